@@ -30,6 +30,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 #include <google/protobuf/timestamp.pb.h>
 // @@protoc_insertion_point(includes)
@@ -93,6 +94,12 @@ extern GetPerformanceAggRequestDefaultTypeInternal _GetPerformanceAggRequest_def
 class GetPerformanceAggResponse;
 struct GetPerformanceAggResponseDefaultTypeInternal;
 extern GetPerformanceAggResponseDefaultTypeInternal _GetPerformanceAggResponse_default_instance_;
+class GetUniquesAggRequest;
+struct GetUniquesAggRequestDefaultTypeInternal;
+extern GetUniquesAggRequestDefaultTypeInternal _GetUniquesAggRequest_default_instance_;
+class GetUniquesAggResponse;
+struct GetUniquesAggResponseDefaultTypeInternal;
+extern GetUniquesAggResponseDefaultTypeInternal _GetUniquesAggResponse_default_instance_;
 class GetWatermarkRequest;
 struct GetWatermarkRequestDefaultTypeInternal;
 extern GetWatermarkRequestDefaultTypeInternal _GetWatermarkRequest_default_instance_;
@@ -102,6 +109,9 @@ extern GetWatermarkResponseDefaultTypeInternal _GetWatermarkResponse_default_ins
 class Pagination;
 struct PaginationDefaultTypeInternal;
 extern PaginationDefaultTypeInternal _Pagination_default_instance_;
+class PerformanceQuantile;
+struct PerformanceQuantileDefaultTypeInternal;
+extern PerformanceQuantileDefaultTypeInternal _PerformanceQuantile_default_instance_;
 class TimeRange;
 struct TimeRangeDefaultTypeInternal;
 extern TimeRangeDefaultTypeInternal _TimeRange_default_instance_;
@@ -123,14 +133,45 @@ template<> ::metricsys::aggregation::GetPageViewsAggRequest* Arena::CreateMaybeM
 template<> ::metricsys::aggregation::GetPageViewsAggResponse* Arena::CreateMaybeMessage<::metricsys::aggregation::GetPageViewsAggResponse>(Arena*);
 template<> ::metricsys::aggregation::GetPerformanceAggRequest* Arena::CreateMaybeMessage<::metricsys::aggregation::GetPerformanceAggRequest>(Arena*);
 template<> ::metricsys::aggregation::GetPerformanceAggResponse* Arena::CreateMaybeMessage<::metricsys::aggregation::GetPerformanceAggResponse>(Arena*);
+template<> ::metricsys::aggregation::GetUniquesAggRequest* Arena::CreateMaybeMessage<::metricsys::aggregation::GetUniquesAggRequest>(Arena*);
+template<> ::metricsys::aggregation::GetUniquesAggResponse* Arena::CreateMaybeMessage<::metricsys::aggregation::GetUniquesAggResponse>(Arena*);
 template<> ::metricsys::aggregation::GetWatermarkRequest* Arena::CreateMaybeMessage<::metricsys::aggregation::GetWatermarkRequest>(Arena*);
 template<> ::metricsys::aggregation::GetWatermarkResponse* Arena::CreateMaybeMessage<::metricsys::aggregation::GetWatermarkResponse>(Arena*);
 template<> ::metricsys::aggregation::Pagination* Arena::CreateMaybeMessage<::metricsys::aggregation::Pagination>(Arena*);
+template<> ::metricsys::aggregation::PerformanceQuantile* Arena::CreateMaybeMessage<::metricsys::aggregation::PerformanceQuantile>(Arena*);
 template<> ::metricsys::aggregation::TimeRange* Arena::CreateMaybeMessage<::metricsys::aggregation::TimeRange>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace metricsys {
 namespace aggregation {
 
+enum UniquesSource : int {
+  UNIQUES_SOURCE_UNSPECIFIED = 0,
+  UNIQUES_SOURCE_PAGE_VIEWS = 1,
+  UNIQUES_SOURCE_CLICKS = 2,
+  UNIQUES_SOURCE_ERRORS = 3,
+  UNIQUES_SOURCE_CUSTOM_EVENTS = 4,
+  UniquesSource_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UniquesSource_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool UniquesSource_IsValid(int value);
+constexpr UniquesSource UniquesSource_MIN = UNIQUES_SOURCE_UNSPECIFIED;
+constexpr UniquesSource UniquesSource_MAX = UNIQUES_SOURCE_CUSTOM_EVENTS;
+constexpr int UniquesSource_ARRAYSIZE = UniquesSource_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UniquesSource_descriptor();
+template<typename T>
+inline const std::string& UniquesSource_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, UniquesSource>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function UniquesSource_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    UniquesSource_descriptor(), enum_t_value);
+}
+inline bool UniquesSource_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UniquesSource* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UniquesSource>(
+    UniquesSource_descriptor(), name, value);
+}
 // ===================================================================
 
 class TimeRange final :
@@ -872,6 +913,7 @@ class AggPageViewsRow final :
     kViewsCountFieldNumber = 4,
     kUniqueUsersFieldNumber = 5,
     kUniqueSessionsFieldNumber = 6,
+    kStepSecondsFieldNumber = 8,
   };
   // string project_id = 2;
   void clear_project_id();
@@ -964,6 +1006,15 @@ class AggPageViewsRow final :
   void _internal_set_unique_sessions(int64_t value);
   public:
 
+  // uint32 step_seconds = 8;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.AggPageViewsRow)
  private:
   class _Internal;
@@ -979,6 +1030,7 @@ class AggPageViewsRow final :
     int64_t views_count_;
     int64_t unique_users_;
     int64_t unique_sessions_;
+    uint32_t step_seconds_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1111,6 +1163,7 @@ class GetPageViewsAggRequest final :
     kPageFieldNumber = 3,
     kTimeRangeFieldNumber = 2,
     kPaginationFieldNumber = 4,
+    kStepSecondsFieldNumber = 5,
   };
   // string project_id = 1;
   void clear_project_id();
@@ -1180,6 +1233,15 @@ class GetPageViewsAggRequest final :
       ::metricsys::aggregation::Pagination* pagination);
   ::metricsys::aggregation::Pagination* unsafe_arena_release_pagination();
 
+  // uint32 step_seconds = 5;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.GetPageViewsAggRequest)
  private:
   class _Internal;
@@ -1194,6 +1256,7 @@ class GetPageViewsAggRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
     ::metricsys::aggregation::TimeRange* time_range_;
     ::metricsys::aggregation::Pagination* pagination_;
+    uint32_t step_seconds_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
@@ -1486,6 +1549,7 @@ class AggClicksRow final :
     kClicksCountFieldNumber = 5,
     kUniqueUsersFieldNumber = 6,
     kUniqueSessionsFieldNumber = 7,
+    kStepSecondsFieldNumber = 9,
   };
   // string project_id = 2;
   void clear_project_id();
@@ -1596,6 +1660,15 @@ class AggClicksRow final :
   void _internal_set_unique_sessions(int64_t value);
   public:
 
+  // uint32 step_seconds = 9;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.AggClicksRow)
  private:
   class _Internal;
@@ -1614,6 +1687,7 @@ class AggClicksRow final :
     int64_t clicks_count_;
     int64_t unique_users_;
     int64_t unique_sessions_;
+    uint32_t step_seconds_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
@@ -1746,6 +1820,7 @@ class GetClicksAggRequest final :
     kElementIdFieldNumber = 4,
     kTimeRangeFieldNumber = 2,
     kPaginationFieldNumber = 5,
+    kStepSecondsFieldNumber = 6,
   };
   // string project_id = 1;
   void clear_project_id();
@@ -1833,6 +1908,15 @@ class GetClicksAggRequest final :
       ::metricsys::aggregation::Pagination* pagination);
   ::metricsys::aggregation::Pagination* unsafe_arena_release_pagination();
 
+  // uint32 step_seconds = 6;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.GetClicksAggRequest)
  private:
   class _Internal;
@@ -1848,6 +1932,7 @@ class GetClicksAggRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr element_id_;
     ::metricsys::aggregation::TimeRange* time_range_;
     ::metricsys::aggregation::Pagination* pagination_;
+    uint32_t step_seconds_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
@@ -2011,6 +2096,198 @@ class GetClicksAggResponse final :
 };
 // -------------------------------------------------------------------
 
+class PerformanceQuantile final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.aggregation.PerformanceQuantile) */ {
+ public:
+  inline PerformanceQuantile() : PerformanceQuantile(nullptr) {}
+  ~PerformanceQuantile() override;
+  explicit PROTOBUF_CONSTEXPR PerformanceQuantile(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PerformanceQuantile(const PerformanceQuantile& from);
+  PerformanceQuantile(PerformanceQuantile&& from) noexcept
+    : PerformanceQuantile() {
+    *this = ::std::move(from);
+  }
+
+  inline PerformanceQuantile& operator=(const PerformanceQuantile& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PerformanceQuantile& operator=(PerformanceQuantile&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PerformanceQuantile& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PerformanceQuantile* internal_default_instance() {
+    return reinterpret_cast<const PerformanceQuantile*>(
+               &_PerformanceQuantile_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(PerformanceQuantile& a, PerformanceQuantile& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PerformanceQuantile* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PerformanceQuantile* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PerformanceQuantile* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PerformanceQuantile>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PerformanceQuantile& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PerformanceQuantile& from) {
+    PerformanceQuantile::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PerformanceQuantile* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.aggregation.PerformanceQuantile";
+  }
+  protected:
+  explicit PerformanceQuantile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kQuantileFieldNumber = 1,
+    kTotalLoadMsFieldNumber = 2,
+    kTtfbMsFieldNumber = 3,
+    kFcpMsFieldNumber = 4,
+    kLcpMsFieldNumber = 5,
+  };
+  // double quantile = 1;
+  void clear_quantile();
+  double quantile() const;
+  void set_quantile(double value);
+  private:
+  double _internal_quantile() const;
+  void _internal_set_quantile(double value);
+  public:
+
+  // double total_load_ms = 2;
+  void clear_total_load_ms();
+  double total_load_ms() const;
+  void set_total_load_ms(double value);
+  private:
+  double _internal_total_load_ms() const;
+  void _internal_set_total_load_ms(double value);
+  public:
+
+  // double ttfb_ms = 3;
+  void clear_ttfb_ms();
+  double ttfb_ms() const;
+  void set_ttfb_ms(double value);
+  private:
+  double _internal_ttfb_ms() const;
+  void _internal_set_ttfb_ms(double value);
+  public:
+
+  // double fcp_ms = 4;
+  void clear_fcp_ms();
+  double fcp_ms() const;
+  void set_fcp_ms(double value);
+  private:
+  double _internal_fcp_ms() const;
+  void _internal_set_fcp_ms(double value);
+  public:
+
+  // double lcp_ms = 5;
+  void clear_lcp_ms();
+  double lcp_ms() const;
+  void set_lcp_ms(double value);
+  private:
+  double _internal_lcp_ms() const;
+  void _internal_set_lcp_ms(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.aggregation.PerformanceQuantile)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double quantile_;
+    double total_load_ms_;
+    double ttfb_ms_;
+    double fcp_ms_;
+    double lcp_ms_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_aggregation_2eproto;
+};
+// -------------------------------------------------------------------
+
 class AggPerformanceRow final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.aggregation.AggPerformanceRow) */ {
  public:
@@ -2059,7 +2336,7 @@ class AggPerformanceRow final :
                &_AggPerformanceRow_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
   friend void swap(AggPerformanceRow& a, AggPerformanceRow& b) {
     a.Swap(&b);
@@ -2132,6 +2409,7 @@ class AggPerformanceRow final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kQuantilesFieldNumber = 14,
     kProjectIdFieldNumber = 2,
     kPageFieldNumber = 3,
     kTimeBucketFieldNumber = 1,
@@ -2145,7 +2423,26 @@ class AggPerformanceRow final :
     kP95FcpMsFieldNumber = 10,
     kAvgLcpMsFieldNumber = 11,
     kP95LcpMsFieldNumber = 12,
+    kStepSecondsFieldNumber = 15,
   };
+  // repeated .metricsys.aggregation.PerformanceQuantile quantiles = 14;
+  int quantiles_size() const;
+  private:
+  int _internal_quantiles_size() const;
+  public:
+  void clear_quantiles();
+  ::metricsys::aggregation::PerformanceQuantile* mutable_quantiles(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::PerformanceQuantile >*
+      mutable_quantiles();
+  private:
+  const ::metricsys::aggregation::PerformanceQuantile& _internal_quantiles(int index) const;
+  ::metricsys::aggregation::PerformanceQuantile* _internal_add_quantiles();
+  public:
+  const ::metricsys::aggregation::PerformanceQuantile& quantiles(int index) const;
+  ::metricsys::aggregation::PerformanceQuantile* add_quantiles();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::PerformanceQuantile >&
+      quantiles() const;
+
   // string project_id = 2;
   void clear_project_id();
   const std::string& project_id() const;
@@ -2291,6 +2588,15 @@ class AggPerformanceRow final :
   void _internal_set_p95_lcp_ms(double value);
   public:
 
+  // uint32 step_seconds = 15;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.AggPerformanceRow)
  private:
   class _Internal;
@@ -2299,6 +2605,7 @@ class AggPerformanceRow final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::PerformanceQuantile > quantiles_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr project_id_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
     ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket_;
@@ -2312,6 +2619,7 @@ class AggPerformanceRow final :
     double p95_fcp_ms_;
     double avg_lcp_ms_;
     double p95_lcp_ms_;
+    uint32_t step_seconds_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2367,7 +2675,7 @@ class GetPerformanceAggRequest final :
                &_GetPerformanceAggRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
   friend void swap(GetPerformanceAggRequest& a, GetPerformanceAggRequest& b) {
     a.Swap(&b);
@@ -2440,11 +2748,36 @@ class GetPerformanceAggRequest final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kQuantilesFieldNumber = 5,
     kProjectIdFieldNumber = 1,
     kPageFieldNumber = 3,
     kTimeRangeFieldNumber = 2,
     kPaginationFieldNumber = 4,
+    kMergeBucketsFieldNumber = 6,
+    kStepSecondsFieldNumber = 7,
   };
+  // repeated double quantiles = 5;
+  int quantiles_size() const;
+  private:
+  int _internal_quantiles_size() const;
+  public:
+  void clear_quantiles();
+  private:
+  double _internal_quantiles(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_quantiles() const;
+  void _internal_add_quantiles(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_quantiles();
+  public:
+  double quantiles(int index) const;
+  void set_quantiles(int index, double value);
+  void add_quantiles(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      quantiles() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_quantiles();
+
   // string project_id = 1;
   void clear_project_id();
   const std::string& project_id() const;
@@ -2513,6 +2846,24 @@ class GetPerformanceAggRequest final :
       ::metricsys::aggregation::Pagination* pagination);
   ::metricsys::aggregation::Pagination* unsafe_arena_release_pagination();
 
+  // bool merge_buckets = 6;
+  void clear_merge_buckets();
+  bool merge_buckets() const;
+  void set_merge_buckets(bool value);
+  private:
+  bool _internal_merge_buckets() const;
+  void _internal_set_merge_buckets(bool value);
+  public:
+
+  // uint32 step_seconds = 7;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.GetPerformanceAggRequest)
  private:
   class _Internal;
@@ -2523,10 +2874,13 @@ class GetPerformanceAggRequest final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > quantiles_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr project_id_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
     ::metricsys::aggregation::TimeRange* time_range_;
     ::metricsys::aggregation::Pagination* pagination_;
+    bool merge_buckets_;
+    uint32_t step_seconds_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
@@ -2581,7 +2935,7 @@ class GetPerformanceAggResponse final :
                &_GetPerformanceAggResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
   friend void swap(GetPerformanceAggResponse& a, GetPerformanceAggResponse& b) {
     a.Swap(&b);
@@ -2738,7 +3092,7 @@ class AggErrorsRow final :
                &_AggErrorsRow_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    14;
 
   friend void swap(AggErrorsRow& a, AggErrorsRow& b) {
     a.Swap(&b);
@@ -2820,6 +3174,7 @@ class AggErrorsRow final :
     kWarningCountFieldNumber = 6,
     kCriticalCountFieldNumber = 7,
     kUniqueUsersFieldNumber = 8,
+    kStepSecondsFieldNumber = 10,
   };
   // string project_id = 2;
   void clear_project_id();
@@ -2939,6 +3294,15 @@ class AggErrorsRow final :
   void _internal_set_unique_users(int64_t value);
   public:
 
+  // uint32 step_seconds = 10;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.AggErrorsRow)
  private:
   class _Internal;
@@ -2958,6 +3322,7 @@ class AggErrorsRow final :
     int64_t warning_count_;
     int64_t critical_count_;
     int64_t unique_users_;
+    uint32_t step_seconds_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
@@ -3012,7 +3377,7 @@ class GetErrorsAggRequest final :
                &_GetErrorsAggRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    15;
 
   friend void swap(GetErrorsAggRequest& a, GetErrorsAggRequest& b) {
     a.Swap(&b);
@@ -3090,6 +3455,7 @@ class GetErrorsAggRequest final :
     kErrorTypeFieldNumber = 4,
     kTimeRangeFieldNumber = 2,
     kPaginationFieldNumber = 5,
+    kStepSecondsFieldNumber = 6,
   };
   // string project_id = 1;
   void clear_project_id();
@@ -3177,6 +3543,15 @@ class GetErrorsAggRequest final :
       ::metricsys::aggregation::Pagination* pagination);
   ::metricsys::aggregation::Pagination* unsafe_arena_release_pagination();
 
+  // uint32 step_seconds = 6;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.GetErrorsAggRequest)
  private:
   class _Internal;
@@ -3192,6 +3567,7 @@ class GetErrorsAggRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_type_;
     ::metricsys::aggregation::TimeRange* time_range_;
     ::metricsys::aggregation::Pagination* pagination_;
+    uint32_t step_seconds_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
@@ -3246,7 +3622,7 @@ class GetErrorsAggResponse final :
                &_GetErrorsAggResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    16;
 
   friend void swap(GetErrorsAggResponse& a, GetErrorsAggResponse& b) {
     a.Swap(&b);
@@ -3403,7 +3779,7 @@ class AggCustomEventsRow final :
                &_AggCustomEventsRow_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    16;
+    17;
 
   friend void swap(AggCustomEventsRow& a, AggCustomEventsRow& b) {
     a.Swap(&b);
@@ -3484,6 +3860,7 @@ class AggCustomEventsRow final :
     kEventsCountFieldNumber = 5,
     kUniqueUsersFieldNumber = 6,
     kUniqueSessionsFieldNumber = 7,
+    kStepSecondsFieldNumber = 9,
   };
   // string project_id = 2;
   void clear_project_id();
@@ -3594,6 +3971,15 @@ class AggCustomEventsRow final :
   void _internal_set_unique_sessions(int64_t value);
   public:
 
+  // uint32 step_seconds = 9;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.AggCustomEventsRow)
  private:
   class _Internal;
@@ -3612,6 +3998,7 @@ class AggCustomEventsRow final :
     int64_t events_count_;
     int64_t unique_users_;
     int64_t unique_sessions_;
+    uint32_t step_seconds_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
@@ -3666,7 +4053,7 @@ class GetCustomEventsAggRequest final :
                &_GetCustomEventsAggRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    17;
+    18;
 
   friend void swap(GetCustomEventsAggRequest& a, GetCustomEventsAggRequest& b) {
     a.Swap(&b);
@@ -3744,6 +4131,7 @@ class GetCustomEventsAggRequest final :
     kPageFieldNumber = 4,
     kTimeRangeFieldNumber = 2,
     kPaginationFieldNumber = 5,
+    kStepSecondsFieldNumber = 6,
   };
   // string project_id = 1;
   void clear_project_id();
@@ -3827,6 +4215,15 @@ class GetCustomEventsAggRequest final :
       ::metricsys::aggregation::Pagination* pagination);
   ::metricsys::aggregation::Pagination* unsafe_arena_release_pagination();
 
+  // uint32 step_seconds = 6;
+  void clear_step_seconds();
+  uint32_t step_seconds() const;
+  void set_step_seconds(uint32_t value);
+  private:
+  uint32_t _internal_step_seconds() const;
+  void _internal_set_step_seconds(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.aggregation.GetCustomEventsAggRequest)
  private:
   class _Internal;
@@ -3842,6 +4239,7 @@ class GetCustomEventsAggRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
     ::metricsys::aggregation::TimeRange* time_range_;
     ::metricsys::aggregation::Pagination* pagination_;
+    uint32_t step_seconds_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
@@ -3896,7 +4294,7 @@ class GetCustomEventsAggResponse final :
                &_GetCustomEventsAggResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    18;
+    19;
 
   friend void swap(GetCustomEventsAggResponse& a, GetCustomEventsAggResponse& b) {
     a.Swap(&b);
@@ -4003,135 +4401,1206 @@ class GetCustomEventsAggResponse final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_aggregation_2eproto;
 };
-// ===================================================================
-
+// -------------------------------------------------------------------
 
-// ===================================================================
+class GetUniquesAggRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.aggregation.GetUniquesAggRequest) */ {
+ public:
+  inline GetUniquesAggRequest() : GetUniquesAggRequest(nullptr) {}
+  ~GetUniquesAggRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetUniquesAggRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// TimeRange
+  GetUniquesAggRequest(const GetUniquesAggRequest& from);
+  GetUniquesAggRequest(GetUniquesAggRequest&& from) noexcept
+    : GetUniquesAggRequest() {
+    *this = ::std::move(from);
+  }
 
-// .google.protobuf.Timestamp from = 1;
-inline bool TimeRange::_internal_has_from() const {
-  return this != internal_default_instance() && _impl_.from_ != nullptr;
-}
-inline bool TimeRange::has_from() const {
-  return _internal_has_from();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& TimeRange::_internal_from() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.from_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
-      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
-}
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& TimeRange::from() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.TimeRange.from)
-  return _internal_from();
-}
-inline void TimeRange::unsafe_arena_set_allocated_from(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* from) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.from_);
+  inline GetUniquesAggRequest& operator=(const GetUniquesAggRequest& from) {
+    CopyFrom(from);
+    return *this;
   }
-  _impl_.from_ = from;
-  if (from) {
-    
-  } else {
-    
+  inline GetUniquesAggRequest& operator=(GetUniquesAggRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.TimeRange.from)
-}
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::release_from() {
-  
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.from_;
-  _impl_.from_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetUniquesAggRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetUniquesAggRequest* internal_default_instance() {
+    return reinterpret_cast<const GetUniquesAggRequest*>(
+               &_GetUniquesAggRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(GetUniquesAggRequest& a, GetUniquesAggRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetUniquesAggRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetUniquesAggRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetUniquesAggRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetUniquesAggRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetUniquesAggRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetUniquesAggRequest& from) {
+    GetUniquesAggRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetUniquesAggRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.aggregation.GetUniquesAggRequest";
+  }
+  protected:
+  explicit GetUniquesAggRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kProjectIdFieldNumber = 1,
+    kPageFieldNumber = 4,
+    kElementIdFieldNumber = 5,
+    kErrorTypeFieldNumber = 6,
+    kEventNameFieldNumber = 7,
+    kTimeRangeFieldNumber = 2,
+    kSourceFieldNumber = 3,
+  };
+  // string project_id = 1;
+  void clear_project_id();
+  const std::string& project_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_project_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_project_id();
+  PROTOBUF_NODISCARD std::string* release_project_id();
+  void set_allocated_project_id(std::string* project_id);
+  private:
+  const std::string& _internal_project_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_project_id(const std::string& value);
+  std::string* _internal_mutable_project_id();
+  public:
+
+  // optional string page = 4;
+  bool has_page() const;
+  private:
+  bool _internal_has_page() const;
+  public:
+  void clear_page();
+  const std::string& page() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page();
+  PROTOBUF_NODISCARD std::string* release_page();
+  void set_allocated_page(std::string* page);
+  private:
+  const std::string& _internal_page() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page(const std::string& value);
+  std::string* _internal_mutable_page();
+  public:
+
+  // optional string element_id = 5;
+  bool has_element_id() const;
+  private:
+  bool _internal_has_element_id() const;
+  public:
+  void clear_element_id();
+  const std::string& element_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_element_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_element_id();
+  PROTOBUF_NODISCARD std::string* release_element_id();
+  void set_allocated_element_id(std::string* element_id);
+  private:
+  const std::string& _internal_element_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_element_id(const std::string& value);
+  std::string* _internal_mutable_element_id();
+  public:
+
+  // optional string error_type = 6;
+  bool has_error_type() const;
+  private:
+  bool _internal_has_error_type() const;
+  public:
+  void clear_error_type();
+  const std::string& error_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_type();
+  PROTOBUF_NODISCARD std::string* release_error_type();
+  void set_allocated_error_type(std::string* error_type);
+  private:
+  const std::string& _internal_error_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_type(const std::string& value);
+  std::string* _internal_mutable_error_type();
+  public:
+
+  // optional string event_name = 7;
+  bool has_event_name() const;
+  private:
+  bool _internal_has_event_name() const;
+  public:
+  void clear_event_name();
+  const std::string& event_name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_event_name();
+  PROTOBUF_NODISCARD std::string* release_event_name();
+  void set_allocated_event_name(std::string* event_name);
+  private:
+  const std::string& _internal_event_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_name(const std::string& value);
+  std::string* _internal_mutable_event_name();
+  public:
+
+  // .metricsys.aggregation.TimeRange time_range = 2;
+  bool has_time_range() const;
+  private:
+  bool _internal_has_time_range() const;
+  public:
+  void clear_time_range();
+  const ::metricsys::aggregation::TimeRange& time_range() const;
+  PROTOBUF_NODISCARD ::metricsys::aggregation::TimeRange* release_time_range();
+  ::metricsys::aggregation::TimeRange* mutable_time_range();
+  void set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range);
+  private:
+  const ::metricsys::aggregation::TimeRange& _internal_time_range() const;
+  ::metricsys::aggregation::TimeRange* _internal_mutable_time_range();
+  public:
+  void unsafe_arena_set_allocated_time_range(
+      ::metricsys::aggregation::TimeRange* time_range);
+  ::metricsys::aggregation::TimeRange* unsafe_arena_release_time_range();
+
+  // .metricsys.aggregation.UniquesSource source = 3;
+  void clear_source();
+  ::metricsys::aggregation::UniquesSource source() const;
+  void set_source(::metricsys::aggregation::UniquesSource value);
+  private:
+  ::metricsys::aggregation::UniquesSource _internal_source() const;
+  void _internal_set_source(::metricsys::aggregation::UniquesSource value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.aggregation.GetUniquesAggRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr project_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr element_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_name_;
+    ::metricsys::aggregation::TimeRange* time_range_;
+    int source_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_aggregation_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetUniquesAggResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.aggregation.GetUniquesAggResponse) */ {
+ public:
+  inline GetUniquesAggResponse() : GetUniquesAggResponse(nullptr) {}
+  ~GetUniquesAggResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetUniquesAggResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetUniquesAggResponse(const GetUniquesAggResponse& from);
+  GetUniquesAggResponse(GetUniquesAggResponse&& from) noexcept
+    : GetUniquesAggResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetUniquesAggResponse& operator=(const GetUniquesAggResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetUniquesAggResponse& operator=(GetUniquesAggResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetUniquesAggResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetUniquesAggResponse* internal_default_instance() {
+    return reinterpret_cast<const GetUniquesAggResponse*>(
+               &_GetUniquesAggResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(GetUniquesAggResponse& a, GetUniquesAggResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetUniquesAggResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetUniquesAggResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetUniquesAggResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetUniquesAggResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetUniquesAggResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetUniquesAggResponse& from) {
+    GetUniquesAggResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetUniquesAggResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.aggregation.GetUniquesAggResponse";
+  }
+  protected:
+  explicit GetUniquesAggResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUniqueUsersFieldNumber = 1,
+    kUniqueSessionsFieldNumber = 2,
+    kBucketsCountFieldNumber = 3,
+  };
+  // int64 unique_users = 1;
+  void clear_unique_users();
+  int64_t unique_users() const;
+  void set_unique_users(int64_t value);
+  private:
+  int64_t _internal_unique_users() const;
+  void _internal_set_unique_users(int64_t value);
+  public:
+
+  // int64 unique_sessions = 2;
+  void clear_unique_sessions();
+  int64_t unique_sessions() const;
+  void set_unique_sessions(int64_t value);
+  private:
+  int64_t _internal_unique_sessions() const;
+  void _internal_set_unique_sessions(int64_t value);
+  public:
+
+  // int64 buckets_count = 3;
+  void clear_buckets_count();
+  int64_t buckets_count() const;
+  void set_buckets_count(int64_t value);
+  private:
+  int64_t _internal_buckets_count() const;
+  void _internal_set_buckets_count(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.aggregation.GetUniquesAggResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t unique_users_;
+    int64_t unique_sessions_;
+    int64_t buckets_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_aggregation_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TimeRange
+
+// .google.protobuf.Timestamp from = 1;
+inline bool TimeRange::_internal_has_from() const {
+  return this != internal_default_instance() && _impl_.from_ != nullptr;
+}
+inline bool TimeRange::has_from() const {
+  return _internal_has_from();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& TimeRange::_internal_from() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.from_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& TimeRange::from() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.TimeRange.from)
+  return _internal_from();
+}
+inline void TimeRange::unsafe_arena_set_allocated_from(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* from) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.from_);
+  }
+  _impl_.from_ = from;
+  if (from) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.TimeRange.from)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::release_from() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.from_;
+  _impl_.from_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::unsafe_arena_release_from() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.TimeRange.from)
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.from_;
+  _impl_.from_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::_internal_mutable_from() {
+  
+  if (_impl_.from_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.from_ = p;
+  }
+  return _impl_.from_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::mutable_from() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_from();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.TimeRange.from)
+  return _msg;
+}
+inline void TimeRange::set_allocated_from(::PROTOBUF_NAMESPACE_ID::Timestamp* from) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.from_);
+  }
+  if (from) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(from));
+    if (message_arena != submessage_arena) {
+      from = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, from, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.from_ = from;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.TimeRange.from)
+}
+
+// .google.protobuf.Timestamp to = 2;
+inline bool TimeRange::_internal_has_to() const {
+  return this != internal_default_instance() && _impl_.to_ != nullptr;
+}
+inline bool TimeRange::has_to() const {
+  return _internal_has_to();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& TimeRange::_internal_to() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.to_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& TimeRange::to() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.TimeRange.to)
+  return _internal_to();
+}
+inline void TimeRange::unsafe_arena_set_allocated_to(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* to) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.to_);
+  }
+  _impl_.to_ = to;
+  if (to) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.TimeRange.to)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::release_to() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.to_;
+  _impl_.to_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::unsafe_arena_release_to() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.TimeRange.to)
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.to_;
+  _impl_.to_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::_internal_mutable_to() {
+  
+  if (_impl_.to_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.to_ = p;
+  }
+  return _impl_.to_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::mutable_to() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_to();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.TimeRange.to)
+  return _msg;
+}
+inline void TimeRange::set_allocated_to(::PROTOBUF_NAMESPACE_ID::Timestamp* to) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.to_);
+  }
+  if (to) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(to));
+    if (message_arena != submessage_arena) {
+      to = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, to, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.to_ = to;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.TimeRange.to)
+}
+
+// -------------------------------------------------------------------
+
+// Pagination
+
+// uint32 limit = 1;
+inline void Pagination::clear_limit() {
+  _impl_.limit_ = 0u;
+}
+inline uint32_t Pagination::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t Pagination::limit() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.Pagination.limit)
+  return _internal_limit();
+}
+inline void Pagination::_internal_set_limit(uint32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void Pagination::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.Pagination.limit)
+}
+
+// uint32 offset = 2;
+inline void Pagination::clear_offset() {
+  _impl_.offset_ = 0u;
+}
+inline uint32_t Pagination::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint32_t Pagination::offset() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.Pagination.offset)
+  return _internal_offset();
+}
+inline void Pagination::_internal_set_offset(uint32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void Pagination::set_offset(uint32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.Pagination.offset)
+}
+
+// -------------------------------------------------------------------
+
+// GetWatermarkRequest
+
+// -------------------------------------------------------------------
+
+// GetWatermarkResponse
+
+// .google.protobuf.Timestamp last_aggregated_at = 1;
+inline bool GetWatermarkResponse::_internal_has_last_aggregated_at() const {
+  return this != internal_default_instance() && _impl_.last_aggregated_at_ != nullptr;
+}
+inline bool GetWatermarkResponse::has_last_aggregated_at() const {
+  return _internal_has_last_aggregated_at();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& GetWatermarkResponse::_internal_last_aggregated_at() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.last_aggregated_at_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& GetWatermarkResponse::last_aggregated_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+  return _internal_last_aggregated_at();
+}
+inline void GetWatermarkResponse::unsafe_arena_set_allocated_last_aggregated_at(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* last_aggregated_at) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.last_aggregated_at_);
+  }
+  _impl_.last_aggregated_at_ = last_aggregated_at;
+  if (last_aggregated_at) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::release_last_aggregated_at() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.last_aggregated_at_;
+  _impl_.last_aggregated_at_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::unsafe_arena_release_last_aggregated_at() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.last_aggregated_at_;
+  _impl_.last_aggregated_at_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::_internal_mutable_last_aggregated_at() {
+  
+  if (_impl_.last_aggregated_at_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.last_aggregated_at_ = p;
+  }
+  return _impl_.last_aggregated_at_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::mutable_last_aggregated_at() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_last_aggregated_at();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+  return _msg;
+}
+inline void GetWatermarkResponse::set_allocated_last_aggregated_at(::PROTOBUF_NAMESPACE_ID::Timestamp* last_aggregated_at) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.last_aggregated_at_);
+  }
+  if (last_aggregated_at) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(last_aggregated_at));
+    if (message_arena != submessage_arena) {
+      last_aggregated_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, last_aggregated_at, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.last_aggregated_at_ = last_aggregated_at;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+}
+
+// -------------------------------------------------------------------
+
+// AggPageViewsRow
+
+// .google.protobuf.Timestamp time_bucket = 1;
+inline bool AggPageViewsRow::_internal_has_time_bucket() const {
+  return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
+}
+inline bool AggPageViewsRow::has_time_bucket() const {
+  return _internal_has_time_bucket();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPageViewsRow::_internal_time_bucket() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPageViewsRow::time_bucket() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.time_bucket)
+  return _internal_time_bucket();
+}
+inline void AggPageViewsRow::unsafe_arena_set_allocated_time_bucket(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
+  }
+  _impl_.time_bucket_ = time_bucket;
+  if (time_bucket) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggPageViewsRow.time_bucket)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::release_time_bucket() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
+  _impl_.time_bucket_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::unsafe_arena_release_time_bucket() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPageViewsRow.time_bucket)
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
+  _impl_.time_bucket_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::_internal_mutable_time_bucket() {
+  
+  if (_impl_.time_bucket_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.time_bucket_ = p;
+  }
+  return _impl_.time_bucket_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::mutable_time_bucket() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPageViewsRow.time_bucket)
+  return _msg;
+}
+inline void AggPageViewsRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
+  }
+  if (time_bucket) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_bucket));
+    if (message_arena != submessage_arena) {
+      time_bucket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_bucket, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.time_bucket_ = time_bucket;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPageViewsRow.time_bucket)
+}
+
+// string project_id = 2;
+inline void AggPageViewsRow::clear_project_id() {
+  _impl_.project_id_.ClearToEmpty();
+}
+inline const std::string& AggPageViewsRow::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.project_id)
+  return _internal_project_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AggPageViewsRow::set_project_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.project_id)
+}
+inline std::string* AggPageViewsRow::mutable_project_id() {
+  std::string* _s = _internal_mutable_project_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPageViewsRow.project_id)
+  return _s;
+}
+inline const std::string& AggPageViewsRow::_internal_project_id() const {
+  return _impl_.project_id_.Get();
+}
+inline void AggPageViewsRow::_internal_set_project_id(const std::string& value) {
+  
+  _impl_.project_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AggPageViewsRow::_internal_mutable_project_id() {
+  
+  return _impl_.project_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AggPageViewsRow::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPageViewsRow.project_id)
+  return _impl_.project_id_.Release();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::unsafe_arena_release_from() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.TimeRange.from)
+inline void AggPageViewsRow::set_allocated_project_id(std::string* project_id) {
+  if (project_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.project_id_.SetAllocated(project_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.project_id_.IsDefault()) {
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPageViewsRow.project_id)
+}
+
+// string page = 3;
+inline void AggPageViewsRow::clear_page() {
+  _impl_.page_.ClearToEmpty();
+}
+inline const std::string& AggPageViewsRow::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.page)
+  return _internal_page();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AggPageViewsRow::set_page(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.page)
+}
+inline std::string* AggPageViewsRow::mutable_page() {
+  std::string* _s = _internal_mutable_page();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPageViewsRow.page)
+  return _s;
+}
+inline const std::string& AggPageViewsRow::_internal_page() const {
+  return _impl_.page_.Get();
+}
+inline void AggPageViewsRow::_internal_set_page(const std::string& value) {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.from_;
-  _impl_.from_ = nullptr;
+  _impl_.page_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AggPageViewsRow::_internal_mutable_page() {
+  
+  return _impl_.page_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AggPageViewsRow::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPageViewsRow.page)
+  return _impl_.page_.Release();
+}
+inline void AggPageViewsRow::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPageViewsRow.page)
+}
+
+// int64 views_count = 4;
+inline void AggPageViewsRow::clear_views_count() {
+  _impl_.views_count_ = int64_t{0};
+}
+inline int64_t AggPageViewsRow::_internal_views_count() const {
+  return _impl_.views_count_;
+}
+inline int64_t AggPageViewsRow::views_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.views_count)
+  return _internal_views_count();
+}
+inline void AggPageViewsRow::_internal_set_views_count(int64_t value) {
+  
+  _impl_.views_count_ = value;
+}
+inline void AggPageViewsRow::set_views_count(int64_t value) {
+  _internal_set_views_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.views_count)
+}
+
+// int64 unique_users = 5;
+inline void AggPageViewsRow::clear_unique_users() {
+  _impl_.unique_users_ = int64_t{0};
+}
+inline int64_t AggPageViewsRow::_internal_unique_users() const {
+  return _impl_.unique_users_;
+}
+inline int64_t AggPageViewsRow::unique_users() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.unique_users)
+  return _internal_unique_users();
+}
+inline void AggPageViewsRow::_internal_set_unique_users(int64_t value) {
+  
+  _impl_.unique_users_ = value;
+}
+inline void AggPageViewsRow::set_unique_users(int64_t value) {
+  _internal_set_unique_users(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.unique_users)
+}
+
+// int64 unique_sessions = 6;
+inline void AggPageViewsRow::clear_unique_sessions() {
+  _impl_.unique_sessions_ = int64_t{0};
+}
+inline int64_t AggPageViewsRow::_internal_unique_sessions() const {
+  return _impl_.unique_sessions_;
+}
+inline int64_t AggPageViewsRow::unique_sessions() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.unique_sessions)
+  return _internal_unique_sessions();
+}
+inline void AggPageViewsRow::_internal_set_unique_sessions(int64_t value) {
+  
+  _impl_.unique_sessions_ = value;
+}
+inline void AggPageViewsRow::set_unique_sessions(int64_t value) {
+  _internal_set_unique_sessions(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.unique_sessions)
+}
+
+// .google.protobuf.Timestamp created_at = 7;
+inline bool AggPageViewsRow::_internal_has_created_at() const {
+  return this != internal_default_instance() && _impl_.created_at_ != nullptr;
+}
+inline bool AggPageViewsRow::has_created_at() const {
+  return _internal_has_created_at();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPageViewsRow::_internal_created_at() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPageViewsRow::created_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.created_at)
+  return _internal_created_at();
+}
+inline void AggPageViewsRow::unsafe_arena_set_allocated_created_at(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+  }
+  _impl_.created_at_ = created_at;
+  if (created_at) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggPageViewsRow.created_at)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::release_created_at() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
+  _impl_.created_at_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::_internal_mutable_from() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::unsafe_arena_release_created_at() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPageViewsRow.created_at)
   
-  if (_impl_.from_ == nullptr) {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
+  _impl_.created_at_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::_internal_mutable_created_at() {
+  
+  if (_impl_.created_at_ == nullptr) {
     auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.from_ = p;
+    _impl_.created_at_ = p;
   }
-  return _impl_.from_;
+  return _impl_.created_at_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::mutable_created_at() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPageViewsRow.created_at)
+  return _msg;
+}
+inline void AggPageViewsRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+  }
+  if (created_at) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(created_at));
+    if (message_arena != submessage_arena) {
+      created_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, created_at, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.created_at_ = created_at;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPageViewsRow.created_at)
+}
+
+// uint32 step_seconds = 8;
+inline void AggPageViewsRow::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
+}
+inline uint32_t AggPageViewsRow::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
+}
+inline uint32_t AggPageViewsRow::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.step_seconds)
+  return _internal_step_seconds();
+}
+inline void AggPageViewsRow::_internal_set_step_seconds(uint32_t value) {
+  
+  _impl_.step_seconds_ = value;
+}
+inline void AggPageViewsRow::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.step_seconds)
+}
+
+// -------------------------------------------------------------------
+
+// GetPageViewsAggRequest
+
+// string project_id = 1;
+inline void GetPageViewsAggRequest::clear_project_id() {
+  _impl_.project_id_.ClearToEmpty();
+}
+inline const std::string& GetPageViewsAggRequest::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+  return _internal_project_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetPageViewsAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+}
+inline std::string* GetPageViewsAggRequest::mutable_project_id() {
+  std::string* _s = _internal_mutable_project_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+  return _s;
+}
+inline const std::string& GetPageViewsAggRequest::_internal_project_id() const {
+  return _impl_.project_id_.Get();
+}
+inline void GetPageViewsAggRequest::_internal_set_project_id(const std::string& value) {
+  
+  _impl_.project_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetPageViewsAggRequest::_internal_mutable_project_id() {
+  
+  return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::mutable_from() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_from();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.TimeRange.from)
-  return _msg;
+inline std::string* GetPageViewsAggRequest::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+  return _impl_.project_id_.Release();
 }
-inline void TimeRange::set_allocated_from(::PROTOBUF_NAMESPACE_ID::Timestamp* from) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.from_);
-  }
-  if (from) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(from));
-    if (message_arena != submessage_arena) {
-      from = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, from, submessage_arena);
-    }
+inline void GetPageViewsAggRequest::set_allocated_project_id(std::string* project_id) {
+  if (project_id != nullptr) {
     
   } else {
     
   }
-  _impl_.from_ = from;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.TimeRange.from)
+  _impl_.project_id_.SetAllocated(project_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.project_id_.IsDefault()) {
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.project_id)
 }
 
-// .google.protobuf.Timestamp to = 2;
-inline bool TimeRange::_internal_has_to() const {
-  return this != internal_default_instance() && _impl_.to_ != nullptr;
+// .metricsys.aggregation.TimeRange time_range = 2;
+inline bool GetPageViewsAggRequest::_internal_has_time_range() const {
+  return this != internal_default_instance() && _impl_.time_range_ != nullptr;
 }
-inline bool TimeRange::has_to() const {
-  return _internal_has_to();
+inline bool GetPageViewsAggRequest::has_time_range() const {
+  return _internal_has_time_range();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& TimeRange::_internal_to() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.to_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
-      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+inline void GetPageViewsAggRequest::clear_time_range() {
+  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
+    delete _impl_.time_range_;
+  }
+  _impl_.time_range_ = nullptr;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& TimeRange::to() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.TimeRange.to)
-  return _internal_to();
+inline const ::metricsys::aggregation::TimeRange& GetPageViewsAggRequest::_internal_time_range() const {
+  const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
+      ::metricsys::aggregation::_TimeRange_default_instance_);
 }
-inline void TimeRange::unsafe_arena_set_allocated_to(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* to) {
+inline const ::metricsys::aggregation::TimeRange& GetPageViewsAggRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetPageViewsAggRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::aggregation::TimeRange* time_range) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.to_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
   }
-  _impl_.to_ = to;
-  if (to) {
+  _impl_.time_range_ = time_range;
+  if (time_range) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.TimeRange.to)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.time_range)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::release_to() {
+inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::release_time_range() {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.to_;
-  _impl_.to_ = nullptr;
+  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -4143,132 +5612,153 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::release_to() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::unsafe_arena_release_to() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.TimeRange.to)
+inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPageViewsAggRequest.time_range)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.to_;
-  _impl_.to_ = nullptr;
+  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::_internal_mutable_to() {
+inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::_internal_mutable_time_range() {
   
-  if (_impl_.to_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.to_ = p;
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
   }
-  return _impl_.to_;
+  return _impl_.time_range_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* TimeRange::mutable_to() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_to();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.TimeRange.to)
+inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::mutable_time_range() {
+  ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggRequest.time_range)
   return _msg;
 }
-inline void TimeRange::set_allocated_to(::PROTOBUF_NAMESPACE_ID::Timestamp* to) {
+inline void GetPageViewsAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.to_);
+    delete _impl_.time_range_;
   }
-  if (to) {
+  if (time_range) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(to));
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
     if (message_arena != submessage_arena) {
-      to = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, to, submessage_arena);
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.to_ = to;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.TimeRange.to)
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.time_range)
 }
 
-// -------------------------------------------------------------------
-
-// Pagination
-
-// uint32 limit = 1;
-inline void Pagination::clear_limit() {
-  _impl_.limit_ = 0u;
+// optional string page = 3;
+inline bool GetPageViewsAggRequest::_internal_has_page() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
 }
-inline uint32_t Pagination::_internal_limit() const {
-  return _impl_.limit_;
+inline bool GetPageViewsAggRequest::has_page() const {
+  return _internal_has_page();
 }
-inline uint32_t Pagination::limit() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.Pagination.limit)
-  return _internal_limit();
+inline void GetPageViewsAggRequest::clear_page() {
+  _impl_.page_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline void Pagination::_internal_set_limit(uint32_t value) {
-  
-  _impl_.limit_ = value;
+inline const std::string& GetPageViewsAggRequest::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.page)
+  return _internal_page();
 }
-inline void Pagination::set_limit(uint32_t value) {
-  _internal_set_limit(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.Pagination.limit)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetPageViewsAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPageViewsAggRequest.page)
 }
-
-// uint32 offset = 2;
-inline void Pagination::clear_offset() {
-  _impl_.offset_ = 0u;
+inline std::string* GetPageViewsAggRequest::mutable_page() {
+  std::string* _s = _internal_mutable_page();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggRequest.page)
+  return _s;
 }
-inline uint32_t Pagination::_internal_offset() const {
-  return _impl_.offset_;
+inline const std::string& GetPageViewsAggRequest::_internal_page() const {
+  return _impl_.page_.Get();
 }
-inline uint32_t Pagination::offset() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.Pagination.offset)
-  return _internal_offset();
+inline void GetPageViewsAggRequest::_internal_set_page(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline void Pagination::_internal_set_offset(uint32_t value) {
-  
-  _impl_.offset_ = value;
+inline std::string* GetPageViewsAggRequest::_internal_mutable_page() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline void Pagination::set_offset(uint32_t value) {
-  _internal_set_offset(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.Pagination.offset)
+inline std::string* GetPageViewsAggRequest::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPageViewsAggRequest.page)
+  if (!_internal_has_page()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetPageViewsAggRequest::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.page)
 }
 
-// -------------------------------------------------------------------
-
-// GetWatermarkRequest
-
-// -------------------------------------------------------------------
-
-// GetWatermarkResponse
-
-// .google.protobuf.Timestamp last_aggregated_at = 1;
-inline bool GetWatermarkResponse::_internal_has_last_aggregated_at() const {
-  return this != internal_default_instance() && _impl_.last_aggregated_at_ != nullptr;
+// .metricsys.aggregation.Pagination pagination = 4;
+inline bool GetPageViewsAggRequest::_internal_has_pagination() const {
+  return this != internal_default_instance() && _impl_.pagination_ != nullptr;
 }
-inline bool GetWatermarkResponse::has_last_aggregated_at() const {
-  return _internal_has_last_aggregated_at();
+inline bool GetPageViewsAggRequest::has_pagination() const {
+  return _internal_has_pagination();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& GetWatermarkResponse::_internal_last_aggregated_at() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.last_aggregated_at_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
-      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+inline void GetPageViewsAggRequest::clear_pagination() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
+    delete _impl_.pagination_;
+  }
+  _impl_.pagination_ = nullptr;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& GetWatermarkResponse::last_aggregated_at() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
-  return _internal_last_aggregated_at();
+inline const ::metricsys::aggregation::Pagination& GetPageViewsAggRequest::_internal_pagination() const {
+  const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
+      ::metricsys::aggregation::_Pagination_default_instance_);
 }
-inline void GetWatermarkResponse::unsafe_arena_set_allocated_last_aggregated_at(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* last_aggregated_at) {
+inline const ::metricsys::aggregation::Pagination& GetPageViewsAggRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.pagination)
+  return _internal_pagination();
+}
+inline void GetPageViewsAggRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::aggregation::Pagination* pagination) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.last_aggregated_at_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
   }
-  _impl_.last_aggregated_at_ = last_aggregated_at;
-  if (last_aggregated_at) {
+  _impl_.pagination_ = pagination;
+  if (pagination) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.pagination)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::release_last_aggregated_at() {
+inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::release_pagination() {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.last_aggregated_at_;
-  _impl_.last_aggregated_at_ = nullptr;
+  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -4280,68 +5770,131 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::release_last_ag
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::unsafe_arena_release_last_aggregated_at() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPageViewsAggRequest.pagination)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.last_aggregated_at_;
-  _impl_.last_aggregated_at_ = nullptr;
+  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::_internal_mutable_last_aggregated_at() {
+inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::_internal_mutable_pagination() {
   
-  if (_impl_.last_aggregated_at_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.last_aggregated_at_ = p;
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
   }
-  return _impl_.last_aggregated_at_;
+  return _impl_.pagination_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* GetWatermarkResponse::mutable_last_aggregated_at() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_last_aggregated_at();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::mutable_pagination() {
+  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggRequest.pagination)
   return _msg;
 }
-inline void GetWatermarkResponse::set_allocated_last_aggregated_at(::PROTOBUF_NAMESPACE_ID::Timestamp* last_aggregated_at) {
+inline void GetPageViewsAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.last_aggregated_at_);
+    delete _impl_.pagination_;
   }
-  if (last_aggregated_at) {
+  if (pagination) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(last_aggregated_at));
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
     if (message_arena != submessage_arena) {
-      last_aggregated_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, last_aggregated_at, submessage_arena);
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.last_aggregated_at_ = last_aggregated_at;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetWatermarkResponse.last_aggregated_at)
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.pagination)
+}
+
+// uint32 step_seconds = 5;
+inline void GetPageViewsAggRequest::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
+}
+inline uint32_t GetPageViewsAggRequest::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
+}
+inline uint32_t GetPageViewsAggRequest::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.step_seconds)
+  return _internal_step_seconds();
+}
+inline void GetPageViewsAggRequest::_internal_set_step_seconds(uint32_t value) {
+  
+  _impl_.step_seconds_ = value;
+}
+inline void GetPageViewsAggRequest::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPageViewsAggRequest.step_seconds)
 }
 
 // -------------------------------------------------------------------
 
-// AggPageViewsRow
+// GetPageViewsAggResponse
+
+// repeated .metricsys.aggregation.AggPageViewsRow rows = 1;
+inline int GetPageViewsAggResponse::_internal_rows_size() const {
+  return _impl_.rows_.size();
+}
+inline int GetPageViewsAggResponse::rows_size() const {
+  return _internal_rows_size();
+}
+inline void GetPageViewsAggResponse::clear_rows() {
+  _impl_.rows_.Clear();
+}
+inline ::metricsys::aggregation::AggPageViewsRow* GetPageViewsAggResponse::mutable_rows(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggResponse.rows)
+  return _impl_.rows_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggPageViewsRow >*
+GetPageViewsAggResponse::mutable_rows() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetPageViewsAggResponse.rows)
+  return &_impl_.rows_;
+}
+inline const ::metricsys::aggregation::AggPageViewsRow& GetPageViewsAggResponse::_internal_rows(int index) const {
+  return _impl_.rows_.Get(index);
+}
+inline const ::metricsys::aggregation::AggPageViewsRow& GetPageViewsAggResponse::rows(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggResponse.rows)
+  return _internal_rows(index);
+}
+inline ::metricsys::aggregation::AggPageViewsRow* GetPageViewsAggResponse::_internal_add_rows() {
+  return _impl_.rows_.Add();
+}
+inline ::metricsys::aggregation::AggPageViewsRow* GetPageViewsAggResponse::add_rows() {
+  ::metricsys::aggregation::AggPageViewsRow* _add = _internal_add_rows();
+  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetPageViewsAggResponse.rows)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggPageViewsRow >&
+GetPageViewsAggResponse::rows() const {
+  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetPageViewsAggResponse.rows)
+  return _impl_.rows_;
+}
+
+// -------------------------------------------------------------------
+
+// AggClicksRow
 
 // .google.protobuf.Timestamp time_bucket = 1;
-inline bool AggPageViewsRow::_internal_has_time_bucket() const {
+inline bool AggClicksRow::_internal_has_time_bucket() const {
   return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
 }
-inline bool AggPageViewsRow::has_time_bucket() const {
+inline bool AggClicksRow::has_time_bucket() const {
   return _internal_has_time_bucket();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPageViewsRow::_internal_time_bucket() const {
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggClicksRow::_internal_time_bucket() const {
   const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
   return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
       ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPageViewsRow::time_bucket() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.time_bucket)
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggClicksRow::time_bucket() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.time_bucket)
   return _internal_time_bucket();
 }
-inline void AggPageViewsRow::unsafe_arena_set_allocated_time_bucket(
+inline void AggClicksRow::unsafe_arena_set_allocated_time_bucket(
     ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
@@ -4352,9 +5905,9 @@ inline void AggPageViewsRow::unsafe_arena_set_allocated_time_bucket(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggPageViewsRow.time_bucket)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggClicksRow.time_bucket)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::release_time_bucket() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::release_time_bucket() {
   
   ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
   _impl_.time_bucket_ = nullptr;
@@ -4369,14 +5922,14 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::release_time_bucket(
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::unsafe_arena_release_time_bucket() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPageViewsRow.time_bucket)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::unsafe_arena_release_time_bucket() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.time_bucket)
   
   ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
   _impl_.time_bucket_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::_internal_mutable_time_bucket() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::_internal_mutable_time_bucket() {
   
   if (_impl_.time_bucket_ == nullptr) {
     auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
@@ -4384,12 +5937,12 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::_internal_mutable_ti
   }
   return _impl_.time_bucket_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::mutable_time_bucket() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::mutable_time_bucket() {
   ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPageViewsRow.time_bucket)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.time_bucket)
   return _msg;
 }
-inline void AggPageViewsRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+inline void AggClicksRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
@@ -4407,45 +5960,45 @@ inline void AggPageViewsRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::
     
   }
   _impl_.time_bucket_ = time_bucket;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPageViewsRow.time_bucket)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.time_bucket)
 }
 
 // string project_id = 2;
-inline void AggPageViewsRow::clear_project_id() {
+inline void AggClicksRow::clear_project_id() {
   _impl_.project_id_.ClearToEmpty();
 }
-inline const std::string& AggPageViewsRow::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.project_id)
+inline const std::string& AggClicksRow::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.project_id)
   return _internal_project_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggPageViewsRow::set_project_id(ArgT0&& arg0, ArgT... args) {
+void AggClicksRow::set_project_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.project_id)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.project_id)
 }
-inline std::string* AggPageViewsRow::mutable_project_id() {
+inline std::string* AggClicksRow::mutable_project_id() {
   std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPageViewsRow.project_id)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.project_id)
   return _s;
 }
-inline const std::string& AggPageViewsRow::_internal_project_id() const {
+inline const std::string& AggClicksRow::_internal_project_id() const {
   return _impl_.project_id_.Get();
 }
-inline void AggPageViewsRow::_internal_set_project_id(const std::string& value) {
+inline void AggClicksRow::_internal_set_project_id(const std::string& value) {
   
   _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggPageViewsRow::_internal_mutable_project_id() {
+inline std::string* AggClicksRow::_internal_mutable_project_id() {
   
   return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* AggPageViewsRow::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPageViewsRow.project_id)
+inline std::string* AggClicksRow::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.project_id)
   return _impl_.project_id_.Release();
 }
-inline void AggPageViewsRow::set_allocated_project_id(std::string* project_id) {
+inline void AggClicksRow::set_allocated_project_id(std::string* project_id) {
   if (project_id != nullptr) {
     
   } else {
@@ -4457,136 +6010,204 @@ inline void AggPageViewsRow::set_allocated_project_id(std::string* project_id) {
     _impl_.project_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPageViewsRow.project_id)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.project_id)
 }
 
 // string page = 3;
-inline void AggPageViewsRow::clear_page() {
+inline void AggClicksRow::clear_page() {
   _impl_.page_.ClearToEmpty();
 }
-inline const std::string& AggPageViewsRow::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.page)
+inline const std::string& AggClicksRow::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.page)
   return _internal_page();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggPageViewsRow::set_page(ArgT0&& arg0, ArgT... args) {
+void AggClicksRow::set_page(ArgT0&& arg0, ArgT... args) {
  
  _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.page)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.page)
 }
-inline std::string* AggPageViewsRow::mutable_page() {
+inline std::string* AggClicksRow::mutable_page() {
   std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPageViewsRow.page)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.page)
   return _s;
 }
-inline const std::string& AggPageViewsRow::_internal_page() const {
+inline const std::string& AggClicksRow::_internal_page() const {
   return _impl_.page_.Get();
 }
-inline void AggPageViewsRow::_internal_set_page(const std::string& value) {
+inline void AggClicksRow::_internal_set_page(const std::string& value) {
   
   _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggPageViewsRow::_internal_mutable_page() {
+inline std::string* AggClicksRow::_internal_mutable_page() {
   
   return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline std::string* AggPageViewsRow::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPageViewsRow.page)
+inline std::string* AggClicksRow::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.page)
   return _impl_.page_.Release();
 }
-inline void AggPageViewsRow::set_allocated_page(std::string* page) {
+inline void AggClicksRow::set_allocated_page(std::string* page) {
   if (page != nullptr) {
     
   } else {
-    
+    
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.page)
+}
+
+// optional string element_id = 4;
+inline bool AggClicksRow::_internal_has_element_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool AggClicksRow::has_element_id() const {
+  return _internal_has_element_id();
+}
+inline void AggClicksRow::clear_element_id() {
+  _impl_.element_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& AggClicksRow::element_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.element_id)
+  return _internal_element_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AggClicksRow::set_element_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.element_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.element_id)
+}
+inline std::string* AggClicksRow::mutable_element_id() {
+  std::string* _s = _internal_mutable_element_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.element_id)
+  return _s;
+}
+inline const std::string& AggClicksRow::_internal_element_id() const {
+  return _impl_.element_id_.Get();
+}
+inline void AggClicksRow::_internal_set_element_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.element_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AggClicksRow::_internal_mutable_element_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.element_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AggClicksRow::release_element_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.element_id)
+  if (!_internal_has_element_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.element_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.element_id_.IsDefault()) {
+    _impl_.element_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void AggClicksRow::set_allocated_element_id(std::string* element_id) {
+  if (element_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+  _impl_.element_id_.SetAllocated(element_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
+  if (_impl_.element_id_.IsDefault()) {
+    _impl_.element_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPageViewsRow.page)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.element_id)
 }
 
-// int64 views_count = 4;
-inline void AggPageViewsRow::clear_views_count() {
-  _impl_.views_count_ = int64_t{0};
+// int64 clicks_count = 5;
+inline void AggClicksRow::clear_clicks_count() {
+  _impl_.clicks_count_ = int64_t{0};
 }
-inline int64_t AggPageViewsRow::_internal_views_count() const {
-  return _impl_.views_count_;
+inline int64_t AggClicksRow::_internal_clicks_count() const {
+  return _impl_.clicks_count_;
 }
-inline int64_t AggPageViewsRow::views_count() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.views_count)
-  return _internal_views_count();
+inline int64_t AggClicksRow::clicks_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.clicks_count)
+  return _internal_clicks_count();
 }
-inline void AggPageViewsRow::_internal_set_views_count(int64_t value) {
+inline void AggClicksRow::_internal_set_clicks_count(int64_t value) {
   
-  _impl_.views_count_ = value;
+  _impl_.clicks_count_ = value;
 }
-inline void AggPageViewsRow::set_views_count(int64_t value) {
-  _internal_set_views_count(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.views_count)
+inline void AggClicksRow::set_clicks_count(int64_t value) {
+  _internal_set_clicks_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.clicks_count)
 }
 
-// int64 unique_users = 5;
-inline void AggPageViewsRow::clear_unique_users() {
+// int64 unique_users = 6;
+inline void AggClicksRow::clear_unique_users() {
   _impl_.unique_users_ = int64_t{0};
 }
-inline int64_t AggPageViewsRow::_internal_unique_users() const {
+inline int64_t AggClicksRow::_internal_unique_users() const {
   return _impl_.unique_users_;
 }
-inline int64_t AggPageViewsRow::unique_users() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.unique_users)
+inline int64_t AggClicksRow::unique_users() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.unique_users)
   return _internal_unique_users();
 }
-inline void AggPageViewsRow::_internal_set_unique_users(int64_t value) {
+inline void AggClicksRow::_internal_set_unique_users(int64_t value) {
   
   _impl_.unique_users_ = value;
 }
-inline void AggPageViewsRow::set_unique_users(int64_t value) {
+inline void AggClicksRow::set_unique_users(int64_t value) {
   _internal_set_unique_users(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.unique_users)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.unique_users)
 }
 
-// int64 unique_sessions = 6;
-inline void AggPageViewsRow::clear_unique_sessions() {
+// int64 unique_sessions = 7;
+inline void AggClicksRow::clear_unique_sessions() {
   _impl_.unique_sessions_ = int64_t{0};
 }
-inline int64_t AggPageViewsRow::_internal_unique_sessions() const {
+inline int64_t AggClicksRow::_internal_unique_sessions() const {
   return _impl_.unique_sessions_;
 }
-inline int64_t AggPageViewsRow::unique_sessions() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.unique_sessions)
+inline int64_t AggClicksRow::unique_sessions() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.unique_sessions)
   return _internal_unique_sessions();
 }
-inline void AggPageViewsRow::_internal_set_unique_sessions(int64_t value) {
+inline void AggClicksRow::_internal_set_unique_sessions(int64_t value) {
   
   _impl_.unique_sessions_ = value;
 }
-inline void AggPageViewsRow::set_unique_sessions(int64_t value) {
+inline void AggClicksRow::set_unique_sessions(int64_t value) {
   _internal_set_unique_sessions(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPageViewsRow.unique_sessions)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.unique_sessions)
 }
 
-// .google.protobuf.Timestamp created_at = 7;
-inline bool AggPageViewsRow::_internal_has_created_at() const {
+// .google.protobuf.Timestamp created_at = 8;
+inline bool AggClicksRow::_internal_has_created_at() const {
   return this != internal_default_instance() && _impl_.created_at_ != nullptr;
 }
-inline bool AggPageViewsRow::has_created_at() const {
+inline bool AggClicksRow::has_created_at() const {
   return _internal_has_created_at();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPageViewsRow::_internal_created_at() const {
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggClicksRow::_internal_created_at() const {
   const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
   return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
       ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPageViewsRow::created_at() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPageViewsRow.created_at)
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggClicksRow::created_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.created_at)
   return _internal_created_at();
 }
-inline void AggPageViewsRow::unsafe_arena_set_allocated_created_at(
+inline void AggClicksRow::unsafe_arena_set_allocated_created_at(
     ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
@@ -4597,9 +6218,9 @@ inline void AggPageViewsRow::unsafe_arena_set_allocated_created_at(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggPageViewsRow.created_at)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggClicksRow.created_at)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::release_created_at() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::release_created_at() {
   
   ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
   _impl_.created_at_ = nullptr;
@@ -4614,14 +6235,14 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::release_created_at()
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::unsafe_arena_release_created_at() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPageViewsRow.created_at)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::unsafe_arena_release_created_at() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.created_at)
   
   ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
   _impl_.created_at_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::_internal_mutable_created_at() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::_internal_mutable_created_at() {
   
   if (_impl_.created_at_ == nullptr) {
     auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
@@ -4629,12 +6250,12 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::_internal_mutable_cr
   }
   return _impl_.created_at_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPageViewsRow::mutable_created_at() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::mutable_created_at() {
   ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPageViewsRow.created_at)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.created_at)
   return _msg;
 }
-inline void AggPageViewsRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline void AggClicksRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
@@ -4652,49 +6273,69 @@ inline void AggPageViewsRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::T
     
   }
   _impl_.created_at_ = created_at;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPageViewsRow.created_at)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.created_at)
+}
+
+// uint32 step_seconds = 9;
+inline void AggClicksRow::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
+}
+inline uint32_t AggClicksRow::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
+}
+inline uint32_t AggClicksRow::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.step_seconds)
+  return _internal_step_seconds();
+}
+inline void AggClicksRow::_internal_set_step_seconds(uint32_t value) {
+  
+  _impl_.step_seconds_ = value;
+}
+inline void AggClicksRow::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.step_seconds)
 }
 
 // -------------------------------------------------------------------
 
-// GetPageViewsAggRequest
+// GetClicksAggRequest
 
 // string project_id = 1;
-inline void GetPageViewsAggRequest::clear_project_id() {
+inline void GetClicksAggRequest::clear_project_id() {
   _impl_.project_id_.ClearToEmpty();
 }
-inline const std::string& GetPageViewsAggRequest::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+inline const std::string& GetClicksAggRequest::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.project_id)
   return _internal_project_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetPageViewsAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
+void GetClicksAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetClicksAggRequest.project_id)
 }
-inline std::string* GetPageViewsAggRequest::mutable_project_id() {
+inline std::string* GetClicksAggRequest::mutable_project_id() {
   std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.project_id)
   return _s;
 }
-inline const std::string& GetPageViewsAggRequest::_internal_project_id() const {
+inline const std::string& GetClicksAggRequest::_internal_project_id() const {
   return _impl_.project_id_.Get();
 }
-inline void GetPageViewsAggRequest::_internal_set_project_id(const std::string& value) {
+inline void GetClicksAggRequest::_internal_set_project_id(const std::string& value) {
   
   _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetPageViewsAggRequest::_internal_mutable_project_id() {
+inline std::string* GetClicksAggRequest::_internal_mutable_project_id() {
   
   return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetPageViewsAggRequest::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+inline std::string* GetClicksAggRequest::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.project_id)
   return _impl_.project_id_.Release();
 }
-inline void GetPageViewsAggRequest::set_allocated_project_id(std::string* project_id) {
+inline void GetClicksAggRequest::set_allocated_project_id(std::string* project_id) {
   if (project_id != nullptr) {
     
   } else {
@@ -4706,32 +6347,32 @@ inline void GetPageViewsAggRequest::set_allocated_project_id(std::string* projec
     _impl_.project_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.project_id)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.project_id)
 }
 
 // .metricsys.aggregation.TimeRange time_range = 2;
-inline bool GetPageViewsAggRequest::_internal_has_time_range() const {
+inline bool GetClicksAggRequest::_internal_has_time_range() const {
   return this != internal_default_instance() && _impl_.time_range_ != nullptr;
 }
-inline bool GetPageViewsAggRequest::has_time_range() const {
+inline bool GetClicksAggRequest::has_time_range() const {
   return _internal_has_time_range();
 }
-inline void GetPageViewsAggRequest::clear_time_range() {
+inline void GetClicksAggRequest::clear_time_range() {
   if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
     delete _impl_.time_range_;
   }
   _impl_.time_range_ = nullptr;
 }
-inline const ::metricsys::aggregation::TimeRange& GetPageViewsAggRequest::_internal_time_range() const {
+inline const ::metricsys::aggregation::TimeRange& GetClicksAggRequest::_internal_time_range() const {
   const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
   return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
       ::metricsys::aggregation::_TimeRange_default_instance_);
 }
-inline const ::metricsys::aggregation::TimeRange& GetPageViewsAggRequest::time_range() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.time_range)
+inline const ::metricsys::aggregation::TimeRange& GetClicksAggRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.time_range)
   return _internal_time_range();
 }
-inline void GetPageViewsAggRequest::unsafe_arena_set_allocated_time_range(
+inline void GetClicksAggRequest::unsafe_arena_set_allocated_time_range(
     ::metricsys::aggregation::TimeRange* time_range) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
@@ -4742,9 +6383,9 @@ inline void GetPageViewsAggRequest::unsafe_arena_set_allocated_time_range(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.time_range)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetClicksAggRequest.time_range)
 }
-inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::release_time_range() {
+inline ::metricsys::aggregation::TimeRange* GetClicksAggRequest::release_time_range() {
   
   ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
   _impl_.time_range_ = nullptr;
@@ -4759,14 +6400,14 @@ inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::release_time
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::unsafe_arena_release_time_range() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPageViewsAggRequest.time_range)
+inline ::metricsys::aggregation::TimeRange* GetClicksAggRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.time_range)
   
   ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
   _impl_.time_range_ = nullptr;
   return temp;
 }
-inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::_internal_mutable_time_range() {
+inline ::metricsys::aggregation::TimeRange* GetClicksAggRequest::_internal_mutable_time_range() {
   
   if (_impl_.time_range_ == nullptr) {
     auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
@@ -4774,12 +6415,12 @@ inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::_internal_mu
   }
   return _impl_.time_range_;
 }
-inline ::metricsys::aggregation::TimeRange* GetPageViewsAggRequest::mutable_time_range() {
+inline ::metricsys::aggregation::TimeRange* GetClicksAggRequest::mutable_time_range() {
   ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggRequest.time_range)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.time_range)
   return _msg;
 }
-inline void GetPageViewsAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
+inline void GetClicksAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.time_range_;
@@ -4796,100 +6437,168 @@ inline void GetPageViewsAggRequest::set_allocated_time_range(::metricsys::aggreg
     
   }
   _impl_.time_range_ = time_range;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.time_range)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.time_range)
 }
 
 // optional string page = 3;
-inline bool GetPageViewsAggRequest::_internal_has_page() const {
+inline bool GetClicksAggRequest::_internal_has_page() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool GetPageViewsAggRequest::has_page() const {
+inline bool GetClicksAggRequest::has_page() const {
   return _internal_has_page();
 }
-inline void GetPageViewsAggRequest::clear_page() {
+inline void GetClicksAggRequest::clear_page() {
   _impl_.page_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& GetPageViewsAggRequest::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.page)
+inline const std::string& GetClicksAggRequest::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.page)
   return _internal_page();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetPageViewsAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
+void GetClicksAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPageViewsAggRequest.page)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetClicksAggRequest.page)
 }
-inline std::string* GetPageViewsAggRequest::mutable_page() {
+inline std::string* GetClicksAggRequest::mutable_page() {
   std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggRequest.page)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.page)
   return _s;
 }
-inline const std::string& GetPageViewsAggRequest::_internal_page() const {
+inline const std::string& GetClicksAggRequest::_internal_page() const {
   return _impl_.page_.Get();
 }
-inline void GetPageViewsAggRequest::_internal_set_page(const std::string& value) {
+inline void GetClicksAggRequest::_internal_set_page(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetPageViewsAggRequest::_internal_mutable_page() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.page_.Mutable(GetArenaForAllocation());
+inline std::string* GetClicksAggRequest::_internal_mutable_page() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.page_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetClicksAggRequest::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.page)
+  if (!_internal_has_page()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetClicksAggRequest::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.page)
+}
+
+// optional string element_id = 4;
+inline bool GetClicksAggRequest::_internal_has_element_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetClicksAggRequest::has_element_id() const {
+  return _internal_has_element_id();
+}
+inline void GetClicksAggRequest::clear_element_id() {
+  _impl_.element_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetClicksAggRequest::element_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.element_id)
+  return _internal_element_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetClicksAggRequest::set_element_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.element_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetClicksAggRequest.element_id)
+}
+inline std::string* GetClicksAggRequest::mutable_element_id() {
+  std::string* _s = _internal_mutable_element_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.element_id)
+  return _s;
+}
+inline const std::string& GetClicksAggRequest::_internal_element_id() const {
+  return _impl_.element_id_.Get();
+}
+inline void GetClicksAggRequest::_internal_set_element_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.element_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetClicksAggRequest::_internal_mutable_element_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.element_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetPageViewsAggRequest::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPageViewsAggRequest.page)
-  if (!_internal_has_page()) {
+inline std::string* GetClicksAggRequest::release_element_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.element_id)
+  if (!_internal_has_element_id()) {
     return nullptr;
   }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.page_.Release();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.element_id_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
+  if (_impl_.element_id_.IsDefault()) {
+    _impl_.element_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void GetPageViewsAggRequest::set_allocated_page(std::string* page) {
-  if (page != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+inline void GetClicksAggRequest::set_allocated_element_id(std::string* element_id) {
+  if (element_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+  _impl_.element_id_.SetAllocated(element_id, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
+  if (_impl_.element_id_.IsDefault()) {
+    _impl_.element_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.page)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.element_id)
 }
 
-// .metricsys.aggregation.Pagination pagination = 4;
-inline bool GetPageViewsAggRequest::_internal_has_pagination() const {
+// .metricsys.aggregation.Pagination pagination = 5;
+inline bool GetClicksAggRequest::_internal_has_pagination() const {
   return this != internal_default_instance() && _impl_.pagination_ != nullptr;
 }
-inline bool GetPageViewsAggRequest::has_pagination() const {
+inline bool GetClicksAggRequest::has_pagination() const {
   return _internal_has_pagination();
 }
-inline void GetPageViewsAggRequest::clear_pagination() {
+inline void GetClicksAggRequest::clear_pagination() {
   if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
     delete _impl_.pagination_;
   }
   _impl_.pagination_ = nullptr;
 }
-inline const ::metricsys::aggregation::Pagination& GetPageViewsAggRequest::_internal_pagination() const {
+inline const ::metricsys::aggregation::Pagination& GetClicksAggRequest::_internal_pagination() const {
   const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
   return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
       ::metricsys::aggregation::_Pagination_default_instance_);
 }
-inline const ::metricsys::aggregation::Pagination& GetPageViewsAggRequest::pagination() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggRequest.pagination)
+inline const ::metricsys::aggregation::Pagination& GetClicksAggRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.pagination)
   return _internal_pagination();
 }
-inline void GetPageViewsAggRequest::unsafe_arena_set_allocated_pagination(
+inline void GetClicksAggRequest::unsafe_arena_set_allocated_pagination(
     ::metricsys::aggregation::Pagination* pagination) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
@@ -4900,9 +6609,9 @@ inline void GetPageViewsAggRequest::unsafe_arena_set_allocated_pagination(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.pagination)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetClicksAggRequest.pagination)
 }
-inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::release_pagination() {
+inline ::metricsys::aggregation::Pagination* GetClicksAggRequest::release_pagination() {
   
   ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
   _impl_.pagination_ = nullptr;
@@ -4917,440 +6626,251 @@ inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::release_pag
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::unsafe_arena_release_pagination() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPageViewsAggRequest.pagination)
+inline ::metricsys::aggregation::Pagination* GetClicksAggRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.pagination)
   
   ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
   _impl_.pagination_ = nullptr;
   return temp;
 }
-inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::_internal_mutable_pagination() {
+inline ::metricsys::aggregation::Pagination* GetClicksAggRequest::_internal_mutable_pagination() {
   
   if (_impl_.pagination_ == nullptr) {
     auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
     _impl_.pagination_ = p;
-  }
-  return _impl_.pagination_;
-}
-inline ::metricsys::aggregation::Pagination* GetPageViewsAggRequest::mutable_pagination() {
-  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggRequest.pagination)
-  return _msg;
-}
-inline void GetPageViewsAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.pagination_;
-  }
-  if (pagination) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
-    if (message_arena != submessage_arena) {
-      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pagination, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.pagination_ = pagination;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPageViewsAggRequest.pagination)
-}
-
-// -------------------------------------------------------------------
-
-// GetPageViewsAggResponse
-
-// repeated .metricsys.aggregation.AggPageViewsRow rows = 1;
-inline int GetPageViewsAggResponse::_internal_rows_size() const {
-  return _impl_.rows_.size();
-}
-inline int GetPageViewsAggResponse::rows_size() const {
-  return _internal_rows_size();
-}
-inline void GetPageViewsAggResponse::clear_rows() {
-  _impl_.rows_.Clear();
-}
-inline ::metricsys::aggregation::AggPageViewsRow* GetPageViewsAggResponse::mutable_rows(int index) {
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPageViewsAggResponse.rows)
-  return _impl_.rows_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggPageViewsRow >*
-GetPageViewsAggResponse::mutable_rows() {
-  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetPageViewsAggResponse.rows)
-  return &_impl_.rows_;
-}
-inline const ::metricsys::aggregation::AggPageViewsRow& GetPageViewsAggResponse::_internal_rows(int index) const {
-  return _impl_.rows_.Get(index);
-}
-inline const ::metricsys::aggregation::AggPageViewsRow& GetPageViewsAggResponse::rows(int index) const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPageViewsAggResponse.rows)
-  return _internal_rows(index);
-}
-inline ::metricsys::aggregation::AggPageViewsRow* GetPageViewsAggResponse::_internal_add_rows() {
-  return _impl_.rows_.Add();
-}
-inline ::metricsys::aggregation::AggPageViewsRow* GetPageViewsAggResponse::add_rows() {
-  ::metricsys::aggregation::AggPageViewsRow* _add = _internal_add_rows();
-  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetPageViewsAggResponse.rows)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggPageViewsRow >&
-GetPageViewsAggResponse::rows() const {
-  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetPageViewsAggResponse.rows)
-  return _impl_.rows_;
-}
-
-// -------------------------------------------------------------------
-
-// AggClicksRow
-
-// .google.protobuf.Timestamp time_bucket = 1;
-inline bool AggClicksRow::_internal_has_time_bucket() const {
-  return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
-}
-inline bool AggClicksRow::has_time_bucket() const {
-  return _internal_has_time_bucket();
-}
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggClicksRow::_internal_time_bucket() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
-      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
-}
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggClicksRow::time_bucket() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.time_bucket)
-  return _internal_time_bucket();
-}
-inline void AggClicksRow::unsafe_arena_set_allocated_time_bucket(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
-  }
-  _impl_.time_bucket_ = time_bucket;
-  if (time_bucket) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggClicksRow.time_bucket)
-}
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::release_time_bucket() {
-  
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
-  _impl_.time_bucket_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::unsafe_arena_release_time_bucket() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.time_bucket)
-  
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
-  _impl_.time_bucket_ = nullptr;
-  return temp;
-}
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::_internal_mutable_time_bucket() {
-  
-  if (_impl_.time_bucket_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.time_bucket_ = p;
-  }
-  return _impl_.time_bucket_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::mutable_time_bucket() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.time_bucket)
-  return _msg;
-}
-inline void AggClicksRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
-  }
-  if (time_bucket) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_bucket));
-    if (message_arena != submessage_arena) {
-      time_bucket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, time_bucket, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.time_bucket_ = time_bucket;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.time_bucket)
-}
-
-// string project_id = 2;
-inline void AggClicksRow::clear_project_id() {
-  _impl_.project_id_.ClearToEmpty();
-}
-inline const std::string& AggClicksRow::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.project_id)
-  return _internal_project_id();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void AggClicksRow::set_project_id(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.project_id)
-}
-inline std::string* AggClicksRow::mutable_project_id() {
-  std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.project_id)
-  return _s;
-}
-inline const std::string& AggClicksRow::_internal_project_id() const {
-  return _impl_.project_id_.Get();
-}
-inline void AggClicksRow::_internal_set_project_id(const std::string& value) {
-  
-  _impl_.project_id_.Set(value, GetArenaForAllocation());
-}
-inline std::string* AggClicksRow::_internal_mutable_project_id() {
-  
-  return _impl_.project_id_.Mutable(GetArenaForAllocation());
+  }
+  return _impl_.pagination_;
 }
-inline std::string* AggClicksRow::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.project_id)
-  return _impl_.project_id_.Release();
+inline ::metricsys::aggregation::Pagination* GetClicksAggRequest::mutable_pagination() {
+  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.pagination)
+  return _msg;
 }
-inline void AggClicksRow::set_allocated_project_id(std::string* project_id) {
-  if (project_id != nullptr) {
+inline void GetClicksAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pagination_;
+  }
+  if (pagination) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+    if (message_arena != submessage_arena) {
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
+    }
     
   } else {
     
   }
-  _impl_.project_id_.SetAllocated(project_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.project_id_.IsDefault()) {
-    _impl_.project_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.project_id)
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.pagination)
 }
 
-// string page = 3;
-inline void AggClicksRow::clear_page() {
-  _impl_.page_.ClearToEmpty();
+// uint32 step_seconds = 6;
+inline void GetClicksAggRequest::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
 }
-inline const std::string& AggClicksRow::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.page)
-  return _internal_page();
+inline uint32_t GetClicksAggRequest::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void AggClicksRow::set_page(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.page)
+inline uint32_t GetClicksAggRequest::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.step_seconds)
+  return _internal_step_seconds();
 }
-inline std::string* AggClicksRow::mutable_page() {
-  std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.page)
-  return _s;
+inline void GetClicksAggRequest::_internal_set_step_seconds(uint32_t value) {
+  
+  _impl_.step_seconds_ = value;
 }
-inline const std::string& AggClicksRow::_internal_page() const {
-  return _impl_.page_.Get();
+inline void GetClicksAggRequest::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetClicksAggRequest.step_seconds)
 }
-inline void AggClicksRow::_internal_set_page(const std::string& value) {
-  
-  _impl_.page_.Set(value, GetArenaForAllocation());
+
+// -------------------------------------------------------------------
+
+// GetClicksAggResponse
+
+// repeated .metricsys.aggregation.AggClicksRow rows = 1;
+inline int GetClicksAggResponse::_internal_rows_size() const {
+  return _impl_.rows_.size();
 }
-inline std::string* AggClicksRow::_internal_mutable_page() {
-  
-  return _impl_.page_.Mutable(GetArenaForAllocation());
+inline int GetClicksAggResponse::rows_size() const {
+  return _internal_rows_size();
 }
-inline std::string* AggClicksRow::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.page)
-  return _impl_.page_.Release();
+inline void GetClicksAggResponse::clear_rows() {
+  _impl_.rows_.Clear();
 }
-inline void AggClicksRow::set_allocated_page(std::string* page) {
-  if (page != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.page)
+inline ::metricsys::aggregation::AggClicksRow* GetClicksAggResponse::mutable_rows(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggResponse.rows)
+  return _impl_.rows_.Mutable(index);
 }
-
-// optional string element_id = 4;
-inline bool AggClicksRow::_internal_has_element_id() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggClicksRow >*
+GetClicksAggResponse::mutable_rows() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetClicksAggResponse.rows)
+  return &_impl_.rows_;
 }
-inline bool AggClicksRow::has_element_id() const {
-  return _internal_has_element_id();
+inline const ::metricsys::aggregation::AggClicksRow& GetClicksAggResponse::_internal_rows(int index) const {
+  return _impl_.rows_.Get(index);
 }
-inline void AggClicksRow::clear_element_id() {
-  _impl_.element_id_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+inline const ::metricsys::aggregation::AggClicksRow& GetClicksAggResponse::rows(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggResponse.rows)
+  return _internal_rows(index);
 }
-inline const std::string& AggClicksRow::element_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.element_id)
-  return _internal_element_id();
+inline ::metricsys::aggregation::AggClicksRow* GetClicksAggResponse::_internal_add_rows() {
+  return _impl_.rows_.Add();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void AggClicksRow::set_element_id(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.element_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.element_id)
+inline ::metricsys::aggregation::AggClicksRow* GetClicksAggResponse::add_rows() {
+  ::metricsys::aggregation::AggClicksRow* _add = _internal_add_rows();
+  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetClicksAggResponse.rows)
+  return _add;
 }
-inline std::string* AggClicksRow::mutable_element_id() {
-  std::string* _s = _internal_mutable_element_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.element_id)
-  return _s;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggClicksRow >&
+GetClicksAggResponse::rows() const {
+  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetClicksAggResponse.rows)
+  return _impl_.rows_;
 }
-inline const std::string& AggClicksRow::_internal_element_id() const {
-  return _impl_.element_id_.Get();
+
+// -------------------------------------------------------------------
+
+// PerformanceQuantile
+
+// double quantile = 1;
+inline void PerformanceQuantile::clear_quantile() {
+  _impl_.quantile_ = 0;
 }
-inline void AggClicksRow::_internal_set_element_id(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.element_id_.Set(value, GetArenaForAllocation());
+inline double PerformanceQuantile::_internal_quantile() const {
+  return _impl_.quantile_;
 }
-inline std::string* AggClicksRow::_internal_mutable_element_id() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.element_id_.Mutable(GetArenaForAllocation());
+inline double PerformanceQuantile::quantile() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.PerformanceQuantile.quantile)
+  return _internal_quantile();
 }
-inline std::string* AggClicksRow::release_element_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.element_id)
-  if (!_internal_has_element_id()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.element_id_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.element_id_.IsDefault()) {
-    _impl_.element_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline void PerformanceQuantile::_internal_set_quantile(double value) {
+  
+  _impl_.quantile_ = value;
 }
-inline void AggClicksRow::set_allocated_element_id(std::string* element_id) {
-  if (element_id != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.element_id_.SetAllocated(element_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.element_id_.IsDefault()) {
-    _impl_.element_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.element_id)
+inline void PerformanceQuantile::set_quantile(double value) {
+  _internal_set_quantile(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.PerformanceQuantile.quantile)
 }
 
-// int64 clicks_count = 5;
-inline void AggClicksRow::clear_clicks_count() {
-  _impl_.clicks_count_ = int64_t{0};
+// double total_load_ms = 2;
+inline void PerformanceQuantile::clear_total_load_ms() {
+  _impl_.total_load_ms_ = 0;
 }
-inline int64_t AggClicksRow::_internal_clicks_count() const {
-  return _impl_.clicks_count_;
+inline double PerformanceQuantile::_internal_total_load_ms() const {
+  return _impl_.total_load_ms_;
 }
-inline int64_t AggClicksRow::clicks_count() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.clicks_count)
-  return _internal_clicks_count();
+inline double PerformanceQuantile::total_load_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.PerformanceQuantile.total_load_ms)
+  return _internal_total_load_ms();
 }
-inline void AggClicksRow::_internal_set_clicks_count(int64_t value) {
+inline void PerformanceQuantile::_internal_set_total_load_ms(double value) {
   
-  _impl_.clicks_count_ = value;
+  _impl_.total_load_ms_ = value;
 }
-inline void AggClicksRow::set_clicks_count(int64_t value) {
-  _internal_set_clicks_count(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.clicks_count)
+inline void PerformanceQuantile::set_total_load_ms(double value) {
+  _internal_set_total_load_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.PerformanceQuantile.total_load_ms)
 }
 
-// int64 unique_users = 6;
-inline void AggClicksRow::clear_unique_users() {
-  _impl_.unique_users_ = int64_t{0};
+// double ttfb_ms = 3;
+inline void PerformanceQuantile::clear_ttfb_ms() {
+  _impl_.ttfb_ms_ = 0;
 }
-inline int64_t AggClicksRow::_internal_unique_users() const {
-  return _impl_.unique_users_;
+inline double PerformanceQuantile::_internal_ttfb_ms() const {
+  return _impl_.ttfb_ms_;
 }
-inline int64_t AggClicksRow::unique_users() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.unique_users)
-  return _internal_unique_users();
+inline double PerformanceQuantile::ttfb_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.PerformanceQuantile.ttfb_ms)
+  return _internal_ttfb_ms();
 }
-inline void AggClicksRow::_internal_set_unique_users(int64_t value) {
+inline void PerformanceQuantile::_internal_set_ttfb_ms(double value) {
   
-  _impl_.unique_users_ = value;
+  _impl_.ttfb_ms_ = value;
 }
-inline void AggClicksRow::set_unique_users(int64_t value) {
-  _internal_set_unique_users(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.unique_users)
+inline void PerformanceQuantile::set_ttfb_ms(double value) {
+  _internal_set_ttfb_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.PerformanceQuantile.ttfb_ms)
 }
 
-// int64 unique_sessions = 7;
-inline void AggClicksRow::clear_unique_sessions() {
-  _impl_.unique_sessions_ = int64_t{0};
+// double fcp_ms = 4;
+inline void PerformanceQuantile::clear_fcp_ms() {
+  _impl_.fcp_ms_ = 0;
 }
-inline int64_t AggClicksRow::_internal_unique_sessions() const {
-  return _impl_.unique_sessions_;
+inline double PerformanceQuantile::_internal_fcp_ms() const {
+  return _impl_.fcp_ms_;
 }
-inline int64_t AggClicksRow::unique_sessions() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.unique_sessions)
-  return _internal_unique_sessions();
+inline double PerformanceQuantile::fcp_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.PerformanceQuantile.fcp_ms)
+  return _internal_fcp_ms();
 }
-inline void AggClicksRow::_internal_set_unique_sessions(int64_t value) {
+inline void PerformanceQuantile::_internal_set_fcp_ms(double value) {
   
-  _impl_.unique_sessions_ = value;
+  _impl_.fcp_ms_ = value;
 }
-inline void AggClicksRow::set_unique_sessions(int64_t value) {
-  _internal_set_unique_sessions(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggClicksRow.unique_sessions)
+inline void PerformanceQuantile::set_fcp_ms(double value) {
+  _internal_set_fcp_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.PerformanceQuantile.fcp_ms)
 }
 
-// .google.protobuf.Timestamp created_at = 8;
-inline bool AggClicksRow::_internal_has_created_at() const {
-  return this != internal_default_instance() && _impl_.created_at_ != nullptr;
+// double lcp_ms = 5;
+inline void PerformanceQuantile::clear_lcp_ms() {
+  _impl_.lcp_ms_ = 0;
 }
-inline bool AggClicksRow::has_created_at() const {
-  return _internal_has_created_at();
+inline double PerformanceQuantile::_internal_lcp_ms() const {
+  return _impl_.lcp_ms_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggClicksRow::_internal_created_at() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
+inline double PerformanceQuantile::lcp_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.PerformanceQuantile.lcp_ms)
+  return _internal_lcp_ms();
+}
+inline void PerformanceQuantile::_internal_set_lcp_ms(double value) {
+  
+  _impl_.lcp_ms_ = value;
+}
+inline void PerformanceQuantile::set_lcp_ms(double value) {
+  _internal_set_lcp_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.PerformanceQuantile.lcp_ms)
+}
+
+// -------------------------------------------------------------------
+
+// AggPerformanceRow
+
+// .google.protobuf.Timestamp time_bucket = 1;
+inline bool AggPerformanceRow::_internal_has_time_bucket() const {
+  return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
+}
+inline bool AggPerformanceRow::has_time_bucket() const {
+  return _internal_has_time_bucket();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPerformanceRow::_internal_time_bucket() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
   return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
       ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggClicksRow::created_at() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggClicksRow.created_at)
-  return _internal_created_at();
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPerformanceRow::time_bucket() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.time_bucket)
+  return _internal_time_bucket();
 }
-inline void AggClicksRow::unsafe_arena_set_allocated_created_at(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline void AggPerformanceRow::unsafe_arena_set_allocated_time_bucket(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
   }
-  _impl_.created_at_ = created_at;
-  if (created_at) {
+  _impl_.time_bucket_ = time_bucket;
+  if (time_bucket) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggClicksRow.created_at)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggPerformanceRow.time_bucket)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::release_created_at() {
-  
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
-  _impl_.created_at_ = nullptr;
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::release_time_bucket() {
+  
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
+  _impl_.time_bucket_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -5362,87 +6882,83 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::release_created_at() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::unsafe_arena_release_created_at() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggClicksRow.created_at)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::unsafe_arena_release_time_bucket() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPerformanceRow.time_bucket)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
-  _impl_.created_at_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
+  _impl_.time_bucket_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::_internal_mutable_created_at() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::_internal_mutable_time_bucket() {
   
-  if (_impl_.created_at_ == nullptr) {
+  if (_impl_.time_bucket_ == nullptr) {
     auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.created_at_ = p;
+    _impl_.time_bucket_ = p;
   }
-  return _impl_.created_at_;
+  return _impl_.time_bucket_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggClicksRow::mutable_created_at() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggClicksRow.created_at)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::mutable_time_bucket() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.time_bucket)
   return _msg;
 }
-inline void AggClicksRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline void AggPerformanceRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
   }
-  if (created_at) {
+  if (time_bucket) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
         ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(created_at));
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_bucket));
     if (message_arena != submessage_arena) {
-      created_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, created_at, submessage_arena);
+      time_bucket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_bucket, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.created_at_ = created_at;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggClicksRow.created_at)
+  _impl_.time_bucket_ = time_bucket;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPerformanceRow.time_bucket)
 }
 
-// -------------------------------------------------------------------
-
-// GetClicksAggRequest
-
-// string project_id = 1;
-inline void GetClicksAggRequest::clear_project_id() {
+// string project_id = 2;
+inline void AggPerformanceRow::clear_project_id() {
   _impl_.project_id_.ClearToEmpty();
 }
-inline const std::string& GetClicksAggRequest::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.project_id)
+inline const std::string& AggPerformanceRow::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.project_id)
   return _internal_project_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetClicksAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
+void AggPerformanceRow::set_project_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetClicksAggRequest.project_id)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.project_id)
 }
-inline std::string* GetClicksAggRequest::mutable_project_id() {
+inline std::string* AggPerformanceRow::mutable_project_id() {
   std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.project_id)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.project_id)
   return _s;
 }
-inline const std::string& GetClicksAggRequest::_internal_project_id() const {
+inline const std::string& AggPerformanceRow::_internal_project_id() const {
   return _impl_.project_id_.Get();
 }
-inline void GetClicksAggRequest::_internal_set_project_id(const std::string& value) {
+inline void AggPerformanceRow::_internal_set_project_id(const std::string& value) {
   
   _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetClicksAggRequest::_internal_mutable_project_id() {
+inline std::string* AggPerformanceRow::_internal_mutable_project_id() {
   
   return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetClicksAggRequest::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.project_id)
+inline std::string* AggPerformanceRow::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPerformanceRow.project_id)
   return _impl_.project_id_.Release();
 }
-inline void GetClicksAggRequest::set_allocated_project_id(std::string* project_id) {
+inline void AggPerformanceRow::set_allocated_project_id(std::string* project_id) {
   if (project_id != nullptr) {
     
   } else {
@@ -5454,157 +6970,49 @@ inline void GetClicksAggRequest::set_allocated_project_id(std::string* project_i
     _impl_.project_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.project_id)
-}
-
-// .metricsys.aggregation.TimeRange time_range = 2;
-inline bool GetClicksAggRequest::_internal_has_time_range() const {
-  return this != internal_default_instance() && _impl_.time_range_ != nullptr;
-}
-inline bool GetClicksAggRequest::has_time_range() const {
-  return _internal_has_time_range();
-}
-inline void GetClicksAggRequest::clear_time_range() {
-  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
-    delete _impl_.time_range_;
-  }
-  _impl_.time_range_ = nullptr;
-}
-inline const ::metricsys::aggregation::TimeRange& GetClicksAggRequest::_internal_time_range() const {
-  const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
-  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
-      ::metricsys::aggregation::_TimeRange_default_instance_);
-}
-inline const ::metricsys::aggregation::TimeRange& GetClicksAggRequest::time_range() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.time_range)
-  return _internal_time_range();
-}
-inline void GetClicksAggRequest::unsafe_arena_set_allocated_time_range(
-    ::metricsys::aggregation::TimeRange* time_range) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
-  }
-  _impl_.time_range_ = time_range;
-  if (time_range) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetClicksAggRequest.time_range)
-}
-inline ::metricsys::aggregation::TimeRange* GetClicksAggRequest::release_time_range() {
-  
-  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
-  _impl_.time_range_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::metricsys::aggregation::TimeRange* GetClicksAggRequest::unsafe_arena_release_time_range() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.time_range)
-  
-  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
-  _impl_.time_range_ = nullptr;
-  return temp;
-}
-inline ::metricsys::aggregation::TimeRange* GetClicksAggRequest::_internal_mutable_time_range() {
-  
-  if (_impl_.time_range_ == nullptr) {
-    auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
-    _impl_.time_range_ = p;
-  }
-  return _impl_.time_range_;
-}
-inline ::metricsys::aggregation::TimeRange* GetClicksAggRequest::mutable_time_range() {
-  ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.time_range)
-  return _msg;
-}
-inline void GetClicksAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.time_range_;
-  }
-  if (time_range) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
-    if (message_arena != submessage_arena) {
-      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, time_range, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.time_range_ = time_range;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.time_range)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPerformanceRow.project_id)
 }
 
-// optional string page = 3;
-inline bool GetClicksAggRequest::_internal_has_page() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool GetClicksAggRequest::has_page() const {
-  return _internal_has_page();
-}
-inline void GetClicksAggRequest::clear_page() {
+// string page = 3;
+inline void AggPerformanceRow::clear_page() {
   _impl_.page_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& GetClicksAggRequest::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.page)
+inline const std::string& AggPerformanceRow::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.page)
   return _internal_page();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetClicksAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
+void AggPerformanceRow::set_page(ArgT0&& arg0, ArgT... args) {
+ 
  _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetClicksAggRequest.page)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.page)
 }
-inline std::string* GetClicksAggRequest::mutable_page() {
+inline std::string* AggPerformanceRow::mutable_page() {
   std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.page)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.page)
   return _s;
 }
-inline const std::string& GetClicksAggRequest::_internal_page() const {
+inline const std::string& AggPerformanceRow::_internal_page() const {
   return _impl_.page_.Get();
 }
-inline void GetClicksAggRequest::_internal_set_page(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline void AggPerformanceRow::_internal_set_page(const std::string& value) {
+  
   _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetClicksAggRequest::_internal_mutable_page() {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline std::string* AggPerformanceRow::_internal_mutable_page() {
+  
   return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetClicksAggRequest::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.page)
-  if (!_internal_has_page()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.page_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline std::string* AggPerformanceRow::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPerformanceRow.page)
+  return _impl_.page_.Release();
 }
-inline void GetClicksAggRequest::set_allocated_page(std::string* page) {
+inline void AggPerformanceRow::set_allocated_page(std::string* page) {
   if (page != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    
   }
   _impl_.page_.SetAllocated(page, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -5612,248 +7020,222 @@ inline void GetClicksAggRequest::set_allocated_page(std::string* page) {
     _impl_.page_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.page)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPerformanceRow.page)
+}
+
+// int64 samples_count = 4;
+inline void AggPerformanceRow::clear_samples_count() {
+  _impl_.samples_count_ = int64_t{0};
+}
+inline int64_t AggPerformanceRow::_internal_samples_count() const {
+  return _impl_.samples_count_;
+}
+inline int64_t AggPerformanceRow::samples_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.samples_count)
+  return _internal_samples_count();
+}
+inline void AggPerformanceRow::_internal_set_samples_count(int64_t value) {
+  
+  _impl_.samples_count_ = value;
+}
+inline void AggPerformanceRow::set_samples_count(int64_t value) {
+  _internal_set_samples_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.samples_count)
+}
+
+// double avg_total_load_ms = 5;
+inline void AggPerformanceRow::clear_avg_total_load_ms() {
+  _impl_.avg_total_load_ms_ = 0;
+}
+inline double AggPerformanceRow::_internal_avg_total_load_ms() const {
+  return _impl_.avg_total_load_ms_;
+}
+inline double AggPerformanceRow::avg_total_load_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.avg_total_load_ms)
+  return _internal_avg_total_load_ms();
 }
-
-// optional string element_id = 4;
-inline bool GetClicksAggRequest::_internal_has_element_id() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
+inline void AggPerformanceRow::_internal_set_avg_total_load_ms(double value) {
+  
+  _impl_.avg_total_load_ms_ = value;
 }
-inline bool GetClicksAggRequest::has_element_id() const {
-  return _internal_has_element_id();
+inline void AggPerformanceRow::set_avg_total_load_ms(double value) {
+  _internal_set_avg_total_load_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.avg_total_load_ms)
 }
-inline void GetClicksAggRequest::clear_element_id() {
-  _impl_.element_id_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+
+// double p95_total_load_ms = 6;
+inline void AggPerformanceRow::clear_p95_total_load_ms() {
+  _impl_.p95_total_load_ms_ = 0;
 }
-inline const std::string& GetClicksAggRequest::element_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.element_id)
-  return _internal_element_id();
+inline double AggPerformanceRow::_internal_p95_total_load_ms() const {
+  return _impl_.p95_total_load_ms_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetClicksAggRequest::set_element_id(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.element_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetClicksAggRequest.element_id)
+inline double AggPerformanceRow::p95_total_load_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.p95_total_load_ms)
+  return _internal_p95_total_load_ms();
 }
-inline std::string* GetClicksAggRequest::mutable_element_id() {
-  std::string* _s = _internal_mutable_element_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.element_id)
-  return _s;
+inline void AggPerformanceRow::_internal_set_p95_total_load_ms(double value) {
+  
+  _impl_.p95_total_load_ms_ = value;
 }
-inline const std::string& GetClicksAggRequest::_internal_element_id() const {
-  return _impl_.element_id_.Get();
+inline void AggPerformanceRow::set_p95_total_load_ms(double value) {
+  _internal_set_p95_total_load_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.p95_total_load_ms)
 }
-inline void GetClicksAggRequest::_internal_set_element_id(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.element_id_.Set(value, GetArenaForAllocation());
+
+// double avg_ttfb_ms = 7;
+inline void AggPerformanceRow::clear_avg_ttfb_ms() {
+  _impl_.avg_ttfb_ms_ = 0;
 }
-inline std::string* GetClicksAggRequest::_internal_mutable_element_id() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.element_id_.Mutable(GetArenaForAllocation());
+inline double AggPerformanceRow::_internal_avg_ttfb_ms() const {
+  return _impl_.avg_ttfb_ms_;
 }
-inline std::string* GetClicksAggRequest::release_element_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.element_id)
-  if (!_internal_has_element_id()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.element_id_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.element_id_.IsDefault()) {
-    _impl_.element_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline double AggPerformanceRow::avg_ttfb_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.avg_ttfb_ms)
+  return _internal_avg_ttfb_ms();
 }
-inline void GetClicksAggRequest::set_allocated_element_id(std::string* element_id) {
-  if (element_id != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.element_id_.SetAllocated(element_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.element_id_.IsDefault()) {
-    _impl_.element_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.element_id)
+inline void AggPerformanceRow::_internal_set_avg_ttfb_ms(double value) {
+  
+  _impl_.avg_ttfb_ms_ = value;
+}
+inline void AggPerformanceRow::set_avg_ttfb_ms(double value) {
+  _internal_set_avg_ttfb_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.avg_ttfb_ms)
 }
 
-// .metricsys.aggregation.Pagination pagination = 5;
-inline bool GetClicksAggRequest::_internal_has_pagination() const {
-  return this != internal_default_instance() && _impl_.pagination_ != nullptr;
+// double p95_ttfb_ms = 8;
+inline void AggPerformanceRow::clear_p95_ttfb_ms() {
+  _impl_.p95_ttfb_ms_ = 0;
 }
-inline bool GetClicksAggRequest::has_pagination() const {
-  return _internal_has_pagination();
+inline double AggPerformanceRow::_internal_p95_ttfb_ms() const {
+  return _impl_.p95_ttfb_ms_;
 }
-inline void GetClicksAggRequest::clear_pagination() {
-  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
-    delete _impl_.pagination_;
-  }
-  _impl_.pagination_ = nullptr;
+inline double AggPerformanceRow::p95_ttfb_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.p95_ttfb_ms)
+  return _internal_p95_ttfb_ms();
 }
-inline const ::metricsys::aggregation::Pagination& GetClicksAggRequest::_internal_pagination() const {
-  const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
-  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
-      ::metricsys::aggregation::_Pagination_default_instance_);
+inline void AggPerformanceRow::_internal_set_p95_ttfb_ms(double value) {
+  
+  _impl_.p95_ttfb_ms_ = value;
 }
-inline const ::metricsys::aggregation::Pagination& GetClicksAggRequest::pagination() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggRequest.pagination)
-  return _internal_pagination();
+inline void AggPerformanceRow::set_p95_ttfb_ms(double value) {
+  _internal_set_p95_ttfb_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.p95_ttfb_ms)
 }
-inline void GetClicksAggRequest::unsafe_arena_set_allocated_pagination(
-    ::metricsys::aggregation::Pagination* pagination) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
-  }
-  _impl_.pagination_ = pagination;
-  if (pagination) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetClicksAggRequest.pagination)
+
+// double avg_fcp_ms = 9;
+inline void AggPerformanceRow::clear_avg_fcp_ms() {
+  _impl_.avg_fcp_ms_ = 0;
 }
-inline ::metricsys::aggregation::Pagination* GetClicksAggRequest::release_pagination() {
-  
-  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
-  _impl_.pagination_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline double AggPerformanceRow::_internal_avg_fcp_ms() const {
+  return _impl_.avg_fcp_ms_;
 }
-inline ::metricsys::aggregation::Pagination* GetClicksAggRequest::unsafe_arena_release_pagination() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetClicksAggRequest.pagination)
-  
-  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
-  _impl_.pagination_ = nullptr;
-  return temp;
+inline double AggPerformanceRow::avg_fcp_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.avg_fcp_ms)
+  return _internal_avg_fcp_ms();
 }
-inline ::metricsys::aggregation::Pagination* GetClicksAggRequest::_internal_mutable_pagination() {
+inline void AggPerformanceRow::_internal_set_avg_fcp_ms(double value) {
   
-  if (_impl_.pagination_ == nullptr) {
-    auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
-    _impl_.pagination_ = p;
-  }
-  return _impl_.pagination_;
-}
-inline ::metricsys::aggregation::Pagination* GetClicksAggRequest::mutable_pagination() {
-  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggRequest.pagination)
-  return _msg;
+  _impl_.avg_fcp_ms_ = value;
 }
-inline void GetClicksAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.pagination_;
-  }
-  if (pagination) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
-    if (message_arena != submessage_arena) {
-      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pagination, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.pagination_ = pagination;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetClicksAggRequest.pagination)
+inline void AggPerformanceRow::set_avg_fcp_ms(double value) {
+  _internal_set_avg_fcp_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.avg_fcp_ms)
 }
 
-// -------------------------------------------------------------------
-
-// GetClicksAggResponse
+// double p95_fcp_ms = 10;
+inline void AggPerformanceRow::clear_p95_fcp_ms() {
+  _impl_.p95_fcp_ms_ = 0;
+}
+inline double AggPerformanceRow::_internal_p95_fcp_ms() const {
+  return _impl_.p95_fcp_ms_;
+}
+inline double AggPerformanceRow::p95_fcp_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.p95_fcp_ms)
+  return _internal_p95_fcp_ms();
+}
+inline void AggPerformanceRow::_internal_set_p95_fcp_ms(double value) {
+  
+  _impl_.p95_fcp_ms_ = value;
+}
+inline void AggPerformanceRow::set_p95_fcp_ms(double value) {
+  _internal_set_p95_fcp_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.p95_fcp_ms)
+}
 
-// repeated .metricsys.aggregation.AggClicksRow rows = 1;
-inline int GetClicksAggResponse::_internal_rows_size() const {
-  return _impl_.rows_.size();
+// double avg_lcp_ms = 11;
+inline void AggPerformanceRow::clear_avg_lcp_ms() {
+  _impl_.avg_lcp_ms_ = 0;
 }
-inline int GetClicksAggResponse::rows_size() const {
-  return _internal_rows_size();
+inline double AggPerformanceRow::_internal_avg_lcp_ms() const {
+  return _impl_.avg_lcp_ms_;
 }
-inline void GetClicksAggResponse::clear_rows() {
-  _impl_.rows_.Clear();
+inline double AggPerformanceRow::avg_lcp_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.avg_lcp_ms)
+  return _internal_avg_lcp_ms();
 }
-inline ::metricsys::aggregation::AggClicksRow* GetClicksAggResponse::mutable_rows(int index) {
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetClicksAggResponse.rows)
-  return _impl_.rows_.Mutable(index);
+inline void AggPerformanceRow::_internal_set_avg_lcp_ms(double value) {
+  
+  _impl_.avg_lcp_ms_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggClicksRow >*
-GetClicksAggResponse::mutable_rows() {
-  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetClicksAggResponse.rows)
-  return &_impl_.rows_;
+inline void AggPerformanceRow::set_avg_lcp_ms(double value) {
+  _internal_set_avg_lcp_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.avg_lcp_ms)
 }
-inline const ::metricsys::aggregation::AggClicksRow& GetClicksAggResponse::_internal_rows(int index) const {
-  return _impl_.rows_.Get(index);
+
+// double p95_lcp_ms = 12;
+inline void AggPerformanceRow::clear_p95_lcp_ms() {
+  _impl_.p95_lcp_ms_ = 0;
 }
-inline const ::metricsys::aggregation::AggClicksRow& GetClicksAggResponse::rows(int index) const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetClicksAggResponse.rows)
-  return _internal_rows(index);
+inline double AggPerformanceRow::_internal_p95_lcp_ms() const {
+  return _impl_.p95_lcp_ms_;
 }
-inline ::metricsys::aggregation::AggClicksRow* GetClicksAggResponse::_internal_add_rows() {
-  return _impl_.rows_.Add();
+inline double AggPerformanceRow::p95_lcp_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.p95_lcp_ms)
+  return _internal_p95_lcp_ms();
 }
-inline ::metricsys::aggregation::AggClicksRow* GetClicksAggResponse::add_rows() {
-  ::metricsys::aggregation::AggClicksRow* _add = _internal_add_rows();
-  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetClicksAggResponse.rows)
-  return _add;
+inline void AggPerformanceRow::_internal_set_p95_lcp_ms(double value) {
+  
+  _impl_.p95_lcp_ms_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggClicksRow >&
-GetClicksAggResponse::rows() const {
-  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetClicksAggResponse.rows)
-  return _impl_.rows_;
+inline void AggPerformanceRow::set_p95_lcp_ms(double value) {
+  _internal_set_p95_lcp_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.p95_lcp_ms)
 }
 
-// -------------------------------------------------------------------
-
-// AggPerformanceRow
-
-// .google.protobuf.Timestamp time_bucket = 1;
-inline bool AggPerformanceRow::_internal_has_time_bucket() const {
-  return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
+// .google.protobuf.Timestamp created_at = 13;
+inline bool AggPerformanceRow::_internal_has_created_at() const {
+  return this != internal_default_instance() && _impl_.created_at_ != nullptr;
 }
-inline bool AggPerformanceRow::has_time_bucket() const {
-  return _internal_has_time_bucket();
+inline bool AggPerformanceRow::has_created_at() const {
+  return _internal_has_created_at();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPerformanceRow::_internal_time_bucket() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPerformanceRow::_internal_created_at() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
   return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
       ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPerformanceRow::time_bucket() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.time_bucket)
-  return _internal_time_bucket();
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPerformanceRow::created_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.created_at)
+  return _internal_created_at();
 }
-inline void AggPerformanceRow::unsafe_arena_set_allocated_time_bucket(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+inline void AggPerformanceRow::unsafe_arena_set_allocated_created_at(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
   }
-  _impl_.time_bucket_ = time_bucket;
-  if (time_bucket) {
+  _impl_.created_at_ = created_at;
+  if (created_at) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggPerformanceRow.time_bucket)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggPerformanceRow.created_at)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::release_time_bucket() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::release_created_at() {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
-  _impl_.time_bucket_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
+  _impl_.created_at_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -5865,83 +7247,147 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::release_time_bucke
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::unsafe_arena_release_time_bucket() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPerformanceRow.time_bucket)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::unsafe_arena_release_created_at() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPerformanceRow.created_at)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
-  _impl_.time_bucket_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
+  _impl_.created_at_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::_internal_mutable_time_bucket() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::_internal_mutable_created_at() {
   
-  if (_impl_.time_bucket_ == nullptr) {
+  if (_impl_.created_at_ == nullptr) {
     auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.time_bucket_ = p;
+    _impl_.created_at_ = p;
   }
-  return _impl_.time_bucket_;
+  return _impl_.created_at_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::mutable_time_bucket() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.time_bucket)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::mutable_created_at() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.created_at)
   return _msg;
 }
-inline void AggPerformanceRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+inline void AggPerformanceRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
   }
-  if (time_bucket) {
+  if (created_at) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
         ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_bucket));
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(created_at));
     if (message_arena != submessage_arena) {
-      time_bucket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, time_bucket, submessage_arena);
+      created_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, created_at, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.time_bucket_ = time_bucket;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPerformanceRow.time_bucket)
+  _impl_.created_at_ = created_at;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPerformanceRow.created_at)
 }
 
-// string project_id = 2;
-inline void AggPerformanceRow::clear_project_id() {
+// repeated .metricsys.aggregation.PerformanceQuantile quantiles = 14;
+inline int AggPerformanceRow::_internal_quantiles_size() const {
+  return _impl_.quantiles_.size();
+}
+inline int AggPerformanceRow::quantiles_size() const {
+  return _internal_quantiles_size();
+}
+inline void AggPerformanceRow::clear_quantiles() {
+  _impl_.quantiles_.Clear();
+}
+inline ::metricsys::aggregation::PerformanceQuantile* AggPerformanceRow::mutable_quantiles(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.quantiles)
+  return _impl_.quantiles_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::PerformanceQuantile >*
+AggPerformanceRow::mutable_quantiles() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.AggPerformanceRow.quantiles)
+  return &_impl_.quantiles_;
+}
+inline const ::metricsys::aggregation::PerformanceQuantile& AggPerformanceRow::_internal_quantiles(int index) const {
+  return _impl_.quantiles_.Get(index);
+}
+inline const ::metricsys::aggregation::PerformanceQuantile& AggPerformanceRow::quantiles(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.quantiles)
+  return _internal_quantiles(index);
+}
+inline ::metricsys::aggregation::PerformanceQuantile* AggPerformanceRow::_internal_add_quantiles() {
+  return _impl_.quantiles_.Add();
+}
+inline ::metricsys::aggregation::PerformanceQuantile* AggPerformanceRow::add_quantiles() {
+  ::metricsys::aggregation::PerformanceQuantile* _add = _internal_add_quantiles();
+  // @@protoc_insertion_point(field_add:metricsys.aggregation.AggPerformanceRow.quantiles)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::PerformanceQuantile >&
+AggPerformanceRow::quantiles() const {
+  // @@protoc_insertion_point(field_list:metricsys.aggregation.AggPerformanceRow.quantiles)
+  return _impl_.quantiles_;
+}
+
+// uint32 step_seconds = 15;
+inline void AggPerformanceRow::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
+}
+inline uint32_t AggPerformanceRow::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
+}
+inline uint32_t AggPerformanceRow::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.step_seconds)
+  return _internal_step_seconds();
+}
+inline void AggPerformanceRow::_internal_set_step_seconds(uint32_t value) {
+  
+  _impl_.step_seconds_ = value;
+}
+inline void AggPerformanceRow::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.step_seconds)
+}
+
+// -------------------------------------------------------------------
+
+// GetPerformanceAggRequest
+
+// string project_id = 1;
+inline void GetPerformanceAggRequest::clear_project_id() {
   _impl_.project_id_.ClearToEmpty();
 }
-inline const std::string& AggPerformanceRow::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.project_id)
+inline const std::string& GetPerformanceAggRequest::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.project_id)
   return _internal_project_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggPerformanceRow::set_project_id(ArgT0&& arg0, ArgT... args) {
+void GetPerformanceAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.project_id)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPerformanceAggRequest.project_id)
 }
-inline std::string* AggPerformanceRow::mutable_project_id() {
+inline std::string* GetPerformanceAggRequest::mutable_project_id() {
   std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.project_id)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggRequest.project_id)
   return _s;
 }
-inline const std::string& AggPerformanceRow::_internal_project_id() const {
+inline const std::string& GetPerformanceAggRequest::_internal_project_id() const {
   return _impl_.project_id_.Get();
 }
-inline void AggPerformanceRow::_internal_set_project_id(const std::string& value) {
+inline void GetPerformanceAggRequest::_internal_set_project_id(const std::string& value) {
   
   _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggPerformanceRow::_internal_mutable_project_id() {
+inline std::string* GetPerformanceAggRequest::_internal_mutable_project_id() {
   
   return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* AggPerformanceRow::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPerformanceRow.project_id)
+inline std::string* GetPerformanceAggRequest::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPerformanceAggRequest.project_id)
   return _impl_.project_id_.Release();
 }
-inline void AggPerformanceRow::set_allocated_project_id(std::string* project_id) {
+inline void GetPerformanceAggRequest::set_allocated_project_id(std::string* project_id) {
   if (project_id != nullptr) {
     
   } else {
@@ -5953,49 +7399,157 @@ inline void AggPerformanceRow::set_allocated_project_id(std::string* project_id)
     _impl_.project_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPerformanceRow.project_id)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.project_id)
+}
+
+// .metricsys.aggregation.TimeRange time_range = 2;
+inline bool GetPerformanceAggRequest::_internal_has_time_range() const {
+  return this != internal_default_instance() && _impl_.time_range_ != nullptr;
+}
+inline bool GetPerformanceAggRequest::has_time_range() const {
+  return _internal_has_time_range();
+}
+inline void GetPerformanceAggRequest::clear_time_range() {
+  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
+    delete _impl_.time_range_;
+  }
+  _impl_.time_range_ = nullptr;
+}
+inline const ::metricsys::aggregation::TimeRange& GetPerformanceAggRequest::_internal_time_range() const {
+  const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
+      ::metricsys::aggregation::_TimeRange_default_instance_);
+}
+inline const ::metricsys::aggregation::TimeRange& GetPerformanceAggRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetPerformanceAggRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::aggregation::TimeRange* time_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
+  }
+  _impl_.time_range_ = time_range;
+  if (time_range) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.time_range)
+}
+inline ::metricsys::aggregation::TimeRange* GetPerformanceAggRequest::release_time_range() {
+  
+  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::aggregation::TimeRange* GetPerformanceAggRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPerformanceAggRequest.time_range)
+  
+  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::aggregation::TimeRange* GetPerformanceAggRequest::_internal_mutable_time_range() {
+  
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
+  }
+  return _impl_.time_range_;
+}
+inline ::metricsys::aggregation::TimeRange* GetPerformanceAggRequest::mutable_time_range() {
+  ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggRequest.time_range)
+  return _msg;
+}
+inline void GetPerformanceAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.time_range_;
+  }
+  if (time_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
+    if (message_arena != submessage_arena) {
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.time_range)
+}
+
+// optional string page = 3;
+inline bool GetPerformanceAggRequest::_internal_has_page() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetPerformanceAggRequest::has_page() const {
+  return _internal_has_page();
 }
-
-// string page = 3;
-inline void AggPerformanceRow::clear_page() {
+inline void GetPerformanceAggRequest::clear_page() {
   _impl_.page_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& AggPerformanceRow::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.page)
+inline const std::string& GetPerformanceAggRequest::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.page)
   return _internal_page();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggPerformanceRow::set_page(ArgT0&& arg0, ArgT... args) {
- 
+void GetPerformanceAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.page)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPerformanceAggRequest.page)
 }
-inline std::string* AggPerformanceRow::mutable_page() {
+inline std::string* GetPerformanceAggRequest::mutable_page() {
   std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.page)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggRequest.page)
   return _s;
 }
-inline const std::string& AggPerformanceRow::_internal_page() const {
+inline const std::string& GetPerformanceAggRequest::_internal_page() const {
   return _impl_.page_.Get();
 }
-inline void AggPerformanceRow::_internal_set_page(const std::string& value) {
-  
+inline void GetPerformanceAggRequest::_internal_set_page(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggPerformanceRow::_internal_mutable_page() {
-  
+inline std::string* GetPerformanceAggRequest::_internal_mutable_page() {
+  _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline std::string* AggPerformanceRow::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPerformanceRow.page)
-  return _impl_.page_.Release();
+inline std::string* GetPerformanceAggRequest::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPerformanceAggRequest.page)
+  if (!_internal_has_page()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void AggPerformanceRow::set_allocated_page(std::string* page) {
+inline void GetPerformanceAggRequest::set_allocated_page(std::string* page) {
   if (page != nullptr) {
-    
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   _impl_.page_.SetAllocated(page, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -6003,222 +7557,267 @@ inline void AggPerformanceRow::set_allocated_page(std::string* page) {
     _impl_.page_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPerformanceRow.page)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.page)
 }
 
-// int64 samples_count = 4;
-inline void AggPerformanceRow::clear_samples_count() {
-  _impl_.samples_count_ = int64_t{0};
-}
-inline int64_t AggPerformanceRow::_internal_samples_count() const {
-  return _impl_.samples_count_;
-}
-inline int64_t AggPerformanceRow::samples_count() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.samples_count)
-  return _internal_samples_count();
+// .metricsys.aggregation.Pagination pagination = 4;
+inline bool GetPerformanceAggRequest::_internal_has_pagination() const {
+  return this != internal_default_instance() && _impl_.pagination_ != nullptr;
 }
-inline void AggPerformanceRow::_internal_set_samples_count(int64_t value) {
-  
-  _impl_.samples_count_ = value;
+inline bool GetPerformanceAggRequest::has_pagination() const {
+  return _internal_has_pagination();
 }
-inline void AggPerformanceRow::set_samples_count(int64_t value) {
-  _internal_set_samples_count(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.samples_count)
+inline void GetPerformanceAggRequest::clear_pagination() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
+    delete _impl_.pagination_;
+  }
+  _impl_.pagination_ = nullptr;
 }
-
-// double avg_total_load_ms = 5;
-inline void AggPerformanceRow::clear_avg_total_load_ms() {
-  _impl_.avg_total_load_ms_ = 0;
+inline const ::metricsys::aggregation::Pagination& GetPerformanceAggRequest::_internal_pagination() const {
+  const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
+      ::metricsys::aggregation::_Pagination_default_instance_);
 }
-inline double AggPerformanceRow::_internal_avg_total_load_ms() const {
-  return _impl_.avg_total_load_ms_;
+inline const ::metricsys::aggregation::Pagination& GetPerformanceAggRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.pagination)
+  return _internal_pagination();
 }
-inline double AggPerformanceRow::avg_total_load_ms() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.avg_total_load_ms)
-  return _internal_avg_total_load_ms();
+inline void GetPerformanceAggRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::aggregation::Pagination* pagination) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+  }
+  _impl_.pagination_ = pagination;
+  if (pagination) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.pagination)
 }
-inline void AggPerformanceRow::_internal_set_avg_total_load_ms(double value) {
+inline ::metricsys::aggregation::Pagination* GetPerformanceAggRequest::release_pagination() {
   
-  _impl_.avg_total_load_ms_ = value;
+  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline void AggPerformanceRow::set_avg_total_load_ms(double value) {
-  _internal_set_avg_total_load_ms(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.avg_total_load_ms)
+inline ::metricsys::aggregation::Pagination* GetPerformanceAggRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPerformanceAggRequest.pagination)
+  
+  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+  return temp;
 }
-
-// double p95_total_load_ms = 6;
-inline void AggPerformanceRow::clear_p95_total_load_ms() {
-  _impl_.p95_total_load_ms_ = 0;
+inline ::metricsys::aggregation::Pagination* GetPerformanceAggRequest::_internal_mutable_pagination() {
+  
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
+  }
+  return _impl_.pagination_;
 }
-inline double AggPerformanceRow::_internal_p95_total_load_ms() const {
-  return _impl_.p95_total_load_ms_;
+inline ::metricsys::aggregation::Pagination* GetPerformanceAggRequest::mutable_pagination() {
+  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggRequest.pagination)
+  return _msg;
 }
-inline double AggPerformanceRow::p95_total_load_ms() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.p95_total_load_ms)
-  return _internal_p95_total_load_ms();
+inline void GetPerformanceAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pagination_;
+  }
+  if (pagination) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+    if (message_arena != submessage_arena) {
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.pagination)
 }
-inline void AggPerformanceRow::_internal_set_p95_total_load_ms(double value) {
-  
-  _impl_.p95_total_load_ms_ = value;
+
+// repeated double quantiles = 5;
+inline int GetPerformanceAggRequest::_internal_quantiles_size() const {
+  return _impl_.quantiles_.size();
 }
-inline void AggPerformanceRow::set_p95_total_load_ms(double value) {
-  _internal_set_p95_total_load_ms(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.p95_total_load_ms)
+inline int GetPerformanceAggRequest::quantiles_size() const {
+  return _internal_quantiles_size();
 }
-
-// double avg_ttfb_ms = 7;
-inline void AggPerformanceRow::clear_avg_ttfb_ms() {
-  _impl_.avg_ttfb_ms_ = 0;
+inline void GetPerformanceAggRequest::clear_quantiles() {
+  _impl_.quantiles_.Clear();
 }
-inline double AggPerformanceRow::_internal_avg_ttfb_ms() const {
-  return _impl_.avg_ttfb_ms_;
+inline double GetPerformanceAggRequest::_internal_quantiles(int index) const {
+  return _impl_.quantiles_.Get(index);
 }
-inline double AggPerformanceRow::avg_ttfb_ms() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.avg_ttfb_ms)
-  return _internal_avg_ttfb_ms();
+inline double GetPerformanceAggRequest::quantiles(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.quantiles)
+  return _internal_quantiles(index);
 }
-inline void AggPerformanceRow::_internal_set_avg_ttfb_ms(double value) {
-  
-  _impl_.avg_ttfb_ms_ = value;
+inline void GetPerformanceAggRequest::set_quantiles(int index, double value) {
+  _impl_.quantiles_.Set(index, value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPerformanceAggRequest.quantiles)
 }
-inline void AggPerformanceRow::set_avg_ttfb_ms(double value) {
-  _internal_set_avg_ttfb_ms(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.avg_ttfb_ms)
+inline void GetPerformanceAggRequest::_internal_add_quantiles(double value) {
+  _impl_.quantiles_.Add(value);
 }
-
-// double p95_ttfb_ms = 8;
-inline void AggPerformanceRow::clear_p95_ttfb_ms() {
-  _impl_.p95_ttfb_ms_ = 0;
+inline void GetPerformanceAggRequest::add_quantiles(double value) {
+  _internal_add_quantiles(value);
+  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetPerformanceAggRequest.quantiles)
 }
-inline double AggPerformanceRow::_internal_p95_ttfb_ms() const {
-  return _impl_.p95_ttfb_ms_;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+GetPerformanceAggRequest::_internal_quantiles() const {
+  return _impl_.quantiles_;
 }
-inline double AggPerformanceRow::p95_ttfb_ms() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.p95_ttfb_ms)
-  return _internal_p95_ttfb_ms();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+GetPerformanceAggRequest::quantiles() const {
+  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetPerformanceAggRequest.quantiles)
+  return _internal_quantiles();
 }
-inline void AggPerformanceRow::_internal_set_p95_ttfb_ms(double value) {
-  
-  _impl_.p95_ttfb_ms_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+GetPerformanceAggRequest::_internal_mutable_quantiles() {
+  return &_impl_.quantiles_;
 }
-inline void AggPerformanceRow::set_p95_ttfb_ms(double value) {
-  _internal_set_p95_ttfb_ms(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.p95_ttfb_ms)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+GetPerformanceAggRequest::mutable_quantiles() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetPerformanceAggRequest.quantiles)
+  return _internal_mutable_quantiles();
 }
 
-// double avg_fcp_ms = 9;
-inline void AggPerformanceRow::clear_avg_fcp_ms() {
-  _impl_.avg_fcp_ms_ = 0;
+// bool merge_buckets = 6;
+inline void GetPerformanceAggRequest::clear_merge_buckets() {
+  _impl_.merge_buckets_ = false;
 }
-inline double AggPerformanceRow::_internal_avg_fcp_ms() const {
-  return _impl_.avg_fcp_ms_;
+inline bool GetPerformanceAggRequest::_internal_merge_buckets() const {
+  return _impl_.merge_buckets_;
 }
-inline double AggPerformanceRow::avg_fcp_ms() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.avg_fcp_ms)
-  return _internal_avg_fcp_ms();
+inline bool GetPerformanceAggRequest::merge_buckets() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.merge_buckets)
+  return _internal_merge_buckets();
 }
-inline void AggPerformanceRow::_internal_set_avg_fcp_ms(double value) {
+inline void GetPerformanceAggRequest::_internal_set_merge_buckets(bool value) {
   
-  _impl_.avg_fcp_ms_ = value;
+  _impl_.merge_buckets_ = value;
 }
-inline void AggPerformanceRow::set_avg_fcp_ms(double value) {
-  _internal_set_avg_fcp_ms(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.avg_fcp_ms)
+inline void GetPerformanceAggRequest::set_merge_buckets(bool value) {
+  _internal_set_merge_buckets(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPerformanceAggRequest.merge_buckets)
 }
 
-// double p95_fcp_ms = 10;
-inline void AggPerformanceRow::clear_p95_fcp_ms() {
-  _impl_.p95_fcp_ms_ = 0;
+// uint32 step_seconds = 7;
+inline void GetPerformanceAggRequest::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
 }
-inline double AggPerformanceRow::_internal_p95_fcp_ms() const {
-  return _impl_.p95_fcp_ms_;
+inline uint32_t GetPerformanceAggRequest::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
 }
-inline double AggPerformanceRow::p95_fcp_ms() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.p95_fcp_ms)
-  return _internal_p95_fcp_ms();
+inline uint32_t GetPerformanceAggRequest::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.step_seconds)
+  return _internal_step_seconds();
 }
-inline void AggPerformanceRow::_internal_set_p95_fcp_ms(double value) {
+inline void GetPerformanceAggRequest::_internal_set_step_seconds(uint32_t value) {
   
-  _impl_.p95_fcp_ms_ = value;
+  _impl_.step_seconds_ = value;
 }
-inline void AggPerformanceRow::set_p95_fcp_ms(double value) {
-  _internal_set_p95_fcp_ms(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.p95_fcp_ms)
+inline void GetPerformanceAggRequest::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPerformanceAggRequest.step_seconds)
 }
 
-// double avg_lcp_ms = 11;
-inline void AggPerformanceRow::clear_avg_lcp_ms() {
-  _impl_.avg_lcp_ms_ = 0;
+// -------------------------------------------------------------------
+
+// GetPerformanceAggResponse
+
+// repeated .metricsys.aggregation.AggPerformanceRow rows = 1;
+inline int GetPerformanceAggResponse::_internal_rows_size() const {
+  return _impl_.rows_.size();
 }
-inline double AggPerformanceRow::_internal_avg_lcp_ms() const {
-  return _impl_.avg_lcp_ms_;
+inline int GetPerformanceAggResponse::rows_size() const {
+  return _internal_rows_size();
 }
-inline double AggPerformanceRow::avg_lcp_ms() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.avg_lcp_ms)
-  return _internal_avg_lcp_ms();
+inline void GetPerformanceAggResponse::clear_rows() {
+  _impl_.rows_.Clear();
 }
-inline void AggPerformanceRow::_internal_set_avg_lcp_ms(double value) {
-  
-  _impl_.avg_lcp_ms_ = value;
+inline ::metricsys::aggregation::AggPerformanceRow* GetPerformanceAggResponse::mutable_rows(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggResponse.rows)
+  return _impl_.rows_.Mutable(index);
 }
-inline void AggPerformanceRow::set_avg_lcp_ms(double value) {
-  _internal_set_avg_lcp_ms(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.avg_lcp_ms)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggPerformanceRow >*
+GetPerformanceAggResponse::mutable_rows() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetPerformanceAggResponse.rows)
+  return &_impl_.rows_;
 }
-
-// double p95_lcp_ms = 12;
-inline void AggPerformanceRow::clear_p95_lcp_ms() {
-  _impl_.p95_lcp_ms_ = 0;
+inline const ::metricsys::aggregation::AggPerformanceRow& GetPerformanceAggResponse::_internal_rows(int index) const {
+  return _impl_.rows_.Get(index);
 }
-inline double AggPerformanceRow::_internal_p95_lcp_ms() const {
-  return _impl_.p95_lcp_ms_;
+inline const ::metricsys::aggregation::AggPerformanceRow& GetPerformanceAggResponse::rows(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggResponse.rows)
+  return _internal_rows(index);
 }
-inline double AggPerformanceRow::p95_lcp_ms() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.p95_lcp_ms)
-  return _internal_p95_lcp_ms();
+inline ::metricsys::aggregation::AggPerformanceRow* GetPerformanceAggResponse::_internal_add_rows() {
+  return _impl_.rows_.Add();
 }
-inline void AggPerformanceRow::_internal_set_p95_lcp_ms(double value) {
-  
-  _impl_.p95_lcp_ms_ = value;
+inline ::metricsys::aggregation::AggPerformanceRow* GetPerformanceAggResponse::add_rows() {
+  ::metricsys::aggregation::AggPerformanceRow* _add = _internal_add_rows();
+  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetPerformanceAggResponse.rows)
+  return _add;
 }
-inline void AggPerformanceRow::set_p95_lcp_ms(double value) {
-  _internal_set_p95_lcp_ms(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggPerformanceRow.p95_lcp_ms)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggPerformanceRow >&
+GetPerformanceAggResponse::rows() const {
+  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetPerformanceAggResponse.rows)
+  return _impl_.rows_;
 }
 
-// .google.protobuf.Timestamp created_at = 13;
-inline bool AggPerformanceRow::_internal_has_created_at() const {
-  return this != internal_default_instance() && _impl_.created_at_ != nullptr;
+// -------------------------------------------------------------------
+
+// AggErrorsRow
+
+// .google.protobuf.Timestamp time_bucket = 1;
+inline bool AggErrorsRow::_internal_has_time_bucket() const {
+  return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
 }
-inline bool AggPerformanceRow::has_created_at() const {
-  return _internal_has_created_at();
+inline bool AggErrorsRow::has_time_bucket() const {
+  return _internal_has_time_bucket();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPerformanceRow::_internal_created_at() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggErrorsRow::_internal_time_bucket() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
   return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
       ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggPerformanceRow::created_at() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggPerformanceRow.created_at)
-  return _internal_created_at();
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggErrorsRow::time_bucket() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.time_bucket)
+  return _internal_time_bucket();
 }
-inline void AggPerformanceRow::unsafe_arena_set_allocated_created_at(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline void AggErrorsRow::unsafe_arena_set_allocated_time_bucket(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
   }
-  _impl_.created_at_ = created_at;
-  if (created_at) {
+  _impl_.time_bucket_ = time_bucket;
+  if (time_bucket) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggPerformanceRow.created_at)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggErrorsRow.time_bucket)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::release_created_at() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::release_time_bucket() {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
-  _impl_.created_at_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
+  _impl_.time_bucket_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -6230,87 +7829,83 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::release_created_at
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::unsafe_arena_release_created_at() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggPerformanceRow.created_at)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::unsafe_arena_release_time_bucket() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.time_bucket)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
-  _impl_.created_at_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
+  _impl_.time_bucket_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::_internal_mutable_created_at() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::_internal_mutable_time_bucket() {
   
-  if (_impl_.created_at_ == nullptr) {
+  if (_impl_.time_bucket_ == nullptr) {
     auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.created_at_ = p;
+    _impl_.time_bucket_ = p;
   }
-  return _impl_.created_at_;
+  return _impl_.time_bucket_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggPerformanceRow::mutable_created_at() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggPerformanceRow.created_at)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::mutable_time_bucket() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.time_bucket)
   return _msg;
 }
-inline void AggPerformanceRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline void AggErrorsRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
   }
-  if (created_at) {
+  if (time_bucket) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
         ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(created_at));
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_bucket));
     if (message_arena != submessage_arena) {
-      created_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, created_at, submessage_arena);
+      time_bucket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_bucket, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.created_at_ = created_at;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggPerformanceRow.created_at)
+  _impl_.time_bucket_ = time_bucket;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.time_bucket)
 }
 
-// -------------------------------------------------------------------
-
-// GetPerformanceAggRequest
-
-// string project_id = 1;
-inline void GetPerformanceAggRequest::clear_project_id() {
+// string project_id = 2;
+inline void AggErrorsRow::clear_project_id() {
   _impl_.project_id_.ClearToEmpty();
 }
-inline const std::string& GetPerformanceAggRequest::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.project_id)
+inline const std::string& AggErrorsRow::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.project_id)
   return _internal_project_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetPerformanceAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
+void AggErrorsRow::set_project_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPerformanceAggRequest.project_id)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.project_id)
 }
-inline std::string* GetPerformanceAggRequest::mutable_project_id() {
+inline std::string* AggErrorsRow::mutable_project_id() {
   std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggRequest.project_id)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.project_id)
   return _s;
 }
-inline const std::string& GetPerformanceAggRequest::_internal_project_id() const {
+inline const std::string& AggErrorsRow::_internal_project_id() const {
   return _impl_.project_id_.Get();
 }
-inline void GetPerformanceAggRequest::_internal_set_project_id(const std::string& value) {
+inline void AggErrorsRow::_internal_set_project_id(const std::string& value) {
   
   _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetPerformanceAggRequest::_internal_mutable_project_id() {
+inline std::string* AggErrorsRow::_internal_mutable_project_id() {
   
   return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetPerformanceAggRequest::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPerformanceAggRequest.project_id)
+inline std::string* AggErrorsRow::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.project_id)
   return _impl_.project_id_.Release();
 }
-inline void GetPerformanceAggRequest::set_allocated_project_id(std::string* project_id) {
+inline void AggErrorsRow::set_allocated_project_id(std::string* project_id) {
   if (project_id != nullptr) {
     
   } else {
@@ -6322,338 +7917,240 @@ inline void GetPerformanceAggRequest::set_allocated_project_id(std::string* proj
     _impl_.project_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.project_id)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.project_id)
 }
 
-// .metricsys.aggregation.TimeRange time_range = 2;
-inline bool GetPerformanceAggRequest::_internal_has_time_range() const {
-  return this != internal_default_instance() && _impl_.time_range_ != nullptr;
-}
-inline bool GetPerformanceAggRequest::has_time_range() const {
-  return _internal_has_time_range();
-}
-inline void GetPerformanceAggRequest::clear_time_range() {
-  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
-    delete _impl_.time_range_;
-  }
-  _impl_.time_range_ = nullptr;
+// string page = 3;
+inline void AggErrorsRow::clear_page() {
+  _impl_.page_.ClearToEmpty();
 }
-inline const ::metricsys::aggregation::TimeRange& GetPerformanceAggRequest::_internal_time_range() const {
-  const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
-  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
-      ::metricsys::aggregation::_TimeRange_default_instance_);
+inline const std::string& AggErrorsRow::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.page)
+  return _internal_page();
 }
-inline const ::metricsys::aggregation::TimeRange& GetPerformanceAggRequest::time_range() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.time_range)
-  return _internal_time_range();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AggErrorsRow::set_page(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.page)
 }
-inline void GetPerformanceAggRequest::unsafe_arena_set_allocated_time_range(
-    ::metricsys::aggregation::TimeRange* time_range) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
-  }
-  _impl_.time_range_ = time_range;
-  if (time_range) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.time_range)
+inline std::string* AggErrorsRow::mutable_page() {
+  std::string* _s = _internal_mutable_page();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.page)
+  return _s;
 }
-inline ::metricsys::aggregation::TimeRange* GetPerformanceAggRequest::release_time_range() {
-  
-  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
-  _impl_.time_range_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& AggErrorsRow::_internal_page() const {
+  return _impl_.page_.Get();
 }
-inline ::metricsys::aggregation::TimeRange* GetPerformanceAggRequest::unsafe_arena_release_time_range() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPerformanceAggRequest.time_range)
+inline void AggErrorsRow::_internal_set_page(const std::string& value) {
   
-  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
-  _impl_.time_range_ = nullptr;
-  return temp;
+  _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline ::metricsys::aggregation::TimeRange* GetPerformanceAggRequest::_internal_mutable_time_range() {
+inline std::string* AggErrorsRow::_internal_mutable_page() {
   
-  if (_impl_.time_range_ == nullptr) {
-    auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
-    _impl_.time_range_ = p;
-  }
-  return _impl_.time_range_;
+  return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline ::metricsys::aggregation::TimeRange* GetPerformanceAggRequest::mutable_time_range() {
-  ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggRequest.time_range)
-  return _msg;
+inline std::string* AggErrorsRow::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.page)
+  return _impl_.page_.Release();
 }
-inline void GetPerformanceAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.time_range_;
-  }
-  if (time_range) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
-    if (message_arena != submessage_arena) {
-      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, time_range, submessage_arena);
-    }
+inline void AggErrorsRow::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
     
   } else {
     
   }
-  _impl_.time_range_ = time_range;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.time_range)
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.page)
 }
 
-// optional string page = 3;
-inline bool GetPerformanceAggRequest::_internal_has_page() const {
+// optional string error_type = 4;
+inline bool AggErrorsRow::_internal_has_error_type() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool GetPerformanceAggRequest::has_page() const {
-  return _internal_has_page();
+inline bool AggErrorsRow::has_error_type() const {
+  return _internal_has_error_type();
 }
-inline void GetPerformanceAggRequest::clear_page() {
-  _impl_.page_.ClearToEmpty();
+inline void AggErrorsRow::clear_error_type() {
+  _impl_.error_type_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& GetPerformanceAggRequest::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.page)
-  return _internal_page();
+inline const std::string& AggErrorsRow::error_type() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.error_type)
+  return _internal_error_type();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetPerformanceAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
+void AggErrorsRow::set_error_type(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetPerformanceAggRequest.page)
+ _impl_.error_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.error_type)
 }
-inline std::string* GetPerformanceAggRequest::mutable_page() {
-  std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggRequest.page)
+inline std::string* AggErrorsRow::mutable_error_type() {
+  std::string* _s = _internal_mutable_error_type();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.error_type)
   return _s;
 }
-inline const std::string& GetPerformanceAggRequest::_internal_page() const {
-  return _impl_.page_.Get();
+inline const std::string& AggErrorsRow::_internal_error_type() const {
+  return _impl_.error_type_.Get();
 }
-inline void GetPerformanceAggRequest::_internal_set_page(const std::string& value) {
+inline void AggErrorsRow::_internal_set_error_type(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.page_.Set(value, GetArenaForAllocation());
+  _impl_.error_type_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetPerformanceAggRequest::_internal_mutable_page() {
+inline std::string* AggErrorsRow::_internal_mutable_error_type() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.page_.Mutable(GetArenaForAllocation());
+  return _impl_.error_type_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetPerformanceAggRequest::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPerformanceAggRequest.page)
-  if (!_internal_has_page()) {
+inline std::string* AggErrorsRow::release_error_type() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.error_type)
+  if (!_internal_has_error_type()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.page_.Release();
+  auto* p = _impl_.error_type_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
+  if (_impl_.error_type_.IsDefault()) {
+    _impl_.error_type_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void GetPerformanceAggRequest::set_allocated_page(std::string* page) {
-  if (page != nullptr) {
+inline void AggErrorsRow::set_allocated_error_type(std::string* error_type) {
+  if (error_type != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+  _impl_.error_type_.SetAllocated(error_type, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
+  if (_impl_.error_type_.IsDefault()) {
+    _impl_.error_type_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.page)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.error_type)
 }
 
-// .metricsys.aggregation.Pagination pagination = 4;
-inline bool GetPerformanceAggRequest::_internal_has_pagination() const {
-  return this != internal_default_instance() && _impl_.pagination_ != nullptr;
+// int64 errors_count = 5;
+inline void AggErrorsRow::clear_errors_count() {
+  _impl_.errors_count_ = int64_t{0};
 }
-inline bool GetPerformanceAggRequest::has_pagination() const {
-  return _internal_has_pagination();
+inline int64_t AggErrorsRow::_internal_errors_count() const {
+  return _impl_.errors_count_;
 }
-inline void GetPerformanceAggRequest::clear_pagination() {
-  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
-    delete _impl_.pagination_;
-  }
-  _impl_.pagination_ = nullptr;
+inline int64_t AggErrorsRow::errors_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.errors_count)
+  return _internal_errors_count();
 }
-inline const ::metricsys::aggregation::Pagination& GetPerformanceAggRequest::_internal_pagination() const {
-  const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
-  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
-      ::metricsys::aggregation::_Pagination_default_instance_);
+inline void AggErrorsRow::_internal_set_errors_count(int64_t value) {
+  
+  _impl_.errors_count_ = value;
 }
-inline const ::metricsys::aggregation::Pagination& GetPerformanceAggRequest::pagination() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggRequest.pagination)
-  return _internal_pagination();
+inline void AggErrorsRow::set_errors_count(int64_t value) {
+  _internal_set_errors_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.errors_count)
 }
-inline void GetPerformanceAggRequest::unsafe_arena_set_allocated_pagination(
-    ::metricsys::aggregation::Pagination* pagination) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
-  }
-  _impl_.pagination_ = pagination;
-  if (pagination) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.pagination)
+
+// int64 warning_count = 6;
+inline void AggErrorsRow::clear_warning_count() {
+  _impl_.warning_count_ = int64_t{0};
 }
-inline ::metricsys::aggregation::Pagination* GetPerformanceAggRequest::release_pagination() {
-  
-  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
-  _impl_.pagination_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline int64_t AggErrorsRow::_internal_warning_count() const {
+  return _impl_.warning_count_;
 }
-inline ::metricsys::aggregation::Pagination* GetPerformanceAggRequest::unsafe_arena_release_pagination() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetPerformanceAggRequest.pagination)
-  
-  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
-  _impl_.pagination_ = nullptr;
-  return temp;
+inline int64_t AggErrorsRow::warning_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.warning_count)
+  return _internal_warning_count();
 }
-inline ::metricsys::aggregation::Pagination* GetPerformanceAggRequest::_internal_mutable_pagination() {
+inline void AggErrorsRow::_internal_set_warning_count(int64_t value) {
   
-  if (_impl_.pagination_ == nullptr) {
-    auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
-    _impl_.pagination_ = p;
-  }
-  return _impl_.pagination_;
-}
-inline ::metricsys::aggregation::Pagination* GetPerformanceAggRequest::mutable_pagination() {
-  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggRequest.pagination)
-  return _msg;
+  _impl_.warning_count_ = value;
 }
-inline void GetPerformanceAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.pagination_;
-  }
-  if (pagination) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
-    if (message_arena != submessage_arena) {
-      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pagination, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  _impl_.pagination_ = pagination;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetPerformanceAggRequest.pagination)
+inline void AggErrorsRow::set_warning_count(int64_t value) {
+  _internal_set_warning_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.warning_count)
 }
 
-// -------------------------------------------------------------------
-
-// GetPerformanceAggResponse
-
-// repeated .metricsys.aggregation.AggPerformanceRow rows = 1;
-inline int GetPerformanceAggResponse::_internal_rows_size() const {
-  return _impl_.rows_.size();
+// int64 critical_count = 7;
+inline void AggErrorsRow::clear_critical_count() {
+  _impl_.critical_count_ = int64_t{0};
 }
-inline int GetPerformanceAggResponse::rows_size() const {
-  return _internal_rows_size();
+inline int64_t AggErrorsRow::_internal_critical_count() const {
+  return _impl_.critical_count_;
 }
-inline void GetPerformanceAggResponse::clear_rows() {
-  _impl_.rows_.Clear();
+inline int64_t AggErrorsRow::critical_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.critical_count)
+  return _internal_critical_count();
 }
-inline ::metricsys::aggregation::AggPerformanceRow* GetPerformanceAggResponse::mutable_rows(int index) {
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetPerformanceAggResponse.rows)
-  return _impl_.rows_.Mutable(index);
+inline void AggErrorsRow::_internal_set_critical_count(int64_t value) {
+  
+  _impl_.critical_count_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggPerformanceRow >*
-GetPerformanceAggResponse::mutable_rows() {
-  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetPerformanceAggResponse.rows)
-  return &_impl_.rows_;
+inline void AggErrorsRow::set_critical_count(int64_t value) {
+  _internal_set_critical_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.critical_count)
 }
-inline const ::metricsys::aggregation::AggPerformanceRow& GetPerformanceAggResponse::_internal_rows(int index) const {
-  return _impl_.rows_.Get(index);
+
+// int64 unique_users = 8;
+inline void AggErrorsRow::clear_unique_users() {
+  _impl_.unique_users_ = int64_t{0};
 }
-inline const ::metricsys::aggregation::AggPerformanceRow& GetPerformanceAggResponse::rows(int index) const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetPerformanceAggResponse.rows)
-  return _internal_rows(index);
+inline int64_t AggErrorsRow::_internal_unique_users() const {
+  return _impl_.unique_users_;
 }
-inline ::metricsys::aggregation::AggPerformanceRow* GetPerformanceAggResponse::_internal_add_rows() {
-  return _impl_.rows_.Add();
+inline int64_t AggErrorsRow::unique_users() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.unique_users)
+  return _internal_unique_users();
 }
-inline ::metricsys::aggregation::AggPerformanceRow* GetPerformanceAggResponse::add_rows() {
-  ::metricsys::aggregation::AggPerformanceRow* _add = _internal_add_rows();
-  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetPerformanceAggResponse.rows)
-  return _add;
+inline void AggErrorsRow::_internal_set_unique_users(int64_t value) {
+  
+  _impl_.unique_users_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggPerformanceRow >&
-GetPerformanceAggResponse::rows() const {
-  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetPerformanceAggResponse.rows)
-  return _impl_.rows_;
+inline void AggErrorsRow::set_unique_users(int64_t value) {
+  _internal_set_unique_users(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.unique_users)
 }
 
-// -------------------------------------------------------------------
-
-// AggErrorsRow
-
-// .google.protobuf.Timestamp time_bucket = 1;
-inline bool AggErrorsRow::_internal_has_time_bucket() const {
-  return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
-}
-inline bool AggErrorsRow::has_time_bucket() const {
-  return _internal_has_time_bucket();
+// .google.protobuf.Timestamp created_at = 9;
+inline bool AggErrorsRow::_internal_has_created_at() const {
+  return this != internal_default_instance() && _impl_.created_at_ != nullptr;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggErrorsRow::_internal_time_bucket() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
+inline bool AggErrorsRow::has_created_at() const {
+  return _internal_has_created_at();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggErrorsRow::_internal_created_at() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
   return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
       ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggErrorsRow::time_bucket() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.time_bucket)
-  return _internal_time_bucket();
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggErrorsRow::created_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.created_at)
+  return _internal_created_at();
 }
-inline void AggErrorsRow::unsafe_arena_set_allocated_time_bucket(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+inline void AggErrorsRow::unsafe_arena_set_allocated_created_at(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
   }
-  _impl_.time_bucket_ = time_bucket;
-  if (time_bucket) {
+  _impl_.created_at_ = created_at;
+  if (created_at) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggErrorsRow.time_bucket)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggErrorsRow.created_at)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::release_time_bucket() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::release_created_at() {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
-  _impl_.time_bucket_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
+  _impl_.created_at_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -6665,83 +8162,107 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::release_time_bucket() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::unsafe_arena_release_time_bucket() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.time_bucket)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::unsafe_arena_release_created_at() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.created_at)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
-  _impl_.time_bucket_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
+  _impl_.created_at_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::_internal_mutable_time_bucket() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::_internal_mutable_created_at() {
   
-  if (_impl_.time_bucket_ == nullptr) {
+  if (_impl_.created_at_ == nullptr) {
     auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.time_bucket_ = p;
+    _impl_.created_at_ = p;
   }
-  return _impl_.time_bucket_;
+  return _impl_.created_at_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::mutable_time_bucket() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.time_bucket)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::mutable_created_at() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.created_at)
   return _msg;
 }
-inline void AggErrorsRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+inline void AggErrorsRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
   }
-  if (time_bucket) {
+  if (created_at) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
         ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_bucket));
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(created_at));
     if (message_arena != submessage_arena) {
-      time_bucket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, time_bucket, submessage_arena);
+      created_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, created_at, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.time_bucket_ = time_bucket;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.time_bucket)
+  _impl_.created_at_ = created_at;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.created_at)
 }
 
-// string project_id = 2;
-inline void AggErrorsRow::clear_project_id() {
+// uint32 step_seconds = 10;
+inline void AggErrorsRow::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
+}
+inline uint32_t AggErrorsRow::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
+}
+inline uint32_t AggErrorsRow::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.step_seconds)
+  return _internal_step_seconds();
+}
+inline void AggErrorsRow::_internal_set_step_seconds(uint32_t value) {
+  
+  _impl_.step_seconds_ = value;
+}
+inline void AggErrorsRow::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.step_seconds)
+}
+
+// -------------------------------------------------------------------
+
+// GetErrorsAggRequest
+
+// string project_id = 1;
+inline void GetErrorsAggRequest::clear_project_id() {
   _impl_.project_id_.ClearToEmpty();
 }
-inline const std::string& AggErrorsRow::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.project_id)
+inline const std::string& GetErrorsAggRequest::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.project_id)
   return _internal_project_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggErrorsRow::set_project_id(ArgT0&& arg0, ArgT... args) {
+void GetErrorsAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.project_id)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetErrorsAggRequest.project_id)
 }
-inline std::string* AggErrorsRow::mutable_project_id() {
+inline std::string* GetErrorsAggRequest::mutable_project_id() {
   std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.project_id)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.project_id)
   return _s;
 }
-inline const std::string& AggErrorsRow::_internal_project_id() const {
+inline const std::string& GetErrorsAggRequest::_internal_project_id() const {
   return _impl_.project_id_.Get();
 }
-inline void AggErrorsRow::_internal_set_project_id(const std::string& value) {
+inline void GetErrorsAggRequest::_internal_set_project_id(const std::string& value) {
   
   _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggErrorsRow::_internal_mutable_project_id() {
+inline std::string* GetErrorsAggRequest::_internal_mutable_project_id() {
   
   return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* AggErrorsRow::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.project_id)
+inline std::string* GetErrorsAggRequest::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.project_id)
   return _impl_.project_id_.Release();
 }
-inline void AggErrorsRow::set_allocated_project_id(std::string* project_id) {
+inline void GetErrorsAggRequest::set_allocated_project_id(std::string* project_id) {
   if (project_id != nullptr) {
     
   } else {
@@ -6753,49 +8274,157 @@ inline void AggErrorsRow::set_allocated_project_id(std::string* project_id) {
     _impl_.project_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.project_id)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.project_id)
 }
 
-// string page = 3;
-inline void AggErrorsRow::clear_page() {
+// .metricsys.aggregation.TimeRange time_range = 2;
+inline bool GetErrorsAggRequest::_internal_has_time_range() const {
+  return this != internal_default_instance() && _impl_.time_range_ != nullptr;
+}
+inline bool GetErrorsAggRequest::has_time_range() const {
+  return _internal_has_time_range();
+}
+inline void GetErrorsAggRequest::clear_time_range() {
+  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
+    delete _impl_.time_range_;
+  }
+  _impl_.time_range_ = nullptr;
+}
+inline const ::metricsys::aggregation::TimeRange& GetErrorsAggRequest::_internal_time_range() const {
+  const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
+      ::metricsys::aggregation::_TimeRange_default_instance_);
+}
+inline const ::metricsys::aggregation::TimeRange& GetErrorsAggRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetErrorsAggRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::aggregation::TimeRange* time_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
+  }
+  _impl_.time_range_ = time_range;
+  if (time_range) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetErrorsAggRequest.time_range)
+}
+inline ::metricsys::aggregation::TimeRange* GetErrorsAggRequest::release_time_range() {
+  
+  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::aggregation::TimeRange* GetErrorsAggRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.time_range)
+  
+  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::aggregation::TimeRange* GetErrorsAggRequest::_internal_mutable_time_range() {
+  
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
+  }
+  return _impl_.time_range_;
+}
+inline ::metricsys::aggregation::TimeRange* GetErrorsAggRequest::mutable_time_range() {
+  ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.time_range)
+  return _msg;
+}
+inline void GetErrorsAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.time_range_;
+  }
+  if (time_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
+    if (message_arena != submessage_arena) {
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.time_range)
+}
+
+// optional string page = 3;
+inline bool GetErrorsAggRequest::_internal_has_page() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetErrorsAggRequest::has_page() const {
+  return _internal_has_page();
+}
+inline void GetErrorsAggRequest::clear_page() {
   _impl_.page_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& AggErrorsRow::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.page)
+inline const std::string& GetErrorsAggRequest::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.page)
   return _internal_page();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggErrorsRow::set_page(ArgT0&& arg0, ArgT... args) {
- 
+void GetErrorsAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.page)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetErrorsAggRequest.page)
 }
-inline std::string* AggErrorsRow::mutable_page() {
+inline std::string* GetErrorsAggRequest::mutable_page() {
   std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.page)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.page)
   return _s;
 }
-inline const std::string& AggErrorsRow::_internal_page() const {
+inline const std::string& GetErrorsAggRequest::_internal_page() const {
   return _impl_.page_.Get();
 }
-inline void AggErrorsRow::_internal_set_page(const std::string& value) {
-  
+inline void GetErrorsAggRequest::_internal_set_page(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggErrorsRow::_internal_mutable_page() {
-  
+inline std::string* GetErrorsAggRequest::_internal_mutable_page() {
+  _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline std::string* AggErrorsRow::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.page)
-  return _impl_.page_.Release();
+inline std::string* GetErrorsAggRequest::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.page)
+  if (!_internal_has_page()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void AggErrorsRow::set_allocated_page(std::string* page) {
+inline void GetErrorsAggRequest::set_allocated_page(std::string* page) {
   if (page != nullptr) {
-    
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   _impl_.page_.SetAllocated(page, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -6803,54 +8432,54 @@ inline void AggErrorsRow::set_allocated_page(std::string* page) {
     _impl_.page_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.page)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.page)
 }
 
 // optional string error_type = 4;
-inline bool AggErrorsRow::_internal_has_error_type() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+inline bool GetErrorsAggRequest::_internal_has_error_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool AggErrorsRow::has_error_type() const {
+inline bool GetErrorsAggRequest::has_error_type() const {
   return _internal_has_error_type();
 }
-inline void AggErrorsRow::clear_error_type() {
+inline void GetErrorsAggRequest::clear_error_type() {
   _impl_.error_type_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& AggErrorsRow::error_type() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.error_type)
+inline const std::string& GetErrorsAggRequest::error_type() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.error_type)
   return _internal_error_type();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggErrorsRow::set_error_type(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
+void GetErrorsAggRequest::set_error_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
  _impl_.error_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.error_type)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetErrorsAggRequest.error_type)
 }
-inline std::string* AggErrorsRow::mutable_error_type() {
+inline std::string* GetErrorsAggRequest::mutable_error_type() {
   std::string* _s = _internal_mutable_error_type();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.error_type)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.error_type)
   return _s;
 }
-inline const std::string& AggErrorsRow::_internal_error_type() const {
+inline const std::string& GetErrorsAggRequest::_internal_error_type() const {
   return _impl_.error_type_.Get();
 }
-inline void AggErrorsRow::_internal_set_error_type(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline void GetErrorsAggRequest::_internal_set_error_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
   _impl_.error_type_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggErrorsRow::_internal_mutable_error_type() {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline std::string* GetErrorsAggRequest::_internal_mutable_error_type() {
+  _impl_._has_bits_[0] |= 0x00000002u;
   return _impl_.error_type_.Mutable(GetArenaForAllocation());
 }
-inline std::string* AggErrorsRow::release_error_type() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.error_type)
+inline std::string* GetErrorsAggRequest::release_error_type() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.error_type)
   if (!_internal_has_error_type()) {
     return nullptr;
   }
-  _impl_._has_bits_[0] &= ~0x00000001u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
   auto* p = _impl_.error_type_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (_impl_.error_type_.IsDefault()) {
@@ -6859,11 +8488,11 @@ inline std::string* AggErrorsRow::release_error_type() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void AggErrorsRow::set_allocated_error_type(std::string* error_type) {
+inline void GetErrorsAggRequest::set_allocated_error_type(std::string* error_type) {
   if (error_type != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   _impl_.error_type_.SetAllocated(error_type, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -6871,122 +8500,200 @@ inline void AggErrorsRow::set_allocated_error_type(std::string* error_type) {
     _impl_.error_type_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.error_type)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.error_type)
 }
 
-// int64 errors_count = 5;
-inline void AggErrorsRow::clear_errors_count() {
-  _impl_.errors_count_ = int64_t{0};
+// .metricsys.aggregation.Pagination pagination = 5;
+inline bool GetErrorsAggRequest::_internal_has_pagination() const {
+  return this != internal_default_instance() && _impl_.pagination_ != nullptr;
 }
-inline int64_t AggErrorsRow::_internal_errors_count() const {
-  return _impl_.errors_count_;
+inline bool GetErrorsAggRequest::has_pagination() const {
+  return _internal_has_pagination();
 }
-inline int64_t AggErrorsRow::errors_count() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.errors_count)
-  return _internal_errors_count();
+inline void GetErrorsAggRequest::clear_pagination() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
+    delete _impl_.pagination_;
+  }
+  _impl_.pagination_ = nullptr;
 }
-inline void AggErrorsRow::_internal_set_errors_count(int64_t value) {
-  
-  _impl_.errors_count_ = value;
+inline const ::metricsys::aggregation::Pagination& GetErrorsAggRequest::_internal_pagination() const {
+  const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
+      ::metricsys::aggregation::_Pagination_default_instance_);
 }
-inline void AggErrorsRow::set_errors_count(int64_t value) {
-  _internal_set_errors_count(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.errors_count)
+inline const ::metricsys::aggregation::Pagination& GetErrorsAggRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.pagination)
+  return _internal_pagination();
 }
-
-// int64 warning_count = 6;
-inline void AggErrorsRow::clear_warning_count() {
-  _impl_.warning_count_ = int64_t{0};
+inline void GetErrorsAggRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::aggregation::Pagination* pagination) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+  }
+  _impl_.pagination_ = pagination;
+  if (pagination) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetErrorsAggRequest.pagination)
 }
-inline int64_t AggErrorsRow::_internal_warning_count() const {
-  return _impl_.warning_count_;
+inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::release_pagination() {
+  
+  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline int64_t AggErrorsRow::warning_count() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.warning_count)
-  return _internal_warning_count();
+inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.pagination)
+  
+  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+  return temp;
 }
-inline void AggErrorsRow::_internal_set_warning_count(int64_t value) {
+inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::_internal_mutable_pagination() {
   
-  _impl_.warning_count_ = value;
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
+  }
+  return _impl_.pagination_;
 }
-inline void AggErrorsRow::set_warning_count(int64_t value) {
-  _internal_set_warning_count(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.warning_count)
+inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::mutable_pagination() {
+  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.pagination)
+  return _msg;
+}
+inline void GetErrorsAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pagination_;
+  }
+  if (pagination) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+    if (message_arena != submessage_arena) {
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.pagination)
 }
 
-// int64 critical_count = 7;
-inline void AggErrorsRow::clear_critical_count() {
-  _impl_.critical_count_ = int64_t{0};
+// uint32 step_seconds = 6;
+inline void GetErrorsAggRequest::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
 }
-inline int64_t AggErrorsRow::_internal_critical_count() const {
-  return _impl_.critical_count_;
+inline uint32_t GetErrorsAggRequest::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
 }
-inline int64_t AggErrorsRow::critical_count() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.critical_count)
-  return _internal_critical_count();
+inline uint32_t GetErrorsAggRequest::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.step_seconds)
+  return _internal_step_seconds();
 }
-inline void AggErrorsRow::_internal_set_critical_count(int64_t value) {
+inline void GetErrorsAggRequest::_internal_set_step_seconds(uint32_t value) {
   
-  _impl_.critical_count_ = value;
+  _impl_.step_seconds_ = value;
 }
-inline void AggErrorsRow::set_critical_count(int64_t value) {
-  _internal_set_critical_count(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.critical_count)
+inline void GetErrorsAggRequest::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetErrorsAggRequest.step_seconds)
 }
 
-// int64 unique_users = 8;
-inline void AggErrorsRow::clear_unique_users() {
-  _impl_.unique_users_ = int64_t{0};
+// -------------------------------------------------------------------
+
+// GetErrorsAggResponse
+
+// repeated .metricsys.aggregation.AggErrorsRow rows = 1;
+inline int GetErrorsAggResponse::_internal_rows_size() const {
+  return _impl_.rows_.size();
 }
-inline int64_t AggErrorsRow::_internal_unique_users() const {
-  return _impl_.unique_users_;
+inline int GetErrorsAggResponse::rows_size() const {
+  return _internal_rows_size();
 }
-inline int64_t AggErrorsRow::unique_users() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.unique_users)
-  return _internal_unique_users();
+inline void GetErrorsAggResponse::clear_rows() {
+  _impl_.rows_.Clear();
 }
-inline void AggErrorsRow::_internal_set_unique_users(int64_t value) {
-  
-  _impl_.unique_users_ = value;
+inline ::metricsys::aggregation::AggErrorsRow* GetErrorsAggResponse::mutable_rows(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggResponse.rows)
+  return _impl_.rows_.Mutable(index);
 }
-inline void AggErrorsRow::set_unique_users(int64_t value) {
-  _internal_set_unique_users(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggErrorsRow.unique_users)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggErrorsRow >*
+GetErrorsAggResponse::mutable_rows() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetErrorsAggResponse.rows)
+  return &_impl_.rows_;
+}
+inline const ::metricsys::aggregation::AggErrorsRow& GetErrorsAggResponse::_internal_rows(int index) const {
+  return _impl_.rows_.Get(index);
+}
+inline const ::metricsys::aggregation::AggErrorsRow& GetErrorsAggResponse::rows(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggResponse.rows)
+  return _internal_rows(index);
+}
+inline ::metricsys::aggregation::AggErrorsRow* GetErrorsAggResponse::_internal_add_rows() {
+  return _impl_.rows_.Add();
+}
+inline ::metricsys::aggregation::AggErrorsRow* GetErrorsAggResponse::add_rows() {
+  ::metricsys::aggregation::AggErrorsRow* _add = _internal_add_rows();
+  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetErrorsAggResponse.rows)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggErrorsRow >&
+GetErrorsAggResponse::rows() const {
+  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetErrorsAggResponse.rows)
+  return _impl_.rows_;
 }
 
-// .google.protobuf.Timestamp created_at = 9;
-inline bool AggErrorsRow::_internal_has_created_at() const {
-  return this != internal_default_instance() && _impl_.created_at_ != nullptr;
+// -------------------------------------------------------------------
+
+// AggCustomEventsRow
+
+// .google.protobuf.Timestamp time_bucket = 1;
+inline bool AggCustomEventsRow::_internal_has_time_bucket() const {
+  return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
 }
-inline bool AggErrorsRow::has_created_at() const {
-  return _internal_has_created_at();
+inline bool AggCustomEventsRow::has_time_bucket() const {
+  return _internal_has_time_bucket();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggErrorsRow::_internal_created_at() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggCustomEventsRow::_internal_time_bucket() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
   return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
       ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggErrorsRow::created_at() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggErrorsRow.created_at)
-  return _internal_created_at();
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggCustomEventsRow::time_bucket() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.time_bucket)
+  return _internal_time_bucket();
 }
-inline void AggErrorsRow::unsafe_arena_set_allocated_created_at(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline void AggCustomEventsRow::unsafe_arena_set_allocated_time_bucket(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
   }
-  _impl_.created_at_ = created_at;
-  if (created_at) {
+  _impl_.time_bucket_ = time_bucket;
+  if (time_bucket) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggErrorsRow.created_at)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggCustomEventsRow.time_bucket)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::release_created_at() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::release_time_bucket() {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
-  _impl_.created_at_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
+  _impl_.time_bucket_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -6998,87 +8705,83 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::release_created_at() {
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::unsafe_arena_release_created_at() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggErrorsRow.created_at)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::unsafe_arena_release_time_bucket() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.time_bucket)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
-  _impl_.created_at_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
+  _impl_.time_bucket_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::_internal_mutable_created_at() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::_internal_mutable_time_bucket() {
   
-  if (_impl_.created_at_ == nullptr) {
+  if (_impl_.time_bucket_ == nullptr) {
     auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.created_at_ = p;
+    _impl_.time_bucket_ = p;
   }
-  return _impl_.created_at_;
+  return _impl_.time_bucket_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggErrorsRow::mutable_created_at() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggErrorsRow.created_at)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::mutable_time_bucket() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.time_bucket)
   return _msg;
 }
-inline void AggErrorsRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline void AggCustomEventsRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
   }
-  if (created_at) {
+  if (time_bucket) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
         ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(created_at));
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_bucket));
     if (message_arena != submessage_arena) {
-      created_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, created_at, submessage_arena);
+      time_bucket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_bucket, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.created_at_ = created_at;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggErrorsRow.created_at)
+  _impl_.time_bucket_ = time_bucket;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.time_bucket)
 }
 
-// -------------------------------------------------------------------
-
-// GetErrorsAggRequest
-
-// string project_id = 1;
-inline void GetErrorsAggRequest::clear_project_id() {
+// string project_id = 2;
+inline void AggCustomEventsRow::clear_project_id() {
   _impl_.project_id_.ClearToEmpty();
 }
-inline const std::string& GetErrorsAggRequest::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.project_id)
+inline const std::string& AggCustomEventsRow::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.project_id)
   return _internal_project_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetErrorsAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
+void AggCustomEventsRow::set_project_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetErrorsAggRequest.project_id)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.project_id)
 }
-inline std::string* GetErrorsAggRequest::mutable_project_id() {
+inline std::string* AggCustomEventsRow::mutable_project_id() {
   std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.project_id)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.project_id)
   return _s;
 }
-inline const std::string& GetErrorsAggRequest::_internal_project_id() const {
+inline const std::string& AggCustomEventsRow::_internal_project_id() const {
   return _impl_.project_id_.Get();
 }
-inline void GetErrorsAggRequest::_internal_set_project_id(const std::string& value) {
+inline void AggCustomEventsRow::_internal_set_project_id(const std::string& value) {
   
   _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetErrorsAggRequest::_internal_mutable_project_id() {
+inline std::string* AggCustomEventsRow::_internal_mutable_project_id() {
   
   return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetErrorsAggRequest::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.project_id)
+inline std::string* AggCustomEventsRow::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.project_id)
   return _impl_.project_id_.Release();
 }
-inline void GetErrorsAggRequest::set_allocated_project_id(std::string* project_id) {
+inline void AggCustomEventsRow::set_allocated_project_id(std::string* project_id) {
   if (project_id != nullptr) {
     
   } else {
@@ -7090,140 +8793,100 @@ inline void GetErrorsAggRequest::set_allocated_project_id(std::string* project_i
     _impl_.project_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.project_id)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.project_id)
 }
 
-// .metricsys.aggregation.TimeRange time_range = 2;
-inline bool GetErrorsAggRequest::_internal_has_time_range() const {
-  return this != internal_default_instance() && _impl_.time_range_ != nullptr;
-}
-inline bool GetErrorsAggRequest::has_time_range() const {
-  return _internal_has_time_range();
-}
-inline void GetErrorsAggRequest::clear_time_range() {
-  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
-    delete _impl_.time_range_;
-  }
-  _impl_.time_range_ = nullptr;
+// string event_name = 3;
+inline void AggCustomEventsRow::clear_event_name() {
+  _impl_.event_name_.ClearToEmpty();
 }
-inline const ::metricsys::aggregation::TimeRange& GetErrorsAggRequest::_internal_time_range() const {
-  const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
-  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
-      ::metricsys::aggregation::_TimeRange_default_instance_);
+inline const std::string& AggCustomEventsRow::event_name() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.event_name)
+  return _internal_event_name();
 }
-inline const ::metricsys::aggregation::TimeRange& GetErrorsAggRequest::time_range() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.time_range)
-  return _internal_time_range();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AggCustomEventsRow::set_event_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.event_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.event_name)
 }
-inline void GetErrorsAggRequest::unsafe_arena_set_allocated_time_range(
-    ::metricsys::aggregation::TimeRange* time_range) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
-  }
-  _impl_.time_range_ = time_range;
-  if (time_range) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetErrorsAggRequest.time_range)
+inline std::string* AggCustomEventsRow::mutable_event_name() {
+  std::string* _s = _internal_mutable_event_name();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.event_name)
+  return _s;
 }
-inline ::metricsys::aggregation::TimeRange* GetErrorsAggRequest::release_time_range() {
-  
-  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
-  _impl_.time_range_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& AggCustomEventsRow::_internal_event_name() const {
+  return _impl_.event_name_.Get();
 }
-inline ::metricsys::aggregation::TimeRange* GetErrorsAggRequest::unsafe_arena_release_time_range() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.time_range)
+inline void AggCustomEventsRow::_internal_set_event_name(const std::string& value) {
   
-  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
-  _impl_.time_range_ = nullptr;
-  return temp;
+  _impl_.event_name_.Set(value, GetArenaForAllocation());
 }
-inline ::metricsys::aggregation::TimeRange* GetErrorsAggRequest::_internal_mutable_time_range() {
+inline std::string* AggCustomEventsRow::_internal_mutable_event_name() {
   
-  if (_impl_.time_range_ == nullptr) {
-    auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
-    _impl_.time_range_ = p;
-  }
-  return _impl_.time_range_;
+  return _impl_.event_name_.Mutable(GetArenaForAllocation());
 }
-inline ::metricsys::aggregation::TimeRange* GetErrorsAggRequest::mutable_time_range() {
-  ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.time_range)
-  return _msg;
+inline std::string* AggCustomEventsRow::release_event_name() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.event_name)
+  return _impl_.event_name_.Release();
 }
-inline void GetErrorsAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.time_range_;
-  }
-  if (time_range) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
-    if (message_arena != submessage_arena) {
-      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, time_range, submessage_arena);
-    }
+inline void AggCustomEventsRow::set_allocated_event_name(std::string* event_name) {
+  if (event_name != nullptr) {
     
   } else {
     
   }
-  _impl_.time_range_ = time_range;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.time_range)
+  _impl_.event_name_.SetAllocated(event_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_name_.IsDefault()) {
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.event_name)
 }
 
-// optional string page = 3;
-inline bool GetErrorsAggRequest::_internal_has_page() const {
+// optional string page = 4;
+inline bool AggCustomEventsRow::_internal_has_page() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool GetErrorsAggRequest::has_page() const {
+inline bool AggCustomEventsRow::has_page() const {
   return _internal_has_page();
 }
-inline void GetErrorsAggRequest::clear_page() {
+inline void AggCustomEventsRow::clear_page() {
   _impl_.page_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& GetErrorsAggRequest::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.page)
+inline const std::string& AggCustomEventsRow::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.page)
   return _internal_page();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetErrorsAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
+void AggCustomEventsRow::set_page(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetErrorsAggRequest.page)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.page)
 }
-inline std::string* GetErrorsAggRequest::mutable_page() {
+inline std::string* AggCustomEventsRow::mutable_page() {
   std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.page)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.page)
   return _s;
 }
-inline const std::string& GetErrorsAggRequest::_internal_page() const {
+inline const std::string& AggCustomEventsRow::_internal_page() const {
   return _impl_.page_.Get();
 }
-inline void GetErrorsAggRequest::_internal_set_page(const std::string& value) {
+inline void AggCustomEventsRow::_internal_set_page(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetErrorsAggRequest::_internal_mutable_page() {
+inline std::string* AggCustomEventsRow::_internal_mutable_page() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetErrorsAggRequest::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.page)
+inline std::string* AggCustomEventsRow::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.page)
   if (!_internal_has_page()) {
     return nullptr;
   }
@@ -7236,7 +8899,7 @@ inline std::string* GetErrorsAggRequest::release_page() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void GetErrorsAggRequest::set_allocated_page(std::string* page) {
+inline void AggCustomEventsRow::set_allocated_page(std::string* page) {
   if (page != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -7248,116 +8911,102 @@ inline void GetErrorsAggRequest::set_allocated_page(std::string* page) {
     _impl_.page_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.page)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.page)
 }
 
-// optional string error_type = 4;
-inline bool GetErrorsAggRequest::_internal_has_error_type() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
+// int64 events_count = 5;
+inline void AggCustomEventsRow::clear_events_count() {
+  _impl_.events_count_ = int64_t{0};
 }
-inline bool GetErrorsAggRequest::has_error_type() const {
-  return _internal_has_error_type();
+inline int64_t AggCustomEventsRow::_internal_events_count() const {
+  return _impl_.events_count_;
 }
-inline void GetErrorsAggRequest::clear_error_type() {
-  _impl_.error_type_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+inline int64_t AggCustomEventsRow::events_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.events_count)
+  return _internal_events_count();
 }
-inline const std::string& GetErrorsAggRequest::error_type() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.error_type)
-  return _internal_error_type();
+inline void AggCustomEventsRow::_internal_set_events_count(int64_t value) {
+  
+  _impl_.events_count_ = value;
+}
+inline void AggCustomEventsRow::set_events_count(int64_t value) {
+  _internal_set_events_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.events_count)
+}
+
+// int64 unique_users = 6;
+inline void AggCustomEventsRow::clear_unique_users() {
+  _impl_.unique_users_ = int64_t{0};
+}
+inline int64_t AggCustomEventsRow::_internal_unique_users() const {
+  return _impl_.unique_users_;
+}
+inline int64_t AggCustomEventsRow::unique_users() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.unique_users)
+  return _internal_unique_users();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetErrorsAggRequest::set_error_type(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.error_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetErrorsAggRequest.error_type)
+inline void AggCustomEventsRow::_internal_set_unique_users(int64_t value) {
+  
+  _impl_.unique_users_ = value;
 }
-inline std::string* GetErrorsAggRequest::mutable_error_type() {
-  std::string* _s = _internal_mutable_error_type();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.error_type)
-  return _s;
+inline void AggCustomEventsRow::set_unique_users(int64_t value) {
+  _internal_set_unique_users(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.unique_users)
 }
-inline const std::string& GetErrorsAggRequest::_internal_error_type() const {
-  return _impl_.error_type_.Get();
+
+// int64 unique_sessions = 7;
+inline void AggCustomEventsRow::clear_unique_sessions() {
+  _impl_.unique_sessions_ = int64_t{0};
 }
-inline void GetErrorsAggRequest::_internal_set_error_type(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.error_type_.Set(value, GetArenaForAllocation());
+inline int64_t AggCustomEventsRow::_internal_unique_sessions() const {
+  return _impl_.unique_sessions_;
 }
-inline std::string* GetErrorsAggRequest::_internal_mutable_error_type() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.error_type_.Mutable(GetArenaForAllocation());
+inline int64_t AggCustomEventsRow::unique_sessions() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.unique_sessions)
+  return _internal_unique_sessions();
 }
-inline std::string* GetErrorsAggRequest::release_error_type() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.error_type)
-  if (!_internal_has_error_type()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.error_type_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_type_.IsDefault()) {
-    _impl_.error_type_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline void AggCustomEventsRow::_internal_set_unique_sessions(int64_t value) {
+  
+  _impl_.unique_sessions_ = value;
 }
-inline void GetErrorsAggRequest::set_allocated_error_type(std::string* error_type) {
-  if (error_type != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.error_type_.SetAllocated(error_type, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_type_.IsDefault()) {
-    _impl_.error_type_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.error_type)
+inline void AggCustomEventsRow::set_unique_sessions(int64_t value) {
+  _internal_set_unique_sessions(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.unique_sessions)
 }
 
-// .metricsys.aggregation.Pagination pagination = 5;
-inline bool GetErrorsAggRequest::_internal_has_pagination() const {
-  return this != internal_default_instance() && _impl_.pagination_ != nullptr;
-}
-inline bool GetErrorsAggRequest::has_pagination() const {
-  return _internal_has_pagination();
+// .google.protobuf.Timestamp created_at = 8;
+inline bool AggCustomEventsRow::_internal_has_created_at() const {
+  return this != internal_default_instance() && _impl_.created_at_ != nullptr;
 }
-inline void GetErrorsAggRequest::clear_pagination() {
-  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
-    delete _impl_.pagination_;
-  }
-  _impl_.pagination_ = nullptr;
+inline bool AggCustomEventsRow::has_created_at() const {
+  return _internal_has_created_at();
 }
-inline const ::metricsys::aggregation::Pagination& GetErrorsAggRequest::_internal_pagination() const {
-  const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
-  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
-      ::metricsys::aggregation::_Pagination_default_instance_);
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggCustomEventsRow::_internal_created_at() const {
+  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
+      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
 }
-inline const ::metricsys::aggregation::Pagination& GetErrorsAggRequest::pagination() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggRequest.pagination)
-  return _internal_pagination();
+inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggCustomEventsRow::created_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.created_at)
+  return _internal_created_at();
 }
-inline void GetErrorsAggRequest::unsafe_arena_set_allocated_pagination(
-    ::metricsys::aggregation::Pagination* pagination) {
+inline void AggCustomEventsRow::unsafe_arena_set_allocated_created_at(
+    ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
   }
-  _impl_.pagination_ = pagination;
-  if (pagination) {
+  _impl_.created_at_ = created_at;
+  if (created_at) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetErrorsAggRequest.pagination)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggCustomEventsRow.created_at)
 }
-inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::release_pagination() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::release_created_at() {
   
-  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
-  _impl_.pagination_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
+  _impl_.created_at_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -7369,127 +9018,160 @@ inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::release_pagina
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::unsafe_arena_release_pagination() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetErrorsAggRequest.pagination)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::unsafe_arena_release_created_at() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.created_at)
   
-  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
-  _impl_.pagination_ = nullptr;
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
+  _impl_.created_at_ = nullptr;
   return temp;
 }
-inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::_internal_mutable_pagination() {
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::_internal_mutable_created_at() {
   
-  if (_impl_.pagination_ == nullptr) {
-    auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
-    _impl_.pagination_ = p;
+  if (_impl_.created_at_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
+    _impl_.created_at_ = p;
   }
-  return _impl_.pagination_;
+  return _impl_.created_at_;
 }
-inline ::metricsys::aggregation::Pagination* GetErrorsAggRequest::mutable_pagination() {
-  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggRequest.pagination)
+inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::mutable_created_at() {
+  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.created_at)
   return _msg;
 }
-inline void GetErrorsAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
+inline void AggCustomEventsRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete _impl_.pagination_;
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
   }
-  if (pagination) {
+  if (created_at) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(created_at));
     if (message_arena != submessage_arena) {
-      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pagination, submessage_arena);
+      created_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, created_at, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.pagination_ = pagination;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetErrorsAggRequest.pagination)
+  _impl_.created_at_ = created_at;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.created_at)
+}
+
+// uint32 step_seconds = 9;
+inline void AggCustomEventsRow::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
+}
+inline uint32_t AggCustomEventsRow::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
+}
+inline uint32_t AggCustomEventsRow::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.step_seconds)
+  return _internal_step_seconds();
+}
+inline void AggCustomEventsRow::_internal_set_step_seconds(uint32_t value) {
+  
+  _impl_.step_seconds_ = value;
+}
+inline void AggCustomEventsRow::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.step_seconds)
 }
 
 // -------------------------------------------------------------------
 
-// GetErrorsAggResponse
+// GetCustomEventsAggRequest
 
-// repeated .metricsys.aggregation.AggErrorsRow rows = 1;
-inline int GetErrorsAggResponse::_internal_rows_size() const {
-  return _impl_.rows_.size();
-}
-inline int GetErrorsAggResponse::rows_size() const {
-  return _internal_rows_size();
+// string project_id = 1;
+inline void GetCustomEventsAggRequest::clear_project_id() {
+  _impl_.project_id_.ClearToEmpty();
 }
-inline void GetErrorsAggResponse::clear_rows() {
-  _impl_.rows_.Clear();
+inline const std::string& GetCustomEventsAggRequest::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
+  return _internal_project_id();
 }
-inline ::metricsys::aggregation::AggErrorsRow* GetErrorsAggResponse::mutable_rows(int index) {
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetErrorsAggResponse.rows)
-  return _impl_.rows_.Mutable(index);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCustomEventsAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggErrorsRow >*
-GetErrorsAggResponse::mutable_rows() {
-  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetErrorsAggResponse.rows)
-  return &_impl_.rows_;
+inline std::string* GetCustomEventsAggRequest::mutable_project_id() {
+  std::string* _s = _internal_mutable_project_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
+  return _s;
 }
-inline const ::metricsys::aggregation::AggErrorsRow& GetErrorsAggResponse::_internal_rows(int index) const {
-  return _impl_.rows_.Get(index);
+inline const std::string& GetCustomEventsAggRequest::_internal_project_id() const {
+  return _impl_.project_id_.Get();
 }
-inline const ::metricsys::aggregation::AggErrorsRow& GetErrorsAggResponse::rows(int index) const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetErrorsAggResponse.rows)
-  return _internal_rows(index);
+inline void GetCustomEventsAggRequest::_internal_set_project_id(const std::string& value) {
+  
+  _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline ::metricsys::aggregation::AggErrorsRow* GetErrorsAggResponse::_internal_add_rows() {
-  return _impl_.rows_.Add();
+inline std::string* GetCustomEventsAggRequest::_internal_mutable_project_id() {
+  
+  return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline ::metricsys::aggregation::AggErrorsRow* GetErrorsAggResponse::add_rows() {
-  ::metricsys::aggregation::AggErrorsRow* _add = _internal_add_rows();
-  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetErrorsAggResponse.rows)
-  return _add;
+inline std::string* GetCustomEventsAggRequest::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
+  return _impl_.project_id_.Release();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggErrorsRow >&
-GetErrorsAggResponse::rows() const {
-  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetErrorsAggResponse.rows)
-  return _impl_.rows_;
+inline void GetCustomEventsAggRequest::set_allocated_project_id(std::string* project_id) {
+  if (project_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.project_id_.SetAllocated(project_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.project_id_.IsDefault()) {
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
 }
 
-// -------------------------------------------------------------------
-
-// AggCustomEventsRow
-
-// .google.protobuf.Timestamp time_bucket = 1;
-inline bool AggCustomEventsRow::_internal_has_time_bucket() const {
-  return this != internal_default_instance() && _impl_.time_bucket_ != nullptr;
+// .metricsys.aggregation.TimeRange time_range = 2;
+inline bool GetCustomEventsAggRequest::_internal_has_time_range() const {
+  return this != internal_default_instance() && _impl_.time_range_ != nullptr;
 }
-inline bool AggCustomEventsRow::has_time_bucket() const {
-  return _internal_has_time_bucket();
+inline bool GetCustomEventsAggRequest::has_time_range() const {
+  return _internal_has_time_range();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggCustomEventsRow::_internal_time_bucket() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.time_bucket_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
-      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+inline void GetCustomEventsAggRequest::clear_time_range() {
+  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
+    delete _impl_.time_range_;
+  }
+  _impl_.time_range_ = nullptr;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggCustomEventsRow::time_bucket() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.time_bucket)
-  return _internal_time_bucket();
+inline const ::metricsys::aggregation::TimeRange& GetCustomEventsAggRequest::_internal_time_range() const {
+  const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
+      ::metricsys::aggregation::_TimeRange_default_instance_);
 }
-inline void AggCustomEventsRow::unsafe_arena_set_allocated_time_bucket(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+inline const ::metricsys::aggregation::TimeRange& GetCustomEventsAggRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetCustomEventsAggRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::aggregation::TimeRange* time_range) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
   }
-  _impl_.time_bucket_ = time_bucket;
-  if (time_bucket) {
+  _impl_.time_range_ = time_range;
+  if (time_range) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggCustomEventsRow.time_bucket)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::release_time_bucket() {
+inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::release_time_range() {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
-  _impl_.time_bucket_ = nullptr;
+  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -7501,133 +9183,82 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::release_time_buck
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::unsafe_arena_release_time_bucket() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.time_bucket)
+inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.time_bucket_;
-  _impl_.time_bucket_ = nullptr;
+  ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::_internal_mutable_time_bucket() {
+inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::_internal_mutable_time_range() {
   
-  if (_impl_.time_bucket_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.time_bucket_ = p;
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
   }
-  return _impl_.time_bucket_;
+  return _impl_.time_range_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::mutable_time_bucket() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_time_bucket();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.time_bucket)
+inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::mutable_time_range() {
+  ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
   return _msg;
 }
-inline void AggCustomEventsRow::set_allocated_time_bucket(::PROTOBUF_NAMESPACE_ID::Timestamp* time_bucket) {
+inline void GetCustomEventsAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_bucket_);
+    delete _impl_.time_range_;
   }
-  if (time_bucket) {
+  if (time_range) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(time_bucket));
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
     if (message_arena != submessage_arena) {
-      time_bucket = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, time_bucket, submessage_arena);
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.time_bucket_ = time_bucket;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.time_bucket)
-}
-
-// string project_id = 2;
-inline void AggCustomEventsRow::clear_project_id() {
-  _impl_.project_id_.ClearToEmpty();
-}
-inline const std::string& AggCustomEventsRow::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.project_id)
-  return _internal_project_id();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void AggCustomEventsRow::set_project_id(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.project_id)
-}
-inline std::string* AggCustomEventsRow::mutable_project_id() {
-  std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.project_id)
-  return _s;
-}
-inline const std::string& AggCustomEventsRow::_internal_project_id() const {
-  return _impl_.project_id_.Get();
-}
-inline void AggCustomEventsRow::_internal_set_project_id(const std::string& value) {
-  
-  _impl_.project_id_.Set(value, GetArenaForAllocation());
-}
-inline std::string* AggCustomEventsRow::_internal_mutable_project_id() {
-  
-  return _impl_.project_id_.Mutable(GetArenaForAllocation());
-}
-inline std::string* AggCustomEventsRow::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.project_id)
-  return _impl_.project_id_.Release();
-}
-inline void AggCustomEventsRow::set_allocated_project_id(std::string* project_id) {
-  if (project_id != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.project_id_.SetAllocated(project_id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.project_id_.IsDefault()) {
-    _impl_.project_id_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.project_id)
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
 }
 
 // string event_name = 3;
-inline void AggCustomEventsRow::clear_event_name() {
+inline void GetCustomEventsAggRequest::clear_event_name() {
   _impl_.event_name_.ClearToEmpty();
 }
-inline const std::string& AggCustomEventsRow::event_name() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.event_name)
+inline const std::string& GetCustomEventsAggRequest::event_name() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
   return _internal_event_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggCustomEventsRow::set_event_name(ArgT0&& arg0, ArgT... args) {
+void GetCustomEventsAggRequest::set_event_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.event_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.event_name)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
 }
-inline std::string* AggCustomEventsRow::mutable_event_name() {
+inline std::string* GetCustomEventsAggRequest::mutable_event_name() {
   std::string* _s = _internal_mutable_event_name();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.event_name)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
   return _s;
 }
-inline const std::string& AggCustomEventsRow::_internal_event_name() const {
+inline const std::string& GetCustomEventsAggRequest::_internal_event_name() const {
   return _impl_.event_name_.Get();
 }
-inline void AggCustomEventsRow::_internal_set_event_name(const std::string& value) {
+inline void GetCustomEventsAggRequest::_internal_set_event_name(const std::string& value) {
   
   _impl_.event_name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggCustomEventsRow::_internal_mutable_event_name() {
+inline std::string* GetCustomEventsAggRequest::_internal_mutable_event_name() {
   
   return _impl_.event_name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* AggCustomEventsRow::release_event_name() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.event_name)
+inline std::string* GetCustomEventsAggRequest::release_event_name() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
   return _impl_.event_name_.Release();
 }
-inline void AggCustomEventsRow::set_allocated_event_name(std::string* event_name) {
+inline void GetCustomEventsAggRequest::set_allocated_event_name(std::string* event_name) {
   if (event_name != nullptr) {
     
   } else {
@@ -7639,170 +9270,116 @@ inline void AggCustomEventsRow::set_allocated_event_name(std::string* event_name
     _impl_.event_name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.event_name)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
 }
 
 // optional string page = 4;
-inline bool AggCustomEventsRow::_internal_has_page() const {
+inline bool GetCustomEventsAggRequest::_internal_has_page() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool AggCustomEventsRow::has_page() const {
+inline bool GetCustomEventsAggRequest::has_page() const {
   return _internal_has_page();
 }
-inline void AggCustomEventsRow::clear_page() {
+inline void GetCustomEventsAggRequest::clear_page() {
   _impl_.page_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& AggCustomEventsRow::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.page)
+inline const std::string& GetCustomEventsAggRequest::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.page)
   return _internal_page();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void AggCustomEventsRow::set_page(ArgT0&& arg0, ArgT... args) {
+void GetCustomEventsAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.page)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetCustomEventsAggRequest.page)
 }
-inline std::string* AggCustomEventsRow::mutable_page() {
+inline std::string* GetCustomEventsAggRequest::mutable_page() {
   std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.page)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.page)
   return _s;
 }
-inline const std::string& AggCustomEventsRow::_internal_page() const {
+inline const std::string& GetCustomEventsAggRequest::_internal_page() const {
   return _impl_.page_.Get();
 }
-inline void AggCustomEventsRow::_internal_set_page(const std::string& value) {
+inline void GetCustomEventsAggRequest::_internal_set_page(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline std::string* AggCustomEventsRow::_internal_mutable_page() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.page_.Mutable(GetArenaForAllocation());
-}
-inline std::string* AggCustomEventsRow::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.page)
-  if (!_internal_has_page()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.page_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
-}
-inline void AggCustomEventsRow::set_allocated_page(std::string* page) {
-  if (page != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.page_.IsDefault()) {
-    _impl_.page_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.page)
-}
-
-// int64 events_count = 5;
-inline void AggCustomEventsRow::clear_events_count() {
-  _impl_.events_count_ = int64_t{0};
-}
-inline int64_t AggCustomEventsRow::_internal_events_count() const {
-  return _impl_.events_count_;
-}
-inline int64_t AggCustomEventsRow::events_count() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.events_count)
-  return _internal_events_count();
-}
-inline void AggCustomEventsRow::_internal_set_events_count(int64_t value) {
-  
-  _impl_.events_count_ = value;
-}
-inline void AggCustomEventsRow::set_events_count(int64_t value) {
-  _internal_set_events_count(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.events_count)
-}
-
-// int64 unique_users = 6;
-inline void AggCustomEventsRow::clear_unique_users() {
-  _impl_.unique_users_ = int64_t{0};
-}
-inline int64_t AggCustomEventsRow::_internal_unique_users() const {
-  return _impl_.unique_users_;
-}
-inline int64_t AggCustomEventsRow::unique_users() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.unique_users)
-  return _internal_unique_users();
-}
-inline void AggCustomEventsRow::_internal_set_unique_users(int64_t value) {
-  
-  _impl_.unique_users_ = value;
-}
-inline void AggCustomEventsRow::set_unique_users(int64_t value) {
-  _internal_set_unique_users(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.unique_users)
-}
-
-// int64 unique_sessions = 7;
-inline void AggCustomEventsRow::clear_unique_sessions() {
-  _impl_.unique_sessions_ = int64_t{0};
-}
-inline int64_t AggCustomEventsRow::_internal_unique_sessions() const {
-  return _impl_.unique_sessions_;
-}
-inline int64_t AggCustomEventsRow::unique_sessions() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.unique_sessions)
-  return _internal_unique_sessions();
+inline std::string* GetCustomEventsAggRequest::_internal_mutable_page() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline void AggCustomEventsRow::_internal_set_unique_sessions(int64_t value) {
-  
-  _impl_.unique_sessions_ = value;
+inline std::string* GetCustomEventsAggRequest::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.page)
+  if (!_internal_has_page()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void AggCustomEventsRow::set_unique_sessions(int64_t value) {
-  _internal_set_unique_sessions(value);
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.AggCustomEventsRow.unique_sessions)
+inline void GetCustomEventsAggRequest::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.page)
 }
 
-// .google.protobuf.Timestamp created_at = 8;
-inline bool AggCustomEventsRow::_internal_has_created_at() const {
-  return this != internal_default_instance() && _impl_.created_at_ != nullptr;
+// .metricsys.aggregation.Pagination pagination = 5;
+inline bool GetCustomEventsAggRequest::_internal_has_pagination() const {
+  return this != internal_default_instance() && _impl_.pagination_ != nullptr;
 }
-inline bool AggCustomEventsRow::has_created_at() const {
-  return _internal_has_created_at();
+inline bool GetCustomEventsAggRequest::has_pagination() const {
+  return _internal_has_pagination();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggCustomEventsRow::_internal_created_at() const {
-  const ::PROTOBUF_NAMESPACE_ID::Timestamp* p = _impl_.created_at_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Timestamp&>(
-      ::PROTOBUF_NAMESPACE_ID::_Timestamp_default_instance_);
+inline void GetCustomEventsAggRequest::clear_pagination() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
+    delete _impl_.pagination_;
+  }
+  _impl_.pagination_ = nullptr;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Timestamp& AggCustomEventsRow::created_at() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.AggCustomEventsRow.created_at)
-  return _internal_created_at();
+inline const ::metricsys::aggregation::Pagination& GetCustomEventsAggRequest::_internal_pagination() const {
+  const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
+      ::metricsys::aggregation::_Pagination_default_instance_);
 }
-inline void AggCustomEventsRow::unsafe_arena_set_allocated_created_at(
-    ::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline const ::metricsys::aggregation::Pagination& GetCustomEventsAggRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
+  return _internal_pagination();
+}
+inline void GetCustomEventsAggRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::aggregation::Pagination* pagination) {
   if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
   }
-  _impl_.created_at_ = created_at;
-  if (created_at) {
+  _impl_.pagination_ = pagination;
+  if (pagination) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.AggCustomEventsRow.created_at)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::release_created_at() {
+inline ::metricsys::aggregation::Pagination* GetCustomEventsAggRequest::release_pagination() {
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
-  _impl_.created_at_ = nullptr;
+  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
   temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
@@ -7814,87 +9391,150 @@ inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::release_created_a
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::unsafe_arena_release_created_at() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.AggCustomEventsRow.created_at)
+inline ::metricsys::aggregation::Pagination* GetCustomEventsAggRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
   
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* temp = _impl_.created_at_;
-  _impl_.created_at_ = nullptr;
+  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
   return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::_internal_mutable_created_at() {
+inline ::metricsys::aggregation::Pagination* GetCustomEventsAggRequest::_internal_mutable_pagination() {
   
-  if (_impl_.created_at_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Timestamp>(GetArenaForAllocation());
-    _impl_.created_at_ = p;
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
   }
-  return _impl_.created_at_;
+  return _impl_.pagination_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Timestamp* AggCustomEventsRow::mutable_created_at() {
-  ::PROTOBUF_NAMESPACE_ID::Timestamp* _msg = _internal_mutable_created_at();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.AggCustomEventsRow.created_at)
+inline ::metricsys::aggregation::Pagination* GetCustomEventsAggRequest::mutable_pagination() {
+  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
   return _msg;
 }
-inline void AggCustomEventsRow::set_allocated_created_at(::PROTOBUF_NAMESPACE_ID::Timestamp* created_at) {
+inline void GetCustomEventsAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.created_at_);
+    delete _impl_.pagination_;
   }
-  if (created_at) {
+  if (pagination) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(created_at));
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
     if (message_arena != submessage_arena) {
-      created_at = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, created_at, submessage_arena);
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
     }
     
   } else {
     
   }
-  _impl_.created_at_ = created_at;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.AggCustomEventsRow.created_at)
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
+}
+
+// uint32 step_seconds = 6;
+inline void GetCustomEventsAggRequest::clear_step_seconds() {
+  _impl_.step_seconds_ = 0u;
+}
+inline uint32_t GetCustomEventsAggRequest::_internal_step_seconds() const {
+  return _impl_.step_seconds_;
+}
+inline uint32_t GetCustomEventsAggRequest::step_seconds() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.step_seconds)
+  return _internal_step_seconds();
+}
+inline void GetCustomEventsAggRequest::_internal_set_step_seconds(uint32_t value) {
+  
+  _impl_.step_seconds_ = value;
+}
+inline void GetCustomEventsAggRequest::set_step_seconds(uint32_t value) {
+  _internal_set_step_seconds(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetCustomEventsAggRequest.step_seconds)
 }
 
 // -------------------------------------------------------------------
 
-// GetCustomEventsAggRequest
+// GetCustomEventsAggResponse
+
+// repeated .metricsys.aggregation.AggCustomEventsRow rows = 1;
+inline int GetCustomEventsAggResponse::_internal_rows_size() const {
+  return _impl_.rows_.size();
+}
+inline int GetCustomEventsAggResponse::rows_size() const {
+  return _internal_rows_size();
+}
+inline void GetCustomEventsAggResponse::clear_rows() {
+  _impl_.rows_.Clear();
+}
+inline ::metricsys::aggregation::AggCustomEventsRow* GetCustomEventsAggResponse::mutable_rows(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggResponse.rows)
+  return _impl_.rows_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggCustomEventsRow >*
+GetCustomEventsAggResponse::mutable_rows() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetCustomEventsAggResponse.rows)
+  return &_impl_.rows_;
+}
+inline const ::metricsys::aggregation::AggCustomEventsRow& GetCustomEventsAggResponse::_internal_rows(int index) const {
+  return _impl_.rows_.Get(index);
+}
+inline const ::metricsys::aggregation::AggCustomEventsRow& GetCustomEventsAggResponse::rows(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggResponse.rows)
+  return _internal_rows(index);
+}
+inline ::metricsys::aggregation::AggCustomEventsRow* GetCustomEventsAggResponse::_internal_add_rows() {
+  return _impl_.rows_.Add();
+}
+inline ::metricsys::aggregation::AggCustomEventsRow* GetCustomEventsAggResponse::add_rows() {
+  ::metricsys::aggregation::AggCustomEventsRow* _add = _internal_add_rows();
+  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetCustomEventsAggResponse.rows)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggCustomEventsRow >&
+GetCustomEventsAggResponse::rows() const {
+  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetCustomEventsAggResponse.rows)
+  return _impl_.rows_;
+}
+
+// -------------------------------------------------------------------
+
+// GetUniquesAggRequest
 
 // string project_id = 1;
-inline void GetCustomEventsAggRequest::clear_project_id() {
+inline void GetUniquesAggRequest::clear_project_id() {
   _impl_.project_id_.ClearToEmpty();
 }
-inline const std::string& GetCustomEventsAggRequest::project_id() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
+inline const std::string& GetUniquesAggRequest::project_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggRequest.project_id)
   return _internal_project_id();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetCustomEventsAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
+void GetUniquesAggRequest::set_project_id(ArgT0&& arg0, ArgT... args) {
  
  _impl_.project_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggRequest.project_id)
 }
-inline std::string* GetCustomEventsAggRequest::mutable_project_id() {
+inline std::string* GetUniquesAggRequest::mutable_project_id() {
   std::string* _s = _internal_mutable_project_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetUniquesAggRequest.project_id)
   return _s;
 }
-inline const std::string& GetCustomEventsAggRequest::_internal_project_id() const {
+inline const std::string& GetUniquesAggRequest::_internal_project_id() const {
   return _impl_.project_id_.Get();
 }
-inline void GetCustomEventsAggRequest::_internal_set_project_id(const std::string& value) {
+inline void GetUniquesAggRequest::_internal_set_project_id(const std::string& value) {
   
   _impl_.project_id_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetCustomEventsAggRequest::_internal_mutable_project_id() {
+inline std::string* GetUniquesAggRequest::_internal_mutable_project_id() {
   
   return _impl_.project_id_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetCustomEventsAggRequest::release_project_id() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
+inline std::string* GetUniquesAggRequest::release_project_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetUniquesAggRequest.project_id)
   return _impl_.project_id_.Release();
 }
-inline void GetCustomEventsAggRequest::set_allocated_project_id(std::string* project_id) {
+inline void GetUniquesAggRequest::set_allocated_project_id(std::string* project_id) {
   if (project_id != nullptr) {
     
   } else {
@@ -7906,32 +9546,32 @@ inline void GetCustomEventsAggRequest::set_allocated_project_id(std::string* pro
     _impl_.project_id_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.project_id)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetUniquesAggRequest.project_id)
 }
 
 // .metricsys.aggregation.TimeRange time_range = 2;
-inline bool GetCustomEventsAggRequest::_internal_has_time_range() const {
+inline bool GetUniquesAggRequest::_internal_has_time_range() const {
   return this != internal_default_instance() && _impl_.time_range_ != nullptr;
 }
-inline bool GetCustomEventsAggRequest::has_time_range() const {
+inline bool GetUniquesAggRequest::has_time_range() const {
   return _internal_has_time_range();
 }
-inline void GetCustomEventsAggRequest::clear_time_range() {
+inline void GetUniquesAggRequest::clear_time_range() {
   if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
     delete _impl_.time_range_;
   }
   _impl_.time_range_ = nullptr;
 }
-inline const ::metricsys::aggregation::TimeRange& GetCustomEventsAggRequest::_internal_time_range() const {
+inline const ::metricsys::aggregation::TimeRange& GetUniquesAggRequest::_internal_time_range() const {
   const ::metricsys::aggregation::TimeRange* p = _impl_.time_range_;
   return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::TimeRange&>(
       ::metricsys::aggregation::_TimeRange_default_instance_);
 }
-inline const ::metricsys::aggregation::TimeRange& GetCustomEventsAggRequest::time_range() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
+inline const ::metricsys::aggregation::TimeRange& GetUniquesAggRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggRequest.time_range)
   return _internal_time_range();
 }
-inline void GetCustomEventsAggRequest::unsafe_arena_set_allocated_time_range(
+inline void GetUniquesAggRequest::unsafe_arena_set_allocated_time_range(
     ::metricsys::aggregation::TimeRange* time_range) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
@@ -7942,9 +9582,9 @@ inline void GetCustomEventsAggRequest::unsafe_arena_set_allocated_time_range(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetUniquesAggRequest.time_range)
 }
-inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::release_time_range() {
+inline ::metricsys::aggregation::TimeRange* GetUniquesAggRequest::release_time_range() {
   
   ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
   _impl_.time_range_ = nullptr;
@@ -7959,14 +9599,14 @@ inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::release_t
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::unsafe_arena_release_time_range() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
+inline ::metricsys::aggregation::TimeRange* GetUniquesAggRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetUniquesAggRequest.time_range)
   
   ::metricsys::aggregation::TimeRange* temp = _impl_.time_range_;
   _impl_.time_range_ = nullptr;
   return temp;
 }
-inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::_internal_mutable_time_range() {
+inline ::metricsys::aggregation::TimeRange* GetUniquesAggRequest::_internal_mutable_time_range() {
   
   if (_impl_.time_range_ == nullptr) {
     auto* p = CreateMaybeMessage<::metricsys::aggregation::TimeRange>(GetArenaForAllocation());
@@ -7974,12 +9614,12 @@ inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::_internal
   }
   return _impl_.time_range_;
 }
-inline ::metricsys::aggregation::TimeRange* GetCustomEventsAggRequest::mutable_time_range() {
+inline ::metricsys::aggregation::TimeRange* GetUniquesAggRequest::mutable_time_range() {
   ::metricsys::aggregation::TimeRange* _msg = _internal_mutable_time_range();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetUniquesAggRequest.time_range)
   return _msg;
 }
-inline void GetCustomEventsAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
+inline void GetUniquesAggRequest::set_allocated_time_range(::metricsys::aggregation::TimeRange* time_range) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.time_range_;
@@ -7996,100 +9636,70 @@ inline void GetCustomEventsAggRequest::set_allocated_time_range(::metricsys::agg
     
   }
   _impl_.time_range_ = time_range;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.time_range)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetUniquesAggRequest.time_range)
 }
 
-// string event_name = 3;
-inline void GetCustomEventsAggRequest::clear_event_name() {
-  _impl_.event_name_.ClearToEmpty();
-}
-inline const std::string& GetCustomEventsAggRequest::event_name() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
-  return _internal_event_name();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetCustomEventsAggRequest::set_event_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.event_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
-}
-inline std::string* GetCustomEventsAggRequest::mutable_event_name() {
-  std::string* _s = _internal_mutable_event_name();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
-  return _s;
+// .metricsys.aggregation.UniquesSource source = 3;
+inline void GetUniquesAggRequest::clear_source() {
+  _impl_.source_ = 0;
 }
-inline const std::string& GetCustomEventsAggRequest::_internal_event_name() const {
-  return _impl_.event_name_.Get();
+inline ::metricsys::aggregation::UniquesSource GetUniquesAggRequest::_internal_source() const {
+  return static_cast< ::metricsys::aggregation::UniquesSource >(_impl_.source_);
 }
-inline void GetCustomEventsAggRequest::_internal_set_event_name(const std::string& value) {
-  
-  _impl_.event_name_.Set(value, GetArenaForAllocation());
+inline ::metricsys::aggregation::UniquesSource GetUniquesAggRequest::source() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggRequest.source)
+  return _internal_source();
 }
-inline std::string* GetCustomEventsAggRequest::_internal_mutable_event_name() {
+inline void GetUniquesAggRequest::_internal_set_source(::metricsys::aggregation::UniquesSource value) {
   
-  return _impl_.event_name_.Mutable(GetArenaForAllocation());
-}
-inline std::string* GetCustomEventsAggRequest::release_event_name() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
-  return _impl_.event_name_.Release();
+  _impl_.source_ = value;
 }
-inline void GetCustomEventsAggRequest::set_allocated_event_name(std::string* event_name) {
-  if (event_name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.event_name_.SetAllocated(event_name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.event_name_.IsDefault()) {
-    _impl_.event_name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.event_name)
+inline void GetUniquesAggRequest::set_source(::metricsys::aggregation::UniquesSource value) {
+  _internal_set_source(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggRequest.source)
 }
 
 // optional string page = 4;
-inline bool GetCustomEventsAggRequest::_internal_has_page() const {
+inline bool GetUniquesAggRequest::_internal_has_page() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool GetCustomEventsAggRequest::has_page() const {
+inline bool GetUniquesAggRequest::has_page() const {
   return _internal_has_page();
 }
-inline void GetCustomEventsAggRequest::clear_page() {
+inline void GetUniquesAggRequest::clear_page() {
   _impl_.page_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& GetCustomEventsAggRequest::page() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.page)
+inline const std::string& GetUniquesAggRequest::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggRequest.page)
   return _internal_page();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void GetCustomEventsAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
+void GetUniquesAggRequest::set_page(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetCustomEventsAggRequest.page)
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggRequest.page)
 }
-inline std::string* GetCustomEventsAggRequest::mutable_page() {
+inline std::string* GetUniquesAggRequest::mutable_page() {
   std::string* _s = _internal_mutable_page();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.page)
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetUniquesAggRequest.page)
   return _s;
 }
-inline const std::string& GetCustomEventsAggRequest::_internal_page() const {
+inline const std::string& GetUniquesAggRequest::_internal_page() const {
   return _impl_.page_.Get();
 }
-inline void GetCustomEventsAggRequest::_internal_set_page(const std::string& value) {
+inline void GetUniquesAggRequest::_internal_set_page(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.page_.Set(value, GetArenaForAllocation());
 }
-inline std::string* GetCustomEventsAggRequest::_internal_mutable_page() {
+inline std::string* GetUniquesAggRequest::_internal_mutable_page() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.page_.Mutable(GetArenaForAllocation());
 }
-inline std::string* GetCustomEventsAggRequest::release_page() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.page)
+inline std::string* GetUniquesAggRequest::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetUniquesAggRequest.page)
   if (!_internal_has_page()) {
     return nullptr;
   }
@@ -8102,7 +9712,7 @@ inline std::string* GetCustomEventsAggRequest::release_page() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void GetCustomEventsAggRequest::set_allocated_page(std::string* page) {
+inline void GetUniquesAggRequest::set_allocated_page(std::string* page) {
   if (page != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -8114,141 +9724,275 @@ inline void GetCustomEventsAggRequest::set_allocated_page(std::string* page) {
     _impl_.page_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.page)
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetUniquesAggRequest.page)
 }
 
-// .metricsys.aggregation.Pagination pagination = 5;
-inline bool GetCustomEventsAggRequest::_internal_has_pagination() const {
-  return this != internal_default_instance() && _impl_.pagination_ != nullptr;
+// optional string element_id = 5;
+inline bool GetUniquesAggRequest::_internal_has_element_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline bool GetCustomEventsAggRequest::has_pagination() const {
-  return _internal_has_pagination();
+inline bool GetUniquesAggRequest::has_element_id() const {
+  return _internal_has_element_id();
 }
-inline void GetCustomEventsAggRequest::clear_pagination() {
-  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
-    delete _impl_.pagination_;
-  }
-  _impl_.pagination_ = nullptr;
+inline void GetUniquesAggRequest::clear_element_id() {
+  _impl_.element_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::metricsys::aggregation::Pagination& GetCustomEventsAggRequest::_internal_pagination() const {
-  const ::metricsys::aggregation::Pagination* p = _impl_.pagination_;
-  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::aggregation::Pagination&>(
-      ::metricsys::aggregation::_Pagination_default_instance_);
+inline const std::string& GetUniquesAggRequest::element_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggRequest.element_id)
+  return _internal_element_id();
 }
-inline const ::metricsys::aggregation::Pagination& GetCustomEventsAggRequest::pagination() const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
-  return _internal_pagination();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetUniquesAggRequest::set_element_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.element_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggRequest.element_id)
 }
-inline void GetCustomEventsAggRequest::unsafe_arena_set_allocated_pagination(
-    ::metricsys::aggregation::Pagination* pagination) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+inline std::string* GetUniquesAggRequest::mutable_element_id() {
+  std::string* _s = _internal_mutable_element_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetUniquesAggRequest.element_id)
+  return _s;
+}
+inline const std::string& GetUniquesAggRequest::_internal_element_id() const {
+  return _impl_.element_id_.Get();
+}
+inline void GetUniquesAggRequest::_internal_set_element_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.element_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetUniquesAggRequest::_internal_mutable_element_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.element_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetUniquesAggRequest::release_element_id() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetUniquesAggRequest.element_id)
+  if (!_internal_has_element_id()) {
+    return nullptr;
   }
-  _impl_.pagination_ = pagination;
-  if (pagination) {
-    
-  } else {
-    
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.element_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.element_id_.IsDefault()) {
+    _impl_.element_id_.Set("", GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::metricsys::aggregation::Pagination* GetCustomEventsAggRequest::release_pagination() {
-  
-  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
-  _impl_.pagination_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+inline void GetUniquesAggRequest::set_allocated_element_id(std::string* element_id) {
+  if (element_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+  _impl_.element_id_.SetAllocated(element_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.element_id_.IsDefault()) {
+    _impl_.element_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetUniquesAggRequest.element_id)
 }
-inline ::metricsys::aggregation::Pagination* GetCustomEventsAggRequest::unsafe_arena_release_pagination() {
-  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
-  
-  ::metricsys::aggregation::Pagination* temp = _impl_.pagination_;
-  _impl_.pagination_ = nullptr;
-  return temp;
+
+// optional string error_type = 6;
+inline bool GetUniquesAggRequest::_internal_has_error_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline ::metricsys::aggregation::Pagination* GetCustomEventsAggRequest::_internal_mutable_pagination() {
-  
-  if (_impl_.pagination_ == nullptr) {
-    auto* p = CreateMaybeMessage<::metricsys::aggregation::Pagination>(GetArenaForAllocation());
-    _impl_.pagination_ = p;
+inline bool GetUniquesAggRequest::has_error_type() const {
+  return _internal_has_error_type();
+}
+inline void GetUniquesAggRequest::clear_error_type() {
+  _impl_.error_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& GetUniquesAggRequest::error_type() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggRequest.error_type)
+  return _internal_error_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetUniquesAggRequest::set_error_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.error_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggRequest.error_type)
+}
+inline std::string* GetUniquesAggRequest::mutable_error_type() {
+  std::string* _s = _internal_mutable_error_type();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetUniquesAggRequest.error_type)
+  return _s;
+}
+inline const std::string& GetUniquesAggRequest::_internal_error_type() const {
+  return _impl_.error_type_.Get();
+}
+inline void GetUniquesAggRequest::_internal_set_error_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.error_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetUniquesAggRequest::_internal_mutable_error_type() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.error_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetUniquesAggRequest::release_error_type() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetUniquesAggRequest.error_type)
+  if (!_internal_has_error_type()) {
+    return nullptr;
   }
-  return _impl_.pagination_;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.error_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_type_.IsDefault()) {
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline ::metricsys::aggregation::Pagination* GetCustomEventsAggRequest::mutable_pagination() {
-  ::metricsys::aggregation::Pagination* _msg = _internal_mutable_pagination();
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
-  return _msg;
+inline void GetUniquesAggRequest::set_allocated_error_type(std::string* error_type) {
+  if (error_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.error_type_.SetAllocated(error_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_type_.IsDefault()) {
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetUniquesAggRequest.error_type)
 }
-inline void GetCustomEventsAggRequest::set_allocated_pagination(::metricsys::aggregation::Pagination* pagination) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.pagination_;
+
+// optional string event_name = 7;
+inline bool GetUniquesAggRequest::_internal_has_event_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool GetUniquesAggRequest::has_event_name() const {
+  return _internal_has_event_name();
+}
+inline void GetUniquesAggRequest::clear_event_name() {
+  _impl_.event_name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& GetUniquesAggRequest::event_name() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggRequest.event_name)
+  return _internal_event_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetUniquesAggRequest::set_event_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.event_name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggRequest.event_name)
+}
+inline std::string* GetUniquesAggRequest::mutable_event_name() {
+  std::string* _s = _internal_mutable_event_name();
+  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetUniquesAggRequest.event_name)
+  return _s;
+}
+inline const std::string& GetUniquesAggRequest::_internal_event_name() const {
+  return _impl_.event_name_.Get();
+}
+inline void GetUniquesAggRequest::_internal_set_event_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.event_name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetUniquesAggRequest::_internal_mutable_event_name() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.event_name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetUniquesAggRequest::release_event_name() {
+  // @@protoc_insertion_point(field_release:metricsys.aggregation.GetUniquesAggRequest.event_name)
+  if (!_internal_has_event_name()) {
+    return nullptr;
   }
-  if (pagination) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
-    if (message_arena != submessage_arena) {
-      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pagination, submessage_arena);
-    }
-    
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.event_name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_name_.IsDefault()) {
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetUniquesAggRequest::set_allocated_event_name(std::string* event_name) {
+  if (event_name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
   } else {
-    
+    _impl_._has_bits_[0] &= ~0x00000008u;
   }
-  _impl_.pagination_ = pagination;
-  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetCustomEventsAggRequest.pagination)
+  _impl_.event_name_.SetAllocated(event_name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_name_.IsDefault()) {
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.aggregation.GetUniquesAggRequest.event_name)
 }
 
 // -------------------------------------------------------------------
 
-// GetCustomEventsAggResponse
+// GetUniquesAggResponse
 
-// repeated .metricsys.aggregation.AggCustomEventsRow rows = 1;
-inline int GetCustomEventsAggResponse::_internal_rows_size() const {
-  return _impl_.rows_.size();
+// int64 unique_users = 1;
+inline void GetUniquesAggResponse::clear_unique_users() {
+  _impl_.unique_users_ = int64_t{0};
 }
-inline int GetCustomEventsAggResponse::rows_size() const {
-  return _internal_rows_size();
+inline int64_t GetUniquesAggResponse::_internal_unique_users() const {
+  return _impl_.unique_users_;
 }
-inline void GetCustomEventsAggResponse::clear_rows() {
-  _impl_.rows_.Clear();
+inline int64_t GetUniquesAggResponse::unique_users() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggResponse.unique_users)
+  return _internal_unique_users();
 }
-inline ::metricsys::aggregation::AggCustomEventsRow* GetCustomEventsAggResponse::mutable_rows(int index) {
-  // @@protoc_insertion_point(field_mutable:metricsys.aggregation.GetCustomEventsAggResponse.rows)
-  return _impl_.rows_.Mutable(index);
+inline void GetUniquesAggResponse::_internal_set_unique_users(int64_t value) {
+  
+  _impl_.unique_users_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggCustomEventsRow >*
-GetCustomEventsAggResponse::mutable_rows() {
-  // @@protoc_insertion_point(field_mutable_list:metricsys.aggregation.GetCustomEventsAggResponse.rows)
-  return &_impl_.rows_;
+inline void GetUniquesAggResponse::set_unique_users(int64_t value) {
+  _internal_set_unique_users(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggResponse.unique_users)
 }
-inline const ::metricsys::aggregation::AggCustomEventsRow& GetCustomEventsAggResponse::_internal_rows(int index) const {
-  return _impl_.rows_.Get(index);
+
+// int64 unique_sessions = 2;
+inline void GetUniquesAggResponse::clear_unique_sessions() {
+  _impl_.unique_sessions_ = int64_t{0};
 }
-inline const ::metricsys::aggregation::AggCustomEventsRow& GetCustomEventsAggResponse::rows(int index) const {
-  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetCustomEventsAggResponse.rows)
-  return _internal_rows(index);
+inline int64_t GetUniquesAggResponse::_internal_unique_sessions() const {
+  return _impl_.unique_sessions_;
 }
-inline ::metricsys::aggregation::AggCustomEventsRow* GetCustomEventsAggResponse::_internal_add_rows() {
-  return _impl_.rows_.Add();
+inline int64_t GetUniquesAggResponse::unique_sessions() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggResponse.unique_sessions)
+  return _internal_unique_sessions();
 }
-inline ::metricsys::aggregation::AggCustomEventsRow* GetCustomEventsAggResponse::add_rows() {
-  ::metricsys::aggregation::AggCustomEventsRow* _add = _internal_add_rows();
-  // @@protoc_insertion_point(field_add:metricsys.aggregation.GetCustomEventsAggResponse.rows)
-  return _add;
+inline void GetUniquesAggResponse::_internal_set_unique_sessions(int64_t value) {
+  
+  _impl_.unique_sessions_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::aggregation::AggCustomEventsRow >&
-GetCustomEventsAggResponse::rows() const {
-  // @@protoc_insertion_point(field_list:metricsys.aggregation.GetCustomEventsAggResponse.rows)
-  return _impl_.rows_;
+inline void GetUniquesAggResponse::set_unique_sessions(int64_t value) {
+  _internal_set_unique_sessions(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggResponse.unique_sessions)
+}
+
+// int64 buckets_count = 3;
+inline void GetUniquesAggResponse::clear_buckets_count() {
+  _impl_.buckets_count_ = int64_t{0};
+}
+inline int64_t GetUniquesAggResponse::_internal_buckets_count() const {
+  return _impl_.buckets_count_;
+}
+inline int64_t GetUniquesAggResponse::buckets_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.aggregation.GetUniquesAggResponse.buckets_count)
+  return _internal_buckets_count();
+}
+inline void GetUniquesAggResponse::_internal_set_buckets_count(int64_t value) {
+  
+  _impl_.buckets_count_ = value;
+}
+inline void GetUniquesAggResponse::set_buckets_count(int64_t value) {
+  _internal_set_buckets_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.aggregation.GetUniquesAggResponse.buckets_count)
 }
 
 #ifdef __GNUC__
@@ -8290,12 +10034,28 @@ GetCustomEventsAggResponse::rows() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace aggregation
 }  // namespace metricsys
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::metricsys::aggregation::UniquesSource> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::metricsys::aggregation::UniquesSource>() {
+  return ::metricsys::aggregation::UniquesSource_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -3,17 +3,24 @@
 
 #include <grpcpp/grpcpp.h>
 #include "aggregation.grpc.pb.h"
+#include "rollup.h"
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace aggregation {
 
 class Database;
+class DatabasePool;
+class HotWindowCache;
 
-// gRPC сервер для предоставления агрегированных данных
+// gRPC сервер для предоставления агрегированных данных. Каждый вызов берёт
+// своё соединение из пула читателей, поэтому вызовы идут параллельно.
+// Page views и performance с шагом базового уровня сначала ищутся в hotWindow
 class AggregationServiceImpl final : public metricsys::aggregation::AggregationService::Service {
 public:
-    explicit AggregationServiceImpl(Database& db);
+    explicit AggregationServiceImpl(DatabasePool& readers, HotWindowCache* hotWindow = nullptr);
     ~AggregationServiceImpl() override;
 
     // Получить watermark
@@ -58,14 +65,39 @@ public:
         metricsys::aggregation::GetCustomEventsAggResponse* response
     ) override;
 
+    // Уникальные пользователи/сессии за диапазон: объединение HLL-скетчей бакетов
+    grpc::Status GetUniquesAgg(
+        grpc::ServerContext* context,
+        const metricsys::aggregation::GetUniquesAggRequest* request,
+        metricsys::aggregation::GetUniquesAggResponse* response
+    ) override;
+
 private:
-    Database& database_;
+    // План чтения: самый крупный уровень, не превышающий шаг (0 — autoStep),
+    // и более мелкие уровни для краёв и ещё не свёрнутого хвоста
+    std::vector<TimeSegment> planSegments(
+        Database& database,
+        std::chrono::system_clock::time_point from,
+        std::chrono::system_clock::time_point to,
+        uint32_t stepSeconds
+    );
+
+    // Кеш хранит только базовый уровень, поэтому подходит лишь для шага меньше следующего
+    bool hotWindowServes(
+        std::chrono::system_clock::time_point from,
+        std::chrono::system_clock::time_point to,
+        uint32_t stepSeconds
+    ) const;
+
+    DatabasePool& readers_;
+    HotWindowCache* hotWindow_;
 };
 
 // Запуск gRPC сервера в отдельном потоке
 class AggregationGrpcServer {
 public:
-    AggregationGrpcServer(Database& db, const std::string& server_address);
+    AggregationGrpcServer(DatabasePool& readers, const std::string& server_address,
+                          HotWindowCache* hotWindow = nullptr);
     ~AggregationGrpcServer();
 
     void start();
@@ -1,53 +1,38 @@
 #ifndef AGGREGATOR_H
 #define AGGREGATOR_H
 
+#include <atomic>
 #include <vector>
 #include <string>
 #include <chrono>
 #include <cstdint>
-#include <map>
+#include <optional>
+#include <unordered_map>
+
+#include "ddsketch.h"
+#include "event_batch.h"
+#include "hyperloglog.h"
+#include "rollup.h"
+#include "symbol_table.h"
 
 namespace aggregation {
 
 class Database;
+class DatabasePool;
+class HotWindowCache;
 class MetricsClient;
 
-struct RawEvent {
-    std::string projectId;
-    std::string page;
-    std::string eventType;  // "page_view", "click", "performance", "error", "custom"
-
-    // Performance metrics
-    double totalPageLoadMs = 0.0;
-    double ttfbMs = 0.0;
-    double fcpMs = 0.0;
-    double lcpMs = 0.0;
-
-    bool isError = false;
-    std::string userId;
-    std::string sessionId;
-    std::chrono::system_clock::time_point timestamp;
-
-    // Click fields
-    std::string elementId;
-
-    // Error fields
-    std::string errorType;
-    std::string errorMessage;
-    int severity = 0;  // 0=UNSPECIFIED, 1=WARNING, 2=ERROR, 3=CRITICAL
-
-    // Custom event fields
-    std::string customEventName;
-    std::map<std::string, std::string> properties;
-};
-
 struct AggregatedPageViews {
     std::string projectId;
     std::string page;
     std::chrono::system_clock::time_point timeBucket;
+    int64_t stepSeconds = 60;  // разрешение строки, один из ROLLUP_LEVELS
     int64_t viewsCount = 0;
     int64_t uniqueUsers = 0;
     int64_t uniqueSessions = 0;
+    // Сериализованные HyperLogLog-скетчи; пустые, если строка прочитана без них
+    std::string usersHll;
+    std::string sessionsHll;
 };
 
 struct AggregatedClicks {
@@ -55,15 +40,19 @@ struct AggregatedClicks {
     std::string page;
     std::string elementId;
     std::chrono::system_clock::time_point timeBucket;
+    int64_t stepSeconds = 60;  // разрешение строки, один из ROLLUP_LEVELS
     int64_t clicksCount = 0;
     int64_t uniqueUsers = 0;
     int64_t uniqueSessions = 0;
+    std::string usersHll;
+    std::string sessionsHll;
 };
 
 struct AggregatedPerformance {
     std::string projectId;
     std::string page;
     std::chrono::system_clock::time_point timeBucket;
+    int64_t stepSeconds = 60;  // разрешение строки, один из ROLLUP_LEVELS
     int64_t samplesCount = 0;
     double avgTotalLoadMs = 0.0;
     double p95TotalLoadMs = 0.0;
@@ -73,6 +62,12 @@ struct AggregatedPerformance {
     double p95FcpMs = 0.0;
     double avgLcpMs = 0.0;
     double p95LcpMs = 0.0;
+    // Сериализованные DDSketch по каждой метрике: из них считаются
+    // произвольные квантили и слияние бакетов
+    std::string totalLoadSketch;
+    std::string ttfbSketch;
+    std::string fcpSketch;
+    std::string lcpSketch;
 };
 
 struct AggregatedErrors {
@@ -80,10 +75,12 @@ struct AggregatedErrors {
     std::string page;
     std::string errorType;
     std::chrono::system_clock::time_point timeBucket;
+    int64_t stepSeconds = 60;  // разрешение строки, один из ROLLUP_LEVELS
     int64_t errorsCount = 0;
     int64_t warningCount = 0;
     int64_t criticalCount = 0;
     int64_t uniqueUsers = 0;
+    std::string usersHll;
 };
 
 struct AggregatedCustomEvents {
@@ -91,9 +88,12 @@ struct AggregatedCustomEvents {
     std::string eventName;
     std::string page;
     std::chrono::system_clock::time_point timeBucket;
+    int64_t stepSeconds = 60;  // разрешение строки, один из ROLLUP_LEVELS
     int64_t eventsCount = 0;
     int64_t uniqueUsers = 0;
     int64_t uniqueSessions = 0;
+    std::string usersHll;
+    std::string sessionsHll;
 };
 
 // Контейнер для всех типов агрегатов
@@ -105,25 +105,245 @@ struct AggregationResult {
     std::vector<AggregatedCustomEvents> customEvents;
 };
 
+// Ключ для группировки событий
+struct AggregationKey {
+    SymbolId projectId = EMPTY_SYMBOL;
+    SymbolId page = EMPTY_SYMBOL;
+    std::chrono::system_clock::time_point timeBucket;
+    SymbolId extra = EMPTY_SYMBOL;  // element_id, error_type, event_name в зависимости от типа
+
+    bool operator==(const AggregationKey& other) const {
+        return projectId == other.projectId &&
+               page == other.page &&
+               timeBucket == other.timeBucket &&
+               extra == other.extra;
+    }
+};
+
+struct AggregationKeyHash {
+    std::size_t operator()(const AggregationKey& k) const {
+        // Перемешивание из splitmix64: номера плотные, без него соседние ключи
+        // попадали бы в соседние корзины
+        uint64_t h = (static_cast<uint64_t>(k.projectId) << 32 | k.page) * 0x9e3779b97f4a7c15ULL;
+        h ^= static_cast<uint64_t>(k.timeBucket.time_since_epoch().count()) +
+             (static_cast<uint64_t>(k.extra) << 32);
+        h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+        return static_cast<std::size_t>(h ^ (h >> 31));
+    }
+};
+
+// Инкрементальная агрегация: каждое событие сразу сворачивается в состояние
+// своей группы (счётчики, суммы, HLL- и DDSketch-скетчи), сами события не сохраняются,
+// так что память растёт с числом групп, а не событий.
+// Бакеты, которые целиком лежат до watermark, забираются finalizeBefore().
+// Группы ключуются номерами из symbols, строки достаются из него при сборке агрегатов.
+class EventAccumulator {
+public:
+    EventAccumulator(std::chrono::minutes bucketSize, const SymbolTable& symbols);
+
+    // Ядра по типам событий: ключи групп и бакеты считаются одним проходом
+    // по колонкам пачки
+    void add(const PageViewBatch& batch);
+    void add(const ClickBatch& batch);
+    void add(const PerformanceBatch& batch);
+    void add(const ErrorBatch& batch);
+    void add(const CustomBatch& batch);
+    void add(const EventBatches& batches);
+
+    int64_t eventsCount() const { return eventsCount_; }
+    size_t groupsCount() const;
+    std::chrono::minutes bucketSize() const { return bucketSize_; }
+
+    // Агрегаты всех накопленных групп; состояние не меняется
+    AggregationResult finish() const;
+
+    // Забирает агрегаты бакетов, закончившихся не позже watermark,
+    // и удаляет их состояние. Остальные бакеты продолжают накапливаться.
+    AggregationResult finalizeBefore(std::chrono::system_clock::time_point watermark);
+
+    void clear();
+
+    // Отмечает номера, на которые ссылаются ключи групп
+    void markSymbols(std::vector<bool>& live) const;
+    // Переводит ключи на номера после SymbolTable::compact()
+    void remapSymbols(const std::vector<SymbolId>& mapping);
+
+private:
+    struct CountState {
+        int64_t count = 0;
+        HyperLogLog users;
+        HyperLogLog sessions;
+    };
+
+    // Среднее считается по суммам, квантили — по скетчу
+    struct MetricState {
+        int64_t count = 0;
+        double sum = 0.0;
+        DDSketch sketch;
+
+        void add(double value);
+    };
+
+    struct PerformanceState {
+        int64_t count = 0;
+        MetricState totalLoad;
+        MetricState ttfb;
+        MetricState fcp;
+        MetricState lcp;
+    };
+
+    struct ErrorState {
+        int64_t count = 0;
+        int64_t warningCount = 0;
+        int64_t criticalCount = 0;
+        HyperLogLog users;
+    };
+
+    template <typename State>
+    using GroupMap = std::unordered_map<AggregationKey, State, AggregationKeyHash>;
+
+    // Общая сборка результата для finish() и finalizeBefore()
+    template <typename Filter>
+    AggregationResult collect(Filter&& include) const;
+
+    // Бакеты строк пачки в buckets_; строки засчитываются в eventsCount_
+    void bucketize(const EventColumns& batch);
+    template <typename State>
+    State& group(GroupMap<State>& groups, const EventColumns& batch, size_t row, SymbolId extra);
+
+    std::chrono::minutes bucketSize_;
+    const SymbolTable* symbols_;
+    int64_t eventsCount_ = 0;
+    // Рабочие колонки ядер, переиспользуются между пачками
+    std::vector<std::chrono::system_clock::time_point> buckets_;
+    std::vector<PerformanceState*> performanceRows_;
+
+    GroupMap<CountState> pageViews_;
+    GroupMap<CountState> clicks_;
+    GroupMap<PerformanceState> performance_;
+    GroupMap<ErrorState> errors_;
+    GroupMap<CountState> customEvents_;
+};
+
+// Поправки от опоздавших событий к уже записанным бакетам. Событие сворачивается
+// сразу во все уровни ROLLUP_LEVELS; дельта базового бакета сливается с записанной
+// строкой тем же upsert, что и окно, так что пересчитываются только затронутые бакеты
+class LateCorrections {
+public:
+    explicit LateCorrections(const SymbolTable& symbols);
+
+    void add(const EventBatches& events);
+    bool empty() const { return levels_.front().eventsCount() == 0; }
+    int64_t eventsCount() const { return levels_.front().eventsCount(); }
+
+    // Дельты всех базовых бакетов и тех бакетов старших уровней, которые уже свёрнуты
+    // (до rolledUp): остальные свёртка соберёт из исправленных строк сама.
+    // Состояние очищается
+    AggregationResult take(const RollupWatermarks& rolledUp);
+
+private:
+    std::vector<EventAccumulator> levels_;  // по одному на ROLLUP_LEVELS
+};
+
 class Aggregator {
 public:
-    explicit Aggregator(Database& db, MetricsClient& metricsClient);
+    static constexpr std::chrono::seconds DEFAULT_FETCH_LAG{5};
+    static constexpr std::chrono::seconds DEFAULT_ALLOWED_LATENESS{3600};
+    static constexpr size_t DEFAULT_MAX_SYMBOLS = size_t{1} << 20;
+
+    // writer — отдельный пул (обычно из одного соединения) только для агрегатора,
+    // чтобы запись не делила соединения с gRPC-чтением.
+    // fetchLag — насколько закрытие бакетов отстаёт от текущего времени: события,
+    // принятые за это время, попадают в свой бакет, а не в поправки. Полноту окна
+    // чтения он не обеспечивает — её даёт горизонт записи metrics-service.
+    // allowedLateness — насколько событие может опоздать к своему бакету: такие
+    // бакеты досчитываются, более поздние события только сохраняются в late_events.
+    // maxSymbols — сколько строк словаря можно накопить, прежде чем в начале цикла
+    // выбросить те, на которые уже ничто не ссылается
+    explicit Aggregator(DatabasePool& writer, MetricsClient& metricsClient,
+                        std::chrono::seconds fetchLag = DEFAULT_FETCH_LAG,
+                        std::chrono::seconds allowedLateness = DEFAULT_ALLOWED_LATENESS,
+                        size_t maxSymbols = DEFAULT_MAX_SYMBOLS);
     ~Aggregator();
 
+    // Каждое закоммиченное окно дополнительно попадает в кеш (nullptr — без кеша)
+    void setHotWindow(HotWindowCache* hotWindow) { hotWindow_ = hotWindow; }
+
+    // Один цикл: дочитывает события с прошлого цикла в движок, записывает
+    // бакеты, которые закончились до нового watermark, и сдвигает watermark
     void run();
 
     AggregationResult aggregateEvents(
-        const std::vector<RawEvent>& events,
+        const EventBatches& events,
         std::chrono::minutes bucketSize
     );
 
-    static double calculateAverage(const std::vector<double>& values);
-    static double calculateMin(const std::vector<double>& values);
-    static double calculateMax(const std::vector<double>& values);
-    static double calculateP95(std::vector<double> values);
+    // Куда событие попадает при коммите окна, бакеты до closedBefore которого уже записаны
+    enum class Lateness {
+        OnTime,   // в движок, бакет ещё открыт
+        Late,     // поправка к записанному бакету
+        TooLate   // опоздание больше allowedLateness — только в late_events
+    };
+    static Lateness classify(std::chrono::system_clock::time_point timestamp,
+                             std::chrono::system_clock::time_point closedBefore,
+                             std::chrono::seconds allowedLateness);
+
+    // Метрики в текстовом формате Prometheus (GET /metrics)
+    std::string formatMetrics() const;
+
 private:
-    Database& database_;
+    // Окно [from, to) закрытых бакетов, ожидающее записи. Коммит окна включает
+    // ровно события, принятые до to: поправки и late_events тоже пишутся с ним
+    struct PendingCommit {
+        AggregationResult result;
+        std::chrono::system_clock::time_point from;
+        std::chrono::system_clock::time_point to;
+        AggregationResult corrections;
+        EventBatches tooLate;
+        int64_t lateCount = 0;
+    };
+
+    // Раскладывает события чанка по движку и буферам опоздавших.
+    // closedUntil — граница уже записанных бакетов, next — граница окна этого цикла
+    void route(const EventBatches& events,
+               std::chrono::system_clock::time_point closedUntil,
+               std::chrono::system_clock::time_point next);
+    // Окно [watermark_, to) с опоздавшими событиями, принятыми до to
+    PendingCommit makeCommit(Database& database, std::chrono::system_clock::time_point to);
+    // Базовые бакеты, изменённые поправками, перечитываются в горячее окно из БД
+    void refreshHotWindow(Database& database, const AggregationResult& corrections);
+    // Сбрасывает незавершённые бакеты: следующий цикл перечитает их с watermark
+    void resetEngine();
+    // Записывает pending_ вместе со сдвигом watermark; при неудаче окно остаётся
+    // в pending_ и повторяется в следующем цикле
+    bool commitPending(Database& database);
+    // Досворачивает уровни ROLLUP_LEVELS до нового watermark
+    void rollupClosedBuckets(Database& database);
+    // Сжимает symbols_ до строк, на которые ссылаются движок и отложенные события
+    void compactSymbols();
+
+    DatabasePool& writer_;
     MetricsClient& metricsClient_;
+    std::chrono::seconds fetchLag_;
+    std::chrono::seconds allowedLateness_;
+    HotWindowCache* hotWindow_ = nullptr;
+    size_t maxSymbols_;
+
+    // Живёт дольше движка: номера в ключах открытых бакетов и отложенных событиях
+    // остаются действительными между циклами
+    SymbolTable symbols_;
+    EventAccumulator engine_;
+    // Опоздавшие события, ещё не попавшие в коммит
+    EventBatches late_;
+    EventBatches tooLate_;
+    // До какого момента события уже свёрнуты в engine_ (не сохраняется в БД)
+    std::optional<std::chrono::system_clock::time_point> fetchedUntil_;
+    std::chrono::system_clock::time_point watermark_;
+    std::optional<PendingCommit> pending_;
+
+    std::atomic<uint64_t> lateEvents_{0};
+    std::atomic<uint64_t> tooLateEvents_{0};
 };
 
 } // namespace aggregation
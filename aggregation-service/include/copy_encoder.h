@@ -0,0 +1,49 @@
+#ifndef COPY_ENCODER_H
+#define COPY_ENCODER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace aggregation {
+
+// Построчный кодировщик потока COPY ... FROM STDIN (FORMAT binary).
+// Формат: заголовок PGCOPY, затем кортежи — int16 число полей и для каждого
+// поля int32 длина (-1 для NULL) и значение в сетевом порядке байт; в конце int16 -1.
+// Типы полей должны в точности совпадать с колонками таблицы: сервер их не приводит.
+class BinaryCopyEncoder {
+public:
+    BinaryCopyEncoder();
+
+    void beginRow(int16_t fieldCount);
+
+    void addInt4(int32_t value);
+    void addInt8(int64_t value);
+    void addFloat8(double value);
+    void addText(std::string_view value);
+    // Пустой скетч пишется как NULL
+    void addBytea(std::string_view value);
+    void addTimestamp(std::chrono::system_clock::time_point value);
+    void addNull();
+
+    // Дописывает маркер конца; после него в буфер ничего добавлять нельзя
+    void finish();
+
+    // Накопленная часть потока; clear() после отправки очередного куска
+    const std::string& data() const { return buffer_; }
+    size_t size() const { return buffer_.size(); }
+    void clear() { buffer_.clear(); }
+
+private:
+    void putInt16(int16_t value);
+    void putInt32(int32_t value);
+    void putInt64(int64_t value);
+
+    std::string buffer_;
+};
+
+} // namespace aggregation
+
+#endif // COPY_ENCODER_H
@@ -1,11 +1,17 @@
 #ifndef DATABASE_H
 #define DATABASE_H
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <chrono>
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
 #include <libpq-fe.h>
 
+#include "rollup.h"
+
 namespace aggregation {
 
 // Forward declarations
@@ -15,38 +21,106 @@ struct AggregatedPerformance;
 struct AggregatedErrors;
 struct AggregatedCustomEvents;
 struct AggregationResult;
+struct EventBatches;
+class SymbolTable;
+class BinaryCopyEncoder;
+
+// Таблица, по которой объединяются HLL-скетчи в readUniques()
+enum class UniquesSource {
+    PageViews,
+    Clicks,
+    Errors,
+    CustomEvents
+};
 
+// Итог Database::commitAggregation()
+enum class CommitStatus {
+    Committed,         // окно записано этим вызовом
+    AlreadyCommitted,  // окно было записано раньше (повтор после неясного сбоя)
+    Failed             // транзакция откатана, ничего не записано
+};
+
+struct UniqueCounts {
+    int64_t uniqueUsers = 0;
+    int64_t uniqueSessions = 0;  // в agg_errors скетча сессий нет, всегда 0
+    int64_t bucketsCount = 0;
+};
+
+// Одно соединение libpq: объект используется одним потоком за раз
+// (для gRPC — через DatabasePool)
 class Database {
 public:
+    // Счётчики выполненных запросов; читаются из других потоков (метрики)
+    struct QueryStats {
+        uint64_t queries = 0;
+        uint64_t failures = 0;
+        std::chrono::microseconds totalTime{0};
+    };
+
     Database();
     ~Database();
+    Database(const Database&) = delete;
+    Database& operator=(const Database&) = delete;
 
     bool connect(const std::string& connectionString);
     void disconnect();
     bool isConnected() const;
 
+    QueryStats queryStats() const;
+
     bool initializeSchema();
     bool executeQuery(const std::string& query);
+    // Число затронутых строк или -1 при ошибке
+    int executeUpdate(const std::string& query);
 
     // Watermark методы
     std::chrono::system_clock::time_point getWatermark();
     bool updateWatermark(std::chrono::system_clock::time_point timestamp);
 
-    // Методы записи агрегатов
+    // Методы записи агрегатов: строки идут бинарным COPY во временную staging-таблицу
+    // и сливаются в agg_* одним INSERT ... SELECT ... ON CONFLICT. Вне транзакции
+    // каждый метод открывает свою, внутри writeAggregationResult() — общую
     bool writePageViews(const std::vector<AggregatedPageViews>& data);
     bool writeClicks(const std::vector<AggregatedClicks>& data);
     bool writePerformance(const std::vector<AggregatedPerformance>& data);
     bool writeErrors(const std::vector<AggregatedErrors>& data);
     bool writeCustomEvents(const std::vector<AggregatedCustomEvents>& data);
 
-    // Записать все агрегаты
+    // Записать все агрегаты одной транзакцией
     bool writeAggregationResult(const AggregationResult& result);
 
-    // Методы чтения агрегатов для gRPC сервера
+    // Записывает агрегаты окна [windowFrom, windowTo) и сдвигает watermark
+    // с windowFrom на windowTo одной транзакцией. Окно фиксируется в
+    // aggregation_commit_log, поэтому повтор того же коммита ничего не удваивает.
+    // В той же транзакции сливаются поправки опоздавших событий к уже записанным
+    // бакетам (corrections) и сохраняются события сверх допустимого опоздания
+    // (их строковые поля берутся из symbols)
+    CommitStatus commitAggregation(
+        const AggregationResult& result,
+        std::chrono::system_clock::time_point windowFrom,
+        std::chrono::system_clock::time_point windowTo,
+        const AggregationResult& corrections,
+        const EventBatches& lateEvents,
+        const SymbolTable& symbols
+    );
+
+    // Свёртка уровней разрешения (ROLLUP_LEVELS)
+    RollupWatermarks getRollupWatermarks();
+    // Сворачивает строки уровня source за [from, to) в уровень target во всех
+    // таблицах и сдвигает границу target — одной транзакцией
+    bool rollup(
+        std::chrono::seconds source,
+        std::chrono::seconds target,
+        std::chrono::system_clock::time_point from,
+        std::chrono::system_clock::time_point to
+    );
+
+    // Методы чтения агрегатов для gRPC сервера. segments — план из planResolution():
+    // каждый участок диапазона читается со своего уровня. Запросы — prepared
+    // statements (свой на каждый набор непустых фильтров) с бинарным результатом
     std::vector<AggregatedPageViews> readPageViews(
         const std::string& projectId,
-        std::chrono::system_clock::time_point from,
-        std::chrono::system_clock::time_point to,
+        const std::vector<TimeSegment>& segments,
         const std::string& pageFilter = "",
         int limit = 1000,
         int offset = 0
@@ -54,8 +128,7 @@ public:
 
     std::vector<AggregatedClicks> readClicks(
         const std::string& projectId,
-        std::chrono::system_clock::time_point from,
-        std::chrono::system_clock::time_point to,
+        const std::vector<TimeSegment>& segments,
         const std::string& pageFilter = "",
         const std::string& elementIdFilter = "",
         int limit = 1000,
@@ -64,8 +137,7 @@ public:
 
     std::vector<AggregatedPerformance> readPerformance(
         const std::string& projectId,
-        std::chrono::system_clock::time_point from,
-        std::chrono::system_clock::time_point to,
+        const std::vector<TimeSegment>& segments,
         const std::string& pageFilter = "",
         int limit = 1000,
         int offset = 0
@@ -73,8 +145,7 @@ public:
 
     std::vector<AggregatedErrors> readErrors(
         const std::string& projectId,
-        std::chrono::system_clock::time_point from,
-        std::chrono::system_clock::time_point to,
+        const std::vector<TimeSegment>& segments,
         const std::string& pageFilter = "",
         const std::string& errorTypeFilter = "",
         int limit = 1000,
@@ -83,20 +154,82 @@ public:
 
     std::vector<AggregatedCustomEvents> readCustomEvents(
         const std::string& projectId,
-        std::chrono::system_clock::time_point from,
-        std::chrono::system_clock::time_point to,
+        const std::vector<TimeSegment>& segments,
         const std::string& eventNameFilter = "",
         const std::string& pageFilter = "",
         int limit = 1000,
         int offset = 0
     );
 
+    // Уникальные пользователи/сессии за диапазон бакетов: скетчи строк
+    // объединяются здесь, исходные события не нужны.
+    // extraFilter — element_id, error_type или event_name в зависимости от source.
+    UniqueCounts readUniques(
+        UniquesSource source,
+        const std::string& projectId,
+        const std::vector<TimeSegment>& segments,
+        const std::string& pageFilter = "",
+        const std::string& extraFilter = ""
+    );
+
 private:
+    // PQexec с учётом в queryStats()
+    PGresult* exec(const std::string& sql);
+    // Именованный prepared statement с бинарным результатом. Готовится при первом
+    // вызове на соединении (sql() вызывается только тогда), параметры — текстом
+    PGresult* execPrepared(
+        const std::string& name,
+        const std::function<std::string()>& sql,
+        const std::vector<std::string>& params
+    );
+    void trackQuery(std::chrono::steady_clock::time_point start, const PGresult* res);
+
     std::string formatTimestamp(std::chrono::system_clock::time_point tp) const;
     std::chrono::system_clock::time_point parseTimestamp(const std::string& ts) const;
-    std::string escapeString(const std::string& str) const;
+
+    // BEGIN/COMMIT вокруг body, ROLLBACK при неудаче; если транзакция уже открыта,
+    // body выполняется в ней
+    bool inTransaction(const std::function<bool()>& body);
+
+    // staging-таблицы живут в сессии, поэтому создаются заново после connect()
+    bool ensureStagingTables();
+    // COPY rowCount строк в staging-таблицу кусками по COPY_CHUNK_BYTES
+    bool copyToStaging(
+        const std::string& table,
+        const std::string& columns,
+        size_t rowCount,
+        const std::function<void(BinaryCopyEncoder&, size_t)>& encodeRow
+    );
+    // COPY в staging + слияние в agg-таблицу; транзакцией управляет вызывающий
+    bool stagePageViews(const std::vector<AggregatedPageViews>& data);
+    bool stageClicks(const std::vector<AggregatedClicks>& data);
+    bool stagePerformance(const std::vector<AggregatedPerformance>& data);
+    bool stageErrors(const std::vector<AggregatedErrors>& data);
+    bool stageCustomEvents(const std::vector<AggregatedCustomEvents>& data);
+    bool stageLateEvents(const EventBatches& events, const SymbolTable& symbols);
+
+    // Сливает скетчи rows с уже записанными строками тех же ключей (под FOR UPDATE).
+    // merged остаётся пустым, если совпадений нет, иначе — копия rows с объединёнными скетчами
+    template <typename Row>
+    bool mergeStoredUniques(const std::vector<Row>& rows, std::vector<Row>& merged);
+    // Строки source из [from, to), сгруппированные по бакетам target: счётчики
+    // суммируются, скетчи объединяются
+    template <typename Row>
+    bool collectRollup(
+        std::chrono::seconds source,
+        std::chrono::seconds target,
+        std::chrono::system_clock::time_point from,
+        std::chrono::system_clock::time_point to,
+        std::vector<Row>& rows
+    );
 
     PGconn* dbConnection_;
+    bool stagingReady_ = false;
+    std::unordered_set<std::string> prepared_;  // имена statement-ов этого соединения
+
+    std::atomic<uint64_t> queries_{0};
+    std::atomic<uint64_t> failures_{0};
+    std::atomic<int64_t> queryMicros_{0};
 };
 
 } // namespace aggregation
@@ -0,0 +1,95 @@
+#ifndef DATABASE_POOL_H
+#define DATABASE_POOL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "database.h"
+
+namespace aggregation {
+
+// Пул соединений с PostgreSQL. Соединение libpq нельзя использовать из нескольких
+// потоков сразу, поэтому каждый Database выдаётся одному потоку через Lease
+// и возвращается в пул при разрушении Lease.
+class DatabasePool {
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_ACQUIRE_TIMEOUT{2000};
+
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+        // Пустой Lease — соединение не получено за таймаут
+        explicit operator bool() const { return db_ != nullptr; }
+        Database* operator->() const { return db_; }
+        Database& operator*() const { return *db_; }
+
+    private:
+        friend class DatabasePool;
+        Lease(DatabasePool* pool, Database* db) : pool_(pool), db_(db) {}
+        void release();
+
+        DatabasePool* pool_ = nullptr;
+        Database* db_ = nullptr;
+    };
+
+    struct Stats {
+        std::string name;
+        size_t size = 0;
+        size_t inUse = 0;
+        uint64_t acquired = 0;
+        uint64_t timeouts = 0;
+        uint64_t reconnects = 0;
+        std::chrono::microseconds waitTotal{0};
+        std::chrono::microseconds waitMax{0};
+        Database::QueryStats queries;  // сумма по соединениям пула
+    };
+
+    // name — метка pool в метриках
+    DatabasePool(std::string name, size_t size);
+    ~DatabasePool();
+
+    // Открывает все соединения; строка сохраняется для переподключения
+    bool connect(const std::string& connectionString);
+    void disconnect();
+
+    // Ждёт свободное соединение не дольше timeout. Разорванное соединение
+    // переподключается перед выдачей
+    Lease acquire(std::chrono::milliseconds timeout = DEFAULT_ACQUIRE_TIMEOUT);
+
+    Stats stats() const;
+    const std::string& name() const { return name_; }
+
+private:
+    void release(Database* db);
+
+    const std::string name_;
+    std::string connectionString_;
+    std::vector<std::unique_ptr<Database>> connections_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable available_;
+    std::vector<Database*> idle_;
+    uint64_t acquired_ = 0;
+    uint64_t timeouts_ = 0;
+    uint64_t reconnects_ = 0;
+    std::chrono::microseconds waitTotal_{0};
+    std::chrono::microseconds waitMax_{0};
+};
+
+// Метрики пулов в текстовом формате Prometheus (GET /metrics)
+std::string formatPoolMetrics(const std::vector<DatabasePool::Stats>& pools);
+
+} // namespace aggregation
+
+#endif // DATABASE_POOL_H
@@ -0,0 +1,58 @@
+#ifndef DDSKETCH_H
+#define DDSKETCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aggregation {
+
+// DDSketch: квантили с относительной ошибкой RELATIVE_ACCURACY (1%).
+// Значение x попадает в бин ceil(log_gamma(x)), gamma = (1 + a) / (1 - a);
+// добавление O(1), скетчи объединяются сложением бинов, поэтому p50..p99
+// за несколько бакетов считаются без исходных значений.
+// Учитываются только положительные значения (как и раньше для метрик).
+//
+// Сериализованный формат (колонки *_sketch, функции ddsketch_* в init.sql):
+// 1 байт версии, затем непустые бины по возрастанию индекса,
+// каждый — int32 индекс и int64 счётчик (big-endian).
+class DDSketch {
+public:
+    static constexpr double RELATIVE_ACCURACY = 0.01;
+    static constexpr uint8_t FORMAT_VERSION = 1;
+    static constexpr size_t BIN_SIZE = sizeof(int32_t) + sizeof(int64_t);
+    // Лимит бинов: при превышении младшие бины сливаются (точность
+    // сохраняется для верхних квантилей, которые и нужны для latency)
+    static constexpr size_t MAX_BINS = 2048;
+
+    void add(double value);
+    void merge(const DDSketch& other);
+
+    int64_t count() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    // q в [0, 1]; для пустого скетча 0
+    double quantile(double q) const;
+
+    // Пустой скетч сериализуется в пустую строку (NULL в БД)
+    std::string serialize() const;
+    // Бросает std::invalid_argument при неверной версии или длине
+    static DDSketch deserialize(std::string_view bytes);
+
+private:
+    static int32_t indexOf(double value);
+    static double valueOf(int32_t index);
+
+    void addToBin(int32_t index, int64_t count);
+    void collapse();
+
+    int32_t offset_ = 0;           // индекс бина counts_[0]
+    std::vector<int64_t> counts_;
+    int64_t count_ = 0;
+};
+
+} // namespace aggregation
+
+#endif // DDSKETCH_H
@@ -0,0 +1,165 @@
+#ifndef EVENT_BATCH_H
+#define EVENT_BATCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "symbol_table.h"
+
+namespace aggregation {
+
+// События одного типа по колонкам (structure of arrays): строка i — i-й элемент
+// каждой колонки. MetricsClient дописывает колонки прямо из ответа gRPC, а
+// EventAccumulator сворачивает их своим ядром на тип, так что ни одно событие
+// не тянет за собой поля чужих типов.
+//
+// Строковые поля — номера в SymbolTable агрегатора (EMPTY_SYMBOL — значения нет).
+struct EventColumns {
+    std::vector<SymbolId> projectId;
+    std::vector<SymbolId> page;
+    std::vector<SymbolId> userId;
+    std::vector<SymbolId> sessionId;
+    // Время события на клиенте (бакет считается по нему) и время приёма в metrics-service;
+    // timestamp никогда не позже receivedAt
+    std::vector<std::chrono::system_clock::time_point> timestamp;
+    std::vector<std::chrono::system_clock::time_point> receivedAt;
+
+    size_t size() const { return timestamp.size(); }
+    bool empty() const { return timestamp.empty(); }
+
+    // Общие колонки новой строки; колонки своего типа вызывающий дописывает сам
+    void append(SymbolId project, SymbolId pageId, SymbolId user, SymbolId session,
+                std::chrono::system_clock::time_point eventTime,
+                std::chrono::system_clock::time_point received) {
+        projectId.push_back(project);
+        page.push_back(pageId);
+        userId.push_back(user);
+        sessionId.push_back(session);
+        timestamp.push_back(eventTime);
+        receivedAt.push_back(received);
+    }
+
+protected:
+    auto commonColumns() { return std::tie(projectId, page, userId, sessionId, timestamp, receivedAt); }
+    auto commonColumns() const { return std::tie(projectId, page, userId, sessionId, timestamp, receivedAt); }
+    auto commonSymbols() { return std::tie(projectId, page, userId, sessionId); }
+    auto commonSymbols() const { return std::tie(projectId, page, userId, sessionId); }
+};
+
+// columns() — все колонки типа, symbols() — колонки номеров SymbolTable;
+// по ним работают обобщённые операции ниже
+
+struct PageViewBatch : EventColumns {
+    static constexpr const char* EVENT_TYPE = "page_view";
+
+    auto columns() { return commonColumns(); }
+    auto columns() const { return commonColumns(); }
+    auto symbols() { return commonSymbols(); }
+    auto symbols() const { return commonSymbols(); }
+};
+
+struct ClickBatch : EventColumns {
+    static constexpr const char* EVENT_TYPE = "click";
+
+    std::vector<SymbolId> elementId;
+
+    auto columns() { return std::tuple_cat(commonColumns(), std::tie(elementId)); }
+    auto columns() const { return std::tuple_cat(commonColumns(), std::tie(elementId)); }
+    auto symbols() { return std::tuple_cat(commonSymbols(), std::tie(elementId)); }
+    auto symbols() const { return std::tuple_cat(commonSymbols(), std::tie(elementId)); }
+};
+
+struct PerformanceBatch : EventColumns {
+    static constexpr const char* EVENT_TYPE = "performance";
+
+    // 0 — метрика не измерена
+    std::vector<double> totalPageLoadMs;
+    std::vector<double> ttfbMs;
+    std::vector<double> fcpMs;
+    std::vector<double> lcpMs;
+
+    auto columns() { return std::tuple_cat(commonColumns(), std::tie(totalPageLoadMs, ttfbMs, fcpMs, lcpMs)); }
+    auto columns() const { return std::tuple_cat(commonColumns(), std::tie(totalPageLoadMs, ttfbMs, fcpMs, lcpMs)); }
+    auto symbols() { return commonSymbols(); }
+    auto symbols() const { return commonSymbols(); }
+};
+
+struct ErrorBatch : EventColumns {
+    static constexpr const char* EVENT_TYPE = "error";
+
+    std::vector<SymbolId> errorType;
+    std::vector<int32_t> severity;  // 0=UNSPECIFIED, 1=WARNING, 2=ERROR, 3=CRITICAL
+
+    auto columns() { return std::tuple_cat(commonColumns(), std::tie(errorType, severity)); }
+    auto columns() const { return std::tuple_cat(commonColumns(), std::tie(errorType, severity)); }
+    auto symbols() { return std::tuple_cat(commonSymbols(), std::tie(errorType)); }
+    auto symbols() const { return std::tuple_cat(commonSymbols(), std::tie(errorType)); }
+};
+
+struct CustomBatch : EventColumns {
+    static constexpr const char* EVENT_TYPE = "custom";
+
+    std::vector<SymbolId> eventName;
+
+    auto columns() { return std::tuple_cat(commonColumns(), std::tie(eventName)); }
+    auto columns() const { return std::tuple_cat(commonColumns(), std::tie(eventName)); }
+    auto symbols() { return std::tuple_cat(commonSymbols(), std::tie(eventName)); }
+    auto symbols() const { return std::tuple_cat(commonSymbols(), std::tie(eventName)); }
+};
+
+template <typename Batch>
+void clearBatch(Batch& batch) {
+    std::apply([](auto&... column) { (column.clear(), ...); }, batch.columns());
+}
+
+// Дописывает строку row из from в конец to
+template <typename Batch>
+void appendRow(Batch& to, const Batch& from, size_t row) {
+    std::apply([&from, row](auto&... target) {
+        std::apply([row, &target...](const auto&... source) { (target.push_back(source[row]), ...); },
+                   from.columns());
+    }, to.columns());
+}
+
+// Пачки всех типов. Чанк одного потока MetricsClient заполняет только свою
+struct EventBatches {
+    PageViewBatch pageViews;
+    ClickBatch clicks;
+    PerformanceBatch performance;
+    ErrorBatch errors;
+    CustomBatch customEvents;
+
+    template <typename Visit>
+    void forEach(Visit&& visit) {
+        visit(pageViews);
+        visit(clicks);
+        visit(performance);
+        visit(errors);
+        visit(customEvents);
+    }
+
+    template <typename Visit>
+    void forEach(Visit&& visit) const {
+        visit(pageViews);
+        visit(clicks);
+        visit(performance);
+        visit(errors);
+        visit(customEvents);
+    }
+
+    size_t size() const;
+    bool empty() const { return size() == 0; }
+    void clear();
+
+    // Есть ли события, принятые до to
+    bool hasReceivedBefore(std::chrono::system_clock::time_point to) const;
+    // Забирает события, принятые до to; остальные остаются в порядке приёма
+    EventBatches takeReceivedBefore(std::chrono::system_clock::time_point to);
+};
+
+} // namespace aggregation
+
+#endif // EVENT_BATCH_H
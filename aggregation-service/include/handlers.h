@@ -9,10 +9,15 @@
 class HttpHandler {
 public:
     using DatabaseCheckFunc = std::function<bool()>;
+    using MetricsFunc = std::function<std::string()>;
 
     HttpHandler(int port);
     ~HttpHandler();
 
+    // GET /metrics отдаёт результат metrics (текстовый формат Prometheus).
+    // Вызывать до start()
+    void setMetricsHandler(MetricsFunc metrics);
+
     void start();
     void stop();
 
@@ -0,0 +1,125 @@
+#ifndef HOT_WINDOW_H
+#define HOT_WINDOW_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include "aggregator.h"
+
+namespace aggregation {
+
+// Последние часы агрегатов базового уровня в памяти процесса — для GetPageViewsAgg
+// и GetPerformanceAgg без обращения к БД. Агрегатор добавляет каждое закоммиченное
+// окно; данные разбиты на часовые партиции, внутри партиции — колонки по сериям
+// (project, page). Кеш полон на отрезке [coveredFrom, coveredTo): с первого окна
+// после старта (или после разрыва) до последнего watermark.
+//
+// Строки не сливаются: повторно пришедший бакет серии заменяет прежний. Поправки
+// опоздавших событий приходят через refresh() — итоговыми строками из БД.
+class HotWindowCache {
+public:
+    struct Config {
+        std::chrono::hours window{24};
+        size_t maxBytes = 256u << 20;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t rows = 0;
+        size_t bytes = 0;
+        size_t partitions = 0;
+    };
+
+    explicit HotWindowCache(Config config);
+
+    // Окно [from, to) закоммичено в БД. Окно, не продолжающее предыдущее, сбрасывает кеш
+    void add(const AggregationResult& result,
+             std::chrono::system_clock::time_point from,
+             std::chrono::system_clock::time_point to);
+
+    // Бакеты, досчитанные после записи, перечитаны из БД и заменяют прежние.
+    // Строки вне покрытого отрезка пропускаются
+    void refresh(const std::vector<AggregatedPageViews>& pageViews,
+                 const std::vector<AggregatedPerformance>& performance);
+
+    // Строки в порядке БД (time_bucket по убыванию) или nullopt, если from раньше
+    // покрытого отрезка — тогда читать из БД. Пустой pageFilter — все страницы
+    std::optional<std::vector<AggregatedPageViews>> readPageViews(
+        const std::string& projectId,
+        std::chrono::system_clock::time_point from,
+        std::chrono::system_clock::time_point to,
+        const std::string& pageFilter,
+        int limit,
+        int offset
+    );
+
+    std::optional<std::vector<AggregatedPerformance>> readPerformance(
+        const std::string& projectId,
+        std::chrono::system_clock::time_point from,
+        std::chrono::system_clock::time_point to,
+        const std::string& pageFilter,
+        int limit,
+        int offset
+    );
+
+    Stats stats() const;
+    // Метрики в текстовом формате Prometheus (GET /metrics)
+    std::string formatMetrics() const;
+
+private:
+    using SeriesKey = std::pair<std::string, std::string>;  // project_id, page
+
+    // Колонки одной серии в пределах партиции, по возрастанию bucket
+    struct PageViewsColumns {
+        std::vector<int64_t> bucket;  // секунды от эпохи
+        std::vector<int64_t> views;
+        std::vector<int64_t> uniqueUsers;
+        std::vector<int64_t> uniqueSessions;
+    };
+
+    struct PerformanceColumns {
+        std::vector<int64_t> bucket;
+        std::vector<int64_t> samples;
+        std::vector<double> avgTotalLoad, p95TotalLoad, avgTtfb, p95Ttfb;
+        std::vector<double> avgFcp, p95Fcp, avgLcp, p95Lcp;
+        std::vector<std::string> totalLoadSketch, ttfbSketch, fcpSketch, lcpSketch;
+    };
+
+    struct Partition {
+        std::map<SeriesKey, PageViewsColumns> pageViews;
+        std::map<SeriesKey, PerformanceColumns> performance;
+        size_t rows = 0;
+        size_t bytes = 0;
+    };
+
+    void insert(const AggregatedPageViews& row);
+    void insert(const AggregatedPerformance& row);
+    void evict(std::chrono::system_clock::time_point now);
+    void dropOldestPartition();
+    void clear();
+    bool covers(std::chrono::system_clock::time_point from) const;
+
+    Config config_;
+
+    mutable std::shared_mutex mutex_;
+    std::map<int64_t, Partition> partitions_;  // начало часа (секунды от эпохи) -> партиция
+    std::optional<std::chrono::system_clock::time_point> coveredFrom_;
+    std::chrono::system_clock::time_point coveredTo_;
+    size_t rows_ = 0;
+    size_t bytes_ = 0;
+
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+} // namespace aggregation
+
+#endif // HOT_WINDOW_H
@@ -0,0 +1,58 @@
+#ifndef HYPERLOGLOG_H
+#define HYPERLOGLOG_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aggregation {
+
+// HyperLogLog-скетч для оценки числа уникальных значений (p = 12, 4096 регистров,
+// стандартная ошибка ~1.6%). Скетчи объединяются поразрядным максимумом,
+// поэтому uniques нескольких бакетов считаются без исходных событий.
+//
+// Пока значений мало, скетч хранит отсортированные 64-битные хеши (оценка точная),
+// на PROMOTE_THRESHOLD хешах переходит к регистрам.
+//
+// Сериализованный формат (колонки *_hll):
+// плотный — 1 байт точности, затем REGISTERS байт регистров;
+// разреженный — байт SPARSE_TAG, затем хеши по возрастанию, по 8 байт big-endian.
+// Разреженный пишется, пока скетч хранит хеши, поэтому бакет с одним
+// посетителем занимает 9 байт, а не 4097.
+class HyperLogLog {
+public:
+    static constexpr uint8_t PRECISION = 12;
+    static constexpr uint8_t SPARSE_TAG = 0x80 | PRECISION;
+    static constexpr size_t REGISTERS = size_t{1} << PRECISION;
+    static constexpr size_t SERIALIZED_SIZE = REGISTERS + 1;
+    static constexpr size_t PROMOTE_THRESHOLD = REGISTERS / sizeof(uint64_t);
+
+    void add(std::string_view value);
+    // Для значений, чей hash() уже посчитан (SymbolTable хранит его рядом со строкой)
+    void addHash(uint64_t hash);
+    void merge(const HyperLogLog& other);
+
+    int64_t estimate() const;
+    bool empty() const { return sparse_.empty() && registers_.empty(); }
+    bool isSparse() const { return registers_.empty(); }
+
+    std::string serialize() const;
+    // Бросает std::invalid_argument при неверном размере, точности или порядке хешей
+    static HyperLogLog deserialize(std::string_view bytes);
+
+    static uint64_t hash(std::string_view value);
+
+private:
+    void insertSparse(uint64_t hash);
+    void setRegister(uint64_t hash);
+    void promote();
+
+    std::vector<uint64_t> sparse_;
+    std::vector<uint8_t> registers_;
+};
+
+} // namespace aggregation
+
+#endif // HYPERLOGLOG_H
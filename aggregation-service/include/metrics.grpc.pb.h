@@ -70,6 +70,51 @@ class MetricsService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::GetCustomEventsResponse>> PrepareAsyncGetCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::GetCustomEventsResponse>>(PrepareAsyncGetCustomEventsRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetPageViewsResponse>> StreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetPageViewsResponse>>(StreamPageViewsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPageViewsResponse>> AsyncStreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPageViewsResponse>>(AsyncStreamPageViewsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPageViewsResponse>> PrepareAsyncStreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPageViewsResponse>>(PrepareAsyncStreamPageViewsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetClicksResponse>> StreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetClicksResponse>>(StreamClicksRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetClicksResponse>> AsyncStreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetClicksResponse>>(AsyncStreamClicksRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetClicksResponse>> PrepareAsyncStreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetClicksResponse>>(PrepareAsyncStreamClicksRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetPerformanceResponse>> StreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetPerformanceResponse>>(StreamPerformanceRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPerformanceResponse>> AsyncStreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPerformanceResponse>>(AsyncStreamPerformanceRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPerformanceResponse>> PrepareAsyncStreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPerformanceResponse>>(PrepareAsyncStreamPerformanceRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetErrorsResponse>> StreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetErrorsResponse>>(StreamErrorsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetErrorsResponse>> AsyncStreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetErrorsResponse>>(AsyncStreamErrorsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetErrorsResponse>> PrepareAsyncStreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetErrorsResponse>>(PrepareAsyncStreamErrorsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetCustomEventsResponse>> StreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::metricsys::GetCustomEventsResponse>>(StreamCustomEventsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetCustomEventsResponse>> AsyncStreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetCustomEventsResponse>>(AsyncStreamCustomEventsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetCustomEventsResponse>> PrepareAsyncStreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::metricsys::GetCustomEventsResponse>>(PrepareAsyncStreamCustomEventsRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -83,6 +128,11 @@ class MetricsService final {
       virtual void GetErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest* request, ::metricsys::GetErrorsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest* request, ::metricsys::GetCustomEventsResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest* request, ::metricsys::GetCustomEventsResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void StreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetPageViewsResponse>* reactor) = 0;
+      virtual void StreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetClicksResponse>* reactor) = 0;
+      virtual void StreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetPerformanceResponse>* reactor) = 0;
+      virtual void StreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetErrorsResponse>* reactor) = 0;
+      virtual void StreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetCustomEventsResponse>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -98,6 +148,21 @@ class MetricsService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::GetErrorsResponse>* PrepareAsyncGetErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::GetCustomEventsResponse>* AsyncGetCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::GetCustomEventsResponse>* PrepareAsyncGetCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::metricsys::GetPageViewsResponse>* StreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPageViewsResponse>* AsyncStreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPageViewsResponse>* PrepareAsyncStreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::metricsys::GetClicksResponse>* StreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetClicksResponse>* AsyncStreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetClicksResponse>* PrepareAsyncStreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::metricsys::GetPerformanceResponse>* StreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPerformanceResponse>* AsyncStreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetPerformanceResponse>* PrepareAsyncStreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::metricsys::GetErrorsResponse>* StreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetErrorsResponse>* AsyncStreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetErrorsResponse>* PrepareAsyncStreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::metricsys::GetCustomEventsResponse>* StreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetCustomEventsResponse>* AsyncStreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::metricsys::GetCustomEventsResponse>* PrepareAsyncStreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -137,6 +202,51 @@ class MetricsService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::metricsys::GetCustomEventsResponse>> PrepareAsyncGetCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::metricsys::GetCustomEventsResponse>>(PrepareAsyncGetCustomEventsRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetPageViewsResponse>> StreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetPageViewsResponse>>(StreamPageViewsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetPageViewsResponse>> AsyncStreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetPageViewsResponse>>(AsyncStreamPageViewsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetPageViewsResponse>> PrepareAsyncStreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetPageViewsResponse>>(PrepareAsyncStreamPageViewsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetClicksResponse>> StreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetClicksResponse>>(StreamClicksRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetClicksResponse>> AsyncStreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetClicksResponse>>(AsyncStreamClicksRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetClicksResponse>> PrepareAsyncStreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetClicksResponse>>(PrepareAsyncStreamClicksRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetPerformanceResponse>> StreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetPerformanceResponse>>(StreamPerformanceRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetPerformanceResponse>> AsyncStreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetPerformanceResponse>>(AsyncStreamPerformanceRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetPerformanceResponse>> PrepareAsyncStreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetPerformanceResponse>>(PrepareAsyncStreamPerformanceRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetErrorsResponse>> StreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetErrorsResponse>>(StreamErrorsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetErrorsResponse>> AsyncStreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetErrorsResponse>>(AsyncStreamErrorsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetErrorsResponse>> PrepareAsyncStreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetErrorsResponse>>(PrepareAsyncStreamErrorsRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetCustomEventsResponse>> StreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::metricsys::GetCustomEventsResponse>>(StreamCustomEventsRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetCustomEventsResponse>> AsyncStreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetCustomEventsResponse>>(AsyncStreamCustomEventsRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetCustomEventsResponse>> PrepareAsyncStreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::metricsys::GetCustomEventsResponse>>(PrepareAsyncStreamCustomEventsRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -150,6 +260,11 @@ class MetricsService final {
       void GetErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest* request, ::metricsys::GetErrorsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest* request, ::metricsys::GetCustomEventsResponse* response, std::function<void(::grpc::Status)>) override;
       void GetCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest* request, ::metricsys::GetCustomEventsResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void StreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetPageViewsResponse>* reactor) override;
+      void StreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetClicksResponse>* reactor) override;
+      void StreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetPerformanceResponse>* reactor) override;
+      void StreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetErrorsResponse>* reactor) override;
+      void StreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetCustomEventsResponse>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -171,11 +286,31 @@ class MetricsService final {
     ::grpc::ClientAsyncResponseReader< ::metricsys::GetErrorsResponse>* PrepareAsyncGetErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::metricsys::GetCustomEventsResponse>* AsyncGetCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::metricsys::GetCustomEventsResponse>* PrepareAsyncGetCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::metricsys::GetPageViewsResponse>* StreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetPageViewsResponse>* AsyncStreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetPageViewsResponse>* PrepareAsyncStreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::metricsys::GetClicksResponse>* StreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetClicksResponse>* AsyncStreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetClicksResponse>* PrepareAsyncStreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::metricsys::GetPerformanceResponse>* StreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetPerformanceResponse>* AsyncStreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetPerformanceResponse>* PrepareAsyncStreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::metricsys::GetErrorsResponse>* StreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetErrorsResponse>* AsyncStreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetErrorsResponse>* PrepareAsyncStreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::metricsys::GetCustomEventsResponse>* StreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetCustomEventsResponse>* AsyncStreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::metricsys::GetCustomEventsResponse>* PrepareAsyncStreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetPageViews_;
     const ::grpc::internal::RpcMethod rpcmethod_GetClicks_;
     const ::grpc::internal::RpcMethod rpcmethod_GetPerformance_;
     const ::grpc::internal::RpcMethod rpcmethod_GetErrors_;
     const ::grpc::internal::RpcMethod rpcmethod_GetCustomEvents_;
+    const ::grpc::internal::RpcMethod rpcmethod_StreamPageViews_;
+    const ::grpc::internal::RpcMethod rpcmethod_StreamClicks_;
+    const ::grpc::internal::RpcMethod rpcmethod_StreamPerformance_;
+    const ::grpc::internal::RpcMethod rpcmethod_StreamErrors_;
+    const ::grpc::internal::RpcMethod rpcmethod_StreamCustomEvents_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -188,6 +323,11 @@ class MetricsService final {
     virtual ::grpc::Status GetPerformance(::grpc::ServerContext* context, const ::metricsys::GetPerformanceRequest* request, ::metricsys::GetPerformanceResponse* response);
     virtual ::grpc::Status GetErrors(::grpc::ServerContext* context, const ::metricsys::GetErrorsRequest* request, ::metricsys::GetErrorsResponse* response);
     virtual ::grpc::Status GetCustomEvents(::grpc::ServerContext* context, const ::metricsys::GetCustomEventsRequest* request, ::metricsys::GetCustomEventsResponse* response);
+    virtual ::grpc::Status StreamPageViews(::grpc::ServerContext* context, const ::metricsys::GetPageViewsRequest* request, ::grpc::ServerWriter< ::metricsys::GetPageViewsResponse>* writer);
+    virtual ::grpc::Status StreamClicks(::grpc::ServerContext* context, const ::metricsys::GetClicksRequest* request, ::grpc::ServerWriter< ::metricsys::GetClicksResponse>* writer);
+    virtual ::grpc::Status StreamPerformance(::grpc::ServerContext* context, const ::metricsys::GetPerformanceRequest* request, ::grpc::ServerWriter< ::metricsys::GetPerformanceResponse>* writer);
+    virtual ::grpc::Status StreamErrors(::grpc::ServerContext* context, const ::metricsys::GetErrorsRequest* request, ::grpc::ServerWriter< ::metricsys::GetErrorsResponse>* writer);
+    virtual ::grpc::Status StreamCustomEvents(::grpc::ServerContext* context, const ::metricsys::GetCustomEventsRequest* request, ::grpc::ServerWriter< ::metricsys::GetCustomEventsResponse>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetPageViews : public BaseClass {
@@ -289,7 +429,107 @@ class MetricsService final {
       ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetPageViews<WithAsyncMethod_GetClicks<WithAsyncMethod_GetPerformance<WithAsyncMethod_GetErrors<WithAsyncMethod_GetCustomEvents<Service > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_StreamPageViews : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StreamPageViews() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_StreamPageViews() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPageViews(::grpc::ServerContext* /*context*/, const ::metricsys::GetPageViewsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPageViewsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamPageViews(::grpc::ServerContext* context, ::metricsys::GetPageViewsRequest* request, ::grpc::ServerAsyncWriter< ::metricsys::GetPageViewsResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(5, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_StreamClicks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StreamClicks() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_StreamClicks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamClicks(::grpc::ServerContext* /*context*/, const ::metricsys::GetClicksRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetClicksResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamClicks(::grpc::ServerContext* context, ::metricsys::GetClicksRequest* request, ::grpc::ServerAsyncWriter< ::metricsys::GetClicksResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_StreamPerformance : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StreamPerformance() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_StreamPerformance() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPerformance(::grpc::ServerContext* /*context*/, const ::metricsys::GetPerformanceRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPerformanceResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamPerformance(::grpc::ServerContext* context, ::metricsys::GetPerformanceRequest* request, ::grpc::ServerAsyncWriter< ::metricsys::GetPerformanceResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(7, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_StreamErrors : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StreamErrors() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_StreamErrors() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamErrors(::grpc::ServerContext* /*context*/, const ::metricsys::GetErrorsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetErrorsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamErrors(::grpc::ServerContext* context, ::metricsys::GetErrorsRequest* request, ::grpc::ServerAsyncWriter< ::metricsys::GetErrorsResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(8, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_StreamCustomEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_StreamCustomEvents() {
+      ::grpc::Service::MarkMethodAsync(9);
+    }
+    ~WithAsyncMethod_StreamCustomEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCustomEvents(::grpc::ServerContext* /*context*/, const ::metricsys::GetCustomEventsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetCustomEventsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamCustomEvents(::grpc::ServerContext* context, ::metricsys::GetCustomEventsRequest* request, ::grpc::ServerAsyncWriter< ::metricsys::GetCustomEventsResponse>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(9, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GetPageViews<WithAsyncMethod_GetClicks<WithAsyncMethod_GetPerformance<WithAsyncMethod_GetErrors<WithAsyncMethod_GetCustomEvents<WithAsyncMethod_StreamPageViews<WithAsyncMethod_StreamClicks<WithAsyncMethod_StreamPerformance<WithAsyncMethod_StreamErrors<WithAsyncMethod_StreamCustomEvents<Service > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_GetPageViews : public BaseClass {
    private:
@@ -425,7 +665,117 @@ class MetricsService final {
     virtual ::grpc::ServerUnaryReactor* GetCustomEvents(
       ::grpc::CallbackServerContext* /*context*/, const ::metricsys::GetCustomEventsRequest* /*request*/, ::metricsys::GetCustomEventsResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_GetPageViews<WithCallbackMethod_GetClicks<WithCallbackMethod_GetPerformance<WithCallbackMethod_GetErrors<WithCallbackMethod_GetCustomEvents<Service > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_StreamPageViews : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StreamPageViews() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::metricsys::GetPageViewsRequest, ::metricsys::GetPageViewsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::metricsys::GetPageViewsRequest* request) { return this->StreamPageViews(context, request); }));
+    }
+    ~WithCallbackMethod_StreamPageViews() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPageViews(::grpc::ServerContext* /*context*/, const ::metricsys::GetPageViewsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPageViewsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::metricsys::GetPageViewsResponse>* StreamPageViews(
+      ::grpc::CallbackServerContext* /*context*/, const ::metricsys::GetPageViewsRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_StreamClicks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StreamClicks() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::metricsys::GetClicksRequest, ::metricsys::GetClicksResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::metricsys::GetClicksRequest* request) { return this->StreamClicks(context, request); }));
+    }
+    ~WithCallbackMethod_StreamClicks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamClicks(::grpc::ServerContext* /*context*/, const ::metricsys::GetClicksRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetClicksResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::metricsys::GetClicksResponse>* StreamClicks(
+      ::grpc::CallbackServerContext* /*context*/, const ::metricsys::GetClicksRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_StreamPerformance : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StreamPerformance() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::metricsys::GetPerformanceRequest, ::metricsys::GetPerformanceResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::metricsys::GetPerformanceRequest* request) { return this->StreamPerformance(context, request); }));
+    }
+    ~WithCallbackMethod_StreamPerformance() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPerformance(::grpc::ServerContext* /*context*/, const ::metricsys::GetPerformanceRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPerformanceResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::metricsys::GetPerformanceResponse>* StreamPerformance(
+      ::grpc::CallbackServerContext* /*context*/, const ::metricsys::GetPerformanceRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_StreamErrors : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StreamErrors() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::metricsys::GetErrorsRequest, ::metricsys::GetErrorsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::metricsys::GetErrorsRequest* request) { return this->StreamErrors(context, request); }));
+    }
+    ~WithCallbackMethod_StreamErrors() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamErrors(::grpc::ServerContext* /*context*/, const ::metricsys::GetErrorsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetErrorsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::metricsys::GetErrorsResponse>* StreamErrors(
+      ::grpc::CallbackServerContext* /*context*/, const ::metricsys::GetErrorsRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_StreamCustomEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_StreamCustomEvents() {
+      ::grpc::Service::MarkMethodCallback(9,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::metricsys::GetCustomEventsRequest, ::metricsys::GetCustomEventsResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::metricsys::GetCustomEventsRequest* request) { return this->StreamCustomEvents(context, request); }));
+    }
+    ~WithCallbackMethod_StreamCustomEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCustomEvents(::grpc::ServerContext* /*context*/, const ::metricsys::GetCustomEventsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetCustomEventsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::metricsys::GetCustomEventsResponse>* StreamCustomEvents(
+      ::grpc::CallbackServerContext* /*context*/, const ::metricsys::GetCustomEventsRequest* /*request*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_GetPageViews<WithCallbackMethod_GetClicks<WithCallbackMethod_GetPerformance<WithCallbackMethod_GetErrors<WithCallbackMethod_GetCustomEvents<WithCallbackMethod_StreamPageViews<WithCallbackMethod_StreamClicks<WithCallbackMethod_StreamPerformance<WithCallbackMethod_StreamErrors<WithCallbackMethod_StreamCustomEvents<Service > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetPageViews : public BaseClass {
@@ -513,6 +863,91 @@ class MetricsService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_StreamPageViews : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StreamPageViews() {
+      ::grpc::Service::MarkMethodGeneric(5);
+    }
+    ~WithGenericMethod_StreamPageViews() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPageViews(::grpc::ServerContext* /*context*/, const ::metricsys::GetPageViewsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPageViewsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StreamClicks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StreamClicks() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_StreamClicks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamClicks(::grpc::ServerContext* /*context*/, const ::metricsys::GetClicksRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetClicksResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StreamPerformance : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StreamPerformance() {
+      ::grpc::Service::MarkMethodGeneric(7);
+    }
+    ~WithGenericMethod_StreamPerformance() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPerformance(::grpc::ServerContext* /*context*/, const ::metricsys::GetPerformanceRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPerformanceResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StreamErrors : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StreamErrors() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_StreamErrors() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamErrors(::grpc::ServerContext* /*context*/, const ::metricsys::GetErrorsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetErrorsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_StreamCustomEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_StreamCustomEvents() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_StreamCustomEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCustomEvents(::grpc::ServerContext* /*context*/, const ::metricsys::GetCustomEventsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetCustomEventsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GetPageViews : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -613,6 +1048,106 @@ class MetricsService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_StreamPageViews : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StreamPageViews() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_StreamPageViews() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPageViews(::grpc::ServerContext* /*context*/, const ::metricsys::GetPageViewsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPageViewsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamPageViews(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(5, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StreamClicks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StreamClicks() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_StreamClicks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamClicks(::grpc::ServerContext* /*context*/, const ::metricsys::GetClicksRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetClicksResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamClicks(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StreamPerformance : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StreamPerformance() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_StreamPerformance() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPerformance(::grpc::ServerContext* /*context*/, const ::metricsys::GetPerformanceRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPerformanceResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamPerformance(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(7, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StreamErrors : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StreamErrors() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_StreamErrors() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamErrors(::grpc::ServerContext* /*context*/, const ::metricsys::GetErrorsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetErrorsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamErrors(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(8, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_StreamCustomEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_StreamCustomEvents() {
+      ::grpc::Service::MarkMethodRaw(9);
+    }
+    ~WithRawMethod_StreamCustomEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCustomEvents(::grpc::ServerContext* /*context*/, const ::metricsys::GetCustomEventsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetCustomEventsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestStreamCustomEvents(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(9, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_GetPageViews : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -723,6 +1258,116 @@ class MetricsService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_StreamPageViews : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StreamPageViews() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamPageViews(context, request); }));
+    }
+    ~WithRawCallbackMethod_StreamPageViews() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPageViews(::grpc::ServerContext* /*context*/, const ::metricsys::GetPageViewsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPageViewsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamPageViews(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StreamClicks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StreamClicks() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamClicks(context, request); }));
+    }
+    ~WithRawCallbackMethod_StreamClicks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamClicks(::grpc::ServerContext* /*context*/, const ::metricsys::GetClicksRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetClicksResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamClicks(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StreamPerformance : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StreamPerformance() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamPerformance(context, request); }));
+    }
+    ~WithRawCallbackMethod_StreamPerformance() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamPerformance(::grpc::ServerContext* /*context*/, const ::metricsys::GetPerformanceRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPerformanceResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamPerformance(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StreamErrors : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StreamErrors() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamErrors(context, request); }));
+    }
+    ~WithRawCallbackMethod_StreamErrors() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamErrors(::grpc::ServerContext* /*context*/, const ::metricsys::GetErrorsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetErrorsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamErrors(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_StreamCustomEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_StreamCustomEvents() {
+      ::grpc::Service::MarkMethodRawCallback(9,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->StreamCustomEvents(context, request); }));
+    }
+    ~WithRawCallbackMethod_StreamCustomEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status StreamCustomEvents(::grpc::ServerContext* /*context*/, const ::metricsys::GetCustomEventsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetCustomEventsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* StreamCustomEvents(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetPageViews : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -858,8 +1503,143 @@ class MetricsService final {
     virtual ::grpc::Status StreamedGetCustomEvents(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::metricsys::GetCustomEventsRequest,::metricsys::GetCustomEventsResponse>* server_unary_streamer) = 0;
   };
   typedef WithStreamedUnaryMethod_GetPageViews<WithStreamedUnaryMethod_GetClicks<WithStreamedUnaryMethod_GetPerformance<WithStreamedUnaryMethod_GetErrors<WithStreamedUnaryMethod_GetCustomEvents<Service > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GetPageViews<WithStreamedUnaryMethod_GetClicks<WithStreamedUnaryMethod_GetPerformance<WithStreamedUnaryMethod_GetErrors<WithStreamedUnaryMethod_GetCustomEvents<Service > > > > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_StreamPageViews : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_StreamPageViews() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::metricsys::GetPageViewsRequest, ::metricsys::GetPageViewsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::metricsys::GetPageViewsRequest, ::metricsys::GetPageViewsResponse>* streamer) {
+                       return this->StreamedStreamPageViews(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_StreamPageViews() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StreamPageViews(::grpc::ServerContext* /*context*/, const ::metricsys::GetPageViewsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPageViewsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedStreamPageViews(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::metricsys::GetPageViewsRequest,::metricsys::GetPageViewsResponse>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_StreamClicks : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_StreamClicks() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::metricsys::GetClicksRequest, ::metricsys::GetClicksResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::metricsys::GetClicksRequest, ::metricsys::GetClicksResponse>* streamer) {
+                       return this->StreamedStreamClicks(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_StreamClicks() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StreamClicks(::grpc::ServerContext* /*context*/, const ::metricsys::GetClicksRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetClicksResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedStreamClicks(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::metricsys::GetClicksRequest,::metricsys::GetClicksResponse>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_StreamPerformance : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_StreamPerformance() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::metricsys::GetPerformanceRequest, ::metricsys::GetPerformanceResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::metricsys::GetPerformanceRequest, ::metricsys::GetPerformanceResponse>* streamer) {
+                       return this->StreamedStreamPerformance(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_StreamPerformance() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StreamPerformance(::grpc::ServerContext* /*context*/, const ::metricsys::GetPerformanceRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetPerformanceResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedStreamPerformance(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::metricsys::GetPerformanceRequest,::metricsys::GetPerformanceResponse>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_StreamErrors : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_StreamErrors() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::metricsys::GetErrorsRequest, ::metricsys::GetErrorsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::metricsys::GetErrorsRequest, ::metricsys::GetErrorsResponse>* streamer) {
+                       return this->StreamedStreamErrors(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_StreamErrors() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StreamErrors(::grpc::ServerContext* /*context*/, const ::metricsys::GetErrorsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetErrorsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedStreamErrors(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::metricsys::GetErrorsRequest,::metricsys::GetErrorsResponse>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_StreamCustomEvents : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_StreamCustomEvents() {
+      ::grpc::Service::MarkMethodStreamed(9,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::metricsys::GetCustomEventsRequest, ::metricsys::GetCustomEventsResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::metricsys::GetCustomEventsRequest, ::metricsys::GetCustomEventsResponse>* streamer) {
+                       return this->StreamedStreamCustomEvents(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_StreamCustomEvents() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status StreamCustomEvents(::grpc::ServerContext* /*context*/, const ::metricsys::GetCustomEventsRequest* /*request*/, ::grpc::ServerWriter< ::metricsys::GetCustomEventsResponse>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedStreamCustomEvents(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::metricsys::GetCustomEventsRequest,::metricsys::GetCustomEventsResponse>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_StreamPageViews<WithSplitStreamingMethod_StreamClicks<WithSplitStreamingMethod_StreamPerformance<WithSplitStreamingMethod_StreamErrors<WithSplitStreamingMethod_StreamCustomEvents<Service > > > > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_GetPageViews<WithStreamedUnaryMethod_GetClicks<WithStreamedUnaryMethod_GetPerformance<WithStreamedUnaryMethod_GetErrors<WithStreamedUnaryMethod_GetCustomEvents<WithSplitStreamingMethod_StreamPageViews<WithSplitStreamingMethod_StreamClicks<WithSplitStreamingMethod_StreamPerformance<WithSplitStreamingMethod_StreamErrors<WithSplitStreamingMethod_StreamCustomEvents<Service > > > > > > > > > > StreamedService;
 };
 
 }  // namespace metricsys
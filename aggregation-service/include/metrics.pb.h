@@ -61,6 +61,9 @@ extern CustomEvent_PropertiesEntry_DoNotUseDefaultTypeInternal _CustomEvent_Prop
 class ErrorEvent;
 struct ErrorEventDefaultTypeInternal;
 extern ErrorEventDefaultTypeInternal _ErrorEvent_default_instance_;
+class EventCursor;
+struct EventCursorDefaultTypeInternal;
+extern EventCursorDefaultTypeInternal _EventCursor_default_instance_;
 class GetClicksRequest;
 struct GetClicksRequestDefaultTypeInternal;
 extern GetClicksRequestDefaultTypeInternal _GetClicksRequest_default_instance_;
@@ -109,6 +112,7 @@ template<> ::metricsys::ClickEvent* Arena::CreateMaybeMessage<::metricsys::Click
 template<> ::metricsys::CustomEvent* Arena::CreateMaybeMessage<::metricsys::CustomEvent>(Arena*);
 template<> ::metricsys::CustomEvent_PropertiesEntry_DoNotUse* Arena::CreateMaybeMessage<::metricsys::CustomEvent_PropertiesEntry_DoNotUse>(Arena*);
 template<> ::metricsys::ErrorEvent* Arena::CreateMaybeMessage<::metricsys::ErrorEvent>(Arena*);
+template<> ::metricsys::EventCursor* Arena::CreateMaybeMessage<::metricsys::EventCursor>(Arena*);
 template<> ::metricsys::GetClicksRequest* Arena::CreateMaybeMessage<::metricsys::GetClicksRequest>(Arena*);
 template<> ::metricsys::GetClicksResponse* Arena::CreateMaybeMessage<::metricsys::GetClicksResponse>(Arena*);
 template<> ::metricsys::GetCustomEventsRequest* Arena::CreateMaybeMessage<::metricsys::GetCustomEventsRequest>(Arena*);
@@ -473,6 +477,170 @@ class Pagination final :
 };
 // -------------------------------------------------------------------
 
+class EventCursor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.EventCursor) */ {
+ public:
+  inline EventCursor() : EventCursor(nullptr) {}
+  ~EventCursor() override;
+  explicit PROTOBUF_CONSTEXPR EventCursor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EventCursor(const EventCursor& from);
+  EventCursor(EventCursor&& from) noexcept
+    : EventCursor() {
+    *this = ::std::move(from);
+  }
+
+  inline EventCursor& operator=(const EventCursor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EventCursor& operator=(EventCursor&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EventCursor& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EventCursor* internal_default_instance() {
+    return reinterpret_cast<const EventCursor*>(
+               &_EventCursor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(EventCursor& a, EventCursor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EventCursor* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EventCursor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EventCursor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EventCursor>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EventCursor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EventCursor& from) {
+    EventCursor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EventCursor* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.EventCursor";
+  }
+  protected:
+  explicit EventCursor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 2,
+    kTimestampUsFieldNumber = 1,
+  };
+  // string id = 2;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // int64 timestamp_us = 1;
+  void clear_timestamp_us();
+  int64_t timestamp_us() const;
+  void set_timestamp_us(int64_t value);
+  private:
+  int64_t _internal_timestamp_us() const;
+  void _internal_set_timestamp_us(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.EventCursor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    int64_t timestamp_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
 class PageViewEvent final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.PageViewEvent) */ {
  public:
@@ -521,7 +689,7 @@ class PageViewEvent final :
                &_PageViewEvent_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    3;
 
   friend void swap(PageViewEvent& a, PageViewEvent& b) {
     a.Swap(&b);
@@ -600,6 +768,7 @@ class PageViewEvent final :
     kSessionIdFieldNumber = 4,
     kReferrerFieldNumber = 5,
     kTimestampFieldNumber = 6,
+    kReceivedAtFieldNumber = 7,
   };
   // string id = 1;
   void clear_id();
@@ -692,6 +861,15 @@ class PageViewEvent final :
   void _internal_set_timestamp(int64_t value);
   public:
 
+  // int64 received_at = 7;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.PageViewEvent)
  private:
   class _Internal;
@@ -708,6 +886,7 @@ class PageViewEvent final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr referrer_;
     int64_t timestamp_;
+    int64_t received_at_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -762,7 +941,7 @@ class GetPageViewsRequest final :
                &_GetPageViewsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(GetPageViewsRequest& a, GetPageViewsRequest& b) {
     a.Swap(&b);
@@ -839,6 +1018,9 @@ class GetPageViewsRequest final :
     kUserIdFilterFieldNumber = 4,
     kTimeRangeFieldNumber = 1,
     kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 5,
+    kReceivedRangeFieldNumber = 6,
+    kAllowSegmentsFieldNumber = 7,
   };
   // optional string page_filter = 3;
   bool has_page_filter() const;
@@ -912,6 +1094,51 @@ class GetPageViewsRequest final :
       ::metricsys::Pagination* pagination);
   ::metricsys::Pagination* unsafe_arena_release_pagination();
 
+  // optional .metricsys.EventCursor after = 5;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 6;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // bool allow_segments = 7;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.GetPageViewsRequest)
  private:
   class _Internal;
@@ -926,6 +1153,9 @@ class GetPageViewsRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
     ::metricsys::TimeRange* time_range_;
     ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    bool allow_segments_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -980,7 +1210,7 @@ class GetPageViewsResponse final :
                &_GetPageViewsResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(GetPageViewsResponse& a, GetPageViewsResponse& b) {
     a.Swap(&b);
@@ -1054,6 +1284,8 @@ class GetPageViewsResponse final :
 
   enum : int {
     kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
     kTotalCountFieldNumber = 2,
   };
   // repeated .metricsys.PageViewEvent events = 1;
@@ -1074,6 +1306,37 @@ class GetPageViewsResponse final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PageViewEvent >&
       events() const;
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
   // int32 total_count = 2;
   void clear_total_count();
   int32_t total_count() const;
@@ -1091,9 +1354,12 @@ class GetPageViewsResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PageViewEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
     int32_t total_count_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -1148,7 +1414,7 @@ class ClickEvent final :
                &_ClickEvent_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(ClickEvent& a, ClickEvent& b) {
     a.Swap(&b);
@@ -1228,6 +1494,7 @@ class ClickEvent final :
     kUserIdFieldNumber = 5,
     kSessionIdFieldNumber = 6,
     kTimestampFieldNumber = 7,
+    kReceivedAtFieldNumber = 8,
   };
   // string id = 1;
   void clear_id();
@@ -1334,6 +1601,15 @@ class ClickEvent final :
   void _internal_set_timestamp(int64_t value);
   public:
 
+  // int64 received_at = 8;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.ClickEvent)
  private:
   class _Internal;
@@ -1351,6 +1627,7 @@ class ClickEvent final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
     int64_t timestamp_;
+    int64_t received_at_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -1405,7 +1682,7 @@ class GetClicksRequest final :
                &_GetClicksRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
   friend void swap(GetClicksRequest& a, GetClicksRequest& b) {
     a.Swap(&b);
@@ -1483,6 +1760,9 @@ class GetClicksRequest final :
     kUserIdFilterFieldNumber = 5,
     kTimeRangeFieldNumber = 1,
     kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 6,
+    kReceivedRangeFieldNumber = 7,
+    kAllowSegmentsFieldNumber = 8,
   };
   // optional string page_filter = 3;
   bool has_page_filter() const;
@@ -1574,6 +1854,51 @@ class GetClicksRequest final :
       ::metricsys::Pagination* pagination);
   ::metricsys::Pagination* unsafe_arena_release_pagination();
 
+  // optional .metricsys.EventCursor after = 6;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 7;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // bool allow_segments = 8;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.GetClicksRequest)
  private:
   class _Internal;
@@ -1589,6 +1914,9 @@ class GetClicksRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
     ::metricsys::TimeRange* time_range_;
     ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    bool allow_segments_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -1643,7 +1971,7 @@ class GetClicksResponse final :
                &_GetClicksResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
   friend void swap(GetClicksResponse& a, GetClicksResponse& b) {
     a.Swap(&b);
@@ -1717,6 +2045,8 @@ class GetClicksResponse final :
 
   enum : int {
     kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
     kTotalCountFieldNumber = 2,
   };
   // repeated .metricsys.ClickEvent events = 1;
@@ -1737,6 +2067,37 @@ class GetClicksResponse final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ClickEvent >&
       events() const;
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
   // int32 total_count = 2;
   void clear_total_count();
   int32_t total_count() const;
@@ -1754,9 +2115,12 @@ class GetClicksResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ClickEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
     int32_t total_count_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -1811,7 +2175,7 @@ class PerformanceEvent final :
                &_PerformanceEvent_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
   friend void swap(PerformanceEvent& a, PerformanceEvent& b) {
     a.Swap(&b);
@@ -1893,6 +2257,7 @@ class PerformanceEvent final :
     kLcpMsFieldNumber = 5,
     kTotalPageLoadMsFieldNumber = 6,
     kTimestampFieldNumber = 9,
+    kReceivedAtFieldNumber = 10,
   };
   // string id = 1;
   void clear_id();
@@ -2019,6 +2384,15 @@ class PerformanceEvent final :
   void _internal_set_timestamp(int64_t value);
   public:
 
+  // int64 received_at = 10;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.PerformanceEvent)
  private:
   class _Internal;
@@ -2038,6 +2412,7 @@ class PerformanceEvent final :
     double lcp_ms_;
     double total_page_load_ms_;
     int64_t timestamp_;
+    int64_t received_at_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -2092,7 +2467,7 @@ class GetPerformanceRequest final :
                &_GetPerformanceRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
   friend void swap(GetPerformanceRequest& a, GetPerformanceRequest& b) {
     a.Swap(&b);
@@ -2169,6 +2544,9 @@ class GetPerformanceRequest final :
     kUserIdFilterFieldNumber = 4,
     kTimeRangeFieldNumber = 1,
     kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 5,
+    kReceivedRangeFieldNumber = 6,
+    kAllowSegmentsFieldNumber = 7,
   };
   // optional string page_filter = 3;
   bool has_page_filter() const;
@@ -2242,6 +2620,51 @@ class GetPerformanceRequest final :
       ::metricsys::Pagination* pagination);
   ::metricsys::Pagination* unsafe_arena_release_pagination();
 
+  // optional .metricsys.EventCursor after = 5;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 6;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // bool allow_segments = 7;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.GetPerformanceRequest)
  private:
   class _Internal;
@@ -2256,6 +2679,9 @@ class GetPerformanceRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
     ::metricsys::TimeRange* time_range_;
     ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    bool allow_segments_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -2310,7 +2736,7 @@ class GetPerformanceResponse final :
                &_GetPerformanceResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
   friend void swap(GetPerformanceResponse& a, GetPerformanceResponse& b) {
     a.Swap(&b);
@@ -2384,6 +2810,8 @@ class GetPerformanceResponse final :
 
   enum : int {
     kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
     kTotalCountFieldNumber = 2,
   };
   // repeated .metricsys.PerformanceEvent events = 1;
@@ -2404,6 +2832,37 @@ class GetPerformanceResponse final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PerformanceEvent >&
       events() const;
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
   // int32 total_count = 2;
   void clear_total_count();
   int32_t total_count() const;
@@ -2421,9 +2880,12 @@ class GetPerformanceResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PerformanceEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
     int32_t total_count_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -2478,7 +2940,7 @@ class ErrorEvent final :
                &_ErrorEvent_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
   friend void swap(ErrorEvent& a, ErrorEvent& b) {
     a.Swap(&b);
@@ -2559,6 +3021,7 @@ class ErrorEvent final :
     kUserIdFieldNumber = 7,
     kSessionIdFieldNumber = 8,
     kTimestampFieldNumber = 9,
+    kReceivedAtFieldNumber = 10,
     kSeverityFieldNumber = 6,
   };
   // string id = 1;
@@ -2680,6 +3143,15 @@ class ErrorEvent final :
   void _internal_set_timestamp(int64_t value);
   public:
 
+  // int64 received_at = 10;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
   // .metricsys.Severity severity = 6;
   void clear_severity();
   ::metricsys::Severity severity() const;
@@ -2707,6 +3179,7 @@ class ErrorEvent final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
     int64_t timestamp_;
+    int64_t received_at_;
     int severity_;
   };
   union { Impl_ _impl_; };
@@ -2762,7 +3235,7 @@ class GetErrorsRequest final :
                &_GetErrorsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
   friend void swap(GetErrorsRequest& a, GetErrorsRequest& b) {
     a.Swap(&b);
@@ -2840,7 +3313,10 @@ class GetErrorsRequest final :
     kUserIdFilterFieldNumber = 6,
     kTimeRangeFieldNumber = 1,
     kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 7,
+    kReceivedRangeFieldNumber = 8,
     kSeverityFilterFieldNumber = 4,
+    kAllowSegmentsFieldNumber = 9,
   };
   // optional string page_filter = 3;
   bool has_page_filter() const;
@@ -2932,6 +3408,42 @@ class GetErrorsRequest final :
       ::metricsys::Pagination* pagination);
   ::metricsys::Pagination* unsafe_arena_release_pagination();
 
+  // optional .metricsys.EventCursor after = 7;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 8;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
   // optional .metricsys.Severity severity_filter = 4;
   bool has_severity_filter() const;
   private:
@@ -2945,6 +3457,15 @@ class GetErrorsRequest final :
   void _internal_set_severity_filter(::metricsys::Severity value);
   public:
 
+  // bool allow_segments = 9;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.GetErrorsRequest)
  private:
   class _Internal;
@@ -2960,7 +3481,10 @@ class GetErrorsRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
     ::metricsys::TimeRange* time_range_;
     ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
     int severity_filter_;
+    bool allow_segments_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -3015,7 +3539,7 @@ class GetErrorsResponse final :
                &_GetErrorsResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    14;
 
   friend void swap(GetErrorsResponse& a, GetErrorsResponse& b) {
     a.Swap(&b);
@@ -3089,6 +3613,8 @@ class GetErrorsResponse final :
 
   enum : int {
     kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
     kTotalCountFieldNumber = 2,
   };
   // repeated .metricsys.ErrorEvent events = 1;
@@ -3109,8 +3635,39 @@ class GetErrorsResponse final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ErrorEvent >&
       events() const;
 
-  // int32 total_count = 2;
-  void clear_total_count();
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
+  // int32 total_count = 2;
+  void clear_total_count();
   int32_t total_count() const;
   void set_total_count(int32_t value);
   private:
@@ -3126,9 +3683,12 @@ class GetErrorsResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ErrorEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
     int32_t total_count_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -3211,7 +3771,7 @@ class CustomEvent final :
                &_CustomEvent_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    16;
 
   friend void swap(CustomEvent& a, CustomEvent& b) {
     a.Swap(&b);
@@ -3294,6 +3854,7 @@ class CustomEvent final :
     kUserIdFieldNumber = 4,
     kSessionIdFieldNumber = 5,
     kTimestampFieldNumber = 7,
+    kReceivedAtFieldNumber = 8,
   };
   // map<string, string> properties = 6;
   int properties_size() const;
@@ -3403,6 +3964,15 @@ class CustomEvent final :
   void _internal_set_timestamp(int64_t value);
   public:
 
+  // int64 received_at = 8;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.CustomEvent)
  private:
   class _Internal;
@@ -3424,6 +3994,7 @@ class CustomEvent final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
     int64_t timestamp_;
+    int64_t received_at_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -3478,7 +4049,7 @@ class GetCustomEventsRequest final :
                &_GetCustomEventsRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    16;
+    17;
 
   friend void swap(GetCustomEventsRequest& a, GetCustomEventsRequest& b) {
     a.Swap(&b);
@@ -3556,6 +4127,9 @@ class GetCustomEventsRequest final :
     kUserIdFilterFieldNumber = 5,
     kTimeRangeFieldNumber = 1,
     kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 6,
+    kReceivedRangeFieldNumber = 7,
+    kAllowSegmentsFieldNumber = 8,
   };
   // optional string name_filter = 3;
   bool has_name_filter() const;
@@ -3647,6 +4221,51 @@ class GetCustomEventsRequest final :
       ::metricsys::Pagination* pagination);
   ::metricsys::Pagination* unsafe_arena_release_pagination();
 
+  // optional .metricsys.EventCursor after = 6;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 7;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // bool allow_segments = 8;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
   // @@protoc_insertion_point(class_scope:metricsys.GetCustomEventsRequest)
  private:
   class _Internal;
@@ -3662,6 +4281,9 @@ class GetCustomEventsRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
     ::metricsys::TimeRange* time_range_;
     ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    bool allow_segments_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -3716,7 +4338,7 @@ class GetCustomEventsResponse final :
                &_GetCustomEventsResponse_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    17;
+    18;
 
   friend void swap(GetCustomEventsResponse& a, GetCustomEventsResponse& b) {
     a.Swap(&b);
@@ -3790,6 +4412,8 @@ class GetCustomEventsResponse final :
 
   enum : int {
     kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
     kTotalCountFieldNumber = 2,
   };
   // repeated .metricsys.CustomEvent events = 1;
@@ -3810,6 +4434,37 @@ class GetCustomEventsResponse final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::CustomEvent >&
       events() const;
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
   // int32 total_count = 2;
   void clear_total_count();
   int32_t total_count() const;
@@ -3827,9 +4482,12 @@ class GetCustomEventsResponse final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
     ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::CustomEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
     int32_t total_count_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
@@ -3931,6 +4589,80 @@ inline void Pagination::set_offset(int32_t value) {
 
 // -------------------------------------------------------------------
 
+// EventCursor
+
+// int64 timestamp_us = 1;
+inline void EventCursor::clear_timestamp_us() {
+  _impl_.timestamp_us_ = int64_t{0};
+}
+inline int64_t EventCursor::_internal_timestamp_us() const {
+  return _impl_.timestamp_us_;
+}
+inline int64_t EventCursor::timestamp_us() const {
+  // @@protoc_insertion_point(field_get:metricsys.EventCursor.timestamp_us)
+  return _internal_timestamp_us();
+}
+inline void EventCursor::_internal_set_timestamp_us(int64_t value) {
+  
+  _impl_.timestamp_us_ = value;
+}
+inline void EventCursor::set_timestamp_us(int64_t value) {
+  _internal_set_timestamp_us(value);
+  // @@protoc_insertion_point(field_set:metricsys.EventCursor.timestamp_us)
+}
+
+// string id = 2;
+inline void EventCursor::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& EventCursor::id() const {
+  // @@protoc_insertion_point(field_get:metricsys.EventCursor.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventCursor::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.EventCursor.id)
+}
+inline std::string* EventCursor::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.EventCursor.id)
+  return _s;
+}
+inline const std::string& EventCursor::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void EventCursor::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EventCursor::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EventCursor::release_id() {
+  // @@protoc_insertion_point(field_release:metricsys.EventCursor.id)
+  return _impl_.id_.Release();
+}
+inline void EventCursor::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.EventCursor.id)
+}
+
+// -------------------------------------------------------------------
+
 // PageViewEvent
 
 // string id = 1;
@@ -4257,6 +4989,26 @@ inline void PageViewEvent::set_timestamp(int64_t value) {
   // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.timestamp)
 }
 
+// int64 received_at = 7;
+inline void PageViewEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t PageViewEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t PageViewEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.PageViewEvent.received_at)
+  return _internal_received_at();
+}
+inline void PageViewEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void PageViewEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.received_at)
+}
+
 // -------------------------------------------------------------------
 
 // GetPageViewsRequest
@@ -4577,6 +5329,206 @@ inline void GetPageViewsRequest::set_allocated_user_id_filter(std::string* user_
   // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.user_id_filter)
 }
 
+// optional .metricsys.EventCursor after = 5;
+inline bool GetPageViewsRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetPageViewsRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetPageViewsRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::metricsys::EventCursor& GetPageViewsRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetPageViewsRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.after)
+  return _internal_after();
+}
+inline void GetPageViewsRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPageViewsRequest.after)
+}
+inline ::metricsys::EventCursor* GetPageViewsRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPageViewsRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPageViewsRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetPageViewsRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsRequest.after)
+  return _msg;
+}
+inline void GetPageViewsRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 6;
+inline bool GetPageViewsRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetPageViewsRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetPageViewsRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::TimeRange& GetPageViewsRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetPageViewsRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetPageViewsRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPageViewsRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsRequest.received_range)
+  return _msg;
+}
+inline void GetPageViewsRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.received_range)
+}
+
+// bool allow_segments = 7;
+inline void GetPageViewsRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
+}
+inline bool GetPageViewsRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
+}
+inline bool GetPageViewsRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.allow_segments)
+  return _internal_allow_segments();
+}
+inline void GetPageViewsRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
+}
+inline void GetPageViewsRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPageViewsRequest.allow_segments)
+}
+
 // -------------------------------------------------------------------
 
 // GetPageViewsResponse
@@ -4641,63 +5593,181 @@ inline void GetPageViewsResponse::set_total_count(int32_t value) {
   // @@protoc_insertion_point(field_set:metricsys.GetPageViewsResponse.total_count)
 }
 
-// -------------------------------------------------------------------
-
-// ClickEvent
-
-// string id = 1;
-inline void ClickEvent::clear_id() {
-  _impl_.id_.ClearToEmpty();
-}
-inline const std::string& ClickEvent::id() const {
-  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.id)
-  return _internal_id();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void ClickEvent::set_id(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.id)
-}
-inline std::string* ClickEvent::mutable_id() {
-  std::string* _s = _internal_mutable_id();
-  // @@protoc_insertion_point(field_mutable:metricsys.ClickEvent.id)
-  return _s;
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetPageViewsResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
 }
-inline const std::string& ClickEvent::_internal_id() const {
-  return _impl_.id_.Get();
+inline bool GetPageViewsResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
 }
-inline void ClickEvent::_internal_set_id(const std::string& value) {
-  
-  _impl_.id_.Set(value, GetArenaForAllocation());
+inline void GetPageViewsResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline std::string* ClickEvent::_internal_mutable_id() {
-  
-  return _impl_.id_.Mutable(GetArenaForAllocation());
+inline const ::metricsys::EventCursor& GetPageViewsResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
 }
-inline std::string* ClickEvent::release_id() {
-  // @@protoc_insertion_point(field_release:metricsys.ClickEvent.id)
-  return _impl_.id_.Release();
+inline const ::metricsys::EventCursor& GetPageViewsResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsResponse.next_cursor)
+  return _internal_next_cursor();
 }
-inline void ClickEvent::set_allocated_id(std::string* id) {
-  if (id != nullptr) {
-    
-  } else {
-    
+inline void GetPageViewsResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
   }
-  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.id_.IsDefault()) {
-    _impl_.id_.Set("", GetArenaForAllocation());
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.ClickEvent.id)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPageViewsResponse.next_cursor)
 }
-
-// string page = 2;
-inline void ClickEvent::clear_page() {
-  _impl_.page_.ClearToEmpty();
+inline ::metricsys::EventCursor* GetPageViewsResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPageViewsResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPageViewsResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetPageViewsResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsResponse.next_cursor)
+  return _msg;
+}
+inline void GetPageViewsResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetPageViewsResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetPageViewsResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetPageViewsResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetPageViewsResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetPageViewsResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetPageViewsResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetPageViewsResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPageViewsResponse.received_until)
+}
+
+// -------------------------------------------------------------------
+
+// ClickEvent
+
+// string id = 1;
+inline void ClickEvent::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& ClickEvent::id() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClickEvent::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.id)
+}
+inline std::string* ClickEvent::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.ClickEvent.id)
+  return _s;
+}
+inline const std::string& ClickEvent::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void ClickEvent::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClickEvent::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClickEvent::release_id() {
+  // @@protoc_insertion_point(field_release:metricsys.ClickEvent.id)
+  return _impl_.id_.Release();
+}
+inline void ClickEvent::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ClickEvent.id)
+}
+
+// string page = 2;
+inline void ClickEvent::clear_page() {
+  _impl_.page_.ClearToEmpty();
 }
 inline const std::string& ClickEvent::page() const {
   // @@protoc_insertion_point(field_get:metricsys.ClickEvent.page)
@@ -5019,6 +6089,26 @@ inline void ClickEvent::set_timestamp(int64_t value) {
   // @@protoc_insertion_point(field_set:metricsys.ClickEvent.timestamp)
 }
 
+// int64 received_at = 8;
+inline void ClickEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t ClickEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t ClickEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.received_at)
+  return _internal_received_at();
+}
+inline void ClickEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void ClickEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.received_at)
+}
+
 // -------------------------------------------------------------------
 
 // GetClicksRequest
@@ -5407,6 +6497,206 @@ inline void GetClicksRequest::set_allocated_user_id_filter(std::string* user_id_
   // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.user_id_filter)
 }
 
+// optional .metricsys.EventCursor after = 6;
+inline bool GetClicksRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetClicksRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetClicksRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::EventCursor& GetClicksRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetClicksRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.after)
+  return _internal_after();
+}
+inline void GetClicksRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetClicksRequest.after)
+}
+inline ::metricsys::EventCursor* GetClicksRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetClicksRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetClicksRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetClicksRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.after)
+  return _msg;
+}
+inline void GetClicksRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 7;
+inline bool GetClicksRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetClicksRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetClicksRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::metricsys::TimeRange& GetClicksRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetClicksRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetClicksRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetClicksRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetClicksRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.received_range)
+  return _msg;
+}
+inline void GetClicksRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.received_range)
+}
+
+// bool allow_segments = 8;
+inline void GetClicksRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
+}
+inline bool GetClicksRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
+}
+inline bool GetClicksRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.allow_segments)
+  return _internal_allow_segments();
+}
+inline void GetClicksRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
+}
+inline void GetClicksRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetClicksRequest.allow_segments)
+}
+
 // -------------------------------------------------------------------
 
 // GetClicksResponse
@@ -5471,6 +6761,124 @@ inline void GetClicksResponse::set_total_count(int32_t value) {
   // @@protoc_insertion_point(field_set:metricsys.GetClicksResponse.total_count)
 }
 
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetClicksResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetClicksResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetClicksResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetClicksResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetClicksResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetClicksResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetClicksResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetClicksResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetClicksResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetClicksResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetClicksResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksResponse.next_cursor)
+  return _msg;
+}
+inline void GetClicksResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetClicksResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetClicksResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetClicksResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetClicksResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetClicksResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetClicksResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetClicksResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetClicksResponse.received_until)
+}
+
 // -------------------------------------------------------------------
 
 // PerformanceEvent
@@ -5843,6 +7251,26 @@ inline void PerformanceEvent::set_timestamp(int64_t value) {
   // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.timestamp)
 }
 
+// int64 received_at = 10;
+inline void PerformanceEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t PerformanceEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t PerformanceEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.received_at)
+  return _internal_received_at();
+}
+inline void PerformanceEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void PerformanceEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.received_at)
+}
+
 // -------------------------------------------------------------------
 
 // GetPerformanceRequest
@@ -6103,64 +7531,264 @@ inline bool GetPerformanceRequest::_internal_has_user_id_filter() const {
 inline bool GetPerformanceRequest::has_user_id_filter() const {
   return _internal_has_user_id_filter();
 }
-inline void GetPerformanceRequest::clear_user_id_filter() {
-  _impl_.user_id_filter_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+inline void GetPerformanceRequest::clear_user_id_filter() {
+  _impl_.user_id_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetPerformanceRequest::user_id_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.user_id_filter)
+  return _internal_user_id_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetPerformanceRequest::set_user_id_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.user_id_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceRequest.user_id_filter)
+}
+inline std::string* GetPerformanceRequest::mutable_user_id_filter() {
+  std::string* _s = _internal_mutable_user_id_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.user_id_filter)
+  return _s;
+}
+inline const std::string& GetPerformanceRequest::_internal_user_id_filter() const {
+  return _impl_.user_id_filter_.Get();
+}
+inline void GetPerformanceRequest::_internal_set_user_id_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetPerformanceRequest::_internal_mutable_user_id_filter() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetPerformanceRequest::release_user_id_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.user_id_filter)
+  if (!_internal_has_user_id_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.user_id_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetPerformanceRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
+  if (user_id_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.user_id_filter)
+}
+
+// optional .metricsys.EventCursor after = 5;
+inline bool GetPerformanceRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetPerformanceRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetPerformanceRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::metricsys::EventCursor& GetPerformanceRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetPerformanceRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.after)
+  return _internal_after();
+}
+inline void GetPerformanceRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPerformanceRequest.after)
+}
+inline ::metricsys::EventCursor* GetPerformanceRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPerformanceRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPerformanceRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetPerformanceRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.after)
+  return _msg;
+}
+inline void GetPerformanceRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 6;
+inline bool GetPerformanceRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetPerformanceRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetPerformanceRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::TimeRange& GetPerformanceRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetPerformanceRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetPerformanceRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPerformanceRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
 }
-inline const std::string& GetPerformanceRequest::user_id_filter() const {
-  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.user_id_filter)
-  return _internal_user_id_filter();
+inline ::metricsys::TimeRange* GetPerformanceRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void GetPerformanceRequest::set_user_id_filter(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.user_id_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceRequest.user_id_filter)
+inline ::metricsys::TimeRange* GetPerformanceRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.received_range)
+  return _msg;
 }
-inline std::string* GetPerformanceRequest::mutable_user_id_filter() {
-  std::string* _s = _internal_mutable_user_id_filter();
-  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.user_id_filter)
-  return _s;
+inline void GetPerformanceRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.received_range)
 }
-inline const std::string& GetPerformanceRequest::_internal_user_id_filter() const {
-  return _impl_.user_id_filter_.Get();
+
+// bool allow_segments = 7;
+inline void GetPerformanceRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
 }
-inline void GetPerformanceRequest::_internal_set_user_id_filter(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+inline bool GetPerformanceRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
 }
-inline std::string* GetPerformanceRequest::_internal_mutable_user_id_filter() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+inline bool GetPerformanceRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.allow_segments)
+  return _internal_allow_segments();
 }
-inline std::string* GetPerformanceRequest::release_user_id_filter() {
-  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.user_id_filter)
-  if (!_internal_has_user_id_filter()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.user_id_filter_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.user_id_filter_.IsDefault()) {
-    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline void GetPerformanceRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
 }
-inline void GetPerformanceRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
-  if (user_id_filter != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.user_id_filter_.IsDefault()) {
-    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.user_id_filter)
+inline void GetPerformanceRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceRequest.allow_segments)
 }
 
 // -------------------------------------------------------------------
@@ -6227,6 +7855,124 @@ inline void GetPerformanceResponse::set_total_count(int32_t value) {
   // @@protoc_insertion_point(field_set:metricsys.GetPerformanceResponse.total_count)
 }
 
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetPerformanceResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetPerformanceResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetPerformanceResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetPerformanceResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetPerformanceResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetPerformanceResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPerformanceResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetPerformanceResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPerformanceResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPerformanceResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetPerformanceResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceResponse.next_cursor)
+  return _msg;
+}
+inline void GetPerformanceResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetPerformanceResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetPerformanceResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetPerformanceResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetPerformanceResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetPerformanceResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetPerformanceResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetPerformanceResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceResponse.received_until)
+}
+
 // -------------------------------------------------------------------
 
 // ErrorEvent
@@ -6675,6 +8421,26 @@ inline void ErrorEvent::set_timestamp(int64_t value) {
   // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.timestamp)
 }
 
+// int64 received_at = 10;
+inline void ErrorEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t ErrorEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t ErrorEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.received_at)
+  return _internal_received_at();
+}
+inline void ErrorEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void ErrorEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.received_at)
+}
+
 // -------------------------------------------------------------------
 
 // GetErrorsRequest
@@ -6929,7 +8695,7 @@ inline void GetErrorsRequest::set_allocated_page_filter(std::string* page_filter
 
 // optional .metricsys.Severity severity_filter = 4;
 inline bool GetErrorsRequest::_internal_has_severity_filter() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
   return value;
 }
 inline bool GetErrorsRequest::has_severity_filter() const {
@@ -6937,7 +8703,7 @@ inline bool GetErrorsRequest::has_severity_filter() const {
 }
 inline void GetErrorsRequest::clear_severity_filter() {
   _impl_.severity_filter_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000020u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
 }
 inline ::metricsys::Severity GetErrorsRequest::_internal_severity_filter() const {
   return static_cast< ::metricsys::Severity >(_impl_.severity_filter_);
@@ -6947,7 +8713,7 @@ inline ::metricsys::Severity GetErrorsRequest::severity_filter() const {
   return _internal_severity_filter();
 }
 inline void GetErrorsRequest::_internal_set_severity_filter(::metricsys::Severity value) {
-  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_._has_bits_[0] |= 0x00000080u;
   _impl_.severity_filter_ = value;
 }
 inline void GetErrorsRequest::set_severity_filter(::metricsys::Severity value) {
@@ -7051,44 +8817,244 @@ inline std::string* GetErrorsRequest::mutable_user_id_filter() {
   // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.user_id_filter)
   return _s;
 }
-inline const std::string& GetErrorsRequest::_internal_user_id_filter() const {
-  return _impl_.user_id_filter_.Get();
+inline const std::string& GetErrorsRequest::_internal_user_id_filter() const {
+  return _impl_.user_id_filter_.Get();
+}
+inline void GetErrorsRequest::_internal_set_user_id_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetErrorsRequest::_internal_mutable_user_id_filter() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetErrorsRequest::release_user_id_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.user_id_filter)
+  if (!_internal_has_user_id_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.user_id_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetErrorsRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
+  if (user_id_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.user_id_filter)
+}
+
+// optional .metricsys.EventCursor after = 7;
+inline bool GetErrorsRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetErrorsRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetErrorsRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::EventCursor& GetErrorsRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetErrorsRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.after)
+  return _internal_after();
+}
+inline void GetErrorsRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetErrorsRequest.after)
+}
+inline ::metricsys::EventCursor* GetErrorsRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetErrorsRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetErrorsRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetErrorsRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.after)
+  return _msg;
+}
+inline void GetErrorsRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 8;
+inline bool GetErrorsRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetErrorsRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetErrorsRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::metricsys::TimeRange& GetErrorsRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetErrorsRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetErrorsRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetErrorsRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.received_range)
+  return _msg;
+}
+inline void GetErrorsRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.received_range)
+}
+
+// bool allow_segments = 9;
+inline void GetErrorsRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
 }
-inline void GetErrorsRequest::_internal_set_user_id_filter(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
-  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+inline bool GetErrorsRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
 }
-inline std::string* GetErrorsRequest::_internal_mutable_user_id_filter() {
-  _impl_._has_bits_[0] |= 0x00000004u;
-  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+inline bool GetErrorsRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.allow_segments)
+  return _internal_allow_segments();
 }
-inline std::string* GetErrorsRequest::release_user_id_filter() {
-  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.user_id_filter)
-  if (!_internal_has_user_id_filter()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000004u;
-  auto* p = _impl_.user_id_filter_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.user_id_filter_.IsDefault()) {
-    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline void GetErrorsRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
 }
-inline void GetErrorsRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
-  if (user_id_filter != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000004u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000004u;
-  }
-  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.user_id_filter_.IsDefault()) {
-    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.user_id_filter)
+inline void GetErrorsRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsRequest.allow_segments)
 }
 
 // -------------------------------------------------------------------
@@ -7155,6 +9121,124 @@ inline void GetErrorsResponse::set_total_count(int32_t value) {
   // @@protoc_insertion_point(field_set:metricsys.GetErrorsResponse.total_count)
 }
 
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetErrorsResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetErrorsResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetErrorsResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetErrorsResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetErrorsResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetErrorsResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetErrorsResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetErrorsResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetErrorsResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetErrorsResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetErrorsResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsResponse.next_cursor)
+  return _msg;
+}
+inline void GetErrorsResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetErrorsResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetErrorsResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetErrorsResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetErrorsResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetErrorsResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetErrorsResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetErrorsResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsResponse.received_until)
+}
+
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -7514,6 +9598,26 @@ inline void CustomEvent::set_timestamp(int64_t value) {
   // @@protoc_insertion_point(field_set:metricsys.CustomEvent.timestamp)
 }
 
+// int64 received_at = 8;
+inline void CustomEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t CustomEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t CustomEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.CustomEvent.received_at)
+  return _internal_received_at();
+}
+inline void CustomEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void CustomEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.CustomEvent.received_at)
+}
+
 // -------------------------------------------------------------------
 
 // GetCustomEventsRequest
@@ -7902,6 +10006,206 @@ inline void GetCustomEventsRequest::set_allocated_user_id_filter(std::string* us
   // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.user_id_filter)
 }
 
+// optional .metricsys.EventCursor after = 6;
+inline bool GetCustomEventsRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetCustomEventsRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetCustomEventsRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::EventCursor& GetCustomEventsRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetCustomEventsRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.after)
+  return _internal_after();
+}
+inline void GetCustomEventsRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetCustomEventsRequest.after)
+}
+inline ::metricsys::EventCursor* GetCustomEventsRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetCustomEventsRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetCustomEventsRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetCustomEventsRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.after)
+  return _msg;
+}
+inline void GetCustomEventsRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 7;
+inline bool GetCustomEventsRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetCustomEventsRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetCustomEventsRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::metricsys::TimeRange& GetCustomEventsRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetCustomEventsRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetCustomEventsRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetCustomEventsRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.received_range)
+  return _msg;
+}
+inline void GetCustomEventsRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.received_range)
+}
+
+// bool allow_segments = 8;
+inline void GetCustomEventsRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
+}
+inline bool GetCustomEventsRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
+}
+inline bool GetCustomEventsRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.allow_segments)
+  return _internal_allow_segments();
+}
+inline void GetCustomEventsRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
+}
+inline void GetCustomEventsRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsRequest.allow_segments)
+}
+
 // -------------------------------------------------------------------
 
 // GetCustomEventsResponse
@@ -7966,6 +10270,124 @@ inline void GetCustomEventsResponse::set_total_count(int32_t value) {
   // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsResponse.total_count)
 }
 
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetCustomEventsResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetCustomEventsResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetCustomEventsResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetCustomEventsResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetCustomEventsResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetCustomEventsResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetCustomEventsResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetCustomEventsResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetCustomEventsResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetCustomEventsResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetCustomEventsResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsResponse.next_cursor)
+  return _msg;
+}
+inline void GetCustomEventsResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetCustomEventsResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetCustomEventsResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetCustomEventsResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetCustomEventsResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetCustomEventsResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetCustomEventsResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetCustomEventsResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsResponse.received_until)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -8003,6 +10425,8 @@ inline void GetCustomEventsResponse::set_total_count(int32_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -6,6 +6,7 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include <grpcpp/grpcpp.h>
@@ -15,57 +16,137 @@ namespace aggregation {
 
     class MetricsClient {
     public:
-        MetricsClient(const std::string& host, const std::string& port);
+        // Получает очередной чанк событий (заполнена пачка одного типа); пачки
+        // переиспользуются между вызовами.
+        // Вызывается из потоков gRPC, но никогда не конкурентно с самим собой.
+        using ChunkHandler = std::function<void(const EventBatches& chunk)>;
+
+        static constexpr int DEFAULT_CHUNK_SIZE = 1000;
+        static constexpr std::chrono::milliseconds DEFAULT_CALL_TIMEOUT{30000};
+
+        MetricsClient(const std::string& host, const std::string& port,
+                      int chunkSize = DEFAULT_CHUNK_SIZE,
+                      std::chrono::milliseconds callTimeout = DEFAULT_CALL_TIMEOUT);
         ~MetricsClient();
 
-        // Получить все события всех типов за период
-        std::vector<RawEvent> fetchAllEvents(
+        // Читает все события всех типов, принятые metrics-service в [from, to)
+        // (по received_at, а не времени события). metrics-service урезает to до
+        // своего горизонта записи: на выходе to — конец окна, до которого прочитано
+        // всё и с которого надо продолжать. Пять Stream* RPC идут
+        // параллельно через callback API, у каждого вызова свой дедлайн.
+        // События отдаются чанками по chunkSize, строковые поля переводятся
+        // в номера symbols (под той же блокировкой, что и onChunk, так что
+        // в обработчике словарь тоже можно трогать). Возвращает количество событий.
+        // Бросает std::runtime_error, если какой-то поток не удалось дочитать
+        // (частичный результат агрегировать нельзя).
+        int64_t streamAllEvents(
             std::chrono::system_clock::time_point from,
-            std::chrono::system_clock::time_point to
+            std::chrono::system_clock::time_point& to,
+            SymbolTable& symbols,
+            const ChunkHandler& onChunk
         );
 
         // Отдельные методы для каждого типа событий
-        std::vector<RawEvent> fetchPageViews(
+        int64_t streamPageViews(
             std::chrono::system_clock::time_point from,
-            std::chrono::system_clock::time_point to
+            std::chrono::system_clock::time_point to,
+            SymbolTable& symbols,
+            const ChunkHandler& onChunk
         );
 
-        std::vector<RawEvent> fetchClicks(
+        int64_t streamClicks(
             std::chrono::system_clock::time_point from,
-            std::chrono::system_clock::time_point to
+            std::chrono::system_clock::time_point to,
+            SymbolTable& symbols,
+            const ChunkHandler& onChunk
         );
 
-        std::vector<RawEvent> fetchPerformance(
+        int64_t streamPerformance(
             std::chrono::system_clock::time_point from,
-            std::chrono::system_clock::time_point to
+            std::chrono::system_clock::time_point to,
+            SymbolTable& symbols,
+            const ChunkHandler& onChunk
         );
 
-        std::vector<RawEvent> fetchErrors(
+        int64_t streamErrors(
             std::chrono::system_clock::time_point from,
-            std::chrono::system_clock::time_point to
+            std::chrono::system_clock::time_point to,
+            SymbolTable& symbols,
+            const ChunkHandler& onChunk
         );
 
-        std::vector<RawEvent> fetchCustomEvents(
+        int64_t streamCustomEvents(
             std::chrono::system_clock::time_point from,
-            std::chrono::system_clock::time_point to
+            std::chrono::system_clock::time_point to,
+            SymbolTable& symbols,
+            const ChunkHandler& onChunk
         );
 
         bool isConnected() const;
 
     private:
+        class EventStream;
+        template <typename Request, typename Response>
+        class TypedEventStream;
+        struct StreamGroup;
+
+        using StreamList = std::vector<std::unique_ptr<EventStream>>;
+
+        // Запускает потоки одновременно и ждёт завершения всех; оборвавшиеся
+        // переоткрываются с последнего next_cursor, так что события
+        // не теряются и не дублируются. receivedUntil урезается до общего
+        // received_until потоков; разные received_until — std::runtime_error
+        int64_t runStreams(StreamList& streams, SymbolTable& symbols, const ChunkHandler& onChunk,
+                           std::chrono::system_clock::time_point* receivedUntil = nullptr);
+
+        std::unique_ptr<EventStream> makePageViewsStream(
+            std::chrono::system_clock::time_point from,
+            std::chrono::system_clock::time_point to);
+        std::unique_ptr<EventStream> makeClicksStream(
+            std::chrono::system_clock::time_point from,
+            std::chrono::system_clock::time_point to);
+        std::unique_ptr<EventStream> makePerformanceStream(
+            std::chrono::system_clock::time_point from,
+            std::chrono::system_clock::time_point to);
+        std::unique_ptr<EventStream> makeErrorsStream(
+            std::chrono::system_clock::time_point from,
+            std::chrono::system_clock::time_point to);
+        std::unique_ptr<EventStream> makeCustomEventsStream(
+            std::chrono::system_clock::time_point from,
+            std::chrono::system_clock::time_point to);
+
+        void appendEvents(const metricsys::GetPageViewsResponse& response, SymbolTable& symbols,
+                          EventBatches& out) const;
+        void appendEvents(const metricsys::GetClicksResponse& response, SymbolTable& symbols,
+                          EventBatches& out) const;
+        void appendEvents(const metricsys::GetPerformanceResponse& response, SymbolTable& symbols,
+                          EventBatches& out) const;
+        void appendEvents(const metricsys::GetErrorsResponse& response, SymbolTable& symbols,
+                          EventBatches& out) const;
+        void appendEvents(const metricsys::GetCustomEventsResponse& response, SymbolTable& symbols,
+                          EventBatches& out) const;
+
         metricsys::TimeRange makeTimeRange(
             std::chrono::system_clock::time_point from,
             std::chrono::system_clock::time_point to
         ) const;
 
+        metricsys::Pagination makePagination() const;
+
+        // Общие колонки строки события metrics-service, включая timestamp и receivedAt
+        template <typename Event>
+        void appendCommon(EventColumns& batch, SymbolId projectId, const Event& event,
+                          SymbolTable& symbols) const;
+
         std::chrono::system_clock::time_point timestampToTimePoint(int64_t ts) const;
 
         std::shared_ptr<grpc::Channel> channel_;
         std::unique_ptr<metricsys::MetricsService::Stub> stub_;
         std::string projectId_;
+        int chunkSize_;
+        std::chrono::milliseconds callTimeout_;
     };
 
 } // namespace aggregation
 
 #endif // METRICS_CLIENT_H
-
@@ -0,0 +1,20 @@
+#ifndef PG_BINARY_H
+#define PG_BINARY_H
+
+#include <chrono>
+#include <cstdint>
+
+namespace aggregation {
+
+// Бинарный формат значений PostgreSQL (COPY BINARY и результаты с resultFormat = 1):
+// целые и float8 в сетевом порядке байт, timestamptz — int64 микросекунд от 2000-01-01 UTC
+inline constexpr std::chrono::seconds POSTGRES_EPOCH{946684800};
+
+int32_t readInt4(const char* data);
+int64_t readInt8(const char* data);
+double readFloat8(const char* data);
+std::chrono::system_clock::time_point readTimestamp(const char* data);
+
+} // namespace aggregation
+
+#endif // PG_BINARY_H
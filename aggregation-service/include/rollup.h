@@ -0,0 +1,55 @@
+#ifndef ROLLUP_H
+#define ROLLUP_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace aggregation {
+
+// Разрешения агрегатов (колонка step_seconds). Агрегатор пишет из событий только
+// базовый уровень, каждый следующий сворачивается из предыдущего (Database::rollup)
+inline constexpr std::chrono::minutes BASE_BUCKET{1};
+inline constexpr std::array<std::chrono::seconds, 4> ROLLUP_LEVELS{
+    std::chrono::seconds(60),
+    std::chrono::seconds(300),
+    std::chrono::seconds(3600),
+    std::chrono::seconds(86400),
+};
+static_assert(ROLLUP_LEVELS.front() == BASE_BUCKET);
+
+// Если шаг не задан, берётся такой, чтобы на диапазон было не больше стольких бакетов
+inline constexpr int64_t AUTO_STEP_MAX_POINTS = 1000;
+
+// Часть диапазона запроса, читаемая с одного уровня
+struct TimeSegment {
+    std::chrono::seconds step;
+    std::chrono::system_clock::time_point from;
+    std::chrono::system_clock::time_point to;
+};
+
+// Докуда свёрнут каждый уровень кроме базового: бакеты уровня до этой границы
+// уже записаны целиком
+using RollupWatermarks = std::map<std::chrono::seconds, std::chrono::system_clock::time_point>;
+
+std::chrono::system_clock::time_point alignDown(std::chrono::system_clock::time_point tp,
+                                                std::chrono::seconds step);
+std::chrono::system_clock::time_point alignUp(std::chrono::system_clock::time_point tp,
+                                              std::chrono::seconds step);
+
+std::chrono::seconds autoStep(std::chrono::system_clock::time_point from,
+                              std::chrono::system_clock::time_point to);
+
+// Разбивает [from, to) на сегменты по возрастанию времени: середина читается
+// с самого крупного уровня не больше step, а невыровненные края и ещё не свёрнутый
+// хвост — с более мелких уровней
+std::vector<TimeSegment> planResolution(std::chrono::system_clock::time_point from,
+                                        std::chrono::system_clock::time_point to,
+                                        std::chrono::seconds step,
+                                        const RollupWatermarks& rolledUp);
+
+} // namespace aggregation
+
+#endif // ROLLUP_H
@@ -0,0 +1,57 @@
+#ifndef SYMBOL_TABLE_H
+#define SYMBOL_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace aggregation {
+
+using SymbolId = uint32_t;
+
+// Номер пустой строки — "значения нет" (например, событие без user_id)
+inline constexpr SymbolId EMPTY_SYMBOL = 0;
+// Метка выброшенной при compact() строки
+inline constexpr SymbolId INVALID_SYMBOL = std::numeric_limits<SymbolId>::max();
+
+// Словарь строковых идентификаторов событий (проект, страница, пользователь, сессия,
+// элемент, тип ошибки, имя события). MetricsClient переводит строки в плотные номера
+// при чтении, дальше группировка и уникальные считаются по номерам, а строки
+// достаются из словаря только при записи.
+//
+// Рядом с каждой строкой хранится её HyperLogLog::hash: скетч, собранный по номерам,
+// совпадает со скетчем по строкам, а хеш считается один раз на строку, а не на событие.
+// Не потокобезопасен.
+class SymbolTable {
+public:
+    SymbolTable();
+
+    SymbolTable(const SymbolTable&) = delete;
+    SymbolTable& operator=(const SymbolTable&) = delete;
+
+    SymbolId intern(std::string_view value);
+
+    const std::string& str(SymbolId id) const { return strings_[id]; }
+    uint64_t hash(SymbolId id) const { return hashes_[id]; }
+    size_t size() const { return strings_.size(); }
+
+    // Оставляет только строки с live[id] (и пустую), перенумеровывая их подряд.
+    // Возвращает новый номер для каждого старого, INVALID_SYMBOL — для выброшенных;
+    // все, кто держит номера, должны перевести их по этой таблице
+    std::vector<SymbolId> compact(const std::vector<bool>& live);
+
+private:
+    // deque не перемещает элементы при росте: ключи ids_ смотрят в strings_
+    std::deque<std::string> strings_;
+    std::vector<uint64_t> hashes_;
+    std::unordered_map<std::string_view, SymbolId> ids_;
+};
+
+} // namespace aggregation
+
+#endif // SYMBOL_TABLE_H
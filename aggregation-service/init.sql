@@ -4,22 +4,26 @@
 -- Table for aggregated page view events
 CREATE TABLE IF NOT EXISTS agg_page_views (
     id SERIAL PRIMARY KEY,
+    step_seconds INTEGER NOT NULL DEFAULT 60,
     time_bucket TIMESTAMPTZ NOT NULL,
     project_id TEXT NOT NULL,
     page TEXT NOT NULL,
     views_count BIGINT NOT NULL DEFAULT 0,
     unique_users BIGINT DEFAULT 0,
     unique_sessions BIGINT DEFAULT 0,
+    users_hll BYTEA,
+    sessions_hll BYTEA,
     created_at TIMESTAMPTZ NOT NULL DEFAULT NOW(),
-    UNIQUE(time_bucket, project_id, page)
+    UNIQUE(step_seconds, time_bucket, project_id, page)
 );
 
-CREATE INDEX IF NOT EXISTS idx_agg_page_views_time ON agg_page_views(time_bucket);
+CREATE INDEX IF NOT EXISTS idx_agg_page_views_time ON agg_page_views(step_seconds, time_bucket);
 CREATE INDEX IF NOT EXISTS idx_agg_page_views_project ON agg_page_views(project_id, page);
 
 -- Table for aggregated click events
 CREATE TABLE IF NOT EXISTS agg_clicks (
     id SERIAL PRIMARY KEY,
+    step_seconds INTEGER NOT NULL DEFAULT 60,
     time_bucket TIMESTAMPTZ NOT NULL,
     project_id TEXT NOT NULL,
     page TEXT NOT NULL,
@@ -27,16 +31,19 @@ CREATE TABLE IF NOT EXISTS agg_clicks (
     clicks_count BIGINT NOT NULL DEFAULT 0,
     unique_users BIGINT DEFAULT 0,
     unique_sessions BIGINT DEFAULT 0,
+    users_hll BYTEA,
+    sessions_hll BYTEA,
     created_at TIMESTAMPTZ NOT NULL DEFAULT NOW(),
-    UNIQUE(time_bucket, project_id, page, element_id)
+    UNIQUE(step_seconds, time_bucket, project_id, page, element_id)
 );
 
-CREATE INDEX IF NOT EXISTS idx_agg_clicks_time ON agg_clicks(time_bucket);
+CREATE INDEX IF NOT EXISTS idx_agg_clicks_time ON agg_clicks(step_seconds, time_bucket);
 CREATE INDEX IF NOT EXISTS idx_agg_clicks_project ON agg_clicks(project_id, page);
 
 -- Table for aggregated performance metrics
 CREATE TABLE IF NOT EXISTS agg_performance (
     id SERIAL PRIMARY KEY,
+    step_seconds INTEGER NOT NULL DEFAULT 60,
     time_bucket TIMESTAMPTZ NOT NULL,
     project_id TEXT NOT NULL,
     page TEXT NOT NULL,
@@ -49,16 +56,21 @@ CREATE TABLE IF NOT EXISTS agg_performance (
     p95_fcp_ms DOUBLE PRECISION,
     avg_lcp_ms DOUBLE PRECISION,
     p95_lcp_ms DOUBLE PRECISION,
+    total_load_sketch BYTEA,
+    ttfb_sketch BYTEA,
+    fcp_sketch BYTEA,
+    lcp_sketch BYTEA,
     created_at TIMESTAMPTZ NOT NULL DEFAULT NOW(),
-    UNIQUE(time_bucket, project_id, page)
+    UNIQUE(step_seconds, time_bucket, project_id, page)
 );
 
-CREATE INDEX IF NOT EXISTS idx_agg_performance_time ON agg_performance(time_bucket);
+CREATE INDEX IF NOT EXISTS idx_agg_performance_time ON agg_performance(step_seconds, time_bucket);
 CREATE INDEX IF NOT EXISTS idx_agg_performance_project ON agg_performance(project_id, page);
 
 -- Table for aggregated error events
 CREATE TABLE IF NOT EXISTS agg_errors (
     id SERIAL PRIMARY KEY,
+    step_seconds INTEGER NOT NULL DEFAULT 60,
     time_bucket TIMESTAMPTZ NOT NULL,
     project_id TEXT NOT NULL,
     page TEXT NOT NULL,
@@ -67,16 +79,18 @@ CREATE TABLE IF NOT EXISTS agg_errors (
     warning_count BIGINT DEFAULT 0,
     critical_count BIGINT DEFAULT 0,
     unique_users BIGINT DEFAULT 0,
+    users_hll BYTEA,
     created_at TIMESTAMPTZ NOT NULL DEFAULT NOW(),
-    UNIQUE(time_bucket, project_id, page, error_type)
+    UNIQUE(step_seconds, time_bucket, project_id, page, error_type)
 );
 
-CREATE INDEX IF NOT EXISTS idx_agg_errors_time ON agg_errors(time_bucket);
+CREATE INDEX IF NOT EXISTS idx_agg_errors_time ON agg_errors(step_seconds, time_bucket);
 CREATE INDEX IF NOT EXISTS idx_agg_errors_project ON agg_errors(project_id, page);
 
 -- Table for aggregated custom events
 CREATE TABLE IF NOT EXISTS agg_custom_events (
     id SERIAL PRIMARY KEY,
+    step_seconds INTEGER NOT NULL DEFAULT 60,
     time_bucket TIMESTAMPTZ NOT NULL,
     project_id TEXT NOT NULL,
     event_name TEXT NOT NULL,
@@ -84,13 +98,85 @@ CREATE TABLE IF NOT EXISTS agg_custom_events (
     events_count BIGINT NOT NULL DEFAULT 0,
     unique_users BIGINT DEFAULT 0,
     unique_sessions BIGINT DEFAULT 0,
+    users_hll BYTEA,
+    sessions_hll BYTEA,
     created_at TIMESTAMPTZ NOT NULL DEFAULT NOW(),
-    UNIQUE(time_bucket, project_id, event_name, page)
+    UNIQUE(step_seconds, time_bucket, project_id, event_name, page)
 );
 
-CREATE INDEX IF NOT EXISTS idx_agg_custom_events_time ON agg_custom_events(time_bucket);
+CREATE INDEX IF NOT EXISTS idx_agg_custom_events_time ON agg_custom_events(step_seconds, time_bucket);
 CREATE INDEX IF NOT EXISTS idx_agg_custom_events_project ON agg_custom_events(project_id, event_name);
 
+-- HyperLogLog sketches (users_hll, sessions_hll)
+-- Dense format: 1 precision byte followed by 2^precision one-byte registers.
+-- Sparse format (few visitors): 0x80 | precision, then ascending big-endian
+-- uint64 hashes. Sketches are merged and estimated by aggregation-service
+-- (HyperLogLog in hyperloglog.cpp), the database only stores them.
+DROP AGGREGATE IF EXISTS hll_union_agg(BYTEA);
+DROP FUNCTION IF EXISTS hll_cardinality(BYTEA);
+DROP FUNCTION IF EXISTS hll_merge(BYTEA, BYTEA);
+
+-- DDSketch quantile sketches (*_sketch in agg_performance)
+-- Format: 1 version byte followed by non-empty bins in ascending index order,
+-- each bin is an int4 index and an int8 count (big-endian).
+-- Bin i covers (gamma^(i-1), gamma^i], gamma = 1.01 / 0.99 (1% relative error).
+-- Sketches are merged by adding bin counts.
+
+CREATE OR REPLACE FUNCTION ddsketch_bins(sketch BYTEA) RETURNS TABLE(idx INTEGER, cnt BIGINT) AS $$
+    SELECT ('x' || encode(substring(sketch FROM 2 + i * 12 FOR 4), 'hex'))::BIT(32)::INTEGER,
+           ('x' || encode(substring(sketch FROM 6 + i * 12 FOR 8), 'hex'))::BIT(64)::BIGINT
+    FROM generate_series(0, (length(sketch) - 1) / 12 - 1) AS i
+$$ LANGUAGE sql IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION ddsketch_merge(a BYTEA, b BYTEA) RETURNS BYTEA AS $$
+BEGIN
+    IF a IS NULL THEN
+        RETURN b;
+    END IF;
+    IF b IS NULL THEN
+        RETURN a;
+    END IF;
+    IF get_byte(a, 0) <> get_byte(b, 0) THEN
+        RAISE EXCEPTION 'ddsketch_merge: sketches have different format versions';
+    END IF;
+
+    RETURN substring(a FROM 1 FOR 1) || (
+        SELECT COALESCE(string_agg(int4send(idx) || int8send(cnt), ''::BYTEA ORDER BY idx), ''::BYTEA)
+        FROM (
+            SELECT idx, sum(cnt)::BIGINT AS cnt
+            FROM (SELECT * FROM ddsketch_bins(a) UNION ALL SELECT * FROM ddsketch_bins(b)) AS bins
+            GROUP BY idx
+        ) AS merged
+    );
+END;
+$$ LANGUAGE plpgsql IMMUTABLE PARALLEL SAFE;
+
+CREATE OR REPLACE FUNCTION ddsketch_count(sketch BYTEA) RETURNS BIGINT AS $$
+    SELECT COALESCE(sum(cnt), 0)::BIGINT FROM ddsketch_bins(sketch)
+$$ LANGUAGE sql IMMUTABLE STRICT PARALLEL SAFE;
+
+-- Same rank rule as DDSketch::quantile() in aggregation-service
+CREATE OR REPLACE FUNCTION ddsketch_quantile(sketch BYTEA, q DOUBLE PRECISION) RETURNS DOUBLE PRECISION AS $$
+    WITH bins AS (
+        SELECT idx,
+               sum(cnt) OVER (ORDER BY idx) AS cumulative,
+               sum(cnt) OVER () AS total
+        FROM ddsketch_bins(sketch)
+    )
+    SELECT 2 * power(101.0::DOUBLE PRECISION / 99.0, idx) / (101.0::DOUBLE PRECISION / 99.0 + 1)
+    FROM bins
+    WHERE cumulative > greatest(0.0, least(1.0, q)) * (total - 1)
+    ORDER BY idx
+    LIMIT 1
+$$ LANGUAGE sql IMMUTABLE STRICT PARALLEL SAFE;
+
+CREATE OR REPLACE AGGREGATE ddsketch_union_agg(BYTEA) (
+    SFUNC = ddsketch_merge,
+    STYPE = BYTEA,
+    COMBINEFUNC = ddsketch_merge,
+    PARALLEL = SAFE
+);
+
 -- Watermark table for tracking aggregation progress
 CREATE TABLE IF NOT EXISTS aggregation_watermark (
     id INTEGER PRIMARY KEY,
@@ -102,3 +188,51 @@ INSERT INTO aggregation_watermark (id, last_aggregated_at)
 VALUES (1, '1970-01-01T00:00:00Z')
 ON CONFLICT (id) DO NOTHING;
 
+-- One row per committed aggregation window. The row is inserted in the same
+-- transaction as the window's aggregates and the watermark advance, so a retried
+-- commit of the same window is detected and skipped instead of double-counting
+CREATE TABLE IF NOT EXISTS aggregation_commit_log (
+    window_from TIMESTAMPTZ NOT NULL,
+    window_to TIMESTAMPTZ NOT NULL,
+    rows_written BIGINT NOT NULL DEFAULT 0,
+    committed_at TIMESTAMPTZ NOT NULL DEFAULT NOW(),
+    PRIMARY KEY (window_from, window_to)
+);
+
+-- Rollup progress per resolution: buckets of step_seconds before rolled_up_until
+-- have been derived from the next finer level (60s rows come from raw events)
+CREATE TABLE IF NOT EXISTS aggregation_rollup_watermark (
+    step_seconds INTEGER PRIMARY KEY,
+    rolled_up_until TIMESTAMPTZ NOT NULL
+);
+
+INSERT INTO aggregation_rollup_watermark (step_seconds, rolled_up_until)
+VALUES (300, '1970-01-01T00:00:00Z'),
+       (3600, '1970-01-01T00:00:00Z'),
+       (86400, '1970-01-01T00:00:00Z')
+ON CONFLICT (step_seconds) DO NOTHING;
+
+-- Events that arrived later than the allowed lateness (AGG_ALLOWED_LATENESS_SEC):
+-- their buckets are not re-aggregated. Rows are written in the same transaction
+-- as the aggregation window, so they can be folded in out of band later.
+-- detail is element_id, error_type or the custom event name
+CREATE TABLE IF NOT EXISTS late_events (
+    id BIGSERIAL PRIMARY KEY,
+    event_type TEXT NOT NULL,
+    project_id TEXT NOT NULL,
+    page TEXT,
+    detail TEXT,
+    user_id TEXT,
+    session_id TEXT,
+    severity INTEGER,
+    total_page_load_ms DOUBLE PRECISION,
+    ttfb_ms DOUBLE PRECISION,
+    fcp_ms DOUBLE PRECISION,
+    lcp_ms DOUBLE PRECISION,
+    event_time TIMESTAMPTZ NOT NULL,
+    received_at TIMESTAMPTZ NOT NULL,
+    recorded_at TIMESTAMPTZ NOT NULL DEFAULT NOW()
+);
+
+CREATE INDEX IF NOT EXISTS idx_late_events_time ON late_events(project_id, event_time);
+
@@ -29,6 +29,7 @@ static const char* AggregationService_method_names[] = {
   "/metricsys.aggregation.AggregationService/GetPerformanceAgg",
   "/metricsys.aggregation.AggregationService/GetErrorsAgg",
   "/metricsys.aggregation.AggregationService/GetCustomEventsAgg",
+  "/metricsys.aggregation.AggregationService/GetUniquesAgg",
 };
 
 std::unique_ptr< AggregationService::Stub> AggregationService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -44,6 +45,7 @@ AggregationService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>&
   , rpcmethod_GetPerformanceAgg_(AggregationService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetErrorsAgg_(AggregationService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetCustomEventsAgg_(AggregationService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetUniquesAgg_(AggregationService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status AggregationService::Stub::GetWatermark(::grpc::ClientContext* context, const ::metricsys::aggregation::GetWatermarkRequest& request, ::metricsys::aggregation::GetWatermarkResponse* response) {
@@ -184,6 +186,29 @@ void AggregationService::Stub::async::GetCustomEventsAgg(::grpc::ClientContext*
   return result;
 }
 
+::grpc::Status AggregationService::Stub::GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::metricsys::aggregation::GetUniquesAggResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::metricsys::aggregation::GetUniquesAggRequest, ::metricsys::aggregation::GetUniquesAggResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetUniquesAgg_, context, request, response);
+}
+
+void AggregationService::Stub::async::GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::metricsys::aggregation::GetUniquesAggRequest, ::metricsys::aggregation::GetUniquesAggResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetUniquesAgg_, context, request, response, std::move(f));
+}
+
+void AggregationService::Stub::async::GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_GetUniquesAgg_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetUniquesAggResponse>* AggregationService::Stub::PrepareAsyncGetUniquesAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::metricsys::aggregation::GetUniquesAggResponse, ::metricsys::aggregation::GetUniquesAggRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_GetUniquesAgg_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetUniquesAggResponse>* AggregationService::Stub::AsyncGetUniquesAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncGetUniquesAggRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 AggregationService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       AggregationService_method_names[0],
@@ -245,6 +270,16 @@ AggregationService::Service::Service() {
              ::metricsys::aggregation::GetCustomEventsAggResponse* resp) {
                return service->GetCustomEventsAgg(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      AggregationService_method_names[6],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< AggregationService::Service, ::metricsys::aggregation::GetUniquesAggRequest, ::metricsys::aggregation::GetUniquesAggResponse, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](AggregationService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::metricsys::aggregation::GetUniquesAggRequest* req,
+             ::metricsys::aggregation::GetUniquesAggResponse* resp) {
+               return service->GetUniquesAgg(ctx, req, resp);
+             }, this)));
 }
 
 AggregationService::Service::~Service() {
@@ -292,6 +327,13 @@ AggregationService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status AggregationService::Service::GetUniquesAgg(::grpc::ServerContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace metricsys
 }  // namespace aggregation
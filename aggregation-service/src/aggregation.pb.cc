@@ -83,6 +83,7 @@ PROTOBUF_CONSTEXPR AggPageViewsRow::AggPageViewsRow(
   , /*decltype(_impl_.views_count_)*/int64_t{0}
   , /*decltype(_impl_.unique_users_)*/int64_t{0}
   , /*decltype(_impl_.unique_sessions_)*/int64_t{0}
+  , /*decltype(_impl_.step_seconds_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct AggPageViewsRowDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AggPageViewsRowDefaultTypeInternal()
@@ -100,7 +101,8 @@ PROTOBUF_CONSTEXPR GetPageViewsAggRequest::GetPageViewsAggRequest(
   , /*decltype(_impl_.project_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.step_seconds_)*/0u} {}
 struct GetPageViewsAggRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetPageViewsAggRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -134,7 +136,8 @@ PROTOBUF_CONSTEXPR AggClicksRow::AggClicksRow(
   , /*decltype(_impl_.created_at_)*/nullptr
   , /*decltype(_impl_.clicks_count_)*/int64_t{0}
   , /*decltype(_impl_.unique_users_)*/int64_t{0}
-  , /*decltype(_impl_.unique_sessions_)*/int64_t{0}} {}
+  , /*decltype(_impl_.unique_sessions_)*/int64_t{0}
+  , /*decltype(_impl_.step_seconds_)*/0u} {}
 struct AggClicksRowDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AggClicksRowDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -152,7 +155,8 @@ PROTOBUF_CONSTEXPR GetClicksAggRequest::GetClicksAggRequest(
   , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.element_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.step_seconds_)*/0u} {}
 struct GetClicksAggRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetClicksAggRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -175,9 +179,27 @@ struct GetClicksAggResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetClicksAggResponseDefaultTypeInternal _GetClicksAggResponse_default_instance_;
+PROTOBUF_CONSTEXPR PerformanceQuantile::PerformanceQuantile(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.quantile_)*/0
+  , /*decltype(_impl_.total_load_ms_)*/0
+  , /*decltype(_impl_.ttfb_ms_)*/0
+  , /*decltype(_impl_.fcp_ms_)*/0
+  , /*decltype(_impl_.lcp_ms_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PerformanceQuantileDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PerformanceQuantileDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PerformanceQuantileDefaultTypeInternal() {}
+  union {
+    PerformanceQuantile _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PerformanceQuantileDefaultTypeInternal _PerformanceQuantile_default_instance_;
 PROTOBUF_CONSTEXPR AggPerformanceRow::AggPerformanceRow(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.project_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+    /*decltype(_impl_.quantiles_)*/{}
+  , /*decltype(_impl_.project_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_bucket_)*/nullptr
   , /*decltype(_impl_.created_at_)*/nullptr
@@ -190,6 +212,7 @@ PROTOBUF_CONSTEXPR AggPerformanceRow::AggPerformanceRow(
   , /*decltype(_impl_.p95_fcp_ms_)*/0
   , /*decltype(_impl_.avg_lcp_ms_)*/0
   , /*decltype(_impl_.p95_lcp_ms_)*/0
+  , /*decltype(_impl_.step_seconds_)*/0u
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct AggPerformanceRowDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AggPerformanceRowDefaultTypeInternal()
@@ -204,10 +227,13 @@ PROTOBUF_CONSTEXPR GetPerformanceAggRequest::GetPerformanceAggRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
   , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.quantiles_)*/{}
   , /*decltype(_impl_.project_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.merge_buckets_)*/false
+  , /*decltype(_impl_.step_seconds_)*/0u} {}
 struct GetPerformanceAggRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetPerformanceAggRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -242,7 +268,8 @@ PROTOBUF_CONSTEXPR AggErrorsRow::AggErrorsRow(
   , /*decltype(_impl_.errors_count_)*/int64_t{0}
   , /*decltype(_impl_.warning_count_)*/int64_t{0}
   , /*decltype(_impl_.critical_count_)*/int64_t{0}
-  , /*decltype(_impl_.unique_users_)*/int64_t{0}} {}
+  , /*decltype(_impl_.unique_users_)*/int64_t{0}
+  , /*decltype(_impl_.step_seconds_)*/0u} {}
 struct AggErrorsRowDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AggErrorsRowDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -260,7 +287,8 @@ PROTOBUF_CONSTEXPR GetErrorsAggRequest::GetErrorsAggRequest(
   , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.error_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.step_seconds_)*/0u} {}
 struct GetErrorsAggRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetErrorsAggRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -294,7 +322,8 @@ PROTOBUF_CONSTEXPR AggCustomEventsRow::AggCustomEventsRow(
   , /*decltype(_impl_.created_at_)*/nullptr
   , /*decltype(_impl_.events_count_)*/int64_t{0}
   , /*decltype(_impl_.unique_users_)*/int64_t{0}
-  , /*decltype(_impl_.unique_sessions_)*/int64_t{0}} {}
+  , /*decltype(_impl_.unique_sessions_)*/int64_t{0}
+  , /*decltype(_impl_.step_seconds_)*/0u} {}
 struct AggCustomEventsRowDefaultTypeInternal {
   PROTOBUF_CONSTEXPR AggCustomEventsRowDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -312,7 +341,8 @@ PROTOBUF_CONSTEXPR GetCustomEventsAggRequest::GetCustomEventsAggRequest(
   , /*decltype(_impl_.event_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.step_seconds_)*/0u} {}
 struct GetCustomEventsAggRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetCustomEventsAggRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -335,10 +365,45 @@ struct GetCustomEventsAggResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetCustomEventsAggResponseDefaultTypeInternal _GetCustomEventsAggResponse_default_instance_;
+PROTOBUF_CONSTEXPR GetUniquesAggRequest::GetUniquesAggRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.project_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.element_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.event_name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_range_)*/nullptr
+  , /*decltype(_impl_.source_)*/0} {}
+struct GetUniquesAggRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetUniquesAggRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetUniquesAggRequestDefaultTypeInternal() {}
+  union {
+    GetUniquesAggRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUniquesAggRequestDefaultTypeInternal _GetUniquesAggRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetUniquesAggResponse::GetUniquesAggResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.unique_users_)*/int64_t{0}
+  , /*decltype(_impl_.unique_sessions_)*/int64_t{0}
+  , /*decltype(_impl_.buckets_count_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GetUniquesAggResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetUniquesAggResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetUniquesAggResponseDefaultTypeInternal() {}
+  union {
+    GetUniquesAggResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetUniquesAggResponseDefaultTypeInternal _GetUniquesAggResponse_default_instance_;
 }  // namespace aggregation
 }  // namespace metricsys
-static ::_pb::Metadata file_level_metadata_aggregation_2eproto[19];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_aggregation_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_aggregation_2eproto[22];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_aggregation_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_aggregation_2eproto = nullptr;
 
 const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -384,6 +449,7 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPageViewsRow, _impl_.unique_users_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPageViewsRow, _impl_.unique_sessions_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPageViewsRow, _impl_.created_at_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPageViewsRow, _impl_.step_seconds_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPageViewsAggRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPageViewsAggRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -394,10 +460,12 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPageViewsAggRequest, _impl_.time_range_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPageViewsAggRequest, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPageViewsAggRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPageViewsAggRequest, _impl_.step_seconds_),
   ~0u,
   ~0u,
   0,
   ~0u,
+  ~0u,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPageViewsAggResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -419,6 +487,7 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggClicksRow, _impl_.unique_users_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggClicksRow, _impl_.unique_sessions_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggClicksRow, _impl_.created_at_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggClicksRow, _impl_.step_seconds_),
   ~0u,
   ~0u,
   ~0u,
@@ -427,6 +496,7 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,
   ~0u,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetClicksAggRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetClicksAggRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -438,11 +508,13 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetClicksAggRequest, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetClicksAggRequest, _impl_.element_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetClicksAggRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetClicksAggRequest, _impl_.step_seconds_),
   ~0u,
   ~0u,
   0,
   1,
   ~0u,
+  ~0u,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetClicksAggResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -451,6 +523,17 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetClicksAggResponse, _impl_.rows_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::PerformanceQuantile, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::PerformanceQuantile, _impl_.quantile_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::PerformanceQuantile, _impl_.total_load_ms_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::PerformanceQuantile, _impl_.ttfb_ms_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::PerformanceQuantile, _impl_.fcp_ms_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::PerformanceQuantile, _impl_.lcp_ms_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPerformanceRow, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -469,6 +552,8 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPerformanceRow, _impl_.avg_lcp_ms_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPerformanceRow, _impl_.p95_lcp_ms_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPerformanceRow, _impl_.created_at_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPerformanceRow, _impl_.quantiles_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggPerformanceRow, _impl_.step_seconds_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -479,10 +564,16 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggRequest, _impl_.time_range_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggRequest, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggRequest, _impl_.quantiles_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggRequest, _impl_.merge_buckets_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggRequest, _impl_.step_seconds_),
   ~0u,
   ~0u,
   0,
   ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetPerformanceAggResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -505,6 +596,7 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggErrorsRow, _impl_.critical_count_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggErrorsRow, _impl_.unique_users_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggErrorsRow, _impl_.created_at_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggErrorsRow, _impl_.step_seconds_),
   ~0u,
   ~0u,
   ~0u,
@@ -514,6 +606,7 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,
   ~0u,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetErrorsAggRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetErrorsAggRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -525,11 +618,13 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetErrorsAggRequest, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetErrorsAggRequest, _impl_.error_type_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetErrorsAggRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetErrorsAggRequest, _impl_.step_seconds_),
   ~0u,
   ~0u,
   0,
   1,
   ~0u,
+  ~0u,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetErrorsAggResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -551,6 +646,7 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggCustomEventsRow, _impl_.unique_users_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggCustomEventsRow, _impl_.unique_sessions_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggCustomEventsRow, _impl_.created_at_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::AggCustomEventsRow, _impl_.step_seconds_),
   ~0u,
   ~0u,
   ~0u,
@@ -559,6 +655,7 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,
   ~0u,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetCustomEventsAggRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetCustomEventsAggRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -570,11 +667,13 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetCustomEventsAggRequest, _impl_.event_name_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetCustomEventsAggRequest, _impl_.page_),
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetCustomEventsAggRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetCustomEventsAggRequest, _impl_.step_seconds_),
   ~0u,
   ~0u,
   ~0u,
   0,
   ~0u,
+  ~0u,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetCustomEventsAggResponse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -582,6 +681,35 @@ const uint32_t TableStruct_aggregation_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetCustomEventsAggResponse, _impl_.rows_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _impl_.project_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _impl_.time_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _impl_.source_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _impl_.page_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _impl_.element_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _impl_.error_type_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggRequest, _impl_.event_name_),
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  1,
+  2,
+  3,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggResponse, _impl_.unique_users_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggResponse, _impl_.unique_sessions_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::aggregation::GetUniquesAggResponse, _impl_.buckets_count_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::metricsys::aggregation::TimeRange)},
@@ -589,20 +717,23 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 16, -1, -1, sizeof(::metricsys::aggregation::GetWatermarkRequest)},
   { 22, -1, -1, sizeof(::metricsys::aggregation::GetWatermarkResponse)},
   { 29, -1, -1, sizeof(::metricsys::aggregation::AggPageViewsRow)},
-  { 42, 52, -1, sizeof(::metricsys::aggregation::GetPageViewsAggRequest)},
-  { 56, -1, -1, sizeof(::metricsys::aggregation::GetPageViewsAggResponse)},
-  { 63, 77, -1, sizeof(::metricsys::aggregation::AggClicksRow)},
-  { 85, 96, -1, sizeof(::metricsys::aggregation::GetClicksAggRequest)},
-  { 101, -1, -1, sizeof(::metricsys::aggregation::GetClicksAggResponse)},
-  { 108, -1, -1, sizeof(::metricsys::aggregation::AggPerformanceRow)},
-  { 127, 137, -1, sizeof(::metricsys::aggregation::GetPerformanceAggRequest)},
-  { 141, -1, -1, sizeof(::metricsys::aggregation::GetPerformanceAggResponse)},
-  { 148, 163, -1, sizeof(::metricsys::aggregation::AggErrorsRow)},
-  { 172, 183, -1, sizeof(::metricsys::aggregation::GetErrorsAggRequest)},
-  { 188, -1, -1, sizeof(::metricsys::aggregation::GetErrorsAggResponse)},
-  { 195, 209, -1, sizeof(::metricsys::aggregation::AggCustomEventsRow)},
-  { 217, 228, -1, sizeof(::metricsys::aggregation::GetCustomEventsAggRequest)},
-  { 233, -1, -1, sizeof(::metricsys::aggregation::GetCustomEventsAggResponse)},
+  { 43, 54, -1, sizeof(::metricsys::aggregation::GetPageViewsAggRequest)},
+  { 59, -1, -1, sizeof(::metricsys::aggregation::GetPageViewsAggResponse)},
+  { 66, 81, -1, sizeof(::metricsys::aggregation::AggClicksRow)},
+  { 90, 102, -1, sizeof(::metricsys::aggregation::GetClicksAggRequest)},
+  { 108, -1, -1, sizeof(::metricsys::aggregation::GetClicksAggResponse)},
+  { 115, -1, -1, sizeof(::metricsys::aggregation::PerformanceQuantile)},
+  { 126, -1, -1, sizeof(::metricsys::aggregation::AggPerformanceRow)},
+  { 147, 160, -1, sizeof(::metricsys::aggregation::GetPerformanceAggRequest)},
+  { 167, -1, -1, sizeof(::metricsys::aggregation::GetPerformanceAggResponse)},
+  { 174, 190, -1, sizeof(::metricsys::aggregation::AggErrorsRow)},
+  { 200, 212, -1, sizeof(::metricsys::aggregation::GetErrorsAggRequest)},
+  { 218, -1, -1, sizeof(::metricsys::aggregation::GetErrorsAggResponse)},
+  { 225, 240, -1, sizeof(::metricsys::aggregation::AggCustomEventsRow)},
+  { 249, 261, -1, sizeof(::metricsys::aggregation::GetCustomEventsAggRequest)},
+  { 267, -1, -1, sizeof(::metricsys::aggregation::GetCustomEventsAggResponse)},
+  { 274, 287, -1, sizeof(::metricsys::aggregation::GetUniquesAggRequest)},
+  { 294, -1, -1, sizeof(::metricsys::aggregation::GetUniquesAggResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -616,6 +747,7 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::metricsys::aggregation::_AggClicksRow_default_instance_._instance,
   &::metricsys::aggregation::_GetClicksAggRequest_default_instance_._instance,
   &::metricsys::aggregation::_GetClicksAggResponse_default_instance_._instance,
+  &::metricsys::aggregation::_PerformanceQuantile_default_instance_._instance,
   &::metricsys::aggregation::_AggPerformanceRow_default_instance_._instance,
   &::metricsys::aggregation::_GetPerformanceAggRequest_default_instance_._instance,
   &::metricsys::aggregation::_GetPerformanceAggResponse_default_instance_._instance,
@@ -625,6 +757,8 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::metricsys::aggregation::_AggCustomEventsRow_default_instance_._instance,
   &::metricsys::aggregation::_GetCustomEventsAggRequest_default_instance_._instance,
   &::metricsys::aggregation::_GetCustomEventsAggResponse_default_instance_._instance,
+  &::metricsys::aggregation::_GetUniquesAggRequest_default_instance_._instance,
+  &::metricsys::aggregation::_GetUniquesAggResponse_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_aggregation_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -635,104 +769,131 @@ const char descriptor_table_protodef_aggregation_2eproto[] PROTOBUF_SECTION_VARI
   ".Timestamp\"+\n\nPagination\022\r\n\005limit\030\001 \001(\r\022"
   "\016\n\006offset\030\002 \001(\r\"\025\n\023GetWatermarkRequest\"N"
   "\n\024GetWatermarkResponse\0226\n\022last_aggregate"
-  "d_at\030\001 \001(\0132\032.google.protobuf.Timestamp\"\330"
+  "d_at\030\001 \001(\0132\032.google.protobuf.Timestamp\"\356"
   "\001\n\017AggPageViewsRow\022/\n\013time_bucket\030\001 \001(\0132"
   "\032.google.protobuf.Timestamp\022\022\n\nproject_i"
   "d\030\002 \001(\t\022\014\n\004page\030\003 \001(\t\022\023\n\013views_count\030\004 \001"
   "(\003\022\024\n\014unique_users\030\005 \001(\003\022\027\n\017unique_sessi"
   "ons\030\006 \001(\003\022.\n\ncreated_at\030\007 \001(\0132\032.google.p"
-  "rotobuf.Timestamp\"\265\001\n\026GetPageViewsAggReq"
-  "uest\022\022\n\nproject_id\030\001 \001(\t\0224\n\ntime_range\030\002"
-  " \001(\0132 .metricsys.aggregation.TimeRange\022\021"
-  "\n\004page\030\003 \001(\tH\000\210\001\001\0225\n\npagination\030\004 \001(\0132!."
-  "metricsys.aggregation.PaginationB\007\n\005_pag"
-  "e\"O\n\027GetPageViewsAggResponse\0224\n\004rows\030\001 \003"
-  "(\0132&.metricsys.aggregation.AggPageViewsR"
-  "ow\"\376\001\n\014AggClicksRow\022/\n\013time_bucket\030\001 \001(\013"
-  "2\032.google.protobuf.Timestamp\022\022\n\nproject_"
-  "id\030\002 \001(\t\022\014\n\004page\030\003 \001(\t\022\027\n\nelement_id\030\004 \001"
-  "(\tH\000\210\001\001\022\024\n\014clicks_count\030\005 \001(\003\022\024\n\014unique_"
-  "users\030\006 \001(\003\022\027\n\017unique_sessions\030\007 \001(\003\022.\n\n"
-  "created_at\030\010 \001(\0132\032.google.protobuf.Times"
-  "tampB\r\n\013_element_id\"\332\001\n\023GetClicksAggRequ"
-  "est\022\022\n\nproject_id\030\001 \001(\t\0224\n\ntime_range\030\002 "
-  "\001(\0132 .metricsys.aggregation.TimeRange\022\021\n"
-  "\004page\030\003 \001(\tH\000\210\001\001\022\027\n\nelement_id\030\004 \001(\tH\001\210\001"
-  "\001\0225\n\npagination\030\005 \001(\0132!.metricsys.aggreg"
-  "ation.PaginationB\007\n\005_pageB\r\n\013_element_id"
-  "\"I\n\024GetClicksAggResponse\0221\n\004rows\030\001 \003(\0132#"
-  ".metricsys.aggregation.AggClicksRow\"\335\002\n\021"
-  "AggPerformanceRow\022/\n\013time_bucket\030\001 \001(\0132\032"
-  ".google.protobuf.Timestamp\022\022\n\nproject_id"
-  "\030\002 \001(\t\022\014\n\004page\030\003 \001(\t\022\025\n\rsamples_count\030\004 "
-  "\001(\003\022\031\n\021avg_total_load_ms\030\005 \001(\001\022\031\n\021p95_to"
-  "tal_load_ms\030\006 \001(\001\022\023\n\013avg_ttfb_ms\030\007 \001(\001\022\023"
-  "\n\013p95_ttfb_ms\030\010 \001(\001\022\022\n\navg_fcp_ms\030\t \001(\001\022"
-  "\022\n\np95_fcp_ms\030\n \001(\001\022\022\n\navg_lcp_ms\030\013 \001(\001\022"
-  "\022\n\np95_lcp_ms\030\014 \001(\001\022.\n\ncreated_at\030\r \001(\0132"
-  "\032.google.protobuf.Timestamp\"\267\001\n\030GetPerfo"
-  "rmanceAggRequest\022\022\n\nproject_id\030\001 \001(\t\0224\n\n"
+  "rotobuf.Timestamp\022\024\n\014step_seconds\030\010 \001(\r\""
+  "\313\001\n\026GetPageViewsAggRequest\022\022\n\nproject_id"
+  "\030\001 \001(\t\0224\n\ntime_range\030\002 \001(\0132 .metricsys.a"
+  "ggregation.TimeRange\022\021\n\004page\030\003 \001(\tH\000\210\001\001\022"
+  "5\n\npagination\030\004 \001(\0132!.metricsys.aggregat"
+  "ion.Pagination\022\024\n\014step_seconds\030\005 \001(\rB\007\n\005"
+  "_page\"O\n\027GetPageViewsAggResponse\0224\n\004rows"
+  "\030\001 \003(\0132&.metricsys.aggregation.AggPageVi"
+  "ewsRow\"\224\002\n\014AggClicksRow\022/\n\013time_bucket\030\001"
+  " \001(\0132\032.google.protobuf.Timestamp\022\022\n\nproj"
+  "ect_id\030\002 \001(\t\022\014\n\004page\030\003 \001(\t\022\027\n\nelement_id"
+  "\030\004 \001(\tH\000\210\001\001\022\024\n\014clicks_count\030\005 \001(\003\022\024\n\014uni"
+  "que_users\030\006 \001(\003\022\027\n\017unique_sessions\030\007 \001(\003"
+  "\022.\n\ncreated_at\030\010 \001(\0132\032.google.protobuf.T"
+  "imestamp\022\024\n\014step_seconds\030\t \001(\rB\r\n\013_eleme"
+  "nt_id\"\360\001\n\023GetClicksAggRequest\022\022\n\nproject"
+  "_id\030\001 \001(\t\0224\n\ntime_range\030\002 \001(\0132 .metricsy"
+  "s.aggregation.TimeRange\022\021\n\004page\030\003 \001(\tH\000\210"
+  "\001\001\022\027\n\nelement_id\030\004 \001(\tH\001\210\001\001\0225\n\npaginatio"
+  "n\030\005 \001(\0132!.metricsys.aggregation.Paginati"
+  "on\022\024\n\014step_seconds\030\006 \001(\rB\007\n\005_pageB\r\n\013_el"
+  "ement_id\"I\n\024GetClicksAggResponse\0221\n\004rows"
+  "\030\001 \003(\0132#.metricsys.aggregation.AggClicks"
+  "Row\"o\n\023PerformanceQuantile\022\020\n\010quantile\030\001"
+  " \001(\001\022\025\n\rtotal_load_ms\030\002 \001(\001\022\017\n\007ttfb_ms\030\003"
+  " \001(\001\022\016\n\006fcp_ms\030\004 \001(\001\022\016\n\006lcp_ms\030\005 \001(\001\"\262\003\n"
+  "\021AggPerformanceRow\022/\n\013time_bucket\030\001 \001(\0132"
+  "\032.google.protobuf.Timestamp\022\022\n\nproject_i"
+  "d\030\002 \001(\t\022\014\n\004page\030\003 \001(\t\022\025\n\rsamples_count\030\004"
+  " \001(\003\022\031\n\021avg_total_load_ms\030\005 \001(\001\022\031\n\021p95_t"
+  "otal_load_ms\030\006 \001(\001\022\023\n\013avg_ttfb_ms\030\007 \001(\001\022"
+  "\023\n\013p95_ttfb_ms\030\010 \001(\001\022\022\n\navg_fcp_ms\030\t \001(\001"
+  "\022\022\n\np95_fcp_ms\030\n \001(\001\022\022\n\navg_lcp_ms\030\013 \001(\001"
+  "\022\022\n\np95_lcp_ms\030\014 \001(\001\022.\n\ncreated_at\030\r \001(\013"
+  "2\032.google.protobuf.Timestamp\022=\n\tquantile"
+  "s\030\016 \003(\0132*.metricsys.aggregation.Performa"
+  "nceQuantile\022\024\n\014step_seconds\030\017 \001(\r\"\367\001\n\030Ge"
+  "tPerformanceAggRequest\022\022\n\nproject_id\030\001 \001"
+  "(\t\0224\n\ntime_range\030\002 \001(\0132 .metricsys.aggre"
+  "gation.TimeRange\022\021\n\004page\030\003 \001(\tH\000\210\001\001\0225\n\np"
+  "agination\030\004 \001(\0132!.metricsys.aggregation."
+  "Pagination\022\021\n\tquantiles\030\005 \003(\001\022\025\n\rmerge_b"
+  "uckets\030\006 \001(\010\022\024\n\014step_seconds\030\007 \001(\rB\007\n\005_p"
+  "age\"S\n\031GetPerformanceAggResponse\0226\n\004rows"
+  "\030\001 \003(\0132(.metricsys.aggregation.AggPerfor"
+  "manceRow\"\252\002\n\014AggErrorsRow\022/\n\013time_bucket"
+  "\030\001 \001(\0132\032.google.protobuf.Timestamp\022\022\n\npr"
+  "oject_id\030\002 \001(\t\022\014\n\004page\030\003 \001(\t\022\027\n\nerror_ty"
+  "pe\030\004 \001(\tH\000\210\001\001\022\024\n\014errors_count\030\005 \001(\003\022\025\n\rw"
+  "arning_count\030\006 \001(\003\022\026\n\016critical_count\030\007 \001"
+  "(\003\022\024\n\014unique_users\030\010 \001(\003\022.\n\ncreated_at\030\t"
+  " \001(\0132\032.google.protobuf.Timestamp\022\024\n\014step"
+  "_seconds\030\n \001(\rB\r\n\013_error_type\"\360\001\n\023GetErr"
+  "orsAggRequest\022\022\n\nproject_id\030\001 \001(\t\0224\n\ntim"
+  "e_range\030\002 \001(\0132 .metricsys.aggregation.Ti"
+  "meRange\022\021\n\004page\030\003 \001(\tH\000\210\001\001\022\027\n\nerror_type"
+  "\030\004 \001(\tH\001\210\001\001\0225\n\npagination\030\005 \001(\0132!.metric"
+  "sys.aggregation.Pagination\022\024\n\014step_secon"
+  "ds\030\006 \001(\rB\007\n\005_pageB\r\n\013_error_type\"I\n\024GetE"
+  "rrorsAggResponse\0221\n\004rows\030\001 \003(\0132#.metrics"
+  "ys.aggregation.AggErrorsRow\"\224\002\n\022AggCusto"
+  "mEventsRow\022/\n\013time_bucket\030\001 \001(\0132\032.google"
+  ".protobuf.Timestamp\022\022\n\nproject_id\030\002 \001(\t\022"
+  "\022\n\nevent_name\030\003 \001(\t\022\021\n\004page\030\004 \001(\tH\000\210\001\001\022\024"
+  "\n\014events_count\030\005 \001(\003\022\024\n\014unique_users\030\006 \001"
+  "(\003\022\027\n\017unique_sessions\030\007 \001(\003\022.\n\ncreated_a"
+  "t\030\010 \001(\0132\032.google.protobuf.Timestamp\022\024\n\014s"
+  "tep_seconds\030\t \001(\rB\007\n\005_page\"\342\001\n\031GetCustom"
+  "EventsAggRequest\022\022\n\nproject_id\030\001 \001(\t\0224\n\n"
   "time_range\030\002 \001(\0132 .metricsys.aggregation"
-  ".TimeRange\022\021\n\004page\030\003 \001(\tH\000\210\001\001\0225\n\npaginat"
-  "ion\030\004 \001(\0132!.metricsys.aggregation.Pagina"
-  "tionB\007\n\005_page\"S\n\031GetPerformanceAggRespon"
-  "se\0226\n\004rows\030\001 \003(\0132(.metricsys.aggregation"
-  ".AggPerformanceRow\"\224\002\n\014AggErrorsRow\022/\n\013t"
-  "ime_bucket\030\001 \001(\0132\032.google.protobuf.Times"
-  "tamp\022\022\n\nproject_id\030\002 \001(\t\022\014\n\004page\030\003 \001(\t\022\027"
-  "\n\nerror_type\030\004 \001(\tH\000\210\001\001\022\024\n\014errors_count\030"
-  "\005 \001(\003\022\025\n\rwarning_count\030\006 \001(\003\022\026\n\016critical"
-  "_count\030\007 \001(\003\022\024\n\014unique_users\030\010 \001(\003\022.\n\ncr"
-  "eated_at\030\t \001(\0132\032.google.protobuf.Timesta"
-  "mpB\r\n\013_error_type\"\332\001\n\023GetErrorsAggReques"
-  "t\022\022\n\nproject_id\030\001 \001(\t\0224\n\ntime_range\030\002 \001("
-  "\0132 .metricsys.aggregation.TimeRange\022\021\n\004p"
-  "age\030\003 \001(\tH\000\210\001\001\022\027\n\nerror_type\030\004 \001(\tH\001\210\001\001\022"
-  "5\n\npagination\030\005 \001(\0132!.metricsys.aggregat"
-  "ion.PaginationB\007\n\005_pageB\r\n\013_error_type\"I"
-  "\n\024GetErrorsAggResponse\0221\n\004rows\030\001 \003(\0132#.m"
-  "etricsys.aggregation.AggErrorsRow\"\376\001\n\022Ag"
-  "gCustomEventsRow\022/\n\013time_bucket\030\001 \001(\0132\032."
-  "google.protobuf.Timestamp\022\022\n\nproject_id\030"
-  "\002 \001(\t\022\022\n\nevent_name\030\003 \001(\t\022\021\n\004page\030\004 \001(\tH"
-  "\000\210\001\001\022\024\n\014events_count\030\005 \001(\003\022\024\n\014unique_use"
-  "rs\030\006 \001(\003\022\027\n\017unique_sessions\030\007 \001(\003\022.\n\ncre"
-  "ated_at\030\010 \001(\0132\032.google.protobuf.Timestam"
-  "pB\007\n\005_page\"\314\001\n\031GetCustomEventsAggRequest"
-  "\022\022\n\nproject_id\030\001 \001(\t\0224\n\ntime_range\030\002 \001(\013"
-  "2 .metricsys.aggregation.TimeRange\022\022\n\nev"
-  "ent_name\030\003 \001(\t\022\021\n\004page\030\004 \001(\tH\000\210\001\001\0225\n\npag"
-  "ination\030\005 \001(\0132!.metricsys.aggregation.Pa"
-  "ginationB\007\n\005_page\"U\n\032GetCustomEventsAggR"
-  "esponse\0227\n\004rows\030\001 \003(\0132).metricsys.aggreg"
-  "ation.AggCustomEventsRow2\264\005\n\022Aggregation"
-  "Service\022g\n\014GetWatermark\022*.metricsys.aggr"
-  "egation.GetWatermarkRequest\032+.metricsys."
-  "aggregation.GetWatermarkResponse\022p\n\017GetP"
-  "ageViewsAgg\022-.metricsys.aggregation.GetP"
-  "ageViewsAggRequest\032..metricsys.aggregati"
-  "on.GetPageViewsAggResponse\022g\n\014GetClicksA"
-  "gg\022*.metricsys.aggregation.GetClicksAggR"
-  "equest\032+.metricsys.aggregation.GetClicks"
-  "AggResponse\022v\n\021GetPerformanceAgg\022/.metri"
-  "csys.aggregation.GetPerformanceAggReques"
-  "t\0320.metricsys.aggregation.GetPerformance"
-  "AggResponse\022g\n\014GetErrorsAgg\022*.metricsys."
-  "aggregation.GetErrorsAggRequest\032+.metric"
-  "sys.aggregation.GetErrorsAggResponse\022y\n\022"
-  "GetCustomEventsAgg\0220.metricsys.aggregati"
-  "on.GetCustomEventsAggRequest\0321.metricsys"
-  ".aggregation.GetCustomEventsAggResponseb"
-  "\006proto3"
+  ".TimeRange\022\022\n\nevent_name\030\003 \001(\t\022\021\n\004page\030\004"
+  " \001(\tH\000\210\001\001\0225\n\npagination\030\005 \001(\0132!.metricsy"
+  "s.aggregation.Pagination\022\024\n\014step_seconds"
+  "\030\006 \001(\rB\007\n\005_page\"U\n\032GetCustomEventsAggRes"
+  "ponse\0227\n\004rows\030\001 \003(\0132).metricsys.aggregat"
+  "ion.AggCustomEventsRow\"\252\002\n\024GetUniquesAgg"
+  "Request\022\022\n\nproject_id\030\001 \001(\t\0224\n\ntime_rang"
+  "e\030\002 \001(\0132 .metricsys.aggregation.TimeRang"
+  "e\0224\n\006source\030\003 \001(\0162$.metricsys.aggregatio"
+  "n.UniquesSource\022\021\n\004page\030\004 \001(\tH\000\210\001\001\022\027\n\nel"
+  "ement_id\030\005 \001(\tH\001\210\001\001\022\027\n\nerror_type\030\006 \001(\tH"
+  "\002\210\001\001\022\027\n\nevent_name\030\007 \001(\tH\003\210\001\001B\007\n\005_pageB\r"
+  "\n\013_element_idB\r\n\013_error_typeB\r\n\013_event_n"
+  "ame\"]\n\025GetUniquesAggResponse\022\024\n\014unique_u"
+  "sers\030\001 \001(\003\022\027\n\017unique_sessions\030\002 \001(\003\022\025\n\rb"
+  "uckets_count\030\003 \001(\003*\246\001\n\rUniquesSource\022\036\n\032"
+  "UNIQUES_SOURCE_UNSPECIFIED\020\000\022\035\n\031UNIQUES_"
+  "SOURCE_PAGE_VIEWS\020\001\022\031\n\025UNIQUES_SOURCE_CL"
+  "ICKS\020\002\022\031\n\025UNIQUES_SOURCE_ERRORS\020\003\022 \n\034UNI"
+  "QUES_SOURCE_CUSTOM_EVENTS\020\0042\240\006\n\022Aggregat"
+  "ionService\022g\n\014GetWatermark\022*.metricsys.a"
+  "ggregation.GetWatermarkRequest\032+.metrics"
+  "ys.aggregation.GetWatermarkResponse\022p\n\017G"
+  "etPageViewsAgg\022-.metricsys.aggregation.G"
+  "etPageViewsAggRequest\032..metricsys.aggreg"
+  "ation.GetPageViewsAggResponse\022g\n\014GetClic"
+  "ksAgg\022*.metricsys.aggregation.GetClicksA"
+  "ggRequest\032+.metricsys.aggregation.GetCli"
+  "cksAggResponse\022v\n\021GetPerformanceAgg\022/.me"
+  "tricsys.aggregation.GetPerformanceAggReq"
+  "uest\0320.metricsys.aggregation.GetPerforma"
+  "nceAggResponse\022g\n\014GetErrorsAgg\022*.metrics"
+  "ys.aggregation.GetErrorsAggRequest\032+.met"
+  "ricsys.aggregation.GetErrorsAggResponse\022"
+  "y\n\022GetCustomEventsAgg\0220.metricsys.aggreg"
+  "ation.GetCustomEventsAggRequest\0321.metric"
+  "sys.aggregation.GetCustomEventsAggRespon"
+  "se\022j\n\rGetUniquesAgg\022+.metricsys.aggregat"
+  "ion.GetUniquesAggRequest\032,.metricsys.agg"
+  "regation.GetUniquesAggResponseb\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_aggregation_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2ftimestamp_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_aggregation_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_aggregation_2eproto = {
-    false, false, 3807, descriptor_table_protodef_aggregation_2eproto,
+    false, false, 4918, descriptor_table_protodef_aggregation_2eproto,
     "aggregation.proto",
-    &descriptor_table_aggregation_2eproto_once, descriptor_table_aggregation_2eproto_deps, 1, 19,
+    &descriptor_table_aggregation_2eproto_once, descriptor_table_aggregation_2eproto_deps, 1, 22,
     schemas, file_default_instances, TableStruct_aggregation_2eproto::offsets,
     file_level_metadata_aggregation_2eproto, file_level_enum_descriptors_aggregation_2eproto,
     file_level_service_descriptors_aggregation_2eproto,
@@ -745,6 +906,23 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_aggregat
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_aggregation_2eproto(&descriptor_table_aggregation_2eproto);
 namespace metricsys {
 namespace aggregation {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UniquesSource_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_aggregation_2eproto);
+  return file_level_enum_descriptors_aggregation_2eproto[0];
+}
+bool UniquesSource_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -1492,6 +1670,7 @@ AggPageViewsRow::AggPageViewsRow(const AggPageViewsRow& from)
     , decltype(_impl_.views_count_){}
     , decltype(_impl_.unique_users_){}
     , decltype(_impl_.unique_sessions_){}
+    , decltype(_impl_.step_seconds_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -1518,8 +1697,8 @@ AggPageViewsRow::AggPageViewsRow(const AggPageViewsRow& from)
     _this->_impl_.created_at_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.created_at_);
   }
   ::memcpy(&_impl_.views_count_, &from._impl_.views_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unique_sessions_) -
-    reinterpret_cast<char*>(&_impl_.views_count_)) + sizeof(_impl_.unique_sessions_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.step_seconds_) -
+    reinterpret_cast<char*>(&_impl_.views_count_)) + sizeof(_impl_.step_seconds_));
   // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.AggPageViewsRow)
 }
 
@@ -1535,6 +1714,7 @@ inline void AggPageViewsRow::SharedCtor(
     , decltype(_impl_.views_count_){int64_t{0}}
     , decltype(_impl_.unique_users_){int64_t{0}}
     , decltype(_impl_.unique_sessions_){int64_t{0}}
+    , decltype(_impl_.step_seconds_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.project_id_.InitDefault();
@@ -1585,8 +1765,8 @@ void AggPageViewsRow::Clear() {
   }
   _impl_.created_at_ = nullptr;
   ::memset(&_impl_.views_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.unique_sessions_) -
-      reinterpret_cast<char*>(&_impl_.views_count_)) + sizeof(_impl_.unique_sessions_));
+      reinterpret_cast<char*>(&_impl_.step_seconds_) -
+      reinterpret_cast<char*>(&_impl_.views_count_)) + sizeof(_impl_.step_seconds_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1656,6 +1836,14 @@ const char* AggPageViewsRow::_InternalParse(const char* ptr, ::_pbi::ParseContex
         } else
           goto handle_unusual;
         continue;
+      // uint32 step_seconds = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1737,6 +1925,12 @@ uint8_t* AggPageViewsRow::_InternalSerialize(
         _Internal::created_at(this).GetCachedSize(), target, stream);
   }
 
+  // uint32 step_seconds = 8;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_step_seconds(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1796,6 +1990,11 @@ size_t AggPageViewsRow::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_sessions());
   }
 
+  // uint32 step_seconds = 8;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1837,6 +2036,9 @@ void AggPageViewsRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (from._internal_unique_sessions() != 0) {
     _this->_internal_set_unique_sessions(from._internal_unique_sessions());
   }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1865,8 +2067,8 @@ void AggPageViewsRow::InternalSwap(AggPageViewsRow* other) {
       &other->_impl_.page_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AggPageViewsRow, _impl_.unique_sessions_)
-      + sizeof(AggPageViewsRow::_impl_.unique_sessions_)
+      PROTOBUF_FIELD_OFFSET(AggPageViewsRow, _impl_.step_seconds_)
+      + sizeof(AggPageViewsRow::_impl_.step_seconds_)
       - PROTOBUF_FIELD_OFFSET(AggPageViewsRow, _impl_.time_bucket_)>(
           reinterpret_cast<char*>(&_impl_.time_bucket_),
           reinterpret_cast<char*>(&other->_impl_.time_bucket_));
@@ -1913,7 +2115,8 @@ GetPageViewsAggRequest::GetPageViewsAggRequest(const GetPageViewsAggRequest& fro
     , decltype(_impl_.project_id_){}
     , decltype(_impl_.page_){}
     , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.step_seconds_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.project_id_.InitDefault();
@@ -1938,6 +2141,7 @@ GetPageViewsAggRequest::GetPageViewsAggRequest(const GetPageViewsAggRequest& fro
   if (from._internal_has_pagination()) {
     _this->_impl_.pagination_ = new ::metricsys::aggregation::Pagination(*from._impl_.pagination_);
   }
+  _this->_impl_.step_seconds_ = from._impl_.step_seconds_;
   // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetPageViewsAggRequest)
 }
 
@@ -1952,6 +2156,7 @@ inline void GetPageViewsAggRequest::SharedCtor(
     , decltype(_impl_.page_){}
     , decltype(_impl_.time_range_){nullptr}
     , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.step_seconds_){0u}
   };
   _impl_.project_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2003,6 +2208,7 @@ void GetPageViewsAggRequest::Clear() {
     delete _impl_.pagination_;
   }
   _impl_.pagination_ = nullptr;
+  _impl_.step_seconds_ = 0u;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -2050,6 +2256,14 @@ const char* GetPageViewsAggRequest::_InternalParse(const char* ptr, ::_pbi::Pars
         } else
           goto handle_unusual;
         continue;
+      // uint32 step_seconds = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2114,6 +2328,12 @@ uint8_t* GetPageViewsAggRequest::_InternalSerialize(
         _Internal::pagination(this).GetCachedSize(), target, stream);
   }
 
+  // uint32 step_seconds = 5;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_step_seconds(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2159,6 +2379,11 @@ size_t GetPageViewsAggRequest::ByteSizeLong() const {
         *_impl_.pagination_);
   }
 
+  // uint32 step_seconds = 5;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -2191,6 +2416,9 @@ void GetPageViewsAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg,
     _this->_internal_mutable_pagination()->::metricsys::aggregation::Pagination::MergeFrom(
         from._internal_pagination());
   }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -2220,8 +2448,8 @@ void GetPageViewsAggRequest::InternalSwap(GetPageViewsAggRequest* other) {
       &other->_impl_.page_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetPageViewsAggRequest, _impl_.pagination_)
-      + sizeof(GetPageViewsAggRequest::_impl_.pagination_)
+      PROTOBUF_FIELD_OFFSET(GetPageViewsAggRequest, _impl_.step_seconds_)
+      + sizeof(GetPageViewsAggRequest::_impl_.step_seconds_)
       - PROTOBUF_FIELD_OFFSET(GetPageViewsAggRequest, _impl_.time_range_)>(
           reinterpret_cast<char*>(&_impl_.time_range_),
           reinterpret_cast<char*>(&other->_impl_.time_range_));
@@ -2469,7 +2697,8 @@ AggClicksRow::AggClicksRow(const AggClicksRow& from)
     , decltype(_impl_.created_at_){nullptr}
     , decltype(_impl_.clicks_count_){}
     , decltype(_impl_.unique_users_){}
-    , decltype(_impl_.unique_sessions_){}};
+    , decltype(_impl_.unique_sessions_){}
+    , decltype(_impl_.step_seconds_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.project_id_.InitDefault();
@@ -2503,8 +2732,8 @@ AggClicksRow::AggClicksRow(const AggClicksRow& from)
     _this->_impl_.created_at_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.created_at_);
   }
   ::memcpy(&_impl_.clicks_count_, &from._impl_.clicks_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unique_sessions_) -
-    reinterpret_cast<char*>(&_impl_.clicks_count_)) + sizeof(_impl_.unique_sessions_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.step_seconds_) -
+    reinterpret_cast<char*>(&_impl_.clicks_count_)) + sizeof(_impl_.step_seconds_));
   // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.AggClicksRow)
 }
 
@@ -2523,6 +2752,7 @@ inline void AggClicksRow::SharedCtor(
     , decltype(_impl_.clicks_count_){int64_t{0}}
     , decltype(_impl_.unique_users_){int64_t{0}}
     , decltype(_impl_.unique_sessions_){int64_t{0}}
+    , decltype(_impl_.step_seconds_){0u}
   };
   _impl_.project_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2581,8 +2811,8 @@ void AggClicksRow::Clear() {
   }
   _impl_.created_at_ = nullptr;
   ::memset(&_impl_.clicks_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.unique_sessions_) -
-      reinterpret_cast<char*>(&_impl_.clicks_count_)) + sizeof(_impl_.unique_sessions_));
+      reinterpret_cast<char*>(&_impl_.step_seconds_) -
+      reinterpret_cast<char*>(&_impl_.clicks_count_)) + sizeof(_impl_.step_seconds_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -2664,6 +2894,14 @@ const char* AggClicksRow::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // uint32 step_seconds = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2756,6 +2994,12 @@ uint8_t* AggClicksRow::_InternalSerialize(
         _Internal::created_at(this).GetCachedSize(), target, stream);
   }
 
+  // uint32 step_seconds = 9;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_step_seconds(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2823,6 +3067,11 @@ size_t AggClicksRow::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_sessions());
   }
 
+  // uint32 step_seconds = 9;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -2867,6 +3116,9 @@ void AggClicksRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::P
   if (from._internal_unique_sessions() != 0) {
     _this->_internal_set_unique_sessions(from._internal_unique_sessions());
   }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -2900,8 +3152,8 @@ void AggClicksRow::InternalSwap(AggClicksRow* other) {
       &other->_impl_.element_id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AggClicksRow, _impl_.unique_sessions_)
-      + sizeof(AggClicksRow::_impl_.unique_sessions_)
+      PROTOBUF_FIELD_OFFSET(AggClicksRow, _impl_.step_seconds_)
+      + sizeof(AggClicksRow::_impl_.step_seconds_)
       - PROTOBUF_FIELD_OFFSET(AggClicksRow, _impl_.time_bucket_)>(
           reinterpret_cast<char*>(&_impl_.time_bucket_),
           reinterpret_cast<char*>(&other->_impl_.time_bucket_));
@@ -2952,7 +3204,8 @@ GetClicksAggRequest::GetClicksAggRequest(const GetClicksAggRequest& from)
     , decltype(_impl_.page_){}
     , decltype(_impl_.element_id_){}
     , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.step_seconds_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.project_id_.InitDefault();
@@ -2985,6 +3238,7 @@ GetClicksAggRequest::GetClicksAggRequest(const GetClicksAggRequest& from)
   if (from._internal_has_pagination()) {
     _this->_impl_.pagination_ = new ::metricsys::aggregation::Pagination(*from._impl_.pagination_);
   }
+  _this->_impl_.step_seconds_ = from._impl_.step_seconds_;
   // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetClicksAggRequest)
 }
 
@@ -3000,6 +3254,7 @@ inline void GetClicksAggRequest::SharedCtor(
     , decltype(_impl_.element_id_){}
     , decltype(_impl_.time_range_){nullptr}
     , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.step_seconds_){0u}
   };
   _impl_.project_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -3061,6 +3316,7 @@ void GetClicksAggRequest::Clear() {
     delete _impl_.pagination_;
   }
   _impl_.pagination_ = nullptr;
+  _impl_.step_seconds_ = 0u;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -3118,6 +3374,14 @@ const char* GetClicksAggRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
+      // uint32 step_seconds = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3192,6 +3456,12 @@ uint8_t* GetClicksAggRequest::_InternalSerialize(
         _Internal::pagination(this).GetCachedSize(), target, stream);
   }
 
+  // uint32 step_seconds = 6;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_step_seconds(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3246,6 +3516,11 @@ size_t GetClicksAggRequest::ByteSizeLong() const {
         *_impl_.pagination_);
   }
 
+  // uint32 step_seconds = 6;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -3284,6 +3559,9 @@ void GetClicksAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
     _this->_internal_mutable_pagination()->::metricsys::aggregation::Pagination::MergeFrom(
         from._internal_pagination());
   }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -3317,8 +3595,8 @@ void GetClicksAggRequest::InternalSwap(GetClicksAggRequest* other) {
       &other->_impl_.element_id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetClicksAggRequest, _impl_.pagination_)
-      + sizeof(GetClicksAggRequest::_impl_.pagination_)
+      PROTOBUF_FIELD_OFFSET(GetClicksAggRequest, _impl_.step_seconds_)
+      + sizeof(GetClicksAggRequest::_impl_.step_seconds_)
       - PROTOBUF_FIELD_OFFSET(GetClicksAggRequest, _impl_.time_range_)>(
           reinterpret_cast<char*>(&_impl_.time_range_),
           reinterpret_cast<char*>(&other->_impl_.time_range_));
@@ -3517,118 +3795,50 @@ void GetClicksAggResponse::InternalSwap(GetClicksAggResponse* other) {
 
 // ===================================================================
 
-class AggPerformanceRow::_Internal {
+class PerformanceQuantile::_Internal {
  public:
-  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& time_bucket(const AggPerformanceRow* msg);
-  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& created_at(const AggPerformanceRow* msg);
 };
 
-const ::PROTOBUF_NAMESPACE_ID::Timestamp&
-AggPerformanceRow::_Internal::time_bucket(const AggPerformanceRow* msg) {
-  return *msg->_impl_.time_bucket_;
-}
-const ::PROTOBUF_NAMESPACE_ID::Timestamp&
-AggPerformanceRow::_Internal::created_at(const AggPerformanceRow* msg) {
-  return *msg->_impl_.created_at_;
-}
-void AggPerformanceRow::clear_time_bucket() {
-  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
-    delete _impl_.time_bucket_;
-  }
-  _impl_.time_bucket_ = nullptr;
-}
-void AggPerformanceRow::clear_created_at() {
-  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
-    delete _impl_.created_at_;
-  }
-  _impl_.created_at_ = nullptr;
-}
-AggPerformanceRow::AggPerformanceRow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+PerformanceQuantile::PerformanceQuantile(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.AggPerformanceRow)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.PerformanceQuantile)
 }
-AggPerformanceRow::AggPerformanceRow(const AggPerformanceRow& from)
+PerformanceQuantile::PerformanceQuantile(const PerformanceQuantile& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  AggPerformanceRow* const _this = this; (void)_this;
+  PerformanceQuantile* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.project_id_){}
-    , decltype(_impl_.page_){}
-    , decltype(_impl_.time_bucket_){nullptr}
-    , decltype(_impl_.created_at_){nullptr}
-    , decltype(_impl_.samples_count_){}
-    , decltype(_impl_.avg_total_load_ms_){}
-    , decltype(_impl_.p95_total_load_ms_){}
-    , decltype(_impl_.avg_ttfb_ms_){}
-    , decltype(_impl_.p95_ttfb_ms_){}
-    , decltype(_impl_.avg_fcp_ms_){}
-    , decltype(_impl_.p95_fcp_ms_){}
-    , decltype(_impl_.avg_lcp_ms_){}
-    , decltype(_impl_.p95_lcp_ms_){}
+      decltype(_impl_.quantile_){}
+    , decltype(_impl_.total_load_ms_){}
+    , decltype(_impl_.ttfb_ms_){}
+    , decltype(_impl_.fcp_ms_){}
+    , decltype(_impl_.lcp_ms_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.project_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.project_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_project_id().empty()) {
-    _this->_impl_.project_id_.Set(from._internal_project_id(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.page_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.page_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_page().empty()) {
-    _this->_impl_.page_.Set(from._internal_page(), 
-      _this->GetArenaForAllocation());
-  }
-  if (from._internal_has_time_bucket()) {
-    _this->_impl_.time_bucket_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.time_bucket_);
-  }
-  if (from._internal_has_created_at()) {
-    _this->_impl_.created_at_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.created_at_);
-  }
-  ::memcpy(&_impl_.samples_count_, &from._impl_.samples_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.p95_lcp_ms_) -
-    reinterpret_cast<char*>(&_impl_.samples_count_)) + sizeof(_impl_.p95_lcp_ms_));
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.AggPerformanceRow)
+  ::memcpy(&_impl_.quantile_, &from._impl_.quantile_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lcp_ms_) -
+    reinterpret_cast<char*>(&_impl_.quantile_)) + sizeof(_impl_.lcp_ms_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.PerformanceQuantile)
 }
 
-inline void AggPerformanceRow::SharedCtor(
+inline void PerformanceQuantile::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.project_id_){}
-    , decltype(_impl_.page_){}
-    , decltype(_impl_.time_bucket_){nullptr}
-    , decltype(_impl_.created_at_){nullptr}
-    , decltype(_impl_.samples_count_){int64_t{0}}
-    , decltype(_impl_.avg_total_load_ms_){0}
-    , decltype(_impl_.p95_total_load_ms_){0}
-    , decltype(_impl_.avg_ttfb_ms_){0}
-    , decltype(_impl_.p95_ttfb_ms_){0}
-    , decltype(_impl_.avg_fcp_ms_){0}
-    , decltype(_impl_.p95_fcp_ms_){0}
-    , decltype(_impl_.avg_lcp_ms_){0}
-    , decltype(_impl_.p95_lcp_ms_){0}
+      decltype(_impl_.quantile_){0}
+    , decltype(_impl_.total_load_ms_){0}
+    , decltype(_impl_.ttfb_ms_){0}
+    , decltype(_impl_.fcp_ms_){0}
+    , decltype(_impl_.lcp_ms_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.project_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.project_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.page_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.page_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-AggPerformanceRow::~AggPerformanceRow() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.AggPerformanceRow)
+PerformanceQuantile::~PerformanceQuantile() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.PerformanceQuantile)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3636,154 +3846,72 @@ AggPerformanceRow::~AggPerformanceRow() {
   SharedDtor();
 }
 
-inline void AggPerformanceRow::SharedDtor() {
+inline void PerformanceQuantile::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.project_id_.Destroy();
-  _impl_.page_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.time_bucket_;
-  if (this != internal_default_instance()) delete _impl_.created_at_;
 }
 
-void AggPerformanceRow::SetCachedSize(int size) const {
+void PerformanceQuantile::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void AggPerformanceRow::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.AggPerformanceRow)
+void PerformanceQuantile::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.PerformanceQuantile)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.project_id_.ClearToEmpty();
-  _impl_.page_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
-    delete _impl_.time_bucket_;
-  }
-  _impl_.time_bucket_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
-    delete _impl_.created_at_;
-  }
-  _impl_.created_at_ = nullptr;
-  ::memset(&_impl_.samples_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.p95_lcp_ms_) -
-      reinterpret_cast<char*>(&_impl_.samples_count_)) + sizeof(_impl_.p95_lcp_ms_));
+  ::memset(&_impl_.quantile_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lcp_ms_) -
+      reinterpret_cast<char*>(&_impl_.quantile_)) + sizeof(_impl_.lcp_ms_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AggPerformanceRow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* PerformanceQuantile::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .google.protobuf.Timestamp time_bucket = 1;
+      // double quantile = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_time_bucket(), ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.quantile_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
-      // string project_id = 2;
+      // double total_load_ms = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_project_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggPerformanceRow.project_id"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.total_load_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
-      // string page = 3;
+      // double ttfb_ms = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_page();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggPerformanceRow.page"));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.ttfb_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
-      // int64 samples_count = 4;
+      // double fcp_ms = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.samples_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.fcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
-      // double avg_total_load_ms = 5;
+      // double lcp_ms = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
-          _impl_.avg_total_load_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          _impl_.lcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
           ptr += sizeof(double);
         } else
           goto handle_unusual;
         continue;
-      // double p95_total_load_ms = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
-          _impl_.p95_total_load_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double avg_ttfb_ms = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
-          _impl_.avg_ttfb_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double p95_ttfb_ms = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
-          _impl_.p95_ttfb_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double avg_fcp_ms = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
-          _impl_.avg_fcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double p95_fcp_ms = 10;
-      case 10:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
-          _impl_.p95_fcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double avg_lcp_ms = 11;
-      case 11:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
-          _impl_.avg_lcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // double p95_lcp_ms = 12;
-      case 12:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
-          _impl_.p95_lcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
-          ptr += sizeof(double);
-        } else
-          goto handle_unusual;
-        continue;
-      // .google.protobuf.Timestamp created_at = 13;
-      case 13:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
-          ptr = ctx->ParseMessage(_internal_mutable_created_at(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3807,380 +3935,202 @@ failure:
 #undef CHK_
 }
 
-uint8_t* AggPerformanceRow::_InternalSerialize(
+uint8_t* PerformanceQuantile::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.AggPerformanceRow)
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.PerformanceQuantile)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .google.protobuf.Timestamp time_bucket = 1;
-  if (this->_internal_has_time_bucket()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::time_bucket(this),
-        _Internal::time_bucket(this).GetCachedSize(), target, stream);
-  }
-
-  // string project_id = 2;
-  if (!this->_internal_project_id().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.AggPerformanceRow.project_id");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_project_id(), target);
-  }
-
-  // string page = 3;
-  if (!this->_internal_page().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.AggPerformanceRow.page");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_page(), target);
-  }
-
-  // int64 samples_count = 4;
-  if (this->_internal_samples_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_samples_count(), target);
-  }
-
-  // double avg_total_load_ms = 5;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_total_load_ms = this->_internal_avg_total_load_ms();
-  uint64_t raw_avg_total_load_ms;
-  memcpy(&raw_avg_total_load_ms, &tmp_avg_total_load_ms, sizeof(tmp_avg_total_load_ms));
-  if (raw_avg_total_load_ms != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_avg_total_load_ms(), target);
-  }
-
-  // double p95_total_load_ms = 6;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_total_load_ms = this->_internal_p95_total_load_ms();
-  uint64_t raw_p95_total_load_ms;
-  memcpy(&raw_p95_total_load_ms, &tmp_p95_total_load_ms, sizeof(tmp_p95_total_load_ms));
-  if (raw_p95_total_load_ms != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_p95_total_load_ms(), target);
-  }
-
-  // double avg_ttfb_ms = 7;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_ttfb_ms = this->_internal_avg_ttfb_ms();
-  uint64_t raw_avg_ttfb_ms;
-  memcpy(&raw_avg_ttfb_ms, &tmp_avg_ttfb_ms, sizeof(tmp_avg_ttfb_ms));
-  if (raw_avg_ttfb_ms != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_avg_ttfb_ms(), target);
-  }
-
-  // double p95_ttfb_ms = 8;
+  // double quantile = 1;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_ttfb_ms = this->_internal_p95_ttfb_ms();
-  uint64_t raw_p95_ttfb_ms;
-  memcpy(&raw_p95_ttfb_ms, &tmp_p95_ttfb_ms, sizeof(tmp_p95_ttfb_ms));
-  if (raw_p95_ttfb_ms != 0) {
+  double tmp_quantile = this->_internal_quantile();
+  uint64_t raw_quantile;
+  memcpy(&raw_quantile, &tmp_quantile, sizeof(tmp_quantile));
+  if (raw_quantile != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_p95_ttfb_ms(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_quantile(), target);
   }
 
-  // double avg_fcp_ms = 9;
+  // double total_load_ms = 2;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_fcp_ms = this->_internal_avg_fcp_ms();
-  uint64_t raw_avg_fcp_ms;
-  memcpy(&raw_avg_fcp_ms, &tmp_avg_fcp_ms, sizeof(tmp_avg_fcp_ms));
-  if (raw_avg_fcp_ms != 0) {
+  double tmp_total_load_ms = this->_internal_total_load_ms();
+  uint64_t raw_total_load_ms;
+  memcpy(&raw_total_load_ms, &tmp_total_load_ms, sizeof(tmp_total_load_ms));
+  if (raw_total_load_ms != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_avg_fcp_ms(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_total_load_ms(), target);
   }
 
-  // double p95_fcp_ms = 10;
+  // double ttfb_ms = 3;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_fcp_ms = this->_internal_p95_fcp_ms();
-  uint64_t raw_p95_fcp_ms;
-  memcpy(&raw_p95_fcp_ms, &tmp_p95_fcp_ms, sizeof(tmp_p95_fcp_ms));
-  if (raw_p95_fcp_ms != 0) {
+  double tmp_ttfb_ms = this->_internal_ttfb_ms();
+  uint64_t raw_ttfb_ms;
+  memcpy(&raw_ttfb_ms, &tmp_ttfb_ms, sizeof(tmp_ttfb_ms));
+  if (raw_ttfb_ms != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_p95_fcp_ms(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_ttfb_ms(), target);
   }
 
-  // double avg_lcp_ms = 11;
+  // double fcp_ms = 4;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_lcp_ms = this->_internal_avg_lcp_ms();
-  uint64_t raw_avg_lcp_ms;
-  memcpy(&raw_avg_lcp_ms, &tmp_avg_lcp_ms, sizeof(tmp_avg_lcp_ms));
-  if (raw_avg_lcp_ms != 0) {
+  double tmp_fcp_ms = this->_internal_fcp_ms();
+  uint64_t raw_fcp_ms;
+  memcpy(&raw_fcp_ms, &tmp_fcp_ms, sizeof(tmp_fcp_ms));
+  if (raw_fcp_ms != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_avg_lcp_ms(), target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_fcp_ms(), target);
   }
 
-  // double p95_lcp_ms = 12;
+  // double lcp_ms = 5;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_lcp_ms = this->_internal_p95_lcp_ms();
-  uint64_t raw_p95_lcp_ms;
-  memcpy(&raw_p95_lcp_ms, &tmp_p95_lcp_ms, sizeof(tmp_p95_lcp_ms));
-  if (raw_p95_lcp_ms != 0) {
+  double tmp_lcp_ms = this->_internal_lcp_ms();
+  uint64_t raw_lcp_ms;
+  memcpy(&raw_lcp_ms, &tmp_lcp_ms, sizeof(tmp_lcp_ms));
+  if (raw_lcp_ms != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_p95_lcp_ms(), target);
-  }
-
-  // .google.protobuf.Timestamp created_at = 13;
-  if (this->_internal_has_created_at()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(13, _Internal::created_at(this),
-        _Internal::created_at(this).GetCachedSize(), target, stream);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_lcp_ms(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.AggPerformanceRow)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.PerformanceQuantile)
   return target;
 }
 
-size_t AggPerformanceRow::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.AggPerformanceRow)
+size_t PerformanceQuantile::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.PerformanceQuantile)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string project_id = 2;
-  if (!this->_internal_project_id().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_project_id());
-  }
-
-  // string page = 3;
-  if (!this->_internal_page().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_page());
-  }
-
-  // .google.protobuf.Timestamp time_bucket = 1;
-  if (this->_internal_has_time_bucket()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.time_bucket_);
-  }
-
-  // .google.protobuf.Timestamp created_at = 13;
-  if (this->_internal_has_created_at()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.created_at_);
-  }
-
-  // int64 samples_count = 4;
-  if (this->_internal_samples_count() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_samples_count());
-  }
-
-  // double avg_total_load_ms = 5;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_total_load_ms = this->_internal_avg_total_load_ms();
-  uint64_t raw_avg_total_load_ms;
-  memcpy(&raw_avg_total_load_ms, &tmp_avg_total_load_ms, sizeof(tmp_avg_total_load_ms));
-  if (raw_avg_total_load_ms != 0) {
-    total_size += 1 + 8;
-  }
-
-  // double p95_total_load_ms = 6;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_total_load_ms = this->_internal_p95_total_load_ms();
-  uint64_t raw_p95_total_load_ms;
-  memcpy(&raw_p95_total_load_ms, &tmp_p95_total_load_ms, sizeof(tmp_p95_total_load_ms));
-  if (raw_p95_total_load_ms != 0) {
-    total_size += 1 + 8;
-  }
-
-  // double avg_ttfb_ms = 7;
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_ttfb_ms = this->_internal_avg_ttfb_ms();
-  uint64_t raw_avg_ttfb_ms;
-  memcpy(&raw_avg_ttfb_ms, &tmp_avg_ttfb_ms, sizeof(tmp_avg_ttfb_ms));
-  if (raw_avg_ttfb_ms != 0) {
-    total_size += 1 + 8;
-  }
-
-  // double p95_ttfb_ms = 8;
+  // double quantile = 1;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_ttfb_ms = this->_internal_p95_ttfb_ms();
-  uint64_t raw_p95_ttfb_ms;
-  memcpy(&raw_p95_ttfb_ms, &tmp_p95_ttfb_ms, sizeof(tmp_p95_ttfb_ms));
-  if (raw_p95_ttfb_ms != 0) {
+  double tmp_quantile = this->_internal_quantile();
+  uint64_t raw_quantile;
+  memcpy(&raw_quantile, &tmp_quantile, sizeof(tmp_quantile));
+  if (raw_quantile != 0) {
     total_size += 1 + 8;
   }
 
-  // double avg_fcp_ms = 9;
+  // double total_load_ms = 2;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_fcp_ms = this->_internal_avg_fcp_ms();
-  uint64_t raw_avg_fcp_ms;
-  memcpy(&raw_avg_fcp_ms, &tmp_avg_fcp_ms, sizeof(tmp_avg_fcp_ms));
-  if (raw_avg_fcp_ms != 0) {
+  double tmp_total_load_ms = this->_internal_total_load_ms();
+  uint64_t raw_total_load_ms;
+  memcpy(&raw_total_load_ms, &tmp_total_load_ms, sizeof(tmp_total_load_ms));
+  if (raw_total_load_ms != 0) {
     total_size += 1 + 8;
   }
 
-  // double p95_fcp_ms = 10;
+  // double ttfb_ms = 3;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_fcp_ms = this->_internal_p95_fcp_ms();
-  uint64_t raw_p95_fcp_ms;
-  memcpy(&raw_p95_fcp_ms, &tmp_p95_fcp_ms, sizeof(tmp_p95_fcp_ms));
-  if (raw_p95_fcp_ms != 0) {
+  double tmp_ttfb_ms = this->_internal_ttfb_ms();
+  uint64_t raw_ttfb_ms;
+  memcpy(&raw_ttfb_ms, &tmp_ttfb_ms, sizeof(tmp_ttfb_ms));
+  if (raw_ttfb_ms != 0) {
     total_size += 1 + 8;
   }
 
-  // double avg_lcp_ms = 11;
+  // double fcp_ms = 4;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_lcp_ms = this->_internal_avg_lcp_ms();
-  uint64_t raw_avg_lcp_ms;
-  memcpy(&raw_avg_lcp_ms, &tmp_avg_lcp_ms, sizeof(tmp_avg_lcp_ms));
-  if (raw_avg_lcp_ms != 0) {
+  double tmp_fcp_ms = this->_internal_fcp_ms();
+  uint64_t raw_fcp_ms;
+  memcpy(&raw_fcp_ms, &tmp_fcp_ms, sizeof(tmp_fcp_ms));
+  if (raw_fcp_ms != 0) {
     total_size += 1 + 8;
   }
 
-  // double p95_lcp_ms = 12;
+  // double lcp_ms = 5;
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_lcp_ms = this->_internal_p95_lcp_ms();
-  uint64_t raw_p95_lcp_ms;
-  memcpy(&raw_p95_lcp_ms, &tmp_p95_lcp_ms, sizeof(tmp_p95_lcp_ms));
-  if (raw_p95_lcp_ms != 0) {
+  double tmp_lcp_ms = this->_internal_lcp_ms();
+  uint64_t raw_lcp_ms;
+  memcpy(&raw_lcp_ms, &tmp_lcp_ms, sizeof(tmp_lcp_ms));
+  if (raw_lcp_ms != 0) {
     total_size += 1 + 8;
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AggPerformanceRow::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PerformanceQuantile::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    AggPerformanceRow::MergeImpl
+    PerformanceQuantile::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AggPerformanceRow::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PerformanceQuantile::GetClassData() const { return &_class_data_; }
 
 
-void AggPerformanceRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<AggPerformanceRow*>(&to_msg);
-  auto& from = static_cast<const AggPerformanceRow&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.AggPerformanceRow)
+void PerformanceQuantile::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PerformanceQuantile*>(&to_msg);
+  auto& from = static_cast<const PerformanceQuantile&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.PerformanceQuantile)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_project_id().empty()) {
-    _this->_internal_set_project_id(from._internal_project_id());
-  }
-  if (!from._internal_page().empty()) {
-    _this->_internal_set_page(from._internal_page());
-  }
-  if (from._internal_has_time_bucket()) {
-    _this->_internal_mutable_time_bucket()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
-        from._internal_time_bucket());
-  }
-  if (from._internal_has_created_at()) {
-    _this->_internal_mutable_created_at()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
-        from._internal_created_at());
-  }
-  if (from._internal_samples_count() != 0) {
-    _this->_internal_set_samples_count(from._internal_samples_count());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_total_load_ms = from._internal_avg_total_load_ms();
-  uint64_t raw_avg_total_load_ms;
-  memcpy(&raw_avg_total_load_ms, &tmp_avg_total_load_ms, sizeof(tmp_avg_total_load_ms));
-  if (raw_avg_total_load_ms != 0) {
-    _this->_internal_set_avg_total_load_ms(from._internal_avg_total_load_ms());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_total_load_ms = from._internal_p95_total_load_ms();
-  uint64_t raw_p95_total_load_ms;
-  memcpy(&raw_p95_total_load_ms, &tmp_p95_total_load_ms, sizeof(tmp_p95_total_load_ms));
-  if (raw_p95_total_load_ms != 0) {
-    _this->_internal_set_p95_total_load_ms(from._internal_p95_total_load_ms());
-  }
-  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_ttfb_ms = from._internal_avg_ttfb_ms();
-  uint64_t raw_avg_ttfb_ms;
-  memcpy(&raw_avg_ttfb_ms, &tmp_avg_ttfb_ms, sizeof(tmp_avg_ttfb_ms));
-  if (raw_avg_ttfb_ms != 0) {
-    _this->_internal_set_avg_ttfb_ms(from._internal_avg_ttfb_ms());
-  }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_ttfb_ms = from._internal_p95_ttfb_ms();
-  uint64_t raw_p95_ttfb_ms;
-  memcpy(&raw_p95_ttfb_ms, &tmp_p95_ttfb_ms, sizeof(tmp_p95_ttfb_ms));
-  if (raw_p95_ttfb_ms != 0) {
-    _this->_internal_set_p95_ttfb_ms(from._internal_p95_ttfb_ms());
+  double tmp_quantile = from._internal_quantile();
+  uint64_t raw_quantile;
+  memcpy(&raw_quantile, &tmp_quantile, sizeof(tmp_quantile));
+  if (raw_quantile != 0) {
+    _this->_internal_set_quantile(from._internal_quantile());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_fcp_ms = from._internal_avg_fcp_ms();
-  uint64_t raw_avg_fcp_ms;
-  memcpy(&raw_avg_fcp_ms, &tmp_avg_fcp_ms, sizeof(tmp_avg_fcp_ms));
-  if (raw_avg_fcp_ms != 0) {
-    _this->_internal_set_avg_fcp_ms(from._internal_avg_fcp_ms());
+  double tmp_total_load_ms = from._internal_total_load_ms();
+  uint64_t raw_total_load_ms;
+  memcpy(&raw_total_load_ms, &tmp_total_load_ms, sizeof(tmp_total_load_ms));
+  if (raw_total_load_ms != 0) {
+    _this->_internal_set_total_load_ms(from._internal_total_load_ms());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_fcp_ms = from._internal_p95_fcp_ms();
-  uint64_t raw_p95_fcp_ms;
-  memcpy(&raw_p95_fcp_ms, &tmp_p95_fcp_ms, sizeof(tmp_p95_fcp_ms));
-  if (raw_p95_fcp_ms != 0) {
-    _this->_internal_set_p95_fcp_ms(from._internal_p95_fcp_ms());
+  double tmp_ttfb_ms = from._internal_ttfb_ms();
+  uint64_t raw_ttfb_ms;
+  memcpy(&raw_ttfb_ms, &tmp_ttfb_ms, sizeof(tmp_ttfb_ms));
+  if (raw_ttfb_ms != 0) {
+    _this->_internal_set_ttfb_ms(from._internal_ttfb_ms());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_avg_lcp_ms = from._internal_avg_lcp_ms();
-  uint64_t raw_avg_lcp_ms;
-  memcpy(&raw_avg_lcp_ms, &tmp_avg_lcp_ms, sizeof(tmp_avg_lcp_ms));
-  if (raw_avg_lcp_ms != 0) {
-    _this->_internal_set_avg_lcp_ms(from._internal_avg_lcp_ms());
+  double tmp_fcp_ms = from._internal_fcp_ms();
+  uint64_t raw_fcp_ms;
+  memcpy(&raw_fcp_ms, &tmp_fcp_ms, sizeof(tmp_fcp_ms));
+  if (raw_fcp_ms != 0) {
+    _this->_internal_set_fcp_ms(from._internal_fcp_ms());
   }
   static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
-  double tmp_p95_lcp_ms = from._internal_p95_lcp_ms();
-  uint64_t raw_p95_lcp_ms;
-  memcpy(&raw_p95_lcp_ms, &tmp_p95_lcp_ms, sizeof(tmp_p95_lcp_ms));
-  if (raw_p95_lcp_ms != 0) {
-    _this->_internal_set_p95_lcp_ms(from._internal_p95_lcp_ms());
+  double tmp_lcp_ms = from._internal_lcp_ms();
+  uint64_t raw_lcp_ms;
+  memcpy(&raw_lcp_ms, &tmp_lcp_ms, sizeof(tmp_lcp_ms));
+  if (raw_lcp_ms != 0) {
+    _this->_internal_set_lcp_ms(from._internal_lcp_ms());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AggPerformanceRow::CopyFrom(const AggPerformanceRow& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.AggPerformanceRow)
+void PerformanceQuantile::CopyFrom(const PerformanceQuantile& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.PerformanceQuantile)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AggPerformanceRow::IsInitialized() const {
+bool PerformanceQuantile::IsInitialized() const {
   return true;
 }
 
-void AggPerformanceRow::InternalSwap(AggPerformanceRow* other) {
+void PerformanceQuantile::InternalSwap(PerformanceQuantile* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.project_id_, lhs_arena,
-      &other->_impl_.project_id_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.page_, lhs_arena,
-      &other->_impl_.page_, rhs_arena
-  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AggPerformanceRow, _impl_.p95_lcp_ms_)
-      + sizeof(AggPerformanceRow::_impl_.p95_lcp_ms_)
-      - PROTOBUF_FIELD_OFFSET(AggPerformanceRow, _impl_.time_bucket_)>(
-          reinterpret_cast<char*>(&_impl_.time_bucket_),
-          reinterpret_cast<char*>(&other->_impl_.time_bucket_));
+      PROTOBUF_FIELD_OFFSET(PerformanceQuantile, _impl_.lcp_ms_)
+      + sizeof(PerformanceQuantile::_impl_.lcp_ms_)
+      - PROTOBUF_FIELD_OFFSET(PerformanceQuantile, _impl_.quantile_)>(
+          reinterpret_cast<char*>(&_impl_.quantile_),
+          reinterpret_cast<char*>(&other->_impl_.quantile_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AggPerformanceRow::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata PerformanceQuantile::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
       file_level_metadata_aggregation_2eproto[10]);
@@ -4188,40 +4138,58 @@ void AggPerformanceRow::InternalSwap(AggPerformanceRow* other) {
 
 // ===================================================================
 
-class GetPerformanceAggRequest::_Internal {
+class AggPerformanceRow::_Internal {
  public:
-  using HasBits = decltype(std::declval<GetPerformanceAggRequest>()._impl_._has_bits_);
-  static const ::metricsys::aggregation::TimeRange& time_range(const GetPerformanceAggRequest* msg);
-  static void set_has_page(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static const ::metricsys::aggregation::Pagination& pagination(const GetPerformanceAggRequest* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& time_bucket(const AggPerformanceRow* msg);
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& created_at(const AggPerformanceRow* msg);
 };
 
-const ::metricsys::aggregation::TimeRange&
-GetPerformanceAggRequest::_Internal::time_range(const GetPerformanceAggRequest* msg) {
-  return *msg->_impl_.time_range_;
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
+AggPerformanceRow::_Internal::time_bucket(const AggPerformanceRow* msg) {
+  return *msg->_impl_.time_bucket_;
 }
-const ::metricsys::aggregation::Pagination&
-GetPerformanceAggRequest::_Internal::pagination(const GetPerformanceAggRequest* msg) {
-  return *msg->_impl_.pagination_;
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
+AggPerformanceRow::_Internal::created_at(const AggPerformanceRow* msg) {
+  return *msg->_impl_.created_at_;
 }
-GetPerformanceAggRequest::GetPerformanceAggRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+void AggPerformanceRow::clear_time_bucket() {
+  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
+    delete _impl_.time_bucket_;
+  }
+  _impl_.time_bucket_ = nullptr;
+}
+void AggPerformanceRow::clear_created_at() {
+  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
+    delete _impl_.created_at_;
+  }
+  _impl_.created_at_ = nullptr;
+}
+AggPerformanceRow::AggPerformanceRow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetPerformanceAggRequest)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.AggPerformanceRow)
 }
-GetPerformanceAggRequest::GetPerformanceAggRequest(const GetPerformanceAggRequest& from)
+AggPerformanceRow::AggPerformanceRow(const AggPerformanceRow& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GetPerformanceAggRequest* const _this = this; (void)_this;
+  AggPerformanceRow* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
+      decltype(_impl_.quantiles_){from._impl_.quantiles_}
     , decltype(_impl_.project_id_){}
     , decltype(_impl_.page_){}
-    , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.time_bucket_){nullptr}
+    , decltype(_impl_.created_at_){nullptr}
+    , decltype(_impl_.samples_count_){}
+    , decltype(_impl_.avg_total_load_ms_){}
+    , decltype(_impl_.p95_total_load_ms_){}
+    , decltype(_impl_.avg_ttfb_ms_){}
+    , decltype(_impl_.p95_ttfb_ms_){}
+    , decltype(_impl_.avg_fcp_ms_){}
+    , decltype(_impl_.p95_fcp_ms_){}
+    , decltype(_impl_.avg_lcp_ms_){}
+    , decltype(_impl_.p95_lcp_ms_){}
+    , decltype(_impl_.step_seconds_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.project_id_.InitDefault();
@@ -4236,30 +4204,43 @@ GetPerformanceAggRequest::GetPerformanceAggRequest(const GetPerformanceAggReques
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.page_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_page()) {
+  if (!from._internal_page().empty()) {
     _this->_impl_.page_.Set(from._internal_page(), 
       _this->GetArenaForAllocation());
   }
-  if (from._internal_has_time_range()) {
-    _this->_impl_.time_range_ = new ::metricsys::aggregation::TimeRange(*from._impl_.time_range_);
+  if (from._internal_has_time_bucket()) {
+    _this->_impl_.time_bucket_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.time_bucket_);
   }
-  if (from._internal_has_pagination()) {
-    _this->_impl_.pagination_ = new ::metricsys::aggregation::Pagination(*from._impl_.pagination_);
+  if (from._internal_has_created_at()) {
+    _this->_impl_.created_at_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.created_at_);
   }
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetPerformanceAggRequest)
+  ::memcpy(&_impl_.samples_count_, &from._impl_.samples_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.step_seconds_) -
+    reinterpret_cast<char*>(&_impl_.samples_count_)) + sizeof(_impl_.step_seconds_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.AggPerformanceRow)
 }
 
-inline void GetPerformanceAggRequest::SharedCtor(
+inline void AggPerformanceRow::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
-    , /*decltype(_impl_._cached_size_)*/{}
+      decltype(_impl_.quantiles_){arena}
     , decltype(_impl_.project_id_){}
     , decltype(_impl_.page_){}
-    , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.time_bucket_){nullptr}
+    , decltype(_impl_.created_at_){nullptr}
+    , decltype(_impl_.samples_count_){int64_t{0}}
+    , decltype(_impl_.avg_total_load_ms_){0}
+    , decltype(_impl_.p95_total_load_ms_){0}
+    , decltype(_impl_.avg_ttfb_ms_){0}
+    , decltype(_impl_.p95_ttfb_ms_){0}
+    , decltype(_impl_.avg_fcp_ms_){0}
+    , decltype(_impl_.p95_fcp_ms_){0}
+    , decltype(_impl_.avg_lcp_ms_){0}
+    , decltype(_impl_.p95_lcp_ms_){0}
+    , decltype(_impl_.step_seconds_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
   };
   _impl_.project_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -4271,8 +4252,8 @@ inline void GetPerformanceAggRequest::SharedCtor(
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-GetPerformanceAggRequest::~GetPerformanceAggRequest() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetPerformanceAggRequest)
+AggPerformanceRow::~AggPerformanceRow() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.AggPerformanceRow)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4280,207 +4261,1698 @@ GetPerformanceAggRequest::~GetPerformanceAggRequest() {
   SharedDtor();
 }
 
-inline void GetPerformanceAggRequest::SharedDtor() {
+inline void AggPerformanceRow::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.quantiles_.~RepeatedPtrField();
   _impl_.project_id_.Destroy();
   _impl_.page_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.time_range_;
-  if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.time_bucket_;
+  if (this != internal_default_instance()) delete _impl_.created_at_;
 }
 
-void GetPerformanceAggRequest::SetCachedSize(int size) const {
+void AggPerformanceRow::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GetPerformanceAggRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetPerformanceAggRequest)
+void AggPerformanceRow::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.AggPerformanceRow)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  _impl_.quantiles_.Clear();
   _impl_.project_id_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.page_.ClearNonDefaultToEmpty();
-  }
-  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
-    delete _impl_.time_range_;
+  _impl_.page_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
+    delete _impl_.time_bucket_;
   }
-  _impl_.time_range_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
-    delete _impl_.pagination_;
+  _impl_.time_bucket_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
+    delete _impl_.created_at_;
   }
-  _impl_.pagination_ = nullptr;
-  _impl_._has_bits_.Clear();
+  _impl_.created_at_ = nullptr;
+  ::memset(&_impl_.samples_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.step_seconds_) -
+      reinterpret_cast<char*>(&_impl_.samples_count_)) + sizeof(_impl_.step_seconds_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetPerformanceAggRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* AggPerformanceRow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string project_id = 1;
+      // .google.protobuf.Timestamp time_bucket = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_project_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ctx->ParseMessage(_internal_mutable_time_bucket(), ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetPerformanceAggRequest.project_id"));
         } else
           goto handle_unusual;
         continue;
-      // .metricsys.aggregation.TimeRange time_range = 2;
+      // string project_id = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          auto str = _internal_mutable_project_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggPerformanceRow.project_id"));
         } else
           goto handle_unusual;
         continue;
-      // optional string page = 3;
+      // string page = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           auto str = _internal_mutable_page();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetPerformanceAggRequest.page"));
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggPerformanceRow.page"));
         } else
           goto handle_unusual;
         continue;
-      // .metricsys.aggregation.Pagination pagination = 4;
+      // int64 samples_count = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.samples_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  _impl_._has_bits_.Or(has_bits);
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-uint8_t* GetPerformanceAggRequest::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetPerformanceAggRequest)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
+      // double avg_total_load_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _impl_.avg_total_load_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p95_total_load_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _impl_.p95_total_load_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double avg_ttfb_ms = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _impl_.avg_ttfb_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p95_ttfb_ms = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 65)) {
+          _impl_.p95_ttfb_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double avg_fcp_ms = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _impl_.avg_fcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p95_fcp_ms = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 81)) {
+          _impl_.p95_fcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double avg_lcp_ms = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 89)) {
+          _impl_.avg_lcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double p95_lcp_ms = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _impl_.p95_lcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.Timestamp created_at = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_created_at(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .metricsys.aggregation.PerformanceQuantile quantiles = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_quantiles(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 step_seconds = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AggPerformanceRow::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.AggPerformanceRow)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Timestamp time_bucket = 1;
+  if (this->_internal_has_time_bucket()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time_bucket(this),
+        _Internal::time_bucket(this).GetCachedSize(), target, stream);
+  }
+
+  // string project_id = 2;
+  if (!this->_internal_project_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.AggPerformanceRow.project_id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_project_id(), target);
+  }
+
+  // string page = 3;
+  if (!this->_internal_page().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.AggPerformanceRow.page");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_page(), target);
+  }
+
+  // int64 samples_count = 4;
+  if (this->_internal_samples_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_samples_count(), target);
+  }
+
+  // double avg_total_load_ms = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_total_load_ms = this->_internal_avg_total_load_ms();
+  uint64_t raw_avg_total_load_ms;
+  memcpy(&raw_avg_total_load_ms, &tmp_avg_total_load_ms, sizeof(tmp_avg_total_load_ms));
+  if (raw_avg_total_load_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_avg_total_load_ms(), target);
+  }
+
+  // double p95_total_load_ms = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_total_load_ms = this->_internal_p95_total_load_ms();
+  uint64_t raw_p95_total_load_ms;
+  memcpy(&raw_p95_total_load_ms, &tmp_p95_total_load_ms, sizeof(tmp_p95_total_load_ms));
+  if (raw_p95_total_load_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_p95_total_load_ms(), target);
+  }
+
+  // double avg_ttfb_ms = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_ttfb_ms = this->_internal_avg_ttfb_ms();
+  uint64_t raw_avg_ttfb_ms;
+  memcpy(&raw_avg_ttfb_ms, &tmp_avg_ttfb_ms, sizeof(tmp_avg_ttfb_ms));
+  if (raw_avg_ttfb_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_avg_ttfb_ms(), target);
+  }
+
+  // double p95_ttfb_ms = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_ttfb_ms = this->_internal_p95_ttfb_ms();
+  uint64_t raw_p95_ttfb_ms;
+  memcpy(&raw_p95_ttfb_ms, &tmp_p95_ttfb_ms, sizeof(tmp_p95_ttfb_ms));
+  if (raw_p95_ttfb_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(8, this->_internal_p95_ttfb_ms(), target);
+  }
+
+  // double avg_fcp_ms = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_fcp_ms = this->_internal_avg_fcp_ms();
+  uint64_t raw_avg_fcp_ms;
+  memcpy(&raw_avg_fcp_ms, &tmp_avg_fcp_ms, sizeof(tmp_avg_fcp_ms));
+  if (raw_avg_fcp_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_avg_fcp_ms(), target);
+  }
+
+  // double p95_fcp_ms = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_fcp_ms = this->_internal_p95_fcp_ms();
+  uint64_t raw_p95_fcp_ms;
+  memcpy(&raw_p95_fcp_ms, &tmp_p95_fcp_ms, sizeof(tmp_p95_fcp_ms));
+  if (raw_p95_fcp_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(10, this->_internal_p95_fcp_ms(), target);
+  }
+
+  // double avg_lcp_ms = 11;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_lcp_ms = this->_internal_avg_lcp_ms();
+  uint64_t raw_avg_lcp_ms;
+  memcpy(&raw_avg_lcp_ms, &tmp_avg_lcp_ms, sizeof(tmp_avg_lcp_ms));
+  if (raw_avg_lcp_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(11, this->_internal_avg_lcp_ms(), target);
+  }
+
+  // double p95_lcp_ms = 12;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_lcp_ms = this->_internal_p95_lcp_ms();
+  uint64_t raw_p95_lcp_ms;
+  memcpy(&raw_p95_lcp_ms, &tmp_p95_lcp_ms, sizeof(tmp_p95_lcp_ms));
+  if (raw_p95_lcp_ms != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_p95_lcp_ms(), target);
+  }
+
+  // .google.protobuf.Timestamp created_at = 13;
+  if (this->_internal_has_created_at()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::created_at(this),
+        _Internal::created_at(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .metricsys.aggregation.PerformanceQuantile quantiles = 14;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_quantiles_size()); i < n; i++) {
+    const auto& repfield = this->_internal_quantiles(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(14, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint32 step_seconds = 15;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(15, this->_internal_step_seconds(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.AggPerformanceRow)
+  return target;
+}
+
+size_t AggPerformanceRow::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.AggPerformanceRow)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .metricsys.aggregation.PerformanceQuantile quantiles = 14;
+  total_size += 1UL * this->_internal_quantiles_size();
+  for (const auto& msg : this->_impl_.quantiles_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string project_id = 2;
+  if (!this->_internal_project_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_project_id());
+  }
+
+  // string page = 3;
+  if (!this->_internal_page().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
+  }
+
+  // .google.protobuf.Timestamp time_bucket = 1;
+  if (this->_internal_has_time_bucket()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.time_bucket_);
+  }
+
+  // .google.protobuf.Timestamp created_at = 13;
+  if (this->_internal_has_created_at()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.created_at_);
+  }
+
+  // int64 samples_count = 4;
+  if (this->_internal_samples_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_samples_count());
+  }
+
+  // double avg_total_load_ms = 5;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_total_load_ms = this->_internal_avg_total_load_ms();
+  uint64_t raw_avg_total_load_ms;
+  memcpy(&raw_avg_total_load_ms, &tmp_avg_total_load_ms, sizeof(tmp_avg_total_load_ms));
+  if (raw_avg_total_load_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p95_total_load_ms = 6;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_total_load_ms = this->_internal_p95_total_load_ms();
+  uint64_t raw_p95_total_load_ms;
+  memcpy(&raw_p95_total_load_ms, &tmp_p95_total_load_ms, sizeof(tmp_p95_total_load_ms));
+  if (raw_p95_total_load_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double avg_ttfb_ms = 7;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_ttfb_ms = this->_internal_avg_ttfb_ms();
+  uint64_t raw_avg_ttfb_ms;
+  memcpy(&raw_avg_ttfb_ms, &tmp_avg_ttfb_ms, sizeof(tmp_avg_ttfb_ms));
+  if (raw_avg_ttfb_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p95_ttfb_ms = 8;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_ttfb_ms = this->_internal_p95_ttfb_ms();
+  uint64_t raw_p95_ttfb_ms;
+  memcpy(&raw_p95_ttfb_ms, &tmp_p95_ttfb_ms, sizeof(tmp_p95_ttfb_ms));
+  if (raw_p95_ttfb_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double avg_fcp_ms = 9;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_fcp_ms = this->_internal_avg_fcp_ms();
+  uint64_t raw_avg_fcp_ms;
+  memcpy(&raw_avg_fcp_ms, &tmp_avg_fcp_ms, sizeof(tmp_avg_fcp_ms));
+  if (raw_avg_fcp_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p95_fcp_ms = 10;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_fcp_ms = this->_internal_p95_fcp_ms();
+  uint64_t raw_p95_fcp_ms;
+  memcpy(&raw_p95_fcp_ms, &tmp_p95_fcp_ms, sizeof(tmp_p95_fcp_ms));
+  if (raw_p95_fcp_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double avg_lcp_ms = 11;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_lcp_ms = this->_internal_avg_lcp_ms();
+  uint64_t raw_avg_lcp_ms;
+  memcpy(&raw_avg_lcp_ms, &tmp_avg_lcp_ms, sizeof(tmp_avg_lcp_ms));
+  if (raw_avg_lcp_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double p95_lcp_ms = 12;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_lcp_ms = this->_internal_p95_lcp_ms();
+  uint64_t raw_p95_lcp_ms;
+  memcpy(&raw_p95_lcp_ms, &tmp_p95_lcp_ms, sizeof(tmp_p95_lcp_ms));
+  if (raw_p95_lcp_ms != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 step_seconds = 15;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AggPerformanceRow::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    AggPerformanceRow::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AggPerformanceRow::GetClassData() const { return &_class_data_; }
+
+
+void AggPerformanceRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AggPerformanceRow*>(&to_msg);
+  auto& from = static_cast<const AggPerformanceRow&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.AggPerformanceRow)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.quantiles_.MergeFrom(from._impl_.quantiles_);
+  if (!from._internal_project_id().empty()) {
+    _this->_internal_set_project_id(from._internal_project_id());
+  }
+  if (!from._internal_page().empty()) {
+    _this->_internal_set_page(from._internal_page());
+  }
+  if (from._internal_has_time_bucket()) {
+    _this->_internal_mutable_time_bucket()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_time_bucket());
+  }
+  if (from._internal_has_created_at()) {
+    _this->_internal_mutable_created_at()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_created_at());
+  }
+  if (from._internal_samples_count() != 0) {
+    _this->_internal_set_samples_count(from._internal_samples_count());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_total_load_ms = from._internal_avg_total_load_ms();
+  uint64_t raw_avg_total_load_ms;
+  memcpy(&raw_avg_total_load_ms, &tmp_avg_total_load_ms, sizeof(tmp_avg_total_load_ms));
+  if (raw_avg_total_load_ms != 0) {
+    _this->_internal_set_avg_total_load_ms(from._internal_avg_total_load_ms());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_total_load_ms = from._internal_p95_total_load_ms();
+  uint64_t raw_p95_total_load_ms;
+  memcpy(&raw_p95_total_load_ms, &tmp_p95_total_load_ms, sizeof(tmp_p95_total_load_ms));
+  if (raw_p95_total_load_ms != 0) {
+    _this->_internal_set_p95_total_load_ms(from._internal_p95_total_load_ms());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_ttfb_ms = from._internal_avg_ttfb_ms();
+  uint64_t raw_avg_ttfb_ms;
+  memcpy(&raw_avg_ttfb_ms, &tmp_avg_ttfb_ms, sizeof(tmp_avg_ttfb_ms));
+  if (raw_avg_ttfb_ms != 0) {
+    _this->_internal_set_avg_ttfb_ms(from._internal_avg_ttfb_ms());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_ttfb_ms = from._internal_p95_ttfb_ms();
+  uint64_t raw_p95_ttfb_ms;
+  memcpy(&raw_p95_ttfb_ms, &tmp_p95_ttfb_ms, sizeof(tmp_p95_ttfb_ms));
+  if (raw_p95_ttfb_ms != 0) {
+    _this->_internal_set_p95_ttfb_ms(from._internal_p95_ttfb_ms());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_fcp_ms = from._internal_avg_fcp_ms();
+  uint64_t raw_avg_fcp_ms;
+  memcpy(&raw_avg_fcp_ms, &tmp_avg_fcp_ms, sizeof(tmp_avg_fcp_ms));
+  if (raw_avg_fcp_ms != 0) {
+    _this->_internal_set_avg_fcp_ms(from._internal_avg_fcp_ms());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_fcp_ms = from._internal_p95_fcp_ms();
+  uint64_t raw_p95_fcp_ms;
+  memcpy(&raw_p95_fcp_ms, &tmp_p95_fcp_ms, sizeof(tmp_p95_fcp_ms));
+  if (raw_p95_fcp_ms != 0) {
+    _this->_internal_set_p95_fcp_ms(from._internal_p95_fcp_ms());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_avg_lcp_ms = from._internal_avg_lcp_ms();
+  uint64_t raw_avg_lcp_ms;
+  memcpy(&raw_avg_lcp_ms, &tmp_avg_lcp_ms, sizeof(tmp_avg_lcp_ms));
+  if (raw_avg_lcp_ms != 0) {
+    _this->_internal_set_avg_lcp_ms(from._internal_avg_lcp_ms());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_p95_lcp_ms = from._internal_p95_lcp_ms();
+  uint64_t raw_p95_lcp_ms;
+  memcpy(&raw_p95_lcp_ms, &tmp_p95_lcp_ms, sizeof(tmp_p95_lcp_ms));
+  if (raw_p95_lcp_ms != 0) {
+    _this->_internal_set_p95_lcp_ms(from._internal_p95_lcp_ms());
+  }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void AggPerformanceRow::CopyFrom(const AggPerformanceRow& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.AggPerformanceRow)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool AggPerformanceRow::IsInitialized() const {
+  return true;
+}
+
+void AggPerformanceRow::InternalSwap(AggPerformanceRow* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.quantiles_.InternalSwap(&other->_impl_.quantiles_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.project_id_, lhs_arena,
+      &other->_impl_.project_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(AggPerformanceRow, _impl_.step_seconds_)
+      + sizeof(AggPerformanceRow::_impl_.step_seconds_)
+      - PROTOBUF_FIELD_OFFSET(AggPerformanceRow, _impl_.time_bucket_)>(
+          reinterpret_cast<char*>(&_impl_.time_bucket_),
+          reinterpret_cast<char*>(&other->_impl_.time_bucket_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata AggPerformanceRow::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
+      file_level_metadata_aggregation_2eproto[11]);
+}
+
+// ===================================================================
+
+class GetPerformanceAggRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetPerformanceAggRequest>()._impl_._has_bits_);
+  static const ::metricsys::aggregation::TimeRange& time_range(const GetPerformanceAggRequest* msg);
+  static void set_has_page(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::metricsys::aggregation::Pagination& pagination(const GetPerformanceAggRequest* msg);
+};
+
+const ::metricsys::aggregation::TimeRange&
+GetPerformanceAggRequest::_Internal::time_range(const GetPerformanceAggRequest* msg) {
+  return *msg->_impl_.time_range_;
+}
+const ::metricsys::aggregation::Pagination&
+GetPerformanceAggRequest::_Internal::pagination(const GetPerformanceAggRequest* msg) {
+  return *msg->_impl_.pagination_;
+}
+GetPerformanceAggRequest::GetPerformanceAggRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetPerformanceAggRequest)
+}
+GetPerformanceAggRequest::GetPerformanceAggRequest(const GetPerformanceAggRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetPerformanceAggRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.quantiles_){from._impl_.quantiles_}
+    , decltype(_impl_.project_id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.merge_buckets_){}
+    , decltype(_impl_.step_seconds_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.project_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_project_id().empty()) {
+    _this->_impl_.project_id_.Set(from._internal_project_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_impl_.time_range_ = new ::metricsys::aggregation::TimeRange(*from._impl_.time_range_);
+  }
+  if (from._internal_has_pagination()) {
+    _this->_impl_.pagination_ = new ::metricsys::aggregation::Pagination(*from._impl_.pagination_);
+  }
+  ::memcpy(&_impl_.merge_buckets_, &from._impl_.merge_buckets_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.step_seconds_) -
+    reinterpret_cast<char*>(&_impl_.merge_buckets_)) + sizeof(_impl_.step_seconds_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetPerformanceAggRequest)
+}
+
+inline void GetPerformanceAggRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.quantiles_){arena}
+    , decltype(_impl_.project_id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.merge_buckets_){false}
+    , decltype(_impl_.step_seconds_){0u}
+  };
+  _impl_.project_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetPerformanceAggRequest::~GetPerformanceAggRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetPerformanceAggRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetPerformanceAggRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.quantiles_.~RepeatedField();
+  _impl_.project_id_.Destroy();
+  _impl_.page_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_range_;
+  if (this != internal_default_instance()) delete _impl_.pagination_;
+}
+
+void GetPerformanceAggRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetPerformanceAggRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetPerformanceAggRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.quantiles_.Clear();
+  _impl_.project_id_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.page_.ClearNonDefaultToEmpty();
+  }
+  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
+    delete _impl_.time_range_;
+  }
+  _impl_.time_range_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
+    delete _impl_.pagination_;
+  }
+  _impl_.pagination_ = nullptr;
+  ::memset(&_impl_.merge_buckets_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.step_seconds_) -
+      reinterpret_cast<char*>(&_impl_.merge_buckets_)) + sizeof(_impl_.step_seconds_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetPerformanceAggRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string project_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_project_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetPerformanceAggRequest.project_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .metricsys.aggregation.TimeRange time_range = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetPerformanceAggRequest.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .metricsys.aggregation.Pagination pagination = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double quantiles = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_quantiles(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 41) {
+          _internal_add_quantiles(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool merge_buckets = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.merge_buckets_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 step_seconds = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetPerformanceAggRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetPerformanceAggRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string project_id = 1;
+  if (!this->_internal_project_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetPerformanceAggRequest.project_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_project_id(), target);
+  }
+
+  // .metricsys.aggregation.TimeRange time_range = 2;
+  if (this->_internal_has_time_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::time_range(this),
+        _Internal::time_range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string page = 3;
+  if (_internal_has_page()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetPerformanceAggRequest.page");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_page(), target);
+  }
+
+  // .metricsys.aggregation.Pagination pagination = 4;
+  if (this->_internal_has_pagination()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::pagination(this),
+        _Internal::pagination(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated double quantiles = 5;
+  if (this->_internal_quantiles_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_quantiles(), target);
+  }
+
+  // bool merge_buckets = 6;
+  if (this->_internal_merge_buckets() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_merge_buckets(), target);
+  }
+
+  // uint32 step_seconds = 7;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_step_seconds(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetPerformanceAggRequest)
+  return target;
+}
+
+size_t GetPerformanceAggRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetPerformanceAggRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated double quantiles = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_quantiles_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // string project_id = 1;
+  if (!this->_internal_project_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_project_id());
+  }
+
+  // optional string page = 3;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
+  }
+
+  // .metricsys.aggregation.TimeRange time_range = 2;
+  if (this->_internal_has_time_range()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.time_range_);
+  }
+
+  // .metricsys.aggregation.Pagination pagination = 4;
+  if (this->_internal_has_pagination()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pagination_);
+  }
+
+  // bool merge_buckets = 6;
+  if (this->_internal_merge_buckets() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint32 step_seconds = 7;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetPerformanceAggRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetPerformanceAggRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetPerformanceAggRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetPerformanceAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetPerformanceAggRequest*>(&to_msg);
+  auto& from = static_cast<const GetPerformanceAggRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetPerformanceAggRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.quantiles_.MergeFrom(from._impl_.quantiles_);
+  if (!from._internal_project_id().empty()) {
+    _this->_internal_set_project_id(from._internal_project_id());
+  }
+  if (from._internal_has_page()) {
+    _this->_internal_set_page(from._internal_page());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_internal_mutable_time_range()->::metricsys::aggregation::TimeRange::MergeFrom(
+        from._internal_time_range());
+  }
+  if (from._internal_has_pagination()) {
+    _this->_internal_mutable_pagination()->::metricsys::aggregation::Pagination::MergeFrom(
+        from._internal_pagination());
+  }
+  if (from._internal_merge_buckets() != 0) {
+    _this->_internal_set_merge_buckets(from._internal_merge_buckets());
+  }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetPerformanceAggRequest::CopyFrom(const GetPerformanceAggRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetPerformanceAggRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetPerformanceAggRequest::IsInitialized() const {
+  return true;
+}
+
+void GetPerformanceAggRequest::InternalSwap(GetPerformanceAggRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.quantiles_.InternalSwap(&other->_impl_.quantiles_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.project_id_, lhs_arena,
+      &other->_impl_.project_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetPerformanceAggRequest, _impl_.step_seconds_)
+      + sizeof(GetPerformanceAggRequest::_impl_.step_seconds_)
+      - PROTOBUF_FIELD_OFFSET(GetPerformanceAggRequest, _impl_.time_range_)>(
+          reinterpret_cast<char*>(&_impl_.time_range_),
+          reinterpret_cast<char*>(&other->_impl_.time_range_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetPerformanceAggRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
+      file_level_metadata_aggregation_2eproto[12]);
+}
+
+// ===================================================================
+
+class GetPerformanceAggResponse::_Internal {
+ public:
+};
+
+GetPerformanceAggResponse::GetPerformanceAggResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetPerformanceAggResponse)
+}
+GetPerformanceAggResponse::GetPerformanceAggResponse(const GetPerformanceAggResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetPerformanceAggResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rows_){from._impl_.rows_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetPerformanceAggResponse)
+}
+
+inline void GetPerformanceAggResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rows_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+GetPerformanceAggResponse::~GetPerformanceAggResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetPerformanceAggResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetPerformanceAggResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rows_.~RepeatedPtrField();
+}
+
+void GetPerformanceAggResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetPerformanceAggResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetPerformanceAggResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rows_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetPerformanceAggResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .metricsys.aggregation.AggPerformanceRow rows = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rows(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetPerformanceAggResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetPerformanceAggResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .metricsys.aggregation.AggPerformanceRow rows = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rows_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rows(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetPerformanceAggResponse)
+  return target;
+}
+
+size_t GetPerformanceAggResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetPerformanceAggResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .metricsys.aggregation.AggPerformanceRow rows = 1;
+  total_size += 1UL * this->_internal_rows_size();
+  for (const auto& msg : this->_impl_.rows_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetPerformanceAggResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetPerformanceAggResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetPerformanceAggResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetPerformanceAggResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetPerformanceAggResponse*>(&to_msg);
+  auto& from = static_cast<const GetPerformanceAggResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetPerformanceAggResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rows_.MergeFrom(from._impl_.rows_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetPerformanceAggResponse::CopyFrom(const GetPerformanceAggResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetPerformanceAggResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetPerformanceAggResponse::IsInitialized() const {
+  return true;
+}
+
+void GetPerformanceAggResponse::InternalSwap(GetPerformanceAggResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.rows_.InternalSwap(&other->_impl_.rows_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetPerformanceAggResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
+      file_level_metadata_aggregation_2eproto[13]);
+}
+
+// ===================================================================
+
+class AggErrorsRow::_Internal {
+ public:
+  using HasBits = decltype(std::declval<AggErrorsRow>()._impl_._has_bits_);
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& time_bucket(const AggErrorsRow* msg);
+  static void set_has_error_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& created_at(const AggErrorsRow* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
+AggErrorsRow::_Internal::time_bucket(const AggErrorsRow* msg) {
+  return *msg->_impl_.time_bucket_;
+}
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
+AggErrorsRow::_Internal::created_at(const AggErrorsRow* msg) {
+  return *msg->_impl_.created_at_;
+}
+void AggErrorsRow::clear_time_bucket() {
+  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
+    delete _impl_.time_bucket_;
+  }
+  _impl_.time_bucket_ = nullptr;
+}
+void AggErrorsRow::clear_created_at() {
+  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
+    delete _impl_.created_at_;
+  }
+  _impl_.created_at_ = nullptr;
+}
+AggErrorsRow::AggErrorsRow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.AggErrorsRow)
+}
+AggErrorsRow::AggErrorsRow(const AggErrorsRow& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  AggErrorsRow* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.project_id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.error_type_){}
+    , decltype(_impl_.time_bucket_){nullptr}
+    , decltype(_impl_.created_at_){nullptr}
+    , decltype(_impl_.errors_count_){}
+    , decltype(_impl_.warning_count_){}
+    , decltype(_impl_.critical_count_){}
+    , decltype(_impl_.unique_users_){}
+    , decltype(_impl_.step_seconds_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.project_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_project_id().empty()) {
+    _this->_impl_.project_id_.Set(from._internal_project_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_page().empty()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error_type()) {
+    _this->_impl_.error_type_.Set(from._internal_error_type(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_bucket()) {
+    _this->_impl_.time_bucket_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.time_bucket_);
+  }
+  if (from._internal_has_created_at()) {
+    _this->_impl_.created_at_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.created_at_);
+  }
+  ::memcpy(&_impl_.errors_count_, &from._impl_.errors_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.step_seconds_) -
+    reinterpret_cast<char*>(&_impl_.errors_count_)) + sizeof(_impl_.step_seconds_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.AggErrorsRow)
+}
+
+inline void AggErrorsRow::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.project_id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.error_type_){}
+    , decltype(_impl_.time_bucket_){nullptr}
+    , decltype(_impl_.created_at_){nullptr}
+    , decltype(_impl_.errors_count_){int64_t{0}}
+    , decltype(_impl_.warning_count_){int64_t{0}}
+    , decltype(_impl_.critical_count_){int64_t{0}}
+    , decltype(_impl_.unique_users_){int64_t{0}}
+    , decltype(_impl_.step_seconds_){0u}
+  };
+  _impl_.project_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+AggErrorsRow::~AggErrorsRow() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.AggErrorsRow)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void AggErrorsRow::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.project_id_.Destroy();
+  _impl_.page_.Destroy();
+  _impl_.error_type_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_bucket_;
+  if (this != internal_default_instance()) delete _impl_.created_at_;
+}
+
+void AggErrorsRow::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void AggErrorsRow::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.AggErrorsRow)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.project_id_.ClearToEmpty();
+  _impl_.page_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_type_.ClearNonDefaultToEmpty();
+  }
+  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
+    delete _impl_.time_bucket_;
+  }
+  _impl_.time_bucket_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
+    delete _impl_.created_at_;
+  }
+  _impl_.created_at_ = nullptr;
+  ::memset(&_impl_.errors_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.step_seconds_) -
+      reinterpret_cast<char*>(&_impl_.errors_count_)) + sizeof(_impl_.step_seconds_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* AggErrorsRow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .google.protobuf.Timestamp time_bucket = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_bucket(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string project_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_project_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggErrorsRow.project_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string page = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggErrorsRow.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error_type = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_error_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggErrorsRow.error_type"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 errors_count = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.errors_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 warning_count = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.warning_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 critical_count = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.critical_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 unique_users = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.unique_users_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.Timestamp created_at = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_created_at(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 step_seconds = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* AggErrorsRow::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.AggErrorsRow)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .google.protobuf.Timestamp time_bucket = 1;
+  if (this->_internal_has_time_bucket()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time_bucket(this),
+        _Internal::time_bucket(this).GetCachedSize(), target, stream);
+  }
 
-  // string project_id = 1;
+  // string project_id = 2;
   if (!this->_internal_project_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.GetPerformanceAggRequest.project_id");
+      "metricsys.aggregation.AggErrorsRow.project_id");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_project_id(), target);
-  }
-
-  // .metricsys.aggregation.TimeRange time_range = 2;
-  if (this->_internal_has_time_range()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::time_range(this),
-        _Internal::time_range(this).GetCachedSize(), target, stream);
+        2, this->_internal_project_id(), target);
   }
 
-  // optional string page = 3;
-  if (_internal_has_page()) {
+  // string page = 3;
+  if (!this->_internal_page().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.GetPerformanceAggRequest.page");
+      "metricsys.aggregation.AggErrorsRow.page");
     target = stream->WriteStringMaybeAliased(
         3, this->_internal_page(), target);
   }
 
-  // .metricsys.aggregation.Pagination pagination = 4;
-  if (this->_internal_has_pagination()) {
+  // optional string error_type = 4;
+  if (_internal_has_error_type()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_type().data(), static_cast<int>(this->_internal_error_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.AggErrorsRow.error_type");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_error_type(), target);
+  }
+
+  // int64 errors_count = 5;
+  if (this->_internal_errors_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_errors_count(), target);
+  }
+
+  // int64 warning_count = 6;
+  if (this->_internal_warning_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_warning_count(), target);
+  }
+
+  // int64 critical_count = 7;
+  if (this->_internal_critical_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_critical_count(), target);
+  }
+
+  // int64 unique_users = 8;
+  if (this->_internal_unique_users() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_unique_users(), target);
+  }
+
+  // .google.protobuf.Timestamp created_at = 9;
+  if (this->_internal_has_created_at()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, _Internal::pagination(this),
-        _Internal::pagination(this).GetCachedSize(), target, stream);
+      InternalWriteMessage(9, _Internal::created_at(this),
+        _Internal::created_at(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 step_seconds = 10;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_step_seconds(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetPerformanceAggRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.AggErrorsRow)
   return target;
 }
 
-size_t GetPerformanceAggRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetPerformanceAggRequest)
+size_t AggErrorsRow::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.AggErrorsRow)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string project_id = 1;
+  // string project_id = 2;
   if (!this->_internal_project_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_project_id());
   }
 
-  // optional string page = 3;
+  // string page = 3;
+  if (!this->_internal_page().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
+  }
+
+  // optional string error_type = 4;
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_page());
+        this->_internal_error_type());
   }
 
-  // .metricsys.aggregation.TimeRange time_range = 2;
-  if (this->_internal_has_time_range()) {
+  // .google.protobuf.Timestamp time_bucket = 1;
+  if (this->_internal_has_time_bucket()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.time_range_);
+        *_impl_.time_bucket_);
   }
 
-  // .metricsys.aggregation.Pagination pagination = 4;
-  if (this->_internal_has_pagination()) {
+  // .google.protobuf.Timestamp created_at = 9;
+  if (this->_internal_has_created_at()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.pagination_);
+        *_impl_.created_at_);
+  }
+
+  // int64 errors_count = 5;
+  if (this->_internal_errors_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_errors_count());
+  }
+
+  // int64 warning_count = 6;
+  if (this->_internal_warning_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_warning_count());
+  }
+
+  // int64 critical_count = 7;
+  if (this->_internal_critical_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_critical_count());
+  }
+
+  // int64 unique_users = 8;
+  if (this->_internal_unique_users() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_users());
+  }
+
+  // uint32 step_seconds = 10;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetPerformanceAggRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AggErrorsRow::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GetPerformanceAggRequest::MergeImpl
+    AggErrorsRow::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetPerformanceAggRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AggErrorsRow::GetClassData() const { return &_class_data_; }
 
 
-void GetPerformanceAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GetPerformanceAggRequest*>(&to_msg);
-  auto& from = static_cast<const GetPerformanceAggRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetPerformanceAggRequest)
+void AggErrorsRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AggErrorsRow*>(&to_msg);
+  auto& from = static_cast<const AggErrorsRow&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.AggErrorsRow)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -4488,32 +5960,50 @@ void GetPerformanceAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_ms
   if (!from._internal_project_id().empty()) {
     _this->_internal_set_project_id(from._internal_project_id());
   }
-  if (from._internal_has_page()) {
+  if (!from._internal_page().empty()) {
     _this->_internal_set_page(from._internal_page());
   }
-  if (from._internal_has_time_range()) {
-    _this->_internal_mutable_time_range()->::metricsys::aggregation::TimeRange::MergeFrom(
-        from._internal_time_range());
+  if (from._internal_has_error_type()) {
+    _this->_internal_set_error_type(from._internal_error_type());
   }
-  if (from._internal_has_pagination()) {
-    _this->_internal_mutable_pagination()->::metricsys::aggregation::Pagination::MergeFrom(
-        from._internal_pagination());
+  if (from._internal_has_time_bucket()) {
+    _this->_internal_mutable_time_bucket()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_time_bucket());
+  }
+  if (from._internal_has_created_at()) {
+    _this->_internal_mutable_created_at()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_created_at());
+  }
+  if (from._internal_errors_count() != 0) {
+    _this->_internal_set_errors_count(from._internal_errors_count());
+  }
+  if (from._internal_warning_count() != 0) {
+    _this->_internal_set_warning_count(from._internal_warning_count());
+  }
+  if (from._internal_critical_count() != 0) {
+    _this->_internal_set_critical_count(from._internal_critical_count());
+  }
+  if (from._internal_unique_users() != 0) {
+    _this->_internal_set_unique_users(from._internal_unique_users());
+  }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GetPerformanceAggRequest::CopyFrom(const GetPerformanceAggRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetPerformanceAggRequest)
+void AggErrorsRow::CopyFrom(const AggErrorsRow& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.AggErrorsRow)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetPerformanceAggRequest::IsInitialized() const {
+bool AggErrorsRow::IsInitialized() const {
   return true;
 }
 
-void GetPerformanceAggRequest::InternalSwap(GetPerformanceAggRequest* other) {
+void AggErrorsRow::InternalSwap(AggErrorsRow* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -4527,55 +6017,131 @@ void GetPerformanceAggRequest::InternalSwap(GetPerformanceAggRequest* other) {
       &_impl_.page_, lhs_arena,
       &other->_impl_.page_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_type_, lhs_arena,
+      &other->_impl_.error_type_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetPerformanceAggRequest, _impl_.pagination_)
-      + sizeof(GetPerformanceAggRequest::_impl_.pagination_)
-      - PROTOBUF_FIELD_OFFSET(GetPerformanceAggRequest, _impl_.time_range_)>(
-          reinterpret_cast<char*>(&_impl_.time_range_),
-          reinterpret_cast<char*>(&other->_impl_.time_range_));
+      PROTOBUF_FIELD_OFFSET(AggErrorsRow, _impl_.step_seconds_)
+      + sizeof(AggErrorsRow::_impl_.step_seconds_)
+      - PROTOBUF_FIELD_OFFSET(AggErrorsRow, _impl_.time_bucket_)>(
+          reinterpret_cast<char*>(&_impl_.time_bucket_),
+          reinterpret_cast<char*>(&other->_impl_.time_bucket_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetPerformanceAggRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata AggErrorsRow::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
-      file_level_metadata_aggregation_2eproto[11]);
+      file_level_metadata_aggregation_2eproto[14]);
 }
 
 // ===================================================================
 
-class GetPerformanceAggResponse::_Internal {
+class GetErrorsAggRequest::_Internal {
  public:
+  using HasBits = decltype(std::declval<GetErrorsAggRequest>()._impl_._has_bits_);
+  static const ::metricsys::aggregation::TimeRange& time_range(const GetErrorsAggRequest* msg);
+  static void set_has_page(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_error_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::metricsys::aggregation::Pagination& pagination(const GetErrorsAggRequest* msg);
 };
 
-GetPerformanceAggResponse::GetPerformanceAggResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::metricsys::aggregation::TimeRange&
+GetErrorsAggRequest::_Internal::time_range(const GetErrorsAggRequest* msg) {
+  return *msg->_impl_.time_range_;
+}
+const ::metricsys::aggregation::Pagination&
+GetErrorsAggRequest::_Internal::pagination(const GetErrorsAggRequest* msg) {
+  return *msg->_impl_.pagination_;
+}
+GetErrorsAggRequest::GetErrorsAggRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetPerformanceAggResponse)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetErrorsAggRequest)
 }
-GetPerformanceAggResponse::GetPerformanceAggResponse(const GetPerformanceAggResponse& from)
+GetErrorsAggRequest::GetErrorsAggRequest(const GetErrorsAggRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GetPerformanceAggResponse* const _this = this; (void)_this;
+  GetErrorsAggRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.rows_){from._impl_.rows_}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.project_id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.error_type_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.step_seconds_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetPerformanceAggResponse)
+  _impl_.project_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_project_id().empty()) {
+    _this->_impl_.project_id_.Set(from._internal_project_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error_type()) {
+    _this->_impl_.error_type_.Set(from._internal_error_type(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_impl_.time_range_ = new ::metricsys::aggregation::TimeRange(*from._impl_.time_range_);
+  }
+  if (from._internal_has_pagination()) {
+    _this->_impl_.pagination_ = new ::metricsys::aggregation::Pagination(*from._impl_.pagination_);
+  }
+  _this->_impl_.step_seconds_ = from._impl_.step_seconds_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetErrorsAggRequest)
 }
 
-inline void GetPerformanceAggResponse::SharedCtor(
+inline void GetErrorsAggRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.rows_){arena}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.project_id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.error_type_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.step_seconds_){0u}
   };
+  _impl_.project_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-GetPerformanceAggResponse::~GetPerformanceAggResponse() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetPerformanceAggResponse)
+GetErrorsAggRequest::~GetErrorsAggRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetErrorsAggRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4583,41 +6149,106 @@ GetPerformanceAggResponse::~GetPerformanceAggResponse() {
   SharedDtor();
 }
 
-inline void GetPerformanceAggResponse::SharedDtor() {
+inline void GetErrorsAggRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.rows_.~RepeatedPtrField();
+  _impl_.project_id_.Destroy();
+  _impl_.page_.Destroy();
+  _impl_.error_type_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_range_;
+  if (this != internal_default_instance()) delete _impl_.pagination_;
 }
 
-void GetPerformanceAggResponse::SetCachedSize(int size) const {
+void GetErrorsAggRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GetPerformanceAggResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetPerformanceAggResponse)
+void GetErrorsAggRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetErrorsAggRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.rows_.Clear();
+  _impl_.project_id_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.page_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.error_type_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
+    delete _impl_.time_range_;
+  }
+  _impl_.time_range_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
+    delete _impl_.pagination_;
+  }
+  _impl_.pagination_ = nullptr;
+  _impl_.step_seconds_ = 0u;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetPerformanceAggResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* GetErrorsAggRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .metricsys.aggregation.AggPerformanceRow rows = 1;
+      // string project_id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_rows(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          auto str = _internal_mutable_project_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetErrorsAggRequest.project_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .metricsys.aggregation.TimeRange time_range = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetErrorsAggRequest.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error_type = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_error_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetErrorsAggRequest.error_type"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .metricsys.aggregation.Pagination pagination = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 step_seconds = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -4637,6 +6268,7 @@ const char* GetPerformanceAggResponse::_InternalParse(const char* ptr, ::_pbi::P
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -4644,212 +6276,243 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GetPerformanceAggResponse::_InternalSerialize(
+uint8_t* GetErrorsAggRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetPerformanceAggResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetErrorsAggRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .metricsys.aggregation.AggPerformanceRow rows = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_rows_size()); i < n; i++) {
-    const auto& repfield = this->_internal_rows(i);
+  // string project_id = 1;
+  if (!this->_internal_project_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetErrorsAggRequest.project_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_project_id(), target);
+  }
+
+  // .metricsys.aggregation.TimeRange time_range = 2;
+  if (this->_internal_has_time_range()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+      InternalWriteMessage(2, _Internal::time_range(this),
+        _Internal::time_range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string page = 3;
+  if (_internal_has_page()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetErrorsAggRequest.page");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_page(), target);
+  }
+
+  // optional string error_type = 4;
+  if (_internal_has_error_type()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_type().data(), static_cast<int>(this->_internal_error_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetErrorsAggRequest.error_type");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_error_type(), target);
+  }
+
+  // .metricsys.aggregation.Pagination pagination = 5;
+  if (this->_internal_has_pagination()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::pagination(this),
+        _Internal::pagination(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 step_seconds = 6;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_step_seconds(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetPerformanceAggResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetErrorsAggRequest)
   return target;
 }
 
-size_t GetPerformanceAggResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetPerformanceAggResponse)
+size_t GetErrorsAggRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetErrorsAggRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .metricsys.aggregation.AggPerformanceRow rows = 1;
-  total_size += 1UL * this->_internal_rows_size();
-  for (const auto& msg : this->_impl_.rows_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // string project_id = 1;
+  if (!this->_internal_project_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_project_id());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string page = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_page());
+    }
+
+    // optional string error_type = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error_type());
+    }
+
+  }
+  // .metricsys.aggregation.TimeRange time_range = 2;
+  if (this->_internal_has_time_range()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.time_range_);
+  }
+
+  // .metricsys.aggregation.Pagination pagination = 5;
+  if (this->_internal_has_pagination()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pagination_);
+  }
+
+  // uint32 step_seconds = 6;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetPerformanceAggResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetErrorsAggRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GetPerformanceAggResponse::MergeImpl
+    GetErrorsAggRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetPerformanceAggResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetErrorsAggRequest::GetClassData() const { return &_class_data_; }
 
 
-void GetPerformanceAggResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GetPerformanceAggResponse*>(&to_msg);
-  auto& from = static_cast<const GetPerformanceAggResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetPerformanceAggResponse)
+void GetErrorsAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetErrorsAggRequest*>(&to_msg);
+  auto& from = static_cast<const GetErrorsAggRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetErrorsAggRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.rows_.MergeFrom(from._impl_.rows_);
+  if (!from._internal_project_id().empty()) {
+    _this->_internal_set_project_id(from._internal_project_id());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_page(from._internal_page());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_error_type(from._internal_error_type());
+    }
+  }
+  if (from._internal_has_time_range()) {
+    _this->_internal_mutable_time_range()->::metricsys::aggregation::TimeRange::MergeFrom(
+        from._internal_time_range());
+  }
+  if (from._internal_has_pagination()) {
+    _this->_internal_mutable_pagination()->::metricsys::aggregation::Pagination::MergeFrom(
+        from._internal_pagination());
+  }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
-
-void GetPerformanceAggResponse::CopyFrom(const GetPerformanceAggResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetPerformanceAggResponse)
+
+void GetErrorsAggRequest::CopyFrom(const GetErrorsAggRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetErrorsAggRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetPerformanceAggResponse::IsInitialized() const {
+bool GetErrorsAggRequest::IsInitialized() const {
   return true;
 }
 
-void GetPerformanceAggResponse::InternalSwap(GetPerformanceAggResponse* other) {
+void GetErrorsAggRequest::InternalSwap(GetErrorsAggRequest* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.rows_.InternalSwap(&other->_impl_.rows_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.project_id_, lhs_arena,
+      &other->_impl_.project_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_type_, lhs_arena,
+      &other->_impl_.error_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetErrorsAggRequest, _impl_.step_seconds_)
+      + sizeof(GetErrorsAggRequest::_impl_.step_seconds_)
+      - PROTOBUF_FIELD_OFFSET(GetErrorsAggRequest, _impl_.time_range_)>(
+          reinterpret_cast<char*>(&_impl_.time_range_),
+          reinterpret_cast<char*>(&other->_impl_.time_range_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetPerformanceAggResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetErrorsAggRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
-      file_level_metadata_aggregation_2eproto[12]);
+      file_level_metadata_aggregation_2eproto[15]);
 }
 
 // ===================================================================
 
-class AggErrorsRow::_Internal {
+class GetErrorsAggResponse::_Internal {
  public:
-  using HasBits = decltype(std::declval<AggErrorsRow>()._impl_._has_bits_);
-  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& time_bucket(const AggErrorsRow* msg);
-  static void set_has_error_type(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& created_at(const AggErrorsRow* msg);
 };
 
-const ::PROTOBUF_NAMESPACE_ID::Timestamp&
-AggErrorsRow::_Internal::time_bucket(const AggErrorsRow* msg) {
-  return *msg->_impl_.time_bucket_;
-}
-const ::PROTOBUF_NAMESPACE_ID::Timestamp&
-AggErrorsRow::_Internal::created_at(const AggErrorsRow* msg) {
-  return *msg->_impl_.created_at_;
-}
-void AggErrorsRow::clear_time_bucket() {
-  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
-    delete _impl_.time_bucket_;
-  }
-  _impl_.time_bucket_ = nullptr;
-}
-void AggErrorsRow::clear_created_at() {
-  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
-    delete _impl_.created_at_;
-  }
-  _impl_.created_at_ = nullptr;
-}
-AggErrorsRow::AggErrorsRow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+GetErrorsAggResponse::GetErrorsAggResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.AggErrorsRow)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetErrorsAggResponse)
 }
-AggErrorsRow::AggErrorsRow(const AggErrorsRow& from)
+GetErrorsAggResponse::GetErrorsAggResponse(const GetErrorsAggResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  AggErrorsRow* const _this = this; (void)_this;
+  GetErrorsAggResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.project_id_){}
-    , decltype(_impl_.page_){}
-    , decltype(_impl_.error_type_){}
-    , decltype(_impl_.time_bucket_){nullptr}
-    , decltype(_impl_.created_at_){nullptr}
-    , decltype(_impl_.errors_count_){}
-    , decltype(_impl_.warning_count_){}
-    , decltype(_impl_.critical_count_){}
-    , decltype(_impl_.unique_users_){}};
+      decltype(_impl_.rows_){from._impl_.rows_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.project_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.project_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_project_id().empty()) {
-    _this->_impl_.project_id_.Set(from._internal_project_id(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.page_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.page_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_page().empty()) {
-    _this->_impl_.page_.Set(from._internal_page(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.error_type_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_type_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_error_type()) {
-    _this->_impl_.error_type_.Set(from._internal_error_type(), 
-      _this->GetArenaForAllocation());
-  }
-  if (from._internal_has_time_bucket()) {
-    _this->_impl_.time_bucket_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.time_bucket_);
-  }
-  if (from._internal_has_created_at()) {
-    _this->_impl_.created_at_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.created_at_);
-  }
-  ::memcpy(&_impl_.errors_count_, &from._impl_.errors_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unique_users_) -
-    reinterpret_cast<char*>(&_impl_.errors_count_)) + sizeof(_impl_.unique_users_));
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.AggErrorsRow)
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetErrorsAggResponse)
 }
 
-inline void AggErrorsRow::SharedCtor(
+inline void GetErrorsAggResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
+      decltype(_impl_.rows_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.project_id_){}
-    , decltype(_impl_.page_){}
-    , decltype(_impl_.error_type_){}
-    , decltype(_impl_.time_bucket_){nullptr}
-    , decltype(_impl_.created_at_){nullptr}
-    , decltype(_impl_.errors_count_){int64_t{0}}
-    , decltype(_impl_.warning_count_){int64_t{0}}
-    , decltype(_impl_.critical_count_){int64_t{0}}
-    , decltype(_impl_.unique_users_){int64_t{0}}
   };
-  _impl_.project_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.project_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.page_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.page_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.error_type_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_type_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-AggErrorsRow::~AggErrorsRow() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.AggErrorsRow)
+GetErrorsAggResponse::~GetErrorsAggResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetErrorsAggResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -4857,128 +6520,41 @@ AggErrorsRow::~AggErrorsRow() {
   SharedDtor();
 }
 
-inline void AggErrorsRow::SharedDtor() {
+inline void GetErrorsAggResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.project_id_.Destroy();
-  _impl_.page_.Destroy();
-  _impl_.error_type_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.time_bucket_;
-  if (this != internal_default_instance()) delete _impl_.created_at_;
+  _impl_.rows_.~RepeatedPtrField();
 }
 
-void AggErrorsRow::SetCachedSize(int size) const {
+void GetErrorsAggResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void AggErrorsRow::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.AggErrorsRow)
+void GetErrorsAggResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetErrorsAggResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.project_id_.ClearToEmpty();
-  _impl_.page_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.error_type_.ClearNonDefaultToEmpty();
-  }
-  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
-    delete _impl_.time_bucket_;
-  }
-  _impl_.time_bucket_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
-    delete _impl_.created_at_;
-  }
-  _impl_.created_at_ = nullptr;
-  ::memset(&_impl_.errors_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.unique_users_) -
-      reinterpret_cast<char*>(&_impl_.errors_count_)) + sizeof(_impl_.unique_users_));
-  _impl_._has_bits_.Clear();
+  _impl_.rows_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* AggErrorsRow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
-  while (!ctx->Done(&ptr)) {
-    uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // .google.protobuf.Timestamp time_bucket = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_time_bucket(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // string project_id = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_project_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggErrorsRow.project_id"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string page = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_page();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggErrorsRow.page"));
-        } else
-          goto handle_unusual;
-        continue;
-      // optional string error_type = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_error_type();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggErrorsRow.error_type"));
-        } else
-          goto handle_unusual;
-        continue;
-      // int64 errors_count = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          _impl_.errors_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int64 warning_count = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          _impl_.warning_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int64 critical_count = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
-          _impl_.critical_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int64 unique_users = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
-          _impl_.unique_users_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .google.protobuf.Timestamp created_at = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
-          ptr = ctx->ParseMessage(_internal_mutable_created_at(), ptr);
-          CHK_(ptr);
+}
+
+const char* GetErrorsAggResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .metricsys.aggregation.AggErrorsRow rows = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rows(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -4998,7 +6574,6 @@ const char* AggErrorsRow::_InternalParse(const char* ptr, ::_pbi::ParseContext*
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -5006,285 +6581,141 @@ failure:
 #undef CHK_
 }
 
-uint8_t* AggErrorsRow::_InternalSerialize(
+uint8_t* GetErrorsAggResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.AggErrorsRow)
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetErrorsAggResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .google.protobuf.Timestamp time_bucket = 1;
-  if (this->_internal_has_time_bucket()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::time_bucket(this),
-        _Internal::time_bucket(this).GetCachedSize(), target, stream);
-  }
-
-  // string project_id = 2;
-  if (!this->_internal_project_id().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.AggErrorsRow.project_id");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_project_id(), target);
-  }
-
-  // string page = 3;
-  if (!this->_internal_page().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.AggErrorsRow.page");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_page(), target);
-  }
-
-  // optional string error_type = 4;
-  if (_internal_has_error_type()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_error_type().data(), static_cast<int>(this->_internal_error_type().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.AggErrorsRow.error_type");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_error_type(), target);
-  }
-
-  // int64 errors_count = 5;
-  if (this->_internal_errors_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_errors_count(), target);
-  }
-
-  // int64 warning_count = 6;
-  if (this->_internal_warning_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_warning_count(), target);
-  }
-
-  // int64 critical_count = 7;
-  if (this->_internal_critical_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_critical_count(), target);
-  }
-
-  // int64 unique_users = 8;
-  if (this->_internal_unique_users() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_unique_users(), target);
-  }
-
-  // .google.protobuf.Timestamp created_at = 9;
-  if (this->_internal_has_created_at()) {
+  // repeated .metricsys.aggregation.AggErrorsRow rows = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rows_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rows(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(9, _Internal::created_at(this),
-        _Internal::created_at(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.AggErrorsRow)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetErrorsAggResponse)
   return target;
 }
 
-size_t AggErrorsRow::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.AggErrorsRow)
+size_t GetErrorsAggResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetErrorsAggResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string project_id = 2;
-  if (!this->_internal_project_id().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_project_id());
-  }
-
-  // string page = 3;
-  if (!this->_internal_page().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_page());
-  }
-
-  // optional string error_type = 4;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_error_type());
-  }
-
-  // .google.protobuf.Timestamp time_bucket = 1;
-  if (this->_internal_has_time_bucket()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.time_bucket_);
-  }
-
-  // .google.protobuf.Timestamp created_at = 9;
-  if (this->_internal_has_created_at()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.created_at_);
-  }
-
-  // int64 errors_count = 5;
-  if (this->_internal_errors_count() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_errors_count());
-  }
-
-  // int64 warning_count = 6;
-  if (this->_internal_warning_count() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_warning_count());
-  }
-
-  // int64 critical_count = 7;
-  if (this->_internal_critical_count() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_critical_count());
-  }
-
-  // int64 unique_users = 8;
-  if (this->_internal_unique_users() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_users());
+  // repeated .metricsys.aggregation.AggErrorsRow rows = 1;
+  total_size += 1UL * this->_internal_rows_size();
+  for (const auto& msg : this->_impl_.rows_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AggErrorsRow::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetErrorsAggResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    AggErrorsRow::MergeImpl
+    GetErrorsAggResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AggErrorsRow::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetErrorsAggResponse::GetClassData() const { return &_class_data_; }
 
 
-void AggErrorsRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<AggErrorsRow*>(&to_msg);
-  auto& from = static_cast<const AggErrorsRow&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.AggErrorsRow)
+void GetErrorsAggResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetErrorsAggResponse*>(&to_msg);
+  auto& from = static_cast<const GetErrorsAggResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetErrorsAggResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_project_id().empty()) {
-    _this->_internal_set_project_id(from._internal_project_id());
-  }
-  if (!from._internal_page().empty()) {
-    _this->_internal_set_page(from._internal_page());
-  }
-  if (from._internal_has_error_type()) {
-    _this->_internal_set_error_type(from._internal_error_type());
-  }
-  if (from._internal_has_time_bucket()) {
-    _this->_internal_mutable_time_bucket()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
-        from._internal_time_bucket());
-  }
-  if (from._internal_has_created_at()) {
-    _this->_internal_mutable_created_at()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
-        from._internal_created_at());
-  }
-  if (from._internal_errors_count() != 0) {
-    _this->_internal_set_errors_count(from._internal_errors_count());
-  }
-  if (from._internal_warning_count() != 0) {
-    _this->_internal_set_warning_count(from._internal_warning_count());
-  }
-  if (from._internal_critical_count() != 0) {
-    _this->_internal_set_critical_count(from._internal_critical_count());
-  }
-  if (from._internal_unique_users() != 0) {
-    _this->_internal_set_unique_users(from._internal_unique_users());
-  }
+  _this->_impl_.rows_.MergeFrom(from._impl_.rows_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AggErrorsRow::CopyFrom(const AggErrorsRow& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.AggErrorsRow)
+void GetErrorsAggResponse::CopyFrom(const GetErrorsAggResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetErrorsAggResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AggErrorsRow::IsInitialized() const {
+bool GetErrorsAggResponse::IsInitialized() const {
   return true;
 }
 
-void AggErrorsRow::InternalSwap(AggErrorsRow* other) {
+void GetErrorsAggResponse::InternalSwap(GetErrorsAggResponse* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.project_id_, lhs_arena,
-      &other->_impl_.project_id_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.page_, lhs_arena,
-      &other->_impl_.page_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.error_type_, lhs_arena,
-      &other->_impl_.error_type_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AggErrorsRow, _impl_.unique_users_)
-      + sizeof(AggErrorsRow::_impl_.unique_users_)
-      - PROTOBUF_FIELD_OFFSET(AggErrorsRow, _impl_.time_bucket_)>(
-          reinterpret_cast<char*>(&_impl_.time_bucket_),
-          reinterpret_cast<char*>(&other->_impl_.time_bucket_));
+  _impl_.rows_.InternalSwap(&other->_impl_.rows_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AggErrorsRow::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetErrorsAggResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
-      file_level_metadata_aggregation_2eproto[13]);
+      file_level_metadata_aggregation_2eproto[16]);
 }
 
 // ===================================================================
 
-class GetErrorsAggRequest::_Internal {
+class AggCustomEventsRow::_Internal {
  public:
-  using HasBits = decltype(std::declval<GetErrorsAggRequest>()._impl_._has_bits_);
-  static const ::metricsys::aggregation::TimeRange& time_range(const GetErrorsAggRequest* msg);
+  using HasBits = decltype(std::declval<AggCustomEventsRow>()._impl_._has_bits_);
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& time_bucket(const AggCustomEventsRow* msg);
   static void set_has_page(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_error_type(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
+  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& created_at(const AggCustomEventsRow* msg);
+};
+
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
+AggCustomEventsRow::_Internal::time_bucket(const AggCustomEventsRow* msg) {
+  return *msg->_impl_.time_bucket_;
+}
+const ::PROTOBUF_NAMESPACE_ID::Timestamp&
+AggCustomEventsRow::_Internal::created_at(const AggCustomEventsRow* msg) {
+  return *msg->_impl_.created_at_;
+}
+void AggCustomEventsRow::clear_time_bucket() {
+  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
+    delete _impl_.time_bucket_;
   }
-  static const ::metricsys::aggregation::Pagination& pagination(const GetErrorsAggRequest* msg);
-};
-
-const ::metricsys::aggregation::TimeRange&
-GetErrorsAggRequest::_Internal::time_range(const GetErrorsAggRequest* msg) {
-  return *msg->_impl_.time_range_;
+  _impl_.time_bucket_ = nullptr;
 }
-const ::metricsys::aggregation::Pagination&
-GetErrorsAggRequest::_Internal::pagination(const GetErrorsAggRequest* msg) {
-  return *msg->_impl_.pagination_;
+void AggCustomEventsRow::clear_created_at() {
+  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
+    delete _impl_.created_at_;
+  }
+  _impl_.created_at_ = nullptr;
 }
-GetErrorsAggRequest::GetErrorsAggRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+AggCustomEventsRow::AggCustomEventsRow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetErrorsAggRequest)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.AggCustomEventsRow)
 }
-GetErrorsAggRequest::GetErrorsAggRequest(const GetErrorsAggRequest& from)
+AggCustomEventsRow::AggCustomEventsRow(const AggCustomEventsRow& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GetErrorsAggRequest* const _this = this; (void)_this;
+  AggCustomEventsRow* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.project_id_){}
+    , decltype(_impl_.event_name_){}
     , decltype(_impl_.page_){}
-    , decltype(_impl_.error_type_){}
-    , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.time_bucket_){nullptr}
+    , decltype(_impl_.created_at_){nullptr}
+    , decltype(_impl_.events_count_){}
+    , decltype(_impl_.unique_users_){}
+    , decltype(_impl_.unique_sessions_){}
+    , decltype(_impl_.step_seconds_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.project_id_.InitDefault();
@@ -5295,32 +6726,35 @@ GetErrorsAggRequest::GetErrorsAggRequest(const GetErrorsAggRequest& from)
     _this->_impl_.project_id_.Set(from._internal_project_id(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.page_.InitDefault();
+  _impl_.event_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.page_.Set("", GetArenaForAllocation());
+    _impl_.event_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_page()) {
-    _this->_impl_.page_.Set(from._internal_page(), 
+  if (!from._internal_event_name().empty()) {
+    _this->_impl_.event_name_.Set(from._internal_event_name(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.error_type_.InitDefault();
+  _impl_.page_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_type_.Set("", GetArenaForAllocation());
+    _impl_.page_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_error_type()) {
-    _this->_impl_.error_type_.Set(from._internal_error_type(), 
+  if (from._internal_has_page()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
       _this->GetArenaForAllocation());
   }
-  if (from._internal_has_time_range()) {
-    _this->_impl_.time_range_ = new ::metricsys::aggregation::TimeRange(*from._impl_.time_range_);
+  if (from._internal_has_time_bucket()) {
+    _this->_impl_.time_bucket_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.time_bucket_);
   }
-  if (from._internal_has_pagination()) {
-    _this->_impl_.pagination_ = new ::metricsys::aggregation::Pagination(*from._impl_.pagination_);
+  if (from._internal_has_created_at()) {
+    _this->_impl_.created_at_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.created_at_);
   }
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetErrorsAggRequest)
+  ::memcpy(&_impl_.events_count_, &from._impl_.events_count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.step_seconds_) -
+    reinterpret_cast<char*>(&_impl_.events_count_)) + sizeof(_impl_.step_seconds_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.AggCustomEventsRow)
 }
 
-inline void GetErrorsAggRequest::SharedCtor(
+inline void AggCustomEventsRow::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -5328,27 +6762,31 @@ inline void GetErrorsAggRequest::SharedCtor(
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.project_id_){}
+    , decltype(_impl_.event_name_){}
     , decltype(_impl_.page_){}
-    , decltype(_impl_.error_type_){}
-    , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.time_bucket_){nullptr}
+    , decltype(_impl_.created_at_){nullptr}
+    , decltype(_impl_.events_count_){int64_t{0}}
+    , decltype(_impl_.unique_users_){int64_t{0}}
+    , decltype(_impl_.unique_sessions_){int64_t{0}}
+    , decltype(_impl_.step_seconds_){0u}
   };
   _impl_.project_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.project_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.page_.InitDefault();
+  _impl_.event_name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.page_.Set("", GetArenaForAllocation());
+    _impl_.event_name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.error_type_.InitDefault();
+  _impl_.page_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_type_.Set("", GetArenaForAllocation());
+    _impl_.page_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-GetErrorsAggRequest::~GetErrorsAggRequest() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetErrorsAggRequest)
+AggCustomEventsRow::~AggCustomEventsRow() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.AggCustomEventsRow)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5356,96 +6794,127 @@ GetErrorsAggRequest::~GetErrorsAggRequest() {
   SharedDtor();
 }
 
-inline void GetErrorsAggRequest::SharedDtor() {
+inline void AggCustomEventsRow::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.project_id_.Destroy();
+  _impl_.event_name_.Destroy();
   _impl_.page_.Destroy();
-  _impl_.error_type_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.time_range_;
-  if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.time_bucket_;
+  if (this != internal_default_instance()) delete _impl_.created_at_;
 }
 
-void GetErrorsAggRequest::SetCachedSize(int size) const {
+void AggCustomEventsRow::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GetErrorsAggRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetErrorsAggRequest)
+void AggCustomEventsRow::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.AggCustomEventsRow)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.project_id_.ClearToEmpty();
+  _impl_.event_name_.ClearToEmpty();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _impl_.page_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _impl_.error_type_.ClearNonDefaultToEmpty();
-    }
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.page_.ClearNonDefaultToEmpty();
   }
-  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
-    delete _impl_.time_range_;
+  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
+    delete _impl_.time_bucket_;
   }
-  _impl_.time_range_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
-    delete _impl_.pagination_;
+  _impl_.time_bucket_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
+    delete _impl_.created_at_;
   }
-  _impl_.pagination_ = nullptr;
+  _impl_.created_at_ = nullptr;
+  ::memset(&_impl_.events_count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.step_seconds_) -
+      reinterpret_cast<char*>(&_impl_.events_count_)) + sizeof(_impl_.step_seconds_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetErrorsAggRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* AggCustomEventsRow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string project_id = 1;
+      // .google.protobuf.Timestamp time_bucket = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_project_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ctx->ParseMessage(_internal_mutable_time_bucket(), ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetErrorsAggRequest.project_id"));
         } else
           goto handle_unusual;
         continue;
-      // .metricsys.aggregation.TimeRange time_range = 2;
+      // string project_id = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          auto str = _internal_mutable_project_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggCustomEventsRow.project_id"));
         } else
           goto handle_unusual;
         continue;
-      // optional string page = 3;
+      // string event_name = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_page();
+          auto str = _internal_mutable_event_name();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetErrorsAggRequest.page"));
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggCustomEventsRow.event_name"));
         } else
           goto handle_unusual;
         continue;
-      // optional string error_type = 4;
+      // optional string page = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_error_type();
+          auto str = _internal_mutable_page();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetErrorsAggRequest.error_type"));
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggCustomEventsRow.page"));
         } else
           goto handle_unusual;
         continue;
-      // .metricsys.aggregation.Pagination pagination = 5;
+      // int64 events_count = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.events_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 unique_users = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.unique_users_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 unique_sessions = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.unique_sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .google.protobuf.Timestamp created_at = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_created_at(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 step_seconds = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -5474,124 +6943,166 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GetErrorsAggRequest::_InternalSerialize(
+uint8_t* AggCustomEventsRow::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetErrorsAggRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.AggCustomEventsRow)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string project_id = 1;
+  // .google.protobuf.Timestamp time_bucket = 1;
+  if (this->_internal_has_time_bucket()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time_bucket(this),
+        _Internal::time_bucket(this).GetCachedSize(), target, stream);
+  }
+
+  // string project_id = 2;
   if (!this->_internal_project_id().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.GetErrorsAggRequest.project_id");
+      "metricsys.aggregation.AggCustomEventsRow.project_id");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_project_id(), target);
+        2, this->_internal_project_id(), target);
   }
 
-  // .metricsys.aggregation.TimeRange time_range = 2;
-  if (this->_internal_has_time_range()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::time_range(this),
-        _Internal::time_range(this).GetCachedSize(), target, stream);
+  // string event_name = 3;
+  if (!this->_internal_event_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_event_name().data(), static_cast<int>(this->_internal_event_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.AggCustomEventsRow.event_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_event_name(), target);
   }
 
-  // optional string page = 3;
+  // optional string page = 4;
   if (_internal_has_page()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.GetErrorsAggRequest.page");
+      "metricsys.aggregation.AggCustomEventsRow.page");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_page(), target);
+        4, this->_internal_page(), target);
   }
 
-  // optional string error_type = 4;
-  if (_internal_has_error_type()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_error_type().data(), static_cast<int>(this->_internal_error_type().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.GetErrorsAggRequest.error_type");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_error_type(), target);
+  // int64 events_count = 5;
+  if (this->_internal_events_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_events_count(), target);
   }
 
-  // .metricsys.aggregation.Pagination pagination = 5;
-  if (this->_internal_has_pagination()) {
+  // int64 unique_users = 6;
+  if (this->_internal_unique_users() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_unique_users(), target);
+  }
+
+  // int64 unique_sessions = 7;
+  if (this->_internal_unique_sessions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_unique_sessions(), target);
+  }
+
+  // .google.protobuf.Timestamp created_at = 8;
+  if (this->_internal_has_created_at()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, _Internal::pagination(this),
-        _Internal::pagination(this).GetCachedSize(), target, stream);
+      InternalWriteMessage(8, _Internal::created_at(this),
+        _Internal::created_at(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 step_seconds = 9;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_step_seconds(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetErrorsAggRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.AggCustomEventsRow)
   return target;
 }
 
-size_t GetErrorsAggRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetErrorsAggRequest)
+size_t AggCustomEventsRow::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.AggCustomEventsRow)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string project_id = 1;
+  // string project_id = 2;
   if (!this->_internal_project_id().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_project_id());
   }
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    // optional string page = 3;
-    if (cached_has_bits & 0x00000001u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_page());
-    }
-
-    // optional string error_type = 4;
-    if (cached_has_bits & 0x00000002u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_error_type());
-    }
+  // string event_name = 3;
+  if (!this->_internal_event_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_event_name());
+  }
 
+  // optional string page = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
   }
-  // .metricsys.aggregation.TimeRange time_range = 2;
-  if (this->_internal_has_time_range()) {
+
+  // .google.protobuf.Timestamp time_bucket = 1;
+  if (this->_internal_has_time_bucket()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.time_range_);
+        *_impl_.time_bucket_);
   }
 
-  // .metricsys.aggregation.Pagination pagination = 5;
-  if (this->_internal_has_pagination()) {
+  // .google.protobuf.Timestamp created_at = 8;
+  if (this->_internal_has_created_at()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.pagination_);
+        *_impl_.created_at_);
+  }
+
+  // int64 events_count = 5;
+  if (this->_internal_events_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_events_count());
+  }
+
+  // int64 unique_users = 6;
+  if (this->_internal_unique_users() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_users());
+  }
+
+  // int64 unique_sessions = 7;
+  if (this->_internal_unique_sessions() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_sessions());
+  }
+
+  // uint32 step_seconds = 9;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetErrorsAggRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AggCustomEventsRow::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GetErrorsAggRequest::MergeImpl
+    AggCustomEventsRow::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetErrorsAggRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AggCustomEventsRow::GetClassData() const { return &_class_data_; }
 
 
-void GetErrorsAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GetErrorsAggRequest*>(&to_msg);
-  auto& from = static_cast<const GetErrorsAggRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetErrorsAggRequest)
+void AggCustomEventsRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<AggCustomEventsRow*>(&to_msg);
+  auto& from = static_cast<const AggCustomEventsRow&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.AggCustomEventsRow)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -5599,38 +7110,47 @@ void GetErrorsAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   if (!from._internal_project_id().empty()) {
     _this->_internal_set_project_id(from._internal_project_id());
   }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_page(from._internal_page());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_internal_set_error_type(from._internal_error_type());
-    }
+  if (!from._internal_event_name().empty()) {
+    _this->_internal_set_event_name(from._internal_event_name());
   }
-  if (from._internal_has_time_range()) {
-    _this->_internal_mutable_time_range()->::metricsys::aggregation::TimeRange::MergeFrom(
-        from._internal_time_range());
+  if (from._internal_has_page()) {
+    _this->_internal_set_page(from._internal_page());
   }
-  if (from._internal_has_pagination()) {
-    _this->_internal_mutable_pagination()->::metricsys::aggregation::Pagination::MergeFrom(
-        from._internal_pagination());
+  if (from._internal_has_time_bucket()) {
+    _this->_internal_mutable_time_bucket()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_time_bucket());
+  }
+  if (from._internal_has_created_at()) {
+    _this->_internal_mutable_created_at()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
+        from._internal_created_at());
+  }
+  if (from._internal_events_count() != 0) {
+    _this->_internal_set_events_count(from._internal_events_count());
+  }
+  if (from._internal_unique_users() != 0) {
+    _this->_internal_set_unique_users(from._internal_unique_users());
+  }
+  if (from._internal_unique_sessions() != 0) {
+    _this->_internal_set_unique_sessions(from._internal_unique_sessions());
+  }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GetErrorsAggRequest::CopyFrom(const GetErrorsAggRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetErrorsAggRequest)
+void AggCustomEventsRow::CopyFrom(const AggCustomEventsRow& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.AggCustomEventsRow)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetErrorsAggRequest::IsInitialized() const {
+bool AggCustomEventsRow::IsInitialized() const {
   return true;
 }
 
-void GetErrorsAggRequest::InternalSwap(GetErrorsAggRequest* other) {
+void AggCustomEventsRow::InternalSwap(AggCustomEventsRow* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -5641,62 +7161,131 @@ void GetErrorsAggRequest::InternalSwap(GetErrorsAggRequest* other) {
       &other->_impl_.project_id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.page_, lhs_arena,
-      &other->_impl_.page_, rhs_arena
+      &_impl_.event_name_, lhs_arena,
+      &other->_impl_.event_name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.error_type_, lhs_arena,
-      &other->_impl_.error_type_, rhs_arena
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetErrorsAggRequest, _impl_.pagination_)
-      + sizeof(GetErrorsAggRequest::_impl_.pagination_)
-      - PROTOBUF_FIELD_OFFSET(GetErrorsAggRequest, _impl_.time_range_)>(
-          reinterpret_cast<char*>(&_impl_.time_range_),
-          reinterpret_cast<char*>(&other->_impl_.time_range_));
+      PROTOBUF_FIELD_OFFSET(AggCustomEventsRow, _impl_.step_seconds_)
+      + sizeof(AggCustomEventsRow::_impl_.step_seconds_)
+      - PROTOBUF_FIELD_OFFSET(AggCustomEventsRow, _impl_.time_bucket_)>(
+          reinterpret_cast<char*>(&_impl_.time_bucket_),
+          reinterpret_cast<char*>(&other->_impl_.time_bucket_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetErrorsAggRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata AggCustomEventsRow::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
-      file_level_metadata_aggregation_2eproto[14]);
+      file_level_metadata_aggregation_2eproto[17]);
 }
 
 // ===================================================================
 
-class GetErrorsAggResponse::_Internal {
+class GetCustomEventsAggRequest::_Internal {
  public:
+  using HasBits = decltype(std::declval<GetCustomEventsAggRequest>()._impl_._has_bits_);
+  static const ::metricsys::aggregation::TimeRange& time_range(const GetCustomEventsAggRequest* msg);
+  static void set_has_page(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::metricsys::aggregation::Pagination& pagination(const GetCustomEventsAggRequest* msg);
 };
 
-GetErrorsAggResponse::GetErrorsAggResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::metricsys::aggregation::TimeRange&
+GetCustomEventsAggRequest::_Internal::time_range(const GetCustomEventsAggRequest* msg) {
+  return *msg->_impl_.time_range_;
+}
+const ::metricsys::aggregation::Pagination&
+GetCustomEventsAggRequest::_Internal::pagination(const GetCustomEventsAggRequest* msg) {
+  return *msg->_impl_.pagination_;
+}
+GetCustomEventsAggRequest::GetCustomEventsAggRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetErrorsAggResponse)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetCustomEventsAggRequest)
 }
-GetErrorsAggResponse::GetErrorsAggResponse(const GetErrorsAggResponse& from)
+GetCustomEventsAggRequest::GetCustomEventsAggRequest(const GetCustomEventsAggRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GetErrorsAggResponse* const _this = this; (void)_this;
+  GetCustomEventsAggRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.rows_){from._impl_.rows_}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.project_id_){}
+    , decltype(_impl_.event_name_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.step_seconds_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetErrorsAggResponse)
+  _impl_.project_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_project_id().empty()) {
+    _this->_impl_.project_id_.Set(from._internal_project_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.event_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_event_name().empty()) {
+    _this->_impl_.event_name_.Set(from._internal_event_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_impl_.time_range_ = new ::metricsys::aggregation::TimeRange(*from._impl_.time_range_);
+  }
+  if (from._internal_has_pagination()) {
+    _this->_impl_.pagination_ = new ::metricsys::aggregation::Pagination(*from._impl_.pagination_);
+  }
+  _this->_impl_.step_seconds_ = from._impl_.step_seconds_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetCustomEventsAggRequest)
 }
 
-inline void GetErrorsAggResponse::SharedCtor(
+inline void GetCustomEventsAggRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.rows_){arena}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.project_id_){}
+    , decltype(_impl_.event_name_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.step_seconds_){0u}
   };
+  _impl_.project_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.project_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.event_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-GetErrorsAggResponse::~GetErrorsAggResponse() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetErrorsAggResponse)
+GetCustomEventsAggRequest::~GetCustomEventsAggRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetCustomEventsAggRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5704,41 +7293,102 @@ GetErrorsAggResponse::~GetErrorsAggResponse() {
   SharedDtor();
 }
 
-inline void GetErrorsAggResponse::SharedDtor() {
+inline void GetCustomEventsAggRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.rows_.~RepeatedPtrField();
+  _impl_.project_id_.Destroy();
+  _impl_.event_name_.Destroy();
+  _impl_.page_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_range_;
+  if (this != internal_default_instance()) delete _impl_.pagination_;
 }
 
-void GetErrorsAggResponse::SetCachedSize(int size) const {
+void GetCustomEventsAggRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GetErrorsAggResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetErrorsAggResponse)
+void GetCustomEventsAggRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetCustomEventsAggRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.rows_.Clear();
+  _impl_.project_id_.ClearToEmpty();
+  _impl_.event_name_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.page_.ClearNonDefaultToEmpty();
+  }
+  if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
+    delete _impl_.time_range_;
+  }
+  _impl_.time_range_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
+    delete _impl_.pagination_;
+  }
+  _impl_.pagination_ = nullptr;
+  _impl_.step_seconds_ = 0u;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetErrorsAggResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* GetCustomEventsAggRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .metricsys.aggregation.AggErrorsRow rows = 1;
+      // string project_id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_rows(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          auto str = _internal_mutable_project_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetCustomEventsAggRequest.project_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .metricsys.aggregation.TimeRange time_range = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string event_name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_event_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetCustomEventsAggRequest.event_name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetCustomEventsAggRequest.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .metricsys.aggregation.Pagination pagination = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 step_seconds = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.step_seconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -5758,6 +7408,7 @@ const char* GetErrorsAggResponse::_InternalParse(const char* ptr, ::_pbi::ParseC
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -5765,210 +7416,238 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GetErrorsAggResponse::_InternalSerialize(
+uint8_t* GetCustomEventsAggRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetErrorsAggResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetCustomEventsAggRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .metricsys.aggregation.AggErrorsRow rows = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_rows_size()); i < n; i++) {
-    const auto& repfield = this->_internal_rows(i);
+  // string project_id = 1;
+  if (!this->_internal_project_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetCustomEventsAggRequest.project_id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_project_id(), target);
+  }
+
+  // .metricsys.aggregation.TimeRange time_range = 2;
+  if (this->_internal_has_time_range()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+      InternalWriteMessage(2, _Internal::time_range(this),
+        _Internal::time_range(this).GetCachedSize(), target, stream);
+  }
+
+  // string event_name = 3;
+  if (!this->_internal_event_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_event_name().data(), static_cast<int>(this->_internal_event_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetCustomEventsAggRequest.event_name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_event_name(), target);
+  }
+
+  // optional string page = 4;
+  if (_internal_has_page()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetCustomEventsAggRequest.page");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_page(), target);
+  }
+
+  // .metricsys.aggregation.Pagination pagination = 5;
+  if (this->_internal_has_pagination()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::pagination(this),
+        _Internal::pagination(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 step_seconds = 6;
+  if (this->_internal_step_seconds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_step_seconds(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetErrorsAggResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetCustomEventsAggRequest)
   return target;
 }
 
-size_t GetErrorsAggResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetErrorsAggResponse)
+size_t GetCustomEventsAggRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetCustomEventsAggRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .metricsys.aggregation.AggErrorsRow rows = 1;
-  total_size += 1UL * this->_internal_rows_size();
-  for (const auto& msg : this->_impl_.rows_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // string project_id = 1;
+  if (!this->_internal_project_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_project_id());
+  }
+
+  // string event_name = 3;
+  if (!this->_internal_event_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_event_name());
+  }
+
+  // optional string page = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
+  }
+
+  // .metricsys.aggregation.TimeRange time_range = 2;
+  if (this->_internal_has_time_range()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.time_range_);
+  }
+
+  // .metricsys.aggregation.Pagination pagination = 5;
+  if (this->_internal_has_pagination()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pagination_);
+  }
+
+  // uint32 step_seconds = 6;
+  if (this->_internal_step_seconds() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_step_seconds());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetErrorsAggResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetCustomEventsAggRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GetErrorsAggResponse::MergeImpl
+    GetCustomEventsAggRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetErrorsAggResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetCustomEventsAggRequest::GetClassData() const { return &_class_data_; }
 
 
-void GetErrorsAggResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GetErrorsAggResponse*>(&to_msg);
-  auto& from = static_cast<const GetErrorsAggResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetErrorsAggResponse)
+void GetCustomEventsAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetCustomEventsAggRequest*>(&to_msg);
+  auto& from = static_cast<const GetCustomEventsAggRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetCustomEventsAggRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.rows_.MergeFrom(from._impl_.rows_);
+  if (!from._internal_project_id().empty()) {
+    _this->_internal_set_project_id(from._internal_project_id());
+  }
+  if (!from._internal_event_name().empty()) {
+    _this->_internal_set_event_name(from._internal_event_name());
+  }
+  if (from._internal_has_page()) {
+    _this->_internal_set_page(from._internal_page());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_internal_mutable_time_range()->::metricsys::aggregation::TimeRange::MergeFrom(
+        from._internal_time_range());
+  }
+  if (from._internal_has_pagination()) {
+    _this->_internal_mutable_pagination()->::metricsys::aggregation::Pagination::MergeFrom(
+        from._internal_pagination());
+  }
+  if (from._internal_step_seconds() != 0) {
+    _this->_internal_set_step_seconds(from._internal_step_seconds());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GetErrorsAggResponse::CopyFrom(const GetErrorsAggResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetErrorsAggResponse)
+void GetCustomEventsAggRequest::CopyFrom(const GetCustomEventsAggRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetCustomEventsAggRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetErrorsAggResponse::IsInitialized() const {
+bool GetCustomEventsAggRequest::IsInitialized() const {
   return true;
 }
 
-void GetErrorsAggResponse::InternalSwap(GetErrorsAggResponse* other) {
+void GetCustomEventsAggRequest::InternalSwap(GetCustomEventsAggRequest* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.rows_.InternalSwap(&other->_impl_.rows_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.project_id_, lhs_arena,
+      &other->_impl_.project_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.event_name_, lhs_arena,
+      &other->_impl_.event_name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetCustomEventsAggRequest, _impl_.step_seconds_)
+      + sizeof(GetCustomEventsAggRequest::_impl_.step_seconds_)
+      - PROTOBUF_FIELD_OFFSET(GetCustomEventsAggRequest, _impl_.time_range_)>(
+          reinterpret_cast<char*>(&_impl_.time_range_),
+          reinterpret_cast<char*>(&other->_impl_.time_range_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetErrorsAggResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetCustomEventsAggRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
-      file_level_metadata_aggregation_2eproto[15]);
-}
-
-// ===================================================================
-
-class AggCustomEventsRow::_Internal {
- public:
-  using HasBits = decltype(std::declval<AggCustomEventsRow>()._impl_._has_bits_);
-  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& time_bucket(const AggCustomEventsRow* msg);
-  static void set_has_page(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Timestamp& created_at(const AggCustomEventsRow* msg);
-};
-
-const ::PROTOBUF_NAMESPACE_ID::Timestamp&
-AggCustomEventsRow::_Internal::time_bucket(const AggCustomEventsRow* msg) {
-  return *msg->_impl_.time_bucket_;
-}
-const ::PROTOBUF_NAMESPACE_ID::Timestamp&
-AggCustomEventsRow::_Internal::created_at(const AggCustomEventsRow* msg) {
-  return *msg->_impl_.created_at_;
-}
-void AggCustomEventsRow::clear_time_bucket() {
-  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
-    delete _impl_.time_bucket_;
-  }
-  _impl_.time_bucket_ = nullptr;
-}
-void AggCustomEventsRow::clear_created_at() {
-  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
-    delete _impl_.created_at_;
-  }
-  _impl_.created_at_ = nullptr;
+      file_level_metadata_aggregation_2eproto[18]);
 }
-AggCustomEventsRow::AggCustomEventsRow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+
+// ===================================================================
+
+class GetCustomEventsAggResponse::_Internal {
+ public:
+};
+
+GetCustomEventsAggResponse::GetCustomEventsAggResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.AggCustomEventsRow)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetCustomEventsAggResponse)
 }
-AggCustomEventsRow::AggCustomEventsRow(const AggCustomEventsRow& from)
+GetCustomEventsAggResponse::GetCustomEventsAggResponse(const GetCustomEventsAggResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  AggCustomEventsRow* const _this = this; (void)_this;
+  GetCustomEventsAggResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.project_id_){}
-    , decltype(_impl_.event_name_){}
-    , decltype(_impl_.page_){}
-    , decltype(_impl_.time_bucket_){nullptr}
-    , decltype(_impl_.created_at_){nullptr}
-    , decltype(_impl_.events_count_){}
-    , decltype(_impl_.unique_users_){}
-    , decltype(_impl_.unique_sessions_){}};
+      decltype(_impl_.rows_){from._impl_.rows_}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.project_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.project_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_project_id().empty()) {
-    _this->_impl_.project_id_.Set(from._internal_project_id(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.event_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.event_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_event_name().empty()) {
-    _this->_impl_.event_name_.Set(from._internal_event_name(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.page_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.page_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_page()) {
-    _this->_impl_.page_.Set(from._internal_page(), 
-      _this->GetArenaForAllocation());
-  }
-  if (from._internal_has_time_bucket()) {
-    _this->_impl_.time_bucket_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.time_bucket_);
-  }
-  if (from._internal_has_created_at()) {
-    _this->_impl_.created_at_ = new ::PROTOBUF_NAMESPACE_ID::Timestamp(*from._impl_.created_at_);
-  }
-  ::memcpy(&_impl_.events_count_, &from._impl_.events_count_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.unique_sessions_) -
-    reinterpret_cast<char*>(&_impl_.events_count_)) + sizeof(_impl_.unique_sessions_));
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.AggCustomEventsRow)
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetCustomEventsAggResponse)
 }
 
-inline void AggCustomEventsRow::SharedCtor(
+inline void GetCustomEventsAggResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
+      decltype(_impl_.rows_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.project_id_){}
-    , decltype(_impl_.event_name_){}
-    , decltype(_impl_.page_){}
-    , decltype(_impl_.time_bucket_){nullptr}
-    , decltype(_impl_.created_at_){nullptr}
-    , decltype(_impl_.events_count_){int64_t{0}}
-    , decltype(_impl_.unique_users_){int64_t{0}}
-    , decltype(_impl_.unique_sessions_){int64_t{0}}
   };
-  _impl_.project_id_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.project_id_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.event_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.event_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.page_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.page_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-AggCustomEventsRow::~AggCustomEventsRow() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.AggCustomEventsRow)
+GetCustomEventsAggResponse::~GetCustomEventsAggResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetCustomEventsAggResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -5976,120 +7655,41 @@ AggCustomEventsRow::~AggCustomEventsRow() {
   SharedDtor();
 }
 
-inline void AggCustomEventsRow::SharedDtor() {
+inline void GetCustomEventsAggResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.project_id_.Destroy();
-  _impl_.event_name_.Destroy();
-  _impl_.page_.Destroy();
-  if (this != internal_default_instance()) delete _impl_.time_bucket_;
-  if (this != internal_default_instance()) delete _impl_.created_at_;
+  _impl_.rows_.~RepeatedPtrField();
 }
 
-void AggCustomEventsRow::SetCachedSize(int size) const {
+void GetCustomEventsAggResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void AggCustomEventsRow::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.AggCustomEventsRow)
+void GetCustomEventsAggResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetCustomEventsAggResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.project_id_.ClearToEmpty();
-  _impl_.event_name_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.page_.ClearNonDefaultToEmpty();
-  }
-  if (GetArenaForAllocation() == nullptr && _impl_.time_bucket_ != nullptr) {
-    delete _impl_.time_bucket_;
-  }
-  _impl_.time_bucket_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.created_at_ != nullptr) {
-    delete _impl_.created_at_;
-  }
-  _impl_.created_at_ = nullptr;
-  ::memset(&_impl_.events_count_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.unique_sessions_) -
-      reinterpret_cast<char*>(&_impl_.events_count_)) + sizeof(_impl_.unique_sessions_));
-  _impl_._has_bits_.Clear();
+  _impl_.rows_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* AggCustomEventsRow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* GetCustomEventsAggResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .google.protobuf.Timestamp time_bucket = 1;
+      // repeated .metricsys.aggregation.AggCustomEventsRow rows = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_time_bucket(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // string project_id = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_project_id();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggCustomEventsRow.project_id"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string event_name = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_event_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggCustomEventsRow.event_name"));
-        } else
-          goto handle_unusual;
-        continue;
-      // optional string page = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_page();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.AggCustomEventsRow.page"));
-        } else
-          goto handle_unusual;
-        continue;
-      // int64 events_count = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          _impl_.events_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int64 unique_users = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          _impl_.unique_users_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // int64 unique_sessions = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
-          _impl_.unique_sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .google.protobuf.Timestamp created_at = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
-          ptr = ctx->ParseMessage(_internal_mutable_created_at(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rows(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -6109,276 +7709,138 @@ const char* AggCustomEventsRow::_InternalParse(const char* ptr, ::_pbi::ParseCon
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
   goto message_done;
 #undef CHK_
-}
-
-uint8_t* AggCustomEventsRow::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.AggCustomEventsRow)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .google.protobuf.Timestamp time_bucket = 1;
-  if (this->_internal_has_time_bucket()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::time_bucket(this),
-        _Internal::time_bucket(this).GetCachedSize(), target, stream);
-  }
-
-  // string project_id = 2;
-  if (!this->_internal_project_id().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.AggCustomEventsRow.project_id");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_project_id(), target);
-  }
-
-  // string event_name = 3;
-  if (!this->_internal_event_name().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_event_name().data(), static_cast<int>(this->_internal_event_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.AggCustomEventsRow.event_name");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_event_name(), target);
-  }
-
-  // optional string page = 4;
-  if (_internal_has_page()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.AggCustomEventsRow.page");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_page(), target);
-  }
-
-  // int64 events_count = 5;
-  if (this->_internal_events_count() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(5, this->_internal_events_count(), target);
-  }
-
-  // int64 unique_users = 6;
-  if (this->_internal_unique_users() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_unique_users(), target);
-  }
-
-  // int64 unique_sessions = 7;
-  if (this->_internal_unique_sessions() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_unique_sessions(), target);
-  }
+}
 
-  // .google.protobuf.Timestamp created_at = 8;
-  if (this->_internal_has_created_at()) {
+uint8_t* GetCustomEventsAggResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetCustomEventsAggResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .metricsys.aggregation.AggCustomEventsRow rows = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rows_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rows(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(8, _Internal::created_at(this),
-        _Internal::created_at(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.AggCustomEventsRow)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetCustomEventsAggResponse)
   return target;
 }
 
-size_t AggCustomEventsRow::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.AggCustomEventsRow)
+size_t GetCustomEventsAggResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetCustomEventsAggResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string project_id = 2;
-  if (!this->_internal_project_id().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_project_id());
-  }
-
-  // string event_name = 3;
-  if (!this->_internal_event_name().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_event_name());
-  }
-
-  // optional string page = 4;
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_page());
-  }
-
-  // .google.protobuf.Timestamp time_bucket = 1;
-  if (this->_internal_has_time_bucket()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.time_bucket_);
-  }
-
-  // .google.protobuf.Timestamp created_at = 8;
-  if (this->_internal_has_created_at()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.created_at_);
-  }
-
-  // int64 events_count = 5;
-  if (this->_internal_events_count() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_events_count());
-  }
-
-  // int64 unique_users = 6;
-  if (this->_internal_unique_users() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_users());
-  }
-
-  // int64 unique_sessions = 7;
-  if (this->_internal_unique_sessions() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_sessions());
+  // repeated .metricsys.aggregation.AggCustomEventsRow rows = 1;
+  total_size += 1UL * this->_internal_rows_size();
+  for (const auto& msg : this->_impl_.rows_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData AggCustomEventsRow::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetCustomEventsAggResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    AggCustomEventsRow::MergeImpl
+    GetCustomEventsAggResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*AggCustomEventsRow::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetCustomEventsAggResponse::GetClassData() const { return &_class_data_; }
 
 
-void AggCustomEventsRow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<AggCustomEventsRow*>(&to_msg);
-  auto& from = static_cast<const AggCustomEventsRow&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.AggCustomEventsRow)
+void GetCustomEventsAggResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetCustomEventsAggResponse*>(&to_msg);
+  auto& from = static_cast<const GetCustomEventsAggResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetCustomEventsAggResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_project_id().empty()) {
-    _this->_internal_set_project_id(from._internal_project_id());
-  }
-  if (!from._internal_event_name().empty()) {
-    _this->_internal_set_event_name(from._internal_event_name());
-  }
-  if (from._internal_has_page()) {
-    _this->_internal_set_page(from._internal_page());
-  }
-  if (from._internal_has_time_bucket()) {
-    _this->_internal_mutable_time_bucket()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
-        from._internal_time_bucket());
-  }
-  if (from._internal_has_created_at()) {
-    _this->_internal_mutable_created_at()->::PROTOBUF_NAMESPACE_ID::Timestamp::MergeFrom(
-        from._internal_created_at());
-  }
-  if (from._internal_events_count() != 0) {
-    _this->_internal_set_events_count(from._internal_events_count());
-  }
-  if (from._internal_unique_users() != 0) {
-    _this->_internal_set_unique_users(from._internal_unique_users());
-  }
-  if (from._internal_unique_sessions() != 0) {
-    _this->_internal_set_unique_sessions(from._internal_unique_sessions());
-  }
+  _this->_impl_.rows_.MergeFrom(from._impl_.rows_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void AggCustomEventsRow::CopyFrom(const AggCustomEventsRow& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.AggCustomEventsRow)
+void GetCustomEventsAggResponse::CopyFrom(const GetCustomEventsAggResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetCustomEventsAggResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool AggCustomEventsRow::IsInitialized() const {
+bool GetCustomEventsAggResponse::IsInitialized() const {
   return true;
 }
 
-void AggCustomEventsRow::InternalSwap(AggCustomEventsRow* other) {
+void GetCustomEventsAggResponse::InternalSwap(GetCustomEventsAggResponse* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.project_id_, lhs_arena,
-      &other->_impl_.project_id_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.event_name_, lhs_arena,
-      &other->_impl_.event_name_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.page_, lhs_arena,
-      &other->_impl_.page_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AggCustomEventsRow, _impl_.unique_sessions_)
-      + sizeof(AggCustomEventsRow::_impl_.unique_sessions_)
-      - PROTOBUF_FIELD_OFFSET(AggCustomEventsRow, _impl_.time_bucket_)>(
-          reinterpret_cast<char*>(&_impl_.time_bucket_),
-          reinterpret_cast<char*>(&other->_impl_.time_bucket_));
+  _impl_.rows_.InternalSwap(&other->_impl_.rows_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata AggCustomEventsRow::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetCustomEventsAggResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
-      file_level_metadata_aggregation_2eproto[16]);
+      file_level_metadata_aggregation_2eproto[19]);
 }
 
 // ===================================================================
 
-class GetCustomEventsAggRequest::_Internal {
+class GetUniquesAggRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<GetCustomEventsAggRequest>()._impl_._has_bits_);
-  static const ::metricsys::aggregation::TimeRange& time_range(const GetCustomEventsAggRequest* msg);
+  using HasBits = decltype(std::declval<GetUniquesAggRequest>()._impl_._has_bits_);
+  static const ::metricsys::aggregation::TimeRange& time_range(const GetUniquesAggRequest* msg);
   static void set_has_page(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static const ::metricsys::aggregation::Pagination& pagination(const GetCustomEventsAggRequest* msg);
+  static void set_has_element_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_error_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_event_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
 };
 
 const ::metricsys::aggregation::TimeRange&
-GetCustomEventsAggRequest::_Internal::time_range(const GetCustomEventsAggRequest* msg) {
+GetUniquesAggRequest::_Internal::time_range(const GetUniquesAggRequest* msg) {
   return *msg->_impl_.time_range_;
 }
-const ::metricsys::aggregation::Pagination&
-GetCustomEventsAggRequest::_Internal::pagination(const GetCustomEventsAggRequest* msg) {
-  return *msg->_impl_.pagination_;
-}
-GetCustomEventsAggRequest::GetCustomEventsAggRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+GetUniquesAggRequest::GetUniquesAggRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetCustomEventsAggRequest)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetUniquesAggRequest)
 }
-GetCustomEventsAggRequest::GetCustomEventsAggRequest(const GetCustomEventsAggRequest& from)
+GetUniquesAggRequest::GetUniquesAggRequest(const GetUniquesAggRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GetCustomEventsAggRequest* const _this = this; (void)_this;
+  GetUniquesAggRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.project_id_){}
-    , decltype(_impl_.event_name_){}
     , decltype(_impl_.page_){}
+    , decltype(_impl_.element_id_){}
+    , decltype(_impl_.error_type_){}
+    , decltype(_impl_.event_name_){}
     , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.source_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.project_id_.InitDefault();
@@ -6389,14 +7851,6 @@ GetCustomEventsAggRequest::GetCustomEventsAggRequest(const GetCustomEventsAggReq
     _this->_impl_.project_id_.Set(from._internal_project_id(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.event_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.event_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_event_name().empty()) {
-    _this->_impl_.event_name_.Set(from._internal_event_name(), 
-      _this->GetArenaForAllocation());
-  }
   _impl_.page_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.page_.Set("", GetArenaForAllocation());
@@ -6405,16 +7859,38 @@ GetCustomEventsAggRequest::GetCustomEventsAggRequest(const GetCustomEventsAggReq
     _this->_impl_.page_.Set(from._internal_page(), 
       _this->GetArenaForAllocation());
   }
+  _impl_.element_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.element_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_element_id()) {
+    _this->_impl_.element_id_.Set(from._internal_element_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error_type()) {
+    _this->_impl_.error_type_.Set(from._internal_error_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.event_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_event_name()) {
+    _this->_impl_.event_name_.Set(from._internal_event_name(), 
+      _this->GetArenaForAllocation());
+  }
   if (from._internal_has_time_range()) {
     _this->_impl_.time_range_ = new ::metricsys::aggregation::TimeRange(*from._impl_.time_range_);
   }
-  if (from._internal_has_pagination()) {
-    _this->_impl_.pagination_ = new ::metricsys::aggregation::Pagination(*from._impl_.pagination_);
-  }
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetCustomEventsAggRequest)
+  _this->_impl_.source_ = from._impl_.source_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetUniquesAggRequest)
 }
 
-inline void GetCustomEventsAggRequest::SharedCtor(
+inline void GetUniquesAggRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -6422,27 +7898,37 @@ inline void GetCustomEventsAggRequest::SharedCtor(
       decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.project_id_){}
-    , decltype(_impl_.event_name_){}
     , decltype(_impl_.page_){}
+    , decltype(_impl_.element_id_){}
+    , decltype(_impl_.error_type_){}
+    , decltype(_impl_.event_name_){}
     , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.source_){0}
   };
   _impl_.project_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.project_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.event_name_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.event_name_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   _impl_.page_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.page_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.element_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.element_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.event_name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-GetCustomEventsAggRequest::~GetCustomEventsAggRequest() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetCustomEventsAggRequest)
+GetUniquesAggRequest::~GetUniquesAggRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetUniquesAggRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6450,44 +7936,52 @@ GetCustomEventsAggRequest::~GetCustomEventsAggRequest() {
   SharedDtor();
 }
 
-inline void GetCustomEventsAggRequest::SharedDtor() {
+inline void GetUniquesAggRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.project_id_.Destroy();
-  _impl_.event_name_.Destroy();
   _impl_.page_.Destroy();
+  _impl_.element_id_.Destroy();
+  _impl_.error_type_.Destroy();
+  _impl_.event_name_.Destroy();
   if (this != internal_default_instance()) delete _impl_.time_range_;
-  if (this != internal_default_instance()) delete _impl_.pagination_;
 }
 
-void GetCustomEventsAggRequest::SetCachedSize(int size) const {
+void GetUniquesAggRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GetCustomEventsAggRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetCustomEventsAggRequest)
+void GetUniquesAggRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetUniquesAggRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   _impl_.project_id_.ClearToEmpty();
-  _impl_.event_name_.ClearToEmpty();
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.page_.ClearNonDefaultToEmpty();
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.page_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.element_id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.error_type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.event_name_.ClearNonDefaultToEmpty();
+    }
   }
   if (GetArenaForAllocation() == nullptr && _impl_.time_range_ != nullptr) {
     delete _impl_.time_range_;
   }
-  _impl_.time_range_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && _impl_.pagination_ != nullptr) {
-    delete _impl_.pagination_;
-  }
-  _impl_.pagination_ = nullptr;
+  _impl_.time_range_ = nullptr;
+  _impl_.source_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetCustomEventsAggRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* GetUniquesAggRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
@@ -6500,7 +7994,7 @@ const char* GetCustomEventsAggRequest::_InternalParse(const char* ptr, ::_pbi::P
           auto str = _internal_mutable_project_id();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetCustomEventsAggRequest.project_id"));
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetUniquesAggRequest.project_id"));
         } else
           goto handle_unusual;
         continue;
@@ -6512,13 +8006,12 @@ const char* GetCustomEventsAggRequest::_InternalParse(const char* ptr, ::_pbi::P
         } else
           goto handle_unusual;
         continue;
-      // string event_name = 3;
+      // .metricsys.aggregation.UniquesSource source = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_event_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetCustomEventsAggRequest.event_name"));
+          _internal_set_source(static_cast<::metricsys::aggregation::UniquesSource>(val));
         } else
           goto handle_unusual;
         continue;
@@ -6528,15 +8021,37 @@ const char* GetCustomEventsAggRequest::_InternalParse(const char* ptr, ::_pbi::P
           auto str = _internal_mutable_page();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetCustomEventsAggRequest.page"));
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetUniquesAggRequest.page"));
         } else
           goto handle_unusual;
         continue;
-      // .metricsys.aggregation.Pagination pagination = 5;
+      // optional string element_id = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          auto str = _internal_mutable_element_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetUniquesAggRequest.element_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error_type = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_error_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetUniquesAggRequest.error_type"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string event_name = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_event_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.aggregation.GetUniquesAggRequest.event_name"));
         } else
           goto handle_unusual;
         continue;
@@ -6564,9 +8079,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GetCustomEventsAggRequest::_InternalSerialize(
+uint8_t* GetUniquesAggRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetCustomEventsAggRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetUniquesAggRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -6575,7 +8090,7 @@ uint8_t* GetCustomEventsAggRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_project_id().data(), static_cast<int>(this->_internal_project_id().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.GetCustomEventsAggRequest.project_id");
+      "metricsys.aggregation.GetUniquesAggRequest.project_id");
     target = stream->WriteStringMaybeAliased(
         1, this->_internal_project_id(), target);
   }
@@ -6587,14 +8102,11 @@ uint8_t* GetCustomEventsAggRequest::_InternalSerialize(
         _Internal::time_range(this).GetCachedSize(), target, stream);
   }
 
-  // string event_name = 3;
-  if (!this->_internal_event_name().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_event_name().data(), static_cast<int>(this->_internal_event_name().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.GetCustomEventsAggRequest.event_name");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_event_name(), target);
+  // .metricsys.aggregation.UniquesSource source = 3;
+  if (this->_internal_source() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_source(), target);
   }
 
   // optional string page = 4;
@@ -6602,28 +8114,51 @@ uint8_t* GetCustomEventsAggRequest::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "metricsys.aggregation.GetCustomEventsAggRequest.page");
+      "metricsys.aggregation.GetUniquesAggRequest.page");
     target = stream->WriteStringMaybeAliased(
         4, this->_internal_page(), target);
   }
 
-  // .metricsys.aggregation.Pagination pagination = 5;
-  if (this->_internal_has_pagination()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, _Internal::pagination(this),
-        _Internal::pagination(this).GetCachedSize(), target, stream);
+  // optional string element_id = 5;
+  if (_internal_has_element_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_element_id().data(), static_cast<int>(this->_internal_element_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetUniquesAggRequest.element_id");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_element_id(), target);
+  }
+
+  // optional string error_type = 6;
+  if (_internal_has_error_type()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_type().data(), static_cast<int>(this->_internal_error_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetUniquesAggRequest.error_type");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_error_type(), target);
+  }
+
+  // optional string event_name = 7;
+  if (_internal_has_event_name()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_event_name().data(), static_cast<int>(this->_internal_event_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.aggregation.GetUniquesAggRequest.event_name");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_event_name(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetCustomEventsAggRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetUniquesAggRequest)
   return target;
 }
 
-size_t GetCustomEventsAggRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetCustomEventsAggRequest)
+size_t GetUniquesAggRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetUniquesAggRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -6637,21 +8172,37 @@ size_t GetCustomEventsAggRequest::ByteSizeLong() const {
         this->_internal_project_id());
   }
 
-  // string event_name = 3;
-  if (!this->_internal_event_name().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_event_name());
-  }
-
-  // optional string page = 4;
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_page());
-  }
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string page = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_page());
+    }
+
+    // optional string element_id = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_element_id());
+    }
+
+    // optional string error_type = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error_type());
+    }
 
+    // optional string event_name = 7;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_event_name());
+    }
+
+  }
   // .metricsys.aggregation.TimeRange time_range = 2;
   if (this->_internal_has_time_range()) {
     total_size += 1 +
@@ -6659,27 +8210,26 @@ size_t GetCustomEventsAggRequest::ByteSizeLong() const {
         *_impl_.time_range_);
   }
 
-  // .metricsys.aggregation.Pagination pagination = 5;
-  if (this->_internal_has_pagination()) {
+  // .metricsys.aggregation.UniquesSource source = 3;
+  if (this->_internal_source() != 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *_impl_.pagination_);
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_source());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetCustomEventsAggRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetUniquesAggRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GetCustomEventsAggRequest::MergeImpl
+    GetUniquesAggRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetCustomEventsAggRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetUniquesAggRequest::GetClassData() const { return &_class_data_; }
 
 
-void GetCustomEventsAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GetCustomEventsAggRequest*>(&to_msg);
-  auto& from = static_cast<const GetCustomEventsAggRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetCustomEventsAggRequest)
+void GetUniquesAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetUniquesAggRequest*>(&to_msg);
+  auto& from = static_cast<const GetUniquesAggRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetUniquesAggRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -6687,35 +8237,43 @@ void GetCustomEventsAggRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_m
   if (!from._internal_project_id().empty()) {
     _this->_internal_set_project_id(from._internal_project_id());
   }
-  if (!from._internal_event_name().empty()) {
-    _this->_internal_set_event_name(from._internal_event_name());
-  }
-  if (from._internal_has_page()) {
-    _this->_internal_set_page(from._internal_page());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_page(from._internal_page());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_element_id(from._internal_element_id());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_error_type(from._internal_error_type());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_event_name(from._internal_event_name());
+    }
   }
   if (from._internal_has_time_range()) {
     _this->_internal_mutable_time_range()->::metricsys::aggregation::TimeRange::MergeFrom(
         from._internal_time_range());
   }
-  if (from._internal_has_pagination()) {
-    _this->_internal_mutable_pagination()->::metricsys::aggregation::Pagination::MergeFrom(
-        from._internal_pagination());
+  if (from._internal_source() != 0) {
+    _this->_internal_set_source(from._internal_source());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GetCustomEventsAggRequest::CopyFrom(const GetCustomEventsAggRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetCustomEventsAggRequest)
+void GetUniquesAggRequest::CopyFrom(const GetUniquesAggRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetUniquesAggRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetCustomEventsAggRequest::IsInitialized() const {
+bool GetUniquesAggRequest::IsInitialized() const {
   return true;
 }
 
-void GetCustomEventsAggRequest::InternalSwap(GetCustomEventsAggRequest* other) {
+void GetUniquesAggRequest::InternalSwap(GetUniquesAggRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -6725,63 +8283,78 @@ void GetCustomEventsAggRequest::InternalSwap(GetCustomEventsAggRequest* other) {
       &_impl_.project_id_, lhs_arena,
       &other->_impl_.project_id_, rhs_arena
   );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.event_name_, lhs_arena,
-      &other->_impl_.event_name_, rhs_arena
-  );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &_impl_.page_, lhs_arena,
       &other->_impl_.page_, rhs_arena
   );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.element_id_, lhs_arena,
+      &other->_impl_.element_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_type_, lhs_arena,
+      &other->_impl_.error_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.event_name_, lhs_arena,
+      &other->_impl_.event_name_, rhs_arena
+  );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetCustomEventsAggRequest, _impl_.pagination_)
-      + sizeof(GetCustomEventsAggRequest::_impl_.pagination_)
-      - PROTOBUF_FIELD_OFFSET(GetCustomEventsAggRequest, _impl_.time_range_)>(
+      PROTOBUF_FIELD_OFFSET(GetUniquesAggRequest, _impl_.source_)
+      + sizeof(GetUniquesAggRequest::_impl_.source_)
+      - PROTOBUF_FIELD_OFFSET(GetUniquesAggRequest, _impl_.time_range_)>(
           reinterpret_cast<char*>(&_impl_.time_range_),
           reinterpret_cast<char*>(&other->_impl_.time_range_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetCustomEventsAggRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetUniquesAggRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
-      file_level_metadata_aggregation_2eproto[17]);
+      file_level_metadata_aggregation_2eproto[20]);
 }
 
 // ===================================================================
 
-class GetCustomEventsAggResponse::_Internal {
+class GetUniquesAggResponse::_Internal {
  public:
 };
 
-GetCustomEventsAggResponse::GetCustomEventsAggResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+GetUniquesAggResponse::GetUniquesAggResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetCustomEventsAggResponse)
+  // @@protoc_insertion_point(arena_constructor:metricsys.aggregation.GetUniquesAggResponse)
 }
-GetCustomEventsAggResponse::GetCustomEventsAggResponse(const GetCustomEventsAggResponse& from)
+GetUniquesAggResponse::GetUniquesAggResponse(const GetUniquesAggResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  GetCustomEventsAggResponse* const _this = this; (void)_this;
+  GetUniquesAggResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.rows_){from._impl_.rows_}
+      decltype(_impl_.unique_users_){}
+    , decltype(_impl_.unique_sessions_){}
+    , decltype(_impl_.buckets_count_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetCustomEventsAggResponse)
+  ::memcpy(&_impl_.unique_users_, &from._impl_.unique_users_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.buckets_count_) -
+    reinterpret_cast<char*>(&_impl_.unique_users_)) + sizeof(_impl_.buckets_count_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.aggregation.GetUniquesAggResponse)
 }
 
-inline void GetCustomEventsAggResponse::SharedCtor(
+inline void GetUniquesAggResponse::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.rows_){arena}
+      decltype(_impl_.unique_users_){int64_t{0}}
+    , decltype(_impl_.unique_sessions_){int64_t{0}}
+    , decltype(_impl_.buckets_count_){int64_t{0}}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-GetCustomEventsAggResponse::~GetCustomEventsAggResponse() {
-  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetCustomEventsAggResponse)
+GetUniquesAggResponse::~GetUniquesAggResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.aggregation.GetUniquesAggResponse)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -6789,41 +8362,53 @@ GetCustomEventsAggResponse::~GetCustomEventsAggResponse() {
   SharedDtor();
 }
 
-inline void GetCustomEventsAggResponse::SharedDtor() {
+inline void GetUniquesAggResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.rows_.~RepeatedPtrField();
 }
 
-void GetCustomEventsAggResponse::SetCachedSize(int size) const {
+void GetUniquesAggResponse::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void GetCustomEventsAggResponse::Clear() {
-// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetCustomEventsAggResponse)
+void GetUniquesAggResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.aggregation.GetUniquesAggResponse)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.rows_.Clear();
+  ::memset(&_impl_.unique_users_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.buckets_count_) -
+      reinterpret_cast<char*>(&_impl_.unique_users_)) + sizeof(_impl_.buckets_count_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* GetCustomEventsAggResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* GetUniquesAggResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .metricsys.aggregation.AggCustomEventsRow rows = 1;
+      // int64 unique_users = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_rows(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.unique_users_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 unique_sessions = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.unique_sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 buckets_count = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.buckets_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -6850,86 +8435,117 @@ failure:
 #undef CHK_
 }
 
-uint8_t* GetCustomEventsAggResponse::_InternalSerialize(
+uint8_t* GetUniquesAggResponse::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetCustomEventsAggResponse)
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.aggregation.GetUniquesAggResponse)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .metricsys.aggregation.AggCustomEventsRow rows = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_rows_size()); i < n; i++) {
-    const auto& repfield = this->_internal_rows(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  // int64 unique_users = 1;
+  if (this->_internal_unique_users() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_unique_users(), target);
+  }
+
+  // int64 unique_sessions = 2;
+  if (this->_internal_unique_sessions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_unique_sessions(), target);
+  }
+
+  // int64 buckets_count = 3;
+  if (this->_internal_buckets_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(3, this->_internal_buckets_count(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetCustomEventsAggResponse)
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.aggregation.GetUniquesAggResponse)
   return target;
 }
 
-size_t GetCustomEventsAggResponse::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetCustomEventsAggResponse)
+size_t GetUniquesAggResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.aggregation.GetUniquesAggResponse)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .metricsys.aggregation.AggCustomEventsRow rows = 1;
-  total_size += 1UL * this->_internal_rows_size();
-  for (const auto& msg : this->_impl_.rows_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // int64 unique_users = 1;
+  if (this->_internal_unique_users() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_users());
+  }
+
+  // int64 unique_sessions = 2;
+  if (this->_internal_unique_sessions() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_unique_sessions());
+  }
+
+  // int64 buckets_count = 3;
+  if (this->_internal_buckets_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_buckets_count());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetCustomEventsAggResponse::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetUniquesAggResponse::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    GetCustomEventsAggResponse::MergeImpl
+    GetUniquesAggResponse::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetCustomEventsAggResponse::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetUniquesAggResponse::GetClassData() const { return &_class_data_; }
 
 
-void GetCustomEventsAggResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<GetCustomEventsAggResponse*>(&to_msg);
-  auto& from = static_cast<const GetCustomEventsAggResponse&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetCustomEventsAggResponse)
+void GetUniquesAggResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetUniquesAggResponse*>(&to_msg);
+  auto& from = static_cast<const GetUniquesAggResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.aggregation.GetUniquesAggResponse)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.rows_.MergeFrom(from._impl_.rows_);
+  if (from._internal_unique_users() != 0) {
+    _this->_internal_set_unique_users(from._internal_unique_users());
+  }
+  if (from._internal_unique_sessions() != 0) {
+    _this->_internal_set_unique_sessions(from._internal_unique_sessions());
+  }
+  if (from._internal_buckets_count() != 0) {
+    _this->_internal_set_buckets_count(from._internal_buckets_count());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void GetCustomEventsAggResponse::CopyFrom(const GetCustomEventsAggResponse& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetCustomEventsAggResponse)
+void GetUniquesAggResponse::CopyFrom(const GetUniquesAggResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.aggregation.GetUniquesAggResponse)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool GetCustomEventsAggResponse::IsInitialized() const {
+bool GetUniquesAggResponse::IsInitialized() const {
   return true;
 }
 
-void GetCustomEventsAggResponse::InternalSwap(GetCustomEventsAggResponse* other) {
+void GetUniquesAggResponse::InternalSwap(GetUniquesAggResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.rows_.InternalSwap(&other->_impl_.rows_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetUniquesAggResponse, _impl_.buckets_count_)
+      + sizeof(GetUniquesAggResponse::_impl_.buckets_count_)
+      - PROTOBUF_FIELD_OFFSET(GetUniquesAggResponse, _impl_.unique_users_)>(
+          reinterpret_cast<char*>(&_impl_.unique_users_),
+          reinterpret_cast<char*>(&other->_impl_.unique_users_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata GetCustomEventsAggResponse::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata GetUniquesAggResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_aggregation_2eproto_getter, &descriptor_table_aggregation_2eproto_once,
-      file_level_metadata_aggregation_2eproto[18]);
+      file_level_metadata_aggregation_2eproto[21]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -6976,6 +8592,10 @@ template<> PROTOBUF_NOINLINE ::metricsys::aggregation::GetClicksAggResponse*
 Arena::CreateMaybeMessage< ::metricsys::aggregation::GetClicksAggResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::metricsys::aggregation::GetClicksAggResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::metricsys::aggregation::PerformanceQuantile*
+Arena::CreateMaybeMessage< ::metricsys::aggregation::PerformanceQuantile >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::aggregation::PerformanceQuantile >(arena);
+}
 template<> PROTOBUF_NOINLINE ::metricsys::aggregation::AggPerformanceRow*
 Arena::CreateMaybeMessage< ::metricsys::aggregation::AggPerformanceRow >(Arena* arena) {
   return Arena::CreateMessageInternal< ::metricsys::aggregation::AggPerformanceRow >(arena);
@@ -7012,6 +8632,14 @@ template<> PROTOBUF_NOINLINE ::metricsys::aggregation::GetCustomEventsAggRespons
 Arena::CreateMaybeMessage< ::metricsys::aggregation::GetCustomEventsAggResponse >(Arena* arena) {
   return Arena::CreateMessageInternal< ::metricsys::aggregation::GetCustomEventsAggResponse >(arena);
 }
+template<> PROTOBUF_NOINLINE ::metricsys::aggregation::GetUniquesAggRequest*
+Arena::CreateMaybeMessage< ::metricsys::aggregation::GetUniquesAggRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::aggregation::GetUniquesAggRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::aggregation::GetUniquesAggResponse*
+Arena::CreateMaybeMessage< ::metricsys::aggregation::GetUniquesAggResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::aggregation::GetUniquesAggResponse >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -1,7 +1,12 @@
 #include "aggregation_server.h"
 #include "database.h"
+#include "database_pool.h"
 #include "aggregator.h"
+#include "ddsketch.h"
+#include "hot_window.h"
 #include <iostream>
+#include <map>
+#include <optional>
 #include <grpcpp/ext/proto_server_reflection_plugin.h>
 #include <grpcpp/health_check_service_interface.h>
 
@@ -29,21 +34,109 @@ static std::chrono::system_clock::time_point timestampToTimePoint(
     return std::chrono::system_clock::time_point(seconds + nanos);
 }
 
+// Сколько строк бакетов merge_buckets читает за один запрос. Страницы после слияния
+// сортируются по имени, поэтому обрезать чтение раньше нельзя — часть бакетов
+// молча выпала бы из слияния; вместо этого запрос отклоняется
+static constexpr int MERGE_BUCKETS_MAX_ROWS = 100000;
+
+// Слияние одной метрики нескольких бакетов: скетчи складываются,
+// среднее взвешивается числом значений в скетче
+struct MetricMerge {
+    DDSketch sketch;
+    double sum = 0.0;
+
+    void add(double avg, const std::string& bytes) {
+        auto part = DDSketch::deserialize(bytes);
+        sum += avg * static_cast<double>(part.count());
+        sketch.merge(part);
+    }
+
+    void finish(double& avg, double& p95, std::string& bytes) const {
+        avg = sketch.empty() ? 0.0 : sum / static_cast<double>(sketch.count());
+        p95 = sketch.quantile(0.95);
+        bytes = sketch.serialize();
+    }
+};
+
+// Одна строка на страницу за весь диапазон; time_bucket — начало диапазона,
+// step_seconds — его длина
+static std::vector<AggregatedPerformance> mergePerformanceBuckets(
+    const std::vector<AggregatedPerformance>& rows,
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to
+) {
+    struct PageMerge {
+        AggregatedPerformance row;
+        MetricMerge totalLoad, ttfb, fcp, lcp;
+    };
+
+    std::map<std::string, PageMerge> pages;
+    for (const auto& item : rows) {
+        auto& page = pages[item.page];
+        page.row.projectId = item.projectId;
+        page.row.page = item.page;
+        page.row.samplesCount += item.samplesCount;
+        page.totalLoad.add(item.avgTotalLoadMs, item.totalLoadSketch);
+        page.ttfb.add(item.avgTtfbMs, item.ttfbSketch);
+        page.fcp.add(item.avgFcpMs, item.fcpSketch);
+        page.lcp.add(item.avgLcpMs, item.lcpSketch);
+    }
+
+    std::vector<AggregatedPerformance> result;
+    result.reserve(pages.size());
+    for (auto& [name, page] : pages) {
+        auto& row = page.row;
+        row.timeBucket = from;
+        row.stepSeconds = std::chrono::duration_cast<std::chrono::seconds>(to - from).count();
+        page.totalLoad.finish(row.avgTotalLoadMs, row.p95TotalLoadMs, row.totalLoadSketch);
+        page.ttfb.finish(row.avgTtfbMs, row.p95TtfbMs, row.ttfbSketch);
+        page.fcp.finish(row.avgFcpMs, row.p95FcpMs, row.fcpSketch);
+        page.lcp.finish(row.avgLcpMs, row.p95LcpMs, row.lcpSketch);
+        result.push_back(std::move(row));
+    }
+    return result;
+}
+
 // ===== AggregationServiceImpl =====
 
-AggregationServiceImpl::AggregationServiceImpl(Database& db)
-    : database_(db) {
+AggregationServiceImpl::AggregationServiceImpl(DatabasePool& readers, HotWindowCache* hotWindow)
+    : readers_(readers), hotWindow_(hotWindow) {
 }
 
 AggregationServiceImpl::~AggregationServiceImpl() = default;
 
+std::vector<TimeSegment> AggregationServiceImpl::planSegments(
+    Database& database,
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    uint32_t stepSeconds
+) {
+    auto step = stepSeconds > 0 ? std::chrono::seconds(stepSeconds) : autoStep(from, to);
+    return planResolution(from, to, step, database.getRollupWatermarks());
+}
+
+bool AggregationServiceImpl::hotWindowServes(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    uint32_t stepSeconds
+) const {
+    if (!hotWindow_) return false;
+    auto step = stepSeconds > 0 ? std::chrono::seconds(stepSeconds) : autoStep(from, to);
+    return step < ROLLUP_LEVELS[1];
+}
+
 grpc::Status AggregationServiceImpl::GetWatermark(
     grpc::ServerContext* context,
     const metricsys::aggregation::GetWatermarkRequest* request,
     metricsys::aggregation::GetWatermarkResponse* response
 ) {
     try {
-        auto watermark = database_.getWatermark();
+        auto database = readers_.acquire();
+        if (!database) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "no database connection available");
+        }
+
+        auto watermark = database->getWatermark();
         timePointToTimestamp(watermark, response->mutable_last_aggregated_at());
         return grpc::Status::OK;
     } catch (const std::exception& e) {
@@ -68,16 +161,27 @@ grpc::Status AggregationServiceImpl::GetPageViewsAgg(
         int limit = request->pagination().limit() > 0 ? request->pagination().limit() : 1000;
         int offset = request->pagination().offset();
 
-        auto data = database_.readPageViews(
-            request->project_id(),
-            from,
-            to,
-            pageFilter,
-            limit,
-            offset
-        );
+        std::optional<std::vector<AggregatedPageViews>> data;
+        if (hotWindowServes(from, to, request->step_seconds())) {
+            data = hotWindow_->readPageViews(request->project_id(), from, to, pageFilter, limit, offset);
+        }
+        if (!data) {
+            auto database = readers_.acquire();
+            if (!database) {
+                return grpc::Status(grpc::StatusCode::UNAVAILABLE, "no database connection available");
+            }
 
-        for (const auto& item : data) {
+            auto segments = planSegments(*database, from, to, request->step_seconds());
+            data = database->readPageViews(
+                request->project_id(),
+                segments,
+                pageFilter,
+                limit,
+                offset
+            );
+        }
+
+        for (const auto& item : *data) {
             auto* row = response->add_rows();
             timePointToTimestamp(item.timeBucket, row->mutable_time_bucket());
             row->set_project_id(item.projectId);
@@ -86,6 +190,7 @@ grpc::Status AggregationServiceImpl::GetPageViewsAgg(
             row->set_unique_users(item.uniqueUsers);
             row->set_unique_sessions(item.uniqueSessions);
             timePointToTimestamp(std::chrono::system_clock::now(), row->mutable_created_at());
+            row->set_step_seconds(static_cast<uint32_t>(item.stepSeconds));
         }
 
         return grpc::Status::OK;
@@ -104,18 +209,23 @@ grpc::Status AggregationServiceImpl::GetClicksAgg(
             return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "project_id is required");
         }
 
+        auto database = readers_.acquire();
+        if (!database) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "no database connection available");
+        }
+
         auto from = timestampToTimePoint(request->time_range().from());
         auto to = timestampToTimePoint(request->time_range().to());
+        auto segments = planSegments(*database, from, to, request->step_seconds());
 
         std::string pageFilter = request->has_page() ? request->page() : "";
         std::string elementIdFilter = request->has_element_id() ? request->element_id() : "";
         int limit = request->pagination().limit() > 0 ? request->pagination().limit() : 1000;
         int offset = request->pagination().offset();
 
-        auto data = database_.readClicks(
+        auto data = database->readClicks(
             request->project_id(),
-            from,
-            to,
+            segments,
             pageFilter,
             elementIdFilter,
             limit,
@@ -134,6 +244,7 @@ grpc::Status AggregationServiceImpl::GetClicksAgg(
             row->set_unique_users(item.uniqueUsers);
             row->set_unique_sessions(item.uniqueSessions);
             timePointToTimestamp(std::chrono::system_clock::now(), row->mutable_created_at());
+            row->set_step_seconds(static_cast<uint32_t>(item.stepSeconds));
         }
 
         return grpc::Status::OK;
@@ -152,6 +263,12 @@ grpc::Status AggregationServiceImpl::GetPerformanceAgg(
             return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "project_id is required");
         }
 
+        for (double q : request->quantiles()) {
+            if (!(q >= 0.0 && q <= 1.0)) {
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "quantiles must be within [0, 1]");
+            }
+        }
+
         auto from = timestampToTimePoint(request->time_range().from());
         auto to = timestampToTimePoint(request->time_range().to());
 
@@ -159,14 +276,45 @@ grpc::Status AggregationServiceImpl::GetPerformanceAgg(
         int limit = request->pagination().limit() > 0 ? request->pagination().limit() : 1000;
         int offset = request->pagination().offset();
 
-        auto data = database_.readPerformance(
-            request->project_id(),
-            from,
-            to,
-            pageFilter,
-            limit,
-            offset
-        );
+        // При merge_buckets пагинация применяется к уже объединённым строкам;
+        // лишняя строка сверх предела показывает, что диапазон слишком велик
+        int readLimit = request->merge_buckets() ? MERGE_BUCKETS_MAX_ROWS + 1 : limit;
+        int readOffset = request->merge_buckets() ? 0 : offset;
+
+        std::optional<std::vector<AggregatedPerformance>> buckets;
+        if (hotWindowServes(from, to, request->step_seconds())) {
+            buckets = hotWindow_->readPerformance(request->project_id(), from, to, pageFilter, readLimit, readOffset);
+        }
+        if (!buckets) {
+            auto database = readers_.acquire();
+            if (!database) {
+                return grpc::Status(grpc::StatusCode::UNAVAILABLE, "no database connection available");
+            }
+
+            auto segments = planSegments(*database, from, to, request->step_seconds());
+            buckets = database->readPerformance(
+                request->project_id(),
+                segments,
+                pageFilter,
+                readLimit,
+                readOffset
+            );
+        }
+
+        std::vector<AggregatedPerformance> data;
+        if (request->merge_buckets()) {
+            if (buckets->size() > static_cast<size_t>(MERGE_BUCKETS_MAX_ROWS)) {
+                return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                    "merge_buckets range exceeds " + std::to_string(MERGE_BUCKETS_MAX_ROWS) +
+                                        " bucket rows; narrow the range, raise step_seconds or filter by page");
+            }
+            data = mergePerformanceBuckets(*buckets, from, to);
+            auto begin = std::min(data.size(), static_cast<size_t>(offset));
+            auto end = std::min(data.size(), begin + static_cast<size_t>(limit));
+            data = std::vector<AggregatedPerformance>(data.begin() + begin, data.begin() + end);
+        } else {
+            data = std::move(*buckets);
+        }
 
         for (const auto& item : data) {
             auto* row = response->add_rows();
@@ -183,6 +331,22 @@ grpc::Status AggregationServiceImpl::GetPerformanceAgg(
             row->set_avg_lcp_ms(item.avgLcpMs);
             row->set_p95_lcp_ms(item.p95LcpMs);
             timePointToTimestamp(std::chrono::system_clock::now(), row->mutable_created_at());
+            row->set_step_seconds(static_cast<uint32_t>(item.stepSeconds));
+
+            if (request->quantiles_size() > 0) {
+                auto totalLoad = DDSketch::deserialize(item.totalLoadSketch);
+                auto ttfb = DDSketch::deserialize(item.ttfbSketch);
+                auto fcp = DDSketch::deserialize(item.fcpSketch);
+                auto lcp = DDSketch::deserialize(item.lcpSketch);
+                for (double q : request->quantiles()) {
+                    auto* quantile = row->add_quantiles();
+                    quantile->set_quantile(q);
+                    quantile->set_total_load_ms(totalLoad.quantile(q));
+                    quantile->set_ttfb_ms(ttfb.quantile(q));
+                    quantile->set_fcp_ms(fcp.quantile(q));
+                    quantile->set_lcp_ms(lcp.quantile(q));
+                }
+            }
         }
 
         return grpc::Status::OK;
@@ -201,18 +365,23 @@ grpc::Status AggregationServiceImpl::GetErrorsAgg(
             return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "project_id is required");
         }
 
+        auto database = readers_.acquire();
+        if (!database) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "no database connection available");
+        }
+
         auto from = timestampToTimePoint(request->time_range().from());
         auto to = timestampToTimePoint(request->time_range().to());
+        auto segments = planSegments(*database, from, to, request->step_seconds());
 
         std::string pageFilter = request->has_page() ? request->page() : "";
         std::string errorTypeFilter = request->has_error_type() ? request->error_type() : "";
         int limit = request->pagination().limit() > 0 ? request->pagination().limit() : 1000;
         int offset = request->pagination().offset();
 
-        auto data = database_.readErrors(
+        auto data = database->readErrors(
             request->project_id(),
-            from,
-            to,
+            segments,
             pageFilter,
             errorTypeFilter,
             limit,
@@ -232,6 +401,7 @@ grpc::Status AggregationServiceImpl::GetErrorsAgg(
             row->set_critical_count(item.criticalCount);
             row->set_unique_users(item.uniqueUsers);
             timePointToTimestamp(std::chrono::system_clock::now(), row->mutable_created_at());
+            row->set_step_seconds(static_cast<uint32_t>(item.stepSeconds));
         }
 
         return grpc::Status::OK;
@@ -253,17 +423,22 @@ grpc::Status AggregationServiceImpl::GetCustomEventsAgg(
             return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "event_name is required");
         }
 
+        auto database = readers_.acquire();
+        if (!database) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "no database connection available");
+        }
+
         auto from = timestampToTimePoint(request->time_range().from());
         auto to = timestampToTimePoint(request->time_range().to());
+        auto segments = planSegments(*database, from, to, request->step_seconds());
 
         std::string pageFilter = request->has_page() ? request->page() : "";
         int limit = request->pagination().limit() > 0 ? request->pagination().limit() : 1000;
         int offset = request->pagination().offset();
 
-        auto data = database_.readCustomEvents(
+        auto data = database->readCustomEvents(
             request->project_id(),
-            from,
-            to,
+            segments,
             request->event_name(),
             pageFilter,
             limit,
@@ -282,8 +457,64 @@ grpc::Status AggregationServiceImpl::GetCustomEventsAgg(
             row->set_unique_users(item.uniqueUsers);
             row->set_unique_sessions(item.uniqueSessions);
             timePointToTimestamp(std::chrono::system_clock::now(), row->mutable_created_at());
+            row->set_step_seconds(static_cast<uint32_t>(item.stepSeconds));
+        }
+
+        return grpc::Status::OK;
+    } catch (const std::exception& e) {
+        return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+    }
+}
+
+grpc::Status AggregationServiceImpl::GetUniquesAgg(
+    grpc::ServerContext* context,
+    const metricsys::aggregation::GetUniquesAggRequest* request,
+    metricsys::aggregation::GetUniquesAggResponse* response
+) {
+    try {
+        if (request->project_id().empty()) {
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "project_id is required");
+        }
+
+        UniquesSource source;
+        std::string extraFilter;
+        switch (request->source()) {
+            case metricsys::aggregation::UNIQUES_SOURCE_PAGE_VIEWS:
+                source = UniquesSource::PageViews;
+                break;
+            case metricsys::aggregation::UNIQUES_SOURCE_CLICKS:
+                source = UniquesSource::Clicks;
+                extraFilter = request->has_element_id() ? request->element_id() : "";
+                break;
+            case metricsys::aggregation::UNIQUES_SOURCE_ERRORS:
+                source = UniquesSource::Errors;
+                extraFilter = request->has_error_type() ? request->error_type() : "";
+                break;
+            case metricsys::aggregation::UNIQUES_SOURCE_CUSTOM_EVENTS:
+                source = UniquesSource::CustomEvents;
+                extraFilter = request->has_event_name() ? request->event_name() : "";
+                break;
+            default:
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "source is required");
+        }
+
+        auto database = readers_.acquire();
+        if (!database) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "no database connection available");
         }
 
+        auto from = timestampToTimePoint(request->time_range().from());
+        auto to = timestampToTimePoint(request->time_range().to());
+        std::string pageFilter = request->has_page() ? request->page() : "";
+
+        // Для uniques шаг не важен: читаем с самого крупного готового уровня
+        auto segments = planSegments(*database, from, to, static_cast<uint32_t>(ROLLUP_LEVELS.back().count()));
+        auto counts = database->readUniques(source, request->project_id(), segments, pageFilter, extraFilter);
+
+        response->set_unique_users(counts.uniqueUsers);
+        response->set_unique_sessions(counts.uniqueSessions);
+        response->set_buckets_count(counts.bucketsCount);
+
         return grpc::Status::OK;
     } catch (const std::exception& e) {
         return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
@@ -292,8 +523,9 @@ grpc::Status AggregationServiceImpl::GetCustomEventsAgg(
 
 // ===== AggregationGrpcServer =====
 
-AggregationGrpcServer::AggregationGrpcServer(Database& db, const std::string& server_address)
-    : service_(std::make_unique<AggregationServiceImpl>(db))
+AggregationGrpcServer::AggregationGrpcServer(DatabasePool& readers, const std::string& server_address,
+                                             HotWindowCache* hotWindow)
+    : service_(std::make_unique<AggregationServiceImpl>(readers, hotWindow))
     , server_address_(server_address) {
 }
 
@@ -1,125 +1,308 @@
 #include "aggregator.h"
 #include "database.h"
+#include "database_pool.h"
+#include "hot_window.h"
 #include "metrics_client.h"
+#include "rollup.h"
 
 #include <iostream>
 #include <algorithm>
-#include <unordered_map>
-#include <unordered_set>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
 
 namespace aggregation {
 
-Aggregator::Aggregator(Database& db, MetricsClient& metricsClient)
-    : database_(db), metricsClient_(metricsClient) {
+// Вспомогательная функция для округления времени до bucket
+static std::chrono::system_clock::time_point truncateToBucket(
+    std::chrono::system_clock::time_point tp,
+    std::chrono::minutes bucketSize
+) {
+    auto duration = tp.time_since_epoch();
+    auto minutes = std::chrono::duration_cast<std::chrono::minutes>(duration);
+    auto bucketMinutes = (minutes.count() / bucketSize.count()) * bucketSize.count();
+    return std::chrono::system_clock::time_point(std::chrono::minutes(bucketMinutes));
+}
+
+// Дописывает строки from в конец to
+static void appendResult(AggregationResult& to, AggregationResult&& from) {
+    auto append = [](auto& target, auto& source) {
+        target.insert(target.end(), std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+    };
+    append(to.pageViews, from.pageViews);
+    append(to.clicks, from.clicks);
+    append(to.performance, from.performance);
+    append(to.errors, from.errors);
+    append(to.customEvents, from.customEvents);
+}
+
+// Вызывает visit для каждого номера SymbolTable в пачках
+template <typename Batches, typename Visit>
+static void forEachSymbol(Batches& batches, Visit&& visit) {
+    batches.forEach([&visit](auto& batch) {
+        std::apply([&visit](auto&... column) {
+            (std::for_each(column.begin(), column.end(), visit), ...);
+        }, batch.symbols());
+    });
+}
+
+Aggregator::Aggregator(DatabasePool& writer, MetricsClient& metricsClient, std::chrono::seconds fetchLag,
+                       std::chrono::seconds allowedLateness, size_t maxSymbols)
+    : writer_(writer), metricsClient_(metricsClient), fetchLag_(fetchLag),
+      allowedLateness_(allowedLateness), maxSymbols_(maxSymbols), engine_(BASE_BUCKET, symbols_) {
 }
 
 Aggregator::~Aggregator() = default;
 
+void Aggregator::resetEngine() {
+    engine_.clear();
+    late_.clear();
+    tooLate_.clear();
+    fetchedUntil_.reset();
+    // Незаписанное окно перечитается вместе с остальным с watermark из БД
+    pending_.reset();
+}
+
+Aggregator::Lateness Aggregator::classify(std::chrono::system_clock::time_point timestamp,
+                                          std::chrono::system_clock::time_point closedBefore,
+                                          std::chrono::seconds allowedLateness) {
+    // closedBefore выровнен по бакету, поэтому сравнивать можно само время события
+    if (timestamp >= closedBefore) return Lateness::OnTime;
+    if (timestamp >= closedBefore - allowedLateness) return Lateness::Late;
+    return Lateness::TooLate;
+}
+
+void Aggregator::route(const EventBatches& events,
+                       std::chrono::system_clock::time_point closedUntil,
+                       std::chrono::system_clock::time_point next) {
+    auto routeBatch = [&](const auto& batch, auto& late, auto& tooLate) {
+        std::vector<Lateness> lateness(batch.size());
+        bool allOnTime = true;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            // Событие, принятое после next, попадёт уже в следующее окно: к тому
+            // моменту закрыты будут бакеты до next
+            auto closedBefore = batch.receivedAt[i] < next ? closedUntil : next;
+            lateness[i] = classify(batch.timestamp[i], closedBefore, allowedLateness_);
+            allOnTime = allOnTime && lateness[i] == Lateness::OnTime;
+        }
+        // Обычно весь чанк попадает в открытые бакеты и уходит в движок без копий
+        if (allOnTime) {
+            engine_.add(batch);
+            return;
+        }
+
+        std::remove_cvref_t<decltype(batch)> onTime;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            switch (lateness[i]) {
+                case Lateness::OnTime:
+                    appendRow(onTime, batch, i);
+                    break;
+                case Lateness::Late:
+                    appendRow(late, batch, i);
+                    break;
+                case Lateness::TooLate:
+                    appendRow(tooLate, batch, i);
+                    break;
+            }
+        }
+        engine_.add(onTime);
+    };
+
+    routeBatch(events.pageViews, late_.pageViews, tooLate_.pageViews);
+    routeBatch(events.clicks, late_.clicks, tooLate_.clicks);
+    routeBatch(events.performance, late_.performance, tooLate_.performance);
+    routeBatch(events.errors, late_.errors, tooLate_.errors);
+    routeBatch(events.customEvents, late_.customEvents, tooLate_.customEvents);
+}
+
+Aggregator::PendingCommit Aggregator::makeCommit(Database& database, std::chrono::system_clock::time_point to) {
+    // Границы свёртки читаются до того, как движок отдаст бакеты: при ошибке
+    // состояние не меняется и окно соберётся в следующем цикле
+    bool hasLate = late_.hasReceivedBefore(to);
+    RollupWatermarks rolledUp;
+    if (hasLate) {
+        rolledUp = database.getRollupWatermarks();
+        if (rolledUp.empty()) {
+            throw std::runtime_error("Failed to read rollup watermarks for late events");
+        }
+    }
+
+    PendingCommit commit{engine_.finalizeBefore(to), watermark_, to, {}, {}, 0};
+
+    if (hasLate) {
+        LateCorrections corrections(symbols_);
+        corrections.add(late_.takeReceivedBefore(to));
+        commit.lateCount = corrections.eventsCount();
+        commit.corrections = corrections.take(rolledUp);
+    }
+
+    // Опоздавшие события, принятые после to, войдут в следующее окно: после рестарта
+    // они перечитываются с watermark и не должны быть уже записаны
+    commit.tooLate = tooLate_.takeReceivedBefore(to);
+    return commit;
+}
+
+void Aggregator::refreshHotWindow(Database& database, const AggregationResult& corrections) {
+    const auto step = ROLLUP_LEVELS.front();
+
+    std::map<std::string, std::set<std::chrono::system_clock::time_point>> dirty;
+    auto mark = [&](const auto& rows) {
+        for (const auto& row : rows) {
+            if (row.stepSeconds == step.count()) dirty[row.projectId].insert(row.timeBucket);
+        }
+    };
+    mark(corrections.pageViews);
+    mark(corrections.performance);
+
+    for (const auto& [projectId, buckets] : dirty) {
+        std::vector<TimeSegment> segments;
+        for (auto bucket : buckets) {
+            segments.push_back({step, bucket, bucket + step});
+        }
+        constexpr int ALL = std::numeric_limits<int>::max();
+        hotWindow_->refresh(database.readPageViews(projectId, segments, "", ALL),
+                            database.readPerformance(projectId, segments, "", ALL));
+    }
+}
+
+bool Aggregator::commitPending(Database& database) {
+    switch (database.commitAggregation(pending_->result, pending_->from, pending_->to,
+                                       pending_->corrections, pending_->tooLate, symbols_)) {
+        case CommitStatus::Committed:
+            std::cout << "Aggregation committed successfully. Watermark updated." << std::endl;
+            break;
+        case CommitStatus::AlreadyCommitted:
+            std::cout << "Aggregation window was already committed. Watermark updated." << std::endl;
+            break;
+        case CommitStatus::Failed:
+            std::cerr << "Failed to commit aggregation window, nothing was written" << std::endl;
+            return false;
+    }
+
+    if (pending_->lateCount > 0 || !pending_->tooLate.empty()) {
+        std::cout << "Late events: " << pending_->lateCount << " merged into written buckets, "
+                  << pending_->tooLate.size() << " beyond allowed lateness saved to late_events" << std::endl;
+        lateEvents_.fetch_add(static_cast<uint64_t>(pending_->lateCount), std::memory_order_relaxed);
+        tooLateEvents_.fetch_add(pending_->tooLate.size(), std::memory_order_relaxed);
+    }
+
+    if (hotWindow_) {
+        hotWindow_->add(pending_->result, pending_->from, pending_->to);
+        refreshHotWindow(database, pending_->corrections);
+    }
+    watermark_ = pending_->to;
+    pending_.reset();
+    return true;
+}
+
 void Aggregator::run() {
     std::cout << "Aggregator::run() started" << std::endl;
 
     try {
-        // 1. Получаем watermark - с какого времени агрегировать
-        auto watermark = database_.getWatermark();
+        auto database = writer_.acquire();
+        if (!database) {
+            throw std::runtime_error("Writer database connection is not available");
+        }
+
+        // 1. Определяем окно чтения. После старта или ошибки начинаем с watermark
+        //    из БД: это граница последнего записанного бакета
+        if (!fetchedUntil_) {
+            engine_.clear();
+            watermark_ = database->getWatermark();
+            fetchedUntil_ = watermark_;
+        }
+        compactSymbols();
+        auto from = *fetchedUntil_;
+        // Конец окна metrics-service урезает до своего горизонта записи, так что
+        // непрочитанные события окна не появятся в нём позже
         auto now = std::chrono::system_clock::now();
+        // Бакеты до closedUntil уже записаны (или ждут повтора в pending_),
+        // этот цикл закроет бакеты до next; отставание только уменьшает число поправок
+        auto closedUntil = pending_ ? pending_->to : watermark_;
+        auto next = std::max(closedUntil, truncateToBucket(now - fetchLag_, engine_.bucketSize()));
 
         std::cout << "Watermark: last aggregated at epoch + "
-                  << std::chrono::duration_cast<std::chrono::seconds>(watermark.time_since_epoch()).count()
-                  << " seconds" << std::endl;
-
-        // 2. Получаем события от metrics-service через gRPC
-        std::vector<RawEvent> rawEvents;
+                  << std::chrono::duration_cast<std::chrono::seconds>(watermark_.time_since_epoch()).count()
+                  << " seconds, reading from epoch + "
+                  << std::chrono::duration_cast<std::chrono::seconds>(from.time_since_epoch()).count()
+                  << std::endl;
+
+        // 2. Получаем от metrics-service события, принятые с прошлого цикла, через gRPC
+        //    чанками и сразу раскладываем: в движок (бакеты базового уровня по времени
+        //    события) или в поправки к уже записанным бакетам
+        auto onChunk = [this, closedUntil, next](const EventBatches& chunk) {
+            route(chunk, closedUntil, next);
+        };
 
         try {
             if (metricsClient_.isConnected()) {
-                std::cout << "Fetching events from metrics-service via gRPC..." << std::endl;
-                rawEvents = metricsClient_.fetchAllEvents(watermark, now);
-                std::cout << "Received " << rawEvents.size() << " events from metrics-service" << std::endl;
+                std::cout << "Streaming events from metrics-service via gRPC..." << std::endl;
+                auto received = metricsClient_.streamAllEvents(from, now, symbols_, onChunk);
+                std::cout << "Received " << received << " events from metrics-service" << std::endl;
             } else {
                 std::cout << "Warning: metrics-service not available, using test data" << std::endl;
 
-                // Fallback: создаём тестовые события для проверки
+                EventBatches testEvents;
+                const SymbolId project = symbols_.intern("test-project");
+                const SymbolId home = symbols_.intern("/home");
+
                 // Тестовые page_view события
                 for (int i = 0; i < 5; ++i) {
-                    RawEvent e;
-                    e.projectId = "test-project";
-                    e.page = "/home";
-                    e.eventType = "page_view";
-                    e.userId = "user-" + std::to_string(i % 3);
-                    e.sessionId = "session-" + std::to_string(i);
-                    e.timestamp = now - std::chrono::minutes(i);
-                    rawEvents.push_back(e);
+                    testEvents.pageViews.append(project, home,
+                                                symbols_.intern("user-" + std::to_string(i % 3)),
+                                                symbols_.intern("session-" + std::to_string(i)),
+                                                now - std::chrono::minutes(i), now);
                 }
 
                 // Тестовые performance события
+                auto& performance = testEvents.performance;
                 for (int i = 0; i < 3; ++i) {
-                    RawEvent e;
-                    e.projectId = "test-project";
-                    e.page = "/home";
-                    e.eventType = "performance";
-                    e.userId = "user-" + std::to_string(i);
-                    e.sessionId = "session-perf-" + std::to_string(i);
-                    e.timestamp = now - std::chrono::minutes(i);
-                    e.totalPageLoadMs = 100.0 + i * 50.0;
-                    e.ttfbMs = 20.0 + i * 5.0;
-                    e.fcpMs = 50.0 + i * 10.0;
-                    e.lcpMs = 80.0 + i * 15.0;
-                    rawEvents.push_back(e);
+                    performance.append(project, home,
+                                       symbols_.intern("user-" + std::to_string(i)),
+                                       symbols_.intern("session-perf-" + std::to_string(i)),
+                                       now - std::chrono::minutes(i), now);
+                    performance.totalPageLoadMs.push_back(100.0 + i * 50.0);
+                    performance.ttfbMs.push_back(20.0 + i * 5.0);
+                    performance.fcpMs.push_back(50.0 + i * 10.0);
+                    performance.lcpMs.push_back(80.0 + i * 15.0);
                 }
 
                 // Тестовые error события
-                {
-                    RawEvent e;
-                    e.projectId = "test-project";
-                    e.page = "/checkout";
-                    e.eventType = "error";
-                    e.isError = true;
-                    e.errorType = "NetworkError";
-                    e.errorMessage = "Failed to fetch";
-                    e.severity = 2; // ERROR
-                    e.userId = "user-1";
-                    e.timestamp = now;
-                    rawEvents.push_back(e);
-                }
+                testEvents.errors.append(project, symbols_.intern("/checkout"), symbols_.intern("user-1"),
+                                         EMPTY_SYMBOL, now, now);
+                testEvents.errors.errorType.push_back(symbols_.intern("NetworkError"));
+                testEvents.errors.severity.push_back(2); // ERROR
+
+                onChunk(testEvents);
             }
         } catch (const std::exception& e) {
+            // Часть окна уже в движке — проще перечитать всё с watermark
+            resetEngine();
             std::cerr << "ERROR: Failed to fetch events from metrics-service: " << e.what() << std::endl;
             throw std::runtime_error("Failed to fetch events: " + std::string(e.what()));
         }
+        fetchedUntil_ = now;
 
-        std::cout << "Processing " << rawEvents.size() << " events" << std::endl;
-
-        // 3. Агрегируем события (5-минутные бакеты)
-        AggregationResult result;
-        try {
-            result = aggregateEvents(rawEvents, std::chrono::minutes(5));
-        } catch (const std::exception& e) {
-            std::cerr << "ERROR: Failed to aggregate events: " << e.what() << std::endl;
-            throw std::runtime_error("Failed to aggregate events: " + std::string(e.what()));
-        }
-
-        // 4. Записываем в БД
-        bool success = false;
-        try {
-            success = database_.writeAggregationResult(result);
-        } catch (const std::exception& e) {
-            std::cerr << "ERROR: Failed to write aggregation results: " << e.what() << std::endl;
-            throw std::runtime_error("Failed to write to database: " + std::string(e.what()));
+        // 3. Окно, не записанное в прошлом цикле, повторяем как есть: коммит
+        //    идемпотентен по окну, перечитывать события не нужно
+        if (pending_ && !commitPending(*database)) {
+            throw std::runtime_error("Failed to commit aggregation window, will retry");
         }
 
-        if (success) {
-            // 5. Обновляем watermark
-            try {
-                database_.updateWatermark(now);
-                std::cout << "Aggregation completed successfully. Watermark updated." << std::endl;
-            } catch (const std::exception& e) {
-                std::cerr << "ERROR: Failed to update watermark: " << e.what() << std::endl;
-                throw std::runtime_error("Failed to update watermark: " + std::string(e.what()));
+        // 4. Бакеты, закончившиеся до нового watermark, больше не изменятся.
+        //    Агрегаты, поправки опоздавших и сдвиг watermark записываются одной транзакцией
+        if (next > watermark_) {
+            pending_ = makeCommit(*database, next);
+            if (!commitPending(*database)) {
+                throw std::runtime_error("Failed to commit aggregation window, will retry");
             }
         } else {
-            std::cerr << "Failed to write aggregation results to database." << std::endl;
-            throw std::runtime_error("Failed to write aggregation results");
+            std::cout << "Aggregation completed successfully. No buckets finalized yet." << std::endl;
         }
+
+        std::cout << "Open groups in engine: " << engine_.groupsCount() << std::endl;
+        rollupClosedBuckets(*database);
     } catch (const std::exception& e) {
         std::cerr << "ERROR in Aggregator::run(): " << e.what() << std::endl;
         throw;  // Пробрасываем исключение выше для обработки в main
@@ -129,184 +312,272 @@ void Aggregator::run() {
     }
 }
 
-// Вспомогательная функция для округления времени до bucket
-static std::chrono::system_clock::time_point truncateToBucket(
-    std::chrono::system_clock::time_point tp,
-    std::chrono::minutes bucketSize
-) {
-    auto duration = tp.time_since_epoch();
-    auto minutes = std::chrono::duration_cast<std::chrono::minutes>(duration);
-    auto bucketMinutes = (minutes.count() / bucketSize.count()) * bucketSize.count();
-    return std::chrono::system_clock::time_point(std::chrono::minutes(bucketMinutes));
+// Сворачивает закрытые бакеты каждого уровня в следующий. Ошибка не валит цикл:
+// граница уровня не сдвинулась, и свёртка повторится в следующем цикле
+void Aggregator::rollupClosedBuckets(Database& database) {
+    auto rolledUp = database.getRollupWatermarks();
+
+    for (size_t i = 1; i < ROLLUP_LEVELS.size(); ++i) {
+        auto source = ROLLUP_LEVELS[i - 1];
+        auto target = ROLLUP_LEVELS[i];
+
+        // Базовый уровень готов до watermark, остальные — до своей границы свёртки
+        auto sourceReady = i == 1 ? watermark_ : rolledUp[source];
+        auto from = rolledUp[target];
+        auto to = alignDown(sourceReady, target);
+        if (to <= from) continue;
+
+        if (!database.rollup(source, target, from, to)) {
+            std::cerr << "Rollup " << source.count() << "s -> " << target.count()
+                      << "s failed, will retry on next cycle" << std::endl;
+            return;
+        }
+        rolledUp[target] = to;
+        std::cout << "Rolled up " << source.count() << "s buckets into "
+                  << target.count() << "s buckets" << std::endl;
+    }
+}
+
+void Aggregator::compactSymbols() {
+    if (symbols_.size() <= maxSymbols_) return;
+
+    std::vector<bool> live(symbols_.size(), false);
+    auto mark = [&live](const EventBatches& events) {
+        forEachSymbol(events, [&live](SymbolId id) { live[id] = true; });
+    };
+    auto remap = [](EventBatches& events, const std::vector<SymbolId>& mapping) {
+        forEachSymbol(events, [&mapping](SymbolId& id) { id = mapping[id]; });
+    };
+
+    engine_.markSymbols(live);
+    mark(late_);
+    mark(tooLate_);
+    if (pending_) mark(pending_->tooLate);
+
+    // Если почти всё ещё используется, словарь просто остаётся больше предела
+    auto before = symbols_.size();
+    auto mapping = symbols_.compact(live);
+    engine_.remapSymbols(mapping);
+    remap(late_, mapping);
+    remap(tooLate_, mapping);
+    if (pending_) remap(pending_->tooLate, mapping);
+
+    std::cout << "Symbol table compacted: " << before << " -> " << symbols_.size() << " strings" << std::endl;
 }
 
-// Ключ для группировки событий
-struct AggregationKey {
-    std::string projectId;
-    std::string page;
-    std::chrono::system_clock::time_point timeBucket;
-    std::string extra;  // element_id, error_type, event_name в зависимости от типа
+std::string Aggregator::formatMetrics() const {
+    std::ostringstream out;
+    auto metric = [&out](const char* name, const char* help, uint64_t value) {
+        out << "# HELP " << name << " " << help << "\n"
+            << "# TYPE " << name << " counter\n"
+            << name << " " << value << "\n";
+    };
+
+    metric("aggregation_late_events_total", "Late events merged into already written buckets",
+           lateEvents_.load(std::memory_order_relaxed));
+    metric("aggregation_too_late_events_total", "Events beyond allowed lateness saved to late_events",
+           tooLateEvents_.load(std::memory_order_relaxed));
+    return out.str();
+}
 
-    bool operator==(const AggregationKey& other) const {
-        return projectId == other.projectId &&
-               page == other.page &&
-               timeBucket == other.timeBucket &&
-               extra == other.extra;
-    }
-};
-
-struct AggregationKeyHash {
-    std::size_t operator()(const AggregationKey& k) const {
-        auto h1 = std::hash<std::string>{}(k.projectId);
-        auto h2 = std::hash<std::string>{}(k.page);
-        auto h3 = std::hash<int64_t>{}(k.timeBucket.time_since_epoch().count());
-        auto h4 = std::hash<std::string>{}(k.extra);
-        return h1 ^ (h2 << 1) ^ (h3 << 2) ^ (h4 << 3);
+// ===== EventAccumulator =====
+
+EventAccumulator::EventAccumulator(std::chrono::minutes bucketSize, const SymbolTable& symbols)
+    : bucketSize_(bucketSize), symbols_(&symbols) {
+}
+
+void EventAccumulator::MetricState::add(double value) {
+    if (value <= 0) return;
+    count++;
+    sum += value;
+    sketch.add(value);
+}
+
+void EventAccumulator::bucketize(const EventColumns& batch) {
+    buckets_.resize(batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        buckets_[i] = truncateToBucket(batch.timestamp[i], bucketSize_);
     }
-};
+    eventsCount_ += static_cast<int64_t>(batch.size());
+}
 
-AggregationResult Aggregator::aggregateEvents(
-    const std::vector<RawEvent>& events,
-    std::chrono::minutes bucketSize
-) {
-    AggregationResult result;
+template <typename State>
+State& EventAccumulator::group(GroupMap<State>& groups, const EventColumns& batch, size_t row, SymbolId extra) {
+    return groups[AggregationKey{batch.projectId[row], batch.page[row], buckets_[row], extra}];
+}
 
-    // Группировки для каждого типа
-    std::unordered_map<AggregationKey, std::vector<const RawEvent*>, AggregationKeyHash> pageViewGroups;
-    std::unordered_map<AggregationKey, std::vector<const RawEvent*>, AggregationKeyHash> clickGroups;
-    std::unordered_map<AggregationKey, std::vector<const RawEvent*>, AggregationKeyHash> perfGroups;
-    std::unordered_map<AggregationKey, std::vector<const RawEvent*>, AggregationKeyHash> errorGroups;
-    std::unordered_map<AggregationKey, std::vector<const RawEvent*>, AggregationKeyHash> customGroups;
+// Уникальные считаются по хешам строк из словаря; пустой номер — значения нет
+static void addUnique(HyperLogLog& sketch, const SymbolTable& symbols, SymbolId id) {
+    if (id != EMPTY_SYMBOL) sketch.addHash(symbols.hash(id));
+}
 
-    // Распределяем события по группам
-    for (const auto& event : events) {
-        auto bucket = truncateToBucket(event.timestamp, bucketSize);
+void EventAccumulator::add(const PageViewBatch& batch) {
+    bucketize(batch);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        auto& state = group(pageViews_, batch, i, EMPTY_SYMBOL);
+        state.count++;
+        addUnique(state.users, *symbols_, batch.userId[i]);
+        addUnique(state.sessions, *symbols_, batch.sessionId[i]);
+    }
+}
 
-        if (event.eventType == "page_view") {
-            AggregationKey key{event.projectId, event.page, bucket, ""};
-            pageViewGroups[key].push_back(&event);
-        }
-        else if (event.eventType == "click") {
-            AggregationKey key{event.projectId, event.page, bucket, event.elementId};
-            clickGroups[key].push_back(&event);
-        }
-        else if (event.eventType == "performance") {
-            AggregationKey key{event.projectId, event.page, bucket, ""};
-            perfGroups[key].push_back(&event);
-        }
-        else if (event.eventType == "error") {
-            AggregationKey key{event.projectId, event.page, bucket, event.errorType};
-            errorGroups[key].push_back(&event);
-        }
-        else if (event.eventType == "custom") {
-            AggregationKey key{event.projectId, event.page, bucket, event.customEventName};
-            customGroups[key].push_back(&event);
-        }
+void EventAccumulator::add(const ClickBatch& batch) {
+    bucketize(batch);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        auto& state = group(clicks_, batch, i, batch.elementId[i]);
+        state.count++;
+        addUnique(state.users, *symbols_, batch.userId[i]);
+        addUnique(state.sessions, *symbols_, batch.sessionId[i]);
     }
+}
 
-    // Агрегируем page_views
-    for (const auto& [key, evts] : pageViewGroups) {
-        std::unordered_set<std::string> users, sessions;
-        for (const auto* e : evts) {
-            if (!e->userId.empty()) users.insert(e->userId);
-            if (!e->sessionId.empty()) sessions.insert(e->sessionId);
+void EventAccumulator::add(const PerformanceBatch& batch) {
+    bucketize(batch);
+    // Сначала группы всех строк, затем каждая метрика отдельным проходом по своей колонке
+    performanceRows_.resize(batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        auto& state = group(performance_, batch, i, EMPTY_SYMBOL);
+        state.count++;
+        performanceRows_[i] = &state;
+    }
+
+    auto addMetric = [this](const std::vector<double>& values, MetricState PerformanceState::*metric) {
+        for (size_t i = 0; i < values.size(); ++i) {
+            (performanceRows_[i]->*metric).add(values[i]);
         }
+    };
+    addMetric(batch.totalPageLoadMs, &PerformanceState::totalLoad);
+    addMetric(batch.ttfbMs, &PerformanceState::ttfb);
+    addMetric(batch.fcpMs, &PerformanceState::fcp);
+    addMetric(batch.lcpMs, &PerformanceState::lcp);
+}
+
+void EventAccumulator::add(const ErrorBatch& batch) {
+    bucketize(batch);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        auto& state = group(errors_, batch, i, batch.errorType[i]);
+        state.count++;
+        addUnique(state.users, *symbols_, batch.userId[i]);
+        if (batch.severity[i] == 1) state.warningCount++;        // SEVERITY_WARNING
+        else if (batch.severity[i] == 3) state.criticalCount++;  // SEVERITY_CRITICAL
+    }
+}
+
+void EventAccumulator::add(const CustomBatch& batch) {
+    bucketize(batch);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        auto& state = group(customEvents_, batch, i, batch.eventName[i]);
+        state.count++;
+        addUnique(state.users, *symbols_, batch.userId[i]);
+        addUnique(state.sessions, *symbols_, batch.sessionId[i]);
+    }
+}
+
+void EventAccumulator::add(const EventBatches& batches) {
+    batches.forEach([this](const auto& batch) { add(batch); });
+}
+
+size_t EventAccumulator::groupsCount() const {
+    return pageViews_.size() + clicks_.size() + performance_.size() +
+           errors_.size() + customEvents_.size();
+}
 
+template <typename Filter>
+AggregationResult EventAccumulator::collect(Filter&& include) const {
+    AggregationResult result;
+
+    auto average = [](const MetricState& m) {
+        return m.count > 0 ? m.sum / static_cast<double>(m.count) : 0.0;
+    };
+
+    // Агрегируем page_views
+    for (const auto& [key, state] : pageViews_) {
+        if (!include(key)) continue;
         AggregatedPageViews agg;
-        agg.projectId = key.projectId;
-        agg.page = key.page;
+        agg.projectId = symbols_->str(key.projectId);
+        agg.page = symbols_->str(key.page);
         agg.timeBucket = key.timeBucket;
-        agg.viewsCount = static_cast<int64_t>(evts.size());
-        agg.uniqueUsers = static_cast<int64_t>(users.size());
-        agg.uniqueSessions = static_cast<int64_t>(sessions.size());
+        agg.stepSeconds = std::chrono::seconds(bucketSize_).count();
+        agg.viewsCount = state.count;
+        agg.uniqueUsers = state.users.estimate();
+        agg.uniqueSessions = state.sessions.estimate();
+        agg.usersHll = state.users.serialize();
+        agg.sessionsHll = state.sessions.serialize();
         result.pageViews.push_back(agg);
     }
 
     // Агрегируем clicks
-    for (const auto& [key, evts] : clickGroups) {
-        std::unordered_set<std::string> users, sessions;
-        for (const auto* e : evts) {
-            if (!e->userId.empty()) users.insert(e->userId);
-            if (!e->sessionId.empty()) sessions.insert(e->sessionId);
-        }
-
+    for (const auto& [key, state] : clicks_) {
+        if (!include(key)) continue;
         AggregatedClicks agg;
-        agg.projectId = key.projectId;
-        agg.page = key.page;
-        agg.elementId = key.extra;
+        agg.projectId = symbols_->str(key.projectId);
+        agg.page = symbols_->str(key.page);
+        agg.elementId = symbols_->str(key.extra);
         agg.timeBucket = key.timeBucket;
-        agg.clicksCount = static_cast<int64_t>(evts.size());
-        agg.uniqueUsers = static_cast<int64_t>(users.size());
-        agg.uniqueSessions = static_cast<int64_t>(sessions.size());
+        agg.stepSeconds = std::chrono::seconds(bucketSize_).count();
+        agg.clicksCount = state.count;
+        agg.uniqueUsers = state.users.estimate();
+        agg.uniqueSessions = state.sessions.estimate();
+        agg.usersHll = state.users.serialize();
+        agg.sessionsHll = state.sessions.serialize();
         result.clicks.push_back(agg);
     }
 
     // Агрегируем performance
-    for (const auto& [key, evts] : perfGroups) {
-        std::vector<double> totalLoads, ttfbs, fcps, lcps;
-
-        for (const auto* e : evts) {
-            if (e->totalPageLoadMs > 0) totalLoads.push_back(e->totalPageLoadMs);
-            if (e->ttfbMs > 0) ttfbs.push_back(e->ttfbMs);
-            if (e->fcpMs > 0) fcps.push_back(e->fcpMs);
-            if (e->lcpMs > 0) lcps.push_back(e->lcpMs);
-        }
-
+    for (const auto& [key, state] : performance_) {
+        if (!include(key)) continue;
         AggregatedPerformance agg;
-        agg.projectId = key.projectId;
-        agg.page = key.page;
+        agg.projectId = symbols_->str(key.projectId);
+        agg.page = symbols_->str(key.page);
         agg.timeBucket = key.timeBucket;
-        agg.samplesCount = static_cast<int64_t>(evts.size());
-        agg.avgTotalLoadMs = calculateAverage(totalLoads);
-        agg.p95TotalLoadMs = calculateP95(totalLoads);
-        agg.avgTtfbMs = calculateAverage(ttfbs);
-        agg.p95TtfbMs = calculateP95(ttfbs);
-        agg.avgFcpMs = calculateAverage(fcps);
-        agg.p95FcpMs = calculateP95(fcps);
-        agg.avgLcpMs = calculateAverage(lcps);
-        agg.p95LcpMs = calculateP95(lcps);
+        agg.stepSeconds = std::chrono::seconds(bucketSize_).count();
+        agg.samplesCount = state.count;
+        agg.avgTotalLoadMs = average(state.totalLoad);
+        agg.p95TotalLoadMs = state.totalLoad.sketch.quantile(0.95);
+        agg.totalLoadSketch = state.totalLoad.sketch.serialize();
+        agg.avgTtfbMs = average(state.ttfb);
+        agg.p95TtfbMs = state.ttfb.sketch.quantile(0.95);
+        agg.ttfbSketch = state.ttfb.sketch.serialize();
+        agg.avgFcpMs = average(state.fcp);
+        agg.p95FcpMs = state.fcp.sketch.quantile(0.95);
+        agg.fcpSketch = state.fcp.sketch.serialize();
+        agg.avgLcpMs = average(state.lcp);
+        agg.p95LcpMs = state.lcp.sketch.quantile(0.95);
+        agg.lcpSketch = state.lcp.sketch.serialize();
         result.performance.push_back(agg);
     }
 
     // Агрегируем errors
-    for (const auto& [key, evts] : errorGroups) {
-        std::unordered_set<std::string> users;
-        int64_t warningCount = 0, criticalCount = 0;
-
-        for (const auto* e : evts) {
-            if (!e->userId.empty()) users.insert(e->userId);
-            if (e->severity == 1) warningCount++;        // SEVERITY_WARNING
-            else if (e->severity == 3) criticalCount++;  // SEVERITY_CRITICAL
-        }
-
+    for (const auto& [key, state] : errors_) {
+        if (!include(key)) continue;
         AggregatedErrors agg;
-        agg.projectId = key.projectId;
-        agg.page = key.page;
-        agg.errorType = key.extra;
+        agg.projectId = symbols_->str(key.projectId);
+        agg.page = symbols_->str(key.page);
+        agg.errorType = symbols_->str(key.extra);
         agg.timeBucket = key.timeBucket;
-        agg.errorsCount = static_cast<int64_t>(evts.size());
-        agg.warningCount = warningCount;
-        agg.criticalCount = criticalCount;
-        agg.uniqueUsers = static_cast<int64_t>(users.size());
+        agg.stepSeconds = std::chrono::seconds(bucketSize_).count();
+        agg.errorsCount = state.count;
+        agg.warningCount = state.warningCount;
+        agg.criticalCount = state.criticalCount;
+        agg.uniqueUsers = state.users.estimate();
+        agg.usersHll = state.users.serialize();
         result.errors.push_back(agg);
     }
 
     // Агрегируем custom events
-    for (const auto& [key, evts] : customGroups) {
-        std::unordered_set<std::string> users, sessions;
-        for (const auto* e : evts) {
-            if (!e->userId.empty()) users.insert(e->userId);
-            if (!e->sessionId.empty()) sessions.insert(e->sessionId);
-        }
-
+    for (const auto& [key, state] : customEvents_) {
+        if (!include(key)) continue;
         AggregatedCustomEvents agg;
-        agg.projectId = key.projectId;
-        agg.page = key.page;
-        agg.eventName = key.extra;
+        agg.projectId = symbols_->str(key.projectId);
+        agg.page = symbols_->str(key.page);
+        agg.eventName = symbols_->str(key.extra);
         agg.timeBucket = key.timeBucket;
-        agg.eventsCount = static_cast<int64_t>(evts.size());
-        agg.uniqueUsers = static_cast<int64_t>(users.size());
-        agg.uniqueSessions = static_cast<int64_t>(sessions.size());
+        agg.stepSeconds = std::chrono::seconds(bucketSize_).count();
+        agg.eventsCount = state.count;
+        agg.uniqueUsers = state.users.estimate();
+        agg.uniqueSessions = state.sessions.estimate();
+        agg.usersHll = state.users.serialize();
+        agg.sessionsHll = state.sessions.serialize();
         result.customEvents.push_back(agg);
     }
 
@@ -320,40 +591,109 @@ AggregationResult Aggregator::aggregateEvents(
     return result;
 }
 
-double Aggregator::calculateAverage(const std::vector<double>& values) {
-    if (values.empty()) return 0.0;
-    double sum = 0.0;
-    for (const auto& val : values) {
-        sum += val;
-    }
-    return sum / static_cast<double>(values.size());
+AggregationResult EventAccumulator::finish() const {
+    return collect([](const AggregationKey&) { return true; });
+}
+
+AggregationResult EventAccumulator::finalizeBefore(std::chrono::system_clock::time_point watermark) {
+    auto closed = [this, watermark](const AggregationKey& key) {
+        return key.timeBucket + bucketSize_ <= watermark;
+    };
+
+    AggregationResult result = collect(closed);
+
+    auto dropClosed = [&closed](auto& groups) {
+        std::erase_if(groups, [&closed](const auto& entry) { return closed(entry.first); });
+    };
+    dropClosed(pageViews_);
+    dropClosed(clicks_);
+    dropClosed(performance_);
+    dropClosed(errors_);
+    dropClosed(customEvents_);
+
+    return result;
 }
 
-double Aggregator::calculateMin(const std::vector<double>& values) {
-    if (values.empty()) return 0.0;
-    double minVal = values[0];
-    for (const auto& val : values) {
-        if (val < minVal) minVal = val;
+void EventAccumulator::clear() {
+    eventsCount_ = 0;
+    pageViews_.clear();
+    clicks_.clear();
+    performance_.clear();
+    errors_.clear();
+    customEvents_.clear();
+}
+
+void EventAccumulator::markSymbols(std::vector<bool>& live) const {
+    auto mark = [&live](const auto& groups) {
+        for (const auto& [key, state] : groups) {
+            live[key.projectId] = true;
+            live[key.page] = true;
+            live[key.extra] = true;
+        }
+    };
+    mark(pageViews_);
+    mark(clicks_);
+    mark(performance_);
+    mark(errors_);
+    mark(customEvents_);
+}
+
+void EventAccumulator::remapSymbols(const std::vector<SymbolId>& mapping) {
+    auto remap = [&mapping](auto& groups) {
+        std::remove_reference_t<decltype(groups)> remapped;
+        remapped.reserve(groups.size());
+        for (auto& [key, state] : groups) {
+            AggregationKey moved{mapping[key.projectId], mapping[key.page], key.timeBucket, mapping[key.extra]};
+            remapped.emplace(moved, std::move(state));
+        }
+        groups = std::move(remapped);
+    };
+    remap(pageViews_);
+    remap(clicks_);
+    remap(performance_);
+    remap(errors_);
+    remap(customEvents_);
+}
+
+// ===== LateCorrections =====
+
+LateCorrections::LateCorrections(const SymbolTable& symbols) {
+    levels_.reserve(ROLLUP_LEVELS.size());
+    for (auto step : ROLLUP_LEVELS) {
+        levels_.emplace_back(std::chrono::duration_cast<std::chrono::minutes>(step), symbols);
     }
-    return minVal;
 }
 
-double Aggregator::calculateMax(const std::vector<double>& values) {
-    if (values.empty()) return 0.0;
-    double maxVal = values[0];
-    for (const auto& val : values) {
-        if (val > maxVal) maxVal = val;
+void LateCorrections::add(const EventBatches& events) {
+    for (auto& level : levels_) {
+        level.add(events);
     }
-    return maxVal;
 }
 
-double Aggregator::calculateP95(std::vector<double> values) {
-    if (values.empty()) return 0.0;
+AggregationResult LateCorrections::take(const RollupWatermarks& rolledUp) {
+    AggregationResult result = levels_.front().finish();
+    for (size_t i = 1; i < levels_.size(); ++i) {
+        auto until = rolledUp.find(ROLLUP_LEVELS[i]);
+        if (until != rolledUp.end()) {
+            appendResult(result, levels_[i].finalizeBefore(until->second));
+        }
+    }
 
-    std::sort(values.begin(), values.end());
+    for (auto& level : levels_) {
+        level.clear();
+    }
+    return result;
+}
 
-    size_t index = static_cast<size_t>(0.95 * static_cast<double>(values.size() - 1));
-    return values[index];
+// ===== Aggregator =====
+
+AggregationResult Aggregator::aggregateEvents(
+    const EventBatches& events,
+    std::chrono::minutes bucketSize
+) {
+    EventAccumulator accumulator(bucketSize, symbols_);
+    accumulator.add(events);
+    return accumulator.finish();
 }
 
 } // namespace aggregation
@@ -0,0 +1,86 @@
+#include "copy_encoder.h"
+#include "pg_binary.h"
+
+#include <bit>
+
+namespace aggregation {
+
+namespace {
+
+// 11 байт сигнатуры вместе с завершающим '\0'
+constexpr char COPY_SIGNATURE[] = "PGCOPY\n\377\r\n";
+
+} // namespace
+
+BinaryCopyEncoder::BinaryCopyEncoder() {
+    buffer_.append(COPY_SIGNATURE, sizeof(COPY_SIGNATURE));
+    putInt32(0);  // флаги
+    putInt32(0);  // длина расширения заголовка
+}
+
+void BinaryCopyEncoder::putInt16(int16_t value) {
+    auto v = static_cast<uint16_t>(value);
+    buffer_ += static_cast<char>(v >> 8);
+    buffer_ += static_cast<char>(v & 0xff);
+}
+
+void BinaryCopyEncoder::putInt32(int32_t value) {
+    auto v = static_cast<uint32_t>(value);
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        buffer_ += static_cast<char>((v >> shift) & 0xff);
+    }
+}
+
+void BinaryCopyEncoder::putInt64(int64_t value) {
+    auto v = static_cast<uint64_t>(value);
+    for (int shift = 56; shift >= 0; shift -= 8) {
+        buffer_ += static_cast<char>((v >> shift) & 0xff);
+    }
+}
+
+void BinaryCopyEncoder::beginRow(int16_t fieldCount) {
+    putInt16(fieldCount);
+}
+
+void BinaryCopyEncoder::addInt4(int32_t value) {
+    putInt32(sizeof(int32_t));
+    putInt32(value);
+}
+
+void BinaryCopyEncoder::addInt8(int64_t value) {
+    putInt32(sizeof(int64_t));
+    putInt64(value);
+}
+
+void BinaryCopyEncoder::addFloat8(double value) {
+    putInt32(sizeof(double));
+    putInt64(std::bit_cast<int64_t>(value));
+}
+
+void BinaryCopyEncoder::addText(std::string_view value) {
+    putInt32(static_cast<int32_t>(value.size()));
+    buffer_.append(value);
+}
+
+void BinaryCopyEncoder::addBytea(std::string_view value) {
+    if (value.empty()) {
+        addNull();
+        return;
+    }
+    addText(value);
+}
+
+void BinaryCopyEncoder::addTimestamp(std::chrono::system_clock::time_point value) {
+    auto sinceEpoch = std::chrono::duration_cast<std::chrono::microseconds>(value.time_since_epoch());
+    addInt8((sinceEpoch - POSTGRES_EPOCH).count());
+}
+
+void BinaryCopyEncoder::addNull() {
+    putInt32(-1);
+}
+
+void BinaryCopyEncoder::finish() {
+    putInt16(-1);
+}
+
+} // namespace aggregation
@@ -1,10 +1,18 @@
 #include "database.h"
 #include "aggregator.h"
+#include "copy_encoder.h"
+#include "hyperloglog.h"
+#include "pg_binary.h"
 
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <ctime>
+#include <array>
+#include <algorithm>
+#include <set>
+#include <stdexcept>
+#include <unordered_map>
 
 namespace aggregation {
 
@@ -40,12 +48,41 @@ void Database::disconnect() {
         PQfinish(dbConnection_);
         dbConnection_ = nullptr;
     }
+    stagingReady_ = false;
+    prepared_.clear();
 }
 
 bool Database::isConnected() const {
     return dbConnection_ != nullptr && PQstatus(dbConnection_) == CONNECTION_OK;
 }
 
+Database::QueryStats Database::queryStats() const {
+    QueryStats stats;
+    stats.queries = queries_.load(std::memory_order_relaxed);
+    stats.failures = failures_.load(std::memory_order_relaxed);
+    stats.totalTime = std::chrono::microseconds(queryMicros_.load(std::memory_order_relaxed));
+    return stats;
+}
+
+PGresult* Database::exec(const std::string& sql) {
+    auto start = std::chrono::steady_clock::now();
+    PGresult* res = PQexec(dbConnection_, sql.c_str());
+    trackQuery(start, res);
+    return res;
+}
+
+void Database::trackQuery(std::chrono::steady_clock::time_point start, const PGresult* res) {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    queries_.fetch_add(1, std::memory_order_relaxed);
+    queryMicros_.fetch_add(elapsed.count(), std::memory_order_relaxed);
+
+    ExecStatusType status = res ? PQresultStatus(res) : PGRES_FATAL_ERROR;
+    if (status == PGRES_FATAL_ERROR || status == PGRES_BAD_RESPONSE) {
+        failures_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
 bool Database::initializeSchema() {
     if (!isConnected()) {
         std::cerr << "Cannot initialize schema: no active database connection" << std::endl;
@@ -58,9 +95,10 @@ bool Database::initializeSchema() {
         "SELECT COUNT(*) FROM information_schema.tables "
         "WHERE table_schema = 'public' AND table_name IN ("
         "'agg_page_views', 'agg_clicks', 'agg_performance', "
-        "'agg_errors', 'agg_custom_events', 'aggregation_watermark')";
+        "'agg_errors', 'agg_custom_events', 'aggregation_watermark', "
+        "'aggregation_rollup_watermark', 'aggregation_commit_log', 'late_events')";
 
-    PGresult* res = PQexec(dbConnection_, checkQuery);
+    PGresult* res = exec(checkQuery);
 
     if (res == nullptr || PQresultStatus(res) != PGRES_TUPLES_OK) {
         std::cerr << "Failed to check database schema: " << PQerrorMessage(dbConnection_) << std::endl;
@@ -74,13 +112,13 @@ bool Database::initializeSchema() {
     }
     PQclear(res);
 
-    if (tableCount != 6) {
-        std::cerr << "Database schema incomplete: found " << tableCount << " tables, expected 6" << std::endl;
+    if (tableCount != 9) {
+        std::cerr << "Database schema incomplete: found " << tableCount << " tables, expected 9" << std::endl;
         std::cerr << "Make sure PostgreSQL initialized with init.sql (via docker-entrypoint-initdb.d)" << std::endl;
         return false;
     }
 
-    std::cout << "Database schema verified successfully (6 tables found)" << std::endl;
+    std::cout << "Database schema verified successfully (9 tables found)" << std::endl;
     return true;
 }
 
@@ -90,7 +128,7 @@ bool Database::executeQuery(const std::string& query) {
         return false;
     }
 
-    PGresult* res = PQexec(dbConnection_, query.c_str());
+    PGresult* res = exec(query);
 
     if (res == nullptr) {
         std::cerr << "Failed to execute query: null result" << std::endl;
@@ -108,6 +146,24 @@ bool Database::executeQuery(const std::string& query) {
     return true;
 }
 
+int Database::executeUpdate(const std::string& query) {
+    if (!isConnected()) {
+        std::cerr << "Cannot execute query: no active database connection" << std::endl;
+        return -1;
+    }
+
+    PGresult* res = exec(query);
+    if (PQresultStatus(res) != PGRES_COMMAND_OK) {
+        std::cerr << "Query execution failed: " << PQerrorMessage(dbConnection_) << std::endl;
+        PQclear(res);
+        return -1;
+    }
+
+    int affected = std::atoi(PQcmdTuples(res));
+    PQclear(res);
+    return affected;
+}
+
 std::string Database::formatTimestamp(std::chrono::system_clock::time_point tp) const {
     auto time_t_val = std::chrono::system_clock::to_time_t(tp);
     std::tm tm_val{};
@@ -131,15 +187,66 @@ std::chrono::system_clock::time_point Database::parseTimestamp(const std::string
     return std::chrono::system_clock::from_time_t(time_t_val);
 }
 
-std::string Database::escapeString(const std::string& str) const {
-    if (!dbConnection_) return str;
+// SET-часть upsert для пары unique_*/ *_hll. Скетч пришедшей строки уже объединён
+// с записанным (mergeStoredUniques), поэтому при конфликте он просто заменяет старый
+static std::string mergeUniques(const std::string& countColumn, const std::string& sketchColumn) {
+    return countColumn + " = EXCLUDED." + countColumn + ", " + sketchColumn + " = EXCLUDED." + sketchColumn;
+}
 
-    char* escaped = PQescapeLiteral(dbConnection_, str.c_str(), str.length());
-    if (!escaped) return "''";
+// SET-часть upsert для метрики agg_performance: скетчи складываются,
+// p95 считается по объединению, среднее взвешивается числом значений
+static std::string mergeQuantiles(const std::string& metric) {
+    const std::string avg = "avg_" + metric + "_ms";
+    const std::string p95 = "p95_" + metric + "_ms";
+    const std::string sketch = metric + "_sketch";
+    const std::string oldCount = "COALESCE(ddsketch_count(agg_performance." + sketch + "), 0)";
+    const std::string newCount = "COALESCE(ddsketch_count(EXCLUDED." + sketch + "), 0)";
+    const std::string merged = "ddsketch_merge(agg_performance." + sketch + ", EXCLUDED." + sketch + ")";
+
+    return avg + " = COALESCE((COALESCE(agg_performance." + avg + ", 0) * " + oldCount +
+           " + EXCLUDED." + avg + " * " + newCount + ") / NULLIF(" + oldCount + " + " + newCount +
+           ", 0), EXCLUDED." + avg + "), " +
+           p95 + " = COALESCE(ddsketch_quantile(" + merged + ", 0.95), EXCLUDED." + p95 + "), " +
+           sketch + " = " + merged;
+}
 
-    std::string result(escaped);
-    PQfreemem(escaped);
-    return result;
+// ON CONFLICT-части общие для записи агрегатов и свёртки уровней
+static std::string pageViewsUpsert() {
+    return " ON CONFLICT (step_seconds, time_bucket, project_id, page) DO UPDATE SET "
+           "views_count = agg_page_views.views_count + EXCLUDED.views_count, " +
+           mergeUniques("unique_users", "users_hll") + ", " +
+           mergeUniques("unique_sessions", "sessions_hll");
+}
+
+static std::string clicksUpsert() {
+    return " ON CONFLICT (step_seconds, time_bucket, project_id, page, element_id) DO UPDATE SET "
+           "clicks_count = agg_clicks.clicks_count + EXCLUDED.clicks_count, " +
+           mergeUniques("unique_users", "users_hll") + ", " +
+           mergeUniques("unique_sessions", "sessions_hll");
+}
+
+static std::string performanceUpsert() {
+    return " ON CONFLICT (step_seconds, time_bucket, project_id, page) DO UPDATE SET "
+           "samples_count = agg_performance.samples_count + EXCLUDED.samples_count, " +
+           mergeQuantiles("total_load") + ", " +
+           mergeQuantiles("ttfb") + ", " +
+           mergeQuantiles("fcp") + ", " +
+           mergeQuantiles("lcp");
+}
+
+static std::string errorsUpsert() {
+    return " ON CONFLICT (step_seconds, time_bucket, project_id, page, error_type) DO UPDATE SET "
+           "errors_count = agg_errors.errors_count + EXCLUDED.errors_count, "
+           "warning_count = agg_errors.warning_count + EXCLUDED.warning_count, "
+           "critical_count = agg_errors.critical_count + EXCLUDED.critical_count, " +
+           mergeUniques("unique_users", "users_hll");
+}
+
+static std::string customEventsUpsert() {
+    return " ON CONFLICT (step_seconds, time_bucket, project_id, event_name, page) DO UPDATE SET "
+           "events_count = agg_custom_events.events_count + EXCLUDED.events_count, " +
+           mergeUniques("unique_users", "users_hll") + ", " +
+           mergeUniques("unique_sessions", "sessions_hll");
 }
 
 std::chrono::system_clock::time_point Database::getWatermark() {
@@ -149,7 +256,7 @@ std::chrono::system_clock::time_point Database::getWatermark() {
     }
 
     const char* sql = "SELECT last_aggregated_at FROM aggregation_watermark WHERE id = 1";
-    PGresult* res = PQexec(dbConnection_, sql);
+    PGresult* res = exec(sql);
 
     if (PQresultStatus(res) != PGRES_TUPLES_OK || PQntuples(res) == 0) {
         std::cerr << "Failed to get watermark: " << PQerrorMessage(dbConnection_) << std::endl;
@@ -176,189 +283,906 @@ bool Database::updateWatermark(std::chrono::system_clock::time_point timestamp)
     return executeQuery(sql.str());
 }
 
-bool Database::writePageViews(const std::vector<AggregatedPageViews>& data) {
+// ===== Запись агрегатов =====
+
+namespace {
+
+// Колонки agg-таблиц в порядке полей COPY; staging-таблицы повторяют их типы
+const std::string PAGE_VIEWS_COLUMNS =
+    "step_seconds, time_bucket, project_id, page, views_count, "
+    "unique_users, unique_sessions, users_hll, sessions_hll";
+const std::string CLICKS_COLUMNS =
+    "step_seconds, time_bucket, project_id, page, element_id, clicks_count, "
+    "unique_users, unique_sessions, users_hll, sessions_hll";
+const std::string PERFORMANCE_COLUMNS =
+    "step_seconds, time_bucket, project_id, page, samples_count, "
+    "avg_total_load_ms, p95_total_load_ms, avg_ttfb_ms, p95_ttfb_ms, "
+    "avg_fcp_ms, p95_fcp_ms, avg_lcp_ms, p95_lcp_ms, "
+    "total_load_sketch, ttfb_sketch, fcp_sketch, lcp_sketch";
+const std::string ERRORS_COLUMNS =
+    "step_seconds, time_bucket, project_id, page, error_type, "
+    "errors_count, warning_count, critical_count, unique_users, users_hll";
+const std::string CUSTOM_EVENTS_COLUMNS =
+    "step_seconds, time_bucket, project_id, event_name, page, "
+    "events_count, unique_users, unique_sessions, users_hll, sessions_hll";
+const std::string LATE_EVENTS_COLUMNS =
+    "event_type, project_id, page, detail, user_id, session_id, severity, "
+    "total_page_load_ms, ttfb_ms, fcp_ms, lcp_ms, event_time, received_at";
+
+// Размер куска, отправляемого одним PQputCopyData
+constexpr size_t COPY_CHUNK_BYTES = 1 << 20;
+
+std::string stagingTable(const std::string& table) {
+    return "stage_" + table;
+}
+
+std::string mergeFromStaging(const std::string& table, const std::string& columns, const std::string& upsert) {
+    return "INSERT INTO " + table + " (" + columns + ") SELECT " + columns +
+           " FROM " + stagingTable(table) + upsert;
+}
+
+// Строка результата в бинарном формате; NULL читается как 0 или пустая строка
+class BinaryRow {
+public:
+    BinaryRow(const PGresult* res, int row) : res_(res), row_(row) {}
+
+    bool isNull(int col) const { return PQgetisnull(res_, row_, col) != 0; }
+
+    int64_t int8(int col) const { return isNull(col) ? 0 : readInt8(PQgetvalue(res_, row_, col)); }
+    int32_t int4(int col) const { return isNull(col) ? 0 : readInt4(PQgetvalue(res_, row_, col)); }
+    double float8(int col) const { return isNull(col) ? 0.0 : readFloat8(PQgetvalue(res_, row_, col)); }
+
+    std::chrono::system_clock::time_point timestamp(int col) const {
+        return isNull(col) ? std::chrono::system_clock::time_point{} : readTimestamp(PQgetvalue(res_, row_, col));
+    }
+
+    // text и bytea в бинарном формате — сами байты значения
+    std::string bytes(int col) const {
+        return std::string(PQgetvalue(res_, row_, col), static_cast<size_t>(PQgetlength(res_, row_, col)));
+    }
+
+private:
+    const PGresult* res_;
+    int row_;
+};
+
+// Таблицы с HLL-скетчами: скетчи сливаются здесь, а не функциями в БД.
+// KEY_COLUMNS идут в том порядке, в котором их склеивает key()
+template <typename Row> struct UniquesTable;
+
+template <> struct UniquesTable<AggregatedPageViews> {
+    static constexpr const char* TABLE = "agg_page_views";
+    static constexpr const char* KEY_COLUMNS = "project_id, page";
+    static constexpr int KEY_COUNT = 2;
+    static constexpr const char* COUNTER_COLUMNS = "views_count";
+    static constexpr bool SESSIONS = true;
+
+    static std::string key(const AggregatedPageViews& r) { return r.projectId + '\0' + r.page; }
+    static void readKey(AggregatedPageViews& r, const BinaryRow& row, int col) {
+        r.projectId = row.bytes(col);
+        r.page = row.bytes(col + 1);
+    }
+    static void addCounters(AggregatedPageViews& r, const BinaryRow& row, int col) {
+        r.viewsCount += row.int8(col);
+    }
+};
+
+template <> struct UniquesTable<AggregatedClicks> {
+    static constexpr const char* TABLE = "agg_clicks";
+    static constexpr const char* KEY_COLUMNS = "project_id, page, element_id";
+    static constexpr int KEY_COUNT = 3;
+    static constexpr const char* COUNTER_COLUMNS = "clicks_count";
+    static constexpr bool SESSIONS = true;
+
+    static std::string key(const AggregatedClicks& r) {
+        return r.projectId + '\0' + r.page + '\0' + r.elementId;
+    }
+    static void readKey(AggregatedClicks& r, const BinaryRow& row, int col) {
+        r.projectId = row.bytes(col);
+        r.page = row.bytes(col + 1);
+        r.elementId = row.bytes(col + 2);
+    }
+    static void addCounters(AggregatedClicks& r, const BinaryRow& row, int col) {
+        r.clicksCount += row.int8(col);
+    }
+};
+
+template <> struct UniquesTable<AggregatedErrors> {
+    static constexpr const char* TABLE = "agg_errors";
+    static constexpr const char* KEY_COLUMNS = "project_id, page, error_type";
+    static constexpr int KEY_COUNT = 3;
+    static constexpr const char* COUNTER_COLUMNS = "errors_count, warning_count, critical_count";
+    static constexpr bool SESSIONS = false;
+
+    static std::string key(const AggregatedErrors& r) {
+        return r.projectId + '\0' + r.page + '\0' + r.errorType;
+    }
+    static void readKey(AggregatedErrors& r, const BinaryRow& row, int col) {
+        r.projectId = row.bytes(col);
+        r.page = row.bytes(col + 1);
+        r.errorType = row.bytes(col + 2);
+    }
+    static void addCounters(AggregatedErrors& r, const BinaryRow& row, int col) {
+        r.errorsCount += row.int8(col);
+        r.warningCount += row.int8(col + 1);
+        r.criticalCount += row.int8(col + 2);
+    }
+};
+
+template <> struct UniquesTable<AggregatedCustomEvents> {
+    static constexpr const char* TABLE = "agg_custom_events";
+    static constexpr const char* KEY_COLUMNS = "project_id, event_name, page";
+    static constexpr int KEY_COUNT = 3;
+    static constexpr const char* COUNTER_COLUMNS = "events_count";
+    static constexpr bool SESSIONS = true;
+
+    static std::string key(const AggregatedCustomEvents& r) {
+        return r.projectId + '\0' + r.eventName + '\0' + r.page;
+    }
+    static void readKey(AggregatedCustomEvents& r, const BinaryRow& row, int col) {
+        r.projectId = row.bytes(col);
+        r.eventName = row.bytes(col + 1);
+        r.page = row.bytes(col + 2);
+    }
+    static void addCounters(AggregatedCustomEvents& r, const BinaryRow& row, int col) {
+        r.eventsCount += row.int8(col);
+    }
+};
+
+// Полный ключ строки: шаг, бакет и строковые колонки
+std::string rowKey(int64_t step, std::chrono::system_clock::time_point bucket, const std::string& key) {
+    const auto micros = std::chrono::duration_cast<std::chrono::microseconds>(bucket.time_since_epoch()).count();
+    return std::to_string(step) + ':' + std::to_string(micros) + ':' + key;
+}
+
+std::string rowKey(const BinaryRow& row, int stepCol, int bucketCol, int keyCol, int keyCount) {
+    std::string key = row.bytes(keyCol);
+    for (int i = 1; i < keyCount; ++i) key += '\0' + row.bytes(keyCol + i);
+    return rowKey(row.int4(stepCol), row.timestamp(bucketCol), key);
+}
+
+// Объединяет скетч строки со скетчем stored и пересчитывает по объединению
+// число уникальных. Без скетчей остаётся пришедшее значение
+void mergeSketch(int64_t& count, std::string& sketch, const std::string& stored) {
+    if (stored.empty()) return;
+    HyperLogLog merged = HyperLogLog::deserialize(stored);
+    if (!sketch.empty()) merged.merge(HyperLogLog::deserialize(sketch));
+    count = merged.estimate();
+    sketch = merged.serialize();
+}
+
+// Накопитель уникальных одной строки свёртки; строки без скетча дают максимум своих счётчиков
+struct SketchUnion {
+    HyperLogLog sketch;
+    bool hasSketch = false;
+    int64_t maxCount = 0;
+
+    void add(int64_t count, const std::string& bytes) {
+        maxCount = std::max(maxCount, count);
+        if (bytes.empty()) return;
+        sketch.merge(HyperLogLog::deserialize(bytes));
+        hasSketch = true;
+    }
+
+    void finish(int64_t& count, std::string& bytes) const {
+        count = hasSketch ? sketch.estimate() : maxCount;
+        bytes = hasSketch ? sketch.serialize() : std::string();
+    }
+};
+
+} // namespace
+
+template <typename Row>
+bool Database::mergeStoredUniques(const std::vector<Row>& rows, std::vector<Row>& merged) {
+    using Table = UniquesTable<Row>;
+
+    // Записанные строки ищутся по бакетам: их мало, а индекс (step_seconds, time_bucket) есть
+    std::set<std::pair<int64_t, int64_t>> buckets;
+    for (const auto& row : rows) {
+        buckets.emplace(row.stepSeconds, std::chrono::duration_cast<std::chrono::microseconds>(
+            row.timeBucket.time_since_epoch()).count());
+    }
+    std::string steps = "{", bucketsUs = "{";
+    for (const auto& [step, bucket] : buckets) {
+        const char* sep = steps.size() > 1 ? "," : "";
+        steps += sep + std::to_string(step);
+        bucketsUs += sep + std::to_string(bucket);
+    }
+
+    PGresult* res = execPrepared(std::string("stored_uniques_") + Table::TABLE, [] {
+        return std::string("SELECT step_seconds, time_bucket, ") + Table::KEY_COLUMNS + ", users_hll, " +
+               (Table::SESSIONS ? "sessions_hll" : "NULL::BYTEA") + " FROM " + Table::TABLE +
+               " WHERE (step_seconds, time_bucket) IN ("
+               "SELECT step, TIMESTAMPTZ 'epoch' + bucket_us * INTERVAL '1 microsecond' "
+               "FROM unnest($1::INTEGER[], $2::BIGINT[]) AS b(step, bucket_us)) "
+               "FOR UPDATE";
+    }, {steps + "}", bucketsUs + "}"});
+    if (PQresultStatus(res) != PGRES_TUPLES_OK) {
+        std::cerr << "Reading stored sketches of " << Table::TABLE << " failed: "
+                  << PQerrorMessage(dbConnection_) << std::endl;
+        PQclear(res);
+        return false;
+    }
+
+    const int stored = PQntuples(res);
+    if (stored > 0) {
+        std::unordered_map<std::string, int> byKey;
+        byKey.reserve(static_cast<size_t>(stored));
+        for (int i = 0; i < stored; ++i) {
+            byKey.emplace(rowKey(BinaryRow(res, i), 0, 1, 2, Table::KEY_COUNT), i);
+        }
+
+        try {
+            for (size_t i = 0; i < rows.size(); ++i) {
+                auto found = byKey.find(rowKey(rows[i].stepSeconds, rows[i].timeBucket, Table::key(rows[i])));
+                if (found == byKey.end()) continue;
+                if (merged.empty()) merged = rows;
+
+                BinaryRow row(res, found->second);
+                mergeSketch(merged[i].uniqueUsers, merged[i].usersHll, row.bytes(2 + Table::KEY_COUNT));
+                if constexpr (Table::SESSIONS) {
+                    mergeSketch(merged[i].uniqueSessions, merged[i].sessionsHll, row.bytes(3 + Table::KEY_COUNT));
+                }
+            }
+        } catch (const std::invalid_argument& e) {
+            std::cerr << "Stored sketch in " << Table::TABLE << " is malformed: " << e.what() << std::endl;
+            PQclear(res);
+            return false;
+        }
+    }
+
+    PQclear(res);
+    return true;
+}
+
+template <typename Row>
+bool Database::collectRollup(
+    std::chrono::seconds source,
+    std::chrono::seconds target,
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    std::vector<Row>& rows
+) {
+    using Table = UniquesTable<Row>;
+    auto micros = [](std::chrono::system_clock::time_point tp) {
+        return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(tp.time_since_epoch()).count());
+    };
+
+    PGresult* res = execPrepared(std::string("rollup_source_") + Table::TABLE, [] {
+        return std::string("SELECT date_bin($2::INTEGER * INTERVAL '1 second', time_bucket, TIMESTAMPTZ 'epoch'), ") +
+               Table::KEY_COLUMNS + ", " + Table::COUNTER_COLUMNS + ", unique_users, users_hll, " +
+               (Table::SESSIONS ? "unique_sessions, sessions_hll" : "0::BIGINT, NULL::BYTEA") +
+               " FROM " + Table::TABLE +
+               " WHERE step_seconds = $1"
+               " AND time_bucket >= TIMESTAMPTZ 'epoch' + $3::BIGINT * INTERVAL '1 microsecond'"
+               " AND time_bucket < TIMESTAMPTZ 'epoch' + $4::BIGINT * INTERVAL '1 microsecond'";
+    }, {std::to_string(source.count()), std::to_string(target.count()), micros(from), micros(to)});
+    if (PQresultStatus(res) != PGRES_TUPLES_OK) {
+        std::cerr << "Reading " << Table::TABLE << " for rollup failed: " << PQerrorMessage(dbConnection_) << std::endl;
+        PQclear(res);
+        return false;
+    }
+
+    // Столбцы: бакет уровня target, ключ, счётчики, затем unique/скетч пользователей и сессий
+    constexpr int keyCol = 1;
+    constexpr int counterCol = keyCol + Table::KEY_COUNT;
+    const int usersCol = PQnfields(res) - 4;
+
+    std::unordered_map<std::string, size_t> groups;
+    std::vector<std::pair<SketchUnion, SketchUnion>> uniques;
+    try {
+        for (int i = 0; i < PQntuples(res); ++i) {
+            BinaryRow row(res, i);
+            Row candidate;
+            candidate.stepSeconds = target.count();
+            candidate.timeBucket = row.timestamp(0);
+            Table::readKey(candidate, row, keyCol);
+
+            auto [it, inserted] = groups.try_emplace(
+                rowKey(candidate.stepSeconds, candidate.timeBucket, Table::key(candidate)), rows.size());
+            if (inserted) {
+                rows.push_back(std::move(candidate));
+                uniques.emplace_back();
+            }
+            Table::addCounters(rows[it->second], row, counterCol);
+            uniques[it->second].first.add(row.int8(usersCol), row.bytes(usersCol + 1));
+            uniques[it->second].second.add(row.int8(usersCol + 2), row.bytes(usersCol + 3));
+        }
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Sketch in " << Table::TABLE << " is malformed: " << e.what() << std::endl;
+        PQclear(res);
+        return false;
+    }
+    PQclear(res);
+
+    for (size_t i = 0; i < rows.size(); ++i) {
+        uniques[i].first.finish(rows[i].uniqueUsers, rows[i].usersHll);
+        if constexpr (Table::SESSIONS) {
+            uniques[i].second.finish(rows[i].uniqueSessions, rows[i].sessionsHll);
+        }
+    }
+    return true;
+}
+
+bool Database::inTransaction(const std::function<bool()>& body) {
+    if (PQtransactionStatus(dbConnection_) != PQTRANS_IDLE) {
+        return body();
+    }
+
+    if (!executeQuery("BEGIN")) return false;
+    if (!body()) {
+        executeQuery("ROLLBACK");
+        return false;
+    }
+    return executeQuery("COMMIT");
+}
+
+bool Database::ensureStagingTables() {
+    if (stagingReady_) return true;
+
+    const std::vector<std::pair<std::string, std::string>> tables = {
+        {"agg_page_views", PAGE_VIEWS_COLUMNS},
+        {"agg_clicks", CLICKS_COLUMNS},
+        {"agg_performance", PERFORMANCE_COLUMNS},
+        {"agg_errors", ERRORS_COLUMNS},
+        {"agg_custom_events", CUSTOM_EVENTS_COLUMNS},
+        {"late_events", LATE_EVENTS_COLUMNS},
+    };
+
+    // Строки staging живут до конца транзакции записи
+    for (const auto& [table, columns] : tables) {
+        if (!executeQuery("CREATE TEMP TABLE IF NOT EXISTS " + stagingTable(table) +
+                          " ON COMMIT DELETE ROWS AS SELECT " + columns +
+                          " FROM " + table + " WITH NO DATA")) {
+            return false;
+        }
+    }
+
+    stagingReady_ = true;
+    return true;
+}
+
+bool Database::copyToStaging(
+    const std::string& table,
+    const std::string& columns,
+    size_t rowCount,
+    const std::function<void(BinaryCopyEncoder&, size_t)>& encodeRow
+) {
+    const std::string sql = "COPY " + stagingTable(table) + " (" + columns + ") FROM STDIN (FORMAT binary)";
+    PGresult* res = exec(sql);
+    if (PQresultStatus(res) != PGRES_COPY_IN) {
+        std::cerr << "Failed to start COPY into " << stagingTable(table) << ": "
+                  << PQerrorMessage(dbConnection_) << std::endl;
+        PQclear(res);
+        return false;
+    }
+    PQclear(res);
+
+    BinaryCopyEncoder encoder;
+    bool sent = true;
+    for (size_t i = 0; i < rowCount && sent; ++i) {
+        encodeRow(encoder, i);
+        if (encoder.size() >= COPY_CHUNK_BYTES) {
+            sent = PQputCopyData(dbConnection_, encoder.data().data(), static_cast<int>(encoder.size())) == 1;
+            encoder.clear();
+        }
+    }
+    if (sent) {
+        encoder.finish();
+        sent = PQputCopyData(dbConnection_, encoder.data().data(), static_cast<int>(encoder.size())) == 1;
+    }
+
+    // При ошибке отправки COPY прерывается, сервер откатит его целиком
+    if (PQputCopyEnd(dbConnection_, sent ? nullptr : "client failed to send COPY data") != 1) {
+        sent = false;
+    }
+
+    bool success = sent;
+    while ((res = PQgetResult(dbConnection_)) != nullptr) {
+        if (PQresultStatus(res) != PGRES_COMMAND_OK) {
+            std::cerr << "COPY into " << stagingTable(table) << " failed: "
+                      << PQerrorMessage(dbConnection_) << std::endl;
+            success = false;
+        }
+        PQclear(res);
+    }
+    return success;
+}
+
+bool Database::stagePageViews(const std::vector<AggregatedPageViews>& data) {
     if (data.empty()) return true;
-    if (!isConnected()) return false;
 
-    std::ostringstream sql;
-    sql << "INSERT INTO agg_page_views (time_bucket, project_id, page, views_count, unique_users, unique_sessions) VALUES ";
-
-    for (size_t i = 0; i < data.size(); ++i) {
-        const auto& d = data[i];
-        if (i > 0) sql << ", ";
-        sql << "('" << formatTimestamp(d.timeBucket) << "', "
-            << escapeString(d.projectId) << ", "
-            << escapeString(d.page) << ", "
-            << d.viewsCount << ", "
-            << d.uniqueUsers << ", "
-            << d.uniqueSessions << ")";
-    }
-    sql << " ON CONFLICT (time_bucket, project_id, page) DO UPDATE SET "
-        << "views_count = agg_page_views.views_count + EXCLUDED.views_count, "
-        << "unique_users = EXCLUDED.unique_users, "
-        << "unique_sessions = EXCLUDED.unique_sessions";
+    std::vector<AggregatedPageViews> merged;
+    if (!mergeStoredUniques(data, merged)) return false;
+    const auto& rows = merged.empty() ? data : merged;
+
+    bool copied = copyToStaging("agg_page_views", PAGE_VIEWS_COLUMNS, rows.size(),
+        [&rows](BinaryCopyEncoder& row, size_t i) {
+            const auto& d = rows[i];
+            row.beginRow(9);
+            row.addInt4(static_cast<int32_t>(d.stepSeconds));
+            row.addTimestamp(d.timeBucket);
+            row.addText(d.projectId);
+            row.addText(d.page);
+            row.addInt8(d.viewsCount);
+            row.addInt8(d.uniqueUsers);
+            row.addInt8(d.uniqueSessions);
+            row.addBytea(d.usersHll);
+            row.addBytea(d.sessionsHll);
+        });
+
+    return copied && executeQuery(mergeFromStaging("agg_page_views", PAGE_VIEWS_COLUMNS, pageViewsUpsert()));
+}
 
-    return executeQuery(sql.str());
+bool Database::stageClicks(const std::vector<AggregatedClicks>& data) {
+    if (data.empty()) return true;
+
+    std::vector<AggregatedClicks> merged;
+    if (!mergeStoredUniques(data, merged)) return false;
+    const auto& rows = merged.empty() ? data : merged;
+
+    bool copied = copyToStaging("agg_clicks", CLICKS_COLUMNS, rows.size(),
+        [&rows](BinaryCopyEncoder& row, size_t i) {
+            const auto& d = rows[i];
+            row.beginRow(10);
+            row.addInt4(static_cast<int32_t>(d.stepSeconds));
+            row.addTimestamp(d.timeBucket);
+            row.addText(d.projectId);
+            row.addText(d.page);
+            row.addText(d.elementId);
+            row.addInt8(d.clicksCount);
+            row.addInt8(d.uniqueUsers);
+            row.addInt8(d.uniqueSessions);
+            row.addBytea(d.usersHll);
+            row.addBytea(d.sessionsHll);
+        });
+
+    return copied && executeQuery(mergeFromStaging("agg_clicks", CLICKS_COLUMNS, clicksUpsert()));
 }
 
-bool Database::writeClicks(const std::vector<AggregatedClicks>& data) {
+bool Database::stagePerformance(const std::vector<AggregatedPerformance>& data) {
     if (data.empty()) return true;
-    if (!isConnected()) return false;
 
-    std::ostringstream sql;
-    sql << "INSERT INTO agg_clicks (time_bucket, project_id, page, element_id, clicks_count, unique_users, unique_sessions) VALUES ";
-
-    for (size_t i = 0; i < data.size(); ++i) {
-        const auto& d = data[i];
-        if (i > 0) sql << ", ";
-        sql << "('" << formatTimestamp(d.timeBucket) << "', "
-            << escapeString(d.projectId) << ", "
-            << escapeString(d.page) << ", "
-            << escapeString(d.elementId) << ", "
-            << d.clicksCount << ", "
-            << d.uniqueUsers << ", "
-            << d.uniqueSessions << ")";
-    }
-    sql << " ON CONFLICT (time_bucket, project_id, page, element_id) DO UPDATE SET "
-        << "clicks_count = agg_clicks.clicks_count + EXCLUDED.clicks_count, "
-        << "unique_users = EXCLUDED.unique_users, "
-        << "unique_sessions = EXCLUDED.unique_sessions";
+    bool copied = copyToStaging("agg_performance", PERFORMANCE_COLUMNS, data.size(),
+        [&data](BinaryCopyEncoder& row, size_t i) {
+            const auto& d = data[i];
+            row.beginRow(17);
+            row.addInt4(static_cast<int32_t>(d.stepSeconds));
+            row.addTimestamp(d.timeBucket);
+            row.addText(d.projectId);
+            row.addText(d.page);
+            row.addInt8(d.samplesCount);
+            row.addFloat8(d.avgTotalLoadMs);
+            row.addFloat8(d.p95TotalLoadMs);
+            row.addFloat8(d.avgTtfbMs);
+            row.addFloat8(d.p95TtfbMs);
+            row.addFloat8(d.avgFcpMs);
+            row.addFloat8(d.p95FcpMs);
+            row.addFloat8(d.avgLcpMs);
+            row.addFloat8(d.p95LcpMs);
+            row.addBytea(d.totalLoadSketch);
+            row.addBytea(d.ttfbSketch);
+            row.addBytea(d.fcpSketch);
+            row.addBytea(d.lcpSketch);
+        });
+
+    return copied && executeQuery(mergeFromStaging("agg_performance", PERFORMANCE_COLUMNS, performanceUpsert()));
+}
 
-    return executeQuery(sql.str());
+bool Database::stageErrors(const std::vector<AggregatedErrors>& data) {
+    if (data.empty()) return true;
+
+    std::vector<AggregatedErrors> merged;
+    if (!mergeStoredUniques(data, merged)) return false;
+    const auto& rows = merged.empty() ? data : merged;
+
+    bool copied = copyToStaging("agg_errors", ERRORS_COLUMNS, rows.size(),
+        [&rows](BinaryCopyEncoder& row, size_t i) {
+            const auto& d = rows[i];
+            row.beginRow(10);
+            row.addInt4(static_cast<int32_t>(d.stepSeconds));
+            row.addTimestamp(d.timeBucket);
+            row.addText(d.projectId);
+            row.addText(d.page);
+            row.addText(d.errorType);
+            row.addInt8(d.errorsCount);
+            row.addInt8(d.warningCount);
+            row.addInt8(d.criticalCount);
+            row.addInt8(d.uniqueUsers);
+            row.addBytea(d.usersHll);
+        });
+
+    return copied && executeQuery(mergeFromStaging("agg_errors", ERRORS_COLUMNS, errorsUpsert()));
 }
 
-bool Database::writePerformance(const std::vector<AggregatedPerformance>& data) {
+bool Database::stageCustomEvents(const std::vector<AggregatedCustomEvents>& data) {
     if (data.empty()) return true;
-    if (!isConnected()) return false;
 
-    std::ostringstream sql;
-    sql << "INSERT INTO agg_performance (time_bucket, project_id, page, samples_count, "
-        << "avg_total_load_ms, p95_total_load_ms, avg_ttfb_ms, p95_ttfb_ms, "
-        << "avg_fcp_ms, p95_fcp_ms, avg_lcp_ms, p95_lcp_ms) VALUES ";
-
-    for (size_t i = 0; i < data.size(); ++i) {
-        const auto& d = data[i];
-        if (i > 0) sql << ", ";
-        sql << "('" << formatTimestamp(d.timeBucket) << "', "
-            << escapeString(d.projectId) << ", "
-            << escapeString(d.page) << ", "
-            << d.samplesCount << ", "
-            << d.avgTotalLoadMs << ", "
-            << d.p95TotalLoadMs << ", "
-            << d.avgTtfbMs << ", "
-            << d.p95TtfbMs << ", "
-            << d.avgFcpMs << ", "
-            << d.p95FcpMs << ", "
-            << d.avgLcpMs << ", "
-            << d.p95LcpMs << ")";
-    }
-    sql << " ON CONFLICT (time_bucket, project_id, page) DO UPDATE SET "
-        << "samples_count = agg_performance.samples_count + EXCLUDED.samples_count, "
-        << "avg_total_load_ms = EXCLUDED.avg_total_load_ms, "
-        << "p95_total_load_ms = EXCLUDED.p95_total_load_ms, "
-        << "avg_ttfb_ms = EXCLUDED.avg_ttfb_ms, "
-        << "p95_ttfb_ms = EXCLUDED.p95_ttfb_ms, "
-        << "avg_fcp_ms = EXCLUDED.avg_fcp_ms, "
-        << "p95_fcp_ms = EXCLUDED.p95_fcp_ms, "
-        << "avg_lcp_ms = EXCLUDED.avg_lcp_ms, "
-        << "p95_lcp_ms = EXCLUDED.p95_lcp_ms";
+    std::vector<AggregatedCustomEvents> merged;
+    if (!mergeStoredUniques(data, merged)) return false;
+    const auto& rows = merged.empty() ? data : merged;
+
+    bool copied = copyToStaging("agg_custom_events", CUSTOM_EVENTS_COLUMNS, rows.size(),
+        [&rows](BinaryCopyEncoder& row, size_t i) {
+            const auto& d = rows[i];
+            row.beginRow(10);
+            row.addInt4(static_cast<int32_t>(d.stepSeconds));
+            row.addTimestamp(d.timeBucket);
+            row.addText(d.projectId);
+            row.addText(d.eventName);
+            row.addText(d.page);
+            row.addInt8(d.eventsCount);
+            row.addInt8(d.uniqueUsers);
+            row.addInt8(d.uniqueSessions);
+            row.addBytea(d.usersHll);
+            row.addBytea(d.sessionsHll);
+        });
+
+    return copied && executeQuery(mergeFromStaging("agg_custom_events", CUSTOM_EVENTS_COLUMNS, customEventsUpsert()));
+}
 
-    return executeQuery(sql.str());
+bool Database::stageLateEvents(const EventBatches& events, const SymbolTable& symbols) {
+    if (events.empty()) return true;
+
+    bool copied = copyToStaging("late_events", LATE_EVENTS_COLUMNS, events.size(),
+        [&events, &symbols](BinaryCopyEncoder& row, size_t i) {
+            // detail — поле, различающее группы своего типа; колонок, которых у типа
+            // нет, в строке нули
+            auto write = [&row, &symbols](const auto& batch, size_t r, SymbolId detail, int32_t severity,
+                                          const std::array<double, 4>& metrics) {
+                row.beginRow(13);
+                row.addText(batch.EVENT_TYPE);
+                row.addText(symbols.str(batch.projectId[r]));
+                row.addText(symbols.str(batch.page[r]));
+                row.addText(symbols.str(detail));
+                row.addText(symbols.str(batch.userId[r]));
+                row.addText(symbols.str(batch.sessionId[r]));
+                row.addInt4(severity);
+                for (double value : metrics) {
+                    row.addFloat8(value);
+                }
+                row.addTimestamp(batch.timestamp[r]);
+                row.addTimestamp(batch.receivedAt[r]);
+            };
+
+            // Строки пачек идут подряд: page_view, click, performance, error, custom
+            const auto& pageViews = events.pageViews;
+            if (i < pageViews.size()) return write(pageViews, i, EMPTY_SYMBOL, 0, {});
+            i -= pageViews.size();
+
+            const auto& clicks = events.clicks;
+            if (i < clicks.size()) return write(clicks, i, clicks.elementId[i], 0, {});
+            i -= clicks.size();
+
+            const auto& performance = events.performance;
+            if (i < performance.size()) {
+                return write(performance, i, EMPTY_SYMBOL, 0,
+                             {performance.totalPageLoadMs[i], performance.ttfbMs[i],
+                              performance.fcpMs[i], performance.lcpMs[i]});
+            }
+            i -= performance.size();
+
+            const auto& errors = events.errors;
+            if (i < errors.size()) return write(errors, i, errors.errorType[i], errors.severity[i], {});
+            i -= errors.size();
+
+            const auto& customEvents = events.customEvents;
+            write(customEvents, i, customEvents.eventName[i], 0, {});
+        });
+
+    return copied && executeQuery(mergeFromStaging("late_events", LATE_EVENTS_COLUMNS, ""));
 }
 
-bool Database::writeErrors(const std::vector<AggregatedErrors>& data) {
+bool Database::writePageViews(const std::vector<AggregatedPageViews>& data) {
     if (data.empty()) return true;
-    if (!isConnected()) return false;
+    if (!isConnected() || !ensureStagingTables()) return false;
 
-    std::ostringstream sql;
-    sql << "INSERT INTO agg_errors (time_bucket, project_id, page, error_type, "
-        << "errors_count, warning_count, critical_count, unique_users) VALUES ";
-
-    for (size_t i = 0; i < data.size(); ++i) {
-        const auto& d = data[i];
-        if (i > 0) sql << ", ";
-        sql << "('" << formatTimestamp(d.timeBucket) << "', "
-            << escapeString(d.projectId) << ", "
-            << escapeString(d.page) << ", "
-            << escapeString(d.errorType) << ", "
-            << d.errorsCount << ", "
-            << d.warningCount << ", "
-            << d.criticalCount << ", "
-            << d.uniqueUsers << ")";
-    }
-    sql << " ON CONFLICT (time_bucket, project_id, page, error_type) DO UPDATE SET "
-        << "errors_count = agg_errors.errors_count + EXCLUDED.errors_count, "
-        << "warning_count = agg_errors.warning_count + EXCLUDED.warning_count, "
-        << "critical_count = agg_errors.critical_count + EXCLUDED.critical_count, "
-        << "unique_users = EXCLUDED.unique_users";
+    return inTransaction([&] { return stagePageViews(data); });
+}
 
-    return executeQuery(sql.str());
+bool Database::writeClicks(const std::vector<AggregatedClicks>& data) {
+    if (data.empty()) return true;
+    if (!isConnected() || !ensureStagingTables()) return false;
+
+    return inTransaction([&] { return stageClicks(data); });
 }
 
-bool Database::writeCustomEvents(const std::vector<AggregatedCustomEvents>& data) {
+bool Database::writePerformance(const std::vector<AggregatedPerformance>& data) {
     if (data.empty()) return true;
-    if (!isConnected()) return false;
+    if (!isConnected() || !ensureStagingTables()) return false;
 
-    std::ostringstream sql;
-    sql << "INSERT INTO agg_custom_events (time_bucket, project_id, event_name, page, "
-        << "events_count, unique_users, unique_sessions) VALUES ";
-
-    for (size_t i = 0; i < data.size(); ++i) {
-        const auto& d = data[i];
-        if (i > 0) sql << ", ";
-        sql << "('" << formatTimestamp(d.timeBucket) << "', "
-            << escapeString(d.projectId) << ", "
-            << escapeString(d.eventName) << ", "
-            << escapeString(d.page) << ", "
-            << d.eventsCount << ", "
-            << d.uniqueUsers << ", "
-            << d.uniqueSessions << ")";
-    }
-    sql << " ON CONFLICT (time_bucket, project_id, event_name, page) DO UPDATE SET "
-        << "events_count = agg_custom_events.events_count + EXCLUDED.events_count, "
-        << "unique_users = EXCLUDED.unique_users, "
-        << "unique_sessions = EXCLUDED.unique_sessions";
+    return inTransaction([&] { return stagePerformance(data); });
+}
 
-    return executeQuery(sql.str());
+bool Database::writeErrors(const std::vector<AggregatedErrors>& data) {
+    if (data.empty()) return true;
+    if (!isConnected() || !ensureStagingTables()) return false;
+
+    return inTransaction([&] { return stageErrors(data); });
+}
+
+bool Database::writeCustomEvents(const std::vector<AggregatedCustomEvents>& data) {
+    if (data.empty()) return true;
+    if (!isConnected() || !ensureStagingTables()) return false;
+
+    return inTransaction([&] { return stageCustomEvents(data); });
 }
 
 bool Database::writeAggregationResult(const AggregationResult& result) {
-    bool success = true;
+    if (!isConnected() || !ensureStagingTables()) return false;
+
+    // Либо записаны все пять таблиц, либо ни одна: иначе повтор цикла
+    // удвоил бы уже записанные счётчики
+    return inTransaction([&] {
+        return stagePageViews(result.pageViews) &&
+               stageClicks(result.clicks) &&
+               stagePerformance(result.performance) &&
+               stageErrors(result.errors) &&
+               stageCustomEvents(result.customEvents);
+    });
+}
 
-    success &= writePageViews(result.pageViews);
-    success &= writeClicks(result.clicks);
-    success &= writePerformance(result.performance);
-    success &= writeErrors(result.errors);
-    success &= writeCustomEvents(result.customEvents);
+CommitStatus Database::commitAggregation(
+    const AggregationResult& result,
+    std::chrono::system_clock::time_point windowFrom,
+    std::chrono::system_clock::time_point windowTo,
+    const AggregationResult& corrections,
+    const EventBatches& lateEvents,
+    const SymbolTable& symbols
+) {
+    if (!isConnected() || !ensureStagingTables()) return CommitStatus::Failed;
+
+    // Строки staging живут до конца транзакции, поэтому каждая таблица сливается
+    // один раз: поправки идут вместе с окном. Их бакеты раньше окна или другого
+    // уровня, так что ключи не пересекаются
+    AggregationResult combined;
+    bool hasCorrections = !corrections.pageViews.empty() || !corrections.clicks.empty() ||
+                          !corrections.performance.empty() || !corrections.errors.empty() ||
+                          !corrections.customEvents.empty();
+    if (hasCorrections) {
+        combined = result;
+        auto append = [](auto& target, const auto& source) {
+            target.insert(target.end(), source.begin(), source.end());
+        };
+        append(combined.pageViews, corrections.pageViews);
+        append(combined.clicks, corrections.clicks);
+        append(combined.performance, corrections.performance);
+        append(combined.errors, corrections.errors);
+        append(combined.customEvents, corrections.customEvents);
+    }
+    const AggregationResult& rows = hasCorrections ? combined : result;
+
+    size_t rowsWritten = rows.pageViews.size() + rows.clicks.size() + rows.performance.size() +
+                         rows.errors.size() + rows.customEvents.size();
+
+    std::ostringstream claim;
+    claim << "INSERT INTO aggregation_commit_log (window_from, window_to, rows_written) VALUES ('"
+          << formatTimestamp(windowFrom) << "', '" << formatTimestamp(windowTo) << "', " << rowsWritten
+          << ") ON CONFLICT (window_from, window_to) DO NOTHING";
+
+    std::ostringstream advance;
+    advance << "UPDATE aggregation_watermark SET last_aggregated_at = '" << formatTimestamp(windowTo)
+            << "' WHERE id = 1 AND last_aggregated_at = '" << formatTimestamp(windowFrom) << "'";
+
+    // Для повторов достаточно недавних окон
+    const char* prune = "DELETE FROM aggregation_commit_log WHERE committed_at < NOW() - INTERVAL '7 days'";
+
+    bool alreadyCommitted = false;
+    bool committed = inTransaction([&] {
+        int claimed = executeUpdate(claim.str());
+        if (claimed == 0) {
+            alreadyCommitted = true;
+            return false;
+        }
+        if (claimed < 0) return false;
+
+        if (!stagePageViews(rows.pageViews) ||
+            !stageClicks(rows.clicks) ||
+            !stagePerformance(rows.performance) ||
+            !stageErrors(rows.errors) ||
+            !stageCustomEvents(rows.customEvents) ||
+            !stageLateEvents(lateEvents, symbols)) {
+            return false;
+        }
+
+        // watermark не там, где начинается окно: его сдвинул кто-то другой
+        if (executeUpdate(advance.str()) != 1) {
+            std::cerr << "Watermark moved concurrently, window starting at "
+                      << formatTimestamp(windowFrom) << " rejected" << std::endl;
+            return false;
+        }
+        return executeQuery(prune);
+    });
+
+    if (committed) return CommitStatus::Committed;
+    return alreadyCommitted ? CommitStatus::AlreadyCommitted : CommitStatus::Failed;
+}
 
-    return success;
+// ===== Свёртка уровней разрешения =====
+
+RollupWatermarks Database::getRollupWatermarks() {
+    RollupWatermarks result;
+    if (!isConnected()) return result;
+
+    PGresult* res = exec("SELECT step_seconds, rolled_up_until FROM aggregation_rollup_watermark");
+    if (PQresultStatus(res) != PGRES_TUPLES_OK) {
+        std::cerr << "Failed to get rollup watermarks: " << PQerrorMessage(dbConnection_) << std::endl;
+        PQclear(res);
+        return result;
+    }
+
+    int rows = PQntuples(res);
+    for (int i = 0; i < rows; ++i) {
+        std::chrono::seconds step(std::stoll(PQgetvalue(res, i, 0)));
+        result[step] = parseTimestamp(PQgetvalue(res, i, 1));
+    }
+
+    PQclear(res);
+    return result;
+}
+
+bool Database::rollup(
+    std::chrono::seconds source,
+    std::chrono::seconds target,
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to
+) {
+    if (!isConnected() || !ensureStagingTables()) return false;
+
+    std::ostringstream filter;
+    filter << " WHERE step_seconds = " << source.count()
+           << " AND time_bucket >= '" << formatTimestamp(from) << "'"
+           << " AND time_bucket < '" << formatTimestamp(to) << "'";
+
+    std::ostringstream bucket;
+    bucket << target.count() << ", date_bin('" << target.count()
+           << " seconds', time_bucket, TIMESTAMPTZ 'epoch')";
+
+    auto metric = [](const std::string& name) {
+        const std::string sketch = name + "_sketch";
+        const std::string weight = "COALESCE(ddsketch_count(" + sketch + "), 0)";
+        return "COALESCE(SUM(avg_" + name + "_ms * " + weight + ") / NULLIF(SUM(" + weight + "), 0), 0), "
+               "COALESCE(ddsketch_quantile(ddsketch_union_agg(" + sketch + "), 0.95), 0)";
+    };
+
+    // Квантили сворачиваются в БД; HLL-скетчи читаются и объединяются в collectRollup
+    const std::string performanceQuery =
+        "INSERT INTO agg_performance (" + PERFORMANCE_COLUMNS + ") "
+        "SELECT " + bucket.str() + ", project_id, page, SUM(samples_count), " +
+        metric("total_load") + ", " + metric("ttfb") + ", " + metric("fcp") + ", " + metric("lcp") + ", "
+        "ddsketch_union_agg(total_load_sketch), ddsketch_union_agg(ttfb_sketch), "
+        "ddsketch_union_agg(fcp_sketch), ddsketch_union_agg(lcp_sketch) "
+        "FROM agg_performance" + filter.str() + " GROUP BY 2, 3, 4" + performanceUpsert();
+
+    std::ostringstream progress;
+    progress << "INSERT INTO aggregation_rollup_watermark (step_seconds, rolled_up_until) VALUES ("
+             << target.count() << ", '" << formatTimestamp(to) << "') "
+             << "ON CONFLICT (step_seconds) DO UPDATE SET rolled_up_until = EXCLUDED.rolled_up_until";
+
+    // Строки уровня и его граница меняются атомарно, иначе повторная свёртка
+    // того же диапазона удвоила бы счётчики
+    return inTransaction([&] {
+        std::vector<AggregatedPageViews> pageViews;
+        std::vector<AggregatedClicks> clicks;
+        std::vector<AggregatedErrors> errors;
+        std::vector<AggregatedCustomEvents> customEvents;
+        return collectRollup(source, target, from, to, pageViews) && stagePageViews(pageViews) &&
+               collectRollup(source, target, from, to, clicks) && stageClicks(clicks) &&
+               executeQuery(performanceQuery) &&
+               collectRollup(source, target, from, to, errors) && stageErrors(errors) &&
+               collectRollup(source, target, from, to, customEvents) && stageCustomEvents(customEvents) &&
+               executeQuery(progress.str());
+    });
 }
 
 // ===== Методы чтения для gRPC сервера =====
 
+// ===== Чтение агрегатов =====
+
+namespace {
+
+// Параметры запроса чтения: $1 — project_id, $2..$4 — сегменты плана массивами
+// (шаг, начало и конец в микросекундах от эпохи), затем фильтры и пагинация
+struct ReadParams {
+    std::vector<std::string> values;
+    std::vector<std::string> filterColumns;
+
+    ReadParams(const std::string& projectId, const std::vector<TimeSegment>& segments) {
+        std::string steps = "{", froms = "{", tos = "{";
+        for (size_t i = 0; i < segments.size(); ++i) {
+            const char* sep = i > 0 ? "," : "";
+            steps += sep + std::to_string(segments[i].step.count());
+            froms += sep + std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(
+                segments[i].from.time_since_epoch()).count());
+            tos += sep + std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(
+                segments[i].to.time_since_epoch()).count());
+        }
+        values = {projectId, steps + "}", froms + "}", tos + "}"};
+    }
+
+    // Пустой фильтр не добавляется: для каждого набора фильтров свой statement
+    void filter(const char* column, const std::string& value) {
+        if (value.empty()) return;
+        filterColumns.push_back(column);
+        values.push_back(value);
+    }
+
+    std::string statementName(const std::string& prefix) const {
+        std::string name = prefix;
+        for (const auto& column : filterColumns) name += "_" + column;
+        return name;
+    }
+
+    // SELECT select FROM table t, ограниченный сегментами и фильтрами
+    std::string sql(const std::string& select, const std::string& table, const std::string& tail) const {
+        std::string sql =
+            "SELECT " + select + " "
+            "FROM unnest($2::INTEGER[], $3::BIGINT[], $4::BIGINT[]) AS s(step, from_us, to_us) "
+            "JOIN " + table + " t ON t.step_seconds = s.step "
+            "AND t.time_bucket >= TIMESTAMPTZ 'epoch' + s.from_us * INTERVAL '1 microsecond' "
+            "AND t.time_bucket < TIMESTAMPTZ 'epoch' + s.to_us * INTERVAL '1 microsecond' "
+            "WHERE t.project_id = $1";
+        for (size_t i = 0; i < filterColumns.size(); ++i) {
+            sql += " AND t." + filterColumns[i] + " = $" + std::to_string(5 + i);
+        }
+        return sql + tail;
+    }
+
+    // ORDER BY и LIMIT/OFFSET последними параметрами
+    std::string paginate(int limit, int offset) {
+        size_t next = values.size() + 1;
+        values.push_back(std::to_string(limit));
+        values.push_back(std::to_string(offset));
+        return " ORDER BY t.time_bucket DESC LIMIT $" + std::to_string(next) + " OFFSET $" + std::to_string(next + 1);
+    }
+};
+
+} // namespace
+
+PGresult* Database::execPrepared(
+    const std::string& name,
+    const std::function<std::string()>& sql,
+    const std::vector<std::string>& params
+) {
+    if (!prepared_.contains(name)) {
+        PGresult* res = PQprepare(dbConnection_, name.c_str(), sql().c_str(), static_cast<int>(params.size()), nullptr);
+        if (PQresultStatus(res) != PGRES_COMMAND_OK) {
+            failures_.fetch_add(1, std::memory_order_relaxed);
+            return res;
+        }
+        PQclear(res);
+        prepared_.insert(name);
+    }
+
+    std::vector<const char*> values;
+    values.reserve(params.size());
+    for (const auto& param : params) values.push_back(param.c_str());
+
+    auto start = std::chrono::steady_clock::now();
+    PGresult* res = PQexecPrepared(dbConnection_, name.c_str(), static_cast<int>(values.size()),
+                                   values.data(), nullptr, nullptr, 1);
+    trackQuery(start, res);
+    return res;
+}
+
 std::vector<AggregatedPageViews> Database::readPageViews(
     const std::string& projectId,
-    std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to,
+    const std::vector<TimeSegment>& segments,
     const std::string& pageFilter,
     int limit,
     int offset
 ) {
     std::vector<AggregatedPageViews> result;
+    if (!isConnected()) return result;
 
-    std::ostringstream sql;
-    sql << "SELECT time_bucket, project_id, page, views_count, unique_users, unique_sessions "
-        << "FROM agg_page_views WHERE project_id = '" << escapeString(projectId) << "' "
-        << "AND time_bucket >= '" << formatTimestamp(from) << "' "
-        << "AND time_bucket < '" << formatTimestamp(to) << "' ";
-
-    if (!pageFilter.empty()) {
-        sql << "AND page = '" << escapeString(pageFilter) << "' ";
-    }
-
-    sql << "ORDER BY time_bucket DESC LIMIT " << limit << " OFFSET " << offset;
+    ReadParams params(projectId, segments);
+    params.filter("page", pageFilter);
+    std::string tail = params.paginate(limit, offset);
 
-    PGresult* res = PQexec(dbConnection_, sql.str().c_str());
+    PGresult* res = execPrepared(params.statementName("read_page_views"), [&] {
+        return params.sql("t.time_bucket, t.project_id, t.page, t.views_count, t.unique_users, "
+                          "t.unique_sessions, t.step_seconds", "agg_page_views", tail);
+    }, params.values);
     if (PQresultStatus(res) != PGRES_TUPLES_OK) {
         std::cerr << "Read page views failed: " << PQerrorMessage(dbConnection_) << std::endl;
         PQclear(res);
@@ -366,15 +1190,18 @@ std::vector<AggregatedPageViews> Database::readPageViews(
     }
 
     int rows = PQntuples(res);
+    result.reserve(static_cast<size_t>(rows));
     for (int i = 0; i < rows; ++i) {
+        BinaryRow row(res, i);
         AggregatedPageViews agg;
-        agg.timeBucket = parseTimestamp(PQgetvalue(res, i, 0));
-        agg.projectId = PQgetvalue(res, i, 1);
-        agg.page = PQgetvalue(res, i, 2);
-        agg.viewsCount = std::stoll(PQgetvalue(res, i, 3));
-        agg.uniqueUsers = std::stoll(PQgetvalue(res, i, 4));
-        agg.uniqueSessions = std::stoll(PQgetvalue(res, i, 5));
-        result.push_back(agg);
+        agg.timeBucket = row.timestamp(0);
+        agg.projectId = row.bytes(1);
+        agg.page = row.bytes(2);
+        agg.viewsCount = row.int8(3);
+        agg.uniqueUsers = row.int8(4);
+        agg.uniqueSessions = row.int8(5);
+        agg.stepSeconds = row.int4(6);
+        result.push_back(std::move(agg));
     }
 
     PQclear(res);
@@ -383,31 +1210,24 @@ std::vector<AggregatedPageViews> Database::readPageViews(
 
 std::vector<AggregatedClicks> Database::readClicks(
     const std::string& projectId,
-    std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to,
+    const std::vector<TimeSegment>& segments,
     const std::string& pageFilter,
     const std::string& elementIdFilter,
     int limit,
     int offset
 ) {
     std::vector<AggregatedClicks> result;
+    if (!isConnected()) return result;
 
-    std::ostringstream sql;
-    sql << "SELECT time_bucket, project_id, page, element_id, clicks_count, unique_users, unique_sessions "
-        << "FROM agg_clicks WHERE project_id = '" << escapeString(projectId) << "' "
-        << "AND time_bucket >= '" << formatTimestamp(from) << "' "
-        << "AND time_bucket < '" << formatTimestamp(to) << "' ";
-
-    if (!pageFilter.empty()) {
-        sql << "AND page = '" << escapeString(pageFilter) << "' ";
-    }
-    if (!elementIdFilter.empty()) {
-        sql << "AND element_id = '" << escapeString(elementIdFilter) << "' ";
-    }
-
-    sql << "ORDER BY time_bucket DESC LIMIT " << limit << " OFFSET " << offset;
+    ReadParams params(projectId, segments);
+    params.filter("page", pageFilter);
+    params.filter("element_id", elementIdFilter);
+    std::string tail = params.paginate(limit, offset);
 
-    PGresult* res = PQexec(dbConnection_, sql.str().c_str());
+    PGresult* res = execPrepared(params.statementName("read_clicks"), [&] {
+        return params.sql("t.time_bucket, t.project_id, t.page, t.element_id, t.clicks_count, "
+                          "t.unique_users, t.unique_sessions, t.step_seconds", "agg_clicks", tail);
+    }, params.values);
     if (PQresultStatus(res) != PGRES_TUPLES_OK) {
         std::cerr << "Read clicks failed: " << PQerrorMessage(dbConnection_) << std::endl;
         PQclear(res);
@@ -415,16 +1235,19 @@ std::vector<AggregatedClicks> Database::readClicks(
     }
 
     int rows = PQntuples(res);
+    result.reserve(static_cast<size_t>(rows));
     for (int i = 0; i < rows; ++i) {
+        BinaryRow row(res, i);
         AggregatedClicks agg;
-        agg.timeBucket = parseTimestamp(PQgetvalue(res, i, 0));
-        agg.projectId = PQgetvalue(res, i, 1);
-        agg.page = PQgetvalue(res, i, 2);
-        agg.elementId = PQgetvalue(res, i, 3);
-        agg.clicksCount = std::stoll(PQgetvalue(res, i, 4));
-        agg.uniqueUsers = std::stoll(PQgetvalue(res, i, 5));
-        agg.uniqueSessions = std::stoll(PQgetvalue(res, i, 6));
-        result.push_back(agg);
+        agg.timeBucket = row.timestamp(0);
+        agg.projectId = row.bytes(1);
+        agg.page = row.bytes(2);
+        agg.elementId = row.bytes(3);
+        agg.clicksCount = row.int8(4);
+        agg.uniqueUsers = row.int8(5);
+        agg.uniqueSessions = row.int8(6);
+        agg.stepSeconds = row.int4(7);
+        result.push_back(std::move(agg));
     }
 
     PQclear(res);
@@ -433,29 +1256,25 @@ std::vector<AggregatedClicks> Database::readClicks(
 
 std::vector<AggregatedPerformance> Database::readPerformance(
     const std::string& projectId,
-    std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to,
+    const std::vector<TimeSegment>& segments,
     const std::string& pageFilter,
     int limit,
     int offset
 ) {
     std::vector<AggregatedPerformance> result;
-
-    std::ostringstream sql;
-    sql << "SELECT time_bucket, project_id, page, samples_count, "
-        << "avg_total_load_ms, p95_total_load_ms, avg_ttfb_ms, p95_ttfb_ms, "
-        << "avg_fcp_ms, p95_fcp_ms, avg_lcp_ms, p95_lcp_ms "
-        << "FROM agg_performance WHERE project_id = '" << escapeString(projectId) << "' "
-        << "AND time_bucket >= '" << formatTimestamp(from) << "' "
-        << "AND time_bucket < '" << formatTimestamp(to) << "' ";
-
-    if (!pageFilter.empty()) {
-        sql << "AND page = '" << escapeString(pageFilter) << "' ";
-    }
-
-    sql << "ORDER BY time_bucket DESC LIMIT " << limit << " OFFSET " << offset;
-
-    PGresult* res = PQexec(dbConnection_, sql.str().c_str());
+    if (!isConnected()) return result;
+
+    ReadParams params(projectId, segments);
+    params.filter("page", pageFilter);
+    std::string tail = params.paginate(limit, offset);
+
+    PGresult* res = execPrepared(params.statementName("read_performance"), [&] {
+        return params.sql("t.time_bucket, t.project_id, t.page, t.samples_count, "
+                          "t.avg_total_load_ms, t.p95_total_load_ms, t.avg_ttfb_ms, t.p95_ttfb_ms, "
+                          "t.avg_fcp_ms, t.p95_fcp_ms, t.avg_lcp_ms, t.p95_lcp_ms, "
+                          "t.total_load_sketch, t.ttfb_sketch, t.fcp_sketch, t.lcp_sketch, t.step_seconds",
+                          "agg_performance", tail);
+    }, params.values);
     if (PQresultStatus(res) != PGRES_TUPLES_OK) {
         std::cerr << "Read performance failed: " << PQerrorMessage(dbConnection_) << std::endl;
         PQclear(res);
@@ -463,21 +1282,28 @@ std::vector<AggregatedPerformance> Database::readPerformance(
     }
 
     int rows = PQntuples(res);
+    result.reserve(static_cast<size_t>(rows));
     for (int i = 0; i < rows; ++i) {
+        BinaryRow row(res, i);
         AggregatedPerformance agg;
-        agg.timeBucket = parseTimestamp(PQgetvalue(res, i, 0));
-        agg.projectId = PQgetvalue(res, i, 1);
-        agg.page = PQgetvalue(res, i, 2);
-        agg.samplesCount = std::stoll(PQgetvalue(res, i, 3));
-        agg.avgTotalLoadMs = std::stod(PQgetvalue(res, i, 4));
-        agg.p95TotalLoadMs = std::stod(PQgetvalue(res, i, 5));
-        agg.avgTtfbMs = std::stod(PQgetvalue(res, i, 6));
-        agg.p95TtfbMs = std::stod(PQgetvalue(res, i, 7));
-        agg.avgFcpMs = std::stod(PQgetvalue(res, i, 8));
-        agg.p95FcpMs = std::stod(PQgetvalue(res, i, 9));
-        agg.avgLcpMs = std::stod(PQgetvalue(res, i, 10));
-        agg.p95LcpMs = std::stod(PQgetvalue(res, i, 11));
-        result.push_back(agg);
+        agg.timeBucket = row.timestamp(0);
+        agg.projectId = row.bytes(1);
+        agg.page = row.bytes(2);
+        agg.samplesCount = row.int8(3);
+        agg.avgTotalLoadMs = row.float8(4);
+        agg.p95TotalLoadMs = row.float8(5);
+        agg.avgTtfbMs = row.float8(6);
+        agg.p95TtfbMs = row.float8(7);
+        agg.avgFcpMs = row.float8(8);
+        agg.p95FcpMs = row.float8(9);
+        agg.avgLcpMs = row.float8(10);
+        agg.p95LcpMs = row.float8(11);
+        agg.totalLoadSketch = row.bytes(12);
+        agg.ttfbSketch = row.bytes(13);
+        agg.fcpSketch = row.bytes(14);
+        agg.lcpSketch = row.bytes(15);
+        agg.stepSeconds = row.int4(16);
+        result.push_back(std::move(agg));
     }
 
     PQclear(res);
@@ -486,32 +1312,24 @@ std::vector<AggregatedPerformance> Database::readPerformance(
 
 std::vector<AggregatedErrors> Database::readErrors(
     const std::string& projectId,
-    std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to,
+    const std::vector<TimeSegment>& segments,
     const std::string& pageFilter,
     const std::string& errorTypeFilter,
     int limit,
     int offset
 ) {
     std::vector<AggregatedErrors> result;
+    if (!isConnected()) return result;
 
-    std::ostringstream sql;
-    sql << "SELECT time_bucket, project_id, page, error_type, errors_count, "
-        << "warning_count, critical_count, unique_users "
-        << "FROM agg_errors WHERE project_id = '" << escapeString(projectId) << "' "
-        << "AND time_bucket >= '" << formatTimestamp(from) << "' "
-        << "AND time_bucket < '" << formatTimestamp(to) << "' ";
-
-    if (!pageFilter.empty()) {
-        sql << "AND page = '" << escapeString(pageFilter) << "' ";
-    }
-    if (!errorTypeFilter.empty()) {
-        sql << "AND error_type = '" << escapeString(errorTypeFilter) << "' ";
-    }
-
-    sql << "ORDER BY time_bucket DESC LIMIT " << limit << " OFFSET " << offset;
+    ReadParams params(projectId, segments);
+    params.filter("page", pageFilter);
+    params.filter("error_type", errorTypeFilter);
+    std::string tail = params.paginate(limit, offset);
 
-    PGresult* res = PQexec(dbConnection_, sql.str().c_str());
+    PGresult* res = execPrepared(params.statementName("read_errors"), [&] {
+        return params.sql("t.time_bucket, t.project_id, t.page, t.error_type, t.errors_count, "
+                          "t.warning_count, t.critical_count, t.unique_users, t.step_seconds", "agg_errors", tail);
+    }, params.values);
     if (PQresultStatus(res) != PGRES_TUPLES_OK) {
         std::cerr << "Read errors failed: " << PQerrorMessage(dbConnection_) << std::endl;
         PQclear(res);
@@ -519,17 +1337,20 @@ std::vector<AggregatedErrors> Database::readErrors(
     }
 
     int rows = PQntuples(res);
+    result.reserve(static_cast<size_t>(rows));
     for (int i = 0; i < rows; ++i) {
+        BinaryRow row(res, i);
         AggregatedErrors agg;
-        agg.timeBucket = parseTimestamp(PQgetvalue(res, i, 0));
-        agg.projectId = PQgetvalue(res, i, 1);
-        agg.page = PQgetvalue(res, i, 2);
-        agg.errorType = PQgetvalue(res, i, 3);
-        agg.errorsCount = std::stoll(PQgetvalue(res, i, 4));
-        agg.warningCount = std::stoll(PQgetvalue(res, i, 5));
-        agg.criticalCount = std::stoll(PQgetvalue(res, i, 6));
-        agg.uniqueUsers = std::stoll(PQgetvalue(res, i, 7));
-        result.push_back(agg);
+        agg.timeBucket = row.timestamp(0);
+        agg.projectId = row.bytes(1);
+        agg.page = row.bytes(2);
+        agg.errorType = row.bytes(3);
+        agg.errorsCount = row.int8(4);
+        agg.warningCount = row.int8(5);
+        agg.criticalCount = row.int8(6);
+        agg.uniqueUsers = row.int8(7);
+        agg.stepSeconds = row.int4(8);
+        result.push_back(std::move(agg));
     }
 
     PQclear(res);
@@ -538,32 +1359,24 @@ std::vector<AggregatedErrors> Database::readErrors(
 
 std::vector<AggregatedCustomEvents> Database::readCustomEvents(
     const std::string& projectId,
-    std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to,
+    const std::vector<TimeSegment>& segments,
     const std::string& eventNameFilter,
     const std::string& pageFilter,
     int limit,
     int offset
 ) {
     std::vector<AggregatedCustomEvents> result;
+    if (!isConnected()) return result;
 
-    std::ostringstream sql;
-    sql << "SELECT time_bucket, project_id, event_name, page, events_count, "
-        << "unique_users, unique_sessions "
-        << "FROM agg_custom_events WHERE project_id = '" << escapeString(projectId) << "' "
-        << "AND time_bucket >= '" << formatTimestamp(from) << "' "
-        << "AND time_bucket < '" << formatTimestamp(to) << "' ";
+    ReadParams params(projectId, segments);
+    params.filter("event_name", eventNameFilter);
+    params.filter("page", pageFilter);
+    std::string tail = params.paginate(limit, offset);
 
-    if (!eventNameFilter.empty()) {
-        sql << "AND event_name = '" << escapeString(eventNameFilter) << "' ";
-    }
-    if (!pageFilter.empty()) {
-        sql << "AND page = '" << escapeString(pageFilter) << "' ";
-    }
-
-    sql << "ORDER BY time_bucket DESC LIMIT " << limit << " OFFSET " << offset;
-
-    PGresult* res = PQexec(dbConnection_, sql.str().c_str());
+    PGresult* res = execPrepared(params.statementName("read_custom_events"), [&] {
+        return params.sql("t.time_bucket, t.project_id, t.event_name, t.page, t.events_count, "
+                          "t.unique_users, t.unique_sessions, t.step_seconds", "agg_custom_events", tail);
+    }, params.values);
     if (PQresultStatus(res) != PGRES_TUPLES_OK) {
         std::cerr << "Read custom events failed: " << PQerrorMessage(dbConnection_) << std::endl;
         PQclear(res);
@@ -571,22 +1384,92 @@ std::vector<AggregatedCustomEvents> Database::readCustomEvents(
     }
 
     int rows = PQntuples(res);
+    result.reserve(static_cast<size_t>(rows));
     for (int i = 0; i < rows; ++i) {
+        BinaryRow row(res, i);
         AggregatedCustomEvents agg;
-        agg.timeBucket = parseTimestamp(PQgetvalue(res, i, 0));
-        agg.projectId = PQgetvalue(res, i, 1);
-        agg.eventName = PQgetvalue(res, i, 2);
-        agg.page = PQgetvalue(res, i, 3);
-        agg.eventsCount = std::stoll(PQgetvalue(res, i, 4));
-        agg.uniqueUsers = std::stoll(PQgetvalue(res, i, 5));
-        agg.uniqueSessions = std::stoll(PQgetvalue(res, i, 6));
-        result.push_back(agg);
+        agg.timeBucket = row.timestamp(0);
+        agg.projectId = row.bytes(1);
+        agg.eventName = row.bytes(2);
+        agg.page = row.bytes(3);
+        agg.eventsCount = row.int8(4);
+        agg.uniqueUsers = row.int8(5);
+        agg.uniqueSessions = row.int8(6);
+        agg.stepSeconds = row.int4(7);
+        result.push_back(std::move(agg));
     }
 
     PQclear(res);
     return result;
 }
 
-} // namespace aggregation
+UniqueCounts Database::readUniques(
+    UniquesSource source,
+    const std::string& projectId,
+    const std::vector<TimeSegment>& segments,
+    const std::string& pageFilter,
+    const std::string& extraFilter
+) {
+    UniqueCounts result;
+    if (!isConnected()) return result;
+
+    const char* table = "agg_page_views";
+    const char* extraColumn = nullptr;
+    bool hasSessions = true;
+    switch (source) {
+        case UniquesSource::PageViews:
+            break;
+        case UniquesSource::Clicks:
+            table = "agg_clicks";
+            extraColumn = "element_id";
+            break;
+        case UniquesSource::Errors:
+            table = "agg_errors";
+            extraColumn = "error_type";
+            hasSessions = false;
+            break;
+        case UniquesSource::CustomEvents:
+            table = "agg_custom_events";
+            extraColumn = "event_name";
+            break;
+    }
 
+    ReadParams params(projectId, segments);
+    params.filter("page", pageFilter);
+    if (extraColumn != nullptr) {
+        params.filter(extraColumn, extraFilter);
+    }
+
+    PGresult* res = execPrepared(params.statementName(std::string("read_uniques_") + table), [&] {
+        return params.sql(std::string("t.users_hll, ") + (hasSessions ? "t.sessions_hll" : "NULL::BYTEA"), table, "");
+    }, params.values);
+    if (PQresultStatus(res) != PGRES_TUPLES_OK) {
+        std::cerr << "Read uniques failed: " << PQerrorMessage(dbConnection_) << std::endl;
+        PQclear(res);
+        return result;
+    }
+
+    // Строки без скетча в оценку не входят
+    HyperLogLog users;
+    HyperLogLog sessions;
+    try {
+        for (int i = 0; i < PQntuples(res); ++i) {
+            BinaryRow row(res, i);
+            if (!row.isNull(0)) users.merge(HyperLogLog::deserialize(row.bytes(0)));
+            if (!row.isNull(1)) sessions.merge(HyperLogLog::deserialize(row.bytes(1)));
+        }
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Stored sketch in " << table << " is malformed: " << e.what() << std::endl;
+        PQclear(res);
+        return result;
+    }
+
+    result.bucketsCount = PQntuples(res);
+    result.uniqueUsers = users.estimate();
+    result.uniqueSessions = sessions.estimate();
+
+    PQclear(res);
+    return result;
+}
 
+} // namespace aggregation
@@ -0,0 +1,184 @@
+#include "database_pool.h"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+namespace aggregation {
+
+// ===== DatabasePool::Lease =====
+
+DatabasePool::Lease::Lease(Lease&& other) noexcept
+    : pool_(other.pool_), db_(other.db_) {
+    other.pool_ = nullptr;
+    other.db_ = nullptr;
+}
+
+DatabasePool::Lease& DatabasePool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool_ = other.pool_;
+        db_ = other.db_;
+        other.pool_ = nullptr;
+        other.db_ = nullptr;
+    }
+    return *this;
+}
+
+DatabasePool::Lease::~Lease() {
+    release();
+}
+
+void DatabasePool::Lease::release() {
+    if (pool_ && db_) {
+        pool_->release(db_);
+    }
+    pool_ = nullptr;
+    db_ = nullptr;
+}
+
+// ===== DatabasePool =====
+
+DatabasePool::DatabasePool(std::string name, size_t size)
+    : name_(std::move(name)) {
+    if (size == 0) size = 1;
+    for (size_t i = 0; i < size; ++i) {
+        connections_.push_back(std::make_unique<Database>());
+        idle_.push_back(connections_.back().get());
+    }
+}
+
+DatabasePool::~DatabasePool() {
+    disconnect();
+}
+
+bool DatabasePool::connect(const std::string& connectionString) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    connectionString_ = connectionString;
+
+    // Соединения, выданные прямо сейчас, не трогаем: их переподключит acquire()
+    for (auto* db : idle_) {
+        if (!db->connect(connectionString_)) {
+            std::cerr << "DatabasePool '" << name_ << "': failed to open connection" << std::endl;
+            return false;
+        }
+    }
+
+    std::cout << "DatabasePool '" << name_ << "': " << connections_.size()
+              << " connection(s) opened" << std::endl;
+    return true;
+}
+
+void DatabasePool::disconnect() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto* db : idle_) {
+        db->disconnect();
+    }
+}
+
+DatabasePool::Lease DatabasePool::acquire(std::chrono::milliseconds timeout) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!available_.wait_for(lock, timeout, [this] { return !idle_.empty(); })) {
+        ++timeouts_;
+        std::cerr << "DatabasePool '" << name_ << "': no free connection within "
+                  << timeout.count() << " ms" << std::endl;
+        return Lease();
+    }
+
+    Database* db = idle_.back();
+    idle_.pop_back();
+
+    auto waited = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    ++acquired_;
+    waitTotal_ += waited;
+    waitMax_ = std::max(waitMax_, waited);
+
+    bool needsReconnect = !connectionString_.empty() && !db->isConnected();
+    std::string connectionString = connectionString_;
+    lock.unlock();
+
+    // Переподключение идёт вне мьютекса: соединение уже принадлежит вызывающему
+    if (needsReconnect) {
+        std::cerr << "DatabasePool '" << name_ << "': connection lost, reconnecting" << std::endl;
+        db->connect(connectionString);
+
+        std::lock_guard<std::mutex> relock(mutex_);
+        ++reconnects_;
+    }
+
+    return Lease(this, db);
+}
+
+void DatabasePool::release(Database* db) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        idle_.push_back(db);
+    }
+    available_.notify_one();
+}
+
+DatabasePool::Stats DatabasePool::stats() const {
+    Stats result;
+    result.name = name_;
+    result.size = connections_.size();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        result.inUse = connections_.size() - idle_.size();
+        result.acquired = acquired_;
+        result.timeouts = timeouts_;
+        result.reconnects = reconnects_;
+        result.waitTotal = waitTotal_;
+        result.waitMax = waitMax_;
+    }
+
+    for (const auto& db : connections_) {
+        auto q = db->queryStats();
+        result.queries.queries += q.queries;
+        result.queries.failures += q.failures;
+        result.queries.totalTime += q.totalTime;
+    }
+    return result;
+}
+
+std::string formatPoolMetrics(const std::vector<DatabasePool::Stats>& pools) {
+    auto seconds = [](std::chrono::microseconds us) {
+        return std::chrono::duration<double>(us).count();
+    };
+
+    std::ostringstream out;
+    auto metric = [&](const char* name, const char* type, const char* help, auto value) {
+        out << "# HELP " << name << " " << help << "\n"
+            << "# TYPE " << name << " " << type << "\n";
+        for (const auto& pool : pools) {
+            out << name << "{pool=\"" << pool.name << "\"} " << value(pool) << "\n";
+        }
+    };
+
+    metric("aggregation_db_pool_size", "gauge", "Connections in the pool",
+           [](const auto& p) { return p.size; });
+    metric("aggregation_db_pool_in_use", "gauge", "Connections currently leased",
+           [](const auto& p) { return p.inUse; });
+    metric("aggregation_db_pool_acquired_total", "counter", "Successful connection leases",
+           [](const auto& p) { return p.acquired; });
+    metric("aggregation_db_pool_acquire_timeouts_total", "counter", "Leases that timed out",
+           [](const auto& p) { return p.timeouts; });
+    metric("aggregation_db_pool_reconnects_total", "counter", "Reconnects of lost connections",
+           [](const auto& p) { return p.reconnects; });
+    metric("aggregation_db_pool_acquire_wait_seconds_total", "counter", "Time spent waiting for a connection",
+           [&](const auto& p) { return seconds(p.waitTotal); });
+    metric("aggregation_db_pool_acquire_wait_seconds_max", "gauge", "Longest wait for a connection",
+           [&](const auto& p) { return seconds(p.waitMax); });
+    metric("aggregation_db_queries_total", "counter", "Statements executed",
+           [](const auto& p) { return p.queries.queries; });
+    metric("aggregation_db_query_failures_total", "counter", "Statements that failed",
+           [](const auto& p) { return p.queries.failures; });
+    metric("aggregation_db_query_seconds_total", "counter", "Time spent executing statements",
+           [&](const auto& p) { return seconds(p.queries.totalTime); });
+
+    return out.str();
+}
+
+} // namespace aggregation
@@ -0,0 +1,130 @@
+#include "ddsketch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace aggregation {
+
+namespace {
+
+// Должно совпадать с ddsketch_quantile() в init.sql: gamma = 101 / 99
+const double GAMMA = (1.0 + DDSketch::RELATIVE_ACCURACY) / (1.0 - DDSketch::RELATIVE_ACCURACY);
+const double LOG_GAMMA = std::log(GAMMA);
+
+void writeBigEndian(std::string& out, uint64_t value, int bytes) {
+    for (int i = bytes - 1; i >= 0; --i) {
+        out += static_cast<char>((value >> (i * 8)) & 0xff);
+    }
+}
+
+uint64_t readBigEndian(std::string_view in, size_t pos, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; ++i) {
+        value = (value << 8) | static_cast<unsigned char>(in[pos + i]);
+    }
+    return value;
+}
+
+} // namespace
+
+int32_t DDSketch::indexOf(double value) {
+    return static_cast<int32_t>(std::ceil(std::log(value) / LOG_GAMMA));
+}
+
+// Середина бина (gamma^(i-1), gamma^i] с точки зрения относительной ошибки
+double DDSketch::valueOf(int32_t index) {
+    return 2.0 * std::pow(GAMMA, index) / (GAMMA + 1.0);
+}
+
+void DDSketch::add(double value) {
+    if (!(value > 0) || !std::isfinite(value)) return;
+    addToBin(indexOf(value), 1);
+}
+
+void DDSketch::addToBin(int32_t index, int64_t count) {
+    if (counts_.empty()) {
+        offset_ = index;
+        counts_.assign(1, 0);
+    } else if (index < offset_) {
+        counts_.insert(counts_.begin(), static_cast<size_t>(offset_ - index), 0);
+        offset_ = index;
+    } else if (static_cast<size_t>(index - offset_) >= counts_.size()) {
+        counts_.resize(static_cast<size_t>(index - offset_) + 1, 0);
+    }
+
+    counts_[static_cast<size_t>(index - offset_)] += count;
+    count_ += count;
+
+    if (counts_.size() > MAX_BINS) collapse();
+}
+
+void DDSketch::collapse() {
+    const size_t excess = counts_.size() - MAX_BINS;
+    counts_[excess] = std::accumulate(counts_.begin(), counts_.begin() + static_cast<std::ptrdiff_t>(excess) + 1,
+                                      int64_t{0});
+    counts_.erase(counts_.begin(), counts_.begin() + static_cast<std::ptrdiff_t>(excess));
+    offset_ += static_cast<int32_t>(excess);
+}
+
+void DDSketch::merge(const DDSketch& other) {
+    for (size_t i = 0; i < other.counts_.size(); ++i) {
+        if (other.counts_[i] != 0) {
+            addToBin(other.offset_ + static_cast<int32_t>(i), other.counts_[i]);
+        }
+    }
+}
+
+// Ранг q * (n - 1) с округлением вниз — как у точного квантиля по отсортированным значениям
+double DDSketch::quantile(double q) const {
+    if (empty()) return 0.0;
+
+    q = std::clamp(q, 0.0, 1.0);
+    const double rank = q * static_cast<double>(count_ - 1);
+
+    int64_t cumulative = 0;
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        cumulative += counts_[i];
+        if (static_cast<double>(cumulative) > rank) {
+            return valueOf(offset_ + static_cast<int32_t>(i));
+        }
+    }
+    return valueOf(offset_ + static_cast<int32_t>(counts_.size()) - 1);
+}
+
+std::string DDSketch::serialize() const {
+    if (empty()) return {};
+
+    std::string bytes;
+    bytes.reserve(1 + counts_.size() * BIN_SIZE);
+    bytes += static_cast<char>(FORMAT_VERSION);
+    for (size_t i = 0; i < counts_.size(); ++i) {
+        if (counts_[i] == 0) continue;
+        writeBigEndian(bytes, static_cast<uint32_t>(offset_ + static_cast<int32_t>(i)), sizeof(int32_t));
+        writeBigEndian(bytes, static_cast<uint64_t>(counts_[i]), sizeof(int64_t));
+    }
+    return bytes;
+}
+
+DDSketch DDSketch::deserialize(std::string_view bytes) {
+    DDSketch sketch;
+    if (bytes.empty()) return sketch;
+
+    if (static_cast<uint8_t>(bytes[0]) != FORMAT_VERSION) {
+        throw std::invalid_argument("DDSketch: unsupported format version " +
+                                    std::to_string(static_cast<uint8_t>(bytes[0])));
+    }
+    if ((bytes.size() - 1) % BIN_SIZE != 0) {
+        throw std::invalid_argument("DDSketch: truncated sketch of " + std::to_string(bytes.size()) + " bytes");
+    }
+
+    for (size_t pos = 1; pos < bytes.size(); pos += BIN_SIZE) {
+        auto index = static_cast<int32_t>(static_cast<uint32_t>(readBigEndian(bytes, pos, sizeof(int32_t))));
+        auto count = static_cast<int64_t>(readBigEndian(bytes, pos + sizeof(int32_t), sizeof(int64_t)));
+        if (count > 0) sketch.addToBin(index, count);
+    }
+    return sketch;
+}
+
+} // namespace aggregation
@@ -0,0 +1,45 @@
+#include "event_batch.h"
+
+namespace aggregation {
+
+size_t EventBatches::size() const {
+    size_t total = 0;
+    forEach([&total](const auto& batch) { total += batch.size(); });
+    return total;
+}
+
+void EventBatches::clear() {
+    forEach([](auto& batch) { clearBatch(batch); });
+}
+
+bool EventBatches::hasReceivedBefore(std::chrono::system_clock::time_point to) const {
+    bool found = false;
+    forEach([&found, to](const auto& batch) {
+        for (auto received : batch.receivedAt) {
+            if (received < to) {
+                found = true;
+                return;
+            }
+        }
+    });
+    return found;
+}
+
+EventBatches EventBatches::takeReceivedBefore(std::chrono::system_clock::time_point to) {
+    EventBatches taken;
+    auto split = [to](auto& batch, auto& accepted) {
+        std::remove_reference_t<decltype(batch)> rest;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            appendRow(batch.receivedAt[i] < to ? accepted : rest, batch, i);
+        }
+        batch = std::move(rest);
+    };
+    split(pageViews, taken.pageViews);
+    split(clicks, taken.clicks);
+    split(performance, taken.performance);
+    split(errors, taken.errors);
+    split(customEvents, taken.customEvents);
+    return taken;
+}
+
+} // namespace aggregation
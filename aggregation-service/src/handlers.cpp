@@ -43,6 +43,12 @@ HttpHandler::HttpHandler(int port)
     });
 }
 
+void HttpHandler::setMetricsHandler(MetricsFunc metrics) {
+    impl_->server.Get("/metrics", [metrics](const httplib::Request& req, httplib::Response& res) {
+        res.set_content(metrics(), "text/plain; version=0.0.4");
+    });
+}
+
 HttpHandler::~HttpHandler() {
     stop();
 }
@@ -56,6 +62,7 @@ void HttpHandler::start() {
         std::cout << "  GET /health/ready - readiness probe" << std::endl;
         std::cout << "  GET /health       - health check" << std::endl;
         std::cout << "  GET /ping         - simple ping" << std::endl;
+        std::cout << "  GET /metrics      - database pool metrics" << std::endl;
         impl_->server.listen("0.0.0.0", port_);
     });
 }
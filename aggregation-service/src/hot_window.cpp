@@ -0,0 +1,355 @@
+#include "hot_window.h"
+#include "rollup.h"
+
+#include <algorithm>
+#include <mutex>
+#include <sstream>
+
+namespace aggregation {
+
+namespace {
+
+constexpr int64_t PARTITION_SECONDS = 3600;
+
+// Оценка памяти: заголовки векторов, узел map и ключ серии
+constexpr size_t SERIES_OVERHEAD = 256;
+constexpr size_t PAGE_VIEWS_ROW_BYTES = 4 * sizeof(int64_t);
+constexpr size_t PERFORMANCE_ROW_BYTES = 2 * sizeof(int64_t) + 8 * sizeof(double) + 4 * sizeof(std::string);
+
+int64_t toSeconds(std::chrono::system_clock::time_point tp) {
+    return std::chrono::floor<std::chrono::seconds>(tp.time_since_epoch()).count();
+}
+
+// Граница диапазона чтения: бакет b попадает в [from, to), если ceil(from) <= b < ceil(to)
+int64_t ceilSeconds(std::chrono::system_clock::time_point tp) {
+    return std::chrono::ceil<std::chrono::seconds>(tp.time_since_epoch()).count();
+}
+
+std::chrono::system_clock::time_point fromSeconds(int64_t seconds) {
+    return std::chrono::system_clock::time_point(std::chrono::seconds(seconds));
+}
+
+int64_t partitionOf(int64_t seconds) {
+    return toSeconds(alignDown(fromSeconds(seconds), std::chrono::seconds(PARTITION_SECONDS)));
+}
+
+// Записывает значение колонки: на место бакета или вставкой новой позиции
+template <typename T>
+void put(std::vector<T>& column, size_t pos, bool replace, T value) {
+    if (replace) {
+        column[pos] = std::move(value);
+    } else {
+        column.insert(column.begin() + static_cast<std::ptrdiff_t>(pos), std::move(value));
+    }
+}
+
+// Позиция бакета в серии и есть ли он там уже
+std::pair<size_t, bool> locate(const std::vector<int64_t>& buckets, int64_t bucket) {
+    auto it = std::lower_bound(buckets.begin(), buckets.end(), bucket);
+    return {static_cast<size_t>(it - buckets.begin()), it != buckets.end() && *it == bucket};
+}
+
+// Порядок строк как в БД: time_bucket по убыванию, затем страница; затем OFFSET/LIMIT
+template <typename Row>
+std::vector<Row> paginate(std::vector<Row> rows, int limit, int offset) {
+    std::stable_sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+        if (a.timeBucket != b.timeBucket) return a.timeBucket > b.timeBucket;
+        return a.page < b.page;
+    });
+
+    auto begin = std::min(rows.size(), static_cast<size_t>(std::max(offset, 0)));
+    auto end = std::min(rows.size(), begin + static_cast<size_t>(std::max(limit, 0)));
+    return std::vector<Row>(std::make_move_iterator(rows.begin() + static_cast<std::ptrdiff_t>(begin)),
+                            std::make_move_iterator(rows.begin() + static_cast<std::ptrdiff_t>(end)));
+}
+
+// Серии проекта (или одна серия при заданной странице) в партиции
+template <typename Columns, typename Visit>
+void forEachSeries(const std::map<std::pair<std::string, std::string>, Columns>& series,
+                   const std::string& projectId, const std::string& pageFilter, Visit&& visit) {
+    if (!pageFilter.empty()) {
+        auto it = series.find({projectId, pageFilter});
+        if (it != series.end()) visit(it->first, it->second);
+        return;
+    }
+    for (auto it = series.lower_bound({projectId, ""}); it != series.end() && it->first.first == projectId; ++it) {
+        visit(it->first, it->second);
+    }
+}
+
+} // namespace
+
+HotWindowCache::HotWindowCache(Config config)
+    : config_(config) {
+}
+
+void HotWindowCache::add(const AggregationResult& result,
+                         std::chrono::system_clock::time_point from,
+                         std::chrono::system_clock::time_point to) {
+    std::unique_lock lock(mutex_);
+
+    // Пропущенное окно (рестарт агрегатора, сброс движка) — покрытие начинается заново
+    if (!coveredFrom_ || from != coveredTo_) {
+        clear();
+        coveredFrom_ = from;
+    }
+
+    for (const auto& row : result.pageViews) insert(row);
+    for (const auto& row : result.performance) insert(row);
+    coveredTo_ = to;
+
+    evict(to);
+}
+
+void HotWindowCache::refresh(const std::vector<AggregatedPageViews>& pageViews,
+                             const std::vector<AggregatedPerformance>& performance) {
+    std::unique_lock lock(mutex_);
+    if (!coveredFrom_) return;
+
+    auto covered = [this](const auto& row) {
+        return row.timeBucket >= *coveredFrom_ && row.timeBucket < coveredTo_;
+    };
+    for (const auto& row : pageViews) {
+        if (covered(row)) insert(row);
+    }
+    for (const auto& row : performance) {
+        if (covered(row)) insert(row);
+    }
+
+    evict(coveredTo_);
+}
+
+void HotWindowCache::insert(const AggregatedPageViews& row) {
+    int64_t bucket = toSeconds(row.timeBucket);
+    auto& partition = partitions_[partitionOf(bucket)];
+
+    auto [it, created] = partition.pageViews.try_emplace({row.projectId, row.page});
+    auto& columns = it->second;
+    if (created) {
+        partition.bytes += SERIES_OVERHEAD + row.projectId.size() + row.page.size();
+        bytes_ += SERIES_OVERHEAD + row.projectId.size() + row.page.size();
+    }
+
+    auto [pos, exists] = locate(columns.bucket, bucket);
+    put(columns.bucket, pos, exists, bucket);
+    put(columns.views, pos, exists, row.viewsCount);
+    put(columns.uniqueUsers, pos, exists, row.uniqueUsers);
+    put(columns.uniqueSessions, pos, exists, row.uniqueSessions);
+
+    if (!exists) {
+        ++partition.rows;
+        ++rows_;
+        partition.bytes += PAGE_VIEWS_ROW_BYTES;
+        bytes_ += PAGE_VIEWS_ROW_BYTES;
+    }
+}
+
+void HotWindowCache::insert(const AggregatedPerformance& row) {
+    int64_t bucket = toSeconds(row.timeBucket);
+    auto& partition = partitions_[partitionOf(bucket)];
+
+    auto [it, created] = partition.performance.try_emplace({row.projectId, row.page});
+    auto& columns = it->second;
+    if (created) {
+        partition.bytes += SERIES_OVERHEAD + row.projectId.size() + row.page.size();
+        bytes_ += SERIES_OVERHEAD + row.projectId.size() + row.page.size();
+    }
+
+    auto [pos, exists] = locate(columns.bucket, bucket);
+    size_t oldSketches = exists ? columns.totalLoadSketch[pos].size() + columns.ttfbSketch[pos].size() +
+                                  columns.fcpSketch[pos].size() + columns.lcpSketch[pos].size()
+                                : 0;
+    size_t newSketches = row.totalLoadSketch.size() + row.ttfbSketch.size() +
+                         row.fcpSketch.size() + row.lcpSketch.size();
+
+    put(columns.bucket, pos, exists, bucket);
+    put(columns.samples, pos, exists, row.samplesCount);
+    put(columns.avgTotalLoad, pos, exists, row.avgTotalLoadMs);
+    put(columns.p95TotalLoad, pos, exists, row.p95TotalLoadMs);
+    put(columns.avgTtfb, pos, exists, row.avgTtfbMs);
+    put(columns.p95Ttfb, pos, exists, row.p95TtfbMs);
+    put(columns.avgFcp, pos, exists, row.avgFcpMs);
+    put(columns.p95Fcp, pos, exists, row.p95FcpMs);
+    put(columns.avgLcp, pos, exists, row.avgLcpMs);
+    put(columns.p95Lcp, pos, exists, row.p95LcpMs);
+    put(columns.totalLoadSketch, pos, exists, row.totalLoadSketch);
+    put(columns.ttfbSketch, pos, exists, row.ttfbSketch);
+    put(columns.fcpSketch, pos, exists, row.fcpSketch);
+    put(columns.lcpSketch, pos, exists, row.lcpSketch);
+
+    size_t added = newSketches + (exists ? 0 : PERFORMANCE_ROW_BYTES);
+    partition.bytes = partition.bytes + added - oldSketches;
+    bytes_ = bytes_ + added - oldSketches;
+    if (!exists) {
+        ++partition.rows;
+        ++rows_;
+    }
+}
+
+void HotWindowCache::evict(std::chrono::system_clock::time_point now) {
+    auto cutoff = alignDown(now - config_.window, std::chrono::seconds(PARTITION_SECONDS));
+    while (!partitions_.empty() && partitions_.begin()->first < toSeconds(cutoff)) {
+        dropOldestPartition();
+    }
+    if (coveredFrom_ && *coveredFrom_ < cutoff) {
+        coveredFrom_ = cutoff;
+    }
+
+    while (bytes_ > config_.maxBytes && !partitions_.empty()) {
+        dropOldestPartition();
+    }
+}
+
+void HotWindowCache::dropOldestPartition() {
+    auto it = partitions_.begin();
+    rows_ -= it->second.rows;
+    bytes_ -= it->second.bytes;
+
+    auto end = fromSeconds(it->first + PARTITION_SECONDS);
+    if (coveredFrom_ && *coveredFrom_ < end) {
+        coveredFrom_ = end;
+    }
+    partitions_.erase(it);
+}
+
+void HotWindowCache::clear() {
+    partitions_.clear();
+    coveredFrom_.reset();
+    rows_ = 0;
+    bytes_ = 0;
+}
+
+bool HotWindowCache::covers(std::chrono::system_clock::time_point from) const {
+    // После watermark строк нет ни в кеше, ни в БД, поэтому to не ограничен
+    return coveredFrom_ && from >= *coveredFrom_;
+}
+
+std::optional<std::vector<AggregatedPageViews>> HotWindowCache::readPageViews(
+    const std::string& projectId,
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    const std::string& pageFilter,
+    int limit,
+    int offset
+) {
+    std::vector<AggregatedPageViews> rows;
+    {
+        std::shared_lock lock(mutex_);
+        if (!covers(from)) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        int64_t fromSec = ceilSeconds(from);
+        int64_t toSec = ceilSeconds(to);
+        auto part = partitions_.lower_bound(partitionOf(fromSec));
+        auto end = fromSec < toSec ? partitions_.lower_bound(toSec) : part;
+        for (; part != end; ++part) {
+            forEachSeries(part->second.pageViews, projectId, pageFilter,
+                [&](const SeriesKey& key, const PageViewsColumns& columns) {
+                    auto first = std::lower_bound(columns.bucket.begin(), columns.bucket.end(), fromSec);
+                    auto last = std::lower_bound(first, columns.bucket.end(), toSec);
+                    for (auto i = static_cast<size_t>(first - columns.bucket.begin());
+                         i < static_cast<size_t>(last - columns.bucket.begin()); ++i) {
+                        AggregatedPageViews row;
+                        row.timeBucket = fromSeconds(columns.bucket[i]);
+                        row.projectId = key.first;
+                        row.page = key.second;
+                        row.viewsCount = columns.views[i];
+                        row.uniqueUsers = columns.uniqueUsers[i];
+                        row.uniqueSessions = columns.uniqueSessions[i];
+                        rows.push_back(std::move(row));
+                    }
+                });
+        }
+    }
+
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return paginate(std::move(rows), limit, offset);
+}
+
+std::optional<std::vector<AggregatedPerformance>> HotWindowCache::readPerformance(
+    const std::string& projectId,
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    const std::string& pageFilter,
+    int limit,
+    int offset
+) {
+    std::vector<AggregatedPerformance> rows;
+    {
+        std::shared_lock lock(mutex_);
+        if (!covers(from)) {
+            misses_.fetch_add(1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        int64_t fromSec = ceilSeconds(from);
+        int64_t toSec = ceilSeconds(to);
+        auto part = partitions_.lower_bound(partitionOf(fromSec));
+        auto end = fromSec < toSec ? partitions_.lower_bound(toSec) : part;
+        for (; part != end; ++part) {
+            forEachSeries(part->second.performance, projectId, pageFilter,
+                [&](const SeriesKey& key, const PerformanceColumns& columns) {
+                    auto first = std::lower_bound(columns.bucket.begin(), columns.bucket.end(), fromSec);
+                    auto last = std::lower_bound(first, columns.bucket.end(), toSec);
+                    for (auto i = static_cast<size_t>(first - columns.bucket.begin());
+                         i < static_cast<size_t>(last - columns.bucket.begin()); ++i) {
+                        AggregatedPerformance row;
+                        row.timeBucket = fromSeconds(columns.bucket[i]);
+                        row.projectId = key.first;
+                        row.page = key.second;
+                        row.samplesCount = columns.samples[i];
+                        row.avgTotalLoadMs = columns.avgTotalLoad[i];
+                        row.p95TotalLoadMs = columns.p95TotalLoad[i];
+                        row.avgTtfbMs = columns.avgTtfb[i];
+                        row.p95TtfbMs = columns.p95Ttfb[i];
+                        row.avgFcpMs = columns.avgFcp[i];
+                        row.p95FcpMs = columns.p95Fcp[i];
+                        row.avgLcpMs = columns.avgLcp[i];
+                        row.p95LcpMs = columns.p95Lcp[i];
+                        row.totalLoadSketch = columns.totalLoadSketch[i];
+                        row.ttfbSketch = columns.ttfbSketch[i];
+                        row.fcpSketch = columns.fcpSketch[i];
+                        row.lcpSketch = columns.lcpSketch[i];
+                        rows.push_back(std::move(row));
+                    }
+                });
+        }
+    }
+
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return paginate(std::move(rows), limit, offset);
+}
+
+HotWindowCache::Stats HotWindowCache::stats() const {
+    Stats result;
+    result.hits = hits_.load(std::memory_order_relaxed);
+    result.misses = misses_.load(std::memory_order_relaxed);
+
+    std::shared_lock lock(mutex_);
+    result.rows = rows_;
+    result.bytes = bytes_;
+    result.partitions = partitions_.size();
+    return result;
+}
+
+std::string HotWindowCache::formatMetrics() const {
+    auto s = stats();
+
+    std::ostringstream out;
+    auto metric = [&out](const char* name, const char* type, const char* help, auto value) {
+        out << "# HELP " << name << " " << help << "\n"
+            << "# TYPE " << name << " " << type << "\n"
+            << name << " " << value << "\n";
+    };
+
+    metric("aggregation_hot_window_hits_total", "counter", "Reads served from the hot window", s.hits);
+    metric("aggregation_hot_window_misses_total", "counter", "Reads outside the hot window", s.misses);
+    metric("aggregation_hot_window_rows", "gauge", "Buckets held in the hot window", s.rows);
+    metric("aggregation_hot_window_bytes", "gauge", "Estimated memory used by the hot window", s.bytes);
+    metric("aggregation_hot_window_partitions", "gauge", "Hourly partitions held", s.partitions);
+    return out.str();
+}
+
+} // namespace aggregation
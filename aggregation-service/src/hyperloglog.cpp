@@ -0,0 +1,185 @@
+#include "hyperloglog.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+namespace aggregation {
+
+namespace {
+
+constexpr uint64_t HASH_SEED = 0x9e3779b97f4a7c15ULL;
+
+} // namespace
+
+// MurmurHash64A. Скетчи хранятся в БД, поэтому хеш не должен зависеть
+// от платформы и стандартной библиотеки (std::hash не подходит).
+uint64_t HyperLogLog::hash(std::string_view value) {
+    constexpr uint64_t m = 0xc6a4a7935bd1e995ULL;
+    constexpr int r = 47;
+
+    const auto* data = reinterpret_cast<const unsigned char*>(value.data());
+    const size_t len = value.size();
+    uint64_t h = HASH_SEED ^ (static_cast<uint64_t>(len) * m);
+
+    const size_t blocks = len / 8;
+    for (size_t i = 0; i < blocks; ++i) {
+        uint64_t k = 0;
+        for (int b = 7; b >= 0; --b) {
+            k = (k << 8) | data[i * 8 + b];
+        }
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+
+    const unsigned char* tail = data + blocks * 8;
+    switch (len & 7) {
+        case 7: h ^= static_cast<uint64_t>(tail[6]) << 48; [[fallthrough]];
+        case 6: h ^= static_cast<uint64_t>(tail[5]) << 40; [[fallthrough]];
+        case 5: h ^= static_cast<uint64_t>(tail[4]) << 32; [[fallthrough]];
+        case 4: h ^= static_cast<uint64_t>(tail[3]) << 24; [[fallthrough]];
+        case 3: h ^= static_cast<uint64_t>(tail[2]) << 16; [[fallthrough]];
+        case 2: h ^= static_cast<uint64_t>(tail[1]) << 8; [[fallthrough]];
+        case 1:
+            h ^= static_cast<uint64_t>(tail[0]);
+            h *= m;
+    }
+
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
+
+void HyperLogLog::add(std::string_view value) {
+    addHash(hash(value));
+}
+
+void HyperLogLog::addHash(uint64_t hash) {
+    if (isSparse()) {
+        insertSparse(hash);
+    } else {
+        setRegister(hash);
+    }
+}
+
+void HyperLogLog::insertSparse(uint64_t hash) {
+    auto it = std::lower_bound(sparse_.begin(), sparse_.end(), hash);
+    if (it != sparse_.end() && *it == hash) return;
+    sparse_.insert(it, hash);
+    if (sparse_.size() >= PROMOTE_THRESHOLD) promote();
+}
+
+void HyperLogLog::setRegister(uint64_t hash) {
+    // Старшие PRECISION бит — номер регистра, в регистр пишется позиция
+    // первой единицы в оставшихся битах
+    const size_t index = hash >> (64 - PRECISION);
+    const uint64_t rest = hash << PRECISION;
+    const uint8_t rank = rest == 0
+        ? static_cast<uint8_t>(64 - PRECISION + 1)
+        : static_cast<uint8_t>(std::countl_zero(rest) + 1);
+    registers_[index] = std::max(registers_[index], rank);
+}
+
+void HyperLogLog::promote() {
+    registers_.assign(REGISTERS, 0);
+    for (uint64_t h : sparse_) {
+        setRegister(h);
+    }
+    sparse_.clear();
+    sparse_.shrink_to_fit();
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+    if (other.isSparse()) {
+        for (uint64_t h : other.sparse_) {
+            addHash(h);
+        }
+        return;
+    }
+
+    if (isSparse()) promote();
+    for (size_t i = 0; i < REGISTERS; ++i) {
+        registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+}
+
+// Сырая оценка HLL с поправкой linear counting для малых кардинальностей
+int64_t HyperLogLog::estimate() const {
+    if (isSparse()) return static_cast<int64_t>(sparse_.size());
+
+    const double m = static_cast<double>(REGISTERS);
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (uint8_t reg : registers_) {
+        sum += std::ldexp(1.0, -static_cast<int>(reg));
+        if (reg == 0) ++zeros;
+    }
+
+    const double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && zeros > 0) {
+        estimate = m * std::log(m / static_cast<double>(zeros));
+    }
+    return std::llround(estimate);
+}
+
+std::string HyperLogLog::serialize() const {
+    if (isSparse()) {
+        std::string bytes(1 + sparse_.size() * sizeof(uint64_t), '\0');
+        bytes[0] = static_cast<char>(SPARSE_TAG);
+        for (size_t i = 0; i < sparse_.size(); ++i) {
+            for (size_t b = 0; b < sizeof(uint64_t); ++b) {
+                bytes[1 + i * sizeof(uint64_t) + b] = static_cast<char>(sparse_[i] >> (56 - 8 * b));
+            }
+        }
+        return bytes;
+    }
+
+    std::string bytes(SERIALIZED_SIZE, '\0');
+    bytes[0] = static_cast<char>(PRECISION);
+    std::copy(registers_.begin(), registers_.end(), bytes.begin() + 1);
+    return bytes;
+}
+
+HyperLogLog HyperLogLog::deserialize(std::string_view bytes) {
+    if (!bytes.empty() && static_cast<uint8_t>(bytes[0]) == SPARSE_TAG) {
+        const size_t count = (bytes.size() - 1) / sizeof(uint64_t);
+        if ((bytes.size() - 1) % sizeof(uint64_t) != 0 || count >= PROMOTE_THRESHOLD) {
+            throw std::invalid_argument("HyperLogLog: unexpected sparse sketch size " +
+                                        std::to_string(bytes.size()));
+        }
+
+        HyperLogLog sketch;
+        sketch.sparse_.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            uint64_t hash = 0;
+            for (size_t b = 0; b < sizeof(uint64_t); ++b) {
+                hash = (hash << 8) | static_cast<uint8_t>(bytes[1 + i * sizeof(uint64_t) + b]);
+            }
+            if (!sketch.sparse_.empty() && hash <= sketch.sparse_.back()) {
+                throw std::invalid_argument("HyperLogLog: sparse hashes are not strictly ascending");
+            }
+            sketch.sparse_.push_back(hash);
+        }
+        return sketch;
+    }
+
+    if (bytes.size() != SERIALIZED_SIZE) {
+        throw std::invalid_argument("HyperLogLog: unexpected sketch size " + std::to_string(bytes.size()));
+    }
+    if (static_cast<uint8_t>(bytes[0]) != PRECISION) {
+        throw std::invalid_argument("HyperLogLog: unsupported precision " +
+                                    std::to_string(static_cast<uint8_t>(bytes[0])));
+    }
+
+    HyperLogLog sketch;
+    sketch.registers_.assign(bytes.begin() + 1, bytes.end());
+    return sketch;
+}
+
+} // namespace aggregation
@@ -2,12 +2,17 @@
 #include <cstdlib>
 #include <string>
 #include <thread>
+#include <chrono>
 #include <atomic>
 #include <csignal>
+#include <algorithm>
+#include <memory>
 
 #include "aggregator.h"
 #include "database.h"
+#include "database_pool.h"
 #include "handlers.h"
+#include "hot_window.h"
 #include "metrics_client.h"
 #include "aggregation_server.h"
 
@@ -54,31 +59,52 @@ int main() {
 
     std::string connectionString = BuildPostrgresConnectionString();
 
-    aggregation::Database database;
-    if (!database.connect(connectionString)) {
+    // Агрегатор пишет через своё соединение, gRPC читает из пула: соединение
+    // libpq не разделяется между потоками. По умолчанию читателей столько же, сколько ядер
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    size_t readPoolSize = std::stoul(GetEnvVar("AGG_DB_READ_POOL_SIZE", std::to_string(cores)));
+    std::cout << "Database read pool size: " << readPoolSize << std::endl;
+
+    aggregation::DatabasePool writer("writer", 1);
+    aggregation::DatabasePool readers("reader", readPoolSize);
+    if (!writer.connect(connectionString) || !readers.connect(connectionString)) {
         std::cerr << "Failed to connect to the database. Exiting." << std::endl;
         return 1;
     }
 
-    if (!database.initializeSchema()) {
+    if (!writer.acquire()->initializeSchema()) {
         std::cerr << "Failed to initialize database schema. Exiting." << std::endl;
         return 1;
     }
 
-    // HTTP сервер для health checks
+    // Последние часы агрегатов в памяти для чтения page views и performance
+    // без БД; AGG_HOT_WINDOW_HOURS=0 отключает кеш
+    int hotWindowHours = std::stoi(GetEnvVar("AGG_HOT_WINDOW_HOURS", "24"));
+    size_t hotWindowMaxMb = std::stoul(GetEnvVar("AGG_HOT_WINDOW_MAX_MB", "256"));
+    std::unique_ptr<aggregation::HotWindowCache> hotWindow;
+    if (hotWindowHours > 0) {
+        hotWindow = std::make_unique<aggregation::HotWindowCache>(aggregation::HotWindowCache::Config{
+            std::chrono::hours(hotWindowHours), hotWindowMaxMb << 20});
+        std::cout << "Hot window: " << hotWindowHours << " h, up to " << hotWindowMaxMb << " MiB" << std::endl;
+    }
+
+    // HTTP сервер для health checks и метрик пулов
     const char* http_port_env = std::getenv("AGG_HTTP_PORT");
     int http_port = http_port_env ? std::stoi(http_port_env) : 8080;
     HttpHandler http_handler(http_port);
-    http_handler.start();
 
     // gRPC подключение к metrics-service
     std::string metricsHost = GetEnvVar("METRICS_GRPC_HOST", "localhost");
     std::string metricsPort = GetEnvVar("METRICS_GRPC_PORT", "50051");
+    int fetchChunkSize = std::stoi(GetEnvVar("METRICS_FETCH_CHUNK_SIZE",
+        std::to_string(aggregation::MetricsClient::DEFAULT_CHUNK_SIZE)));
+    std::chrono::milliseconds fetchTimeout(std::stoi(GetEnvVar("METRICS_FETCH_TIMEOUT_MS",
+        std::to_string(aggregation::MetricsClient::DEFAULT_CALL_TIMEOUT.count()))));
 
     std::cout << "Connecting to metrics-service via gRPC at "
               << metricsHost << ":" << metricsPort << std::endl;
 
-    aggregation::MetricsClient metricsClient(metricsHost, metricsPort);
+    aggregation::MetricsClient metricsClient(metricsHost, metricsPort, fetchChunkSize, fetchTimeout);
 
     if (metricsClient.isConnected()) {
         std::cout << "MetricsClient: gRPC channel is ready" << std::endl;
@@ -87,14 +113,32 @@ int main() {
     }
 
     // Создаем агрегатор
-    aggregation::Aggregator aggregator(database, metricsClient);
+    std::chrono::seconds fetchLag(std::stoi(GetEnvVar("AGG_FETCH_LAG_SEC",
+        std::to_string(aggregation::Aggregator::DEFAULT_FETCH_LAG.count()))));
+    // Насколько событие может опоздать к своему бакету, чтобы бакет ещё досчитали;
+    // более поздние события сохраняются в late_events
+    std::chrono::seconds allowedLateness(std::stoi(GetEnvVar("AGG_ALLOWED_LATENESS_SEC",
+        std::to_string(aggregation::Aggregator::DEFAULT_ALLOWED_LATENESS.count()))));
+    std::cout << "Allowed lateness: " << allowedLateness.count() << " seconds" << std::endl;
+    size_t maxSymbols = std::stoull(GetEnvVar("AGG_MAX_SYMBOLS",
+        std::to_string(aggregation::Aggregator::DEFAULT_MAX_SYMBOLS)));
+    aggregation::Aggregator aggregator(writer, metricsClient, fetchLag, allowedLateness, maxSymbols);
+    aggregator.setHotWindow(hotWindow.get());
+
+    http_handler.setMetricsHandler([&writer, &readers, &hotWindow, &aggregator]() {
+        auto metrics = aggregation::formatPoolMetrics({writer.stats(), readers.stats()});
+        if (hotWindow) metrics += hotWindow->formatMetrics();
+        metrics += aggregator.formatMetrics();
+        return metrics;
+    });
+    http_handler.start();
 
     // Запускаем gRPC сервер для предоставления агрегированных данных
     std::string grpcHost = GetEnvVar("AGG_GRPC_HOST", "0.0.0.0");
     std::string grpcPort = GetEnvVar("AGG_GRPC_PORT", "50052");
     std::string grpcAddress = grpcHost + ":" + grpcPort;
 
-    aggregation::AggregationGrpcServer grpcServer(database, grpcAddress);
+    aggregation::AggregationGrpcServer grpcServer(readers, grpcAddress, hotWindow.get());
 
     std::thread grpcThread([&grpcServer]() {
         grpcServer.start();
@@ -144,8 +188,9 @@ int main() {
     std::cout << "Stopping HTTP server..." << std::endl;
     http_handler.stop();
     
-    std::cout << "Closing database connection..." << std::endl;
-    database.disconnect();
+    std::cout << "Closing database connections..." << std::endl;
+    readers.disconnect();
+    writer.disconnect();
 
     std::cout << "Aggregation Service stopped successfully" << std::endl;
     return 0;
@@ -27,6 +27,11 @@ static const char* MetricsService_method_names[] = {
   "/metricsys.MetricsService/GetPerformance",
   "/metricsys.MetricsService/GetErrors",
   "/metricsys.MetricsService/GetCustomEvents",
+  "/metricsys.MetricsService/StreamPageViews",
+  "/metricsys.MetricsService/StreamClicks",
+  "/metricsys.MetricsService/StreamPerformance",
+  "/metricsys.MetricsService/StreamErrors",
+  "/metricsys.MetricsService/StreamCustomEvents",
 };
 
 std::unique_ptr< MetricsService::Stub> MetricsService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -41,6 +46,11 @@ MetricsService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& cha
   , rpcmethod_GetPerformance_(MetricsService_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetErrors_(MetricsService_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetCustomEvents_(MetricsService_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_StreamPageViews_(MetricsService_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_StreamClicks_(MetricsService_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_StreamPerformance_(MetricsService_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_StreamErrors_(MetricsService_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_StreamCustomEvents_(MetricsService_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   {}
 
 ::grpc::Status MetricsService::Stub::GetPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::metricsys::GetPageViewsResponse* response) {
@@ -158,6 +168,86 @@ void MetricsService::Stub::async::GetCustomEvents(::grpc::ClientContext* context
   return result;
 }
 
+::grpc::ClientReader< ::metricsys::GetPageViewsResponse>* MetricsService::Stub::StreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::metricsys::GetPageViewsResponse>::Create(channel_.get(), rpcmethod_StreamPageViews_, context, request);
+}
+
+void MetricsService::Stub::async::StreamPageViews(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetPageViewsResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::metricsys::GetPageViewsResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamPageViews_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetPageViewsResponse>* MetricsService::Stub::AsyncStreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetPageViewsResponse>::Create(channel_.get(), cq, rpcmethod_StreamPageViews_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetPageViewsResponse>* MetricsService::Stub::PrepareAsyncStreamPageViewsRaw(::grpc::ClientContext* context, const ::metricsys::GetPageViewsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetPageViewsResponse>::Create(channel_.get(), cq, rpcmethod_StreamPageViews_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::metricsys::GetClicksResponse>* MetricsService::Stub::StreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::metricsys::GetClicksResponse>::Create(channel_.get(), rpcmethod_StreamClicks_, context, request);
+}
+
+void MetricsService::Stub::async::StreamClicks(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetClicksResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::metricsys::GetClicksResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamClicks_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetClicksResponse>* MetricsService::Stub::AsyncStreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetClicksResponse>::Create(channel_.get(), cq, rpcmethod_StreamClicks_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetClicksResponse>* MetricsService::Stub::PrepareAsyncStreamClicksRaw(::grpc::ClientContext* context, const ::metricsys::GetClicksRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetClicksResponse>::Create(channel_.get(), cq, rpcmethod_StreamClicks_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::metricsys::GetPerformanceResponse>* MetricsService::Stub::StreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::metricsys::GetPerformanceResponse>::Create(channel_.get(), rpcmethod_StreamPerformance_, context, request);
+}
+
+void MetricsService::Stub::async::StreamPerformance(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetPerformanceResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::metricsys::GetPerformanceResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamPerformance_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetPerformanceResponse>* MetricsService::Stub::AsyncStreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetPerformanceResponse>::Create(channel_.get(), cq, rpcmethod_StreamPerformance_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetPerformanceResponse>* MetricsService::Stub::PrepareAsyncStreamPerformanceRaw(::grpc::ClientContext* context, const ::metricsys::GetPerformanceRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetPerformanceResponse>::Create(channel_.get(), cq, rpcmethod_StreamPerformance_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::metricsys::GetErrorsResponse>* MetricsService::Stub::StreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::metricsys::GetErrorsResponse>::Create(channel_.get(), rpcmethod_StreamErrors_, context, request);
+}
+
+void MetricsService::Stub::async::StreamErrors(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetErrorsResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::metricsys::GetErrorsResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamErrors_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetErrorsResponse>* MetricsService::Stub::AsyncStreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetErrorsResponse>::Create(channel_.get(), cq, rpcmethod_StreamErrors_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetErrorsResponse>* MetricsService::Stub::PrepareAsyncStreamErrorsRaw(::grpc::ClientContext* context, const ::metricsys::GetErrorsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetErrorsResponse>::Create(channel_.get(), cq, rpcmethod_StreamErrors_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::metricsys::GetCustomEventsResponse>* MetricsService::Stub::StreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::metricsys::GetCustomEventsResponse>::Create(channel_.get(), rpcmethod_StreamCustomEvents_, context, request);
+}
+
+void MetricsService::Stub::async::StreamCustomEvents(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest* request, ::grpc::ClientReadReactor< ::metricsys::GetCustomEventsResponse>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::metricsys::GetCustomEventsResponse>::Create(stub_->channel_.get(), stub_->rpcmethod_StreamCustomEvents_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetCustomEventsResponse>* MetricsService::Stub::AsyncStreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetCustomEventsResponse>::Create(channel_.get(), cq, rpcmethod_StreamCustomEvents_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::metricsys::GetCustomEventsResponse>* MetricsService::Stub::PrepareAsyncStreamCustomEventsRaw(::grpc::ClientContext* context, const ::metricsys::GetCustomEventsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::metricsys::GetCustomEventsResponse>::Create(channel_.get(), cq, rpcmethod_StreamCustomEvents_, context, request, false, nullptr);
+}
+
 MetricsService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       MetricsService_method_names[0],
@@ -209,6 +299,56 @@ MetricsService::Service::Service() {
              ::metricsys::GetCustomEventsResponse* resp) {
                return service->GetCustomEvents(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MetricsService_method_names[5],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< MetricsService::Service, ::metricsys::GetPageViewsRequest, ::metricsys::GetPageViewsResponse>(
+          [](MetricsService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::metricsys::GetPageViewsRequest* req,
+             ::grpc::ServerWriter<::metricsys::GetPageViewsResponse>* writer) {
+               return service->StreamPageViews(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MetricsService_method_names[6],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< MetricsService::Service, ::metricsys::GetClicksRequest, ::metricsys::GetClicksResponse>(
+          [](MetricsService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::metricsys::GetClicksRequest* req,
+             ::grpc::ServerWriter<::metricsys::GetClicksResponse>* writer) {
+               return service->StreamClicks(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MetricsService_method_names[7],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< MetricsService::Service, ::metricsys::GetPerformanceRequest, ::metricsys::GetPerformanceResponse>(
+          [](MetricsService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::metricsys::GetPerformanceRequest* req,
+             ::grpc::ServerWriter<::metricsys::GetPerformanceResponse>* writer) {
+               return service->StreamPerformance(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MetricsService_method_names[8],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< MetricsService::Service, ::metricsys::GetErrorsRequest, ::metricsys::GetErrorsResponse>(
+          [](MetricsService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::metricsys::GetErrorsRequest* req,
+             ::grpc::ServerWriter<::metricsys::GetErrorsResponse>* writer) {
+               return service->StreamErrors(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      MetricsService_method_names[9],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< MetricsService::Service, ::metricsys::GetCustomEventsRequest, ::metricsys::GetCustomEventsResponse>(
+          [](MetricsService::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::metricsys::GetCustomEventsRequest* req,
+             ::grpc::ServerWriter<::metricsys::GetCustomEventsResponse>* writer) {
+               return service->StreamCustomEvents(ctx, req, writer);
+             }, this)));
 }
 
 MetricsService::Service::~Service() {
@@ -249,6 +389,41 @@ MetricsService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status MetricsService::Service::StreamPageViews(::grpc::ServerContext* context, const ::metricsys::GetPageViewsRequest* request, ::grpc::ServerWriter< ::metricsys::GetPageViewsResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MetricsService::Service::StreamClicks(::grpc::ServerContext* context, const ::metricsys::GetClicksRequest* request, ::grpc::ServerWriter< ::metricsys::GetClicksResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MetricsService::Service::StreamPerformance(::grpc::ServerContext* context, const ::metricsys::GetPerformanceRequest* request, ::grpc::ServerWriter< ::metricsys::GetPerformanceResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MetricsService::Service::StreamErrors(::grpc::ServerContext* context, const ::metricsys::GetErrorsRequest* request, ::grpc::ServerWriter< ::metricsys::GetErrorsResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status MetricsService::Service::StreamCustomEvents(::grpc::ServerContext* context, const ::metricsys::GetCustomEventsRequest* request, ::grpc::ServerWriter< ::metricsys::GetCustomEventsResponse>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace metricsys
 
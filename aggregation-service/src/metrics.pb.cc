@@ -49,6 +49,20 @@ struct PaginationDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PaginationDefaultTypeInternal _Pagination_default_instance_;
+PROTOBUF_CONSTEXPR EventCursor::EventCursor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_us_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EventCursorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EventCursorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EventCursorDefaultTypeInternal() {}
+  union {
+    EventCursor _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EventCursorDefaultTypeInternal _EventCursor_default_instance_;
 PROTOBUF_CONSTEXPR PageViewEvent::PageViewEvent(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_._has_bits_)*/{}
@@ -58,7 +72,8 @@ PROTOBUF_CONSTEXPR PageViewEvent::PageViewEvent(
   , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.referrer_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.timestamp_)*/int64_t{0}} {}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}} {}
 struct PageViewEventDefaultTypeInternal {
   PROTOBUF_CONSTEXPR PageViewEventDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -75,7 +90,10 @@ PROTOBUF_CONSTEXPR GetPageViewsRequest::GetPageViewsRequest(
   , /*decltype(_impl_.page_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.allow_segments_)*/false} {}
 struct GetPageViewsRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetPageViewsRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -87,9 +105,12 @@ struct GetPageViewsRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetPageViewsRequestDefaultTypeInternal _GetPageViewsRequest_default_instance_;
 PROTOBUF_CONSTEXPR GetPageViewsResponse::GetPageViewsResponse(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.events_)*/{}
-  , /*decltype(_impl_.total_count_)*/0
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
 struct GetPageViewsResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetPageViewsResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -109,7 +130,8 @@ PROTOBUF_CONSTEXPR ClickEvent::ClickEvent(
   , /*decltype(_impl_.action_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.timestamp_)*/int64_t{0}} {}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}} {}
 struct ClickEventDefaultTypeInternal {
   PROTOBUF_CONSTEXPR ClickEventDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -127,7 +149,10 @@ PROTOBUF_CONSTEXPR GetClicksRequest::GetClicksRequest(
   , /*decltype(_impl_.element_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.allow_segments_)*/false} {}
 struct GetClicksRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetClicksRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -139,9 +164,12 @@ struct GetClicksRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetClicksRequestDefaultTypeInternal _GetClicksRequest_default_instance_;
 PROTOBUF_CONSTEXPR GetClicksResponse::GetClicksResponse(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.events_)*/{}
-  , /*decltype(_impl_.total_count_)*/0
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
 struct GetClicksResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetClicksResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -163,7 +191,8 @@ PROTOBUF_CONSTEXPR PerformanceEvent::PerformanceEvent(
   , /*decltype(_impl_.fcp_ms_)*/0
   , /*decltype(_impl_.lcp_ms_)*/0
   , /*decltype(_impl_.total_page_load_ms_)*/0
-  , /*decltype(_impl_.timestamp_)*/int64_t{0}} {}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}} {}
 struct PerformanceEventDefaultTypeInternal {
   PROTOBUF_CONSTEXPR PerformanceEventDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -180,7 +209,10 @@ PROTOBUF_CONSTEXPR GetPerformanceRequest::GetPerformanceRequest(
   , /*decltype(_impl_.page_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.allow_segments_)*/false} {}
 struct GetPerformanceRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetPerformanceRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -192,9 +224,12 @@ struct GetPerformanceRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetPerformanceRequestDefaultTypeInternal _GetPerformanceRequest_default_instance_;
 PROTOBUF_CONSTEXPR GetPerformanceResponse::GetPerformanceResponse(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.events_)*/{}
-  , /*decltype(_impl_.total_count_)*/0
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
 struct GetPerformanceResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetPerformanceResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -216,6 +251,7 @@ PROTOBUF_CONSTEXPR ErrorEvent::ErrorEvent(
   , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}
   , /*decltype(_impl_.severity_)*/0} {}
 struct ErrorEventDefaultTypeInternal {
   PROTOBUF_CONSTEXPR ErrorEventDefaultTypeInternal()
@@ -235,7 +271,10 @@ PROTOBUF_CONSTEXPR GetErrorsRequest::GetErrorsRequest(
   , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
   , /*decltype(_impl_.pagination_)*/nullptr
-  , /*decltype(_impl_.severity_filter_)*/0} {}
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.severity_filter_)*/0
+  , /*decltype(_impl_.allow_segments_)*/false} {}
 struct GetErrorsRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetErrorsRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -247,9 +286,12 @@ struct GetErrorsRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetErrorsRequestDefaultTypeInternal _GetErrorsRequest_default_instance_;
 PROTOBUF_CONSTEXPR GetErrorsResponse::GetErrorsResponse(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.events_)*/{}
-  , /*decltype(_impl_.total_count_)*/0
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
 struct GetErrorsResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetErrorsResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -280,7 +322,8 @@ PROTOBUF_CONSTEXPR CustomEvent::CustomEvent(
   , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.timestamp_)*/int64_t{0}} {}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}} {}
 struct CustomEventDefaultTypeInternal {
   PROTOBUF_CONSTEXPR CustomEventDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -298,7 +341,10 @@ PROTOBUF_CONSTEXPR GetCustomEventsRequest::GetCustomEventsRequest(
   , /*decltype(_impl_.page_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.time_range_)*/nullptr
-  , /*decltype(_impl_.pagination_)*/nullptr} {}
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.allow_segments_)*/false} {}
 struct GetCustomEventsRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetCustomEventsRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -310,9 +356,12 @@ struct GetCustomEventsRequestDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetCustomEventsRequestDefaultTypeInternal _GetCustomEventsRequest_default_instance_;
 PROTOBUF_CONSTEXPR GetCustomEventsResponse::GetCustomEventsResponse(
     ::_pbi::ConstantInitialized): _impl_{
-    /*decltype(_impl_.events_)*/{}
-  , /*decltype(_impl_.total_count_)*/0
-  , /*decltype(_impl_._cached_size_)*/{}} {}
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
 struct GetCustomEventsResponseDefaultTypeInternal {
   PROTOBUF_CONSTEXPR GetCustomEventsResponseDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -323,7 +372,7 @@ struct GetCustomEventsResponseDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetCustomEventsResponseDefaultTypeInternal _GetCustomEventsResponse_default_instance_;
 }  // namespace metricsys
-static ::_pb::Metadata file_level_metadata_metrics_2eproto[18];
+static ::_pb::Metadata file_level_metadata_metrics_2eproto[19];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_metrics_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_metrics_2eproto = nullptr;
 
@@ -344,6 +393,14 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::metricsys::Pagination, _impl_.limit_),
   PROTOBUF_FIELD_OFFSET(::metricsys::Pagination, _impl_.offset_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::metricsys::EventCursor, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::EventCursor, _impl_.timestamp_us_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::EventCursor, _impl_.id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -356,12 +413,14 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.session_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.referrer_),
   PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.received_at_),
   ~0u,
   ~0u,
   0,
   1,
   2,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -372,11 +431,17 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.pagination_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.page_filter_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.allow_segments_),
   2,
   3,
   0,
   1,
-  ~0u,  // no _has_bits_
+  4,
+  5,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -384,6 +449,12 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_.events_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
   PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -397,6 +468,7 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.user_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.session_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.received_at_),
   ~0u,
   ~0u,
   ~0u,
@@ -404,6 +476,7 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   1,
   2,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -415,12 +488,18 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.page_filter_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.element_id_filter_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.allow_segments_),
   3,
   4,
   0,
   1,
   2,
-  ~0u,  // no _has_bits_
+  5,
+  6,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -428,6 +507,12 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_.events_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
   PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -443,6 +528,7 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.user_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.session_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.received_at_),
   ~0u,
   ~0u,
   2,
@@ -452,6 +538,7 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   0,
   1,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -462,11 +549,17 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.pagination_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.page_filter_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.allow_segments_),
   2,
   3,
   0,
   1,
-  ~0u,  // no _has_bits_
+  4,
+  5,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -474,6 +567,12 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_.events_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
   PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -489,6 +588,7 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.user_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.session_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.received_at_),
   ~0u,
   ~0u,
   ~0u,
@@ -498,6 +598,7 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   1,
   2,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -510,13 +611,19 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.severity_filter_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.error_type_filter_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.allow_segments_),
   3,
   4,
   0,
-  5,
+  7,
   1,
   2,
-  ~0u,  // no _has_bits_
+  5,
+  6,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -524,6 +631,12 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_.events_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
   PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent_PropertiesEntry_DoNotUse, _has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent_PropertiesEntry_DoNotUse, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -547,6 +660,7 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.session_id_),
   PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.properties_),
   PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.received_at_),
   ~0u,
   ~0u,
   0,
@@ -554,6 +668,7 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   2,
   ~0u,
   ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -565,12 +680,18 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.name_filter_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.page_filter_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.allow_segments_),
   3,
   4,
   0,
   1,
   2,
-  ~0u,  // no _has_bits_
+  5,
+  6,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -578,31 +699,39 @@ const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_.events_),
   PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::metricsys::TimeRange)},
   { 8, -1, -1, sizeof(::metricsys::Pagination)},
-  { 16, 28, -1, sizeof(::metricsys::PageViewEvent)},
-  { 34, 44, -1, sizeof(::metricsys::GetPageViewsRequest)},
-  { 48, -1, -1, sizeof(::metricsys::GetPageViewsResponse)},
-  { 56, 69, -1, sizeof(::metricsys::ClickEvent)},
-  { 76, 87, -1, sizeof(::metricsys::GetClicksRequest)},
-  { 92, -1, -1, sizeof(::metricsys::GetClicksResponse)},
-  { 100, 115, -1, sizeof(::metricsys::PerformanceEvent)},
-  { 124, 134, -1, sizeof(::metricsys::GetPerformanceRequest)},
-  { 138, -1, -1, sizeof(::metricsys::GetPerformanceResponse)},
-  { 146, 161, -1, sizeof(::metricsys::ErrorEvent)},
-  { 170, 182, -1, sizeof(::metricsys::GetErrorsRequest)},
-  { 188, -1, -1, sizeof(::metricsys::GetErrorsResponse)},
-  { 196, 204, -1, sizeof(::metricsys::CustomEvent_PropertiesEntry_DoNotUse)},
-  { 206, 219, -1, sizeof(::metricsys::CustomEvent)},
-  { 226, 237, -1, sizeof(::metricsys::GetCustomEventsRequest)},
-  { 242, -1, -1, sizeof(::metricsys::GetCustomEventsResponse)},
+  { 16, -1, -1, sizeof(::metricsys::EventCursor)},
+  { 24, 37, -1, sizeof(::metricsys::PageViewEvent)},
+  { 44, 57, -1, sizeof(::metricsys::GetPageViewsRequest)},
+  { 64, 74, -1, sizeof(::metricsys::GetPageViewsResponse)},
+  { 78, 92, -1, sizeof(::metricsys::ClickEvent)},
+  { 100, 114, -1, sizeof(::metricsys::GetClicksRequest)},
+  { 122, 132, -1, sizeof(::metricsys::GetClicksResponse)},
+  { 136, 152, -1, sizeof(::metricsys::PerformanceEvent)},
+  { 162, 175, -1, sizeof(::metricsys::GetPerformanceRequest)},
+  { 182, 192, -1, sizeof(::metricsys::GetPerformanceResponse)},
+  { 196, 212, -1, sizeof(::metricsys::ErrorEvent)},
+  { 222, 237, -1, sizeof(::metricsys::GetErrorsRequest)},
+  { 246, 256, -1, sizeof(::metricsys::GetErrorsResponse)},
+  { 260, 268, -1, sizeof(::metricsys::CustomEvent_PropertiesEntry_DoNotUse)},
+  { 270, 284, -1, sizeof(::metricsys::CustomEvent)},
+  { 292, 306, -1, sizeof(::metricsys::GetCustomEventsRequest)},
+  { 314, 324, -1, sizeof(::metricsys::GetCustomEventsResponse)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::metricsys::_TimeRange_default_instance_._instance,
   &::metricsys::_Pagination_default_instance_._instance,
+  &::metricsys::_EventCursor_default_instance_._instance,
   &::metricsys::_PageViewEvent_default_instance_._instance,
   &::metricsys::_GetPageViewsRequest_default_instance_._instance,
   &::metricsys::_GetPageViewsResponse_default_instance_._instance,
@@ -625,101 +754,149 @@ const char descriptor_table_protodef_metrics_2eproto[] PROTOBUF_SECTION_VARIABLE
   "\n\rmetrics.proto\022\tmetricsys\";\n\tTimeRange\022"
   "\027\n\017start_timestamp\030\001 \001(\003\022\025\n\rend_timestam"
   "p\030\002 \001(\003\"+\n\nPagination\022\r\n\005limit\030\001 \001(\005\022\016\n\006"
-  "offset\030\002 \001(\005\"\252\001\n\rPageViewEvent\022\n\n\002id\030\001 \001"
-  "(\t\022\014\n\004page\030\002 \001(\t\022\024\n\007user_id\030\003 \001(\tH\000\210\001\001\022\027"
-  "\n\nsession_id\030\004 \001(\tH\001\210\001\001\022\025\n\010referrer\030\005 \001("
-  "\tH\002\210\001\001\022\021\n\ttimestamp\030\006 \001(\003B\n\n\010_user_idB\r\n"
-  "\013_session_idB\013\n\t_referrer\"\354\001\n\023GetPageVie"
-  "wsRequest\022-\n\ntime_range\030\001 \001(\0132\024.metricsy"
-  "s.TimeRangeH\000\210\001\001\022.\n\npagination\030\002 \001(\0132\025.m"
-  "etricsys.PaginationH\001\210\001\001\022\030\n\013page_filter\030"
-  "\003 \001(\tH\002\210\001\001\022\033\n\016user_id_filter\030\004 \001(\tH\003\210\001\001B"
-  "\r\n\013_time_rangeB\r\n\013_paginationB\016\n\014_page_f"
-  "ilterB\021\n\017_user_id_filter\"U\n\024GetPageViews"
-  "Response\022(\n\006events\030\001 \003(\0132\030.metricsys.Pag"
-  "eViewEvent\022\023\n\013total_count\030\002 \001(\005\"\267\001\n\nClic"
-  "kEvent\022\n\n\002id\030\001 \001(\t\022\014\n\004page\030\002 \001(\t\022\022\n\nelem"
-  "ent_id\030\003 \001(\t\022\023\n\006action\030\004 \001(\tH\000\210\001\001\022\024\n\007use"
-  "r_id\030\005 \001(\tH\001\210\001\001\022\027\n\nsession_id\030\006 \001(\tH\002\210\001\001"
-  "\022\021\n\ttimestamp\030\007 \001(\003B\t\n\007_actionB\n\n\010_user_"
-  "idB\r\n\013_session_id\"\237\002\n\020GetClicksRequest\022-"
+  "offset\030\002 \001(\005\"/\n\013EventCursor\022\024\n\014timestamp"
+  "_us\030\001 \001(\003\022\n\n\002id\030\002 \001(\t\"\277\001\n\rPageViewEvent\022"
+  "\n\n\002id\030\001 \001(\t\022\014\n\004page\030\002 \001(\t\022\024\n\007user_id\030\003 \001"
+  "(\tH\000\210\001\001\022\027\n\nsession_id\030\004 \001(\tH\001\210\001\001\022\025\n\010refe"
+  "rrer\030\005 \001(\tH\002\210\001\001\022\021\n\ttimestamp\030\006 \001(\003\022\023\n\013re"
+  "ceived_at\030\007 \001(\003B\n\n\010_user_idB\r\n\013_session_"
+  "idB\013\n\t_referrer\"\200\003\n\023GetPageViewsRequest\022"
+  "-\n\ntime_range\030\001 \001(\0132\024.metricsys.TimeRang"
+  "eH\000\210\001\001\022.\n\npagination\030\002 \001(\0132\025.metricsys.P"
+  "aginationH\001\210\001\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001"
+  "\022\033\n\016user_id_filter\030\004 \001(\tH\003\210\001\001\022*\n\005after\030\005"
+  " \001(\0132\026.metricsys.EventCursorH\004\210\001\001\0221\n\016rec"
+  "eived_range\030\006 \001(\0132\024.metricsys.TimeRangeH"
+  "\005\210\001\001\022\026\n\016allow_segments\030\007 \001(\010B\r\n\013_time_ra"
+  "ngeB\r\n\013_paginationB\016\n\014_page_filterB\021\n\017_u"
+  "ser_id_filterB\010\n\006_afterB\021\n\017_received_ran"
+  "ge\"\307\001\n\024GetPageViewsResponse\022(\n\006events\030\001 "
+  "\003(\0132\030.metricsys.PageViewEvent\022\023\n\013total_c"
+  "ount\030\002 \001(\005\0220\n\013next_cursor\030\003 \001(\0132\026.metric"
+  "sys.EventCursorH\000\210\001\001\022\033\n\016received_until\030\004"
+  " \001(\003H\001\210\001\001B\016\n\014_next_cursorB\021\n\017_received_u"
+  "ntil\"\314\001\n\nClickEvent\022\n\n\002id\030\001 \001(\t\022\014\n\004page\030"
+  "\002 \001(\t\022\022\n\nelement_id\030\003 \001(\t\022\023\n\006action\030\004 \001("
+  "\tH\000\210\001\001\022\024\n\007user_id\030\005 \001(\tH\001\210\001\001\022\027\n\nsession_"
+  "id\030\006 \001(\tH\002\210\001\001\022\021\n\ttimestamp\030\007 \001(\003\022\023\n\013rece"
+  "ived_at\030\010 \001(\003B\t\n\007_actionB\n\n\010_user_idB\r\n\013"
+  "_session_id\"\263\003\n\020GetClicksRequest\022-\n\ntime"
+  "_range\030\001 \001(\0132\024.metricsys.TimeRangeH\000\210\001\001\022"
+  ".\n\npagination\030\002 \001(\0132\025.metricsys.Paginati"
+  "onH\001\210\001\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001\022\036\n\021ele"
+  "ment_id_filter\030\004 \001(\tH\003\210\001\001\022\033\n\016user_id_fil"
+  "ter\030\005 \001(\tH\004\210\001\001\022*\n\005after\030\006 \001(\0132\026.metricsy"
+  "s.EventCursorH\005\210\001\001\0221\n\016received_range\030\007 \001"
+  "(\0132\024.metricsys.TimeRangeH\006\210\001\001\022\026\n\016allow_s"
+  "egments\030\010 \001(\010B\r\n\013_time_rangeB\r\n\013_paginat"
+  "ionB\016\n\014_page_filterB\024\n\022_element_id_filte"
+  "rB\021\n\017_user_id_filterB\010\n\006_afterB\021\n\017_recei"
+  "ved_range\"\301\001\n\021GetClicksResponse\022%\n\006event"
+  "s\030\001 \003(\0132\025.metricsys.ClickEvent\022\023\n\013total_"
+  "count\030\002 \001(\005\0220\n\013next_cursor\030\003 \001(\0132\026.metri"
+  "csys.EventCursorH\000\210\001\001\022\033\n\016received_until\030"
+  "\004 \001(\003H\001\210\001\001B\016\n\014_next_cursorB\021\n\017_received_"
+  "until\"\270\002\n\020PerformanceEvent\022\n\n\002id\030\001 \001(\t\022\014"
+  "\n\004page\030\002 \001(\t\022\024\n\007ttfb_ms\030\003 \001(\001H\000\210\001\001\022\023\n\006fc"
+  "p_ms\030\004 \001(\001H\001\210\001\001\022\023\n\006lcp_ms\030\005 \001(\001H\002\210\001\001\022\037\n\022"
+  "total_page_load_ms\030\006 \001(\001H\003\210\001\001\022\024\n\007user_id"
+  "\030\007 \001(\tH\004\210\001\001\022\027\n\nsession_id\030\010 \001(\tH\005\210\001\001\022\021\n\t"
+  "timestamp\030\t \001(\003\022\023\n\013received_at\030\n \001(\003B\n\n\010"
+  "_ttfb_msB\t\n\007_fcp_msB\t\n\007_lcp_msB\025\n\023_total"
+  "_page_load_msB\n\n\010_user_idB\r\n\013_session_id"
+  "\"\202\003\n\025GetPerformanceRequest\022-\n\ntime_range"
+  "\030\001 \001(\0132\024.metricsys.TimeRangeH\000\210\001\001\022.\n\npag"
+  "ination\030\002 \001(\0132\025.metricsys.PaginationH\001\210\001"
+  "\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001\022\033\n\016user_id_f"
+  "ilter\030\004 \001(\tH\003\210\001\001\022*\n\005after\030\005 \001(\0132\026.metric"
+  "sys.EventCursorH\004\210\001\001\0221\n\016received_range\030\006"
+  " \001(\0132\024.metricsys.TimeRangeH\005\210\001\001\022\026\n\016allow"
+  "_segments\030\007 \001(\010B\r\n\013_time_rangeB\r\n\013_pagin"
+  "ationB\016\n\014_page_filterB\021\n\017_user_id_filter"
+  "B\010\n\006_afterB\021\n\017_received_range\"\314\001\n\026GetPer"
+  "formanceResponse\022+\n\006events\030\001 \003(\0132\033.metri"
+  "csys.PerformanceEvent\022\023\n\013total_count\030\002 \001"
+  "(\005\0220\n\013next_cursor\030\003 \001(\0132\026.metricsys.Even"
+  "tCursorH\000\210\001\001\022\033\n\016received_until\030\004 \001(\003H\001\210\001"
+  "\001B\016\n\014_next_cursorB\021\n\017_received_until\"\202\002\n"
+  "\nErrorEvent\022\n\n\002id\030\001 \001(\t\022\014\n\004page\030\002 \001(\t\022\022\n"
+  "\nerror_type\030\003 \001(\t\022\017\n\007message\030\004 \001(\t\022\022\n\005st"
+  "ack\030\005 \001(\tH\000\210\001\001\022%\n\010severity\030\006 \001(\0162\023.metri"
+  "csys.Severity\022\024\n\007user_id\030\007 \001(\tH\001\210\001\001\022\027\n\ns"
+  "ession_id\030\010 \001(\tH\002\210\001\001\022\021\n\ttimestamp\030\t \001(\003\022"
+  "\023\n\013received_at\030\n \001(\003B\010\n\006_stackB\n\n\010_user_"
+  "idB\r\n\013_session_id\"\372\003\n\020GetErrorsRequest\022-"
   "\n\ntime_range\030\001 \001(\0132\024.metricsys.TimeRange"
   "H\000\210\001\001\022.\n\npagination\030\002 \001(\0132\025.metricsys.Pa"
   "ginationH\001\210\001\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001\022"
-  "\036\n\021element_id_filter\030\004 \001(\tH\003\210\001\001\022\033\n\016user_"
-  "id_filter\030\005 \001(\tH\004\210\001\001B\r\n\013_time_rangeB\r\n\013_"
-  "paginationB\016\n\014_page_filterB\024\n\022_element_i"
-  "d_filterB\021\n\017_user_id_filter\"O\n\021GetClicks"
-  "Response\022%\n\006events\030\001 \003(\0132\025.metricsys.Cli"
-  "ckEvent\022\023\n\013total_count\030\002 \001(\005\"\243\002\n\020Perform"
-  "anceEvent\022\n\n\002id\030\001 \001(\t\022\014\n\004page\030\002 \001(\t\022\024\n\007t"
-  "tfb_ms\030\003 \001(\001H\000\210\001\001\022\023\n\006fcp_ms\030\004 \001(\001H\001\210\001\001\022\023"
-  "\n\006lcp_ms\030\005 \001(\001H\002\210\001\001\022\037\n\022total_page_load_m"
-  "s\030\006 \001(\001H\003\210\001\001\022\024\n\007user_id\030\007 \001(\tH\004\210\001\001\022\027\n\nse"
-  "ssion_id\030\010 \001(\tH\005\210\001\001\022\021\n\ttimestamp\030\t \001(\003B\n"
-  "\n\010_ttfb_msB\t\n\007_fcp_msB\t\n\007_lcp_msB\025\n\023_tot"
-  "al_page_load_msB\n\n\010_user_idB\r\n\013_session_"
-  "id\"\356\001\n\025GetPerformanceRequest\022-\n\ntime_ran"
-  "ge\030\001 \001(\0132\024.metricsys.TimeRangeH\000\210\001\001\022.\n\np"
-  "agination\030\002 \001(\0132\025.metricsys.PaginationH\001"
-  "\210\001\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001\022\033\n\016user_id"
-  "_filter\030\004 \001(\tH\003\210\001\001B\r\n\013_time_rangeB\r\n\013_pa"
-  "ginationB\016\n\014_page_filterB\021\n\017_user_id_fil"
-  "ter\"Z\n\026GetPerformanceResponse\022+\n\006events\030"
-  "\001 \003(\0132\033.metricsys.PerformanceEvent\022\023\n\013to"
-  "tal_count\030\002 \001(\005\"\355\001\n\nErrorEvent\022\n\n\002id\030\001 \001"
-  "(\t\022\014\n\004page\030\002 \001(\t\022\022\n\nerror_type\030\003 \001(\t\022\017\n\007"
-  "message\030\004 \001(\t\022\022\n\005stack\030\005 \001(\tH\000\210\001\001\022%\n\010sev"
-  "erity\030\006 \001(\0162\023.metricsys.Severity\022\024\n\007user"
-  "_id\030\007 \001(\tH\001\210\001\001\022\027\n\nsession_id\030\010 \001(\tH\002\210\001\001\022"
-  "\021\n\ttimestamp\030\t \001(\003B\010\n\006_stackB\n\n\010_user_id"
-  "B\r\n\013_session_id\"\346\002\n\020GetErrorsRequest\022-\n\n"
-  "time_range\030\001 \001(\0132\024.metricsys.TimeRangeH\000"
-  "\210\001\001\022.\n\npagination\030\002 \001(\0132\025.metricsys.Pagi"
-  "nationH\001\210\001\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001\0221\n"
-  "\017severity_filter\030\004 \001(\0162\023.metricsys.Sever"
-  "ityH\003\210\001\001\022\036\n\021error_type_filter\030\005 \001(\tH\004\210\001\001"
-  "\022\033\n\016user_id_filter\030\006 \001(\tH\005\210\001\001B\r\n\013_time_r"
-  "angeB\r\n\013_paginationB\016\n\014_page_filterB\022\n\020_"
-  "severity_filterB\024\n\022_error_type_filterB\021\n"
-  "\017_user_id_filter\"O\n\021GetErrorsResponse\022%\n"
-  "\006events\030\001 \003(\0132\025.metricsys.ErrorEvent\022\023\n\013"
-  "total_count\030\002 \001(\005\"\217\002\n\013CustomEvent\022\n\n\002id\030"
-  "\001 \001(\t\022\014\n\004name\030\002 \001(\t\022\021\n\004page\030\003 \001(\tH\000\210\001\001\022\024"
-  "\n\007user_id\030\004 \001(\tH\001\210\001\001\022\027\n\nsession_id\030\005 \001(\t"
-  "H\002\210\001\001\022:\n\nproperties\030\006 \003(\0132&.metricsys.Cu"
-  "stomEvent.PropertiesEntry\022\021\n\ttimestamp\030\007"
-  " \001(\003\0321\n\017PropertiesEntry\022\013\n\003key\030\001 \001(\t\022\r\n\005"
-  "value\030\002 \001(\t:\0028\001B\007\n\005_pageB\n\n\010_user_idB\r\n\013"
-  "_session_id\"\231\002\n\026GetCustomEventsRequest\022-"
-  "\n\ntime_range\030\001 \001(\0132\024.metricsys.TimeRange"
-  "H\000\210\001\001\022.\n\npagination\030\002 \001(\0132\025.metricsys.Pa"
-  "ginationH\001\210\001\001\022\030\n\013name_filter\030\003 \001(\tH\002\210\001\001\022"
-  "\030\n\013page_filter\030\004 \001(\tH\003\210\001\001\022\033\n\016user_id_fil"
-  "ter\030\005 \001(\tH\004\210\001\001B\r\n\013_time_rangeB\r\n\013_pagina"
-  "tionB\016\n\014_name_filterB\016\n\014_page_filterB\021\n\017"
-  "_user_id_filter\"V\n\027GetCustomEventsRespon"
-  "se\022&\n\006events\030\001 \003(\0132\026.metricsys.CustomEve"
-  "nt\022\023\n\013total_count\030\002 \001(\005*e\n\010Severity\022\030\n\024S"
-  "EVERITY_UNSPECIFIED\020\000\022\024\n\020SEVERITY_WARNIN"
-  "G\020\001\022\022\n\016SEVERITY_ERROR\020\002\022\025\n\021SEVERITY_CRIT"
-  "ICAL\020\0032\242\003\n\016MetricsService\022O\n\014GetPageView"
-  "s\022\036.metricsys.GetPageViewsRequest\032\037.metr"
-  "icsys.GetPageViewsResponse\022F\n\tGetClicks\022"
-  "\033.metricsys.GetClicksRequest\032\034.metricsys"
-  ".GetClicksResponse\022U\n\016GetPerformance\022 .m"
-  "etricsys.GetPerformanceRequest\032!.metrics"
-  "ys.GetPerformanceResponse\022F\n\tGetErrors\022\033"
-  ".metricsys.GetErrorsRequest\032\034.metricsys."
-  "GetErrorsResponse\022X\n\017GetCustomEvents\022!.m"
-  "etricsys.GetCustomEventsRequest\032\".metric"
-  "sys.GetCustomEventsResponseb\006proto3"
+  "1\n\017severity_filter\030\004 \001(\0162\023.metricsys.Sev"
+  "erityH\003\210\001\001\022\036\n\021error_type_filter\030\005 \001(\tH\004\210"
+  "\001\001\022\033\n\016user_id_filter\030\006 \001(\tH\005\210\001\001\022*\n\005after"
+  "\030\007 \001(\0132\026.metricsys.EventCursorH\006\210\001\001\0221\n\016r"
+  "eceived_range\030\010 \001(\0132\024.metricsys.TimeRang"
+  "eH\007\210\001\001\022\026\n\016allow_segments\030\t \001(\010B\r\n\013_time_"
+  "rangeB\r\n\013_paginationB\016\n\014_page_filterB\022\n\020"
+  "_severity_filterB\024\n\022_error_type_filterB\021"
+  "\n\017_user_id_filterB\010\n\006_afterB\021\n\017_received"
+  "_range\"\301\001\n\021GetErrorsResponse\022%\n\006events\030\001"
+  " \003(\0132\025.metricsys.ErrorEvent\022\023\n\013total_cou"
+  "nt\030\002 \001(\005\0220\n\013next_cursor\030\003 \001(\0132\026.metricsy"
+  "s.EventCursorH\000\210\001\001\022\033\n\016received_until\030\004 \001"
+  "(\003H\001\210\001\001B\016\n\014_next_cursorB\021\n\017_received_unt"
+  "il\"\244\002\n\013CustomEvent\022\n\n\002id\030\001 \001(\t\022\014\n\004name\030\002"
+  " \001(\t\022\021\n\004page\030\003 \001(\tH\000\210\001\001\022\024\n\007user_id\030\004 \001(\t"
+  "H\001\210\001\001\022\027\n\nsession_id\030\005 \001(\tH\002\210\001\001\022:\n\nproper"
+  "ties\030\006 \003(\0132&.metricsys.CustomEvent.Prope"
+  "rtiesEntry\022\021\n\ttimestamp\030\007 \001(\003\022\023\n\013receive"
+  "d_at\030\010 \001(\003\0321\n\017PropertiesEntry\022\013\n\003key\030\001 \001"
+  "(\t\022\r\n\005value\030\002 \001(\t:\0028\001B\007\n\005_pageB\n\n\010_user_"
+  "idB\r\n\013_session_id\"\255\003\n\026GetCustomEventsReq"
+  "uest\022-\n\ntime_range\030\001 \001(\0132\024.metricsys.Tim"
+  "eRangeH\000\210\001\001\022.\n\npagination\030\002 \001(\0132\025.metric"
+  "sys.PaginationH\001\210\001\001\022\030\n\013name_filter\030\003 \001(\t"
+  "H\002\210\001\001\022\030\n\013page_filter\030\004 \001(\tH\003\210\001\001\022\033\n\016user_"
+  "id_filter\030\005 \001(\tH\004\210\001\001\022*\n\005after\030\006 \001(\0132\026.me"
+  "tricsys.EventCursorH\005\210\001\001\0221\n\016received_ran"
+  "ge\030\007 \001(\0132\024.metricsys.TimeRangeH\006\210\001\001\022\026\n\016a"
+  "llow_segments\030\010 \001(\010B\r\n\013_time_rangeB\r\n\013_p"
+  "aginationB\016\n\014_name_filterB\016\n\014_page_filte"
+  "rB\021\n\017_user_id_filterB\010\n\006_afterB\021\n\017_recei"
+  "ved_range\"\310\001\n\027GetCustomEventsResponse\022&\n"
+  "\006events\030\001 \003(\0132\026.metricsys.CustomEvent\022\023\n"
+  "\013total_count\030\002 \001(\005\0220\n\013next_cursor\030\003 \001(\0132"
+  "\026.metricsys.EventCursorH\000\210\001\001\022\033\n\016received"
+  "_until\030\004 \001(\003H\001\210\001\001B\016\n\014_next_cursorB\021\n\017_re"
+  "ceived_until*e\n\010Severity\022\030\n\024SEVERITY_UNS"
+  "PECIFIED\020\000\022\024\n\020SEVERITY_WARNING\020\001\022\022\n\016SEVE"
+  "RITY_ERROR\020\002\022\025\n\021SEVERITY_CRITICAL\020\0032\315\006\n\016"
+  "MetricsService\022O\n\014GetPageViews\022\036.metrics"
+  "ys.GetPageViewsRequest\032\037.metricsys.GetPa"
+  "geViewsResponse\022F\n\tGetClicks\022\033.metricsys"
+  ".GetClicksRequest\032\034.metricsys.GetClicksR"
+  "esponse\022U\n\016GetPerformance\022 .metricsys.Ge"
+  "tPerformanceRequest\032!.metricsys.GetPerfo"
+  "rmanceResponse\022F\n\tGetErrors\022\033.metricsys."
+  "GetErrorsRequest\032\034.metricsys.GetErrorsRe"
+  "sponse\022X\n\017GetCustomEvents\022!.metricsys.Ge"
+  "tCustomEventsRequest\032\".metricsys.GetCust"
+  "omEventsResponse\022T\n\017StreamPageViews\022\036.me"
+  "tricsys.GetPageViewsRequest\032\037.metricsys."
+  "GetPageViewsResponse0\001\022K\n\014StreamClicks\022\033"
+  ".metricsys.GetClicksRequest\032\034.metricsys."
+  "GetClicksResponse0\001\022Z\n\021StreamPerformance"
+  "\022 .metricsys.GetPerformanceRequest\032!.met"
+  "ricsys.GetPerformanceResponse0\001\022K\n\014Strea"
+  "mErrors\022\033.metricsys.GetErrorsRequest\032\034.m"
+  "etricsys.GetErrorsResponse0\001\022]\n\022StreamCu"
+  "stomEvents\022!.metricsys.GetCustomEventsRe"
+  "quest\032\".metricsys.GetCustomEventsRespons"
+  "e0\001b\006proto3"
   ;
 static ::_pbi::once_flag descriptor_table_metrics_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_metrics_2eproto = {
-    false, false, 3675, descriptor_table_protodef_metrics_2eproto,
+    false, false, 5571, descriptor_table_protodef_metrics_2eproto,
     "metrics.proto",
-    &descriptor_table_metrics_2eproto_once, nullptr, 0, 18,
+    &descriptor_table_metrics_2eproto_once, nullptr, 0, 19,
     schemas, file_default_instances, TableStruct_metrics_2eproto::offsets,
     file_level_metadata_metrics_2eproto, file_level_enum_descriptors_metrics_2eproto,
     file_level_service_descriptors_metrics_2eproto,
@@ -1172,6 +1349,236 @@ void Pagination::InternalSwap(Pagination* other) {
 
 // ===================================================================
 
+class EventCursor::_Internal {
+ public:
+};
+
+EventCursor::EventCursor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.EventCursor)
+}
+EventCursor::EventCursor(const EventCursor& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EventCursor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.timestamp_us_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.timestamp_us_ = from._impl_.timestamp_us_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.EventCursor)
+}
+
+inline void EventCursor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.timestamp_us_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+EventCursor::~EventCursor() {
+  // @@protoc_insertion_point(destructor:metricsys.EventCursor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EventCursor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+}
+
+void EventCursor::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EventCursor::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.EventCursor)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.timestamp_us_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EventCursor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 timestamp_us = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.EventCursor.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EventCursor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.EventCursor)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 timestamp_us = 1;
+  if (this->_internal_timestamp_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_timestamp_us(), target);
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.EventCursor.id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.EventCursor)
+  return target;
+}
+
+size_t EventCursor::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.EventCursor)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // int64 timestamp_us = 1;
+  if (this->_internal_timestamp_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp_us());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EventCursor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EventCursor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EventCursor::GetClassData() const { return &_class_data_; }
+
+
+void EventCursor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EventCursor*>(&to_msg);
+  auto& from = static_cast<const EventCursor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.EventCursor)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_timestamp_us() != 0) {
+    _this->_internal_set_timestamp_us(from._internal_timestamp_us());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EventCursor::CopyFrom(const EventCursor& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.EventCursor)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EventCursor::IsInitialized() const {
+  return true;
+}
+
+void EventCursor::InternalSwap(EventCursor* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  swap(_impl_.timestamp_us_, other->_impl_.timestamp_us_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EventCursor::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[2]);
+}
+
+// ===================================================================
+
 class PageViewEvent::_Internal {
  public:
   using HasBits = decltype(std::declval<PageViewEvent>()._impl_._has_bits_);
@@ -1203,7 +1610,8 @@ PageViewEvent::PageViewEvent(const PageViewEvent& from)
     , decltype(_impl_.user_id_){}
     , decltype(_impl_.session_id_){}
     , decltype(_impl_.referrer_){}
-    , decltype(_impl_.timestamp_){}};
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.id_.InitDefault();
@@ -1246,7 +1654,9 @@ PageViewEvent::PageViewEvent(const PageViewEvent& from)
     _this->_impl_.referrer_.Set(from._internal_referrer(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.timestamp_ = from._impl_.timestamp_;
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.received_at_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
   // @@protoc_insertion_point(copy_constructor:metricsys.PageViewEvent)
 }
 
@@ -1263,6 +1673,7 @@ inline void PageViewEvent::SharedCtor(
     , decltype(_impl_.session_id_){}
     , decltype(_impl_.referrer_){}
     , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
   };
   _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -1328,7 +1739,9 @@ void PageViewEvent::Clear() {
       _impl_.referrer_.ClearNonDefaultToEmpty();
     }
   }
-  _impl_.timestamp_ = int64_t{0};
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.received_at_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -1398,6 +1811,14 @@ const char* PageViewEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // int64 received_at = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1484,6 +1905,12 @@ uint8_t* PageViewEvent::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_timestamp(), target);
   }
 
+  // int64 received_at = 7;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_received_at(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1543,6 +1970,11 @@ size_t PageViewEvent::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
 
+  // int64 received_at = 7;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1582,6 +2014,9 @@ void PageViewEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::
   if (from._internal_timestamp() != 0) {
     _this->_internal_set_timestamp(from._internal_timestamp());
   }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1622,13 +2057,18 @@ void PageViewEvent::InternalSwap(PageViewEvent* other) {
       &_impl_.referrer_, lhs_arena,
       &other->_impl_.referrer_, rhs_arena
   );
-  swap(_impl_.timestamp_, other->_impl_.timestamp_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PageViewEvent, _impl_.received_at_)
+      + sizeof(PageViewEvent::_impl_.received_at_)
+      - PROTOBUF_FIELD_OFFSET(PageViewEvent, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata PageViewEvent::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[2]);
+      file_level_metadata_metrics_2eproto[3]);
 }
 
 // ===================================================================
@@ -1650,6 +2090,14 @@ class GetPageViewsRequest::_Internal {
   static void set_has_user_id_filter(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
+  static const ::metricsys::EventCursor& after(const GetPageViewsRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetPageViewsRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
 };
 
 const ::metricsys::TimeRange&
@@ -1660,6 +2108,14 @@ const ::metricsys::Pagination&
 GetPageViewsRequest::_Internal::pagination(const GetPageViewsRequest* msg) {
   return *msg->_impl_.pagination_;
 }
+const ::metricsys::EventCursor&
+GetPageViewsRequest::_Internal::after(const GetPageViewsRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetPageViewsRequest::_Internal::received_range(const GetPageViewsRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
 GetPageViewsRequest::GetPageViewsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -1675,7 +2131,10 @@ GetPageViewsRequest::GetPageViewsRequest(const GetPageViewsRequest& from)
     , decltype(_impl_.page_filter_){}
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.page_filter_.InitDefault();
@@ -1700,6 +2159,13 @@ GetPageViewsRequest::GetPageViewsRequest(const GetPageViewsRequest& from)
   if (from._internal_has_pagination()) {
     _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
   }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  _this->_impl_.allow_segments_ = from._impl_.allow_segments_;
   // @@protoc_insertion_point(copy_constructor:metricsys.GetPageViewsRequest)
 }
 
@@ -1714,6 +2180,9 @@ inline void GetPageViewsRequest::SharedCtor(
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
     , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){false}
   };
   _impl_.page_filter_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -1740,6 +2209,8 @@ inline void GetPageViewsRequest::SharedDtor() {
   _impl_.user_id_filter_.Destroy();
   if (this != internal_default_instance()) delete _impl_.time_range_;
   if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
 }
 
 void GetPageViewsRequest::SetCachedSize(int size) const {
@@ -1753,7 +2224,7 @@ void GetPageViewsRequest::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000003fu) {
     if (cached_has_bits & 0x00000001u) {
       _impl_.page_filter_.ClearNonDefaultToEmpty();
     }
@@ -1768,7 +2239,16 @@ void GetPageViewsRequest::Clear() {
       GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
       _impl_.pagination_->Clear();
     }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
   }
+  _impl_.allow_segments_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -1816,6 +2296,30 @@ const char* GetPageViewsRequest::_InternalParse(const char* ptr, ::_pbi::ParseCo
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor after = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1880,6 +2384,26 @@ uint8_t* GetPageViewsRequest::_InternalSerialize(
         4, this->_internal_user_id_filter(), target);
   }
 
+  // optional .metricsys.EventCursor after = 5;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 6;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 7;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_allow_segments(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1897,7 +2421,7 @@ size_t GetPageViewsRequest::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000003fu) {
     // optional string page_filter = 3;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -1926,7 +2450,26 @@ size_t GetPageViewsRequest::ByteSizeLong() const {
           *_impl_.pagination_);
     }
 
+    // optional .metricsys.EventCursor after = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
+  }
+  // bool allow_segments = 7;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1946,7 +2489,7 @@ void GetPageViewsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000003fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_page_filter(from._internal_page_filter());
     }
@@ -1961,6 +2504,17 @@ void GetPageViewsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, co
       _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
           from._internal_pagination());
     }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -1991,8 +2545,8 @@ void GetPageViewsRequest::InternalSwap(GetPageViewsRequest* other) {
       &other->_impl_.user_id_filter_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetPageViewsRequest, _impl_.pagination_)
-      + sizeof(GetPageViewsRequest::_impl_.pagination_)
+      PROTOBUF_FIELD_OFFSET(GetPageViewsRequest, _impl_.allow_segments_)
+      + sizeof(GetPageViewsRequest::_impl_.allow_segments_)
       - PROTOBUF_FIELD_OFFSET(GetPageViewsRequest, _impl_.time_range_)>(
           reinterpret_cast<char*>(&_impl_.time_range_),
           reinterpret_cast<char*>(&other->_impl_.time_range_));
@@ -2001,15 +2555,27 @@ void GetPageViewsRequest::InternalSwap(GetPageViewsRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata GetPageViewsRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[3]);
+      file_level_metadata_metrics_2eproto[4]);
 }
 
 // ===================================================================
 
 class GetPageViewsResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<GetPageViewsResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetPageViewsResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
+const ::metricsys::EventCursor&
+GetPageViewsResponse::_Internal::next_cursor(const GetPageViewsResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
 GetPageViewsResponse::GetPageViewsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -2020,12 +2586,20 @@ GetPageViewsResponse::GetPageViewsResponse(const GetPageViewsResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   GetPageViewsResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){from._impl_.events_}
-    , decltype(_impl_.total_count_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.total_count_ = from._impl_.total_count_;
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
   // @@protoc_insertion_point(copy_constructor:metricsys.GetPageViewsResponse)
 }
 
@@ -2034,9 +2608,12 @@ inline void GetPageViewsResponse::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){arena}
-    , decltype(_impl_.total_count_){0}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
   };
 }
 
@@ -2052,6 +2629,7 @@ GetPageViewsResponse::~GetPageViewsResponse() {
 inline void GetPageViewsResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
 }
 
 void GetPageViewsResponse::SetCachedSize(int size) const {
@@ -2065,12 +2643,20 @@ void GetPageViewsResponse::Clear() {
   (void) cached_has_bits;
 
   _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
   _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 const char* GetPageViewsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -2096,6 +2682,23 @@ const char* GetPageViewsResponse::_InternalParse(const char* ptr, ::_pbi::ParseC
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2112,6 +2715,7 @@ const char* GetPageViewsResponse::_InternalParse(const char* ptr, ::_pbi::ParseC
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -2139,6 +2743,19 @@ uint8_t* GetPageViewsResponse::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
   }
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2162,6 +2779,21 @@ size_t GetPageViewsResponse::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
   // int32 total_count = 2;
   if (this->_internal_total_count() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
@@ -2186,6 +2818,17 @@ void GetPageViewsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, c
   (void) cached_has_bits;
 
   _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
   if (from._internal_total_count() != 0) {
     _this->_internal_set_total_count(from._internal_total_count());
   }
@@ -2206,14 +2849,20 @@ bool GetPageViewsResponse::IsInitialized() const {
 void GetPageViewsResponse::InternalSwap(GetPageViewsResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.events_.InternalSwap(&other->_impl_.events_);
-  swap(_impl_.total_count_, other->_impl_.total_count_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetPageViewsResponse, _impl_.total_count_)
+      + sizeof(GetPageViewsResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetPageViewsResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetPageViewsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[4]);
+      file_level_metadata_metrics_2eproto[5]);
 }
 
 // ===================================================================
@@ -2250,7 +2899,8 @@ ClickEvent::ClickEvent(const ClickEvent& from)
     , decltype(_impl_.action_){}
     , decltype(_impl_.user_id_){}
     , decltype(_impl_.session_id_){}
-    , decltype(_impl_.timestamp_){}};
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.id_.InitDefault();
@@ -2301,7 +2951,9 @@ ClickEvent::ClickEvent(const ClickEvent& from)
     _this->_impl_.session_id_.Set(from._internal_session_id(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.timestamp_ = from._impl_.timestamp_;
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.received_at_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
   // @@protoc_insertion_point(copy_constructor:metricsys.ClickEvent)
 }
 
@@ -2319,6 +2971,7 @@ inline void ClickEvent::SharedCtor(
     , decltype(_impl_.user_id_){}
     , decltype(_impl_.session_id_){}
     , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
   };
   _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2390,7 +3043,9 @@ void ClickEvent::Clear() {
       _impl_.session_id_.ClearNonDefaultToEmpty();
     }
   }
-  _impl_.timestamp_ = int64_t{0};
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.received_at_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -2470,6 +3125,14 @@ const char* ClickEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
         } else
           goto handle_unusual;
         continue;
+      // int64 received_at = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2566,6 +3229,12 @@ uint8_t* ClickEvent::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_timestamp(), target);
   }
 
+  // int64 received_at = 8;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_received_at(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -2632,6 +3301,11 @@ size_t ClickEvent::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
 
+  // int64 received_at = 8;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -2674,6 +3348,9 @@ void ClickEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PRO
   if (from._internal_timestamp() != 0) {
     _this->_internal_set_timestamp(from._internal_timestamp());
   }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -2718,13 +3395,18 @@ void ClickEvent::InternalSwap(ClickEvent* other) {
       &_impl_.session_id_, lhs_arena,
       &other->_impl_.session_id_, rhs_arena
   );
-  swap(_impl_.timestamp_, other->_impl_.timestamp_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClickEvent, _impl_.received_at_)
+      + sizeof(ClickEvent::_impl_.received_at_)
+      - PROTOBUF_FIELD_OFFSET(ClickEvent, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata ClickEvent::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[5]);
+      file_level_metadata_metrics_2eproto[6]);
 }
 
 // ===================================================================
@@ -2749,6 +3431,14 @@ class GetClicksRequest::_Internal {
   static void set_has_user_id_filter(HasBits* has_bits) {
     (*has_bits)[0] |= 4u;
   }
+  static const ::metricsys::EventCursor& after(const GetClicksRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetClicksRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
 };
 
 const ::metricsys::TimeRange&
@@ -2759,6 +3449,14 @@ const ::metricsys::Pagination&
 GetClicksRequest::_Internal::pagination(const GetClicksRequest* msg) {
   return *msg->_impl_.pagination_;
 }
+const ::metricsys::EventCursor&
+GetClicksRequest::_Internal::after(const GetClicksRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetClicksRequest::_Internal::received_range(const GetClicksRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
 GetClicksRequest::GetClicksRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -2775,7 +3473,10 @@ GetClicksRequest::GetClicksRequest(const GetClicksRequest& from)
     , decltype(_impl_.element_id_filter_){}
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.page_filter_.InitDefault();
@@ -2808,6 +3509,13 @@ GetClicksRequest::GetClicksRequest(const GetClicksRequest& from)
   if (from._internal_has_pagination()) {
     _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
   }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  _this->_impl_.allow_segments_ = from._impl_.allow_segments_;
   // @@protoc_insertion_point(copy_constructor:metricsys.GetClicksRequest)
 }
 
@@ -2823,6 +3531,9 @@ inline void GetClicksRequest::SharedCtor(
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
     , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){false}
   };
   _impl_.page_filter_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2854,6 +3565,8 @@ inline void GetClicksRequest::SharedDtor() {
   _impl_.user_id_filter_.Destroy();
   if (this != internal_default_instance()) delete _impl_.time_range_;
   if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
 }
 
 void GetClicksRequest::SetCachedSize(int size) const {
@@ -2867,7 +3580,7 @@ void GetClicksRequest::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
       _impl_.page_filter_.ClearNonDefaultToEmpty();
     }
@@ -2885,7 +3598,16 @@ void GetClicksRequest::Clear() {
       GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
       _impl_.pagination_->Clear();
     }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
   }
+  _impl_.allow_segments_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -2943,6 +3665,30 @@ const char* GetClicksRequest::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor after = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3017,6 +3763,26 @@ uint8_t* GetClicksRequest::_InternalSerialize(
         5, this->_internal_user_id_filter(), target);
   }
 
+  // optional .metricsys.EventCursor after = 6;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 7;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 8;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_allow_segments(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3034,7 +3800,7 @@ size_t GetClicksRequest::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000007fu) {
     // optional string page_filter = 3;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -3070,7 +3836,26 @@ size_t GetClicksRequest::ByteSizeLong() const {
           *_impl_.pagination_);
     }
 
+    // optional .metricsys.EventCursor after = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
+  }
+  // bool allow_segments = 8;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -3090,7 +3875,7 @@ void GetClicksRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_page_filter(from._internal_page_filter());
     }
@@ -3108,6 +3893,17 @@ void GetClicksRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
       _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
           from._internal_pagination());
     }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -3142,8 +3938,8 @@ void GetClicksRequest::InternalSwap(GetClicksRequest* other) {
       &other->_impl_.user_id_filter_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetClicksRequest, _impl_.pagination_)
-      + sizeof(GetClicksRequest::_impl_.pagination_)
+      PROTOBUF_FIELD_OFFSET(GetClicksRequest, _impl_.allow_segments_)
+      + sizeof(GetClicksRequest::_impl_.allow_segments_)
       - PROTOBUF_FIELD_OFFSET(GetClicksRequest, _impl_.time_range_)>(
           reinterpret_cast<char*>(&_impl_.time_range_),
           reinterpret_cast<char*>(&other->_impl_.time_range_));
@@ -3152,15 +3948,27 @@ void GetClicksRequest::InternalSwap(GetClicksRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata GetClicksRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[6]);
+      file_level_metadata_metrics_2eproto[7]);
 }
 
 // ===================================================================
 
 class GetClicksResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<GetClicksResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetClicksResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
+const ::metricsys::EventCursor&
+GetClicksResponse::_Internal::next_cursor(const GetClicksResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
 GetClicksResponse::GetClicksResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -3171,12 +3979,20 @@ GetClicksResponse::GetClicksResponse(const GetClicksResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   GetClicksResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){from._impl_.events_}
-    , decltype(_impl_.total_count_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.total_count_ = from._impl_.total_count_;
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
   // @@protoc_insertion_point(copy_constructor:metricsys.GetClicksResponse)
 }
 
@@ -3185,9 +4001,12 @@ inline void GetClicksResponse::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){arena}
-    , decltype(_impl_.total_count_){0}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
   };
 }
 
@@ -3203,6 +4022,7 @@ GetClicksResponse::~GetClicksResponse() {
 inline void GetClicksResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
 }
 
 void GetClicksResponse::SetCachedSize(int size) const {
@@ -3216,12 +4036,20 @@ void GetClicksResponse::Clear() {
   (void) cached_has_bits;
 
   _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
   _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 const char* GetClicksResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -3247,6 +4075,23 @@ const char* GetClicksResponse::_InternalParse(const char* ptr, ::_pbi::ParseCont
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3263,6 +4108,7 @@ const char* GetClicksResponse::_InternalParse(const char* ptr, ::_pbi::ParseCont
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -3290,6 +4136,19 @@ uint8_t* GetClicksResponse::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
   }
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3313,6 +4172,21 @@ size_t GetClicksResponse::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
   // int32 total_count = 2;
   if (this->_internal_total_count() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
@@ -3337,6 +4211,17 @@ void GetClicksResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, cons
   (void) cached_has_bits;
 
   _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
   if (from._internal_total_count() != 0) {
     _this->_internal_set_total_count(from._internal_total_count());
   }
@@ -3357,14 +4242,20 @@ bool GetClicksResponse::IsInitialized() const {
 void GetClicksResponse::InternalSwap(GetClicksResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.events_.InternalSwap(&other->_impl_.events_);
-  swap(_impl_.total_count_, other->_impl_.total_count_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetClicksResponse, _impl_.total_count_)
+      + sizeof(GetClicksResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetClicksResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetClicksResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[7]);
+      file_level_metadata_metrics_2eproto[8]);
 }
 
 // ===================================================================
@@ -3412,7 +4303,8 @@ PerformanceEvent::PerformanceEvent(const PerformanceEvent& from)
     , decltype(_impl_.fcp_ms_){}
     , decltype(_impl_.lcp_ms_){}
     , decltype(_impl_.total_page_load_ms_){}
-    , decltype(_impl_.timestamp_){}};
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.id_.InitDefault();
@@ -3448,8 +4340,8 @@ PerformanceEvent::PerformanceEvent(const PerformanceEvent& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.ttfb_ms_, &from._impl_.ttfb_ms_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.timestamp_) -
-    reinterpret_cast<char*>(&_impl_.ttfb_ms_)) + sizeof(_impl_.timestamp_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.received_at_) -
+    reinterpret_cast<char*>(&_impl_.ttfb_ms_)) + sizeof(_impl_.received_at_));
   // @@protoc_insertion_point(copy_constructor:metricsys.PerformanceEvent)
 }
 
@@ -3469,6 +4361,7 @@ inline void PerformanceEvent::SharedCtor(
     , decltype(_impl_.lcp_ms_){0}
     , decltype(_impl_.total_page_load_ms_){0}
     , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
   };
   _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -3531,7 +4424,9 @@ void PerformanceEvent::Clear() {
         reinterpret_cast<char*>(&_impl_.total_page_load_ms_) -
         reinterpret_cast<char*>(&_impl_.ttfb_ms_)) + sizeof(_impl_.total_page_load_ms_));
   }
-  _impl_.timestamp_ = int64_t{0};
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.received_at_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -3627,6 +4522,14 @@ const char* PerformanceEvent::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
+      // int64 received_at = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3727,6 +4630,12 @@ uint8_t* PerformanceEvent::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_timestamp(), target);
   }
 
+  // int64 received_at = 10;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_received_at(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -3799,6 +4708,11 @@ size_t PerformanceEvent::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
 
+  // int64 received_at = 10;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -3848,6 +4762,9 @@ void PerformanceEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (from._internal_timestamp() != 0) {
     _this->_internal_set_timestamp(from._internal_timestamp());
   }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -3885,8 +4802,8 @@ void PerformanceEvent::InternalSwap(PerformanceEvent* other) {
       &other->_impl_.session_id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(PerformanceEvent, _impl_.timestamp_)
-      + sizeof(PerformanceEvent::_impl_.timestamp_)
+      PROTOBUF_FIELD_OFFSET(PerformanceEvent, _impl_.received_at_)
+      + sizeof(PerformanceEvent::_impl_.received_at_)
       - PROTOBUF_FIELD_OFFSET(PerformanceEvent, _impl_.ttfb_ms_)>(
           reinterpret_cast<char*>(&_impl_.ttfb_ms_),
           reinterpret_cast<char*>(&other->_impl_.ttfb_ms_));
@@ -3895,7 +4812,7 @@ void PerformanceEvent::InternalSwap(PerformanceEvent* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata PerformanceEvent::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[8]);
+      file_level_metadata_metrics_2eproto[9]);
 }
 
 // ===================================================================
@@ -3917,6 +4834,14 @@ class GetPerformanceRequest::_Internal {
   static void set_has_user_id_filter(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
+  static const ::metricsys::EventCursor& after(const GetPerformanceRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetPerformanceRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
 };
 
 const ::metricsys::TimeRange&
@@ -3927,6 +4852,14 @@ const ::metricsys::Pagination&
 GetPerformanceRequest::_Internal::pagination(const GetPerformanceRequest* msg) {
   return *msg->_impl_.pagination_;
 }
+const ::metricsys::EventCursor&
+GetPerformanceRequest::_Internal::after(const GetPerformanceRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetPerformanceRequest::_Internal::received_range(const GetPerformanceRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
 GetPerformanceRequest::GetPerformanceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -3942,7 +4875,10 @@ GetPerformanceRequest::GetPerformanceRequest(const GetPerformanceRequest& from)
     , decltype(_impl_.page_filter_){}
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.page_filter_.InitDefault();
@@ -3967,6 +4903,13 @@ GetPerformanceRequest::GetPerformanceRequest(const GetPerformanceRequest& from)
   if (from._internal_has_pagination()) {
     _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
   }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  _this->_impl_.allow_segments_ = from._impl_.allow_segments_;
   // @@protoc_insertion_point(copy_constructor:metricsys.GetPerformanceRequest)
 }
 
@@ -3981,6 +4924,9 @@ inline void GetPerformanceRequest::SharedCtor(
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
     , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){false}
   };
   _impl_.page_filter_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -4007,6 +4953,8 @@ inline void GetPerformanceRequest::SharedDtor() {
   _impl_.user_id_filter_.Destroy();
   if (this != internal_default_instance()) delete _impl_.time_range_;
   if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
 }
 
 void GetPerformanceRequest::SetCachedSize(int size) const {
@@ -4020,7 +4968,7 @@ void GetPerformanceRequest::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000003fu) {
     if (cached_has_bits & 0x00000001u) {
       _impl_.page_filter_.ClearNonDefaultToEmpty();
     }
@@ -4035,7 +4983,16 @@ void GetPerformanceRequest::Clear() {
       GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
       _impl_.pagination_->Clear();
     }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
   }
+  _impl_.allow_segments_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -4083,6 +5040,30 @@ const char* GetPerformanceRequest::_InternalParse(const char* ptr, ::_pbi::Parse
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor after = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4147,6 +5128,26 @@ uint8_t* GetPerformanceRequest::_InternalSerialize(
         4, this->_internal_user_id_filter(), target);
   }
 
+  // optional .metricsys.EventCursor after = 5;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 6;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 7;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_allow_segments(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4164,7 +5165,7 @@ size_t GetPerformanceRequest::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000003fu) {
     // optional string page_filter = 3;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -4193,7 +5194,26 @@ size_t GetPerformanceRequest::ByteSizeLong() const {
           *_impl_.pagination_);
     }
 
+    // optional .metricsys.EventCursor after = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
   }
+  // bool allow_segments = 7;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -4213,7 +5233,7 @@ void GetPerformanceRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg,
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x0000003fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_page_filter(from._internal_page_filter());
     }
@@ -4228,6 +5248,17 @@ void GetPerformanceRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg,
       _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
           from._internal_pagination());
     }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -4258,8 +5289,8 @@ void GetPerformanceRequest::InternalSwap(GetPerformanceRequest* other) {
       &other->_impl_.user_id_filter_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetPerformanceRequest, _impl_.pagination_)
-      + sizeof(GetPerformanceRequest::_impl_.pagination_)
+      PROTOBUF_FIELD_OFFSET(GetPerformanceRequest, _impl_.allow_segments_)
+      + sizeof(GetPerformanceRequest::_impl_.allow_segments_)
       - PROTOBUF_FIELD_OFFSET(GetPerformanceRequest, _impl_.time_range_)>(
           reinterpret_cast<char*>(&_impl_.time_range_),
           reinterpret_cast<char*>(&other->_impl_.time_range_));
@@ -4268,15 +5299,27 @@ void GetPerformanceRequest::InternalSwap(GetPerformanceRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata GetPerformanceRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[9]);
+      file_level_metadata_metrics_2eproto[10]);
 }
 
 // ===================================================================
 
 class GetPerformanceResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<GetPerformanceResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetPerformanceResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
+const ::metricsys::EventCursor&
+GetPerformanceResponse::_Internal::next_cursor(const GetPerformanceResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
 GetPerformanceResponse::GetPerformanceResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -4287,12 +5330,20 @@ GetPerformanceResponse::GetPerformanceResponse(const GetPerformanceResponse& fro
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   GetPerformanceResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){from._impl_.events_}
-    , decltype(_impl_.total_count_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.total_count_ = from._impl_.total_count_;
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
   // @@protoc_insertion_point(copy_constructor:metricsys.GetPerformanceResponse)
 }
 
@@ -4301,9 +5352,12 @@ inline void GetPerformanceResponse::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){arena}
-    , decltype(_impl_.total_count_){0}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
   };
 }
 
@@ -4319,6 +5373,7 @@ GetPerformanceResponse::~GetPerformanceResponse() {
 inline void GetPerformanceResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
 }
 
 void GetPerformanceResponse::SetCachedSize(int size) const {
@@ -4332,12 +5387,20 @@ void GetPerformanceResponse::Clear() {
   (void) cached_has_bits;
 
   _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
   _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 const char* GetPerformanceResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -4363,6 +5426,23 @@ const char* GetPerformanceResponse::_InternalParse(const char* ptr, ::_pbi::Pars
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4379,6 +5459,7 @@ const char* GetPerformanceResponse::_InternalParse(const char* ptr, ::_pbi::Pars
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -4406,6 +5487,19 @@ uint8_t* GetPerformanceResponse::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
   }
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -4429,6 +5523,21 @@ size_t GetPerformanceResponse::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
   // int32 total_count = 2;
   if (this->_internal_total_count() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
@@ -4453,6 +5562,17 @@ void GetPerformanceResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg,
   (void) cached_has_bits;
 
   _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
   if (from._internal_total_count() != 0) {
     _this->_internal_set_total_count(from._internal_total_count());
   }
@@ -4473,14 +5593,20 @@ bool GetPerformanceResponse::IsInitialized() const {
 void GetPerformanceResponse::InternalSwap(GetPerformanceResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.events_.InternalSwap(&other->_impl_.events_);
-  swap(_impl_.total_count_, other->_impl_.total_count_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetPerformanceResponse, _impl_.total_count_)
+      + sizeof(GetPerformanceResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetPerformanceResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetPerformanceResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[10]);
+      file_level_metadata_metrics_2eproto[11]);
 }
 
 // ===================================================================
@@ -4519,6 +5645,7 @@ ErrorEvent::ErrorEvent(const ErrorEvent& from)
     , decltype(_impl_.user_id_){}
     , decltype(_impl_.session_id_){}
     , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}
     , decltype(_impl_.severity_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
@@ -4599,6 +5726,7 @@ inline void ErrorEvent::SharedCtor(
     , decltype(_impl_.user_id_){}
     , decltype(_impl_.session_id_){}
     , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
     , decltype(_impl_.severity_){0}
   };
   _impl_.id_.InitDefault();
@@ -4778,6 +5906,14 @@ const char* ErrorEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
         } else
           goto handle_unusual;
         continue;
+      // int64 received_at = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -4888,7 +6024,13 @@ uint8_t* ErrorEvent::_InternalSerialize(
   // int64 timestamp = 9;
   if (this->_internal_timestamp() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_timestamp(), target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_timestamp(), target);
+  }
+
+  // int64 received_at = 10;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_received_at(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -4964,6 +6106,11 @@ size_t ErrorEvent::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
 
+  // int64 received_at = 10;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
   // .metricsys.Severity severity = 6;
   if (this->_internal_severity() != 0) {
     total_size += 1 +
@@ -5015,6 +6162,9 @@ void ErrorEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PRO
   if (from._internal_timestamp() != 0) {
     _this->_internal_set_timestamp(from._internal_timestamp());
   }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
   if (from._internal_severity() != 0) {
     _this->_internal_set_severity(from._internal_severity());
   }
@@ -5077,7 +6227,7 @@ void ErrorEvent::InternalSwap(ErrorEvent* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata ErrorEvent::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[11]);
+      file_level_metadata_metrics_2eproto[12]);
 }
 
 // ===================================================================
@@ -5097,7 +6247,7 @@ class GetErrorsRequest::_Internal {
     (*has_bits)[0] |= 1u;
   }
   static void set_has_severity_filter(HasBits* has_bits) {
-    (*has_bits)[0] |= 32u;
+    (*has_bits)[0] |= 128u;
   }
   static void set_has_error_type_filter(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
@@ -5105,6 +6255,14 @@ class GetErrorsRequest::_Internal {
   static void set_has_user_id_filter(HasBits* has_bits) {
     (*has_bits)[0] |= 4u;
   }
+  static const ::metricsys::EventCursor& after(const GetErrorsRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetErrorsRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
 };
 
 const ::metricsys::TimeRange&
@@ -5115,6 +6273,14 @@ const ::metricsys::Pagination&
 GetErrorsRequest::_Internal::pagination(const GetErrorsRequest* msg) {
   return *msg->_impl_.pagination_;
 }
+const ::metricsys::EventCursor&
+GetErrorsRequest::_Internal::after(const GetErrorsRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetErrorsRequest::_Internal::received_range(const GetErrorsRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
 GetErrorsRequest::GetErrorsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -5132,7 +6298,10 @@ GetErrorsRequest::GetErrorsRequest(const GetErrorsRequest& from)
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
     , decltype(_impl_.pagination_){nullptr}
-    , decltype(_impl_.severity_filter_){}};
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.severity_filter_){}
+    , decltype(_impl_.allow_segments_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.page_filter_.InitDefault();
@@ -5165,7 +6334,15 @@ GetErrorsRequest::GetErrorsRequest(const GetErrorsRequest& from)
   if (from._internal_has_pagination()) {
     _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
   }
-  _this->_impl_.severity_filter_ = from._impl_.severity_filter_;
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  ::memcpy(&_impl_.severity_filter_, &from._impl_.severity_filter_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.allow_segments_) -
+    reinterpret_cast<char*>(&_impl_.severity_filter_)) + sizeof(_impl_.allow_segments_));
   // @@protoc_insertion_point(copy_constructor:metricsys.GetErrorsRequest)
 }
 
@@ -5181,7 +6358,10 @@ inline void GetErrorsRequest::SharedCtor(
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
     , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
     , decltype(_impl_.severity_filter_){0}
+    , decltype(_impl_.allow_segments_){false}
   };
   _impl_.page_filter_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -5213,6 +6393,8 @@ inline void GetErrorsRequest::SharedDtor() {
   _impl_.user_id_filter_.Destroy();
   if (this != internal_default_instance()) delete _impl_.time_range_;
   if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
 }
 
 void GetErrorsRequest::SetCachedSize(int size) const {
@@ -5226,7 +6408,7 @@ void GetErrorsRequest::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
       _impl_.page_filter_.ClearNonDefaultToEmpty();
     }
@@ -5244,8 +6426,17 @@ void GetErrorsRequest::Clear() {
       GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
       _impl_.pagination_->Clear();
     }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
   }
   _impl_.severity_filter_ = 0;
+  _impl_.allow_segments_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -5312,6 +6503,30 @@ const char* GetErrorsRequest::_InternalParse(const char* ptr, ::_pbi::ParseConte
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor after = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -5393,6 +6608,26 @@ uint8_t* GetErrorsRequest::_InternalSerialize(
         6, this->_internal_user_id_filter(), target);
   }
 
+  // optional .metricsys.EventCursor after = 7;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 8;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 9;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_allow_segments(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -5410,7 +6645,7 @@ size_t GetErrorsRequest::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000003fu) {
+  if (cached_has_bits & 0x000000ffu) {
     // optional string page_filter = 3;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -5446,13 +6681,32 @@ size_t GetErrorsRequest::ByteSizeLong() const {
           *_impl_.pagination_);
     }
 
-    // optional .metricsys.Severity severity_filter = 4;
+    // optional .metricsys.EventCursor after = 7;
     if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
+    // optional .metricsys.Severity severity_filter = 4;
+    if (cached_has_bits & 0x00000080u) {
       total_size += 1 +
         ::_pbi::WireFormatLite::EnumSize(this->_internal_severity_filter());
     }
 
   }
+  // bool allow_segments = 9;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -5472,7 +6726,7 @@ void GetErrorsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000003fu) {
+  if (cached_has_bits & 0x000000ffu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_page_filter(from._internal_page_filter());
     }
@@ -5491,10 +6745,21 @@ void GetErrorsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
           from._internal_pagination());
     }
     if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+    if (cached_has_bits & 0x00000080u) {
       _this->_impl_.severity_filter_ = from._impl_.severity_filter_;
     }
     _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -5528,8 +6793,8 @@ void GetErrorsRequest::InternalSwap(GetErrorsRequest* other) {
       &other->_impl_.user_id_filter_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetErrorsRequest, _impl_.severity_filter_)
-      + sizeof(GetErrorsRequest::_impl_.severity_filter_)
+      PROTOBUF_FIELD_OFFSET(GetErrorsRequest, _impl_.allow_segments_)
+      + sizeof(GetErrorsRequest::_impl_.allow_segments_)
       - PROTOBUF_FIELD_OFFSET(GetErrorsRequest, _impl_.time_range_)>(
           reinterpret_cast<char*>(&_impl_.time_range_),
           reinterpret_cast<char*>(&other->_impl_.time_range_));
@@ -5538,15 +6803,27 @@ void GetErrorsRequest::InternalSwap(GetErrorsRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata GetErrorsRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[12]);
+      file_level_metadata_metrics_2eproto[13]);
 }
 
 // ===================================================================
 
 class GetErrorsResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<GetErrorsResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetErrorsResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
+const ::metricsys::EventCursor&
+GetErrorsResponse::_Internal::next_cursor(const GetErrorsResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
 GetErrorsResponse::GetErrorsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -5557,12 +6834,20 @@ GetErrorsResponse::GetErrorsResponse(const GetErrorsResponse& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   GetErrorsResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){from._impl_.events_}
-    , decltype(_impl_.total_count_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.total_count_ = from._impl_.total_count_;
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
   // @@protoc_insertion_point(copy_constructor:metricsys.GetErrorsResponse)
 }
 
@@ -5571,9 +6856,12 @@ inline void GetErrorsResponse::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){arena}
-    , decltype(_impl_.total_count_){0}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
   };
 }
 
@@ -5589,6 +6877,7 @@ GetErrorsResponse::~GetErrorsResponse() {
 inline void GetErrorsResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
 }
 
 void GetErrorsResponse::SetCachedSize(int size) const {
@@ -5602,12 +6891,20 @@ void GetErrorsResponse::Clear() {
   (void) cached_has_bits;
 
   _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
   _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 const char* GetErrorsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -5633,6 +6930,23 @@ const char* GetErrorsResponse::_InternalParse(const char* ptr, ::_pbi::ParseCont
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -5649,6 +6963,7 @@ const char* GetErrorsResponse::_InternalParse(const char* ptr, ::_pbi::ParseCont
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -5676,6 +6991,19 @@ uint8_t* GetErrorsResponse::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
   }
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -5699,6 +7027,21 @@ size_t GetErrorsResponse::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
   // int32 total_count = 2;
   if (this->_internal_total_count() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
@@ -5723,6 +7066,17 @@ void GetErrorsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, cons
   (void) cached_has_bits;
 
   _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
   if (from._internal_total_count() != 0) {
     _this->_internal_set_total_count(from._internal_total_count());
   }
@@ -5743,14 +7097,20 @@ bool GetErrorsResponse::IsInitialized() const {
 void GetErrorsResponse::InternalSwap(GetErrorsResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.events_.InternalSwap(&other->_impl_.events_);
-  swap(_impl_.total_count_, other->_impl_.total_count_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetErrorsResponse, _impl_.total_count_)
+      + sizeof(GetErrorsResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetErrorsResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetErrorsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[13]);
+      file_level_metadata_metrics_2eproto[14]);
 }
 
 // ===================================================================
@@ -5764,7 +7124,7 @@ void CustomEvent_PropertiesEntry_DoNotUse::MergeFrom(const CustomEvent_Propertie
 ::PROTOBUF_NAMESPACE_ID::Metadata CustomEvent_PropertiesEntry_DoNotUse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[14]);
+      file_level_metadata_metrics_2eproto[15]);
 }
 
 // ===================================================================
@@ -5804,7 +7164,8 @@ CustomEvent::CustomEvent(const CustomEvent& from)
     , decltype(_impl_.page_){}
     , decltype(_impl_.user_id_){}
     , decltype(_impl_.session_id_){}
-    , decltype(_impl_.timestamp_){}};
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _this->_impl_.properties_.MergeFrom(from._impl_.properties_);
@@ -5848,7 +7209,9 @@ CustomEvent::CustomEvent(const CustomEvent& from)
     _this->_impl_.session_id_.Set(from._internal_session_id(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.timestamp_ = from._impl_.timestamp_;
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.received_at_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
   // @@protoc_insertion_point(copy_constructor:metricsys.CustomEvent)
 }
 
@@ -5866,6 +7229,7 @@ inline void CustomEvent::SharedCtor(
     , decltype(_impl_.user_id_){}
     , decltype(_impl_.session_id_){}
     , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
   };
   _impl_.id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -5939,7 +7303,9 @@ void CustomEvent::Clear() {
       _impl_.session_id_.ClearNonDefaultToEmpty();
     }
   }
-  _impl_.timestamp_ = int64_t{0};
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.received_at_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -6022,6 +7388,14 @@ const char* CustomEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* c
         } else
           goto handle_unusual;
         continue;
+      // int64 received_at = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -6138,6 +7512,12 @@ uint8_t* CustomEvent::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_timestamp(), target);
   }
 
+  // int64 received_at = 8;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_received_at(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -6206,6 +7586,11 @@ size_t CustomEvent::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
   }
 
+  // int64 received_at = 8;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -6246,6 +7631,9 @@ void CustomEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PR
   if (from._internal_timestamp() != 0) {
     _this->_internal_set_timestamp(from._internal_timestamp());
   }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -6287,13 +7675,18 @@ void CustomEvent::InternalSwap(CustomEvent* other) {
       &_impl_.session_id_, lhs_arena,
       &other->_impl_.session_id_, rhs_arena
   );
-  swap(_impl_.timestamp_, other->_impl_.timestamp_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CustomEvent, _impl_.received_at_)
+      + sizeof(CustomEvent::_impl_.received_at_)
+      - PROTOBUF_FIELD_OFFSET(CustomEvent, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata CustomEvent::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[15]);
+      file_level_metadata_metrics_2eproto[16]);
 }
 
 // ===================================================================
@@ -6318,6 +7711,14 @@ class GetCustomEventsRequest::_Internal {
   static void set_has_user_id_filter(HasBits* has_bits) {
     (*has_bits)[0] |= 4u;
   }
+  static const ::metricsys::EventCursor& after(const GetCustomEventsRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetCustomEventsRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
 };
 
 const ::metricsys::TimeRange&
@@ -6328,6 +7729,14 @@ const ::metricsys::Pagination&
 GetCustomEventsRequest::_Internal::pagination(const GetCustomEventsRequest* msg) {
   return *msg->_impl_.pagination_;
 }
+const ::metricsys::EventCursor&
+GetCustomEventsRequest::_Internal::after(const GetCustomEventsRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetCustomEventsRequest::_Internal::received_range(const GetCustomEventsRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
 GetCustomEventsRequest::GetCustomEventsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -6344,7 +7753,10 @@ GetCustomEventsRequest::GetCustomEventsRequest(const GetCustomEventsRequest& fro
     , decltype(_impl_.page_filter_){}
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
-    , decltype(_impl_.pagination_){nullptr}};
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.name_filter_.InitDefault();
@@ -6377,6 +7789,13 @@ GetCustomEventsRequest::GetCustomEventsRequest(const GetCustomEventsRequest& fro
   if (from._internal_has_pagination()) {
     _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
   }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  _this->_impl_.allow_segments_ = from._impl_.allow_segments_;
   // @@protoc_insertion_point(copy_constructor:metricsys.GetCustomEventsRequest)
 }
 
@@ -6392,6 +7811,9 @@ inline void GetCustomEventsRequest::SharedCtor(
     , decltype(_impl_.user_id_filter_){}
     , decltype(_impl_.time_range_){nullptr}
     , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){false}
   };
   _impl_.name_filter_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -6423,6 +7845,8 @@ inline void GetCustomEventsRequest::SharedDtor() {
   _impl_.user_id_filter_.Destroy();
   if (this != internal_default_instance()) delete _impl_.time_range_;
   if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
 }
 
 void GetCustomEventsRequest::SetCachedSize(int size) const {
@@ -6436,7 +7860,7 @@ void GetCustomEventsRequest::Clear() {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
       _impl_.name_filter_.ClearNonDefaultToEmpty();
     }
@@ -6454,7 +7878,16 @@ void GetCustomEventsRequest::Clear() {
       GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
       _impl_.pagination_->Clear();
     }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
   }
+  _impl_.allow_segments_ = false;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -6512,6 +7945,30 @@ const char* GetCustomEventsRequest::_InternalParse(const char* ptr, ::_pbi::Pars
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor after = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -6586,6 +8043,26 @@ uint8_t* GetCustomEventsRequest::_InternalSerialize(
         5, this->_internal_user_id_filter(), target);
   }
 
+  // optional .metricsys.EventCursor after = 6;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 7;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 8;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_allow_segments(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -6603,7 +8080,7 @@ size_t GetCustomEventsRequest::ByteSizeLong() const {
   (void) cached_has_bits;
 
   cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000007fu) {
     // optional string name_filter = 3;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
@@ -6639,7 +8116,26 @@ size_t GetCustomEventsRequest::ByteSizeLong() const {
           *_impl_.pagination_);
     }
 
+    // optional .metricsys.EventCursor after = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
   }
+  // bool allow_segments = 8;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -6659,7 +8155,7 @@ void GetCustomEventsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg,
   (void) cached_has_bits;
 
   cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
+  if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
       _this->_internal_set_name_filter(from._internal_name_filter());
     }
@@ -6677,6 +8173,17 @@ void GetCustomEventsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg,
       _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
           from._internal_pagination());
     }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -6711,8 +8218,8 @@ void GetCustomEventsRequest::InternalSwap(GetCustomEventsRequest* other) {
       &other->_impl_.user_id_filter_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(GetCustomEventsRequest, _impl_.pagination_)
-      + sizeof(GetCustomEventsRequest::_impl_.pagination_)
+      PROTOBUF_FIELD_OFFSET(GetCustomEventsRequest, _impl_.allow_segments_)
+      + sizeof(GetCustomEventsRequest::_impl_.allow_segments_)
       - PROTOBUF_FIELD_OFFSET(GetCustomEventsRequest, _impl_.time_range_)>(
           reinterpret_cast<char*>(&_impl_.time_range_),
           reinterpret_cast<char*>(&other->_impl_.time_range_));
@@ -6721,15 +8228,27 @@ void GetCustomEventsRequest::InternalSwap(GetCustomEventsRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata GetCustomEventsRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[16]);
+      file_level_metadata_metrics_2eproto[17]);
 }
 
 // ===================================================================
 
 class GetCustomEventsResponse::_Internal {
  public:
+  using HasBits = decltype(std::declval<GetCustomEventsResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetCustomEventsResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
+const ::metricsys::EventCursor&
+GetCustomEventsResponse::_Internal::next_cursor(const GetCustomEventsResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
 GetCustomEventsResponse::GetCustomEventsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -6740,12 +8259,20 @@ GetCustomEventsResponse::GetCustomEventsResponse(const GetCustomEventsResponse&
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   GetCustomEventsResponse* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){from._impl_.events_}
-    , decltype(_impl_.total_count_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.total_count_ = from._impl_.total_count_;
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
   // @@protoc_insertion_point(copy_constructor:metricsys.GetCustomEventsResponse)
 }
 
@@ -6754,9 +8281,12 @@ inline void GetCustomEventsResponse::SharedCtor(
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.events_){arena}
-    , decltype(_impl_.total_count_){0}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
   };
 }
 
@@ -6772,6 +8302,7 @@ GetCustomEventsResponse::~GetCustomEventsResponse() {
 inline void GetCustomEventsResponse::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
 }
 
 void GetCustomEventsResponse::SetCachedSize(int size) const {
@@ -6785,12 +8316,20 @@ void GetCustomEventsResponse::Clear() {
   (void) cached_has_bits;
 
   _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
   _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
 const char* GetCustomEventsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
@@ -6816,6 +8355,23 @@ const char* GetCustomEventsResponse::_InternalParse(const char* ptr, ::_pbi::Par
         } else
           goto handle_unusual;
         continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -6832,6 +8388,7 @@ const char* GetCustomEventsResponse::_InternalParse(const char* ptr, ::_pbi::Par
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -6859,6 +8416,19 @@ uint8_t* GetCustomEventsResponse::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
   }
 
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -6882,6 +8452,21 @@ size_t GetCustomEventsResponse::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
   // int32 total_count = 2;
   if (this->_internal_total_count() != 0) {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
@@ -6906,6 +8491,17 @@ void GetCustomEventsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg
   (void) cached_has_bits;
 
   _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
   if (from._internal_total_count() != 0) {
     _this->_internal_set_total_count(from._internal_total_count());
   }
@@ -6926,14 +8522,20 @@ bool GetCustomEventsResponse::IsInitialized() const {
 void GetCustomEventsResponse::InternalSwap(GetCustomEventsResponse* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   _impl_.events_.InternalSwap(&other->_impl_.events_);
-  swap(_impl_.total_count_, other->_impl_.total_count_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetCustomEventsResponse, _impl_.total_count_)
+      + sizeof(GetCustomEventsResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetCustomEventsResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata GetCustomEventsResponse::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
-      file_level_metadata_metrics_2eproto[17]);
+      file_level_metadata_metrics_2eproto[18]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -6947,6 +8549,10 @@ template<> PROTOBUF_NOINLINE ::metricsys::Pagination*
 Arena::CreateMaybeMessage< ::metricsys::Pagination >(Arena* arena) {
   return Arena::CreateMessageInternal< ::metricsys::Pagination >(arena);
 }
+template<> PROTOBUF_NOINLINE ::metricsys::EventCursor*
+Arena::CreateMaybeMessage< ::metricsys::EventCursor >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::EventCursor >(arena);
+}
 template<> PROTOBUF_NOINLINE ::metricsys::PageViewEvent*
 Arena::CreateMaybeMessage< ::metricsys::PageViewEvent >(Arena* arena) {
   return Arena::CreateMessageInternal< ::metricsys::PageViewEvent >(arena);
@@ -1,16 +1,46 @@
 #include "metrics_client.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
 
 namespace aggregation {
 
-MetricsClient::MetricsClient(const std::string& host, const std::string& port)
-    : projectId_("default-project")
+namespace {
+
+// Сколько раз подряд переоткрывать оборвавшийся поток без прогресса
+constexpr int MAX_STREAM_RETRIES = 3;
+
+bool isRetryable(const grpc::Status& status) {
+    switch (status.error_code()) {
+        case grpc::StatusCode::UNAVAILABLE:
+        case grpc::StatusCode::DEADLINE_EXCEEDED:
+        case grpc::StatusCode::RESOURCE_EXHAUSTED:
+        case grpc::StatusCode::ABORTED:
+            return true;
+        default:
+            return false;
+    }
+}
+
+} // namespace
+
+MetricsClient::MetricsClient(const std::string& host, const std::string& port, int chunkSize,
+                             std::chrono::milliseconds callTimeout)
+    : projectId_("default-project"),
+      chunkSize_(chunkSize > 0 ? chunkSize : DEFAULT_CHUNK_SIZE),
+      callTimeout_(callTimeout.count() > 0 ? callTimeout : DEFAULT_CALL_TIMEOUT)
 {
     std::string target = host + ":" + port;
     channel_ = grpc::CreateChannel(target, grpc::InsecureChannelCredentials());
     stub_ = metricsys::MetricsService::NewStub(channel_);
-    std::cout << "MetricsClient: connecting to " << target << std::endl;
+    std::cout << "MetricsClient: connecting to " << target
+              << " (chunk size " << chunkSize_
+              << ", call timeout " << callTimeout_.count() << " ms)" << std::endl;
 }
 
 MetricsClient::~MetricsClient() = default;
@@ -38,6 +68,25 @@ metricsys::TimeRange MetricsClient::makeTimeRange(
     return range;
 }
 
+metricsys::Pagination MetricsClient::makePagination() const {
+    // В Stream* RPC limit — размер чанка, а не ограничение выборки
+    metricsys::Pagination pagination;
+    pagination.set_limit(chunkSize_);
+    return pagination;
+}
+
+template <typename Event>
+void MetricsClient::appendCommon(EventColumns& batch, SymbolId projectId, const Event& event,
+                                 SymbolTable& symbols) const {
+    // Событие не может быть позже своего приёма: бакеты до watermark тогда
+    // содержат только события, принятые до него, и перечитывание с watermark точное
+    auto receivedAt = timestampToTimePoint(event.received_at());
+    auto timestamp = std::min(timestampToTimePoint(event.timestamp()), receivedAt);
+    // Неустановленные optional-поля protobuf отдают "", то есть EMPTY_SYMBOL
+    batch.append(projectId, symbols.intern(event.page()), symbols.intern(event.user_id()),
+                 symbols.intern(event.session_id()), timestamp, receivedAt);
+}
+
 std::chrono::system_clock::time_point MetricsClient::timestampToTimePoint(int64_t ts) const {
     // metrics-service возвращает EXTRACT(EPOCH FROM timestamp) - это секунды
     return std::chrono::system_clock::time_point(
@@ -45,229 +94,462 @@ std::chrono::system_clock::time_point MetricsClient::timestampToTimePoint(int64_
     );
 }
 
-std::vector<RawEvent> MetricsClient::fetchAllEvents(
-    std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to
-) {
-    std::vector<RawEvent> allEvents;
+// ===== Потоковое чтение через callback API =====
+
+// Общее состояние одного запуска runStreams
+struct MetricsClient::StreamGroup {
+    StreamGroup(SymbolTable& symbols, const ChunkHandler& onChunk) : symbols(symbols), onChunk(onChunk) {}
 
-    auto pageViews = fetchPageViews(from, to);
-    allEvents.insert(allEvents.end(), pageViews.begin(), pageViews.end());
+    SymbolTable& symbols;
+    const ChunkHandler& onChunk;
+    std::mutex chunkMutex;  // сериализует заполнение чанков (общий symbols) и вызовы onChunk
 
-    auto clicks = fetchClicks(from, to);
-    allEvents.insert(allEvents.end(), clicks.begin(), clicks.end());
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<EventStream*> completed;  // завершившиеся вызовы, ещё не разобранные
 
-    auto performance = fetchPerformance(from, to);
-    allEvents.insert(allEvents.end(), performance.begin(), performance.end());
+    template <typename Fill>
+    void deliver(const EventBatches& chunk, Fill&& fill) {
+        std::lock_guard<std::mutex> lock(chunkMutex);
+        fill(symbols);
+        onChunk(chunk);
+    }
 
-    auto errors = fetchErrors(from, to);
-    allEvents.insert(allEvents.end(), errors.begin(), errors.end());
+    void finished(EventStream* stream) {
+        std::lock_guard<std::mutex> lock(mutex);
+        completed.push_back(stream);
+        cv.notify_all();
+    }
+};
+
+// Чтение одного типа событий. Переживает свои вызовы: start() после
+// обрыва открывает новый вызов с курсором на последнее полученное событие.
+class MetricsClient::EventStream {
+public:
+    explicit EventStream(const char* name) : name_(name) {}
+    virtual ~EventStream() = default;
+
+    virtual void start(metricsys::MetricsService::Stub* stub, StreamGroup& group,
+                       std::chrono::milliseconds timeout) = 0;
+    virtual void cancel() = 0;
+
+    const char* name() const { return name_; }
+    int64_t total() const { return total_; }
+    // Докуда metrics-service отдал окно (received_until); пусто — сервер окно не урезает
+    std::optional<int64_t> receivedUntil() const { return receivedUntil_; }
+    int failures() const { return failures_; }
+    const grpc::Status& status() const { return status_; }
+    bool done() const { return status_.ok(); }
+    // Ошибка, после которой поток не переоткрывается
+    bool fatal() const {
+        return !status_.ok() && (!isRetryable(status_) || failures_ > MAX_STREAM_RETRIES);
+    }
 
-    auto custom = fetchCustomEvents(from, to);
-    allEvents.insert(allEvents.end(), custom.begin(), custom.end());
+protected:
+    void finishCall(const grpc::Status& status) {
+        status_ = status;
+        if (!status.ok()) {
+            failures_ = progressed_ ? 1 : failures_ + 1;
+        }
+    }
 
-    std::cout << "MetricsClient: fetched " << allEvents.size() << " total events" << std::endl;
-    return allEvents;
-}
+    const char* name_;
+    int64_t total_ = 0;
+    std::optional<int64_t> receivedUntil_;
+    int failures_ = 0;
+    bool progressed_ = false;
+    grpc::Status status_{grpc::StatusCode::UNKNOWN, "not started"};
+};
+
+template <typename Request, typename Response>
+class MetricsClient::TypedEventStream final
+    : public MetricsClient::EventStream, public grpc::ClientReadReactor<Response> {
+public:
+    using Starter = void (metricsys::MetricsService::StubInterface::async_interface::*)(
+        grpc::ClientContext*, const Request*, grpc::ClientReadReactor<Response>*);
+
+    TypedEventStream(const char* name, const MetricsClient& client, Request request, Starter starter)
+        : EventStream(name), client_(client), request_(std::move(request)), starter_(starter) {
+    }
 
-std::vector<RawEvent> MetricsClient::fetchPageViews(
-    std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to
-) {
-    std::vector<RawEvent> result;
+    void start(metricsys::MetricsService::Stub* stub, StreamGroup& group,
+               std::chrono::milliseconds timeout) override {
+        group_ = &group;
+        progressed_ = false;
+        context_ = std::make_unique<grpc::ClientContext>();
+        context_->set_deadline(std::chrono::system_clock::now() + timeout);
 
-    metricsys::GetPageViewsRequest request;
-    *request.mutable_time_range() = makeTimeRange(from, to);
+        (stub->async()->*starter_)(context_.get(), &request_, this);
+        this->StartRead(&response_);
+        this->StartCall();
+    }
 
-    metricsys::GetPageViewsResponse response;
-    grpc::ClientContext context;
+    void cancel() override {
+        context_->TryCancel();
+    }
 
-    grpc::Status status = stub_->GetPageViews(&context, request, &response);
+    void OnReadDone(bool ok) override {
+        if (!ok) {
+            return;  // поток закончился, дальше придёт OnDone
+        }
 
-    if (!status.ok()) {
-        std::cerr << "MetricsClient: GetPageViews error - "
-                  << status.error_code() << ": "
-                  << status.error_message() << std::endl;
-        return result;
+        // Повторный вызов после обрыва просит то же, уже урезанное окно
+        if (response_.has_received_until()) {
+            receivedUntil_ = response_.received_until();
+            request_.mutable_received_range()->set_end_timestamp(response_.received_until());
+        }
+
+        if (response_.events_size() > 0) {
+            chunk_.clear();
+            group_->deliver(chunk_, [this](SymbolTable& symbols) {
+                client_.appendEvents(response_, symbols, chunk_);
+            });
+            total_ += static_cast<int64_t>(chunk_.size());
+        }
+
+        // Курсор на последнее обработанное событие: при обрыве продолжаем с него
+        if (response_.has_next_cursor()) {
+            *request_.mutable_after() = response_.next_cursor();
+        }
+        progressed_ = true;
+
+        this->StartRead(&response_);
     }
 
-    for (const auto& event : response.events()) {
-        RawEvent raw;
-        raw.projectId = projectId_;
-        raw.page = event.page();
-        raw.eventType = "page_view";
-        raw.isError = false;
-        raw.userId = event.has_user_id() ? event.user_id() : "";
-        raw.sessionId = event.has_session_id() ? event.session_id() : "";
-        raw.timestamp = timestampToTimePoint(event.timestamp());
-        result.push_back(raw);
+    void OnDone(const grpc::Status& status) override {
+        finishCall(status);
+        group_->finished(this);
     }
 
-    std::cout << "MetricsClient: received " << result.size() << " page_view events" << std::endl;
-    return result;
-}
+private:
+    const MetricsClient& client_;
+    Request request_;
+    Starter starter_;
+    StreamGroup* group_ = nullptr;
+    std::unique_ptr<grpc::ClientContext> context_;
+    Response response_;
+    EventBatches chunk_;
+};
+
+int64_t MetricsClient::runStreams(StreamList& streams, SymbolTable& symbols, const ChunkHandler& onChunk,
+                                  std::chrono::system_clock::time_point* receivedUntil) {
+    using Clock = std::chrono::steady_clock;
+
+    StreamGroup group{symbols, onChunk};
+    size_t running = 0;
+    // Оборвавшиеся потоки ждут повторного запуска, остальные в это время читаются
+    std::vector<std::pair<Clock::time_point, EventStream*>> delayed;
+    EventStream* failed = nullptr;
+
+    for (auto& stream : streams) {
+        stream->start(stub_.get(), group, callTimeout_);
+        ++running;
+    }
 
-std::vector<RawEvent> MetricsClient::fetchClicks(
-    std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to
-) {
-    std::vector<RawEvent> result;
+    std::unique_lock<std::mutex> lock(group.mutex);
+    while (running > 0 || (!delayed.empty() && !failed)) {
+        if (group.completed.empty()) {
+            if (!delayed.empty() && !failed) {
+                auto next = std::min_element(delayed.begin(), delayed.end())->first;
+                group.cv.wait_until(lock, next);
+            } else {
+                group.cv.wait(lock);
+            }
+        }
 
-    metricsys::GetClicksRequest request;
-    *request.mutable_time_range() = makeTimeRange(from, to);
+        std::vector<EventStream*> completed;
+        std::swap(completed, group.completed);
+        running -= completed.size();
+
+        for (auto* stream : completed) {
+            if (stream->done()) {
+                continue;
+            }
+            std::cerr << "MetricsClient: " << stream->name() << " error - "
+                      << stream->status().error_code() << ": "
+                      << stream->status().error_message() << std::endl;
+
+            if (failed) {
+                continue;  // остальные потоки завершаются после нашей же отмены
+            }
+            if (stream->fatal()) {
+                // Частичный результат не нужен — не ждём остальных до дедлайна
+                failed = stream;
+                for (auto& other : streams) {
+                    if (other.get() != stream) {
+                        other->cancel();
+                    }
+                }
+                continue;
+            }
+
+            std::cerr << "MetricsClient: resuming " << stream->name() << " after "
+                      << stream->total() << " events (attempt " << stream->failures() << ")" << std::endl;
+            delayed.emplace_back(Clock::now() + std::chrono::milliseconds(200 * stream->failures()), stream);
+        }
 
-    metricsys::GetClicksResponse response;
-    grpc::ClientContext context;
+        if (failed) {
+            delayed.clear();
+            continue;
+        }
 
-    grpc::Status status = stub_->GetClicks(&context, request, &response);
+        // Перезапускаем тех, у кого истекла пауза (без блокировки: колбэки
+        // вызовов сами берут group.mutex)
+        std::vector<EventStream*> due;
+        auto now = Clock::now();
+        for (auto it = delayed.begin(); it != delayed.end();) {
+            if (it->first <= now) {
+                due.push_back(it->second);
+                it = delayed.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        if (!due.empty()) {
+            running += due.size();
+            lock.unlock();
+            for (auto* stream : due) {
+                stream->start(stub_.get(), group, callTimeout_);
+            }
+            lock.lock();
+        }
+    }
+    lock.unlock();
 
-    if (!status.ok()) {
-        std::cerr << "MetricsClient: GetClicks error - "
-                  << status.error_code() << ": "
-                  << status.error_message() << std::endl;
-        return result;
+    if (failed) {
+        throw std::runtime_error(std::string(failed->name()) + " failed after " +
+                                 std::to_string(failed->total()) + " events: " +
+                                 failed->status().error_message());
     }
 
-    for (const auto& event : response.events()) {
-        RawEvent raw;
-        raw.projectId = projectId_;
-        raw.page = event.page();
-        raw.eventType = "click";
-        raw.isError = false;
-        raw.userId = event.has_user_id() ? event.user_id() : "";
-        raw.sessionId = event.has_session_id() ? event.session_id() : "";
-        raw.timestamp = timestampToTimePoint(event.timestamp());
-        raw.elementId = event.element_id();
-        result.push_back(raw);
+    // Потоки, урезанные до разных горизонтов, прочитали разные окна: следующее
+    // окно началось бы с дублей в одних типах событий, поэтому результат не годится
+    std::optional<int64_t> until;
+    for (const auto& stream : streams) {
+        auto end = stream->receivedUntil();
+        if (!end) {
+            continue;
+        }
+        if (until && *until != *end) {
+            throw std::runtime_error("metrics-service streams ended at different ingest horizons (" +
+                                     std::to_string(*until) + " and " + std::to_string(*end) + ")");
+        }
+        until = end;
+    }
+    if (until && receivedUntil) {
+        *receivedUntil = std::min(*receivedUntil, timestampToTimePoint(*until));
     }
 
-    std::cout << "MetricsClient: received " << result.size() << " click events" << std::endl;
-    return result;
+    int64_t total = 0;
+    for (const auto& stream : streams) {
+        std::cout << "MetricsClient: received " << stream->total() << " events from "
+                  << stream->name() << std::endl;
+        total += stream->total();
+    }
+    return total;
 }
 
-std::vector<RawEvent> MetricsClient::fetchPerformance(
+std::unique_ptr<MetricsClient::EventStream> MetricsClient::makePageViewsStream(
     std::chrono::system_clock::time_point from,
     std::chrono::system_clock::time_point to
 ) {
-    std::vector<RawEvent> result;
-
-    metricsys::GetPerformanceRequest request;
-    *request.mutable_time_range() = makeTimeRange(from, to);
+    metricsys::GetPageViewsRequest request;
+    *request.mutable_received_range() = makeTimeRange(from, to);
+    *request.mutable_pagination() = makePagination();
+    request.set_allow_segments(true);
 
-    metricsys::GetPerformanceResponse response;
-    grpc::ClientContext context;
+    return std::make_unique<TypedEventStream<metricsys::GetPageViewsRequest, metricsys::GetPageViewsResponse>>(
+        "StreamPageViews", *this, std::move(request),
+        &metricsys::MetricsService::StubInterface::async_interface::StreamPageViews);
+}
 
-    grpc::Status status = stub_->GetPerformance(&context, request, &response);
+std::unique_ptr<MetricsClient::EventStream> MetricsClient::makeClicksStream(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to
+) {
+    metricsys::GetClicksRequest request;
+    *request.mutable_received_range() = makeTimeRange(from, to);
+    *request.mutable_pagination() = makePagination();
+    request.set_allow_segments(true);
 
-    if (!status.ok()) {
-        std::cerr << "MetricsClient: GetPerformance error - "
-                  << status.error_code() << ": "
-                  << status.error_message() << std::endl;
-        return result;
-    }
+    return std::make_unique<TypedEventStream<metricsys::GetClicksRequest, metricsys::GetClicksResponse>>(
+        "StreamClicks", *this, std::move(request),
+        &metricsys::MetricsService::StubInterface::async_interface::StreamClicks);
+}
 
-    for (const auto& event : response.events()) {
-        RawEvent raw;
-        raw.projectId = projectId_;
-        raw.page = event.page();
-        raw.eventType = "performance";
-        raw.isError = false;
-        raw.userId = event.has_user_id() ? event.user_id() : "";
-        raw.sessionId = event.has_session_id() ? event.session_id() : "";
-        raw.timestamp = timestampToTimePoint(event.timestamp());
-
-        // Performance metrics from proto
-        raw.totalPageLoadMs = event.has_total_page_load_ms() ? event.total_page_load_ms() : 0.0;
-        raw.ttfbMs = event.has_ttfb_ms() ? event.ttfb_ms() : 0.0;
-        raw.fcpMs = event.has_fcp_ms() ? event.fcp_ms() : 0.0;
-        raw.lcpMs = event.has_lcp_ms() ? event.lcp_ms() : 0.0;
-
-        result.push_back(raw);
-    }
+std::unique_ptr<MetricsClient::EventStream> MetricsClient::makePerformanceStream(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to
+) {
+    metricsys::GetPerformanceRequest request;
+    *request.mutable_received_range() = makeTimeRange(from, to);
+    *request.mutable_pagination() = makePagination();
+    request.set_allow_segments(true);
 
-    std::cout << "MetricsClient: received " << result.size() << " performance events" << std::endl;
-    return result;
+    return std::make_unique<TypedEventStream<metricsys::GetPerformanceRequest, metricsys::GetPerformanceResponse>>(
+        "StreamPerformance", *this, std::move(request),
+        &metricsys::MetricsService::StubInterface::async_interface::StreamPerformance);
 }
 
-std::vector<RawEvent> MetricsClient::fetchErrors(
+std::unique_ptr<MetricsClient::EventStream> MetricsClient::makeErrorsStream(
     std::chrono::system_clock::time_point from,
     std::chrono::system_clock::time_point to
 ) {
-    std::vector<RawEvent> result;
-
     metricsys::GetErrorsRequest request;
-    *request.mutable_time_range() = makeTimeRange(from, to);
+    *request.mutable_received_range() = makeTimeRange(from, to);
+    *request.mutable_pagination() = makePagination();
+    request.set_allow_segments(true);
 
-    metricsys::GetErrorsResponse response;
-    grpc::ClientContext context;
+    return std::make_unique<TypedEventStream<metricsys::GetErrorsRequest, metricsys::GetErrorsResponse>>(
+        "StreamErrors", *this, std::move(request),
+        &metricsys::MetricsService::StubInterface::async_interface::StreamErrors);
+}
 
-    grpc::Status status = stub_->GetErrors(&context, request, &response);
+std::unique_ptr<MetricsClient::EventStream> MetricsClient::makeCustomEventsStream(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to
+) {
+    metricsys::GetCustomEventsRequest request;
+    *request.mutable_received_range() = makeTimeRange(from, to);
+    *request.mutable_pagination() = makePagination();
+    request.set_allow_segments(true);
 
-    if (!status.ok()) {
-        std::cerr << "MetricsClient: GetErrors error - "
-                  << status.error_code() << ": "
-                  << status.error_message() << std::endl;
-        return result;
-    }
+    return std::make_unique<TypedEventStream<metricsys::GetCustomEventsRequest, metricsys::GetCustomEventsResponse>>(
+        "StreamCustomEvents", *this, std::move(request),
+        &metricsys::MetricsService::StubInterface::async_interface::StreamCustomEvents);
+}
 
-    for (const auto& event : response.events()) {
-        RawEvent raw;
-        raw.projectId = projectId_;
-        raw.page = event.page();
-        raw.eventType = "error";
-        raw.isError = true;
-        raw.userId = event.has_user_id() ? event.user_id() : "";
-        raw.sessionId = event.has_session_id() ? event.session_id() : "";
-        raw.timestamp = timestampToTimePoint(event.timestamp());
-        raw.errorType = event.error_type();
-        raw.errorMessage = event.message();
-        raw.severity = static_cast<int>(event.severity());
-        result.push_back(raw);
-    }
+int64_t MetricsClient::streamAllEvents(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point& to,
+    SymbolTable& symbols,
+    const ChunkHandler& onChunk
+) {
+    auto started = std::chrono::steady_clock::now();
+
+    StreamList streams;
+    streams.push_back(makePageViewsStream(from, to));
+    streams.push_back(makeClicksStream(from, to));
+    streams.push_back(makePerformanceStream(from, to));
+    streams.push_back(makeErrorsStream(from, to));
+    streams.push_back(makeCustomEventsStream(from, to));
+
+    int64_t total = runStreams(streams, symbols, onChunk, &to);
+
+    auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - started).count();
+    std::cout << "MetricsClient: streamed " << total << " total events in "
+              << elapsedMs << " ms" << std::endl;
+    return total;
+}
+
+int64_t MetricsClient::streamPageViews(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    SymbolTable& symbols,
+    const ChunkHandler& onChunk
+) {
+    StreamList streams;
+    streams.push_back(makePageViewsStream(from, to));
+    return runStreams(streams, symbols, onChunk);
+}
 
-    std::cout << "MetricsClient: received " << result.size() << " error events" << std::endl;
-    return result;
+int64_t MetricsClient::streamClicks(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    SymbolTable& symbols,
+    const ChunkHandler& onChunk
+) {
+    StreamList streams;
+    streams.push_back(makeClicksStream(from, to));
+    return runStreams(streams, symbols, onChunk);
 }
 
-std::vector<RawEvent> MetricsClient::fetchCustomEvents(
+int64_t MetricsClient::streamPerformance(
     std::chrono::system_clock::time_point from,
-    std::chrono::system_clock::time_point to
+    std::chrono::system_clock::time_point to,
+    SymbolTable& symbols,
+    const ChunkHandler& onChunk
 ) {
-    std::vector<RawEvent> result;
+    StreamList streams;
+    streams.push_back(makePerformanceStream(from, to));
+    return runStreams(streams, symbols, onChunk);
+}
 
-    metricsys::GetCustomEventsRequest request;
-    *request.mutable_time_range() = makeTimeRange(from, to);
+int64_t MetricsClient::streamErrors(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    SymbolTable& symbols,
+    const ChunkHandler& onChunk
+) {
+    StreamList streams;
+    streams.push_back(makeErrorsStream(from, to));
+    return runStreams(streams, symbols, onChunk);
+}
 
-    metricsys::GetCustomEventsResponse response;
-    grpc::ClientContext context;
+int64_t MetricsClient::streamCustomEvents(
+    std::chrono::system_clock::time_point from,
+    std::chrono::system_clock::time_point to,
+    SymbolTable& symbols,
+    const ChunkHandler& onChunk
+) {
+    StreamList streams;
+    streams.push_back(makeCustomEventsStream(from, to));
+    return runStreams(streams, symbols, onChunk);
+}
 
-    grpc::Status status = stub_->GetCustomEvents(&context, request, &response);
+void MetricsClient::appendEvents(const metricsys::GetPageViewsResponse& response, SymbolTable& symbols,
+                                 EventBatches& out) const {
+    const SymbolId projectId = symbols.intern(projectId_);
+    auto& batch = out.pageViews;
+    for (const auto& event : response.events()) {
+        appendCommon(batch, projectId, event, symbols);
+    }
+}
 
-    if (!status.ok()) {
-        std::cerr << "MetricsClient: GetCustomEvents error - "
-                  << status.error_code() << ": "
-                  << status.error_message() << std::endl;
-        return result;
+void MetricsClient::appendEvents(const metricsys::GetClicksResponse& response, SymbolTable& symbols,
+                                 EventBatches& out) const {
+    const SymbolId projectId = symbols.intern(projectId_);
+    auto& batch = out.clicks;
+    for (const auto& event : response.events()) {
+        appendCommon(batch, projectId, event, symbols);
+        batch.elementId.push_back(symbols.intern(event.element_id()));
     }
+}
 
+void MetricsClient::appendEvents(const metricsys::GetPerformanceResponse& response, SymbolTable& symbols,
+                                 EventBatches& out) const {
+    const SymbolId projectId = symbols.intern(projectId_);
+    auto& batch = out.performance;
     for (const auto& event : response.events()) {
-        RawEvent raw;
-        raw.projectId = projectId_;
-        raw.page = event.has_page() ? event.page() : "";
-        raw.eventType = "custom";
-        raw.isError = false;
-        raw.userId = event.has_user_id() ? event.user_id() : "";
-        raw.sessionId = event.has_session_id() ? event.session_id() : "";
-        raw.timestamp = timestampToTimePoint(event.timestamp());
-        raw.customEventName = event.name();
-        for (const auto& [key, value] : event.properties()) {
-            raw.properties[key] = value;
-        }
-        result.push_back(raw);
+        appendCommon(batch, projectId, event, symbols);
+        // Неизмеренная метрика — 0, EventAccumulator её пропускает
+        batch.totalPageLoadMs.push_back(event.has_total_page_load_ms() ? event.total_page_load_ms() : 0.0);
+        batch.ttfbMs.push_back(event.has_ttfb_ms() ? event.ttfb_ms() : 0.0);
+        batch.fcpMs.push_back(event.has_fcp_ms() ? event.fcp_ms() : 0.0);
+        batch.lcpMs.push_back(event.has_lcp_ms() ? event.lcp_ms() : 0.0);
     }
+}
 
-    std::cout << "MetricsClient: received " << result.size() << " custom events" << std::endl;
-    return result;
+void MetricsClient::appendEvents(const metricsys::GetErrorsResponse& response, SymbolTable& symbols,
+                                 EventBatches& out) const {
+    const SymbolId projectId = symbols.intern(projectId_);
+    auto& batch = out.errors;
+    for (const auto& event : response.events()) {
+        appendCommon(batch, projectId, event, symbols);
+        batch.errorType.push_back(symbols.intern(event.error_type()));
+        batch.severity.push_back(static_cast<int32_t>(event.severity()));
+    }
+}
+
+void MetricsClient::appendEvents(const metricsys::GetCustomEventsResponse& response, SymbolTable& symbols,
+                                 EventBatches& out) const {
+    const SymbolId projectId = symbols.intern(projectId_);
+    auto& batch = out.customEvents;
+    for (const auto& event : response.events()) {
+        appendCommon(batch, projectId, event, symbols);
+        batch.eventName.push_back(symbols.intern(event.name()));
+    }
 }
 
 } // namespace aggregation
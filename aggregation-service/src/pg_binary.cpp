@@ -0,0 +1,37 @@
+#include "pg_binary.h"
+
+#include <bit>
+
+namespace aggregation {
+
+namespace {
+
+uint64_t readBigEndian(const char* data, int bytes) {
+    uint64_t value = 0;
+    for (int i = 0; i < bytes; ++i) {
+        value = (value << 8) | static_cast<unsigned char>(data[i]);
+    }
+    return value;
+}
+
+} // namespace
+
+int32_t readInt4(const char* data) {
+    return static_cast<int32_t>(static_cast<uint32_t>(readBigEndian(data, sizeof(int32_t))));
+}
+
+int64_t readInt8(const char* data) {
+    return static_cast<int64_t>(readBigEndian(data, sizeof(int64_t)));
+}
+
+double readFloat8(const char* data) {
+    return std::bit_cast<double>(readBigEndian(data, sizeof(double)));
+}
+
+std::chrono::system_clock::time_point readTimestamp(const char* data) {
+    std::chrono::microseconds sinceEpoch(readInt8(data));
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(sinceEpoch + POSTGRES_EPOCH));
+}
+
+} // namespace aggregation
@@ -0,0 +1,67 @@
+#include "rollup.h"
+
+#include <algorithm>
+
+namespace aggregation {
+
+std::chrono::system_clock::time_point alignDown(std::chrono::system_clock::time_point tp,
+                                                std::chrono::seconds step) {
+    auto seconds = std::chrono::floor<std::chrono::seconds>(tp.time_since_epoch());
+    auto aligned = seconds - seconds % step;
+    if (seconds % step < std::chrono::seconds::zero()) aligned -= step;  // до эпохи
+    return std::chrono::system_clock::time_point(aligned);
+}
+
+std::chrono::system_clock::time_point alignUp(std::chrono::system_clock::time_point tp,
+                                              std::chrono::seconds step) {
+    auto down = alignDown(tp, step);
+    return down == tp ? down : down + step;
+}
+
+std::chrono::seconds autoStep(std::chrono::system_clock::time_point from,
+                              std::chrono::system_clock::time_point to) {
+    auto range = std::chrono::ceil<std::chrono::seconds>(to - from);
+    auto step = std::chrono::seconds((range.count() + AUTO_STEP_MAX_POINTS - 1) / AUTO_STEP_MAX_POINTS);
+    return std::max(step, std::chrono::seconds(ROLLUP_LEVELS.front()));
+}
+
+static void planRange(std::chrono::system_clock::time_point from,
+                      std::chrono::system_clock::time_point to,
+                      size_t maxLevel,
+                      const RollupWatermarks& rolledUp,
+                      std::vector<TimeSegment>& out) {
+    if (from >= to) return;
+
+    for (size_t i = maxLevel; i > 0; --i) {
+        auto level = ROLLUP_LEVELS[i];
+        auto it = rolledUp.find(level);
+        if (it == rolledUp.end()) continue;
+
+        auto begin = alignUp(from, level);
+        auto end = std::min(alignDown(to, level), alignDown(it->second, level));
+        if (begin < end) {
+            planRange(from, begin, i - 1, rolledUp, out);
+            out.push_back(TimeSegment{level, begin, end});
+            planRange(end, to, i - 1, rolledUp, out);
+            return;
+        }
+    }
+
+    out.push_back(TimeSegment{ROLLUP_LEVELS.front(), from, to});
+}
+
+std::vector<TimeSegment> planResolution(std::chrono::system_clock::time_point from,
+                                        std::chrono::system_clock::time_point to,
+                                        std::chrono::seconds step,
+                                        const RollupWatermarks& rolledUp) {
+    size_t maxLevel = 0;
+    for (size_t i = 0; i < ROLLUP_LEVELS.size(); ++i) {
+        if (ROLLUP_LEVELS[i] <= step) maxLevel = i;
+    }
+
+    std::vector<TimeSegment> segments;
+    planRange(from, to, maxLevel, rolledUp, segments);
+    return segments;
+}
+
+} // namespace aggregation
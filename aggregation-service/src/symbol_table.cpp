@@ -0,0 +1,48 @@
+#include "symbol_table.h"
+#include "hyperloglog.h"
+
+#include <stdexcept>
+
+namespace aggregation {
+
+SymbolTable::SymbolTable() {
+    intern("");
+}
+
+SymbolId SymbolTable::intern(std::string_view value) {
+    auto it = ids_.find(value);
+    if (it != ids_.end()) return it->second;
+
+    if (strings_.size() >= INVALID_SYMBOL) {
+        throw std::length_error("SymbolTable is full");
+    }
+    auto id = static_cast<SymbolId>(strings_.size());
+    const std::string& stored = strings_.emplace_back(value);
+    hashes_.push_back(HyperLogLog::hash(stored));
+    ids_.emplace(stored, id);
+    return id;
+}
+
+std::vector<SymbolId> SymbolTable::compact(const std::vector<bool>& live) {
+    std::vector<SymbolId> mapping(strings_.size(), INVALID_SYMBOL);
+    std::deque<std::string> strings;
+    std::vector<uint64_t> hashes;
+
+    for (size_t id = 0; id < strings_.size(); ++id) {
+        if (id != EMPTY_SYMBOL && (id >= live.size() || !live[id])) continue;
+        mapping[id] = static_cast<SymbolId>(strings.size());
+        strings.push_back(std::move(strings_[id]));
+        hashes.push_back(hashes_[id]);
+    }
+
+    strings_ = std::move(strings);
+    hashes_ = std::move(hashes);
+    ids_.clear();
+    ids_.reserve(strings_.size());
+    for (size_t id = 0; id < strings_.size(); ++id) {
+        ids_.emplace(strings_[id], static_cast<SymbolId>(id));
+    }
+    return mapping;
+}
+
+} // namespace aggregation
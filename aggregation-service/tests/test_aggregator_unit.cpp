@@ -1,98 +1,21 @@
 #include <gtest/gtest.h>
 #include "aggregator.h"
+#include <algorithm>
 #include <chrono>
+#include <map>
+#include <numeric>
 #include <vector>
 
 using namespace aggregation;
 using namespace std::chrono;
 
 // Forward declarations for helper functions
-std::vector<AggregatedPageViews> aggregatePageViewsOnly(const std::vector<RawEvent>& events);
-std::vector<AggregatedPerformance> aggregatePerformanceOnly(const std::vector<RawEvent>& events);
-std::vector<AggregatedErrors> aggregateErrorsOnly(const std::vector<RawEvent>& events);
-
-// ===== Тесты вспомогательных функций =====
-
-class AggregatorUtilsTest : public ::testing::Test {
-protected:
-    void SetUp() override {}
-    void TearDown() override {}
-};
-
-TEST_F(AggregatorUtilsTest, CalculateAverage_EmptyVector) {
-    std::vector<double> empty;
-    EXPECT_DOUBLE_EQ(Aggregator::calculateAverage(empty), 0.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateAverage_SingleValue) {
-    std::vector<double> values = {42.5};
-    EXPECT_DOUBLE_EQ(Aggregator::calculateAverage(values), 42.5);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateAverage_MultipleValues) {
-    std::vector<double> values = {10.0, 20.0, 30.0, 40.0, 50.0};
-    EXPECT_DOUBLE_EQ(Aggregator::calculateAverage(values), 30.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateAverage_NegativeValues) {
-    std::vector<double> values = {-10.0, -20.0, -30.0};
-    EXPECT_DOUBLE_EQ(Aggregator::calculateAverage(values), -20.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateMin_EmptyVector) {
-    std::vector<double> empty;
-    EXPECT_DOUBLE_EQ(Aggregator::calculateMin(empty), 0.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateMin_SingleValue) {
-    std::vector<double> values = {42.5};
-    EXPECT_DOUBLE_EQ(Aggregator::calculateMin(values), 42.5);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateMin_MultipleValues) {
-    std::vector<double> values = {30.0, 10.0, 50.0, 20.0, 40.0};
-    EXPECT_DOUBLE_EQ(Aggregator::calculateMin(values), 10.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateMax_EmptyVector) {
-    std::vector<double> empty;
-    EXPECT_DOUBLE_EQ(Aggregator::calculateMax(empty), 0.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateMax_SingleValue) {
-    std::vector<double> values = {42.5};
-    EXPECT_DOUBLE_EQ(Aggregator::calculateMax(values), 42.5);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateMax_MultipleValues) {
-    std::vector<double> values = {30.0, 10.0, 50.0, 20.0, 40.0};
-    EXPECT_DOUBLE_EQ(Aggregator::calculateMax(values), 50.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateP95_EmptyVector) {
-    std::vector<double> empty;
-    EXPECT_DOUBLE_EQ(Aggregator::calculateP95(empty), 0.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateP95_SingleValue) {
-    std::vector<double> values = {100.0};
-    EXPECT_DOUBLE_EQ(Aggregator::calculateP95(values), 100.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateP95_TenValues) {
-    std::vector<double> values = {10, 20, 30, 40, 50, 60, 70, 80, 90, 100};
-    // P95 для 10 значений: индекс = 0.95 * 9 = 8.55 ≈ 8, значит 9-й элемент = 90
-    EXPECT_DOUBLE_EQ(Aggregator::calculateP95(values), 90.0);
-}
-
-TEST_F(AggregatorUtilsTest, CalculateP95_HundredValues) {
-    std::vector<double> values;
-    for (int i = 1; i <= 100; ++i) {
-        values.push_back(i);
-    }
-    // P95 для 100 значений: индекс = 0.95 * 99 = 94.05 ≈ 94, значит 95-й элемент
-    EXPECT_DOUBLE_EQ(Aggregator::calculateP95(values), 95.0);
-}
+std::vector<AggregatedPageViews> aggregatePageViewsOnly(const PageViewBatch& events,
+                                                        const SymbolTable& symbols);
+std::vector<AggregatedPerformance> aggregatePerformanceOnly(const PerformanceBatch& events,
+                                                            const SymbolTable& symbols);
+std::vector<AggregatedErrors> aggregateErrorsOnly(const ErrorBatch& events,
+                                                  const SymbolTable& symbols);
 
 // ===== Тесты агрегации событий =====
 
@@ -107,33 +30,34 @@ protected:
         now = system_clock::time_point(std::chrono::minutes(bucketMinutes));
     }
 
+    // Общие колонки события test-project, принятого в момент самого события;
+    // колонки своего типа тест дописывает сам
+    void append(EventColumns& batch, std::string_view page, std::string_view user,
+                std::string_view session, system_clock::time_point timestamp) {
+        batch.append(symbols.intern("test-project"), symbols.intern(page), symbols.intern(user),
+                     symbols.intern(session), timestamp, timestamp);
+    }
+
     system_clock::time_point now;
+    SymbolTable symbols;
 };
 
 TEST_F(AggregatorAggregationTest, AggregatePageViews_Empty) {
     // Мок базы данных и клиента не нужны для тестирования чистой логики
-    std::vector<RawEvent> events;
+    PageViewBatch events;
 
     // Создаем временный aggregator (используем nullptr для зависимостей)
     // В реальности нужен мок, но здесь тестируем только статическую функцию
-    auto result = aggregatePageViewsOnly(events);
+    auto result = aggregatePageViewsOnly(events, symbols);
 
     EXPECT_EQ(result.size(), 0);
 }
 
 TEST_F(AggregatorAggregationTest, AggregatePageViews_SingleEvent) {
-    std::vector<RawEvent> events;
+    PageViewBatch events;
+    append(events, "/home", "user-1", "session-1", now);
 
-    RawEvent event;
-    event.projectId = "test-project";
-    event.page = "/home";
-    event.eventType = "page_view";
-    event.userId = "user-1";
-    event.sessionId = "session-1";
-    event.timestamp = now;
-    events.push_back(event);
-
-    auto result = aggregatePageViewsOnly(events);
+    auto result = aggregatePageViewsOnly(events, symbols);
 
     ASSERT_EQ(result.size(), 1);
     EXPECT_EQ(result[0].projectId, "test-project");
@@ -144,20 +68,13 @@ TEST_F(AggregatorAggregationTest, AggregatePageViews_SingleEvent) {
 }
 
 TEST_F(AggregatorAggregationTest, AggregatePageViews_MultipleUsersOnePage) {
-    std::vector<RawEvent> events;
+    PageViewBatch events;
 
     for (int i = 0; i < 5; ++i) {
-        RawEvent event;
-        event.projectId = "test-project";
-        event.page = "/home";
-        event.eventType = "page_view";
-        event.userId = "user-" + std::to_string(i);
-        event.sessionId = "session-" + std::to_string(i);
-        event.timestamp = now;
-        events.push_back(event);
+        append(events, "/home", "user-" + std::to_string(i), "session-" + std::to_string(i), now);
     }
 
-    auto result = aggregatePageViewsOnly(events);
+    auto result = aggregatePageViewsOnly(events, symbols);
 
     ASSERT_EQ(result.size(), 1);
     EXPECT_EQ(result[0].viewsCount, 5);
@@ -166,20 +83,14 @@ TEST_F(AggregatorAggregationTest, AggregatePageViews_MultipleUsersOnePage) {
 }
 
 TEST_F(AggregatorAggregationTest, AggregatePageViews_SameUserMultipleSessions) {
-    std::vector<RawEvent> events;
+    PageViewBatch events;
 
     for (int i = 0; i < 3; ++i) {
-        RawEvent event;
-        event.projectId = "test-project";
-        event.page = "/home";
-        event.eventType = "page_view";
-        event.userId = "user-1";  // Один и тот же пользователь
-        event.sessionId = "session-" + std::to_string(i);
-        event.timestamp = now;
-        events.push_back(event);
+        // Один и тот же пользователь
+        append(events, "/home", "user-1", "session-" + std::to_string(i), now);
     }
 
-    auto result = aggregatePageViewsOnly(events);
+    auto result = aggregatePageViewsOnly(events, symbols);
 
     ASSERT_EQ(result.size(), 1);
     EXPECT_EQ(result[0].viewsCount, 3);
@@ -188,46 +99,33 @@ TEST_F(AggregatorAggregationTest, AggregatePageViews_SameUserMultipleSessions) {
 }
 
 TEST_F(AggregatorAggregationTest, AggregatePageViews_DifferentPages) {
-    std::vector<RawEvent> events;
+    PageViewBatch events;
 
     std::vector<std::string> pages = {"/home", "/about", "/products"};
     for (const auto& page : pages) {
-        RawEvent event;
-        event.projectId = "test-project";
-        event.page = page;
-        event.eventType = "page_view";
-        event.userId = "user-1";
-        event.sessionId = "session-1";
-        event.timestamp = now;
-        events.push_back(event);
+        append(events, page, "user-1", "session-1", now);
     }
 
-    auto result = aggregatePageViewsOnly(events);
+    auto result = aggregatePageViewsOnly(events, symbols);
 
     // Должно быть 3 группы (по одной на каждую страницу)
     EXPECT_EQ(result.size(), 3);
 }
 
 TEST_F(AggregatorAggregationTest, AggregatePerformance_CalculatesMetrics) {
-    std::vector<RawEvent> events;
+    PerformanceBatch events;
 
     // Добавляем события с разными метриками производительности
     std::vector<double> loads = {100, 200, 300, 400, 500, 600, 700, 800, 900, 1000};
     for (double load : loads) {
-        RawEvent event;
-        event.projectId = "test-project";
-        event.page = "/home";
-        event.eventType = "performance";
-        event.userId = "user-1";
-        event.timestamp = now;
-        event.totalPageLoadMs = load;
-        event.ttfbMs = load * 0.1;
-        event.fcpMs = load * 0.3;
-        event.lcpMs = load * 0.7;
-        events.push_back(event);
+        append(events, "/home", "user-1", "", now);
+        events.totalPageLoadMs.push_back(load);
+        events.ttfbMs.push_back(load * 0.1);
+        events.fcpMs.push_back(load * 0.3);
+        events.lcpMs.push_back(load * 0.7);
     }
 
-    auto result = aggregatePerformanceOnly(events);
+    auto result = aggregatePerformanceOnly(events, symbols);
 
     ASSERT_EQ(result.size(), 1);
     EXPECT_EQ(result[0].samplesCount, 10);
@@ -236,44 +134,23 @@ TEST_F(AggregatorAggregationTest, AggregatePerformance_CalculatesMetrics) {
 }
 
 TEST_F(AggregatorAggregationTest, AggregateErrors_CountsBySeverity) {
-    std::vector<RawEvent> events;
+    ErrorBatch events;
+    auto appendError = [&](int32_t severity, const std::string& user) {
+        append(events, "/checkout", user, "", now);
+        events.errorType.push_back(symbols.intern("ValidationError"));
+        events.severity.push_back(severity);
+    };
 
     // 2 warnings, 3 errors, 1 critical
     for (int i = 0; i < 2; ++i) {
-        RawEvent event;
-        event.projectId = "test-project";
-        event.page = "/checkout";
-        event.eventType = "error";
-        event.errorType = "ValidationError";
-        event.severity = 1;  // WARNING
-        event.userId = "user-" + std::to_string(i);
-        event.timestamp = now;
-        events.push_back(event);
+        appendError(1, "user-" + std::to_string(i));  // WARNING
     }
-
     for (int i = 0; i < 3; ++i) {
-        RawEvent event;
-        event.projectId = "test-project";
-        event.page = "/checkout";
-        event.eventType = "error";
-        event.errorType = "ValidationError";
-        event.severity = 2;  // ERROR
-        event.userId = "user-" + std::to_string(i + 2);
-        event.timestamp = now;
-        events.push_back(event);
+        appendError(2, "user-" + std::to_string(i + 2));  // ERROR
     }
+    appendError(3, "user-5");  // CRITICAL
 
-    RawEvent event;
-    event.projectId = "test-project";
-    event.page = "/checkout";
-    event.eventType = "error";
-    event.errorType = "ValidationError";
-    event.severity = 3;  // CRITICAL
-    event.userId = "user-5";
-    event.timestamp = now;
-    events.push_back(event);
-
-    auto result = aggregateErrorsOnly(events);
+    auto result = aggregateErrorsOnly(events, symbols);
 
     ASSERT_EQ(result.size(), 1);
     EXPECT_EQ(result[0].errorsCount, 6);  // Всего ошибок
@@ -282,32 +159,287 @@ TEST_F(AggregatorAggregationTest, AggregateErrors_CountsBySeverity) {
     EXPECT_EQ(result[0].uniqueUsers, 6);
 }
 
+// ===== Тесты EventAccumulator =====
+
+TEST_F(AggregatorAggregationTest, EventAccumulator_ChunkedEqualsSingleBatch) {
+    PageViewBatch events;
+    for (int i = 0; i < 250; ++i) {
+        append(events, i % 2 == 0 ? "/home" : "/about", "user-" + std::to_string(i % 7),
+               "session-" + std::to_string(i % 11), now + seconds(i % 120));
+    }
+
+    EventAccumulator whole(std::chrono::minutes(5), symbols);
+    whole.add(events);
+
+    // Подаём те же события чанками по 64, как это делает MetricsClient
+    EventAccumulator chunked(std::chrono::minutes(5), symbols);
+    PageViewBatch chunk;
+    for (size_t i = 0; i < events.size(); ++i) {
+        appendRow(chunk, events, i);
+        if (chunk.size() == 64 || i + 1 == events.size()) {
+            chunked.add(chunk);
+            clearBatch(chunk);
+        }
+    }
+
+    EXPECT_EQ(chunked.eventsCount(), 250);
+
+    auto expected = whole.finish().pageViews;
+    auto actual = chunked.finish().pageViews;
+    auto byPage = [](const AggregatedPageViews& a, const AggregatedPageViews& b) {
+        return a.page < b.page;
+    };
+    std::sort(expected.begin(), expected.end(), byPage);
+    std::sort(actual.begin(), actual.end(), byPage);
+
+    ASSERT_EQ(actual.size(), 2);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].page, expected[i].page);
+        EXPECT_EQ(actual[i].viewsCount, 125);
+        EXPECT_EQ(actual[i].viewsCount, expected[i].viewsCount);
+        EXPECT_EQ(actual[i].uniqueUsers, expected[i].uniqueUsers);
+        EXPECT_EQ(actual[i].uniqueSessions, expected[i].uniqueSessions);
+    }
+}
+
+TEST_F(AggregatorAggregationTest, EventAccumulator_GroupsByTypeAndBucket) {
+    EventAccumulator accumulator(std::chrono::minutes(5), symbols);
+
+    EventBatches events;
+    append(events.clicks, "/home", "user-1", "", now);
+    append(events.clicks, "/home", "user-1", "", now + minutes(5));  // следующий бакет
+    events.clicks.elementId.assign(2, symbols.intern("buy"));
+
+    append(events.errors, "/home", "", "", now);
+    events.errors.errorType.push_back(symbols.intern("TypeError"));
+    events.errors.severity.push_back(3);
+
+    accumulator.add(events);
+    auto result = accumulator.finish();
+
+    EXPECT_EQ(accumulator.eventsCount(), 3);
+    EXPECT_EQ(result.clicks.size(), 2);
+    ASSERT_EQ(result.errors.size(), 1);
+    EXPECT_EQ(result.errors[0].criticalCount, 1);
+    EXPECT_TRUE(result.pageViews.empty());
+}
+
+TEST_F(AggregatorAggregationTest, EventAccumulator_FinalizesOnlyClosedBuckets) {
+    EventAccumulator accumulator(std::chrono::minutes(5), symbols);
+
+    PageViewBatch events;
+    append(events, "/home", "user-1", "", now);               // бакет [now, now+5m)
+    append(events, "/home", "user-1", "", now + minutes(6));  // бакет [now+5m, now+10m)
+    accumulator.add(events);
+
+    // Watermark внутри второго бакета: закрыт только первый
+    auto first = accumulator.finalizeBefore(now + minutes(7));
+    ASSERT_EQ(first.pageViews.size(), 1);
+    EXPECT_EQ(first.pageViews[0].timeBucket, now);
+    EXPECT_EQ(accumulator.groupsCount(), 1);
+
+    // Событие того же открытого бакета докладывается в существующее состояние
+    clearBatch(events);
+    append(events, "/home", "user-2", "", now + minutes(8));
+    accumulator.add(events);
+
+    auto second = accumulator.finalizeBefore(now + minutes(10));
+    ASSERT_EQ(second.pageViews.size(), 1);
+    EXPECT_EQ(second.pageViews[0].viewsCount, 2);
+    EXPECT_EQ(second.pageViews[0].uniqueUsers, 2);
+    EXPECT_EQ(accumulator.groupsCount(), 0);
+}
+
+TEST_F(AggregatorAggregationTest, EventAccumulator_SketchesMergeAcrossBuckets) {
+    EventAccumulator accumulator(std::chrono::minutes(5), symbols);
+
+    // user-1 есть в обоих бакетах, user-2 и user-3 — по одному
+    PageViewBatch events;
+    for (std::string user : {"user-1", "user-2"}) {
+        append(events, "/home", user, "s-" + user, now);
+    }
+    for (std::string user : {"user-1", "user-3"}) {
+        append(events, "/home", user, "s-" + user, now + minutes(5));
+    }
+    accumulator.add(events);
+
+    auto result = accumulator.finish();
+    ASSERT_EQ(result.pageViews.size(), 2);
+
+    HyperLogLog users;
+    for (const auto& pv : result.pageViews) {
+        EXPECT_EQ(pv.uniqueUsers, 2);
+        // Два посетителя: скетчи разреженные, по 8 байт на хеш
+        ASSERT_EQ(pv.usersHll.size(), 1 + 2 * sizeof(uint64_t));
+        ASSERT_EQ(pv.sessionsHll.size(), 1 + 2 * sizeof(uint64_t));
+        users.merge(HyperLogLog::deserialize(pv.usersHll));
+    }
+    EXPECT_EQ(users.estimate(), 3);
+}
+
+TEST_F(AggregatorAggregationTest, EventAccumulator_SketchesMatchStringHashes) {
+    EventAccumulator accumulator(std::chrono::minutes(5), symbols);
+
+    // Скетч по номерам должен сливаться со скетчами, уже записанными по строкам
+    CustomBatch events;
+    HyperLogLog expected;
+    for (int i = 0; i < 1000; ++i) {
+        const std::string user = "user-" + std::to_string(i);
+        append(events, "/home", user, "", now);
+        events.eventName.push_back(symbols.intern("signup"));
+        expected.add(user);
+    }
+    accumulator.add(events);
+
+    auto result = accumulator.finish();
+    ASSERT_EQ(result.customEvents.size(), 1);
+    EXPECT_EQ(result.customEvents[0].eventName, "signup");
+    EXPECT_EQ(result.customEvents[0].usersHll, expected.serialize());
+    EXPECT_EQ(result.customEvents[0].uniqueSessions, 0);
+}
+
+TEST_F(AggregatorAggregationTest, EventAccumulator_RemapsKeysAfterCompaction) {
+    EventAccumulator accumulator(std::chrono::minutes(5), symbols);
+
+    for (int i = 0; i < 10; ++i) {
+        symbols.intern("/gone-" + std::to_string(i));
+    }
+    ClickBatch events;
+    append(events, "/home", "user-1", "", now);
+    events.elementId.push_back(symbols.intern("buy"));
+    accumulator.add(events);
+
+    std::vector<bool> live(symbols.size(), false);
+    accumulator.markSymbols(live);
+    auto mapping = symbols.compact(live);
+    accumulator.remapSymbols(mapping);
+
+    // Остались пустая строка и три строки ключа; пользователь живёт только в скетче
+    EXPECT_EQ(symbols.size(), 4u);
+    clearBatch(events);
+    append(events, "/home", "user-2", "", now);
+    events.elementId.push_back(symbols.intern("buy"));
+    accumulator.add(events);
+
+    auto result = accumulator.finish();
+    ASSERT_EQ(result.clicks.size(), 1);
+    EXPECT_EQ(result.clicks[0].page, "/home");
+    EXPECT_EQ(result.clicks[0].elementId, "buy");
+    EXPECT_EQ(result.clicks[0].clicksCount, 2);
+    EXPECT_EQ(result.clicks[0].uniqueUsers, 2);
+}
+
+TEST_F(AggregatorAggregationTest, EventAccumulator_SkipsUnmeasuredPerformanceMetrics) {
+    EventAccumulator accumulator(std::chrono::minutes(5), symbols);
+
+    // Метрики лежат своими колонками: у второго события нет LCP
+    PerformanceBatch events;
+    for (double lcp : {300.0, 0.0}) {
+        append(events, "/home", "user-1", "", now);
+        events.totalPageLoadMs.push_back(1000.0);
+        events.ttfbMs.push_back(100.0);
+        events.fcpMs.push_back(200.0);
+        events.lcpMs.push_back(lcp);
+    }
+    accumulator.add(events);
+
+    auto result = accumulator.finish();
+    ASSERT_EQ(result.performance.size(), 1);
+    EXPECT_EQ(result.performance[0].samplesCount, 2);
+    EXPECT_DOUBLE_EQ(result.performance[0].avgTotalLoadMs, 1000.0);
+    EXPECT_DOUBLE_EQ(result.performance[0].avgLcpMs, 300.0);
+}
+
+TEST_F(AggregatorAggregationTest, EventBatches_TakeReceivedBeforeKeepsRest) {
+    EventBatches events;
+    append(events.pageViews, "/a", "u", "", now);
+    append(events.pageViews, "/b", "u", "", now + minutes(1));
+    append(events.errors, "/a", "u", "", now);
+    events.errors.errorType.push_back(symbols.intern("TypeError"));
+    events.errors.severity.push_back(2);
+
+    EXPECT_TRUE(events.hasReceivedBefore(now + seconds(1)));
+    EXPECT_FALSE(events.hasReceivedBefore(now));
+
+    auto taken = events.takeReceivedBefore(now + seconds(1));
+    EXPECT_EQ(taken.size(), 2u);
+    ASSERT_EQ(taken.errors.size(), 1u);
+    EXPECT_EQ(taken.errors.errorType[0], symbols.intern("TypeError"));
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events.pageViews.page[0], symbols.intern("/b"));
+}
+
+TEST_F(AggregatorAggregationTest, Classify_UsesAllowedLateness) {
+    EXPECT_EQ(Aggregator::classify(now, now, minutes(10)), Aggregator::Lateness::OnTime);
+    EXPECT_EQ(Aggregator::classify(now - seconds(1), now, minutes(10)), Aggregator::Lateness::Late);
+    EXPECT_EQ(Aggregator::classify(now - minutes(10), now, minutes(10)), Aggregator::Lateness::Late);
+    EXPECT_EQ(Aggregator::classify(now - minutes(10) - seconds(1), now, minutes(10)),
+              Aggregator::Lateness::TooLate);
+}
+
+TEST_F(AggregatorAggregationTest, LateCorrections_TouchOnlyDirtyBuckets) {
+    // now выровнен по 5 минутам; часовой бакет берём целиком в прошлом
+    auto hour = floor<hours>(now) - hours(2);
+
+    LateCorrections corrections(symbols);
+    EXPECT_TRUE(corrections.empty());
+
+    EventBatches events;
+    append(events.pageViews, "/home", "user-1", "", hour + minutes(7));
+    append(events.pageViews, "/home", "user-2", "", hour + minutes(7) + seconds(30));
+    append(events.pageViews, "/home", "user-2", "", hour + minutes(42));
+    corrections.add(events);
+    EXPECT_EQ(corrections.eventsCount(), 3);
+
+    // 5m свёрнут до hour + 10m, часовой — целиком, дневной — ещё нет
+    RollupWatermarks rolledUp{
+        {seconds(300), hour + minutes(10)},
+        {seconds(3600), hour + hours(1)},
+        {seconds(86400), floor<days>(hour)},
+    };
+    auto result = corrections.take(rolledUp);
+    EXPECT_TRUE(corrections.empty());
+
+    std::map<int64_t, std::vector<AggregatedPageViews>> byStep;
+    for (const auto& row : result.pageViews) byStep[row.stepSeconds].push_back(row);
+
+    // Два базовых бакета, один свёрнутый 5m-бакет, один часовой, дневного нет
+    ASSERT_EQ(byStep[60].size(), 2u);
+    ASSERT_EQ(byStep[300].size(), 1u);
+    EXPECT_EQ(byStep[300][0].timeBucket, hour + minutes(5));
+    EXPECT_EQ(byStep[300][0].viewsCount, 2);
+    EXPECT_EQ(byStep[300][0].uniqueUsers, 2);
+    ASSERT_EQ(byStep[3600].size(), 1u);
+    EXPECT_EQ(byStep[3600][0].viewsCount, 3);
+    EXPECT_TRUE(byStep[86400].empty());
+}
+
 // ===== Вспомогательные функции для тестирования =====
 
-std::vector<AggregatedPageViews> aggregatePageViewsOnly(const std::vector<RawEvent>& events) {
+std::vector<AggregatedPageViews> aggregatePageViewsOnly(const PageViewBatch& events,
+                                                        const SymbolTable& symbols) {
     std::vector<AggregatedPageViews> result;
-    std::map<std::tuple<std::string, std::string, std::chrono::system_clock::time_point>,
-             std::vector<const RawEvent*>> groups;
+    std::map<std::tuple<SymbolId, SymbolId, std::chrono::system_clock::time_point>,
+             std::vector<size_t>> groups;
 
-    for (const auto& event : events) {
-        if (event.eventType == "page_view") {
-            auto key = std::make_tuple(event.projectId, event.page, event.timestamp);
-            groups[key].push_back(&event);
-        }
+    for (size_t i = 0; i < events.size(); ++i) {
+        auto key = std::make_tuple(events.projectId[i], events.page[i], events.timestamp[i]);
+        groups[key].push_back(i);
     }
 
-    for (const auto& [key, evts] : groups) {
-        std::set<std::string> users, sessions;
-        for (const auto* e : evts) {
-            if (!e->userId.empty()) users.insert(e->userId);
-            if (!e->sessionId.empty()) sessions.insert(e->sessionId);
+    for (const auto& [key, rows] : groups) {
+        std::set<SymbolId> users, sessions;
+        for (size_t i : rows) {
+            if (events.userId[i] != EMPTY_SYMBOL) users.insert(events.userId[i]);
+            if (events.sessionId[i] != EMPTY_SYMBOL) sessions.insert(events.sessionId[i]);
         }
 
         AggregatedPageViews agg;
-        agg.projectId = std::get<0>(key);
-        agg.page = std::get<1>(key);
+        agg.projectId = symbols.str(std::get<0>(key));
+        agg.page = symbols.str(std::get<1>(key));
         agg.timeBucket = std::get<2>(key);
-        agg.viewsCount = evts.size();
+        agg.viewsCount = rows.size();
         agg.uniqueUsers = users.size();
         agg.uniqueSessions = sessions.size();
         result.push_back(agg);
@@ -316,75 +448,84 @@ std::vector<AggregatedPageViews> aggregatePageViewsOnly(const std::vector<RawEve
     return result;
 }
 
-std::vector<AggregatedPerformance> aggregatePerformanceOnly(const std::vector<RawEvent>& events) {
+std::vector<AggregatedPerformance> aggregatePerformanceOnly(const PerformanceBatch& events,
+                                                            const SymbolTable& symbols) {
     std::vector<AggregatedPerformance> result;
-    std::map<std::tuple<std::string, std::string, std::chrono::system_clock::time_point>,
-             std::vector<const RawEvent*>> groups;
+    std::map<std::tuple<SymbolId, SymbolId, std::chrono::system_clock::time_point>,
+             std::vector<size_t>> groups;
 
-    for (const auto& event : events) {
-        if (event.eventType == "performance") {
-            auto key = std::make_tuple(event.projectId, event.page, event.timestamp);
-            groups[key].push_back(&event);
-        }
+    for (size_t i = 0; i < events.size(); ++i) {
+        auto key = std::make_tuple(events.projectId[i], events.page[i], events.timestamp[i]);
+        groups[key].push_back(i);
     }
 
-    for (const auto& [key, evts] : groups) {
+    for (const auto& [key, rows] : groups) {
         std::vector<double> totalLoads, ttfbs, fcps, lcps;
 
-        for (const auto* e : evts) {
-            if (e->totalPageLoadMs > 0) totalLoads.push_back(e->totalPageLoadMs);
-            if (e->ttfbMs > 0) ttfbs.push_back(e->ttfbMs);
-            if (e->fcpMs > 0) fcps.push_back(e->fcpMs);
-            if (e->lcpMs > 0) lcps.push_back(e->lcpMs);
+        for (size_t i : rows) {
+            if (events.totalPageLoadMs[i] > 0) totalLoads.push_back(events.totalPageLoadMs[i]);
+            if (events.ttfbMs[i] > 0) ttfbs.push_back(events.ttfbMs[i]);
+            if (events.fcpMs[i] > 0) fcps.push_back(events.fcpMs[i]);
+            if (events.lcpMs[i] > 0) lcps.push_back(events.lcpMs[i]);
         }
 
+        auto average = [](const std::vector<double>& values) {
+            return values.empty() ? 0.0
+                                  : std::accumulate(values.begin(), values.end(), 0.0) /
+                                        static_cast<double>(values.size());
+        };
+        auto p95 = [](const std::vector<double>& values) {
+            DDSketch sketch;
+            for (double v : values) sketch.add(v);
+            return sketch.quantile(0.95);
+        };
+
         AggregatedPerformance agg;
-        agg.projectId = std::get<0>(key);
-        agg.page = std::get<1>(key);
+        agg.projectId = symbols.str(std::get<0>(key));
+        agg.page = symbols.str(std::get<1>(key));
         agg.timeBucket = std::get<2>(key);
-        agg.samplesCount = evts.size();
-        agg.avgTotalLoadMs = Aggregator::calculateAverage(totalLoads);
-        agg.p95TotalLoadMs = Aggregator::calculateP95(totalLoads);
-        agg.avgTtfbMs = Aggregator::calculateAverage(ttfbs);
-        agg.p95TtfbMs = Aggregator::calculateP95(ttfbs);
-        agg.avgFcpMs = Aggregator::calculateAverage(fcps);
-        agg.p95FcpMs = Aggregator::calculateP95(fcps);
-        agg.avgLcpMs = Aggregator::calculateAverage(lcps);
-        agg.p95LcpMs = Aggregator::calculateP95(lcps);
+        agg.samplesCount = rows.size();
+        agg.avgTotalLoadMs = average(totalLoads);
+        agg.p95TotalLoadMs = p95(totalLoads);
+        agg.avgTtfbMs = average(ttfbs);
+        agg.p95TtfbMs = p95(ttfbs);
+        agg.avgFcpMs = average(fcps);
+        agg.p95FcpMs = p95(fcps);
+        agg.avgLcpMs = average(lcps);
+        agg.p95LcpMs = p95(lcps);
         result.push_back(agg);
     }
 
     return result;
 }
 
-std::vector<AggregatedErrors> aggregateErrorsOnly(const std::vector<RawEvent>& events) {
+std::vector<AggregatedErrors> aggregateErrorsOnly(const ErrorBatch& events,
+                                                  const SymbolTable& symbols) {
     std::vector<AggregatedErrors> result;
-    std::map<std::tuple<std::string, std::string, std::string, std::chrono::system_clock::time_point>,
-             std::vector<const RawEvent*>> groups;
+    std::map<std::tuple<SymbolId, SymbolId, SymbolId, std::chrono::system_clock::time_point>,
+             std::vector<size_t>> groups;
 
-    for (const auto& event : events) {
-        if (event.eventType == "error") {
-            auto key = std::make_tuple(event.projectId, event.page, event.errorType, event.timestamp);
-            groups[key].push_back(&event);
-        }
+    for (size_t i = 0; i < events.size(); ++i) {
+        auto key = std::make_tuple(events.projectId[i], events.page[i], events.errorType[i], events.timestamp[i]);
+        groups[key].push_back(i);
     }
 
-    for (const auto& [key, evts] : groups) {
-        std::set<std::string> users;
+    for (const auto& [key, rows] : groups) {
+        std::set<SymbolId> users;
         int64_t warningCount = 0, criticalCount = 0;
 
-        for (const auto* e : evts) {
-            if (!e->userId.empty()) users.insert(e->userId);
-            if (e->severity == 1) warningCount++;
-            else if (e->severity == 3) criticalCount++;
+        for (size_t i : rows) {
+            if (events.userId[i] != EMPTY_SYMBOL) users.insert(events.userId[i]);
+            if (events.severity[i] == 1) warningCount++;
+            else if (events.severity[i] == 3) criticalCount++;
         }
 
         AggregatedErrors agg;
-        agg.projectId = std::get<0>(key);
-        agg.page = std::get<1>(key);
-        agg.errorType = std::get<2>(key);
+        agg.projectId = symbols.str(std::get<0>(key));
+        agg.page = symbols.str(std::get<1>(key));
+        agg.errorType = symbols.str(std::get<2>(key));
         agg.timeBucket = std::get<3>(key);
-        agg.errorsCount = evts.size();
+        agg.errorsCount = rows.size();
         agg.warningCount = warningCount;
         agg.criticalCount = criticalCount;
         agg.uniqueUsers = users.size();
@@ -393,4 +534,3 @@ std::vector<AggregatedErrors> aggregateErrorsOnly(const std::vector<RawEvent>& e
 
     return result;
 }
-
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "copy_encoder.h"
+#include <string>
+
+using namespace aggregation;
+
+// ===== Тесты бинарного COPY =====
+
+namespace {
+
+const std::string HEADER("PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19);
+
+// Тело потока без заголовка
+std::string body(const BinaryCopyEncoder& encoder) {
+    return encoder.data().substr(HEADER.size());
+}
+
+} // namespace
+
+TEST(BinaryCopyEncoderTest, StartsWithHeader) {
+    BinaryCopyEncoder encoder;
+    EXPECT_EQ(encoder.data(), HEADER);
+}
+
+TEST(BinaryCopyEncoderTest, EncodesIntegersBigEndian) {
+    BinaryCopyEncoder encoder;
+    encoder.beginRow(2);
+    encoder.addInt4(300);
+    encoder.addInt8(-2);
+
+    EXPECT_EQ(body(encoder), std::string(
+        "\0\2"
+        "\0\0\0\4" "\0\0\1\x2c"
+        "\0\0\0\x8" "\xff\xff\xff\xff\xff\xff\xff\xfe", 22));
+}
+
+TEST(BinaryCopyEncoderTest, EncodesFloat8AsIeeeBits) {
+    BinaryCopyEncoder encoder;
+    encoder.addFloat8(1.5);
+    EXPECT_EQ(body(encoder), std::string("\0\0\0\x8" "\x3f\xf8\0\0\0\0\0\0", 12));
+}
+
+TEST(BinaryCopyEncoderTest, TimestampIsMicrosecondsSince2000) {
+    BinaryCopyEncoder at2000;
+    at2000.addTimestamp(std::chrono::system_clock::time_point(std::chrono::seconds(946684800)));
+    EXPECT_EQ(body(at2000), std::string("\0\0\0\x8\0\0\0\0\0\0\0\0", 12));
+
+    BinaryCopyEncoder oneSecondLater;
+    oneSecondLater.addTimestamp(std::chrono::system_clock::time_point(std::chrono::seconds(946684801)));
+    EXPECT_EQ(body(oneSecondLater), std::string("\0\0\0\x8" "\0\0\0\0\0\x0f\x42\x40", 12));
+}
+
+TEST(BinaryCopyEncoderTest, TextIsRawBytesAndEmptyByteaIsNull) {
+    BinaryCopyEncoder encoder;
+    encoder.addText("/p'a\"ge");
+    encoder.addText("");
+    encoder.addBytea("");
+    encoder.addBytea(std::string("\0\1", 2));
+
+    EXPECT_EQ(body(encoder), std::string(
+        "\0\0\0\7" "/p'a\"ge"
+        "\0\0\0\0"
+        "\xff\xff\xff\xff"
+        "\0\0\0\2" "\0\1", 25));
+}
+
+TEST(BinaryCopyEncoderTest, FinishAppendsTrailerAfterChunks) {
+    BinaryCopyEncoder encoder;
+    encoder.beginRow(1);
+    encoder.addInt4(1);
+    encoder.clear();  // кусок отправлен
+
+    encoder.finish();
+    EXPECT_EQ(encoder.data(), std::string("\xff\xff", 2));
+}
@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "database_pool.h"
+#include <thread>
+
+using namespace aggregation;
+using namespace std::chrono_literals;
+
+// ===== Тесты пула соединений (без подключения к БД) =====
+
+TEST(DatabasePoolTest, LeaseReturnsConnectionToPool) {
+    DatabasePool pool("reader", 2);
+    {
+        auto a = pool.acquire();
+        auto b = pool.acquire();
+        ASSERT_TRUE(a);
+        ASSERT_TRUE(b);
+        EXPECT_NE(&*a, &*b);
+        EXPECT_EQ(pool.stats().inUse, 2u);
+    }
+
+    auto stats = pool.stats();
+    EXPECT_EQ(stats.inUse, 0u);
+    EXPECT_EQ(stats.acquired, 2u);
+    EXPECT_EQ(stats.size, 2u);
+}
+
+TEST(DatabasePoolTest, AcquireTimesOutWhenExhausted) {
+    DatabasePool pool("writer", 1);
+    auto held = pool.acquire();
+    ASSERT_TRUE(held);
+
+    auto second = pool.acquire(10ms);
+    EXPECT_FALSE(second);
+    EXPECT_EQ(pool.stats().timeouts, 1u);
+}
+
+TEST(DatabasePoolTest, WaiterGetsReleasedConnection) {
+    DatabasePool pool("reader", 1);
+    auto held = pool.acquire();
+    Database* first = &*held;
+
+    std::thread releaser([&held] {
+        std::this_thread::sleep_for(20ms);
+        held = DatabasePool::Lease();
+    });
+
+    auto next = pool.acquire(2000ms);
+    releaser.join();
+
+    ASSERT_TRUE(next);
+    EXPECT_EQ(&*next, first);
+    EXPECT_GT(pool.stats().waitMax.count(), 0);
+}
+
+TEST(DatabasePoolTest, MovedLeaseReleasesOnce) {
+    DatabasePool pool("reader", 1);
+    {
+        auto a = pool.acquire();
+        auto b = std::move(a);
+        EXPECT_FALSE(a);
+        EXPECT_TRUE(b);
+    }
+    EXPECT_EQ(pool.stats().inUse, 0u);
+    EXPECT_TRUE(pool.acquire(10ms));
+}
+
+TEST(DatabasePoolTest, FormatsPrometheusMetricsPerPool) {
+    DatabasePool writer("writer", 1);
+    DatabasePool readers("reader", 4);
+    auto lease = readers.acquire();
+
+    auto text = formatPoolMetrics({writer.stats(), readers.stats()});
+    EXPECT_NE(text.find("# TYPE aggregation_db_pool_size gauge"), std::string::npos);
+    EXPECT_NE(text.find("aggregation_db_pool_size{pool=\"writer\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("aggregation_db_pool_size{pool=\"reader\"} 4\n"), std::string::npos);
+    EXPECT_NE(text.find("aggregation_db_pool_in_use{pool=\"reader\"} 1\n"), std::string::npos);
+    EXPECT_NE(text.find("aggregation_db_queries_total{pool=\"writer\"} 0\n"), std::string::npos);
+}
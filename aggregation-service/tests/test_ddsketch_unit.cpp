@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include "ddsketch.h"
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace aggregation;
+
+// ===== Тесты DDSketch =====
+
+namespace {
+
+// Проверка относительной ошибки против точного квантиля того же ранга
+void expectWithinAccuracy(const DDSketch& sketch, std::vector<double> values, double q) {
+    std::sort(values.begin(), values.end());
+    double exact = values[static_cast<size_t>(q * static_cast<double>(values.size() - 1))];
+    EXPECT_NEAR(sketch.quantile(q), exact, exact * DDSketch::RELATIVE_ACCURACY) << "q = " << q;
+}
+
+} // namespace
+
+TEST(DDSketchTest, EmptySketch) {
+    DDSketch sketch;
+    EXPECT_TRUE(sketch.empty());
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.95), 0.0);
+    EXPECT_TRUE(sketch.serialize().empty());
+    EXPECT_TRUE(DDSketch::deserialize("").empty());
+}
+
+TEST(DDSketchTest, IgnoresNonPositiveValues) {
+    DDSketch sketch;
+    sketch.add(0.0);
+    sketch.add(-5.0);
+    sketch.add(100.0);
+    EXPECT_EQ(sketch.count(), 1);
+    EXPECT_NEAR(sketch.quantile(0.5), 100.0, 1.0);
+}
+
+TEST(DDSketchTest, QuantilesWithinRelativeAccuracy) {
+    std::mt19937 rng(42);
+    std::lognormal_distribution<double> dist(6.0, 1.0);  // ~400 мс с длинным хвостом
+
+    DDSketch sketch;
+    std::vector<double> values;
+    for (int i = 0; i < 50000; ++i) {
+        double v = dist(rng);
+        values.push_back(v);
+        sketch.add(v);
+    }
+
+    EXPECT_EQ(sketch.count(), 50000);
+    for (double q : {0.5, 0.75, 0.9, 0.95, 0.99}) {
+        expectWithinAccuracy(sketch, values, q);
+    }
+}
+
+TEST(DDSketchTest, P95_SingleValue) {
+    DDSketch sketch;
+    sketch.add(100.0);
+    EXPECT_NEAR(sketch.quantile(0.95), 100.0, 100.0 * DDSketch::RELATIVE_ACCURACY);
+}
+
+TEST(DDSketchTest, P95_TenValues) {
+    std::vector<double> values = {100, 200, 300, 400, 500, 600, 700, 800, 900, 1000};
+    DDSketch sketch;
+    for (double v : values) sketch.add(v);
+
+    // Ранг 0.95 * 9 = 8.55 округляется вниз — девятое значение
+    EXPECT_NEAR(sketch.quantile(0.95), 900.0, 900.0 * DDSketch::RELATIVE_ACCURACY);
+    expectWithinAccuracy(sketch, values, 0.95);
+}
+
+TEST(DDSketchTest, P95_HundredValues) {
+    std::vector<double> values;
+    DDSketch sketch;
+    for (int i = 1; i <= 100; ++i) {
+        values.push_back(i);
+        sketch.add(i);
+    }
+
+    EXPECT_NEAR(sketch.quantile(0.95), 95.0, 95.0 * DDSketch::RELATIVE_ACCURACY);
+    expectWithinAccuracy(sketch, values, 0.95);
+}
+
+TEST(DDSketchTest, MergeEqualsSketchOfUnion) {
+    DDSketch a, b, all;
+    for (int i = 1; i <= 1000; ++i) {
+        a.add(i);
+        all.add(i);
+    }
+    for (int i = 500; i <= 5000; i += 3) {
+        b.add(i);
+        all.add(i);
+    }
+
+    a.merge(b);
+
+    EXPECT_EQ(a.count(), all.count());
+    EXPECT_EQ(a.serialize(), all.serialize());
+    EXPECT_DOUBLE_EQ(a.quantile(0.99), all.quantile(0.99));
+}
+
+TEST(DDSketchTest, SerializeRoundTrip) {
+    DDSketch sketch;
+    for (double v : {0.5, 12.0, 12.1, 350.0, 350.0, 90000.0}) sketch.add(v);
+
+    std::string bytes = sketch.serialize();
+    ASSERT_FALSE(bytes.empty());
+    EXPECT_EQ(static_cast<uint8_t>(bytes[0]), DDSketch::FORMAT_VERSION);
+    EXPECT_EQ((bytes.size() - 1) % DDSketch::BIN_SIZE, 0u);
+
+    auto restored = DDSketch::deserialize(bytes);
+    EXPECT_EQ(restored.count(), sketch.count());
+    EXPECT_EQ(restored.serialize(), bytes);
+    for (double q : {0.0, 0.5, 0.9, 1.0}) {
+        EXPECT_DOUBLE_EQ(restored.quantile(q), sketch.quantile(q));
+    }
+}
+
+TEST(DDSketchTest, DeserializeRejectsMalformedInput) {
+    std::string wrongVersion(1 + DDSketch::BIN_SIZE, '\0');
+    wrongVersion[0] = 7;
+    EXPECT_THROW(DDSketch::deserialize(wrongVersion), std::invalid_argument);
+
+    std::string truncated(1 + DDSketch::BIN_SIZE - 1, '\0');
+    truncated[0] = static_cast<char>(DDSketch::FORMAT_VERSION);
+    EXPECT_THROW(DDSketch::deserialize(truncated), std::invalid_argument);
+}
+
+TEST(DDSketchTest, BinCountIsBounded) {
+    DDSketch sketch;
+    // Диапазон шире, чем покрывают MAX_BINS бинов: младшие сливаются
+    for (double v = 1e-30; v < 1e30; v *= 1.01) sketch.add(v);
+
+    auto bins = (sketch.serialize().size() - 1) / DDSketch::BIN_SIZE;
+    EXPECT_LE(bins, DDSketch::MAX_BINS);
+    EXPECT_NEAR(sketch.quantile(1.0), 1e30, 1e30 * 0.05);
+}
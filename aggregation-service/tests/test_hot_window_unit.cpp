@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "hot_window.h"
+#include <chrono>
+
+using namespace aggregation;
+
+// ===== Тесты HotWindowCache =====
+
+namespace {
+
+using Clock = std::chrono::system_clock;
+
+// 2024-01-01 00:00:00 UTC
+const Clock::time_point T0 = Clock::time_point(std::chrono::seconds(1704067200));
+
+Clock::time_point at(int minutes) {
+    return T0 + std::chrono::minutes(minutes);
+}
+
+AggregatedPageViews pageViews(const std::string& page, int minute, int64_t views) {
+    AggregatedPageViews row;
+    row.projectId = "proj";
+    row.page = page;
+    row.timeBucket = at(minute);
+    row.viewsCount = views;
+    row.uniqueUsers = views / 2;
+    row.uniqueSessions = views / 3;
+    return row;
+}
+
+AggregatedPerformance performance(const std::string& page, int minute, const std::string& sketch) {
+    AggregatedPerformance row;
+    row.projectId = "proj";
+    row.page = page;
+    row.timeBucket = at(minute);
+    row.samplesCount = 3;
+    row.avgTotalLoadMs = 120.0;
+    row.p95TotalLoadMs = 250.0;
+    row.totalLoadSketch = sketch;
+    return row;
+}
+
+} // namespace
+
+TEST(HotWindowCacheTest, MissesBeforeFirstWindow) {
+    HotWindowCache cache({});
+    EXPECT_FALSE(cache.readPageViews("proj", at(0), at(10), "", 100, 0).has_value());
+    EXPECT_EQ(cache.stats().misses, 1u);
+}
+
+TEST(HotWindowCacheTest, ServesRowsInDatabaseOrder) {
+    HotWindowCache cache({});
+    AggregationResult result;
+    result.pageViews = {pageViews("/b", 1, 10), pageViews("/a", 1, 20), pageViews("/a", 2, 30)};
+    result.pageViews.push_back(pageViews("/a", 0, 5));
+    result.pageViews.back().projectId = "other";
+    cache.add(result, at(0), at(3));
+
+    auto rows = cache.readPageViews("proj", at(0), at(3), "", 100, 0);
+    ASSERT_TRUE(rows.has_value());
+    ASSERT_EQ(rows->size(), 3u);
+    EXPECT_EQ((*rows)[0].timeBucket, at(2));
+    EXPECT_EQ((*rows)[1].page, "/a");
+    EXPECT_EQ((*rows)[1].viewsCount, 20);
+    EXPECT_EQ((*rows)[1].uniqueUsers, 10);
+    EXPECT_EQ((*rows)[2].page, "/b");
+    EXPECT_EQ((*rows)[2].stepSeconds, 60);
+
+    auto filtered = cache.readPageViews("proj", at(0), at(3), "/b", 100, 0);
+    ASSERT_EQ(filtered->size(), 1u);
+    EXPECT_EQ(filtered->front().viewsCount, 10);
+    EXPECT_EQ(cache.stats().hits, 2u);
+}
+
+TEST(HotWindowCacheTest, RangeIsHalfOpenAndPaginated) {
+    HotWindowCache cache({});
+    AggregationResult result;
+    for (int minute = 0; minute < 10; ++minute) result.pageViews.push_back(pageViews("/", minute, minute));
+    cache.add(result, at(0), at(10));
+
+    auto rows = cache.readPageViews("proj", at(2), at(8), "", 3, 1);
+    ASSERT_EQ(rows->size(), 3u);
+    EXPECT_EQ((*rows)[0].timeBucket, at(6));
+    EXPECT_EQ((*rows)[2].timeBucket, at(4));
+
+    // Начало между бакетами: бакет 2-й минуты раньше from
+    auto partial = cache.readPageViews("proj", at(2) + std::chrono::milliseconds(500), at(4), "", 100, 0);
+    ASSERT_EQ(partial->size(), 1u);
+    EXPECT_EQ(partial->front().timeBucket, at(3));
+}
+
+TEST(HotWindowCacheTest, PerformanceKeepsSketches) {
+    HotWindowCache cache({});
+    AggregationResult result;
+    result.performance = {performance("/", 0, "sketch-0"), performance("/", 1, "sketch-1")};
+    cache.add(result, at(0), at(2));
+
+    // Повторно пришедший бакет заменяет прежний
+    AggregationResult again;
+    again.performance = {performance("/", 1, "sketch-1b")};
+    cache.add(again, at(2), at(3));
+
+    auto rows = cache.readPerformance("proj", at(0), at(3), "", 100, 0);
+    ASSERT_EQ(rows->size(), 2u);
+    EXPECT_EQ((*rows)[0].totalLoadSketch, "sketch-1b");
+    EXPECT_DOUBLE_EQ((*rows)[1].p95TotalLoadMs, 250.0);
+    EXPECT_EQ(cache.stats().rows, 2u);
+}
+
+TEST(HotWindowCacheTest, GapBetweenWindowsResetsCoverage) {
+    HotWindowCache cache({});
+    AggregationResult result;
+    result.pageViews = {pageViews("/", 0, 1)};
+    cache.add(result, at(0), at(1));
+
+    AggregationResult later;
+    later.pageViews = {pageViews("/", 5, 1)};
+    cache.add(later, at(5), at(6));
+
+    EXPECT_FALSE(cache.readPageViews("proj", at(0), at(6), "", 100, 0).has_value());
+    auto rows = cache.readPageViews("proj", at(5), at(6), "", 100, 0);
+    ASSERT_EQ(rows->size(), 1u);
+    EXPECT_EQ(cache.stats().rows, 1u);
+}
+
+TEST(HotWindowCacheTest, RefreshReplacesCorrectedBucketsInsideCoverage) {
+    HotWindowCache cache({});
+    AggregationResult result;
+    result.pageViews = {pageViews("/", 1, 10), pageViews("/", 2, 20)};
+    cache.add(result, at(1), at(3));
+
+    // Бакет 1 досчитан после опоздавших событий, бакет 0 вне покрытия
+    cache.refresh({pageViews("/", 1, 15), pageViews("/", 0, 7)}, {performance("/", 2, "sketch")});
+
+    auto rows = cache.readPageViews("proj", at(1), at(3), "", 100, 0);
+    ASSERT_EQ(rows->size(), 2u);
+    EXPECT_EQ((*rows)[1].viewsCount, 15);
+    EXPECT_EQ(cache.stats().rows, 3u);
+    EXPECT_FALSE(cache.readPageViews("proj", at(0), at(3), "", 100, 0).has_value());
+
+    auto perf = cache.readPerformance("proj", at(1), at(3), "", 100, 0);
+    ASSERT_EQ(perf->size(), 1u);
+    EXPECT_EQ(perf->front().totalLoadSketch, "sketch");
+}
+
+TEST(HotWindowCacheTest, EvictsPartitionsOutsideWindow) {
+    HotWindowCache cache({std::chrono::hours(2), 256u << 20});
+    auto previous = at(0);
+    for (int hour = 0; hour < 5; ++hour) {
+        AggregationResult result;
+        result.pageViews = {pageViews("/", hour * 60, 1)};
+        cache.add(result, previous, at(hour * 60 + 1));
+        previous = at(hour * 60 + 1);
+    }
+
+    // Окно — два последних часа до watermark 04:01, покрытие с 02:00
+    EXPECT_EQ(cache.stats().partitions, 3u);
+    EXPECT_FALSE(cache.readPageViews("proj", at(60), at(300), "", 100, 0).has_value());
+    auto rows = cache.readPageViews("proj", at(120), at(300), "", 100, 0);
+    ASSERT_TRUE(rows.has_value());
+    EXPECT_EQ(rows->size(), 3u);
+}
+
+TEST(HotWindowCacheTest, ByteLimitDropsOldestPartitions) {
+    HotWindowCache cache({std::chrono::hours(24), 4096});
+    AggregationResult result;
+    std::string sketch(1000, 'x');
+    for (int hour = 0; hour < 6; ++hour) {
+        result.performance.push_back(performance("/", hour * 60, sketch));
+    }
+    cache.add(result, at(0), at(300));
+
+    auto stats = cache.stats();
+    EXPECT_LE(stats.bytes, 4096u);
+    EXPECT_GT(stats.partitions, 0u);
+    EXPECT_LT(stats.partitions, 6u);
+    EXPECT_FALSE(cache.readPerformance("proj", at(0), at(300), "", 100, 0).has_value());
+    EXPECT_TRUE(cache.readPerformance("proj", at(300), at(301), "", 100, 0).has_value());
+}
+
+TEST(HotWindowCacheTest, FormatsMetrics) {
+    HotWindowCache cache({});
+    cache.readPageViews("proj", at(0), at(1), "", 100, 0);
+    auto text = cache.formatMetrics();
+    EXPECT_NE(text.find("aggregation_hot_window_misses_total 1\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE aggregation_hot_window_bytes gauge"), std::string::npos);
+}
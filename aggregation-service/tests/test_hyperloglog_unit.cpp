@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "hyperloglog.h"
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+using namespace aggregation;
+
+// ===== Тесты HyperLogLog =====
+
+TEST(HyperLogLogTest, SmallSetIsExact) {
+    HyperLogLog hll;
+    EXPECT_TRUE(hll.empty());
+    EXPECT_EQ(hll.estimate(), 0);
+
+    for (int i = 0; i < 100; ++i) {
+        hll.add("user_" + std::to_string(i % 10));
+    }
+
+    EXPECT_TRUE(hll.isSparse());
+    EXPECT_EQ(hll.estimate(), 10);
+}
+
+TEST(HyperLogLogTest, LargeSetWithinErrorBound) {
+    HyperLogLog hll;
+    const int n = 100000;
+    for (int i = 0; i < n; ++i) {
+        hll.add("user_" + std::to_string(i));
+    }
+
+    EXPECT_FALSE(hll.isSparse());
+    // Стандартная ошибка ~1.6%, допускаем три сигмы
+    EXPECT_NEAR(static_cast<double>(hll.estimate()), n, n * 0.05);
+}
+
+TEST(HyperLogLogTest, MergeMatchesUnion) {
+    HyperLogLog a, b, all;
+    for (int i = 0; i < 3000; ++i) {
+        a.add("user_" + std::to_string(i));
+        all.add("user_" + std::to_string(i));
+    }
+    for (int i = 2000; i < 6000; ++i) {
+        b.add("user_" + std::to_string(i));
+        all.add("user_" + std::to_string(i));
+    }
+
+    a.merge(b);
+
+    EXPECT_EQ(a.serialize(), all.serialize());
+    EXPECT_EQ(a.estimate(), all.estimate());
+    EXPECT_NEAR(static_cast<double>(a.estimate()), 6000, 6000 * 0.05);
+}
+
+TEST(HyperLogLogTest, MergeIsIdempotent) {
+    HyperLogLog a, b;
+    for (int i = 0; i < 1000; ++i) {
+        a.add("session_" + std::to_string(i));
+    }
+    b.merge(a);
+    b.merge(a);
+
+    EXPECT_EQ(b.serialize(), a.serialize());
+}
+
+TEST(HyperLogLogTest, SerializeRoundTrip) {
+    HyperLogLog sparse;
+    sparse.add("u1");
+    sparse.add("u2");
+
+    // Разреженный скетч пишется хешами: байт формата и 8 байт на значение
+    std::string bytes = sparse.serialize();
+    ASSERT_EQ(bytes.size(), 1 + 2 * sizeof(uint64_t));
+    EXPECT_EQ(static_cast<uint8_t>(bytes[0]), HyperLogLog::SPARSE_TAG);
+
+    auto restored = HyperLogLog::deserialize(bytes);
+    EXPECT_TRUE(restored.isSparse());
+    EXPECT_EQ(restored.estimate(), 2);
+    EXPECT_EQ(restored.serialize(), bytes);
+}
+
+TEST(HyperLogLogTest, SerializeRoundTripDense) {
+    HyperLogLog dense;
+    for (int i = 0; i < 5000; ++i) {
+        dense.add("user_" + std::to_string(i));
+    }
+    ASSERT_FALSE(dense.isSparse());
+
+    std::string bytes = dense.serialize();
+    ASSERT_EQ(bytes.size(), HyperLogLog::SERIALIZED_SIZE);
+    EXPECT_EQ(static_cast<uint8_t>(bytes[0]), HyperLogLog::PRECISION);
+
+    auto restored = HyperLogLog::deserialize(bytes);
+    EXPECT_EQ(restored.estimate(), dense.estimate());
+    EXPECT_EQ(restored.serialize(), bytes);
+
+    // Разреженный, влитый в плотный, даёт тот же скетч, что и прямое добавление
+    HyperLogLog few;
+    few.add("user_1");
+    few.add("extra");
+    restored.merge(HyperLogLog::deserialize(few.serialize()));
+    dense.add("extra");
+    EXPECT_EQ(restored.serialize(), dense.serialize());
+}
+
+TEST(HyperLogLogTest, DeserializeRejectsMalformedInput) {
+    EXPECT_THROW(HyperLogLog::deserialize(""), std::invalid_argument);
+    EXPECT_THROW(HyperLogLog::deserialize(std::string(100, '\0')), std::invalid_argument);
+
+    std::string wrongPrecision(HyperLogLog::SERIALIZED_SIZE, '\0');
+    wrongPrecision[0] = 14;
+    EXPECT_THROW(HyperLogLog::deserialize(wrongPrecision), std::invalid_argument);
+
+    std::string truncated(1 + 5, '\0');
+    truncated[0] = static_cast<char>(HyperLogLog::SPARSE_TAG);
+    EXPECT_THROW(HyperLogLog::deserialize(truncated), std::invalid_argument);
+
+    // Одинаковые хеши: строгий порядок нарушен
+    std::string unordered(1 + 2 * sizeof(uint64_t), '\1');
+    unordered[0] = static_cast<char>(HyperLogLog::SPARSE_TAG);
+    EXPECT_THROW(HyperLogLog::deserialize(unordered), std::invalid_argument);
+}
+
+TEST(HyperLogLogTest, HashIsStable) {
+    // Скетчи хранятся в БД: значения хеша не должны меняться между сборками
+    EXPECT_EQ(HyperLogLog::hash("user_1"), HyperLogLog::hash(std::string("user_1")));
+    EXPECT_NE(HyperLogLog::hash("user_1"), HyperLogLog::hash("user_2"));
+    EXPECT_EQ(HyperLogLog::hash(""), HyperLogLog::hash(""));
+}
@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+#include "pg_binary.h"
+#include "copy_encoder.h"
+#include <string>
+
+using namespace aggregation;
+
+// ===== Тесты бинарного формата результатов =====
+
+TEST(PgBinaryTest, ReadsBigEndianIntegers) {
+    EXPECT_EQ(readInt4("\0\0\1\x2c"), 300);
+    EXPECT_EQ(readInt4("\xff\xff\xff\xff"), -1);
+    EXPECT_EQ(readInt8("\0\0\0\0\0\0\0\x2a"), 42);
+    EXPECT_EQ(readInt8("\xff\xff\xff\xff\xff\xff\xff\xfe"), -2);
+}
+
+TEST(PgBinaryTest, ReadsFloat8) {
+    EXPECT_DOUBLE_EQ(readFloat8("\x3f\xf8\0\0\0\0\0\0"), 1.5);
+}
+
+TEST(PgBinaryTest, ReadsTimestampRelativeTo2000) {
+    EXPECT_EQ(readTimestamp("\0\0\0\0\0\0\0\0"),
+              std::chrono::system_clock::time_point(std::chrono::seconds(946684800)));
+    EXPECT_EQ(readTimestamp("\0\0\0\0\0\x0f\x42\x40"),
+              std::chrono::system_clock::time_point(std::chrono::seconds(946684801)));
+}
+
+TEST(PgBinaryTest, DecodesWhatCopyEncoderWrites) {
+    auto tp = std::chrono::system_clock::time_point(std::chrono::seconds(1700000000) + std::chrono::microseconds(123));
+
+    BinaryCopyEncoder encoder;
+    encoder.clear();
+    encoder.addTimestamp(tp);
+    encoder.addFloat8(-0.25);
+
+    const std::string& data = encoder.data();
+    EXPECT_EQ(readTimestamp(data.data() + 4), tp);
+    EXPECT_DOUBLE_EQ(readFloat8(data.data() + 16), -0.25);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "rollup.h"
+
+using namespace aggregation;
+using namespace std::chrono_literals;
+
+// ===== Тесты выбора разрешения =====
+
+namespace {
+
+std::chrono::system_clock::time_point at(std::chrono::seconds sinceEpoch) {
+    return std::chrono::system_clock::time_point(sinceEpoch);
+}
+
+// Сегменты должны покрывать [from, to) без дыр и пересечений
+void expectContiguous(const std::vector<TimeSegment>& segments,
+                      std::chrono::system_clock::time_point from,
+                      std::chrono::system_clock::time_point to) {
+    ASSERT_FALSE(segments.empty());
+    EXPECT_EQ(segments.front().from, from);
+    EXPECT_EQ(segments.back().to, to);
+    for (size_t i = 1; i < segments.size(); ++i) {
+        EXPECT_EQ(segments[i - 1].to, segments[i].from);
+    }
+}
+
+} // namespace
+
+TEST(RollupTest, AlignDownAndUp) {
+    EXPECT_EQ(alignDown(at(3700s), 3600s), at(3600s));
+    EXPECT_EQ(alignUp(at(3700s), 3600s), at(7200s));
+    EXPECT_EQ(alignDown(at(7200s), 3600s), at(7200s));
+    EXPECT_EQ(alignUp(at(7200s), 3600s), at(7200s));
+    EXPECT_EQ(alignDown(at(-10s), 60s), at(-60s));
+}
+
+TEST(RollupTest, AutoStepKeepsPointCountBounded) {
+    EXPECT_EQ(autoStep(at(0s), at(3600s)), 60s);  // не мельче базового уровня
+    EXPECT_EQ(autoStep(at(0s), at(86400s * 30)), 2592s);
+}
+
+TEST(RollupTest, WithoutRollupsReadsBaseLevel) {
+    auto segments = planResolution(at(0s), at(86400s * 2), 86400s, {});
+    ASSERT_EQ(segments.size(), 1u);
+    EXPECT_EQ(segments[0].step, 60s);
+}
+
+TEST(RollupTest, CoarseMiddleFineEdges) {
+    RollupWatermarks rolledUp{{300s, at(86400s * 10)}, {3600s, at(86400s * 10)}, {86400s, at(86400s * 10)}};
+    auto from = at(86400s + 3600s + 120s);  // 1-й день 01:02
+    auto to = at(86400s * 4 + 7200s + 600s); // 4-й день 02:10
+
+    auto segments = planResolution(from, to, 86400s, rolledUp);
+    expectContiguous(segments, from, to);
+
+    std::chrono::seconds coarsest{0};
+    for (const auto& segment : segments) {
+        coarsest = std::max(coarsest, segment.step);
+        EXPECT_EQ(alignDown(segment.from, segment.step), segment.from);
+        EXPECT_EQ(alignDown(segment.to, segment.step), segment.to);
+    }
+    EXPECT_EQ(coarsest, 86400s);
+}
+
+TEST(RollupTest, StepLimitsLevel) {
+    RollupWatermarks rolledUp{{300s, at(86400s * 10)}, {3600s, at(86400s * 10)}, {86400s, at(86400s * 10)}};
+    auto segments = planResolution(at(0s), at(86400s * 2), 300s, rolledUp);
+    ASSERT_EQ(segments.size(), 1u);
+    EXPECT_EQ(segments[0].step, 300s);
+}
+
+TEST(RollupTest, UnrolledTailReadsFinerLevel) {
+    // Часовой уровень свёрнут только до 10:00, пятиминутный — до 10:30
+    RollupWatermarks rolledUp{{300s, at(37800s)}, {3600s, at(36000s)}};
+    auto from = at(0s);
+    auto to = at(39600s);  // 11:00
+
+    auto segments = planResolution(from, to, 3600s, rolledUp);
+    expectContiguous(segments, from, to);
+    ASSERT_EQ(segments.size(), 3u);
+    EXPECT_EQ(segments[0].step, 3600s);
+    EXPECT_EQ(segments[0].to, at(36000s));
+    EXPECT_EQ(segments[1].step, 300s);
+    EXPECT_EQ(segments[1].to, at(37800s));
+    EXPECT_EQ(segments[2].step, 60s);
+}
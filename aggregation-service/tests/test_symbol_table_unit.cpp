@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "symbol_table.h"
+#include "hyperloglog.h"
+#include <string>
+#include <vector>
+
+using namespace aggregation;
+
+// ===== Тесты SymbolTable =====
+
+TEST(SymbolTableTest, EmptyStringIsReserved) {
+    SymbolTable symbols;
+    EXPECT_EQ(symbols.size(), 1u);
+    EXPECT_EQ(symbols.intern(""), EMPTY_SYMBOL);
+    EXPECT_EQ(symbols.str(EMPTY_SYMBOL), "");
+}
+
+TEST(SymbolTableTest, InternsDenseStableIds) {
+    SymbolTable symbols;
+    SymbolId home = symbols.intern("/home");
+    SymbolId about = symbols.intern("/about");
+
+    EXPECT_EQ(home, 1u);
+    EXPECT_EQ(about, 2u);
+    EXPECT_EQ(symbols.intern(std::string("/home")), home);
+    EXPECT_EQ(symbols.size(), 3u);
+    EXPECT_EQ(symbols.str(about), "/about");
+}
+
+TEST(SymbolTableTest, KeepsStringsValidWhileGrowing) {
+    SymbolTable symbols;
+    // Короткие строки лежат внутри std::string (SSO): рост не должен их двигать
+    const std::string& first = symbols.str(symbols.intern("u"));
+    for (int i = 0; i < 10000; ++i) {
+        symbols.intern("user-" + std::to_string(i));
+    }
+    EXPECT_EQ(first, "u");
+    EXPECT_EQ(symbols.intern("u"), 1u);
+    EXPECT_EQ(symbols.intern("user-9999"), 10001u);
+}
+
+TEST(SymbolTableTest, StoresHyperLogLogHash) {
+    SymbolTable symbols;
+    SymbolId id = symbols.intern("user-42");
+    EXPECT_EQ(symbols.hash(id), HyperLogLog::hash("user-42"));
+}
+
+TEST(SymbolTableTest, CompactKeepsLiveStringsInOrder) {
+    SymbolTable symbols;
+    SymbolId a = symbols.intern("a");
+    SymbolId b = symbols.intern("b");
+    SymbolId c = symbols.intern("c");
+
+    std::vector<bool> live(symbols.size(), false);
+    live[c] = true;
+    live[a] = true;
+    auto mapping = symbols.compact(live);
+
+    ASSERT_EQ(mapping.size(), 4u);
+    EXPECT_EQ(mapping[EMPTY_SYMBOL], EMPTY_SYMBOL);
+    EXPECT_EQ(mapping[a], 1u);
+    EXPECT_EQ(mapping[b], INVALID_SYMBOL);
+    EXPECT_EQ(mapping[c], 2u);
+
+    EXPECT_EQ(symbols.size(), 3u);
+    EXPECT_EQ(symbols.str(mapping[c]), "c");
+    EXPECT_EQ(symbols.hash(mapping[c]), HyperLogLog::hash("c"));
+    EXPECT_EQ(symbols.intern("a"), mapping[a]);
+    // Выброшенная строка получает новый номер в конце
+    EXPECT_EQ(symbols.intern("b"), 3u);
+}
@@ -80,6 +80,13 @@ class AggregationService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetCustomEventsAggResponse>> PrepareAsyncGetCustomEventsAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetCustomEventsAggResponse>>(PrepareAsyncGetCustomEventsAggRaw(context, request, cq));
     }
+    virtual ::grpc::Status GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::metricsys::aggregation::GetUniquesAggResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetUniquesAggResponse>> AsyncGetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetUniquesAggResponse>>(AsyncGetUniquesAggRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetUniquesAggResponse>> PrepareAsyncGetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetUniquesAggResponse>>(PrepareAsyncGetUniquesAggRaw(context, request, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -95,6 +102,8 @@ class AggregationService final {
       virtual void GetErrorsAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetErrorsAggRequest* request, ::metricsys::aggregation::GetErrorsAggResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetCustomEventsAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest* request, ::metricsys::aggregation::GetCustomEventsAggResponse* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetCustomEventsAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest* request, ::metricsys::aggregation::GetCustomEventsAggResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      virtual void GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -112,6 +121,8 @@ class AggregationService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetErrorsAggResponse>* PrepareAsyncGetErrorsAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetErrorsAggRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetCustomEventsAggResponse>* AsyncGetCustomEventsAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetCustomEventsAggResponse>* PrepareAsyncGetCustomEventsAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetUniquesAggResponse>* AsyncGetUniquesAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::metricsys::aggregation::GetUniquesAggResponse>* PrepareAsyncGetUniquesAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -158,6 +169,13 @@ class AggregationService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetCustomEventsAggResponse>> PrepareAsyncGetCustomEventsAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetCustomEventsAggResponse>>(PrepareAsyncGetCustomEventsAggRaw(context, request, cq));
     }
+    ::grpc::Status GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::metricsys::aggregation::GetUniquesAggResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetUniquesAggResponse>> AsyncGetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetUniquesAggResponse>>(AsyncGetUniquesAggRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetUniquesAggResponse>> PrepareAsyncGetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetUniquesAggResponse>>(PrepareAsyncGetUniquesAggRaw(context, request, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -173,6 +191,8 @@ class AggregationService final {
       void GetErrorsAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetErrorsAggRequest* request, ::metricsys::aggregation::GetErrorsAggResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetCustomEventsAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest* request, ::metricsys::aggregation::GetCustomEventsAggResponse* response, std::function<void(::grpc::Status)>) override;
       void GetCustomEventsAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest* request, ::metricsys::aggregation::GetCustomEventsAggResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetUniquesAgg(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -196,12 +216,15 @@ class AggregationService final {
     ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetErrorsAggResponse>* PrepareAsyncGetErrorsAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetErrorsAggRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetCustomEventsAggResponse>* AsyncGetCustomEventsAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetCustomEventsAggResponse>* PrepareAsyncGetCustomEventsAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetUniquesAggResponse>* AsyncGetUniquesAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::metricsys::aggregation::GetUniquesAggResponse>* PrepareAsyncGetUniquesAggRaw(::grpc::ClientContext* context, const ::metricsys::aggregation::GetUniquesAggRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetWatermark_;
     const ::grpc::internal::RpcMethod rpcmethod_GetPageViewsAgg_;
     const ::grpc::internal::RpcMethod rpcmethod_GetClicksAgg_;
     const ::grpc::internal::RpcMethod rpcmethod_GetPerformanceAgg_;
     const ::grpc::internal::RpcMethod rpcmethod_GetErrorsAgg_;
     const ::grpc::internal::RpcMethod rpcmethod_GetCustomEventsAgg_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetUniquesAgg_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -215,6 +238,7 @@ class AggregationService final {
     virtual ::grpc::Status GetPerformanceAgg(::grpc::ServerContext* context, const ::metricsys::aggregation::GetPerformanceAggRequest* request, ::metricsys::aggregation::GetPerformanceAggResponse* response);
     virtual ::grpc::Status GetErrorsAgg(::grpc::ServerContext* context, const ::metricsys::aggregation::GetErrorsAggRequest* request, ::metricsys::aggregation::GetErrorsAggResponse* response);
     virtual ::grpc::Status GetCustomEventsAgg(::grpc::ServerContext* context, const ::metricsys::aggregation::GetCustomEventsAggRequest* request, ::metricsys::aggregation::GetCustomEventsAggResponse* response);
+    virtual ::grpc::Status GetUniquesAgg(::grpc::ServerContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetWatermark : public BaseClass {
@@ -336,7 +360,27 @@ class AggregationService final {
       ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetWatermark<WithAsyncMethod_GetPageViewsAgg<WithAsyncMethod_GetClicksAgg<WithAsyncMethod_GetPerformanceAgg<WithAsyncMethod_GetErrorsAgg<WithAsyncMethod_GetCustomEventsAgg<Service > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_GetUniquesAgg : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetUniquesAgg() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_GetUniquesAgg() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetUniquesAgg(::grpc::ServerContext* /*context*/, const ::metricsys::aggregation::GetUniquesAggRequest* /*request*/, ::metricsys::aggregation::GetUniquesAggResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetUniquesAgg(::grpc::ServerContext* context, ::metricsys::aggregation::GetUniquesAggRequest* request, ::grpc::ServerAsyncResponseWriter< ::metricsys::aggregation::GetUniquesAggResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GetWatermark<WithAsyncMethod_GetPageViewsAgg<WithAsyncMethod_GetClicksAgg<WithAsyncMethod_GetPerformanceAgg<WithAsyncMethod_GetErrorsAgg<WithAsyncMethod_GetCustomEventsAgg<WithAsyncMethod_GetUniquesAgg<Service > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_GetWatermark : public BaseClass {
    private:
@@ -499,7 +543,34 @@ class AggregationService final {
     virtual ::grpc::ServerUnaryReactor* GetCustomEventsAgg(
       ::grpc::CallbackServerContext* /*context*/, const ::metricsys::aggregation::GetCustomEventsAggRequest* /*request*/, ::metricsys::aggregation::GetCustomEventsAggResponse* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_GetWatermark<WithCallbackMethod_GetPageViewsAgg<WithCallbackMethod_GetClicksAgg<WithCallbackMethod_GetPerformanceAgg<WithCallbackMethod_GetErrorsAgg<WithCallbackMethod_GetCustomEventsAgg<Service > > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_GetUniquesAgg : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetUniquesAgg() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::metricsys::aggregation::GetUniquesAggRequest, ::metricsys::aggregation::GetUniquesAggResponse>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::metricsys::aggregation::GetUniquesAggRequest* request, ::metricsys::aggregation::GetUniquesAggResponse* response) { return this->GetUniquesAgg(context, request, response); }));}
+    void SetMessageAllocatorFor_GetUniquesAgg(
+        ::grpc::MessageAllocator< ::metricsys::aggregation::GetUniquesAggRequest, ::metricsys::aggregation::GetUniquesAggResponse>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::metricsys::aggregation::GetUniquesAggRequest, ::metricsys::aggregation::GetUniquesAggResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_GetUniquesAgg() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetUniquesAgg(::grpc::ServerContext* /*context*/, const ::metricsys::aggregation::GetUniquesAggRequest* /*request*/, ::metricsys::aggregation::GetUniquesAggResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetUniquesAgg(
+      ::grpc::CallbackServerContext* /*context*/, const ::metricsys::aggregation::GetUniquesAggRequest* /*request*/, ::metricsys::aggregation::GetUniquesAggResponse* /*response*/)  { return nullptr; }
+  };
+  typedef WithCallbackMethod_GetWatermark<WithCallbackMethod_GetPageViewsAgg<WithCallbackMethod_GetClicksAgg<WithCallbackMethod_GetPerformanceAgg<WithCallbackMethod_GetErrorsAgg<WithCallbackMethod_GetCustomEventsAgg<WithCallbackMethod_GetUniquesAgg<Service > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetWatermark : public BaseClass {
@@ -604,6 +675,23 @@ class AggregationService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_GetUniquesAgg : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetUniquesAgg() {
+      ::grpc::Service::MarkMethodGeneric(6);
+    }
+    ~WithGenericMethod_GetUniquesAgg() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetUniquesAgg(::grpc::ServerContext* /*context*/, const ::metricsys::aggregation::GetUniquesAggRequest* /*request*/, ::metricsys::aggregation::GetUniquesAggResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GetWatermark : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -724,6 +812,26 @@ class AggregationService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_GetUniquesAgg : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetUniquesAgg() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_GetUniquesAgg() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetUniquesAgg(::grpc::ServerContext* /*context*/, const ::metricsys::aggregation::GetUniquesAggRequest* /*request*/, ::metricsys::aggregation::GetUniquesAggResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetUniquesAgg(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_GetWatermark : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -856,6 +964,28 @@ class AggregationService final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_GetUniquesAgg : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetUniquesAgg() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetUniquesAgg(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_GetUniquesAgg() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetUniquesAgg(::grpc::ServerContext* /*context*/, const ::metricsys::aggregation::GetUniquesAggRequest* /*request*/, ::metricsys::aggregation::GetUniquesAggResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* GetUniquesAgg(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetWatermark : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1017,9 +1147,36 @@ class AggregationService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedGetCustomEventsAgg(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::metricsys::aggregation::GetCustomEventsAggRequest,::metricsys::aggregation::GetCustomEventsAggResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_GetWatermark<WithStreamedUnaryMethod_GetPageViewsAgg<WithStreamedUnaryMethod_GetClicksAgg<WithStreamedUnaryMethod_GetPerformanceAgg<WithStreamedUnaryMethod_GetErrorsAgg<WithStreamedUnaryMethod_GetCustomEventsAgg<Service > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetUniquesAgg : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetUniquesAgg() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::metricsys::aggregation::GetUniquesAggRequest, ::metricsys::aggregation::GetUniquesAggResponse>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::metricsys::aggregation::GetUniquesAggRequest, ::metricsys::aggregation::GetUniquesAggResponse>* streamer) {
+                       return this->StreamedGetUniquesAgg(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetUniquesAgg() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetUniquesAgg(::grpc::ServerContext* /*context*/, const ::metricsys::aggregation::GetUniquesAggRequest* /*request*/, ::metricsys::aggregation::GetUniquesAggResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetUniquesAgg(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::metricsys::aggregation::GetUniquesAggRequest,::metricsys::aggregation::GetUniquesAggResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_GetWatermark<WithStreamedUnaryMethod_GetPageViewsAgg<WithStreamedUnaryMethod_GetClicksAgg<WithStreamedUnaryMethod_GetPerformanceAgg<WithStreamedUnaryMethod_GetErrorsAgg<WithStreamedUnaryMethod_GetCustomEventsAgg<WithStreamedUnaryMethod_GetUniquesAgg<Service > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GetWatermark<WithStreamedUnaryMethod_GetPageViewsAgg<WithStreamedUnaryMethod_GetClicksAgg<WithStreamedUnaryMethod_GetPerformanceAgg<WithStreamedUnaryMethod_GetErrorsAgg<WithStreamedUnaryMethod_GetCustomEventsAgg<Service > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_GetWatermark<WithStreamedUnaryMethod_GetPageViewsAgg<WithStreamedUnaryMethod_GetClicksAgg<WithStreamedUnaryMethod_GetPerformanceAgg<WithStreamedUnaryMethod_GetErrorsAgg<WithStreamedUnaryMethod_GetCustomEventsAgg<WithStreamedUnaryMethod_GetUniquesAgg<Service > > > > > > > StreamedService;
 };
 
 }  // namespace aggregation
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "metrics.pb.h"
+#include "models.hpp"
+#include "rabbitmq.hpp"
+
+// Кодирование событий для очередей metrics-service.
+// Protobuf (metricsys.*Event из metrics.proto) короче JSON и разбирается без
+// поиска ключей; JSON остаётся для совместимости со старыми потребителями.
+// Формат задаётся API_PAYLOAD_FORMAT=json|protobuf, по умолчанию json
+PayloadFormat loadPayloadFormat();
+
+metricsys::PageViewEvent toProto(const PageViewEvent& event);
+metricsys::ClickEvent toProto(const ClickEvent& event);
+metricsys::PerformanceEvent toProto(const PerformanceEvent& event);
+metricsys::ErrorEvent toProto(const ErrorEvent& event);
+// Строковые свойства передаются как есть, остальные — их JSON-представлением
+metricsys::CustomEvent toProto(const CustomEvent& event);
+
+template <typename Event>
+PublishMessage encodeEvent(const char* queue, const Event& event, PayloadFormat format) {
+    if (format == PayloadFormat::Protobuf) {
+        return makePublishMessage(queue, toProto(event).SerializeAsString(), format);
+    }
+    return makePublishMessage(queue, nlohmann::json(event).dump(), format);
+}
@@ -27,6 +27,9 @@ void handleErrorEvent(const httplib::Request& req, httplib::Response& res);
 // POST /custom-events
 void handleCustomEvent(const httplib::Request& req, httplib::Response& res);
 
+// POST /events/batch — массив событий разных типов, статус по каждому элементу
+void handleEventsBatch(const httplib::Request& req, httplib::Response& res);
+
 // GET /aggregation/watermark
 void handleAggregationWatermark(const httplib::Request& req, httplib::Response& res);
 
@@ -45,6 +48,9 @@ void handleAggregationErrors(const httplib::Request& req, httplib::Response& res
 // POST /aggregation/custom-events
 void handleAggregationCustomEvents(const httplib::Request& req, httplib::Response& res);
 
+// GET /metrics — счётчики кеша ответов /aggregation/* (Prometheus)
+void handleMetrics(const httplib::Request& req, httplib::Response& res);
+
 // ==================== Route Registration ====================
 
 void registerRoutes(httplib::Server& server);
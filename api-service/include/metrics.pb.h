@@ -0,0 +1,10448 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: metrics.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_metrics_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_metrics_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/map.h>  // IWYU pragma: export
+#include <google/protobuf/map_entry.h>
+#include <google/protobuf/map_field_inl.h>
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_metrics_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_metrics_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_metrics_2eproto;
+namespace metricsys {
+class ClickEvent;
+struct ClickEventDefaultTypeInternal;
+extern ClickEventDefaultTypeInternal _ClickEvent_default_instance_;
+class CustomEvent;
+struct CustomEventDefaultTypeInternal;
+extern CustomEventDefaultTypeInternal _CustomEvent_default_instance_;
+class CustomEvent_PropertiesEntry_DoNotUse;
+struct CustomEvent_PropertiesEntry_DoNotUseDefaultTypeInternal;
+extern CustomEvent_PropertiesEntry_DoNotUseDefaultTypeInternal _CustomEvent_PropertiesEntry_DoNotUse_default_instance_;
+class ErrorEvent;
+struct ErrorEventDefaultTypeInternal;
+extern ErrorEventDefaultTypeInternal _ErrorEvent_default_instance_;
+class EventCursor;
+struct EventCursorDefaultTypeInternal;
+extern EventCursorDefaultTypeInternal _EventCursor_default_instance_;
+class GetClicksRequest;
+struct GetClicksRequestDefaultTypeInternal;
+extern GetClicksRequestDefaultTypeInternal _GetClicksRequest_default_instance_;
+class GetClicksResponse;
+struct GetClicksResponseDefaultTypeInternal;
+extern GetClicksResponseDefaultTypeInternal _GetClicksResponse_default_instance_;
+class GetCustomEventsRequest;
+struct GetCustomEventsRequestDefaultTypeInternal;
+extern GetCustomEventsRequestDefaultTypeInternal _GetCustomEventsRequest_default_instance_;
+class GetCustomEventsResponse;
+struct GetCustomEventsResponseDefaultTypeInternal;
+extern GetCustomEventsResponseDefaultTypeInternal _GetCustomEventsResponse_default_instance_;
+class GetErrorsRequest;
+struct GetErrorsRequestDefaultTypeInternal;
+extern GetErrorsRequestDefaultTypeInternal _GetErrorsRequest_default_instance_;
+class GetErrorsResponse;
+struct GetErrorsResponseDefaultTypeInternal;
+extern GetErrorsResponseDefaultTypeInternal _GetErrorsResponse_default_instance_;
+class GetPageViewsRequest;
+struct GetPageViewsRequestDefaultTypeInternal;
+extern GetPageViewsRequestDefaultTypeInternal _GetPageViewsRequest_default_instance_;
+class GetPageViewsResponse;
+struct GetPageViewsResponseDefaultTypeInternal;
+extern GetPageViewsResponseDefaultTypeInternal _GetPageViewsResponse_default_instance_;
+class GetPerformanceRequest;
+struct GetPerformanceRequestDefaultTypeInternal;
+extern GetPerformanceRequestDefaultTypeInternal _GetPerformanceRequest_default_instance_;
+class GetPerformanceResponse;
+struct GetPerformanceResponseDefaultTypeInternal;
+extern GetPerformanceResponseDefaultTypeInternal _GetPerformanceResponse_default_instance_;
+class PageViewEvent;
+struct PageViewEventDefaultTypeInternal;
+extern PageViewEventDefaultTypeInternal _PageViewEvent_default_instance_;
+class Pagination;
+struct PaginationDefaultTypeInternal;
+extern PaginationDefaultTypeInternal _Pagination_default_instance_;
+class PerformanceEvent;
+struct PerformanceEventDefaultTypeInternal;
+extern PerformanceEventDefaultTypeInternal _PerformanceEvent_default_instance_;
+class TimeRange;
+struct TimeRangeDefaultTypeInternal;
+extern TimeRangeDefaultTypeInternal _TimeRange_default_instance_;
+}  // namespace metricsys
+PROTOBUF_NAMESPACE_OPEN
+template<> ::metricsys::ClickEvent* Arena::CreateMaybeMessage<::metricsys::ClickEvent>(Arena*);
+template<> ::metricsys::CustomEvent* Arena::CreateMaybeMessage<::metricsys::CustomEvent>(Arena*);
+template<> ::metricsys::CustomEvent_PropertiesEntry_DoNotUse* Arena::CreateMaybeMessage<::metricsys::CustomEvent_PropertiesEntry_DoNotUse>(Arena*);
+template<> ::metricsys::ErrorEvent* Arena::CreateMaybeMessage<::metricsys::ErrorEvent>(Arena*);
+template<> ::metricsys::EventCursor* Arena::CreateMaybeMessage<::metricsys::EventCursor>(Arena*);
+template<> ::metricsys::GetClicksRequest* Arena::CreateMaybeMessage<::metricsys::GetClicksRequest>(Arena*);
+template<> ::metricsys::GetClicksResponse* Arena::CreateMaybeMessage<::metricsys::GetClicksResponse>(Arena*);
+template<> ::metricsys::GetCustomEventsRequest* Arena::CreateMaybeMessage<::metricsys::GetCustomEventsRequest>(Arena*);
+template<> ::metricsys::GetCustomEventsResponse* Arena::CreateMaybeMessage<::metricsys::GetCustomEventsResponse>(Arena*);
+template<> ::metricsys::GetErrorsRequest* Arena::CreateMaybeMessage<::metricsys::GetErrorsRequest>(Arena*);
+template<> ::metricsys::GetErrorsResponse* Arena::CreateMaybeMessage<::metricsys::GetErrorsResponse>(Arena*);
+template<> ::metricsys::GetPageViewsRequest* Arena::CreateMaybeMessage<::metricsys::GetPageViewsRequest>(Arena*);
+template<> ::metricsys::GetPageViewsResponse* Arena::CreateMaybeMessage<::metricsys::GetPageViewsResponse>(Arena*);
+template<> ::metricsys::GetPerformanceRequest* Arena::CreateMaybeMessage<::metricsys::GetPerformanceRequest>(Arena*);
+template<> ::metricsys::GetPerformanceResponse* Arena::CreateMaybeMessage<::metricsys::GetPerformanceResponse>(Arena*);
+template<> ::metricsys::PageViewEvent* Arena::CreateMaybeMessage<::metricsys::PageViewEvent>(Arena*);
+template<> ::metricsys::Pagination* Arena::CreateMaybeMessage<::metricsys::Pagination>(Arena*);
+template<> ::metricsys::PerformanceEvent* Arena::CreateMaybeMessage<::metricsys::PerformanceEvent>(Arena*);
+template<> ::metricsys::TimeRange* Arena::CreateMaybeMessage<::metricsys::TimeRange>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace metricsys {
+
+enum Severity : int {
+  SEVERITY_UNSPECIFIED = 0,
+  SEVERITY_WARNING = 1,
+  SEVERITY_ERROR = 2,
+  SEVERITY_CRITICAL = 3,
+  Severity_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Severity_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Severity_IsValid(int value);
+constexpr Severity Severity_MIN = SEVERITY_UNSPECIFIED;
+constexpr Severity Severity_MAX = SEVERITY_CRITICAL;
+constexpr int Severity_ARRAYSIZE = Severity_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Severity_descriptor();
+template<typename T>
+inline const std::string& Severity_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Severity>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Severity_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Severity_descriptor(), enum_t_value);
+}
+inline bool Severity_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Severity* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Severity>(
+    Severity_descriptor(), name, value);
+}
+// ===================================================================
+
+class TimeRange final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.TimeRange) */ {
+ public:
+  inline TimeRange() : TimeRange(nullptr) {}
+  ~TimeRange() override;
+  explicit PROTOBUF_CONSTEXPR TimeRange(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TimeRange(const TimeRange& from);
+  TimeRange(TimeRange&& from) noexcept
+    : TimeRange() {
+    *this = ::std::move(from);
+  }
+
+  inline TimeRange& operator=(const TimeRange& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TimeRange& operator=(TimeRange&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TimeRange& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TimeRange* internal_default_instance() {
+    return reinterpret_cast<const TimeRange*>(
+               &_TimeRange_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TimeRange& a, TimeRange& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TimeRange* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TimeRange* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TimeRange* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TimeRange>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TimeRange& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TimeRange& from) {
+    TimeRange::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TimeRange* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.TimeRange";
+  }
+  protected:
+  explicit TimeRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartTimestampFieldNumber = 1,
+    kEndTimestampFieldNumber = 2,
+  };
+  // int64 start_timestamp = 1;
+  void clear_start_timestamp();
+  int64_t start_timestamp() const;
+  void set_start_timestamp(int64_t value);
+  private:
+  int64_t _internal_start_timestamp() const;
+  void _internal_set_start_timestamp(int64_t value);
+  public:
+
+  // int64 end_timestamp = 2;
+  void clear_end_timestamp();
+  int64_t end_timestamp() const;
+  void set_end_timestamp(int64_t value);
+  private:
+  int64_t _internal_end_timestamp() const;
+  void _internal_set_end_timestamp(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.TimeRange)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int64_t start_timestamp_;
+    int64_t end_timestamp_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Pagination final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.Pagination) */ {
+ public:
+  inline Pagination() : Pagination(nullptr) {}
+  ~Pagination() override;
+  explicit PROTOBUF_CONSTEXPR Pagination(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Pagination(const Pagination& from);
+  Pagination(Pagination&& from) noexcept
+    : Pagination() {
+    *this = ::std::move(from);
+  }
+
+  inline Pagination& operator=(const Pagination& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Pagination& operator=(Pagination&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Pagination& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Pagination* internal_default_instance() {
+    return reinterpret_cast<const Pagination*>(
+               &_Pagination_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Pagination& a, Pagination& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Pagination* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Pagination* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Pagination* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Pagination>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Pagination& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Pagination& from) {
+    Pagination::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Pagination* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.Pagination";
+  }
+  protected:
+  explicit Pagination(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLimitFieldNumber = 1,
+    kOffsetFieldNumber = 2,
+  };
+  // int32 limit = 1;
+  void clear_limit();
+  int32_t limit() const;
+  void set_limit(int32_t value);
+  private:
+  int32_t _internal_limit() const;
+  void _internal_set_limit(int32_t value);
+  public:
+
+  // int32 offset = 2;
+  void clear_offset();
+  int32_t offset() const;
+  void set_offset(int32_t value);
+  private:
+  int32_t _internal_offset() const;
+  void _internal_set_offset(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.Pagination)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t limit_;
+    int32_t offset_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EventCursor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.EventCursor) */ {
+ public:
+  inline EventCursor() : EventCursor(nullptr) {}
+  ~EventCursor() override;
+  explicit PROTOBUF_CONSTEXPR EventCursor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EventCursor(const EventCursor& from);
+  EventCursor(EventCursor&& from) noexcept
+    : EventCursor() {
+    *this = ::std::move(from);
+  }
+
+  inline EventCursor& operator=(const EventCursor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EventCursor& operator=(EventCursor&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EventCursor& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EventCursor* internal_default_instance() {
+    return reinterpret_cast<const EventCursor*>(
+               &_EventCursor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(EventCursor& a, EventCursor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EventCursor* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EventCursor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EventCursor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EventCursor>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EventCursor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EventCursor& from) {
+    EventCursor::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EventCursor* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.EventCursor";
+  }
+  protected:
+  explicit EventCursor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 2,
+    kTimestampUsFieldNumber = 1,
+  };
+  // string id = 2;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // int64 timestamp_us = 1;
+  void clear_timestamp_us();
+  int64_t timestamp_us() const;
+  void set_timestamp_us(int64_t value);
+  private:
+  int64_t _internal_timestamp_us() const;
+  void _internal_set_timestamp_us(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.EventCursor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    int64_t timestamp_us_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PageViewEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.PageViewEvent) */ {
+ public:
+  inline PageViewEvent() : PageViewEvent(nullptr) {}
+  ~PageViewEvent() override;
+  explicit PROTOBUF_CONSTEXPR PageViewEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PageViewEvent(const PageViewEvent& from);
+  PageViewEvent(PageViewEvent&& from) noexcept
+    : PageViewEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline PageViewEvent& operator=(const PageViewEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PageViewEvent& operator=(PageViewEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PageViewEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PageViewEvent* internal_default_instance() {
+    return reinterpret_cast<const PageViewEvent*>(
+               &_PageViewEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(PageViewEvent& a, PageViewEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PageViewEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PageViewEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PageViewEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PageViewEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PageViewEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PageViewEvent& from) {
+    PageViewEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PageViewEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.PageViewEvent";
+  }
+  protected:
+  explicit PageViewEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kPageFieldNumber = 2,
+    kUserIdFieldNumber = 3,
+    kSessionIdFieldNumber = 4,
+    kReferrerFieldNumber = 5,
+    kTimestampFieldNumber = 6,
+    kReceivedAtFieldNumber = 7,
+  };
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string page = 2;
+  void clear_page();
+  const std::string& page() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page();
+  PROTOBUF_NODISCARD std::string* release_page();
+  void set_allocated_page(std::string* page);
+  private:
+  const std::string& _internal_page() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page(const std::string& value);
+  std::string* _internal_mutable_page();
+  public:
+
+  // optional string user_id = 3;
+  bool has_user_id() const;
+  private:
+  bool _internal_has_user_id() const;
+  public:
+  void clear_user_id();
+  const std::string& user_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id();
+  PROTOBUF_NODISCARD std::string* release_user_id();
+  void set_allocated_user_id(std::string* user_id);
+  private:
+  const std::string& _internal_user_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(const std::string& value);
+  std::string* _internal_mutable_user_id();
+  public:
+
+  // optional string session_id = 4;
+  bool has_session_id() const;
+  private:
+  bool _internal_has_session_id() const;
+  public:
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // optional string referrer = 5;
+  bool has_referrer() const;
+  private:
+  bool _internal_has_referrer() const;
+  public:
+  void clear_referrer();
+  const std::string& referrer() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_referrer(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_referrer();
+  PROTOBUF_NODISCARD std::string* release_referrer();
+  void set_allocated_referrer(std::string* referrer);
+  private:
+  const std::string& _internal_referrer() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_referrer(const std::string& value);
+  std::string* _internal_mutable_referrer();
+  public:
+
+  // int64 timestamp = 6;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // int64 received_at = 7;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.PageViewEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr referrer_;
+    int64_t timestamp_;
+    int64_t received_at_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetPageViewsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetPageViewsRequest) */ {
+ public:
+  inline GetPageViewsRequest() : GetPageViewsRequest(nullptr) {}
+  ~GetPageViewsRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetPageViewsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetPageViewsRequest(const GetPageViewsRequest& from);
+  GetPageViewsRequest(GetPageViewsRequest&& from) noexcept
+    : GetPageViewsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetPageViewsRequest& operator=(const GetPageViewsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetPageViewsRequest& operator=(GetPageViewsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetPageViewsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetPageViewsRequest* internal_default_instance() {
+    return reinterpret_cast<const GetPageViewsRequest*>(
+               &_GetPageViewsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(GetPageViewsRequest& a, GetPageViewsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetPageViewsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetPageViewsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetPageViewsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetPageViewsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetPageViewsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetPageViewsRequest& from) {
+    GetPageViewsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetPageViewsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetPageViewsRequest";
+  }
+  protected:
+  explicit GetPageViewsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPageFilterFieldNumber = 3,
+    kUserIdFilterFieldNumber = 4,
+    kTimeRangeFieldNumber = 1,
+    kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 5,
+    kReceivedRangeFieldNumber = 6,
+    kAllowSegmentsFieldNumber = 7,
+  };
+  // optional string page_filter = 3;
+  bool has_page_filter() const;
+  private:
+  bool _internal_has_page_filter() const;
+  public:
+  void clear_page_filter();
+  const std::string& page_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page_filter();
+  PROTOBUF_NODISCARD std::string* release_page_filter();
+  void set_allocated_page_filter(std::string* page_filter);
+  private:
+  const std::string& _internal_page_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page_filter(const std::string& value);
+  std::string* _internal_mutable_page_filter();
+  public:
+
+  // optional string user_id_filter = 4;
+  bool has_user_id_filter() const;
+  private:
+  bool _internal_has_user_id_filter() const;
+  public:
+  void clear_user_id_filter();
+  const std::string& user_id_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id_filter();
+  PROTOBUF_NODISCARD std::string* release_user_id_filter();
+  void set_allocated_user_id_filter(std::string* user_id_filter);
+  private:
+  const std::string& _internal_user_id_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id_filter(const std::string& value);
+  std::string* _internal_mutable_user_id_filter();
+  public:
+
+  // optional .metricsys.TimeRange time_range = 1;
+  bool has_time_range() const;
+  private:
+  bool _internal_has_time_range() const;
+  public:
+  void clear_time_range();
+  const ::metricsys::TimeRange& time_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_time_range();
+  ::metricsys::TimeRange* mutable_time_range();
+  void set_allocated_time_range(::metricsys::TimeRange* time_range);
+  private:
+  const ::metricsys::TimeRange& _internal_time_range() const;
+  ::metricsys::TimeRange* _internal_mutable_time_range();
+  public:
+  void unsafe_arena_set_allocated_time_range(
+      ::metricsys::TimeRange* time_range);
+  ::metricsys::TimeRange* unsafe_arena_release_time_range();
+
+  // optional .metricsys.Pagination pagination = 2;
+  bool has_pagination() const;
+  private:
+  bool _internal_has_pagination() const;
+  public:
+  void clear_pagination();
+  const ::metricsys::Pagination& pagination() const;
+  PROTOBUF_NODISCARD ::metricsys::Pagination* release_pagination();
+  ::metricsys::Pagination* mutable_pagination();
+  void set_allocated_pagination(::metricsys::Pagination* pagination);
+  private:
+  const ::metricsys::Pagination& _internal_pagination() const;
+  ::metricsys::Pagination* _internal_mutable_pagination();
+  public:
+  void unsafe_arena_set_allocated_pagination(
+      ::metricsys::Pagination* pagination);
+  ::metricsys::Pagination* unsafe_arena_release_pagination();
+
+  // optional .metricsys.EventCursor after = 5;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 6;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // bool allow_segments = 7;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetPageViewsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_filter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
+    ::metricsys::TimeRange* time_range_;
+    ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    bool allow_segments_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetPageViewsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetPageViewsResponse) */ {
+ public:
+  inline GetPageViewsResponse() : GetPageViewsResponse(nullptr) {}
+  ~GetPageViewsResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetPageViewsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetPageViewsResponse(const GetPageViewsResponse& from);
+  GetPageViewsResponse(GetPageViewsResponse&& from) noexcept
+    : GetPageViewsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetPageViewsResponse& operator=(const GetPageViewsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetPageViewsResponse& operator=(GetPageViewsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetPageViewsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetPageViewsResponse* internal_default_instance() {
+    return reinterpret_cast<const GetPageViewsResponse*>(
+               &_GetPageViewsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(GetPageViewsResponse& a, GetPageViewsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetPageViewsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetPageViewsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetPageViewsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetPageViewsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetPageViewsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetPageViewsResponse& from) {
+    GetPageViewsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetPageViewsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetPageViewsResponse";
+  }
+  protected:
+  explicit GetPageViewsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
+    kTotalCountFieldNumber = 2,
+  };
+  // repeated .metricsys.PageViewEvent events = 1;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::metricsys::PageViewEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PageViewEvent >*
+      mutable_events();
+  private:
+  const ::metricsys::PageViewEvent& _internal_events(int index) const;
+  ::metricsys::PageViewEvent* _internal_add_events();
+  public:
+  const ::metricsys::PageViewEvent& events(int index) const;
+  ::metricsys::PageViewEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PageViewEvent >&
+      events() const;
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
+  // int32 total_count = 2;
+  void clear_total_count();
+  int32_t total_count() const;
+  void set_total_count(int32_t value);
+  private:
+  int32_t _internal_total_count() const;
+  void _internal_set_total_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetPageViewsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PageViewEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
+    int32_t total_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ClickEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.ClickEvent) */ {
+ public:
+  inline ClickEvent() : ClickEvent(nullptr) {}
+  ~ClickEvent() override;
+  explicit PROTOBUF_CONSTEXPR ClickEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ClickEvent(const ClickEvent& from);
+  ClickEvent(ClickEvent&& from) noexcept
+    : ClickEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline ClickEvent& operator=(const ClickEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ClickEvent& operator=(ClickEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ClickEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ClickEvent* internal_default_instance() {
+    return reinterpret_cast<const ClickEvent*>(
+               &_ClickEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(ClickEvent& a, ClickEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ClickEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ClickEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ClickEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ClickEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ClickEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ClickEvent& from) {
+    ClickEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ClickEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.ClickEvent";
+  }
+  protected:
+  explicit ClickEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kPageFieldNumber = 2,
+    kElementIdFieldNumber = 3,
+    kActionFieldNumber = 4,
+    kUserIdFieldNumber = 5,
+    kSessionIdFieldNumber = 6,
+    kTimestampFieldNumber = 7,
+    kReceivedAtFieldNumber = 8,
+  };
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string page = 2;
+  void clear_page();
+  const std::string& page() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page();
+  PROTOBUF_NODISCARD std::string* release_page();
+  void set_allocated_page(std::string* page);
+  private:
+  const std::string& _internal_page() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page(const std::string& value);
+  std::string* _internal_mutable_page();
+  public:
+
+  // string element_id = 3;
+  void clear_element_id();
+  const std::string& element_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_element_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_element_id();
+  PROTOBUF_NODISCARD std::string* release_element_id();
+  void set_allocated_element_id(std::string* element_id);
+  private:
+  const std::string& _internal_element_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_element_id(const std::string& value);
+  std::string* _internal_mutable_element_id();
+  public:
+
+  // optional string action = 4;
+  bool has_action() const;
+  private:
+  bool _internal_has_action() const;
+  public:
+  void clear_action();
+  const std::string& action() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_action(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_action();
+  PROTOBUF_NODISCARD std::string* release_action();
+  void set_allocated_action(std::string* action);
+  private:
+  const std::string& _internal_action() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_action(const std::string& value);
+  std::string* _internal_mutable_action();
+  public:
+
+  // optional string user_id = 5;
+  bool has_user_id() const;
+  private:
+  bool _internal_has_user_id() const;
+  public:
+  void clear_user_id();
+  const std::string& user_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id();
+  PROTOBUF_NODISCARD std::string* release_user_id();
+  void set_allocated_user_id(std::string* user_id);
+  private:
+  const std::string& _internal_user_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(const std::string& value);
+  std::string* _internal_mutable_user_id();
+  public:
+
+  // optional string session_id = 6;
+  bool has_session_id() const;
+  private:
+  bool _internal_has_session_id() const;
+  public:
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // int64 timestamp = 7;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // int64 received_at = 8;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.ClickEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr element_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr action_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    int64_t timestamp_;
+    int64_t received_at_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetClicksRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetClicksRequest) */ {
+ public:
+  inline GetClicksRequest() : GetClicksRequest(nullptr) {}
+  ~GetClicksRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetClicksRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetClicksRequest(const GetClicksRequest& from);
+  GetClicksRequest(GetClicksRequest&& from) noexcept
+    : GetClicksRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetClicksRequest& operator=(const GetClicksRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetClicksRequest& operator=(GetClicksRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetClicksRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetClicksRequest* internal_default_instance() {
+    return reinterpret_cast<const GetClicksRequest*>(
+               &_GetClicksRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(GetClicksRequest& a, GetClicksRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetClicksRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetClicksRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetClicksRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetClicksRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetClicksRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetClicksRequest& from) {
+    GetClicksRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetClicksRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetClicksRequest";
+  }
+  protected:
+  explicit GetClicksRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPageFilterFieldNumber = 3,
+    kElementIdFilterFieldNumber = 4,
+    kUserIdFilterFieldNumber = 5,
+    kTimeRangeFieldNumber = 1,
+    kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 6,
+    kReceivedRangeFieldNumber = 7,
+    kAllowSegmentsFieldNumber = 8,
+  };
+  // optional string page_filter = 3;
+  bool has_page_filter() const;
+  private:
+  bool _internal_has_page_filter() const;
+  public:
+  void clear_page_filter();
+  const std::string& page_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page_filter();
+  PROTOBUF_NODISCARD std::string* release_page_filter();
+  void set_allocated_page_filter(std::string* page_filter);
+  private:
+  const std::string& _internal_page_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page_filter(const std::string& value);
+  std::string* _internal_mutable_page_filter();
+  public:
+
+  // optional string element_id_filter = 4;
+  bool has_element_id_filter() const;
+  private:
+  bool _internal_has_element_id_filter() const;
+  public:
+  void clear_element_id_filter();
+  const std::string& element_id_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_element_id_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_element_id_filter();
+  PROTOBUF_NODISCARD std::string* release_element_id_filter();
+  void set_allocated_element_id_filter(std::string* element_id_filter);
+  private:
+  const std::string& _internal_element_id_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_element_id_filter(const std::string& value);
+  std::string* _internal_mutable_element_id_filter();
+  public:
+
+  // optional string user_id_filter = 5;
+  bool has_user_id_filter() const;
+  private:
+  bool _internal_has_user_id_filter() const;
+  public:
+  void clear_user_id_filter();
+  const std::string& user_id_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id_filter();
+  PROTOBUF_NODISCARD std::string* release_user_id_filter();
+  void set_allocated_user_id_filter(std::string* user_id_filter);
+  private:
+  const std::string& _internal_user_id_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id_filter(const std::string& value);
+  std::string* _internal_mutable_user_id_filter();
+  public:
+
+  // optional .metricsys.TimeRange time_range = 1;
+  bool has_time_range() const;
+  private:
+  bool _internal_has_time_range() const;
+  public:
+  void clear_time_range();
+  const ::metricsys::TimeRange& time_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_time_range();
+  ::metricsys::TimeRange* mutable_time_range();
+  void set_allocated_time_range(::metricsys::TimeRange* time_range);
+  private:
+  const ::metricsys::TimeRange& _internal_time_range() const;
+  ::metricsys::TimeRange* _internal_mutable_time_range();
+  public:
+  void unsafe_arena_set_allocated_time_range(
+      ::metricsys::TimeRange* time_range);
+  ::metricsys::TimeRange* unsafe_arena_release_time_range();
+
+  // optional .metricsys.Pagination pagination = 2;
+  bool has_pagination() const;
+  private:
+  bool _internal_has_pagination() const;
+  public:
+  void clear_pagination();
+  const ::metricsys::Pagination& pagination() const;
+  PROTOBUF_NODISCARD ::metricsys::Pagination* release_pagination();
+  ::metricsys::Pagination* mutable_pagination();
+  void set_allocated_pagination(::metricsys::Pagination* pagination);
+  private:
+  const ::metricsys::Pagination& _internal_pagination() const;
+  ::metricsys::Pagination* _internal_mutable_pagination();
+  public:
+  void unsafe_arena_set_allocated_pagination(
+      ::metricsys::Pagination* pagination);
+  ::metricsys::Pagination* unsafe_arena_release_pagination();
+
+  // optional .metricsys.EventCursor after = 6;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 7;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // bool allow_segments = 8;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetClicksRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_filter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr element_id_filter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
+    ::metricsys::TimeRange* time_range_;
+    ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    bool allow_segments_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetClicksResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetClicksResponse) */ {
+ public:
+  inline GetClicksResponse() : GetClicksResponse(nullptr) {}
+  ~GetClicksResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetClicksResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetClicksResponse(const GetClicksResponse& from);
+  GetClicksResponse(GetClicksResponse&& from) noexcept
+    : GetClicksResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetClicksResponse& operator=(const GetClicksResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetClicksResponse& operator=(GetClicksResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetClicksResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetClicksResponse* internal_default_instance() {
+    return reinterpret_cast<const GetClicksResponse*>(
+               &_GetClicksResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(GetClicksResponse& a, GetClicksResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetClicksResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetClicksResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetClicksResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetClicksResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetClicksResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetClicksResponse& from) {
+    GetClicksResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetClicksResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetClicksResponse";
+  }
+  protected:
+  explicit GetClicksResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
+    kTotalCountFieldNumber = 2,
+  };
+  // repeated .metricsys.ClickEvent events = 1;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::metricsys::ClickEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ClickEvent >*
+      mutable_events();
+  private:
+  const ::metricsys::ClickEvent& _internal_events(int index) const;
+  ::metricsys::ClickEvent* _internal_add_events();
+  public:
+  const ::metricsys::ClickEvent& events(int index) const;
+  ::metricsys::ClickEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ClickEvent >&
+      events() const;
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
+  // int32 total_count = 2;
+  void clear_total_count();
+  int32_t total_count() const;
+  void set_total_count(int32_t value);
+  private:
+  int32_t _internal_total_count() const;
+  void _internal_set_total_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetClicksResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ClickEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
+    int32_t total_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PerformanceEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.PerformanceEvent) */ {
+ public:
+  inline PerformanceEvent() : PerformanceEvent(nullptr) {}
+  ~PerformanceEvent() override;
+  explicit PROTOBUF_CONSTEXPR PerformanceEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PerformanceEvent(const PerformanceEvent& from);
+  PerformanceEvent(PerformanceEvent&& from) noexcept
+    : PerformanceEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline PerformanceEvent& operator=(const PerformanceEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PerformanceEvent& operator=(PerformanceEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PerformanceEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PerformanceEvent* internal_default_instance() {
+    return reinterpret_cast<const PerformanceEvent*>(
+               &_PerformanceEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(PerformanceEvent& a, PerformanceEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PerformanceEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PerformanceEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PerformanceEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PerformanceEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PerformanceEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PerformanceEvent& from) {
+    PerformanceEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PerformanceEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.PerformanceEvent";
+  }
+  protected:
+  explicit PerformanceEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kPageFieldNumber = 2,
+    kUserIdFieldNumber = 7,
+    kSessionIdFieldNumber = 8,
+    kTtfbMsFieldNumber = 3,
+    kFcpMsFieldNumber = 4,
+    kLcpMsFieldNumber = 5,
+    kTotalPageLoadMsFieldNumber = 6,
+    kTimestampFieldNumber = 9,
+    kReceivedAtFieldNumber = 10,
+  };
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string page = 2;
+  void clear_page();
+  const std::string& page() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page();
+  PROTOBUF_NODISCARD std::string* release_page();
+  void set_allocated_page(std::string* page);
+  private:
+  const std::string& _internal_page() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page(const std::string& value);
+  std::string* _internal_mutable_page();
+  public:
+
+  // optional string user_id = 7;
+  bool has_user_id() const;
+  private:
+  bool _internal_has_user_id() const;
+  public:
+  void clear_user_id();
+  const std::string& user_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id();
+  PROTOBUF_NODISCARD std::string* release_user_id();
+  void set_allocated_user_id(std::string* user_id);
+  private:
+  const std::string& _internal_user_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(const std::string& value);
+  std::string* _internal_mutable_user_id();
+  public:
+
+  // optional string session_id = 8;
+  bool has_session_id() const;
+  private:
+  bool _internal_has_session_id() const;
+  public:
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // optional double ttfb_ms = 3;
+  bool has_ttfb_ms() const;
+  private:
+  bool _internal_has_ttfb_ms() const;
+  public:
+  void clear_ttfb_ms();
+  double ttfb_ms() const;
+  void set_ttfb_ms(double value);
+  private:
+  double _internal_ttfb_ms() const;
+  void _internal_set_ttfb_ms(double value);
+  public:
+
+  // optional double fcp_ms = 4;
+  bool has_fcp_ms() const;
+  private:
+  bool _internal_has_fcp_ms() const;
+  public:
+  void clear_fcp_ms();
+  double fcp_ms() const;
+  void set_fcp_ms(double value);
+  private:
+  double _internal_fcp_ms() const;
+  void _internal_set_fcp_ms(double value);
+  public:
+
+  // optional double lcp_ms = 5;
+  bool has_lcp_ms() const;
+  private:
+  bool _internal_has_lcp_ms() const;
+  public:
+  void clear_lcp_ms();
+  double lcp_ms() const;
+  void set_lcp_ms(double value);
+  private:
+  double _internal_lcp_ms() const;
+  void _internal_set_lcp_ms(double value);
+  public:
+
+  // optional double total_page_load_ms = 6;
+  bool has_total_page_load_ms() const;
+  private:
+  bool _internal_has_total_page_load_ms() const;
+  public:
+  void clear_total_page_load_ms();
+  double total_page_load_ms() const;
+  void set_total_page_load_ms(double value);
+  private:
+  double _internal_total_page_load_ms() const;
+  void _internal_set_total_page_load_ms(double value);
+  public:
+
+  // int64 timestamp = 9;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // int64 received_at = 10;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.PerformanceEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    double ttfb_ms_;
+    double fcp_ms_;
+    double lcp_ms_;
+    double total_page_load_ms_;
+    int64_t timestamp_;
+    int64_t received_at_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetPerformanceRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetPerformanceRequest) */ {
+ public:
+  inline GetPerformanceRequest() : GetPerformanceRequest(nullptr) {}
+  ~GetPerformanceRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetPerformanceRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetPerformanceRequest(const GetPerformanceRequest& from);
+  GetPerformanceRequest(GetPerformanceRequest&& from) noexcept
+    : GetPerformanceRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetPerformanceRequest& operator=(const GetPerformanceRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetPerformanceRequest& operator=(GetPerformanceRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetPerformanceRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetPerformanceRequest* internal_default_instance() {
+    return reinterpret_cast<const GetPerformanceRequest*>(
+               &_GetPerformanceRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(GetPerformanceRequest& a, GetPerformanceRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetPerformanceRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetPerformanceRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetPerformanceRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetPerformanceRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetPerformanceRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetPerformanceRequest& from) {
+    GetPerformanceRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetPerformanceRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetPerformanceRequest";
+  }
+  protected:
+  explicit GetPerformanceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPageFilterFieldNumber = 3,
+    kUserIdFilterFieldNumber = 4,
+    kTimeRangeFieldNumber = 1,
+    kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 5,
+    kReceivedRangeFieldNumber = 6,
+    kAllowSegmentsFieldNumber = 7,
+  };
+  // optional string page_filter = 3;
+  bool has_page_filter() const;
+  private:
+  bool _internal_has_page_filter() const;
+  public:
+  void clear_page_filter();
+  const std::string& page_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page_filter();
+  PROTOBUF_NODISCARD std::string* release_page_filter();
+  void set_allocated_page_filter(std::string* page_filter);
+  private:
+  const std::string& _internal_page_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page_filter(const std::string& value);
+  std::string* _internal_mutable_page_filter();
+  public:
+
+  // optional string user_id_filter = 4;
+  bool has_user_id_filter() const;
+  private:
+  bool _internal_has_user_id_filter() const;
+  public:
+  void clear_user_id_filter();
+  const std::string& user_id_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id_filter();
+  PROTOBUF_NODISCARD std::string* release_user_id_filter();
+  void set_allocated_user_id_filter(std::string* user_id_filter);
+  private:
+  const std::string& _internal_user_id_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id_filter(const std::string& value);
+  std::string* _internal_mutable_user_id_filter();
+  public:
+
+  // optional .metricsys.TimeRange time_range = 1;
+  bool has_time_range() const;
+  private:
+  bool _internal_has_time_range() const;
+  public:
+  void clear_time_range();
+  const ::metricsys::TimeRange& time_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_time_range();
+  ::metricsys::TimeRange* mutable_time_range();
+  void set_allocated_time_range(::metricsys::TimeRange* time_range);
+  private:
+  const ::metricsys::TimeRange& _internal_time_range() const;
+  ::metricsys::TimeRange* _internal_mutable_time_range();
+  public:
+  void unsafe_arena_set_allocated_time_range(
+      ::metricsys::TimeRange* time_range);
+  ::metricsys::TimeRange* unsafe_arena_release_time_range();
+
+  // optional .metricsys.Pagination pagination = 2;
+  bool has_pagination() const;
+  private:
+  bool _internal_has_pagination() const;
+  public:
+  void clear_pagination();
+  const ::metricsys::Pagination& pagination() const;
+  PROTOBUF_NODISCARD ::metricsys::Pagination* release_pagination();
+  ::metricsys::Pagination* mutable_pagination();
+  void set_allocated_pagination(::metricsys::Pagination* pagination);
+  private:
+  const ::metricsys::Pagination& _internal_pagination() const;
+  ::metricsys::Pagination* _internal_mutable_pagination();
+  public:
+  void unsafe_arena_set_allocated_pagination(
+      ::metricsys::Pagination* pagination);
+  ::metricsys::Pagination* unsafe_arena_release_pagination();
+
+  // optional .metricsys.EventCursor after = 5;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 6;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // bool allow_segments = 7;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetPerformanceRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_filter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
+    ::metricsys::TimeRange* time_range_;
+    ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    bool allow_segments_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetPerformanceResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetPerformanceResponse) */ {
+ public:
+  inline GetPerformanceResponse() : GetPerformanceResponse(nullptr) {}
+  ~GetPerformanceResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetPerformanceResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetPerformanceResponse(const GetPerformanceResponse& from);
+  GetPerformanceResponse(GetPerformanceResponse&& from) noexcept
+    : GetPerformanceResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetPerformanceResponse& operator=(const GetPerformanceResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetPerformanceResponse& operator=(GetPerformanceResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetPerformanceResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetPerformanceResponse* internal_default_instance() {
+    return reinterpret_cast<const GetPerformanceResponse*>(
+               &_GetPerformanceResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(GetPerformanceResponse& a, GetPerformanceResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetPerformanceResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetPerformanceResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetPerformanceResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetPerformanceResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetPerformanceResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetPerformanceResponse& from) {
+    GetPerformanceResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetPerformanceResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetPerformanceResponse";
+  }
+  protected:
+  explicit GetPerformanceResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
+    kTotalCountFieldNumber = 2,
+  };
+  // repeated .metricsys.PerformanceEvent events = 1;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::metricsys::PerformanceEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PerformanceEvent >*
+      mutable_events();
+  private:
+  const ::metricsys::PerformanceEvent& _internal_events(int index) const;
+  ::metricsys::PerformanceEvent* _internal_add_events();
+  public:
+  const ::metricsys::PerformanceEvent& events(int index) const;
+  ::metricsys::PerformanceEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PerformanceEvent >&
+      events() const;
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
+  // int32 total_count = 2;
+  void clear_total_count();
+  int32_t total_count() const;
+  void set_total_count(int32_t value);
+  private:
+  int32_t _internal_total_count() const;
+  void _internal_set_total_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetPerformanceResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PerformanceEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
+    int32_t total_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ErrorEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.ErrorEvent) */ {
+ public:
+  inline ErrorEvent() : ErrorEvent(nullptr) {}
+  ~ErrorEvent() override;
+  explicit PROTOBUF_CONSTEXPR ErrorEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ErrorEvent(const ErrorEvent& from);
+  ErrorEvent(ErrorEvent&& from) noexcept
+    : ErrorEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline ErrorEvent& operator=(const ErrorEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ErrorEvent& operator=(ErrorEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ErrorEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ErrorEvent* internal_default_instance() {
+    return reinterpret_cast<const ErrorEvent*>(
+               &_ErrorEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ErrorEvent& a, ErrorEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ErrorEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ErrorEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ErrorEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ErrorEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ErrorEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ErrorEvent& from) {
+    ErrorEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ErrorEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.ErrorEvent";
+  }
+  protected:
+  explicit ErrorEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIdFieldNumber = 1,
+    kPageFieldNumber = 2,
+    kErrorTypeFieldNumber = 3,
+    kMessageFieldNumber = 4,
+    kStackFieldNumber = 5,
+    kUserIdFieldNumber = 7,
+    kSessionIdFieldNumber = 8,
+    kTimestampFieldNumber = 9,
+    kReceivedAtFieldNumber = 10,
+    kSeverityFieldNumber = 6,
+  };
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string page = 2;
+  void clear_page();
+  const std::string& page() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page();
+  PROTOBUF_NODISCARD std::string* release_page();
+  void set_allocated_page(std::string* page);
+  private:
+  const std::string& _internal_page() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page(const std::string& value);
+  std::string* _internal_mutable_page();
+  public:
+
+  // string error_type = 3;
+  void clear_error_type();
+  const std::string& error_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_type();
+  PROTOBUF_NODISCARD std::string* release_error_type();
+  void set_allocated_error_type(std::string* error_type);
+  private:
+  const std::string& _internal_error_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_type(const std::string& value);
+  std::string* _internal_mutable_error_type();
+  public:
+
+  // string message = 4;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // optional string stack = 5;
+  bool has_stack() const;
+  private:
+  bool _internal_has_stack() const;
+  public:
+  void clear_stack();
+  const std::string& stack() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stack(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_stack();
+  PROTOBUF_NODISCARD std::string* release_stack();
+  void set_allocated_stack(std::string* stack);
+  private:
+  const std::string& _internal_stack() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stack(const std::string& value);
+  std::string* _internal_mutable_stack();
+  public:
+
+  // optional string user_id = 7;
+  bool has_user_id() const;
+  private:
+  bool _internal_has_user_id() const;
+  public:
+  void clear_user_id();
+  const std::string& user_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id();
+  PROTOBUF_NODISCARD std::string* release_user_id();
+  void set_allocated_user_id(std::string* user_id);
+  private:
+  const std::string& _internal_user_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(const std::string& value);
+  std::string* _internal_mutable_user_id();
+  public:
+
+  // optional string session_id = 8;
+  bool has_session_id() const;
+  private:
+  bool _internal_has_session_id() const;
+  public:
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // int64 timestamp = 9;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // int64 received_at = 10;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
+  // .metricsys.Severity severity = 6;
+  void clear_severity();
+  ::metricsys::Severity severity() const;
+  void set_severity(::metricsys::Severity value);
+  private:
+  ::metricsys::Severity _internal_severity() const;
+  void _internal_set_severity(::metricsys::Severity value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.ErrorEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stack_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    int64_t timestamp_;
+    int64_t received_at_;
+    int severity_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetErrorsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetErrorsRequest) */ {
+ public:
+  inline GetErrorsRequest() : GetErrorsRequest(nullptr) {}
+  ~GetErrorsRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetErrorsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetErrorsRequest(const GetErrorsRequest& from);
+  GetErrorsRequest(GetErrorsRequest&& from) noexcept
+    : GetErrorsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetErrorsRequest& operator=(const GetErrorsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetErrorsRequest& operator=(GetErrorsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetErrorsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetErrorsRequest* internal_default_instance() {
+    return reinterpret_cast<const GetErrorsRequest*>(
+               &_GetErrorsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(GetErrorsRequest& a, GetErrorsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetErrorsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetErrorsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetErrorsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetErrorsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetErrorsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetErrorsRequest& from) {
+    GetErrorsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetErrorsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetErrorsRequest";
+  }
+  protected:
+  explicit GetErrorsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPageFilterFieldNumber = 3,
+    kErrorTypeFilterFieldNumber = 5,
+    kUserIdFilterFieldNumber = 6,
+    kTimeRangeFieldNumber = 1,
+    kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 7,
+    kReceivedRangeFieldNumber = 8,
+    kSeverityFilterFieldNumber = 4,
+    kAllowSegmentsFieldNumber = 9,
+  };
+  // optional string page_filter = 3;
+  bool has_page_filter() const;
+  private:
+  bool _internal_has_page_filter() const;
+  public:
+  void clear_page_filter();
+  const std::string& page_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page_filter();
+  PROTOBUF_NODISCARD std::string* release_page_filter();
+  void set_allocated_page_filter(std::string* page_filter);
+  private:
+  const std::string& _internal_page_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page_filter(const std::string& value);
+  std::string* _internal_mutable_page_filter();
+  public:
+
+  // optional string error_type_filter = 5;
+  bool has_error_type_filter() const;
+  private:
+  bool _internal_has_error_type_filter() const;
+  public:
+  void clear_error_type_filter();
+  const std::string& error_type_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error_type_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error_type_filter();
+  PROTOBUF_NODISCARD std::string* release_error_type_filter();
+  void set_allocated_error_type_filter(std::string* error_type_filter);
+  private:
+  const std::string& _internal_error_type_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error_type_filter(const std::string& value);
+  std::string* _internal_mutable_error_type_filter();
+  public:
+
+  // optional string user_id_filter = 6;
+  bool has_user_id_filter() const;
+  private:
+  bool _internal_has_user_id_filter() const;
+  public:
+  void clear_user_id_filter();
+  const std::string& user_id_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id_filter();
+  PROTOBUF_NODISCARD std::string* release_user_id_filter();
+  void set_allocated_user_id_filter(std::string* user_id_filter);
+  private:
+  const std::string& _internal_user_id_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id_filter(const std::string& value);
+  std::string* _internal_mutable_user_id_filter();
+  public:
+
+  // optional .metricsys.TimeRange time_range = 1;
+  bool has_time_range() const;
+  private:
+  bool _internal_has_time_range() const;
+  public:
+  void clear_time_range();
+  const ::metricsys::TimeRange& time_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_time_range();
+  ::metricsys::TimeRange* mutable_time_range();
+  void set_allocated_time_range(::metricsys::TimeRange* time_range);
+  private:
+  const ::metricsys::TimeRange& _internal_time_range() const;
+  ::metricsys::TimeRange* _internal_mutable_time_range();
+  public:
+  void unsafe_arena_set_allocated_time_range(
+      ::metricsys::TimeRange* time_range);
+  ::metricsys::TimeRange* unsafe_arena_release_time_range();
+
+  // optional .metricsys.Pagination pagination = 2;
+  bool has_pagination() const;
+  private:
+  bool _internal_has_pagination() const;
+  public:
+  void clear_pagination();
+  const ::metricsys::Pagination& pagination() const;
+  PROTOBUF_NODISCARD ::metricsys::Pagination* release_pagination();
+  ::metricsys::Pagination* mutable_pagination();
+  void set_allocated_pagination(::metricsys::Pagination* pagination);
+  private:
+  const ::metricsys::Pagination& _internal_pagination() const;
+  ::metricsys::Pagination* _internal_mutable_pagination();
+  public:
+  void unsafe_arena_set_allocated_pagination(
+      ::metricsys::Pagination* pagination);
+  ::metricsys::Pagination* unsafe_arena_release_pagination();
+
+  // optional .metricsys.EventCursor after = 7;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 8;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // optional .metricsys.Severity severity_filter = 4;
+  bool has_severity_filter() const;
+  private:
+  bool _internal_has_severity_filter() const;
+  public:
+  void clear_severity_filter();
+  ::metricsys::Severity severity_filter() const;
+  void set_severity_filter(::metricsys::Severity value);
+  private:
+  ::metricsys::Severity _internal_severity_filter() const;
+  void _internal_set_severity_filter(::metricsys::Severity value);
+  public:
+
+  // bool allow_segments = 9;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetErrorsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_filter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_type_filter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
+    ::metricsys::TimeRange* time_range_;
+    ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    int severity_filter_;
+    bool allow_segments_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetErrorsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetErrorsResponse) */ {
+ public:
+  inline GetErrorsResponse() : GetErrorsResponse(nullptr) {}
+  ~GetErrorsResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetErrorsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetErrorsResponse(const GetErrorsResponse& from);
+  GetErrorsResponse(GetErrorsResponse&& from) noexcept
+    : GetErrorsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetErrorsResponse& operator=(const GetErrorsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetErrorsResponse& operator=(GetErrorsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetErrorsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetErrorsResponse* internal_default_instance() {
+    return reinterpret_cast<const GetErrorsResponse*>(
+               &_GetErrorsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(GetErrorsResponse& a, GetErrorsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetErrorsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetErrorsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetErrorsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetErrorsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetErrorsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetErrorsResponse& from) {
+    GetErrorsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetErrorsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetErrorsResponse";
+  }
+  protected:
+  explicit GetErrorsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
+    kTotalCountFieldNumber = 2,
+  };
+  // repeated .metricsys.ErrorEvent events = 1;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::metricsys::ErrorEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ErrorEvent >*
+      mutable_events();
+  private:
+  const ::metricsys::ErrorEvent& _internal_events(int index) const;
+  ::metricsys::ErrorEvent* _internal_add_events();
+  public:
+  const ::metricsys::ErrorEvent& events(int index) const;
+  ::metricsys::ErrorEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ErrorEvent >&
+      events() const;
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
+  // int32 total_count = 2;
+  void clear_total_count();
+  int32_t total_count() const;
+  void set_total_count(int32_t value);
+  private:
+  int32_t _internal_total_count() const;
+  void _internal_set_total_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetErrorsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ErrorEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
+    int32_t total_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CustomEvent_PropertiesEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<CustomEvent_PropertiesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<CustomEvent_PropertiesEntry_DoNotUse, 
+    std::string, std::string,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> SuperType;
+  CustomEvent_PropertiesEntry_DoNotUse();
+  explicit PROTOBUF_CONSTEXPR CustomEvent_PropertiesEntry_DoNotUse(
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  explicit CustomEvent_PropertiesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const CustomEvent_PropertiesEntry_DoNotUse& other);
+  static const CustomEvent_PropertiesEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const CustomEvent_PropertiesEntry_DoNotUse*>(&_CustomEvent_PropertiesEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "metricsys.CustomEvent.PropertiesEntry.key");
+ }
+  static bool ValidateValue(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "metricsys.CustomEvent.PropertiesEntry.value");
+ }
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  friend struct ::TableStruct_metrics_2eproto;
+};
+
+// -------------------------------------------------------------------
+
+class CustomEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.CustomEvent) */ {
+ public:
+  inline CustomEvent() : CustomEvent(nullptr) {}
+  ~CustomEvent() override;
+  explicit PROTOBUF_CONSTEXPR CustomEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CustomEvent(const CustomEvent& from);
+  CustomEvent(CustomEvent&& from) noexcept
+    : CustomEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline CustomEvent& operator=(const CustomEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CustomEvent& operator=(CustomEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const CustomEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CustomEvent* internal_default_instance() {
+    return reinterpret_cast<const CustomEvent*>(
+               &_CustomEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(CustomEvent& a, CustomEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CustomEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CustomEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CustomEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CustomEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const CustomEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const CustomEvent& from) {
+    CustomEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(CustomEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.CustomEvent";
+  }
+  protected:
+  explicit CustomEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  private:
+  static void ArenaDtor(void* object);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPropertiesFieldNumber = 6,
+    kIdFieldNumber = 1,
+    kNameFieldNumber = 2,
+    kPageFieldNumber = 3,
+    kUserIdFieldNumber = 4,
+    kSessionIdFieldNumber = 5,
+    kTimestampFieldNumber = 7,
+    kReceivedAtFieldNumber = 8,
+  };
+  // map<string, string> properties = 6;
+  int properties_size() const;
+  private:
+  int _internal_properties_size() const;
+  public:
+  void clear_properties();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      _internal_properties() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      _internal_mutable_properties();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+      properties() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+      mutable_properties();
+
+  // string id = 1;
+  void clear_id();
+  const std::string& id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_id();
+  PROTOBUF_NODISCARD std::string* release_id();
+  void set_allocated_id(std::string* id);
+  private:
+  const std::string& _internal_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_id(const std::string& value);
+  std::string* _internal_mutable_id();
+  public:
+
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string page = 3;
+  bool has_page() const;
+  private:
+  bool _internal_has_page() const;
+  public:
+  void clear_page();
+  const std::string& page() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page();
+  PROTOBUF_NODISCARD std::string* release_page();
+  void set_allocated_page(std::string* page);
+  private:
+  const std::string& _internal_page() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page(const std::string& value);
+  std::string* _internal_mutable_page();
+  public:
+
+  // optional string user_id = 4;
+  bool has_user_id() const;
+  private:
+  bool _internal_has_user_id() const;
+  public:
+  void clear_user_id();
+  const std::string& user_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id();
+  PROTOBUF_NODISCARD std::string* release_user_id();
+  void set_allocated_user_id(std::string* user_id);
+  private:
+  const std::string& _internal_user_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id(const std::string& value);
+  std::string* _internal_mutable_user_id();
+  public:
+
+  // optional string session_id = 5;
+  bool has_session_id() const;
+  private:
+  bool _internal_has_session_id() const;
+  public:
+  void clear_session_id();
+  const std::string& session_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_session_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_session_id();
+  PROTOBUF_NODISCARD std::string* release_session_id();
+  void set_allocated_session_id(std::string* session_id);
+  private:
+  const std::string& _internal_session_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_session_id(const std::string& value);
+  std::string* _internal_mutable_session_id();
+  public:
+
+  // int64 timestamp = 7;
+  void clear_timestamp();
+  int64_t timestamp() const;
+  void set_timestamp(int64_t value);
+  private:
+  int64_t _internal_timestamp() const;
+  void _internal_set_timestamp(int64_t value);
+  public:
+
+  // int64 received_at = 8;
+  void clear_received_at();
+  int64_t received_at() const;
+  void set_received_at(int64_t value);
+  private:
+  int64_t _internal_received_at() const;
+  void _internal_set_received_at(int64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.CustomEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+        CustomEvent_PropertiesEntry_DoNotUse,
+        std::string, std::string,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING> properties_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr session_id_;
+    int64_t timestamp_;
+    int64_t received_at_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetCustomEventsRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetCustomEventsRequest) */ {
+ public:
+  inline GetCustomEventsRequest() : GetCustomEventsRequest(nullptr) {}
+  ~GetCustomEventsRequest() override;
+  explicit PROTOBUF_CONSTEXPR GetCustomEventsRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetCustomEventsRequest(const GetCustomEventsRequest& from);
+  GetCustomEventsRequest(GetCustomEventsRequest&& from) noexcept
+    : GetCustomEventsRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetCustomEventsRequest& operator=(const GetCustomEventsRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetCustomEventsRequest& operator=(GetCustomEventsRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetCustomEventsRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetCustomEventsRequest* internal_default_instance() {
+    return reinterpret_cast<const GetCustomEventsRequest*>(
+               &_GetCustomEventsRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(GetCustomEventsRequest& a, GetCustomEventsRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetCustomEventsRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetCustomEventsRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetCustomEventsRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetCustomEventsRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetCustomEventsRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetCustomEventsRequest& from) {
+    GetCustomEventsRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetCustomEventsRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetCustomEventsRequest";
+  }
+  protected:
+  explicit GetCustomEventsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFilterFieldNumber = 3,
+    kPageFilterFieldNumber = 4,
+    kUserIdFilterFieldNumber = 5,
+    kTimeRangeFieldNumber = 1,
+    kPaginationFieldNumber = 2,
+    kAfterFieldNumber = 6,
+    kReceivedRangeFieldNumber = 7,
+    kAllowSegmentsFieldNumber = 8,
+  };
+  // optional string name_filter = 3;
+  bool has_name_filter() const;
+  private:
+  bool _internal_has_name_filter() const;
+  public:
+  void clear_name_filter();
+  const std::string& name_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name_filter();
+  PROTOBUF_NODISCARD std::string* release_name_filter();
+  void set_allocated_name_filter(std::string* name_filter);
+  private:
+  const std::string& _internal_name_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name_filter(const std::string& value);
+  std::string* _internal_mutable_name_filter();
+  public:
+
+  // optional string page_filter = 4;
+  bool has_page_filter() const;
+  private:
+  bool _internal_has_page_filter() const;
+  public:
+  void clear_page_filter();
+  const std::string& page_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_page_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_page_filter();
+  PROTOBUF_NODISCARD std::string* release_page_filter();
+  void set_allocated_page_filter(std::string* page_filter);
+  private:
+  const std::string& _internal_page_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_page_filter(const std::string& value);
+  std::string* _internal_mutable_page_filter();
+  public:
+
+  // optional string user_id_filter = 5;
+  bool has_user_id_filter() const;
+  private:
+  bool _internal_has_user_id_filter() const;
+  public:
+  void clear_user_id_filter();
+  const std::string& user_id_filter() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_user_id_filter(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_user_id_filter();
+  PROTOBUF_NODISCARD std::string* release_user_id_filter();
+  void set_allocated_user_id_filter(std::string* user_id_filter);
+  private:
+  const std::string& _internal_user_id_filter() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_user_id_filter(const std::string& value);
+  std::string* _internal_mutable_user_id_filter();
+  public:
+
+  // optional .metricsys.TimeRange time_range = 1;
+  bool has_time_range() const;
+  private:
+  bool _internal_has_time_range() const;
+  public:
+  void clear_time_range();
+  const ::metricsys::TimeRange& time_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_time_range();
+  ::metricsys::TimeRange* mutable_time_range();
+  void set_allocated_time_range(::metricsys::TimeRange* time_range);
+  private:
+  const ::metricsys::TimeRange& _internal_time_range() const;
+  ::metricsys::TimeRange* _internal_mutable_time_range();
+  public:
+  void unsafe_arena_set_allocated_time_range(
+      ::metricsys::TimeRange* time_range);
+  ::metricsys::TimeRange* unsafe_arena_release_time_range();
+
+  // optional .metricsys.Pagination pagination = 2;
+  bool has_pagination() const;
+  private:
+  bool _internal_has_pagination() const;
+  public:
+  void clear_pagination();
+  const ::metricsys::Pagination& pagination() const;
+  PROTOBUF_NODISCARD ::metricsys::Pagination* release_pagination();
+  ::metricsys::Pagination* mutable_pagination();
+  void set_allocated_pagination(::metricsys::Pagination* pagination);
+  private:
+  const ::metricsys::Pagination& _internal_pagination() const;
+  ::metricsys::Pagination* _internal_mutable_pagination();
+  public:
+  void unsafe_arena_set_allocated_pagination(
+      ::metricsys::Pagination* pagination);
+  ::metricsys::Pagination* unsafe_arena_release_pagination();
+
+  // optional .metricsys.EventCursor after = 6;
+  bool has_after() const;
+  private:
+  bool _internal_has_after() const;
+  public:
+  void clear_after();
+  const ::metricsys::EventCursor& after() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_after();
+  ::metricsys::EventCursor* mutable_after();
+  void set_allocated_after(::metricsys::EventCursor* after);
+  private:
+  const ::metricsys::EventCursor& _internal_after() const;
+  ::metricsys::EventCursor* _internal_mutable_after();
+  public:
+  void unsafe_arena_set_allocated_after(
+      ::metricsys::EventCursor* after);
+  ::metricsys::EventCursor* unsafe_arena_release_after();
+
+  // optional .metricsys.TimeRange received_range = 7;
+  bool has_received_range() const;
+  private:
+  bool _internal_has_received_range() const;
+  public:
+  void clear_received_range();
+  const ::metricsys::TimeRange& received_range() const;
+  PROTOBUF_NODISCARD ::metricsys::TimeRange* release_received_range();
+  ::metricsys::TimeRange* mutable_received_range();
+  void set_allocated_received_range(::metricsys::TimeRange* received_range);
+  private:
+  const ::metricsys::TimeRange& _internal_received_range() const;
+  ::metricsys::TimeRange* _internal_mutable_received_range();
+  public:
+  void unsafe_arena_set_allocated_received_range(
+      ::metricsys::TimeRange* received_range);
+  ::metricsys::TimeRange* unsafe_arena_release_received_range();
+
+  // bool allow_segments = 8;
+  void clear_allow_segments();
+  bool allow_segments() const;
+  void set_allow_segments(bool value);
+  private:
+  bool _internal_allow_segments() const;
+  void _internal_set_allow_segments(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetCustomEventsRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_filter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr page_filter_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr user_id_filter_;
+    ::metricsys::TimeRange* time_range_;
+    ::metricsys::Pagination* pagination_;
+    ::metricsys::EventCursor* after_;
+    ::metricsys::TimeRange* received_range_;
+    bool allow_segments_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetCustomEventsResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:metricsys.GetCustomEventsResponse) */ {
+ public:
+  inline GetCustomEventsResponse() : GetCustomEventsResponse(nullptr) {}
+  ~GetCustomEventsResponse() override;
+  explicit PROTOBUF_CONSTEXPR GetCustomEventsResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GetCustomEventsResponse(const GetCustomEventsResponse& from);
+  GetCustomEventsResponse(GetCustomEventsResponse&& from) noexcept
+    : GetCustomEventsResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetCustomEventsResponse& operator=(const GetCustomEventsResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetCustomEventsResponse& operator=(GetCustomEventsResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GetCustomEventsResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GetCustomEventsResponse* internal_default_instance() {
+    return reinterpret_cast<const GetCustomEventsResponse*>(
+               &_GetCustomEventsResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(GetCustomEventsResponse& a, GetCustomEventsResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetCustomEventsResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetCustomEventsResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GetCustomEventsResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GetCustomEventsResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GetCustomEventsResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GetCustomEventsResponse& from) {
+    GetCustomEventsResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetCustomEventsResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "metricsys.GetCustomEventsResponse";
+  }
+  protected:
+  explicit GetCustomEventsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventsFieldNumber = 1,
+    kNextCursorFieldNumber = 3,
+    kReceivedUntilFieldNumber = 4,
+    kTotalCountFieldNumber = 2,
+  };
+  // repeated .metricsys.CustomEvent events = 1;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::metricsys::CustomEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::CustomEvent >*
+      mutable_events();
+  private:
+  const ::metricsys::CustomEvent& _internal_events(int index) const;
+  ::metricsys::CustomEvent* _internal_add_events();
+  public:
+  const ::metricsys::CustomEvent& events(int index) const;
+  ::metricsys::CustomEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::CustomEvent >&
+      events() const;
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  bool has_next_cursor() const;
+  private:
+  bool _internal_has_next_cursor() const;
+  public:
+  void clear_next_cursor();
+  const ::metricsys::EventCursor& next_cursor() const;
+  PROTOBUF_NODISCARD ::metricsys::EventCursor* release_next_cursor();
+  ::metricsys::EventCursor* mutable_next_cursor();
+  void set_allocated_next_cursor(::metricsys::EventCursor* next_cursor);
+  private:
+  const ::metricsys::EventCursor& _internal_next_cursor() const;
+  ::metricsys::EventCursor* _internal_mutable_next_cursor();
+  public:
+  void unsafe_arena_set_allocated_next_cursor(
+      ::metricsys::EventCursor* next_cursor);
+  ::metricsys::EventCursor* unsafe_arena_release_next_cursor();
+
+  // optional int64 received_until = 4;
+  bool has_received_until() const;
+  private:
+  bool _internal_has_received_until() const;
+  public:
+  void clear_received_until();
+  int64_t received_until() const;
+  void set_received_until(int64_t value);
+  private:
+  int64_t _internal_received_until() const;
+  void _internal_set_received_until(int64_t value);
+  public:
+
+  // int32 total_count = 2;
+  void clear_total_count();
+  int32_t total_count() const;
+  void set_total_count(int32_t value);
+  private:
+  int32_t _internal_total_count() const;
+  void _internal_set_total_count(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:metricsys.GetCustomEventsResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::CustomEvent > events_;
+    ::metricsys::EventCursor* next_cursor_;
+    int64_t received_until_;
+    int32_t total_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TimeRange
+
+// int64 start_timestamp = 1;
+inline void TimeRange::clear_start_timestamp() {
+  _impl_.start_timestamp_ = int64_t{0};
+}
+inline int64_t TimeRange::_internal_start_timestamp() const {
+  return _impl_.start_timestamp_;
+}
+inline int64_t TimeRange::start_timestamp() const {
+  // @@protoc_insertion_point(field_get:metricsys.TimeRange.start_timestamp)
+  return _internal_start_timestamp();
+}
+inline void TimeRange::_internal_set_start_timestamp(int64_t value) {
+  
+  _impl_.start_timestamp_ = value;
+}
+inline void TimeRange::set_start_timestamp(int64_t value) {
+  _internal_set_start_timestamp(value);
+  // @@protoc_insertion_point(field_set:metricsys.TimeRange.start_timestamp)
+}
+
+// int64 end_timestamp = 2;
+inline void TimeRange::clear_end_timestamp() {
+  _impl_.end_timestamp_ = int64_t{0};
+}
+inline int64_t TimeRange::_internal_end_timestamp() const {
+  return _impl_.end_timestamp_;
+}
+inline int64_t TimeRange::end_timestamp() const {
+  // @@protoc_insertion_point(field_get:metricsys.TimeRange.end_timestamp)
+  return _internal_end_timestamp();
+}
+inline void TimeRange::_internal_set_end_timestamp(int64_t value) {
+  
+  _impl_.end_timestamp_ = value;
+}
+inline void TimeRange::set_end_timestamp(int64_t value) {
+  _internal_set_end_timestamp(value);
+  // @@protoc_insertion_point(field_set:metricsys.TimeRange.end_timestamp)
+}
+
+// -------------------------------------------------------------------
+
+// Pagination
+
+// int32 limit = 1;
+inline void Pagination::clear_limit() {
+  _impl_.limit_ = 0;
+}
+inline int32_t Pagination::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline int32_t Pagination::limit() const {
+  // @@protoc_insertion_point(field_get:metricsys.Pagination.limit)
+  return _internal_limit();
+}
+inline void Pagination::_internal_set_limit(int32_t value) {
+  
+  _impl_.limit_ = value;
+}
+inline void Pagination::set_limit(int32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:metricsys.Pagination.limit)
+}
+
+// int32 offset = 2;
+inline void Pagination::clear_offset() {
+  _impl_.offset_ = 0;
+}
+inline int32_t Pagination::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline int32_t Pagination::offset() const {
+  // @@protoc_insertion_point(field_get:metricsys.Pagination.offset)
+  return _internal_offset();
+}
+inline void Pagination::_internal_set_offset(int32_t value) {
+  
+  _impl_.offset_ = value;
+}
+inline void Pagination::set_offset(int32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:metricsys.Pagination.offset)
+}
+
+// -------------------------------------------------------------------
+
+// EventCursor
+
+// int64 timestamp_us = 1;
+inline void EventCursor::clear_timestamp_us() {
+  _impl_.timestamp_us_ = int64_t{0};
+}
+inline int64_t EventCursor::_internal_timestamp_us() const {
+  return _impl_.timestamp_us_;
+}
+inline int64_t EventCursor::timestamp_us() const {
+  // @@protoc_insertion_point(field_get:metricsys.EventCursor.timestamp_us)
+  return _internal_timestamp_us();
+}
+inline void EventCursor::_internal_set_timestamp_us(int64_t value) {
+  
+  _impl_.timestamp_us_ = value;
+}
+inline void EventCursor::set_timestamp_us(int64_t value) {
+  _internal_set_timestamp_us(value);
+  // @@protoc_insertion_point(field_set:metricsys.EventCursor.timestamp_us)
+}
+
+// string id = 2;
+inline void EventCursor::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& EventCursor::id() const {
+  // @@protoc_insertion_point(field_get:metricsys.EventCursor.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventCursor::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.EventCursor.id)
+}
+inline std::string* EventCursor::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.EventCursor.id)
+  return _s;
+}
+inline const std::string& EventCursor::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void EventCursor::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EventCursor::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EventCursor::release_id() {
+  // @@protoc_insertion_point(field_release:metricsys.EventCursor.id)
+  return _impl_.id_.Release();
+}
+inline void EventCursor::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.EventCursor.id)
+}
+
+// -------------------------------------------------------------------
+
+// PageViewEvent
+
+// string id = 1;
+inline void PageViewEvent::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& PageViewEvent::id() const {
+  // @@protoc_insertion_point(field_get:metricsys.PageViewEvent.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PageViewEvent::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.id)
+}
+inline std::string* PageViewEvent::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.PageViewEvent.id)
+  return _s;
+}
+inline const std::string& PageViewEvent::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void PageViewEvent::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::release_id() {
+  // @@protoc_insertion_point(field_release:metricsys.PageViewEvent.id)
+  return _impl_.id_.Release();
+}
+inline void PageViewEvent::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PageViewEvent.id)
+}
+
+// string page = 2;
+inline void PageViewEvent::clear_page() {
+  _impl_.page_.ClearToEmpty();
+}
+inline const std::string& PageViewEvent::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.PageViewEvent.page)
+  return _internal_page();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PageViewEvent::set_page(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.page)
+}
+inline std::string* PageViewEvent::mutable_page() {
+  std::string* _s = _internal_mutable_page();
+  // @@protoc_insertion_point(field_mutable:metricsys.PageViewEvent.page)
+  return _s;
+}
+inline const std::string& PageViewEvent::_internal_page() const {
+  return _impl_.page_.Get();
+}
+inline void PageViewEvent::_internal_set_page(const std::string& value) {
+  
+  _impl_.page_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::_internal_mutable_page() {
+  
+  return _impl_.page_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.PageViewEvent.page)
+  return _impl_.page_.Release();
+}
+inline void PageViewEvent::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PageViewEvent.page)
+}
+
+// optional string user_id = 3;
+inline bool PageViewEvent::_internal_has_user_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PageViewEvent::has_user_id() const {
+  return _internal_has_user_id();
+}
+inline void PageViewEvent::clear_user_id() {
+  _impl_.user_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PageViewEvent::user_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.PageViewEvent.user_id)
+  return _internal_user_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PageViewEvent::set_user_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.user_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.user_id)
+}
+inline std::string* PageViewEvent::mutable_user_id() {
+  std::string* _s = _internal_mutable_user_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.PageViewEvent.user_id)
+  return _s;
+}
+inline const std::string& PageViewEvent::_internal_user_id() const {
+  return _impl_.user_id_.Get();
+}
+inline void PageViewEvent::_internal_set_user_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.user_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::_internal_mutable_user_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.user_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::release_user_id() {
+  // @@protoc_insertion_point(field_release:metricsys.PageViewEvent.user_id)
+  if (!_internal_has_user_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.user_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PageViewEvent::set_allocated_user_id(std::string* user_id) {
+  if (user_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.user_id_.SetAllocated(user_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PageViewEvent.user_id)
+}
+
+// optional string session_id = 4;
+inline bool PageViewEvent::_internal_has_session_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PageViewEvent::has_session_id() const {
+  return _internal_has_session_id();
+}
+inline void PageViewEvent::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& PageViewEvent::session_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.PageViewEvent.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PageViewEvent::set_session_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.session_id)
+}
+inline std::string* PageViewEvent::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.PageViewEvent.session_id)
+  return _s;
+}
+inline const std::string& PageViewEvent::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void PageViewEvent::_internal_set_session_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::_internal_mutable_session_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::release_session_id() {
+  // @@protoc_insertion_point(field_release:metricsys.PageViewEvent.session_id)
+  if (!_internal_has_session_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.session_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PageViewEvent::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PageViewEvent.session_id)
+}
+
+// optional string referrer = 5;
+inline bool PageViewEvent::_internal_has_referrer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PageViewEvent::has_referrer() const {
+  return _internal_has_referrer();
+}
+inline void PageViewEvent::clear_referrer() {
+  _impl_.referrer_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& PageViewEvent::referrer() const {
+  // @@protoc_insertion_point(field_get:metricsys.PageViewEvent.referrer)
+  return _internal_referrer();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PageViewEvent::set_referrer(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.referrer_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.referrer)
+}
+inline std::string* PageViewEvent::mutable_referrer() {
+  std::string* _s = _internal_mutable_referrer();
+  // @@protoc_insertion_point(field_mutable:metricsys.PageViewEvent.referrer)
+  return _s;
+}
+inline const std::string& PageViewEvent::_internal_referrer() const {
+  return _impl_.referrer_.Get();
+}
+inline void PageViewEvent::_internal_set_referrer(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.referrer_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::_internal_mutable_referrer() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.referrer_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PageViewEvent::release_referrer() {
+  // @@protoc_insertion_point(field_release:metricsys.PageViewEvent.referrer)
+  if (!_internal_has_referrer()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.referrer_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.referrer_.IsDefault()) {
+    _impl_.referrer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PageViewEvent::set_allocated_referrer(std::string* referrer) {
+  if (referrer != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.referrer_.SetAllocated(referrer, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.referrer_.IsDefault()) {
+    _impl_.referrer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PageViewEvent.referrer)
+}
+
+// int64 timestamp = 6;
+inline void PageViewEvent::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t PageViewEvent::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t PageViewEvent::timestamp() const {
+  // @@protoc_insertion_point(field_get:metricsys.PageViewEvent.timestamp)
+  return _internal_timestamp();
+}
+inline void PageViewEvent::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void PageViewEvent::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.timestamp)
+}
+
+// int64 received_at = 7;
+inline void PageViewEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t PageViewEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t PageViewEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.PageViewEvent.received_at)
+  return _internal_received_at();
+}
+inline void PageViewEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void PageViewEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.PageViewEvent.received_at)
+}
+
+// -------------------------------------------------------------------
+
+// GetPageViewsRequest
+
+// optional .metricsys.TimeRange time_range = 1;
+inline bool GetPageViewsRequest::_internal_has_time_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.time_range_ != nullptr);
+  return value;
+}
+inline bool GetPageViewsRequest::has_time_range() const {
+  return _internal_has_time_range();
+}
+inline void GetPageViewsRequest::clear_time_range() {
+  if (_impl_.time_range_ != nullptr) _impl_.time_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::metricsys::TimeRange& GetPageViewsRequest::_internal_time_range() const {
+  const ::metricsys::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetPageViewsRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetPageViewsRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::TimeRange* time_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
+  }
+  _impl_.time_range_ = time_range;
+  if (time_range) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPageViewsRequest.time_range)
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::release_time_range() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsRequest.time_range)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::_internal_mutable_time_range() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
+  }
+  return _impl_.time_range_;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::mutable_time_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsRequest.time_range)
+  return _msg;
+}
+inline void GetPageViewsRequest::set_allocated_time_range(::metricsys::TimeRange* time_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.time_range_;
+  }
+  if (time_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
+    if (message_arena != submessage_arena) {
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.time_range)
+}
+
+// optional .metricsys.Pagination pagination = 2;
+inline bool GetPageViewsRequest::_internal_has_pagination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pagination_ != nullptr);
+  return value;
+}
+inline bool GetPageViewsRequest::has_pagination() const {
+  return _internal_has_pagination();
+}
+inline void GetPageViewsRequest::clear_pagination() {
+  if (_impl_.pagination_ != nullptr) _impl_.pagination_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::metricsys::Pagination& GetPageViewsRequest::_internal_pagination() const {
+  const ::metricsys::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::Pagination&>(
+      ::metricsys::_Pagination_default_instance_);
+}
+inline const ::metricsys::Pagination& GetPageViewsRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.pagination)
+  return _internal_pagination();
+}
+inline void GetPageViewsRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::Pagination* pagination) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+  }
+  _impl_.pagination_ = pagination;
+  if (pagination) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPageViewsRequest.pagination)
+}
+inline ::metricsys::Pagination* GetPageViewsRequest::release_pagination() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::Pagination* GetPageViewsRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsRequest.pagination)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+  return temp;
+}
+inline ::metricsys::Pagination* GetPageViewsRequest::_internal_mutable_pagination() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
+  }
+  return _impl_.pagination_;
+}
+inline ::metricsys::Pagination* GetPageViewsRequest::mutable_pagination() {
+  ::metricsys::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsRequest.pagination)
+  return _msg;
+}
+inline void GetPageViewsRequest::set_allocated_pagination(::metricsys::Pagination* pagination) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pagination_;
+  }
+  if (pagination) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+    if (message_arena != submessage_arena) {
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.pagination)
+}
+
+// optional string page_filter = 3;
+inline bool GetPageViewsRequest::_internal_has_page_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetPageViewsRequest::has_page_filter() const {
+  return _internal_has_page_filter();
+}
+inline void GetPageViewsRequest::clear_page_filter() {
+  _impl_.page_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GetPageViewsRequest::page_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.page_filter)
+  return _internal_page_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetPageViewsRequest::set_page_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.page_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetPageViewsRequest.page_filter)
+}
+inline std::string* GetPageViewsRequest::mutable_page_filter() {
+  std::string* _s = _internal_mutable_page_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsRequest.page_filter)
+  return _s;
+}
+inline const std::string& GetPageViewsRequest::_internal_page_filter() const {
+  return _impl_.page_filter_.Get();
+}
+inline void GetPageViewsRequest::_internal_set_page_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.page_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetPageViewsRequest::_internal_mutable_page_filter() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.page_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetPageViewsRequest::release_page_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsRequest.page_filter)
+  if (!_internal_has_page_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetPageViewsRequest::set_allocated_page_filter(std::string* page_filter) {
+  if (page_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.page_filter_.SetAllocated(page_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.page_filter)
+}
+
+// optional string user_id_filter = 4;
+inline bool GetPageViewsRequest::_internal_has_user_id_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetPageViewsRequest::has_user_id_filter() const {
+  return _internal_has_user_id_filter();
+}
+inline void GetPageViewsRequest::clear_user_id_filter() {
+  _impl_.user_id_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetPageViewsRequest::user_id_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.user_id_filter)
+  return _internal_user_id_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetPageViewsRequest::set_user_id_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.user_id_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetPageViewsRequest.user_id_filter)
+}
+inline std::string* GetPageViewsRequest::mutable_user_id_filter() {
+  std::string* _s = _internal_mutable_user_id_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsRequest.user_id_filter)
+  return _s;
+}
+inline const std::string& GetPageViewsRequest::_internal_user_id_filter() const {
+  return _impl_.user_id_filter_.Get();
+}
+inline void GetPageViewsRequest::_internal_set_user_id_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetPageViewsRequest::_internal_mutable_user_id_filter() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetPageViewsRequest::release_user_id_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsRequest.user_id_filter)
+  if (!_internal_has_user_id_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.user_id_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetPageViewsRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
+  if (user_id_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.user_id_filter)
+}
+
+// optional .metricsys.EventCursor after = 5;
+inline bool GetPageViewsRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetPageViewsRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetPageViewsRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::metricsys::EventCursor& GetPageViewsRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetPageViewsRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.after)
+  return _internal_after();
+}
+inline void GetPageViewsRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPageViewsRequest.after)
+}
+inline ::metricsys::EventCursor* GetPageViewsRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPageViewsRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPageViewsRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetPageViewsRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsRequest.after)
+  return _msg;
+}
+inline void GetPageViewsRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 6;
+inline bool GetPageViewsRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetPageViewsRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetPageViewsRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::TimeRange& GetPageViewsRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetPageViewsRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetPageViewsRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPageViewsRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetPageViewsRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsRequest.received_range)
+  return _msg;
+}
+inline void GetPageViewsRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsRequest.received_range)
+}
+
+// bool allow_segments = 7;
+inline void GetPageViewsRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
+}
+inline bool GetPageViewsRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
+}
+inline bool GetPageViewsRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsRequest.allow_segments)
+  return _internal_allow_segments();
+}
+inline void GetPageViewsRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
+}
+inline void GetPageViewsRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPageViewsRequest.allow_segments)
+}
+
+// -------------------------------------------------------------------
+
+// GetPageViewsResponse
+
+// repeated .metricsys.PageViewEvent events = 1;
+inline int GetPageViewsResponse::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int GetPageViewsResponse::events_size() const {
+  return _internal_events_size();
+}
+inline void GetPageViewsResponse::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::metricsys::PageViewEvent* GetPageViewsResponse::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsResponse.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PageViewEvent >*
+GetPageViewsResponse::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.GetPageViewsResponse.events)
+  return &_impl_.events_;
+}
+inline const ::metricsys::PageViewEvent& GetPageViewsResponse::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::metricsys::PageViewEvent& GetPageViewsResponse::events(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsResponse.events)
+  return _internal_events(index);
+}
+inline ::metricsys::PageViewEvent* GetPageViewsResponse::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::metricsys::PageViewEvent* GetPageViewsResponse::add_events() {
+  ::metricsys::PageViewEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:metricsys.GetPageViewsResponse.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PageViewEvent >&
+GetPageViewsResponse::events() const {
+  // @@protoc_insertion_point(field_list:metricsys.GetPageViewsResponse.events)
+  return _impl_.events_;
+}
+
+// int32 total_count = 2;
+inline void GetPageViewsResponse::clear_total_count() {
+  _impl_.total_count_ = 0;
+}
+inline int32_t GetPageViewsResponse::_internal_total_count() const {
+  return _impl_.total_count_;
+}
+inline int32_t GetPageViewsResponse::total_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsResponse.total_count)
+  return _internal_total_count();
+}
+inline void GetPageViewsResponse::_internal_set_total_count(int32_t value) {
+  
+  _impl_.total_count_ = value;
+}
+inline void GetPageViewsResponse::set_total_count(int32_t value) {
+  _internal_set_total_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPageViewsResponse.total_count)
+}
+
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetPageViewsResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetPageViewsResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetPageViewsResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetPageViewsResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetPageViewsResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetPageViewsResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPageViewsResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetPageViewsResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPageViewsResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPageViewsResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPageViewsResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetPageViewsResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPageViewsResponse.next_cursor)
+  return _msg;
+}
+inline void GetPageViewsResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPageViewsResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetPageViewsResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetPageViewsResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetPageViewsResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetPageViewsResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetPageViewsResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPageViewsResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetPageViewsResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetPageViewsResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPageViewsResponse.received_until)
+}
+
+// -------------------------------------------------------------------
+
+// ClickEvent
+
+// string id = 1;
+inline void ClickEvent::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& ClickEvent::id() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClickEvent::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.id)
+}
+inline std::string* ClickEvent::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.ClickEvent.id)
+  return _s;
+}
+inline const std::string& ClickEvent::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void ClickEvent::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClickEvent::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClickEvent::release_id() {
+  // @@protoc_insertion_point(field_release:metricsys.ClickEvent.id)
+  return _impl_.id_.Release();
+}
+inline void ClickEvent::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ClickEvent.id)
+}
+
+// string page = 2;
+inline void ClickEvent::clear_page() {
+  _impl_.page_.ClearToEmpty();
+}
+inline const std::string& ClickEvent::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.page)
+  return _internal_page();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClickEvent::set_page(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.page)
+}
+inline std::string* ClickEvent::mutable_page() {
+  std::string* _s = _internal_mutable_page();
+  // @@protoc_insertion_point(field_mutable:metricsys.ClickEvent.page)
+  return _s;
+}
+inline const std::string& ClickEvent::_internal_page() const {
+  return _impl_.page_.Get();
+}
+inline void ClickEvent::_internal_set_page(const std::string& value) {
+  
+  _impl_.page_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClickEvent::_internal_mutable_page() {
+  
+  return _impl_.page_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClickEvent::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.ClickEvent.page)
+  return _impl_.page_.Release();
+}
+inline void ClickEvent::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ClickEvent.page)
+}
+
+// string element_id = 3;
+inline void ClickEvent::clear_element_id() {
+  _impl_.element_id_.ClearToEmpty();
+}
+inline const std::string& ClickEvent::element_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.element_id)
+  return _internal_element_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClickEvent::set_element_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.element_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.element_id)
+}
+inline std::string* ClickEvent::mutable_element_id() {
+  std::string* _s = _internal_mutable_element_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.ClickEvent.element_id)
+  return _s;
+}
+inline const std::string& ClickEvent::_internal_element_id() const {
+  return _impl_.element_id_.Get();
+}
+inline void ClickEvent::_internal_set_element_id(const std::string& value) {
+  
+  _impl_.element_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClickEvent::_internal_mutable_element_id() {
+  
+  return _impl_.element_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClickEvent::release_element_id() {
+  // @@protoc_insertion_point(field_release:metricsys.ClickEvent.element_id)
+  return _impl_.element_id_.Release();
+}
+inline void ClickEvent::set_allocated_element_id(std::string* element_id) {
+  if (element_id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.element_id_.SetAllocated(element_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.element_id_.IsDefault()) {
+    _impl_.element_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ClickEvent.element_id)
+}
+
+// optional string action = 4;
+inline bool ClickEvent::_internal_has_action() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ClickEvent::has_action() const {
+  return _internal_has_action();
+}
+inline void ClickEvent::clear_action() {
+  _impl_.action_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ClickEvent::action() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.action)
+  return _internal_action();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClickEvent::set_action(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.action_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.action)
+}
+inline std::string* ClickEvent::mutable_action() {
+  std::string* _s = _internal_mutable_action();
+  // @@protoc_insertion_point(field_mutable:metricsys.ClickEvent.action)
+  return _s;
+}
+inline const std::string& ClickEvent::_internal_action() const {
+  return _impl_.action_.Get();
+}
+inline void ClickEvent::_internal_set_action(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.action_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClickEvent::_internal_mutable_action() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.action_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClickEvent::release_action() {
+  // @@protoc_insertion_point(field_release:metricsys.ClickEvent.action)
+  if (!_internal_has_action()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.action_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.action_.IsDefault()) {
+    _impl_.action_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ClickEvent::set_allocated_action(std::string* action) {
+  if (action != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.action_.SetAllocated(action, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.action_.IsDefault()) {
+    _impl_.action_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ClickEvent.action)
+}
+
+// optional string user_id = 5;
+inline bool ClickEvent::_internal_has_user_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ClickEvent::has_user_id() const {
+  return _internal_has_user_id();
+}
+inline void ClickEvent::clear_user_id() {
+  _impl_.user_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ClickEvent::user_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.user_id)
+  return _internal_user_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClickEvent::set_user_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.user_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.user_id)
+}
+inline std::string* ClickEvent::mutable_user_id() {
+  std::string* _s = _internal_mutable_user_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.ClickEvent.user_id)
+  return _s;
+}
+inline const std::string& ClickEvent::_internal_user_id() const {
+  return _impl_.user_id_.Get();
+}
+inline void ClickEvent::_internal_set_user_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.user_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClickEvent::_internal_mutable_user_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.user_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClickEvent::release_user_id() {
+  // @@protoc_insertion_point(field_release:metricsys.ClickEvent.user_id)
+  if (!_internal_has_user_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.user_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ClickEvent::set_allocated_user_id(std::string* user_id) {
+  if (user_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.user_id_.SetAllocated(user_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ClickEvent.user_id)
+}
+
+// optional string session_id = 6;
+inline bool ClickEvent::_internal_has_session_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ClickEvent::has_session_id() const {
+  return _internal_has_session_id();
+}
+inline void ClickEvent::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& ClickEvent::session_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ClickEvent::set_session_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.session_id)
+}
+inline std::string* ClickEvent::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.ClickEvent.session_id)
+  return _s;
+}
+inline const std::string& ClickEvent::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void ClickEvent::_internal_set_session_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ClickEvent::_internal_mutable_session_id() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ClickEvent::release_session_id() {
+  // @@protoc_insertion_point(field_release:metricsys.ClickEvent.session_id)
+  if (!_internal_has_session_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.session_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ClickEvent::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ClickEvent.session_id)
+}
+
+// int64 timestamp = 7;
+inline void ClickEvent::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t ClickEvent::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t ClickEvent::timestamp() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.timestamp)
+  return _internal_timestamp();
+}
+inline void ClickEvent::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void ClickEvent::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.timestamp)
+}
+
+// int64 received_at = 8;
+inline void ClickEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t ClickEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t ClickEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.ClickEvent.received_at)
+  return _internal_received_at();
+}
+inline void ClickEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void ClickEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.ClickEvent.received_at)
+}
+
+// -------------------------------------------------------------------
+
+// GetClicksRequest
+
+// optional .metricsys.TimeRange time_range = 1;
+inline bool GetClicksRequest::_internal_has_time_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.time_range_ != nullptr);
+  return value;
+}
+inline bool GetClicksRequest::has_time_range() const {
+  return _internal_has_time_range();
+}
+inline void GetClicksRequest::clear_time_range() {
+  if (_impl_.time_range_ != nullptr) _impl_.time_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::metricsys::TimeRange& GetClicksRequest::_internal_time_range() const {
+  const ::metricsys::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetClicksRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetClicksRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::TimeRange* time_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
+  }
+  _impl_.time_range_ = time_range;
+  if (time_range) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetClicksRequest.time_range)
+}
+inline ::metricsys::TimeRange* GetClicksRequest::release_time_range() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.time_range)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::_internal_mutable_time_range() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
+  }
+  return _impl_.time_range_;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::mutable_time_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.time_range)
+  return _msg;
+}
+inline void GetClicksRequest::set_allocated_time_range(::metricsys::TimeRange* time_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.time_range_;
+  }
+  if (time_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
+    if (message_arena != submessage_arena) {
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.time_range)
+}
+
+// optional .metricsys.Pagination pagination = 2;
+inline bool GetClicksRequest::_internal_has_pagination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pagination_ != nullptr);
+  return value;
+}
+inline bool GetClicksRequest::has_pagination() const {
+  return _internal_has_pagination();
+}
+inline void GetClicksRequest::clear_pagination() {
+  if (_impl_.pagination_ != nullptr) _impl_.pagination_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::metricsys::Pagination& GetClicksRequest::_internal_pagination() const {
+  const ::metricsys::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::Pagination&>(
+      ::metricsys::_Pagination_default_instance_);
+}
+inline const ::metricsys::Pagination& GetClicksRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.pagination)
+  return _internal_pagination();
+}
+inline void GetClicksRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::Pagination* pagination) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+  }
+  _impl_.pagination_ = pagination;
+  if (pagination) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetClicksRequest.pagination)
+}
+inline ::metricsys::Pagination* GetClicksRequest::release_pagination() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::Pagination* GetClicksRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.pagination)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+  return temp;
+}
+inline ::metricsys::Pagination* GetClicksRequest::_internal_mutable_pagination() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
+  }
+  return _impl_.pagination_;
+}
+inline ::metricsys::Pagination* GetClicksRequest::mutable_pagination() {
+  ::metricsys::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.pagination)
+  return _msg;
+}
+inline void GetClicksRequest::set_allocated_pagination(::metricsys::Pagination* pagination) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pagination_;
+  }
+  if (pagination) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+    if (message_arena != submessage_arena) {
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.pagination)
+}
+
+// optional string page_filter = 3;
+inline bool GetClicksRequest::_internal_has_page_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetClicksRequest::has_page_filter() const {
+  return _internal_has_page_filter();
+}
+inline void GetClicksRequest::clear_page_filter() {
+  _impl_.page_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GetClicksRequest::page_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.page_filter)
+  return _internal_page_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetClicksRequest::set_page_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.page_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetClicksRequest.page_filter)
+}
+inline std::string* GetClicksRequest::mutable_page_filter() {
+  std::string* _s = _internal_mutable_page_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.page_filter)
+  return _s;
+}
+inline const std::string& GetClicksRequest::_internal_page_filter() const {
+  return _impl_.page_filter_.Get();
+}
+inline void GetClicksRequest::_internal_set_page_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.page_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetClicksRequest::_internal_mutable_page_filter() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.page_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetClicksRequest::release_page_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.page_filter)
+  if (!_internal_has_page_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetClicksRequest::set_allocated_page_filter(std::string* page_filter) {
+  if (page_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.page_filter_.SetAllocated(page_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.page_filter)
+}
+
+// optional string element_id_filter = 4;
+inline bool GetClicksRequest::_internal_has_element_id_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetClicksRequest::has_element_id_filter() const {
+  return _internal_has_element_id_filter();
+}
+inline void GetClicksRequest::clear_element_id_filter() {
+  _impl_.element_id_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetClicksRequest::element_id_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.element_id_filter)
+  return _internal_element_id_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetClicksRequest::set_element_id_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.element_id_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetClicksRequest.element_id_filter)
+}
+inline std::string* GetClicksRequest::mutable_element_id_filter() {
+  std::string* _s = _internal_mutable_element_id_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.element_id_filter)
+  return _s;
+}
+inline const std::string& GetClicksRequest::_internal_element_id_filter() const {
+  return _impl_.element_id_filter_.Get();
+}
+inline void GetClicksRequest::_internal_set_element_id_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.element_id_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetClicksRequest::_internal_mutable_element_id_filter() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.element_id_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetClicksRequest::release_element_id_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.element_id_filter)
+  if (!_internal_has_element_id_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.element_id_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.element_id_filter_.IsDefault()) {
+    _impl_.element_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetClicksRequest::set_allocated_element_id_filter(std::string* element_id_filter) {
+  if (element_id_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.element_id_filter_.SetAllocated(element_id_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.element_id_filter_.IsDefault()) {
+    _impl_.element_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.element_id_filter)
+}
+
+// optional string user_id_filter = 5;
+inline bool GetClicksRequest::_internal_has_user_id_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GetClicksRequest::has_user_id_filter() const {
+  return _internal_has_user_id_filter();
+}
+inline void GetClicksRequest::clear_user_id_filter() {
+  _impl_.user_id_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& GetClicksRequest::user_id_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.user_id_filter)
+  return _internal_user_id_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetClicksRequest::set_user_id_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.user_id_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetClicksRequest.user_id_filter)
+}
+inline std::string* GetClicksRequest::mutable_user_id_filter() {
+  std::string* _s = _internal_mutable_user_id_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.user_id_filter)
+  return _s;
+}
+inline const std::string& GetClicksRequest::_internal_user_id_filter() const {
+  return _impl_.user_id_filter_.Get();
+}
+inline void GetClicksRequest::_internal_set_user_id_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetClicksRequest::_internal_mutable_user_id_filter() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetClicksRequest::release_user_id_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.user_id_filter)
+  if (!_internal_has_user_id_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.user_id_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetClicksRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
+  if (user_id_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.user_id_filter)
+}
+
+// optional .metricsys.EventCursor after = 6;
+inline bool GetClicksRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetClicksRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetClicksRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::EventCursor& GetClicksRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetClicksRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.after)
+  return _internal_after();
+}
+inline void GetClicksRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetClicksRequest.after)
+}
+inline ::metricsys::EventCursor* GetClicksRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetClicksRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetClicksRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetClicksRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.after)
+  return _msg;
+}
+inline void GetClicksRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 7;
+inline bool GetClicksRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetClicksRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetClicksRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::metricsys::TimeRange& GetClicksRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetClicksRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetClicksRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetClicksRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetClicksRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetClicksRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksRequest.received_range)
+  return _msg;
+}
+inline void GetClicksRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksRequest.received_range)
+}
+
+// bool allow_segments = 8;
+inline void GetClicksRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
+}
+inline bool GetClicksRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
+}
+inline bool GetClicksRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksRequest.allow_segments)
+  return _internal_allow_segments();
+}
+inline void GetClicksRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
+}
+inline void GetClicksRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetClicksRequest.allow_segments)
+}
+
+// -------------------------------------------------------------------
+
+// GetClicksResponse
+
+// repeated .metricsys.ClickEvent events = 1;
+inline int GetClicksResponse::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int GetClicksResponse::events_size() const {
+  return _internal_events_size();
+}
+inline void GetClicksResponse::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::metricsys::ClickEvent* GetClicksResponse::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksResponse.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ClickEvent >*
+GetClicksResponse::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.GetClicksResponse.events)
+  return &_impl_.events_;
+}
+inline const ::metricsys::ClickEvent& GetClicksResponse::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::metricsys::ClickEvent& GetClicksResponse::events(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksResponse.events)
+  return _internal_events(index);
+}
+inline ::metricsys::ClickEvent* GetClicksResponse::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::metricsys::ClickEvent* GetClicksResponse::add_events() {
+  ::metricsys::ClickEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:metricsys.GetClicksResponse.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ClickEvent >&
+GetClicksResponse::events() const {
+  // @@protoc_insertion_point(field_list:metricsys.GetClicksResponse.events)
+  return _impl_.events_;
+}
+
+// int32 total_count = 2;
+inline void GetClicksResponse::clear_total_count() {
+  _impl_.total_count_ = 0;
+}
+inline int32_t GetClicksResponse::_internal_total_count() const {
+  return _impl_.total_count_;
+}
+inline int32_t GetClicksResponse::total_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksResponse.total_count)
+  return _internal_total_count();
+}
+inline void GetClicksResponse::_internal_set_total_count(int32_t value) {
+  
+  _impl_.total_count_ = value;
+}
+inline void GetClicksResponse::set_total_count(int32_t value) {
+  _internal_set_total_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetClicksResponse.total_count)
+}
+
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetClicksResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetClicksResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetClicksResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetClicksResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetClicksResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetClicksResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetClicksResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetClicksResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetClicksResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetClicksResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetClicksResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetClicksResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetClicksResponse.next_cursor)
+  return _msg;
+}
+inline void GetClicksResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetClicksResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetClicksResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetClicksResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetClicksResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetClicksResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetClicksResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetClicksResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetClicksResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetClicksResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetClicksResponse.received_until)
+}
+
+// -------------------------------------------------------------------
+
+// PerformanceEvent
+
+// string id = 1;
+inline void PerformanceEvent::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& PerformanceEvent::id() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PerformanceEvent::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.id)
+}
+inline std::string* PerformanceEvent::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.PerformanceEvent.id)
+  return _s;
+}
+inline const std::string& PerformanceEvent::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void PerformanceEvent::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PerformanceEvent::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PerformanceEvent::release_id() {
+  // @@protoc_insertion_point(field_release:metricsys.PerformanceEvent.id)
+  return _impl_.id_.Release();
+}
+inline void PerformanceEvent::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PerformanceEvent.id)
+}
+
+// string page = 2;
+inline void PerformanceEvent::clear_page() {
+  _impl_.page_.ClearToEmpty();
+}
+inline const std::string& PerformanceEvent::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.page)
+  return _internal_page();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PerformanceEvent::set_page(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.page)
+}
+inline std::string* PerformanceEvent::mutable_page() {
+  std::string* _s = _internal_mutable_page();
+  // @@protoc_insertion_point(field_mutable:metricsys.PerformanceEvent.page)
+  return _s;
+}
+inline const std::string& PerformanceEvent::_internal_page() const {
+  return _impl_.page_.Get();
+}
+inline void PerformanceEvent::_internal_set_page(const std::string& value) {
+  
+  _impl_.page_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PerformanceEvent::_internal_mutable_page() {
+  
+  return _impl_.page_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PerformanceEvent::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.PerformanceEvent.page)
+  return _impl_.page_.Release();
+}
+inline void PerformanceEvent::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PerformanceEvent.page)
+}
+
+// optional double ttfb_ms = 3;
+inline bool PerformanceEvent::_internal_has_ttfb_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool PerformanceEvent::has_ttfb_ms() const {
+  return _internal_has_ttfb_ms();
+}
+inline void PerformanceEvent::clear_ttfb_ms() {
+  _impl_.ttfb_ms_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double PerformanceEvent::_internal_ttfb_ms() const {
+  return _impl_.ttfb_ms_;
+}
+inline double PerformanceEvent::ttfb_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.ttfb_ms)
+  return _internal_ttfb_ms();
+}
+inline void PerformanceEvent::_internal_set_ttfb_ms(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.ttfb_ms_ = value;
+}
+inline void PerformanceEvent::set_ttfb_ms(double value) {
+  _internal_set_ttfb_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.ttfb_ms)
+}
+
+// optional double fcp_ms = 4;
+inline bool PerformanceEvent::_internal_has_fcp_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool PerformanceEvent::has_fcp_ms() const {
+  return _internal_has_fcp_ms();
+}
+inline void PerformanceEvent::clear_fcp_ms() {
+  _impl_.fcp_ms_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double PerformanceEvent::_internal_fcp_ms() const {
+  return _impl_.fcp_ms_;
+}
+inline double PerformanceEvent::fcp_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.fcp_ms)
+  return _internal_fcp_ms();
+}
+inline void PerformanceEvent::_internal_set_fcp_ms(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.fcp_ms_ = value;
+}
+inline void PerformanceEvent::set_fcp_ms(double value) {
+  _internal_set_fcp_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.fcp_ms)
+}
+
+// optional double lcp_ms = 5;
+inline bool PerformanceEvent::_internal_has_lcp_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool PerformanceEvent::has_lcp_ms() const {
+  return _internal_has_lcp_ms();
+}
+inline void PerformanceEvent::clear_lcp_ms() {
+  _impl_.lcp_ms_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double PerformanceEvent::_internal_lcp_ms() const {
+  return _impl_.lcp_ms_;
+}
+inline double PerformanceEvent::lcp_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.lcp_ms)
+  return _internal_lcp_ms();
+}
+inline void PerformanceEvent::_internal_set_lcp_ms(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.lcp_ms_ = value;
+}
+inline void PerformanceEvent::set_lcp_ms(double value) {
+  _internal_set_lcp_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.lcp_ms)
+}
+
+// optional double total_page_load_ms = 6;
+inline bool PerformanceEvent::_internal_has_total_page_load_ms() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool PerformanceEvent::has_total_page_load_ms() const {
+  return _internal_has_total_page_load_ms();
+}
+inline void PerformanceEvent::clear_total_page_load_ms() {
+  _impl_.total_page_load_ms_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double PerformanceEvent::_internal_total_page_load_ms() const {
+  return _impl_.total_page_load_ms_;
+}
+inline double PerformanceEvent::total_page_load_ms() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.total_page_load_ms)
+  return _internal_total_page_load_ms();
+}
+inline void PerformanceEvent::_internal_set_total_page_load_ms(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.total_page_load_ms_ = value;
+}
+inline void PerformanceEvent::set_total_page_load_ms(double value) {
+  _internal_set_total_page_load_ms(value);
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.total_page_load_ms)
+}
+
+// optional string user_id = 7;
+inline bool PerformanceEvent::_internal_has_user_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool PerformanceEvent::has_user_id() const {
+  return _internal_has_user_id();
+}
+inline void PerformanceEvent::clear_user_id() {
+  _impl_.user_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& PerformanceEvent::user_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.user_id)
+  return _internal_user_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PerformanceEvent::set_user_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.user_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.user_id)
+}
+inline std::string* PerformanceEvent::mutable_user_id() {
+  std::string* _s = _internal_mutable_user_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.PerformanceEvent.user_id)
+  return _s;
+}
+inline const std::string& PerformanceEvent::_internal_user_id() const {
+  return _impl_.user_id_.Get();
+}
+inline void PerformanceEvent::_internal_set_user_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.user_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PerformanceEvent::_internal_mutable_user_id() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.user_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PerformanceEvent::release_user_id() {
+  // @@protoc_insertion_point(field_release:metricsys.PerformanceEvent.user_id)
+  if (!_internal_has_user_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.user_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PerformanceEvent::set_allocated_user_id(std::string* user_id) {
+  if (user_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.user_id_.SetAllocated(user_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PerformanceEvent.user_id)
+}
+
+// optional string session_id = 8;
+inline bool PerformanceEvent::_internal_has_session_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool PerformanceEvent::has_session_id() const {
+  return _internal_has_session_id();
+}
+inline void PerformanceEvent::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& PerformanceEvent::session_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PerformanceEvent::set_session_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.session_id)
+}
+inline std::string* PerformanceEvent::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.PerformanceEvent.session_id)
+  return _s;
+}
+inline const std::string& PerformanceEvent::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void PerformanceEvent::_internal_set_session_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PerformanceEvent::_internal_mutable_session_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PerformanceEvent::release_session_id() {
+  // @@protoc_insertion_point(field_release:metricsys.PerformanceEvent.session_id)
+  if (!_internal_has_session_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.session_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void PerformanceEvent::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.PerformanceEvent.session_id)
+}
+
+// int64 timestamp = 9;
+inline void PerformanceEvent::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t PerformanceEvent::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t PerformanceEvent::timestamp() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.timestamp)
+  return _internal_timestamp();
+}
+inline void PerformanceEvent::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void PerformanceEvent::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.timestamp)
+}
+
+// int64 received_at = 10;
+inline void PerformanceEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t PerformanceEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t PerformanceEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.PerformanceEvent.received_at)
+  return _internal_received_at();
+}
+inline void PerformanceEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void PerformanceEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.PerformanceEvent.received_at)
+}
+
+// -------------------------------------------------------------------
+
+// GetPerformanceRequest
+
+// optional .metricsys.TimeRange time_range = 1;
+inline bool GetPerformanceRequest::_internal_has_time_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.time_range_ != nullptr);
+  return value;
+}
+inline bool GetPerformanceRequest::has_time_range() const {
+  return _internal_has_time_range();
+}
+inline void GetPerformanceRequest::clear_time_range() {
+  if (_impl_.time_range_ != nullptr) _impl_.time_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::metricsys::TimeRange& GetPerformanceRequest::_internal_time_range() const {
+  const ::metricsys::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetPerformanceRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetPerformanceRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::TimeRange* time_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
+  }
+  _impl_.time_range_ = time_range;
+  if (time_range) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPerformanceRequest.time_range)
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::release_time_range() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.time_range)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::_internal_mutable_time_range() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
+  }
+  return _impl_.time_range_;
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::mutable_time_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.time_range)
+  return _msg;
+}
+inline void GetPerformanceRequest::set_allocated_time_range(::metricsys::TimeRange* time_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.time_range_;
+  }
+  if (time_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
+    if (message_arena != submessage_arena) {
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.time_range)
+}
+
+// optional .metricsys.Pagination pagination = 2;
+inline bool GetPerformanceRequest::_internal_has_pagination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pagination_ != nullptr);
+  return value;
+}
+inline bool GetPerformanceRequest::has_pagination() const {
+  return _internal_has_pagination();
+}
+inline void GetPerformanceRequest::clear_pagination() {
+  if (_impl_.pagination_ != nullptr) _impl_.pagination_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::metricsys::Pagination& GetPerformanceRequest::_internal_pagination() const {
+  const ::metricsys::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::Pagination&>(
+      ::metricsys::_Pagination_default_instance_);
+}
+inline const ::metricsys::Pagination& GetPerformanceRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.pagination)
+  return _internal_pagination();
+}
+inline void GetPerformanceRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::Pagination* pagination) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+  }
+  _impl_.pagination_ = pagination;
+  if (pagination) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPerformanceRequest.pagination)
+}
+inline ::metricsys::Pagination* GetPerformanceRequest::release_pagination() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::Pagination* GetPerformanceRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.pagination)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+  return temp;
+}
+inline ::metricsys::Pagination* GetPerformanceRequest::_internal_mutable_pagination() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
+  }
+  return _impl_.pagination_;
+}
+inline ::metricsys::Pagination* GetPerformanceRequest::mutable_pagination() {
+  ::metricsys::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.pagination)
+  return _msg;
+}
+inline void GetPerformanceRequest::set_allocated_pagination(::metricsys::Pagination* pagination) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pagination_;
+  }
+  if (pagination) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+    if (message_arena != submessage_arena) {
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.pagination)
+}
+
+// optional string page_filter = 3;
+inline bool GetPerformanceRequest::_internal_has_page_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetPerformanceRequest::has_page_filter() const {
+  return _internal_has_page_filter();
+}
+inline void GetPerformanceRequest::clear_page_filter() {
+  _impl_.page_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GetPerformanceRequest::page_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.page_filter)
+  return _internal_page_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetPerformanceRequest::set_page_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.page_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceRequest.page_filter)
+}
+inline std::string* GetPerformanceRequest::mutable_page_filter() {
+  std::string* _s = _internal_mutable_page_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.page_filter)
+  return _s;
+}
+inline const std::string& GetPerformanceRequest::_internal_page_filter() const {
+  return _impl_.page_filter_.Get();
+}
+inline void GetPerformanceRequest::_internal_set_page_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.page_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetPerformanceRequest::_internal_mutable_page_filter() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.page_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetPerformanceRequest::release_page_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.page_filter)
+  if (!_internal_has_page_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetPerformanceRequest::set_allocated_page_filter(std::string* page_filter) {
+  if (page_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.page_filter_.SetAllocated(page_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.page_filter)
+}
+
+// optional string user_id_filter = 4;
+inline bool GetPerformanceRequest::_internal_has_user_id_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetPerformanceRequest::has_user_id_filter() const {
+  return _internal_has_user_id_filter();
+}
+inline void GetPerformanceRequest::clear_user_id_filter() {
+  _impl_.user_id_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetPerformanceRequest::user_id_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.user_id_filter)
+  return _internal_user_id_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetPerformanceRequest::set_user_id_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.user_id_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceRequest.user_id_filter)
+}
+inline std::string* GetPerformanceRequest::mutable_user_id_filter() {
+  std::string* _s = _internal_mutable_user_id_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.user_id_filter)
+  return _s;
+}
+inline const std::string& GetPerformanceRequest::_internal_user_id_filter() const {
+  return _impl_.user_id_filter_.Get();
+}
+inline void GetPerformanceRequest::_internal_set_user_id_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetPerformanceRequest::_internal_mutable_user_id_filter() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetPerformanceRequest::release_user_id_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.user_id_filter)
+  if (!_internal_has_user_id_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.user_id_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetPerformanceRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
+  if (user_id_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.user_id_filter)
+}
+
+// optional .metricsys.EventCursor after = 5;
+inline bool GetPerformanceRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetPerformanceRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetPerformanceRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::metricsys::EventCursor& GetPerformanceRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetPerformanceRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.after)
+  return _internal_after();
+}
+inline void GetPerformanceRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPerformanceRequest.after)
+}
+inline ::metricsys::EventCursor* GetPerformanceRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPerformanceRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPerformanceRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetPerformanceRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.after)
+  return _msg;
+}
+inline void GetPerformanceRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 6;
+inline bool GetPerformanceRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetPerformanceRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetPerformanceRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::TimeRange& GetPerformanceRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetPerformanceRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetPerformanceRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPerformanceRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetPerformanceRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceRequest.received_range)
+  return _msg;
+}
+inline void GetPerformanceRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceRequest.received_range)
+}
+
+// bool allow_segments = 7;
+inline void GetPerformanceRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
+}
+inline bool GetPerformanceRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
+}
+inline bool GetPerformanceRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceRequest.allow_segments)
+  return _internal_allow_segments();
+}
+inline void GetPerformanceRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
+}
+inline void GetPerformanceRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceRequest.allow_segments)
+}
+
+// -------------------------------------------------------------------
+
+// GetPerformanceResponse
+
+// repeated .metricsys.PerformanceEvent events = 1;
+inline int GetPerformanceResponse::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int GetPerformanceResponse::events_size() const {
+  return _internal_events_size();
+}
+inline void GetPerformanceResponse::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::metricsys::PerformanceEvent* GetPerformanceResponse::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceResponse.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PerformanceEvent >*
+GetPerformanceResponse::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.GetPerformanceResponse.events)
+  return &_impl_.events_;
+}
+inline const ::metricsys::PerformanceEvent& GetPerformanceResponse::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::metricsys::PerformanceEvent& GetPerformanceResponse::events(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceResponse.events)
+  return _internal_events(index);
+}
+inline ::metricsys::PerformanceEvent* GetPerformanceResponse::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::metricsys::PerformanceEvent* GetPerformanceResponse::add_events() {
+  ::metricsys::PerformanceEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:metricsys.GetPerformanceResponse.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::PerformanceEvent >&
+GetPerformanceResponse::events() const {
+  // @@protoc_insertion_point(field_list:metricsys.GetPerformanceResponse.events)
+  return _impl_.events_;
+}
+
+// int32 total_count = 2;
+inline void GetPerformanceResponse::clear_total_count() {
+  _impl_.total_count_ = 0;
+}
+inline int32_t GetPerformanceResponse::_internal_total_count() const {
+  return _impl_.total_count_;
+}
+inline int32_t GetPerformanceResponse::total_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceResponse.total_count)
+  return _internal_total_count();
+}
+inline void GetPerformanceResponse::_internal_set_total_count(int32_t value) {
+  
+  _impl_.total_count_ = value;
+}
+inline void GetPerformanceResponse::set_total_count(int32_t value) {
+  _internal_set_total_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceResponse.total_count)
+}
+
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetPerformanceResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetPerformanceResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetPerformanceResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetPerformanceResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetPerformanceResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetPerformanceResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetPerformanceResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetPerformanceResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPerformanceResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetPerformanceResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetPerformanceResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetPerformanceResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetPerformanceResponse.next_cursor)
+  return _msg;
+}
+inline void GetPerformanceResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetPerformanceResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetPerformanceResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetPerformanceResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetPerformanceResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetPerformanceResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetPerformanceResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetPerformanceResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetPerformanceResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetPerformanceResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetPerformanceResponse.received_until)
+}
+
+// -------------------------------------------------------------------
+
+// ErrorEvent
+
+// string id = 1;
+inline void ErrorEvent::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& ErrorEvent::id() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ErrorEvent::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.id)
+}
+inline std::string* ErrorEvent::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.ErrorEvent.id)
+  return _s;
+}
+inline const std::string& ErrorEvent::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void ErrorEvent::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::release_id() {
+  // @@protoc_insertion_point(field_release:metricsys.ErrorEvent.id)
+  return _impl_.id_.Release();
+}
+inline void ErrorEvent::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ErrorEvent.id)
+}
+
+// string page = 2;
+inline void ErrorEvent::clear_page() {
+  _impl_.page_.ClearToEmpty();
+}
+inline const std::string& ErrorEvent::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.page)
+  return _internal_page();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ErrorEvent::set_page(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.page)
+}
+inline std::string* ErrorEvent::mutable_page() {
+  std::string* _s = _internal_mutable_page();
+  // @@protoc_insertion_point(field_mutable:metricsys.ErrorEvent.page)
+  return _s;
+}
+inline const std::string& ErrorEvent::_internal_page() const {
+  return _impl_.page_.Get();
+}
+inline void ErrorEvent::_internal_set_page(const std::string& value) {
+  
+  _impl_.page_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::_internal_mutable_page() {
+  
+  return _impl_.page_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.ErrorEvent.page)
+  return _impl_.page_.Release();
+}
+inline void ErrorEvent::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ErrorEvent.page)
+}
+
+// string error_type = 3;
+inline void ErrorEvent::clear_error_type() {
+  _impl_.error_type_.ClearToEmpty();
+}
+inline const std::string& ErrorEvent::error_type() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.error_type)
+  return _internal_error_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ErrorEvent::set_error_type(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.error_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.error_type)
+}
+inline std::string* ErrorEvent::mutable_error_type() {
+  std::string* _s = _internal_mutable_error_type();
+  // @@protoc_insertion_point(field_mutable:metricsys.ErrorEvent.error_type)
+  return _s;
+}
+inline const std::string& ErrorEvent::_internal_error_type() const {
+  return _impl_.error_type_.Get();
+}
+inline void ErrorEvent::_internal_set_error_type(const std::string& value) {
+  
+  _impl_.error_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::_internal_mutable_error_type() {
+  
+  return _impl_.error_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::release_error_type() {
+  // @@protoc_insertion_point(field_release:metricsys.ErrorEvent.error_type)
+  return _impl_.error_type_.Release();
+}
+inline void ErrorEvent::set_allocated_error_type(std::string* error_type) {
+  if (error_type != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.error_type_.SetAllocated(error_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_type_.IsDefault()) {
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ErrorEvent.error_type)
+}
+
+// string message = 4;
+inline void ErrorEvent::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& ErrorEvent::message() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ErrorEvent::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.message)
+}
+inline std::string* ErrorEvent::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:metricsys.ErrorEvent.message)
+  return _s;
+}
+inline const std::string& ErrorEvent::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void ErrorEvent::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::release_message() {
+  // @@protoc_insertion_point(field_release:metricsys.ErrorEvent.message)
+  return _impl_.message_.Release();
+}
+inline void ErrorEvent::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ErrorEvent.message)
+}
+
+// optional string stack = 5;
+inline bool ErrorEvent::_internal_has_stack() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ErrorEvent::has_stack() const {
+  return _internal_has_stack();
+}
+inline void ErrorEvent::clear_stack() {
+  _impl_.stack_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ErrorEvent::stack() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.stack)
+  return _internal_stack();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ErrorEvent::set_stack(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.stack_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.stack)
+}
+inline std::string* ErrorEvent::mutable_stack() {
+  std::string* _s = _internal_mutable_stack();
+  // @@protoc_insertion_point(field_mutable:metricsys.ErrorEvent.stack)
+  return _s;
+}
+inline const std::string& ErrorEvent::_internal_stack() const {
+  return _impl_.stack_.Get();
+}
+inline void ErrorEvent::_internal_set_stack(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.stack_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::_internal_mutable_stack() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.stack_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::release_stack() {
+  // @@protoc_insertion_point(field_release:metricsys.ErrorEvent.stack)
+  if (!_internal_has_stack()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.stack_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stack_.IsDefault()) {
+    _impl_.stack_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ErrorEvent::set_allocated_stack(std::string* stack) {
+  if (stack != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.stack_.SetAllocated(stack, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stack_.IsDefault()) {
+    _impl_.stack_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ErrorEvent.stack)
+}
+
+// .metricsys.Severity severity = 6;
+inline void ErrorEvent::clear_severity() {
+  _impl_.severity_ = 0;
+}
+inline ::metricsys::Severity ErrorEvent::_internal_severity() const {
+  return static_cast< ::metricsys::Severity >(_impl_.severity_);
+}
+inline ::metricsys::Severity ErrorEvent::severity() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.severity)
+  return _internal_severity();
+}
+inline void ErrorEvent::_internal_set_severity(::metricsys::Severity value) {
+  
+  _impl_.severity_ = value;
+}
+inline void ErrorEvent::set_severity(::metricsys::Severity value) {
+  _internal_set_severity(value);
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.severity)
+}
+
+// optional string user_id = 7;
+inline bool ErrorEvent::_internal_has_user_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ErrorEvent::has_user_id() const {
+  return _internal_has_user_id();
+}
+inline void ErrorEvent::clear_user_id() {
+  _impl_.user_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& ErrorEvent::user_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.user_id)
+  return _internal_user_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ErrorEvent::set_user_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.user_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.user_id)
+}
+inline std::string* ErrorEvent::mutable_user_id() {
+  std::string* _s = _internal_mutable_user_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.ErrorEvent.user_id)
+  return _s;
+}
+inline const std::string& ErrorEvent::_internal_user_id() const {
+  return _impl_.user_id_.Get();
+}
+inline void ErrorEvent::_internal_set_user_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.user_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::_internal_mutable_user_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.user_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::release_user_id() {
+  // @@protoc_insertion_point(field_release:metricsys.ErrorEvent.user_id)
+  if (!_internal_has_user_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.user_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ErrorEvent::set_allocated_user_id(std::string* user_id) {
+  if (user_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.user_id_.SetAllocated(user_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ErrorEvent.user_id)
+}
+
+// optional string session_id = 8;
+inline bool ErrorEvent::_internal_has_session_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ErrorEvent::has_session_id() const {
+  return _internal_has_session_id();
+}
+inline void ErrorEvent::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& ErrorEvent::session_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ErrorEvent::set_session_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.session_id)
+}
+inline std::string* ErrorEvent::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.ErrorEvent.session_id)
+  return _s;
+}
+inline const std::string& ErrorEvent::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void ErrorEvent::_internal_set_session_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::_internal_mutable_session_id() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ErrorEvent::release_session_id() {
+  // @@protoc_insertion_point(field_release:metricsys.ErrorEvent.session_id)
+  if (!_internal_has_session_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.session_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ErrorEvent::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.ErrorEvent.session_id)
+}
+
+// int64 timestamp = 9;
+inline void ErrorEvent::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t ErrorEvent::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t ErrorEvent::timestamp() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.timestamp)
+  return _internal_timestamp();
+}
+inline void ErrorEvent::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void ErrorEvent::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.timestamp)
+}
+
+// int64 received_at = 10;
+inline void ErrorEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t ErrorEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t ErrorEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.ErrorEvent.received_at)
+  return _internal_received_at();
+}
+inline void ErrorEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void ErrorEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.ErrorEvent.received_at)
+}
+
+// -------------------------------------------------------------------
+
+// GetErrorsRequest
+
+// optional .metricsys.TimeRange time_range = 1;
+inline bool GetErrorsRequest::_internal_has_time_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.time_range_ != nullptr);
+  return value;
+}
+inline bool GetErrorsRequest::has_time_range() const {
+  return _internal_has_time_range();
+}
+inline void GetErrorsRequest::clear_time_range() {
+  if (_impl_.time_range_ != nullptr) _impl_.time_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::metricsys::TimeRange& GetErrorsRequest::_internal_time_range() const {
+  const ::metricsys::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetErrorsRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetErrorsRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::TimeRange* time_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
+  }
+  _impl_.time_range_ = time_range;
+  if (time_range) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetErrorsRequest.time_range)
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::release_time_range() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.time_range)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::_internal_mutable_time_range() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
+  }
+  return _impl_.time_range_;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::mutable_time_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.time_range)
+  return _msg;
+}
+inline void GetErrorsRequest::set_allocated_time_range(::metricsys::TimeRange* time_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.time_range_;
+  }
+  if (time_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
+    if (message_arena != submessage_arena) {
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.time_range)
+}
+
+// optional .metricsys.Pagination pagination = 2;
+inline bool GetErrorsRequest::_internal_has_pagination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pagination_ != nullptr);
+  return value;
+}
+inline bool GetErrorsRequest::has_pagination() const {
+  return _internal_has_pagination();
+}
+inline void GetErrorsRequest::clear_pagination() {
+  if (_impl_.pagination_ != nullptr) _impl_.pagination_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::metricsys::Pagination& GetErrorsRequest::_internal_pagination() const {
+  const ::metricsys::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::Pagination&>(
+      ::metricsys::_Pagination_default_instance_);
+}
+inline const ::metricsys::Pagination& GetErrorsRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.pagination)
+  return _internal_pagination();
+}
+inline void GetErrorsRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::Pagination* pagination) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+  }
+  _impl_.pagination_ = pagination;
+  if (pagination) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetErrorsRequest.pagination)
+}
+inline ::metricsys::Pagination* GetErrorsRequest::release_pagination() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::Pagination* GetErrorsRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.pagination)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+  return temp;
+}
+inline ::metricsys::Pagination* GetErrorsRequest::_internal_mutable_pagination() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
+  }
+  return _impl_.pagination_;
+}
+inline ::metricsys::Pagination* GetErrorsRequest::mutable_pagination() {
+  ::metricsys::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.pagination)
+  return _msg;
+}
+inline void GetErrorsRequest::set_allocated_pagination(::metricsys::Pagination* pagination) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pagination_;
+  }
+  if (pagination) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+    if (message_arena != submessage_arena) {
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.pagination)
+}
+
+// optional string page_filter = 3;
+inline bool GetErrorsRequest::_internal_has_page_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetErrorsRequest::has_page_filter() const {
+  return _internal_has_page_filter();
+}
+inline void GetErrorsRequest::clear_page_filter() {
+  _impl_.page_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GetErrorsRequest::page_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.page_filter)
+  return _internal_page_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetErrorsRequest::set_page_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.page_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsRequest.page_filter)
+}
+inline std::string* GetErrorsRequest::mutable_page_filter() {
+  std::string* _s = _internal_mutable_page_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.page_filter)
+  return _s;
+}
+inline const std::string& GetErrorsRequest::_internal_page_filter() const {
+  return _impl_.page_filter_.Get();
+}
+inline void GetErrorsRequest::_internal_set_page_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.page_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetErrorsRequest::_internal_mutable_page_filter() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.page_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetErrorsRequest::release_page_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.page_filter)
+  if (!_internal_has_page_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetErrorsRequest::set_allocated_page_filter(std::string* page_filter) {
+  if (page_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.page_filter_.SetAllocated(page_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.page_filter)
+}
+
+// optional .metricsys.Severity severity_filter = 4;
+inline bool GetErrorsRequest::_internal_has_severity_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool GetErrorsRequest::has_severity_filter() const {
+  return _internal_has_severity_filter();
+}
+inline void GetErrorsRequest::clear_severity_filter() {
+  _impl_.severity_filter_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline ::metricsys::Severity GetErrorsRequest::_internal_severity_filter() const {
+  return static_cast< ::metricsys::Severity >(_impl_.severity_filter_);
+}
+inline ::metricsys::Severity GetErrorsRequest::severity_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.severity_filter)
+  return _internal_severity_filter();
+}
+inline void GetErrorsRequest::_internal_set_severity_filter(::metricsys::Severity value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.severity_filter_ = value;
+}
+inline void GetErrorsRequest::set_severity_filter(::metricsys::Severity value) {
+  _internal_set_severity_filter(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsRequest.severity_filter)
+}
+
+// optional string error_type_filter = 5;
+inline bool GetErrorsRequest::_internal_has_error_type_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetErrorsRequest::has_error_type_filter() const {
+  return _internal_has_error_type_filter();
+}
+inline void GetErrorsRequest::clear_error_type_filter() {
+  _impl_.error_type_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetErrorsRequest::error_type_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.error_type_filter)
+  return _internal_error_type_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetErrorsRequest::set_error_type_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.error_type_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsRequest.error_type_filter)
+}
+inline std::string* GetErrorsRequest::mutable_error_type_filter() {
+  std::string* _s = _internal_mutable_error_type_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.error_type_filter)
+  return _s;
+}
+inline const std::string& GetErrorsRequest::_internal_error_type_filter() const {
+  return _impl_.error_type_filter_.Get();
+}
+inline void GetErrorsRequest::_internal_set_error_type_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.error_type_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetErrorsRequest::_internal_mutable_error_type_filter() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.error_type_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetErrorsRequest::release_error_type_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.error_type_filter)
+  if (!_internal_has_error_type_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.error_type_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_type_filter_.IsDefault()) {
+    _impl_.error_type_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetErrorsRequest::set_allocated_error_type_filter(std::string* error_type_filter) {
+  if (error_type_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.error_type_filter_.SetAllocated(error_type_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_type_filter_.IsDefault()) {
+    _impl_.error_type_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.error_type_filter)
+}
+
+// optional string user_id_filter = 6;
+inline bool GetErrorsRequest::_internal_has_user_id_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GetErrorsRequest::has_user_id_filter() const {
+  return _internal_has_user_id_filter();
+}
+inline void GetErrorsRequest::clear_user_id_filter() {
+  _impl_.user_id_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& GetErrorsRequest::user_id_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.user_id_filter)
+  return _internal_user_id_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetErrorsRequest::set_user_id_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.user_id_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsRequest.user_id_filter)
+}
+inline std::string* GetErrorsRequest::mutable_user_id_filter() {
+  std::string* _s = _internal_mutable_user_id_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.user_id_filter)
+  return _s;
+}
+inline const std::string& GetErrorsRequest::_internal_user_id_filter() const {
+  return _impl_.user_id_filter_.Get();
+}
+inline void GetErrorsRequest::_internal_set_user_id_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetErrorsRequest::_internal_mutable_user_id_filter() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetErrorsRequest::release_user_id_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.user_id_filter)
+  if (!_internal_has_user_id_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.user_id_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetErrorsRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
+  if (user_id_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.user_id_filter)
+}
+
+// optional .metricsys.EventCursor after = 7;
+inline bool GetErrorsRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetErrorsRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetErrorsRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::EventCursor& GetErrorsRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetErrorsRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.after)
+  return _internal_after();
+}
+inline void GetErrorsRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetErrorsRequest.after)
+}
+inline ::metricsys::EventCursor* GetErrorsRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetErrorsRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetErrorsRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetErrorsRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.after)
+  return _msg;
+}
+inline void GetErrorsRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 8;
+inline bool GetErrorsRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetErrorsRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetErrorsRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::metricsys::TimeRange& GetErrorsRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetErrorsRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetErrorsRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetErrorsRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetErrorsRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsRequest.received_range)
+  return _msg;
+}
+inline void GetErrorsRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsRequest.received_range)
+}
+
+// bool allow_segments = 9;
+inline void GetErrorsRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
+}
+inline bool GetErrorsRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
+}
+inline bool GetErrorsRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsRequest.allow_segments)
+  return _internal_allow_segments();
+}
+inline void GetErrorsRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
+}
+inline void GetErrorsRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsRequest.allow_segments)
+}
+
+// -------------------------------------------------------------------
+
+// GetErrorsResponse
+
+// repeated .metricsys.ErrorEvent events = 1;
+inline int GetErrorsResponse::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int GetErrorsResponse::events_size() const {
+  return _internal_events_size();
+}
+inline void GetErrorsResponse::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::metricsys::ErrorEvent* GetErrorsResponse::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsResponse.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ErrorEvent >*
+GetErrorsResponse::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.GetErrorsResponse.events)
+  return &_impl_.events_;
+}
+inline const ::metricsys::ErrorEvent& GetErrorsResponse::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::metricsys::ErrorEvent& GetErrorsResponse::events(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsResponse.events)
+  return _internal_events(index);
+}
+inline ::metricsys::ErrorEvent* GetErrorsResponse::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::metricsys::ErrorEvent* GetErrorsResponse::add_events() {
+  ::metricsys::ErrorEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:metricsys.GetErrorsResponse.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::ErrorEvent >&
+GetErrorsResponse::events() const {
+  // @@protoc_insertion_point(field_list:metricsys.GetErrorsResponse.events)
+  return _impl_.events_;
+}
+
+// int32 total_count = 2;
+inline void GetErrorsResponse::clear_total_count() {
+  _impl_.total_count_ = 0;
+}
+inline int32_t GetErrorsResponse::_internal_total_count() const {
+  return _impl_.total_count_;
+}
+inline int32_t GetErrorsResponse::total_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsResponse.total_count)
+  return _internal_total_count();
+}
+inline void GetErrorsResponse::_internal_set_total_count(int32_t value) {
+  
+  _impl_.total_count_ = value;
+}
+inline void GetErrorsResponse::set_total_count(int32_t value) {
+  _internal_set_total_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsResponse.total_count)
+}
+
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetErrorsResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetErrorsResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetErrorsResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetErrorsResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetErrorsResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetErrorsResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetErrorsResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetErrorsResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetErrorsResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetErrorsResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetErrorsResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetErrorsResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetErrorsResponse.next_cursor)
+  return _msg;
+}
+inline void GetErrorsResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetErrorsResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetErrorsResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetErrorsResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetErrorsResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetErrorsResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetErrorsResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetErrorsResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetErrorsResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetErrorsResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetErrorsResponse.received_until)
+}
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// CustomEvent
+
+// string id = 1;
+inline void CustomEvent::clear_id() {
+  _impl_.id_.ClearToEmpty();
+}
+inline const std::string& CustomEvent::id() const {
+  // @@protoc_insertion_point(field_get:metricsys.CustomEvent.id)
+  return _internal_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CustomEvent::set_id(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.CustomEvent.id)
+}
+inline std::string* CustomEvent::mutable_id() {
+  std::string* _s = _internal_mutable_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.CustomEvent.id)
+  return _s;
+}
+inline const std::string& CustomEvent::_internal_id() const {
+  return _impl_.id_.Get();
+}
+inline void CustomEvent::_internal_set_id(const std::string& value) {
+  
+  _impl_.id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CustomEvent::_internal_mutable_id() {
+  
+  return _impl_.id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CustomEvent::release_id() {
+  // @@protoc_insertion_point(field_release:metricsys.CustomEvent.id)
+  return _impl_.id_.Release();
+}
+inline void CustomEvent::set_allocated_id(std::string* id) {
+  if (id != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.id_.SetAllocated(id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.id_.IsDefault()) {
+    _impl_.id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.CustomEvent.id)
+}
+
+// string name = 2;
+inline void CustomEvent::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& CustomEvent::name() const {
+  // @@protoc_insertion_point(field_get:metricsys.CustomEvent.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CustomEvent::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.CustomEvent.name)
+}
+inline std::string* CustomEvent::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:metricsys.CustomEvent.name)
+  return _s;
+}
+inline const std::string& CustomEvent::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void CustomEvent::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CustomEvent::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CustomEvent::release_name() {
+  // @@protoc_insertion_point(field_release:metricsys.CustomEvent.name)
+  return _impl_.name_.Release();
+}
+inline void CustomEvent::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.CustomEvent.name)
+}
+
+// optional string page = 3;
+inline bool CustomEvent::_internal_has_page() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool CustomEvent::has_page() const {
+  return _internal_has_page();
+}
+inline void CustomEvent::clear_page() {
+  _impl_.page_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& CustomEvent::page() const {
+  // @@protoc_insertion_point(field_get:metricsys.CustomEvent.page)
+  return _internal_page();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CustomEvent::set_page(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.page_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.CustomEvent.page)
+}
+inline std::string* CustomEvent::mutable_page() {
+  std::string* _s = _internal_mutable_page();
+  // @@protoc_insertion_point(field_mutable:metricsys.CustomEvent.page)
+  return _s;
+}
+inline const std::string& CustomEvent::_internal_page() const {
+  return _impl_.page_.Get();
+}
+inline void CustomEvent::_internal_set_page(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.page_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CustomEvent::_internal_mutable_page() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.page_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CustomEvent::release_page() {
+  // @@protoc_insertion_point(field_release:metricsys.CustomEvent.page)
+  if (!_internal_has_page()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.page_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CustomEvent::set_allocated_page(std::string* page) {
+  if (page != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.page_.SetAllocated(page, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_.IsDefault()) {
+    _impl_.page_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.CustomEvent.page)
+}
+
+// optional string user_id = 4;
+inline bool CustomEvent::_internal_has_user_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool CustomEvent::has_user_id() const {
+  return _internal_has_user_id();
+}
+inline void CustomEvent::clear_user_id() {
+  _impl_.user_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& CustomEvent::user_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.CustomEvent.user_id)
+  return _internal_user_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CustomEvent::set_user_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.user_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.CustomEvent.user_id)
+}
+inline std::string* CustomEvent::mutable_user_id() {
+  std::string* _s = _internal_mutable_user_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.CustomEvent.user_id)
+  return _s;
+}
+inline const std::string& CustomEvent::_internal_user_id() const {
+  return _impl_.user_id_.Get();
+}
+inline void CustomEvent::_internal_set_user_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.user_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CustomEvent::_internal_mutable_user_id() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.user_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CustomEvent::release_user_id() {
+  // @@protoc_insertion_point(field_release:metricsys.CustomEvent.user_id)
+  if (!_internal_has_user_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.user_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CustomEvent::set_allocated_user_id(std::string* user_id) {
+  if (user_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.user_id_.SetAllocated(user_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_.IsDefault()) {
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.CustomEvent.user_id)
+}
+
+// optional string session_id = 5;
+inline bool CustomEvent::_internal_has_session_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool CustomEvent::has_session_id() const {
+  return _internal_has_session_id();
+}
+inline void CustomEvent::clear_session_id() {
+  _impl_.session_id_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& CustomEvent::session_id() const {
+  // @@protoc_insertion_point(field_get:metricsys.CustomEvent.session_id)
+  return _internal_session_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void CustomEvent::set_session_id(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.session_id_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.CustomEvent.session_id)
+}
+inline std::string* CustomEvent::mutable_session_id() {
+  std::string* _s = _internal_mutable_session_id();
+  // @@protoc_insertion_point(field_mutable:metricsys.CustomEvent.session_id)
+  return _s;
+}
+inline const std::string& CustomEvent::_internal_session_id() const {
+  return _impl_.session_id_.Get();
+}
+inline void CustomEvent::_internal_set_session_id(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.session_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* CustomEvent::_internal_mutable_session_id() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.session_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* CustomEvent::release_session_id() {
+  // @@protoc_insertion_point(field_release:metricsys.CustomEvent.session_id)
+  if (!_internal_has_session_id()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.session_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void CustomEvent::set_allocated_session_id(std::string* session_id) {
+  if (session_id != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.session_id_.SetAllocated(session_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.session_id_.IsDefault()) {
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.CustomEvent.session_id)
+}
+
+// map<string, string> properties = 6;
+inline int CustomEvent::_internal_properties_size() const {
+  return _impl_.properties_.size();
+}
+inline int CustomEvent::properties_size() const {
+  return _internal_properties_size();
+}
+inline void CustomEvent::clear_properties() {
+  _impl_.properties_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+CustomEvent::_internal_properties() const {
+  return _impl_.properties_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+CustomEvent::properties() const {
+  // @@protoc_insertion_point(field_map:metricsys.CustomEvent.properties)
+  return _internal_properties();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+CustomEvent::_internal_mutable_properties() {
+  return _impl_.properties_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+CustomEvent::mutable_properties() {
+  // @@protoc_insertion_point(field_mutable_map:metricsys.CustomEvent.properties)
+  return _internal_mutable_properties();
+}
+
+// int64 timestamp = 7;
+inline void CustomEvent::clear_timestamp() {
+  _impl_.timestamp_ = int64_t{0};
+}
+inline int64_t CustomEvent::_internal_timestamp() const {
+  return _impl_.timestamp_;
+}
+inline int64_t CustomEvent::timestamp() const {
+  // @@protoc_insertion_point(field_get:metricsys.CustomEvent.timestamp)
+  return _internal_timestamp();
+}
+inline void CustomEvent::_internal_set_timestamp(int64_t value) {
+  
+  _impl_.timestamp_ = value;
+}
+inline void CustomEvent::set_timestamp(int64_t value) {
+  _internal_set_timestamp(value);
+  // @@protoc_insertion_point(field_set:metricsys.CustomEvent.timestamp)
+}
+
+// int64 received_at = 8;
+inline void CustomEvent::clear_received_at() {
+  _impl_.received_at_ = int64_t{0};
+}
+inline int64_t CustomEvent::_internal_received_at() const {
+  return _impl_.received_at_;
+}
+inline int64_t CustomEvent::received_at() const {
+  // @@protoc_insertion_point(field_get:metricsys.CustomEvent.received_at)
+  return _internal_received_at();
+}
+inline void CustomEvent::_internal_set_received_at(int64_t value) {
+  
+  _impl_.received_at_ = value;
+}
+inline void CustomEvent::set_received_at(int64_t value) {
+  _internal_set_received_at(value);
+  // @@protoc_insertion_point(field_set:metricsys.CustomEvent.received_at)
+}
+
+// -------------------------------------------------------------------
+
+// GetCustomEventsRequest
+
+// optional .metricsys.TimeRange time_range = 1;
+inline bool GetCustomEventsRequest::_internal_has_time_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.time_range_ != nullptr);
+  return value;
+}
+inline bool GetCustomEventsRequest::has_time_range() const {
+  return _internal_has_time_range();
+}
+inline void GetCustomEventsRequest::clear_time_range() {
+  if (_impl_.time_range_ != nullptr) _impl_.time_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::metricsys::TimeRange& GetCustomEventsRequest::_internal_time_range() const {
+  const ::metricsys::TimeRange* p = _impl_.time_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetCustomEventsRequest::time_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.time_range)
+  return _internal_time_range();
+}
+inline void GetCustomEventsRequest::unsafe_arena_set_allocated_time_range(
+    ::metricsys::TimeRange* time_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.time_range_);
+  }
+  _impl_.time_range_ = time_range;
+  if (time_range) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetCustomEventsRequest.time_range)
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::release_time_range() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::unsafe_arena_release_time_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.time_range)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::metricsys::TimeRange* temp = _impl_.time_range_;
+  _impl_.time_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::_internal_mutable_time_range() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.time_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.time_range_ = p;
+  }
+  return _impl_.time_range_;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::mutable_time_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_time_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.time_range)
+  return _msg;
+}
+inline void GetCustomEventsRequest::set_allocated_time_range(::metricsys::TimeRange* time_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.time_range_;
+  }
+  if (time_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(time_range);
+    if (message_arena != submessage_arena) {
+      time_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, time_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.time_range_ = time_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.time_range)
+}
+
+// optional .metricsys.Pagination pagination = 2;
+inline bool GetCustomEventsRequest::_internal_has_pagination() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.pagination_ != nullptr);
+  return value;
+}
+inline bool GetCustomEventsRequest::has_pagination() const {
+  return _internal_has_pagination();
+}
+inline void GetCustomEventsRequest::clear_pagination() {
+  if (_impl_.pagination_ != nullptr) _impl_.pagination_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::metricsys::Pagination& GetCustomEventsRequest::_internal_pagination() const {
+  const ::metricsys::Pagination* p = _impl_.pagination_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::Pagination&>(
+      ::metricsys::_Pagination_default_instance_);
+}
+inline const ::metricsys::Pagination& GetCustomEventsRequest::pagination() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.pagination)
+  return _internal_pagination();
+}
+inline void GetCustomEventsRequest::unsafe_arena_set_allocated_pagination(
+    ::metricsys::Pagination* pagination) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pagination_);
+  }
+  _impl_.pagination_ = pagination;
+  if (pagination) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetCustomEventsRequest.pagination)
+}
+inline ::metricsys::Pagination* GetCustomEventsRequest::release_pagination() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::Pagination* GetCustomEventsRequest::unsafe_arena_release_pagination() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.pagination)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::metricsys::Pagination* temp = _impl_.pagination_;
+  _impl_.pagination_ = nullptr;
+  return temp;
+}
+inline ::metricsys::Pagination* GetCustomEventsRequest::_internal_mutable_pagination() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.pagination_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::Pagination>(GetArenaForAllocation());
+    _impl_.pagination_ = p;
+  }
+  return _impl_.pagination_;
+}
+inline ::metricsys::Pagination* GetCustomEventsRequest::mutable_pagination() {
+  ::metricsys::Pagination* _msg = _internal_mutable_pagination();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.pagination)
+  return _msg;
+}
+inline void GetCustomEventsRequest::set_allocated_pagination(::metricsys::Pagination* pagination) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pagination_;
+  }
+  if (pagination) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pagination);
+    if (message_arena != submessage_arena) {
+      pagination = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pagination, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.pagination_ = pagination;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.pagination)
+}
+
+// optional string name_filter = 3;
+inline bool GetCustomEventsRequest::_internal_has_name_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool GetCustomEventsRequest::has_name_filter() const {
+  return _internal_has_name_filter();
+}
+inline void GetCustomEventsRequest::clear_name_filter() {
+  _impl_.name_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& GetCustomEventsRequest::name_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.name_filter)
+  return _internal_name_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCustomEventsRequest::set_name_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.name_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsRequest.name_filter)
+}
+inline std::string* GetCustomEventsRequest::mutable_name_filter() {
+  std::string* _s = _internal_mutable_name_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.name_filter)
+  return _s;
+}
+inline const std::string& GetCustomEventsRequest::_internal_name_filter() const {
+  return _impl_.name_filter_.Get();
+}
+inline void GetCustomEventsRequest::_internal_set_name_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.name_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetCustomEventsRequest::_internal_mutable_name_filter() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.name_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetCustomEventsRequest::release_name_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.name_filter)
+  if (!_internal_has_name_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.name_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_filter_.IsDefault()) {
+    _impl_.name_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetCustomEventsRequest::set_allocated_name_filter(std::string* name_filter) {
+  if (name_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.name_filter_.SetAllocated(name_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_filter_.IsDefault()) {
+    _impl_.name_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.name_filter)
+}
+
+// optional string page_filter = 4;
+inline bool GetCustomEventsRequest::_internal_has_page_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetCustomEventsRequest::has_page_filter() const {
+  return _internal_has_page_filter();
+}
+inline void GetCustomEventsRequest::clear_page_filter() {
+  _impl_.page_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& GetCustomEventsRequest::page_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.page_filter)
+  return _internal_page_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCustomEventsRequest::set_page_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.page_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsRequest.page_filter)
+}
+inline std::string* GetCustomEventsRequest::mutable_page_filter() {
+  std::string* _s = _internal_mutable_page_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.page_filter)
+  return _s;
+}
+inline const std::string& GetCustomEventsRequest::_internal_page_filter() const {
+  return _impl_.page_filter_.Get();
+}
+inline void GetCustomEventsRequest::_internal_set_page_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.page_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetCustomEventsRequest::_internal_mutable_page_filter() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.page_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetCustomEventsRequest::release_page_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.page_filter)
+  if (!_internal_has_page_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.page_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetCustomEventsRequest::set_allocated_page_filter(std::string* page_filter) {
+  if (page_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.page_filter_.SetAllocated(page_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.page_filter_.IsDefault()) {
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.page_filter)
+}
+
+// optional string user_id_filter = 5;
+inline bool GetCustomEventsRequest::_internal_has_user_id_filter() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool GetCustomEventsRequest::has_user_id_filter() const {
+  return _internal_has_user_id_filter();
+}
+inline void GetCustomEventsRequest::clear_user_id_filter() {
+  _impl_.user_id_filter_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& GetCustomEventsRequest::user_id_filter() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.user_id_filter)
+  return _internal_user_id_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GetCustomEventsRequest::set_user_id_filter(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.user_id_filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsRequest.user_id_filter)
+}
+inline std::string* GetCustomEventsRequest::mutable_user_id_filter() {
+  std::string* _s = _internal_mutable_user_id_filter();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.user_id_filter)
+  return _s;
+}
+inline const std::string& GetCustomEventsRequest::_internal_user_id_filter() const {
+  return _impl_.user_id_filter_.Get();
+}
+inline void GetCustomEventsRequest::_internal_set_user_id_filter(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.user_id_filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GetCustomEventsRequest::_internal_mutable_user_id_filter() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.user_id_filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GetCustomEventsRequest::release_user_id_filter() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.user_id_filter)
+  if (!_internal_has_user_id_filter()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.user_id_filter_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void GetCustomEventsRequest::set_allocated_user_id_filter(std::string* user_id_filter) {
+  if (user_id_filter != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.user_id_filter_.SetAllocated(user_id_filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.user_id_filter_.IsDefault()) {
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.user_id_filter)
+}
+
+// optional .metricsys.EventCursor after = 6;
+inline bool GetCustomEventsRequest::_internal_has_after() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.after_ != nullptr);
+  return value;
+}
+inline bool GetCustomEventsRequest::has_after() const {
+  return _internal_has_after();
+}
+inline void GetCustomEventsRequest::clear_after() {
+  if (_impl_.after_ != nullptr) _impl_.after_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::metricsys::EventCursor& GetCustomEventsRequest::_internal_after() const {
+  const ::metricsys::EventCursor* p = _impl_.after_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetCustomEventsRequest::after() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.after)
+  return _internal_after();
+}
+inline void GetCustomEventsRequest::unsafe_arena_set_allocated_after(
+    ::metricsys::EventCursor* after) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.after_);
+  }
+  _impl_.after_ = after;
+  if (after) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetCustomEventsRequest.after)
+}
+inline ::metricsys::EventCursor* GetCustomEventsRequest::release_after() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetCustomEventsRequest::unsafe_arena_release_after() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.after)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::metricsys::EventCursor* temp = _impl_.after_;
+  _impl_.after_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetCustomEventsRequest::_internal_mutable_after() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.after_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.after_ = p;
+  }
+  return _impl_.after_;
+}
+inline ::metricsys::EventCursor* GetCustomEventsRequest::mutable_after() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_after();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.after)
+  return _msg;
+}
+inline void GetCustomEventsRequest::set_allocated_after(::metricsys::EventCursor* after) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.after_;
+  }
+  if (after) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(after);
+    if (message_arena != submessage_arena) {
+      after = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, after, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.after_ = after;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.after)
+}
+
+// optional .metricsys.TimeRange received_range = 7;
+inline bool GetCustomEventsRequest::_internal_has_received_range() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.received_range_ != nullptr);
+  return value;
+}
+inline bool GetCustomEventsRequest::has_received_range() const {
+  return _internal_has_received_range();
+}
+inline void GetCustomEventsRequest::clear_received_range() {
+  if (_impl_.received_range_ != nullptr) _impl_.received_range_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::metricsys::TimeRange& GetCustomEventsRequest::_internal_received_range() const {
+  const ::metricsys::TimeRange* p = _impl_.received_range_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::TimeRange&>(
+      ::metricsys::_TimeRange_default_instance_);
+}
+inline const ::metricsys::TimeRange& GetCustomEventsRequest::received_range() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.received_range)
+  return _internal_received_range();
+}
+inline void GetCustomEventsRequest::unsafe_arena_set_allocated_received_range(
+    ::metricsys::TimeRange* received_range) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.received_range_);
+  }
+  _impl_.received_range_ = received_range;
+  if (received_range) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetCustomEventsRequest.received_range)
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::release_received_range() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::unsafe_arena_release_received_range() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsRequest.received_range)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::metricsys::TimeRange* temp = _impl_.received_range_;
+  _impl_.received_range_ = nullptr;
+  return temp;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::_internal_mutable_received_range() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.received_range_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::TimeRange>(GetArenaForAllocation());
+    _impl_.received_range_ = p;
+  }
+  return _impl_.received_range_;
+}
+inline ::metricsys::TimeRange* GetCustomEventsRequest::mutable_received_range() {
+  ::metricsys::TimeRange* _msg = _internal_mutable_received_range();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsRequest.received_range)
+  return _msg;
+}
+inline void GetCustomEventsRequest::set_allocated_received_range(::metricsys::TimeRange* received_range) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.received_range_;
+  }
+  if (received_range) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(received_range);
+    if (message_arena != submessage_arena) {
+      received_range = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, received_range, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.received_range_ = received_range;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsRequest.received_range)
+}
+
+// bool allow_segments = 8;
+inline void GetCustomEventsRequest::clear_allow_segments() {
+  _impl_.allow_segments_ = false;
+}
+inline bool GetCustomEventsRequest::_internal_allow_segments() const {
+  return _impl_.allow_segments_;
+}
+inline bool GetCustomEventsRequest::allow_segments() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsRequest.allow_segments)
+  return _internal_allow_segments();
+}
+inline void GetCustomEventsRequest::_internal_set_allow_segments(bool value) {
+  
+  _impl_.allow_segments_ = value;
+}
+inline void GetCustomEventsRequest::set_allow_segments(bool value) {
+  _internal_set_allow_segments(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsRequest.allow_segments)
+}
+
+// -------------------------------------------------------------------
+
+// GetCustomEventsResponse
+
+// repeated .metricsys.CustomEvent events = 1;
+inline int GetCustomEventsResponse::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int GetCustomEventsResponse::events_size() const {
+  return _internal_events_size();
+}
+inline void GetCustomEventsResponse::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::metricsys::CustomEvent* GetCustomEventsResponse::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsResponse.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::CustomEvent >*
+GetCustomEventsResponse::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:metricsys.GetCustomEventsResponse.events)
+  return &_impl_.events_;
+}
+inline const ::metricsys::CustomEvent& GetCustomEventsResponse::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::metricsys::CustomEvent& GetCustomEventsResponse::events(int index) const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsResponse.events)
+  return _internal_events(index);
+}
+inline ::metricsys::CustomEvent* GetCustomEventsResponse::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::metricsys::CustomEvent* GetCustomEventsResponse::add_events() {
+  ::metricsys::CustomEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:metricsys.GetCustomEventsResponse.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::metricsys::CustomEvent >&
+GetCustomEventsResponse::events() const {
+  // @@protoc_insertion_point(field_list:metricsys.GetCustomEventsResponse.events)
+  return _impl_.events_;
+}
+
+// int32 total_count = 2;
+inline void GetCustomEventsResponse::clear_total_count() {
+  _impl_.total_count_ = 0;
+}
+inline int32_t GetCustomEventsResponse::_internal_total_count() const {
+  return _impl_.total_count_;
+}
+inline int32_t GetCustomEventsResponse::total_count() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsResponse.total_count)
+  return _internal_total_count();
+}
+inline void GetCustomEventsResponse::_internal_set_total_count(int32_t value) {
+  
+  _impl_.total_count_ = value;
+}
+inline void GetCustomEventsResponse::set_total_count(int32_t value) {
+  _internal_set_total_count(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsResponse.total_count)
+}
+
+// optional .metricsys.EventCursor next_cursor = 3;
+inline bool GetCustomEventsResponse::_internal_has_next_cursor() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.next_cursor_ != nullptr);
+  return value;
+}
+inline bool GetCustomEventsResponse::has_next_cursor() const {
+  return _internal_has_next_cursor();
+}
+inline void GetCustomEventsResponse::clear_next_cursor() {
+  if (_impl_.next_cursor_ != nullptr) _impl_.next_cursor_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::metricsys::EventCursor& GetCustomEventsResponse::_internal_next_cursor() const {
+  const ::metricsys::EventCursor* p = _impl_.next_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::metricsys::EventCursor&>(
+      ::metricsys::_EventCursor_default_instance_);
+}
+inline const ::metricsys::EventCursor& GetCustomEventsResponse::next_cursor() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsResponse.next_cursor)
+  return _internal_next_cursor();
+}
+inline void GetCustomEventsResponse::unsafe_arena_set_allocated_next_cursor(
+    ::metricsys::EventCursor* next_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.next_cursor_);
+  }
+  _impl_.next_cursor_ = next_cursor;
+  if (next_cursor) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:metricsys.GetCustomEventsResponse.next_cursor)
+}
+inline ::metricsys::EventCursor* GetCustomEventsResponse::release_next_cursor() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::metricsys::EventCursor* GetCustomEventsResponse::unsafe_arena_release_next_cursor() {
+  // @@protoc_insertion_point(field_release:metricsys.GetCustomEventsResponse.next_cursor)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::metricsys::EventCursor* temp = _impl_.next_cursor_;
+  _impl_.next_cursor_ = nullptr;
+  return temp;
+}
+inline ::metricsys::EventCursor* GetCustomEventsResponse::_internal_mutable_next_cursor() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.next_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::metricsys::EventCursor>(GetArenaForAllocation());
+    _impl_.next_cursor_ = p;
+  }
+  return _impl_.next_cursor_;
+}
+inline ::metricsys::EventCursor* GetCustomEventsResponse::mutable_next_cursor() {
+  ::metricsys::EventCursor* _msg = _internal_mutable_next_cursor();
+  // @@protoc_insertion_point(field_mutable:metricsys.GetCustomEventsResponse.next_cursor)
+  return _msg;
+}
+inline void GetCustomEventsResponse::set_allocated_next_cursor(::metricsys::EventCursor* next_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.next_cursor_;
+  }
+  if (next_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(next_cursor);
+    if (message_arena != submessage_arena) {
+      next_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, next_cursor, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.next_cursor_ = next_cursor;
+  // @@protoc_insertion_point(field_set_allocated:metricsys.GetCustomEventsResponse.next_cursor)
+}
+
+// optional int64 received_until = 4;
+inline bool GetCustomEventsResponse::_internal_has_received_until() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool GetCustomEventsResponse::has_received_until() const {
+  return _internal_has_received_until();
+}
+inline void GetCustomEventsResponse::clear_received_until() {
+  _impl_.received_until_ = int64_t{0};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int64_t GetCustomEventsResponse::_internal_received_until() const {
+  return _impl_.received_until_;
+}
+inline int64_t GetCustomEventsResponse::received_until() const {
+  // @@protoc_insertion_point(field_get:metricsys.GetCustomEventsResponse.received_until)
+  return _internal_received_until();
+}
+inline void GetCustomEventsResponse::_internal_set_received_until(int64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.received_until_ = value;
+}
+inline void GetCustomEventsResponse::set_received_until(int64_t value) {
+  _internal_set_received_until(value);
+  // @@protoc_insertion_point(field_set:metricsys.GetCustomEventsResponse.received_until)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace metricsys
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::metricsys::Severity> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::metricsys::Severity>() {
+  return ::metricsys::Severity_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_metrics_2eproto
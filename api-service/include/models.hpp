@@ -16,6 +16,7 @@ enum class ErrorCode {
     InvalidCustomEvent,
     InvalidBatch,
     ValidationError,
+    ServiceUnavailable,
     InternalError
 };
 
@@ -27,6 +28,7 @@ NLOHMANN_JSON_SERIALIZE_ENUM(ErrorCode,
                               {ErrorCode::InvalidCustomEvent, "INVALID_CUSTOM_EVENT"},
                               {ErrorCode::InvalidBatch, "INVALID_BATCH"},
                               {ErrorCode::ValidationError, "VALIDATION_ERROR"},
+                              {ErrorCode::ServiceUnavailable, "SERVICE_UNAVAILABLE"},
                               {ErrorCode::InternalError, "INTERNAL_ERROR"}})
 
 enum class Severity { Warning, Error, Critical };
@@ -152,6 +154,27 @@ struct CustomEvent {
 void to_json(nlohmann::json& j, const CustomEvent& e);
 void from_json(const nlohmann::json& j, CustomEvent& e);
 
+// ==================== Batch ====================
+
+// Status of one item of POST /events/batch: "accepted", "rejected" (validation)
+// or "failed" (could not be published)
+struct BatchItemResult {
+    size_t index = 0;
+    std::string status;
+    std::optional<ErrorResponse> error;
+};
+
+void to_json(nlohmann::json& j, const BatchItemResult& r);
+
+struct BatchResponse {
+    size_t accepted = 0;
+    size_t rejected = 0;
+    size_t failed = 0;
+    std::vector<BatchItemResult> results;
+};
+
+void to_json(nlohmann::json& j, const BatchResponse& r);
+
 // ==================== Aggregation Common ====================
 
 struct TimeRange {
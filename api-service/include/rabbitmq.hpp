@@ -1,32 +1,168 @@
 #pragma once
 
-#include <string>
-#include <mutex>
 #include <amqp.h>
 #include <amqp_tcp_socket.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
-class RabbitMQ {
+struct RabbitMQConfig {
+    std::string host = "localhost";
+    int port = 5672;
+    std::string username = "guest";
+    std::string password = "guest";
+    std::string vhost = "/";
+    std::vector<std::string> queues;
+    // Каждый I/O-поток держит своё соединение и канал
+    size_t io_threads = 1;
+    // Ёмкость очереди от обработчиков к одному I/O-потоку; при переполнении — 503
+    size_t queue_capacity = 8192;
+    // Сколько опубликованных, но ещё не подтверждённых брокером сообщений держит поток
+    size_t confirm_window = 1024;
+    // Столько раз сообщение переотправляется после basic.nack, затем отбрасывается
+    uint32_t max_attempts = 3;
+    // Сколько деструктор ждёт досылки очереди и подтверждений
+    std::chrono::milliseconds drain_timeout{5000};
+};
+
+RabbitMQConfig loadRabbitMQConfig();
+
+// ==================== Confirm Tracking ====================
+
+// Кодировка тела сообщения; передаётся получателю в свойстве content_type
+enum class PayloadFormat : uint8_t {
+    Json,
+    Protobuf
+};
+
+const char* contentType(PayloadFormat format);
+
+struct PublishMessage {
+    std::string routing_key;
+    std::string body;
+    PayloadFormat format = PayloadFormat::Json;
+    // Сколько раз сообщение уже уходило в брокер
+    uint32_t attempts = 0;
+    // Вызывается из I/O-потока после basic.ack. Не вызывается, если подтверждение
+    // не пришло до остановки
+    std::function<void()> on_confirm;
+    // Вызывается из I/O-потока вместо on_confirm, когда издатель отказался от сообщения
+    // после max_attempts nack
+    std::function<void(const PublishMessage&)> on_give_up;
+};
+
+PublishMessage makePublishMessage(std::string routing_key, std::string body,
+                                  PayloadFormat format = PayloadFormat::Json);
+
+// Опубликованные сообщения канала в режиме confirm.select по delivery tag.
+// Теги идут с 1 подряд в порядке публикации; ack/nack с multiple закрывают
+// все теги до указанного включительно.
+class ConfirmTracker {
 public:
-    RabbitMQ(const std::string& host, int port, const std::string& username,
-             const std::string& password, const std::string& vhost);
-    ~RabbitMQ();
+    // Возвращает delivery tag, который брокер назначит сообщению
+    uint64_t track(PublishMessage message);
+    // Вызывает on_confirm подтверждённых сообщений и возвращает их число
+    size_t ack(uint64_t tag, bool multiple);
+    // Возвращает отвергнутые брокером сообщения в порядке публикации
+    std::vector<PublishMessage> nack(uint64_t tag, bool multiple);
+    // Канал закрыт: всё неподтверждённое возвращается для повторной отправки,
+    // нумерация на новом канале снова начинается с 1
+    std::vector<PublishMessage> reset();
 
-    bool connect();
-    bool publish(const std::string& exchange, const std::string& routing_key, const std::string& message);
-    bool isConnected() const { return connected_; }
+    size_t size() const { return pending_.size(); }
+    bool empty() const { return pending_.empty(); }
 
 private:
-    // rabbitmq-c connection is not thread-safe, guard socket writes
-    std::mutex mutex_;
-    std::string host_;
-    int port_;
-    std::string username_;
-    std::string password_;
-    std::string vhost_;
-    
-    amqp_connection_state_t conn_ = nullptr;
-    amqp_socket_t* socket_ = nullptr;
-    bool connected_ = false;
-    
-    bool checkRpcReply(const char* context);
+    std::vector<PublishMessage> take(uint64_t tag, bool multiple);
+
+    uint64_t nextTag_ = 1;
+    std::map<uint64_t, PublishMessage> pending_;
+};
+
+// ==================== Publisher ====================
+
+enum class PublishStatus {
+    Queued,
+    // Очередь всех I/O-потоков заполнена — брокер не успевает или недоступен
+    QueueFull,
+    Stopped
+};
+
+struct PublisherStats {
+    uint64_t queued = 0;
+    uint64_t rejected = 0;
+    uint64_t published = 0;
+    uint64_t confirmed = 0;
+    uint64_t nacked = 0;
+    uint64_t republished = 0;
+    uint64_t dropped = 0;
+    uint64_t handed_off = 0;
+    uint64_t reconnects = 0;
+    size_t unconfirmed = 0;
+    size_t queue_depth = 0;
+    size_t queue_capacity = 0;
+    size_t connected_threads = 0;
+};
+
+// Асинхронный издатель: обработчики кладут сообщения в lock-free очередь и сразу
+// возвращаются, а I/O-потоки публикуют их на своих каналах с publisher confirms.
+// Сообщение считается доставленным только после basic.ack; после обрыва соединения
+// неподтверждённые сообщения отправляются заново (at-least-once).
+class RabbitMQPublisher {
+public:
+    // Принимает сообщение, которое издатель не доставил до остановки; false — не принято
+    using ShutdownSink = std::function<bool(const PublishMessage&)>;
+
+    explicit RabbitMQPublisher(RabbitMQConfig config);
+    ~RabbitMQPublisher();
+
+    RabbitMQPublisher(const RabbitMQPublisher&) = delete;
+    RabbitMQPublisher& operator=(const RabbitMQPublisher&) = delete;
+
+    // Не блокируется; Queued значит только «принято в очередь».
+    // message перемещается только при Queued — иначе его можно отправить другим путём
+    PublishStatus publish(PublishMessage&& message);
+
+    // Останавливает потоки, дав им до drain_timeout досылать очередь; повторный вызов ничего не делает.
+    // Очередь, повторы и неподтверждённое после этого уходят в sink, без него — считаются dropped
+    void stop();
+    void setShutdownSink(ShutdownSink sink);
+
+    // Хотя бы один I/O-поток держит открытый канал
+    bool connected() const;
+    PublisherStats stats() const;
+    // Prometheus text format, api_rabbitmq_*
+    std::string formatMetrics() const;
+
+private:
+    class IoThread;
+
+    struct Counters {
+        std::atomic<uint64_t> queued{0};
+        std::atomic<uint64_t> rejected{0};
+        std::atomic<uint64_t> published{0};
+        std::atomic<uint64_t> confirmed{0};
+        std::atomic<uint64_t> nacked{0};
+        std::atomic<uint64_t> republished{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> handed_off{0};
+        std::atomic<uint64_t> reconnects{0};
+    };
+
+    // Из I/O-потока при остановке
+    bool handOff(const PublishMessage& message);
+
+    RabbitMQConfig config_;
+    Counters counters_;
+    std::atomic<size_t> next_{0};
+    std::atomic<bool> stopping_{false};
+    std::mutex sinkMutex_;
+    ShutdownSink sink_;
+    std::vector<std::unique_ptr<IoThread>> threads_;
 };
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+// Готовый ответ агрегатного эндпоинта
+struct CachedResponse {
+    int status = 200;
+    std::string body;
+};
+
+// LRU-кеш ответов /aggregation/*: ключ — нормализованный запрос, значение — JSON.
+// Агрегаты меняются только со сдвигом watermark, поэтому кеш сбрасывается целиком,
+// когда watermark изменился (проверка не чаще checkInterval) или узнать его не удалось.
+// Одинаковые запросы, пришедшие во время промаха, ждут один вызов upstream (single-flight).
+class ResponseCache {
+public:
+    using Fetch = std::function<CachedResponse()>;
+    // Текущий watermark или nullopt, если aggregation-service недоступен
+    using WatermarkFetcher = std::function<std::optional<std::string>()>;
+
+    struct Config {
+        size_t maxBytes = 64u << 20;  // 0 — не хранить ответы (single-flight остаётся)
+        std::chrono::milliseconds checkInterval{1000};
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t coalesced = 0;  // промахи, дождавшиеся чужого вызова upstream
+        uint64_t invalidations = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+
+        // Доля запросов, обслуженных без своего вызова upstream
+        double hitRatio() const;
+    };
+
+    ResponseCache(Config config, WatermarkFetcher watermark);
+
+    // Сохраняются только ответы 200; исключение fetch получают все ожидающие
+    CachedResponse get(const std::string& key, const Fetch& fetch);
+
+    void clear();
+    Stats stats() const;
+    // Метрики в текстовом формате Prometheus (GET /metrics)
+    std::string formatMetrics() const;
+
+private:
+    struct Entry {
+        std::string key;
+        CachedResponse response;
+        size_t bytes = 0;
+    };
+
+    void checkWatermark();
+    // Вызываются под mutex_
+    void invalidate();
+    void insert(const std::string& key, const CachedResponse& response);
+
+    Config config_;
+    WatermarkFetcher watermark_;
+
+    std::mutex checkMutex_;  // watermark проверяет один поток, остальные не ждут
+    std::optional<std::chrono::steady_clock::time_point> lastCheck_;
+    std::optional<std::string> knownWatermark_;
+
+    mutable std::mutex mutex_;
+    std::list<Entry> lru_;  // в начале — недавно использованные
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    std::unordered_map<std::string, std::shared_future<CachedResponse>> inFlight_;
+    uint64_t generation_ = 0;  // растёт при сбросе: ответ, начатый до сброса, не сохраняется
+    bool watermarkKnown_ = false;  // пока watermark неизвестен, ответы не сохраняются
+    size_t bytes_ = 0;
+
+    Stats counters_;
+};
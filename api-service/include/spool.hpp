@@ -0,0 +1,151 @@
+#pragma once
+
+#include "rabbitmq.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <compare>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Журнал событий на локальном диске на время, пока RabbitMQ недоступен или очередь
+// издателя заполнена. Сегментированный append-only лог: файлы фиксированного размера
+// отображены в память, запись — копирование в mmap без системных вызовов.
+// Один потребитель (SpoolReplayer) читает записи по порядку. Запись уходит из журнала
+// только после подтверждения брокера (on_confirm записи, возвращённой peek); до первой
+// неподтверждённой записи сохраняется позиция в файл cursor и удаляются сегменты.
+// После рестарта чтение продолжается с неё (записи после последнего сохранения могут повториться).
+class Spool {
+public:
+    struct Config {
+        std::string dir;
+        size_t segmentBytes = 64u << 20;
+        // Лимит на все сегменты; когда он исчерпан, append отказывает
+        size_t maxBytes = 1u << 30;
+    };
+
+    struct Stats {
+        uint64_t appended = 0;
+        uint64_t replayed = 0;
+        uint64_t requeued = 0;  // отвергнуты брокером и дописаны в конец заново
+        uint64_t rejected = 0;  // не поместились в maxBytes
+        uint64_t pending = 0;
+        size_t segments = 0;
+        size_t bytes = 0;
+    };
+
+    // Создаёт каталог и восстанавливает сегменты прошлого запуска; std::runtime_error при ошибке
+    explicit Spool(Config config);
+    ~Spool();
+
+    Spool(const Spool&) = delete;
+    Spool& operator=(const Spool&) = delete;
+
+    // Потокобезопасно; false — лимит диска исчерпан или запись больше сегмента
+    bool append(const PublishMessage& message);
+
+    // Только из потока-потребителя: следующая запись без удаления из журнала.
+    // out.on_confirm подтверждает именно эту запись, out.on_give_up (брокер так и не принял)
+    // дописывает её в конец журнала; оба можно вызвать из любого потока
+    bool peek(PublishMessage& out);
+    // Переходит к записи после возвращённой peek (она передана издателю)
+    void pop();
+
+    bool empty() const { return pending_.load(std::memory_order_acquire) == 0; }
+    Stats stats() const;
+    // Метрики в текстовом формате Prometheus (GET /metrics)
+    std::string formatMetrics() const;
+
+private:
+    struct Segment;
+
+    // Сегмент и смещение сразу за записью
+    struct Position {
+        uint64_t seq = 0;
+        uint64_t offset = 0;
+        auto operator<=>(const Position&) const = default;
+    };
+
+    struct InFlight {
+        Position position;
+        bool confirmed = false;
+    };
+
+    // Подтверждения приходят из I/O-потоков издателя и могут пережить Spool
+    struct Anchor {
+        std::mutex mutex;
+        Spool* spool = nullptr;
+    };
+
+    std::shared_ptr<Segment> createSegment();
+    void recover();
+    // Дальше — под commitMutex_
+    void track(Position position, bool confirmed);
+    void confirm(Position position);
+    void advance();
+    void removeConfirmedSegments();
+    void saveCursor();
+    // Длина записи в offset или 0, если её там (ещё) нет
+    uint32_t recordLength(const Segment& segment, size_t offset) const;
+
+    Config config_;
+    std::string cursorPath_;
+
+    // Писатели: активный сегмент и смещение в нём
+    std::mutex writeMutex_;
+    std::shared_ptr<Segment> active_;
+    std::atomic<uint64_t> activeSeq_{0};
+    uint64_t nextSeq_ = 1;
+
+    // Все сегменты от старого к новому
+    mutable std::mutex segmentsMutex_;
+    std::deque<std::shared_ptr<Segment>> segments_;
+    size_t bytes_ = 0;
+
+    // Потребитель
+    std::shared_ptr<Segment> readSegment_;
+    uint64_t readSeq_ = 0;
+    size_t readOffset_ = 0;
+    uint32_t peekedLength_ = 0;
+
+    // Переданные издателю записи по порядку чтения и граница подтверждённого
+    std::shared_ptr<Anchor> anchor_;
+    std::mutex commitMutex_;
+    std::deque<InFlight> inFlight_;
+    Position committed_;
+    uint64_t sinceCursorSave_ = 0;
+
+    std::atomic<uint64_t> pending_{0};
+    std::atomic<uint64_t> appended_{0};
+    std::atomic<uint64_t> replayed_{0};
+    std::atomic<uint64_t> requeued_{0};
+    std::atomic<uint64_t> rejected_{0};
+};
+
+// Фоновый поток: переносит журнал в издателя по порядку, как только тот подключён
+// и в его очереди есть место; пока нет — ждёт с экспоненциальной задержкой
+class SpoolReplayer {
+public:
+    SpoolReplayer(Spool& spool, RabbitMQPublisher& publisher);
+    ~SpoolReplayer();
+
+    SpoolReplayer(const SpoolReplayer&) = delete;
+    SpoolReplayer& operator=(const SpoolReplayer&) = delete;
+
+private:
+    void run();
+    void sleepFor(std::chrono::milliseconds duration);
+
+    Spool& spool_;
+    RabbitMQPublisher& publisher_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+    std::thread thread_;
+};
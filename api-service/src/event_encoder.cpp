@@ -0,0 +1,107 @@
+#include "event_encoder.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string_view>
+
+PayloadFormat loadPayloadFormat() {
+    const char* value = std::getenv("API_PAYLOAD_FORMAT");
+    if (!value || std::string_view(value) == "json") {
+        return PayloadFormat::Json;
+    }
+    if (std::string_view(value) == "protobuf") {
+        return PayloadFormat::Protobuf;
+    }
+    std::cerr << "[Encoder] Unknown API_PAYLOAD_FORMAT=" << value << ", using json" << std::endl;
+    return PayloadFormat::Json;
+}
+
+metricsys::PageViewEvent toProto(const PageViewEvent& event) {
+    metricsys::PageViewEvent out;
+    out.set_page(event.page);
+    if (event.user_id.has_value())
+        out.set_user_id(*event.user_id);
+    if (event.session_id.has_value())
+        out.set_session_id(*event.session_id);
+    if (event.referrer.has_value())
+        out.set_referrer(*event.referrer);
+    out.set_timestamp(event.timestamp);
+    return out;
+}
+
+metricsys::ClickEvent toProto(const ClickEvent& event) {
+    metricsys::ClickEvent out;
+    out.set_page(event.page);
+    out.set_element_id(event.element_id);
+    if (event.action.has_value())
+        out.set_action(*event.action);
+    if (event.user_id.has_value())
+        out.set_user_id(*event.user_id);
+    if (event.session_id.has_value())
+        out.set_session_id(*event.session_id);
+    out.set_timestamp(event.timestamp);
+    return out;
+}
+
+metricsys::PerformanceEvent toProto(const PerformanceEvent& event) {
+    metricsys::PerformanceEvent out;
+    out.set_page(event.page);
+    if (event.ttfb_ms.has_value())
+        out.set_ttfb_ms(*event.ttfb_ms);
+    if (event.fcp_ms.has_value())
+        out.set_fcp_ms(*event.fcp_ms);
+    if (event.lcp_ms.has_value())
+        out.set_lcp_ms(*event.lcp_ms);
+    if (event.total_page_load_ms.has_value())
+        out.set_total_page_load_ms(*event.total_page_load_ms);
+    if (event.user_id.has_value())
+        out.set_user_id(*event.user_id);
+    if (event.session_id.has_value())
+        out.set_session_id(*event.session_id);
+    out.set_timestamp(event.timestamp);
+    return out;
+}
+
+static metricsys::Severity toProto(Severity severity) {
+    switch (severity) {
+        case Severity::Warning: return metricsys::SEVERITY_WARNING;
+        case Severity::Error: return metricsys::SEVERITY_ERROR;
+        case Severity::Critical: return metricsys::SEVERITY_CRITICAL;
+    }
+    return metricsys::SEVERITY_UNSPECIFIED;
+}
+
+metricsys::ErrorEvent toProto(const ErrorEvent& event) {
+    metricsys::ErrorEvent out;
+    out.set_page(event.page);
+    out.set_error_type(event.error_type);
+    out.set_message(event.message);
+    if (event.stack.has_value())
+        out.set_stack(*event.stack);
+    out.set_severity(toProto(event.severity));
+    if (event.user_id.has_value())
+        out.set_user_id(*event.user_id);
+    if (event.session_id.has_value())
+        out.set_session_id(*event.session_id);
+    out.set_timestamp(event.timestamp);
+    return out;
+}
+
+metricsys::CustomEvent toProto(const CustomEvent& event) {
+    metricsys::CustomEvent out;
+    out.set_name(event.name);
+    if (event.page.has_value())
+        out.set_page(*event.page);
+    if (event.user_id.has_value())
+        out.set_user_id(*event.user_id);
+    if (event.session_id.has_value())
+        out.set_session_id(*event.session_id);
+    if (event.properties && event.properties->is_object()) {
+        auto& properties = *out.mutable_properties();
+        for (const auto& [key, value] : event.properties->items()) {
+            properties[key] = value.is_string() ? value.get<std::string>() : value.dump();
+        }
+    }
+    out.set_timestamp(event.timestamp);
+    return out;
+}
@@ -3,11 +3,17 @@
 #include <iostream>
 #include <cstdlib>
 #include <chrono>
+#include <memory>
 #include <grpcpp/create_channel.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/util/time_util.h>
 #include "rabbitmq.hpp"
+#include "spool.hpp"
+#include "event_encoder.hpp"
 #include "aggregation_client.hpp"
 #include "monitoring_client.hpp"
+#include "response_cache.hpp"
 
 using json = nlohmann::json;
 
@@ -21,26 +27,9 @@ static int getEnvInt(const char* name, int defaultValue) {
     return val ? std::stoi(val) : defaultValue;
 }
 
-static RabbitMQ* g_rabbitmq = nullptr;
 static AggregationClient* g_aggregation_client = nullptr;
 static MonitoringClient* g_monitoring_client = nullptr;
 
-static RabbitMQ& getRabbitMQ() {
-    if (!g_rabbitmq) {
-        g_rabbitmq = new RabbitMQ(
-            getEnvStr("RABBITMQ_HOST", "localhost"),
-            getEnvInt("RABBITMQ_PORT", 5672),
-            getEnvStr("RABBITMQ_USERNAME", "guest"),
-            getEnvStr("RABBITMQ_PASSWORD", "guest"),
-            getEnvStr("RABBITMQ_VHOST", "/")
-        );
-        if (!g_rabbitmq->connect()) {
-            std::cerr << "[RabbitMQ] Failed to connect, messages will be lost" << std::endl;
-        }
-    }
-    return *g_rabbitmq;
-}
-
 static AggregationClient& getAggregationClient() {
     if (!g_aggregation_client) {
         const std::string host = getEnvStr("AGGREGATION_GRPC_HOST", "localhost");
@@ -72,21 +61,228 @@ static std::string toIsoString(const google::protobuf::Timestamp& ts) {
     return google::protobuf::util::TimeUtil::ToString(ts);
 }
 
+// ==================== Publisher ====================
+
+// Статический локальный объект: потоки издателя останавливаются при выходе из процесса
+static RabbitMQPublisher& getPublisher() {
+    static RabbitMQPublisher publisher(loadRabbitMQConfig());
+    return publisher;
+}
+
+struct SpoolState {
+    std::unique_ptr<Spool> spool;
+    std::unique_ptr<SpoolReplayer> replayer;
+
+    SpoolState() = default;
+    SpoolState(SpoolState&&) = default;
+
+    // Издатель создан раньше и разрушается позже журнала: его останавливают здесь,
+    // чтобы недоставленное успело лечь в журнал
+    ~SpoolState() {
+        replayer.reset();
+        if (spool) {
+            getPublisher().stop();
+        }
+    }
+};
+
+// Журнал на диске для событий, которые издатель сейчас не примет.
+// nullptr, если API_SPOOL_DIR пуст или каталог недоступен — тогда такие события получают 503
+static Spool* getSpool() {
+    static SpoolState state = [] {
+        SpoolState s;
+        const std::string dir = getEnvStr("API_SPOOL_DIR", "/var/spool/api-service");
+        if (dir.empty()) {
+            return s;
+        }
+        try {
+            s.spool = std::make_unique<Spool>(Spool::Config{
+                dir,
+                static_cast<size_t>(getEnvInt("API_SPOOL_SEGMENT_MB", 64)) << 20,
+                static_cast<size_t>(getEnvInt("API_SPOOL_MAX_MB", 1024)) << 20});
+            s.replayer = std::make_unique<SpoolReplayer>(*s.spool, getPublisher());
+            // Сообщения с on_confirm пришли из журнала и остаются в нём до подтверждения
+            getPublisher().setShutdownSink([spool = s.spool.get()](const PublishMessage& message) {
+                return message.on_confirm ? true : spool->append(message);
+            });
+        } catch (const std::exception& e) {
+            std::cerr << "[Spool] Disabled: " << e.what() << std::endl;
+            s.spool.reset();
+        }
+        return s;
+    }();
+    return state.spool.get();
+}
+
+// Формат тел сообщений в очередях; читается один раз при первом событии
+static PayloadFormat payloadFormat() {
+    static const PayloadFormat format = loadPayloadFormat();
+    return format;
+}
+
+// Пока в журнале есть события, новые тоже пишутся туда — иначе они обгонят
+// накопленные. Журнал же принимает события, пока издатель не подключён или его
+// очередь полна. false — событие не принято никуда
+static bool enqueue(PublishMessage&& message) {
+    auto& publisher = getPublisher();
+    Spool* spool = getSpool();
+    if (spool && (!spool->empty() || !publisher.connected())) {
+        return spool->append(message);
+    }
+    if (publisher.publish(std::move(message)) == PublishStatus::Queued) {
+        return true;
+    }
+    return spool && spool->append(message);
+}
+
+// ==================== Response Cache ====================
+
+static std::optional<std::string> fetchWatermark() {
+    metricsys::aggregation::GetWatermarkRequest rpcReq;
+    metricsys::aggregation::GetWatermarkResponse rpcResp;
+    auto status = getAggregationClient().GetWatermark(
+        rpcReq, &rpcResp, std::chrono::milliseconds(getEnvInt("AGGREGATION_GRPC_TIMEOUT_MS", 2000)));
+    if (!status.ok()) {
+        return std::nullopt;
+    }
+    return toIsoString(rpcResp.last_aggregated_at());
+}
+
+// Статический локальный объект: handlers вызываются из потоков httplib
+static ResponseCache& getResponseCache() {
+    static ResponseCache cache(
+        ResponseCache::Config{
+            static_cast<size_t>(getEnvInt("API_CACHE_MAX_MB", 64)) << 20,
+            std::chrono::milliseconds(getEnvInt("API_CACHE_WATERMARK_CHECK_MS", 1000))},
+        fetchWatermark);
+    return cache;
+}
+
+// Ключ — эндпоинт и детерминированно сериализованный gRPC-запрос: порядок полей JSON,
+// формат времени и явные значения по умолчанию на ключ не влияют
+static std::string cacheKey(const std::string& endpoint, const google::protobuf::Message& rpcReq) {
+    std::string key = endpoint + '\n';
+    {
+        google::protobuf::io::StringOutputStream stream(&key);
+        google::protobuf::io::CodedOutputStream coded(&stream);
+        coded.SetSerializationDeterministic(true);
+        rpcReq.SerializeToCodedStream(&coded);
+    }
+    return key;
+}
+
 // ==================== Helper Functions ====================
 
+static CachedResponse errorResponse(int status, ErrorCode code,
+                                    const std::string& message,
+                                    std::optional<json> details = std::nullopt) {
+    ErrorResponse err{code, message, details};
+    return CachedResponse{status, json(err).dump()};
+}
+
 static void sendError(httplib::Response& res, int status, ErrorCode code,
                       const std::string& message,
                       std::optional<json> details = std::nullopt) {
-    ErrorResponse err{code, message, details};
+    auto response = errorResponse(status, code, message, std::move(details));
+    res.status = response.status;
+    res.set_content(response.body, "application/json");
+}
+
+static void sendError(httplib::Response& res, int status, const ErrorResponse& err) {
     res.status = status;
     res.set_content(json(err).dump(), "application/json");
 }
 
+static void sendUnavailable(httplib::Response& res, const std::string& message) {
+    sendError(res, 503, ErrorCode::ServiceUnavailable, message);
+    res.set_header("Retry-After", "1");
+}
+
+// Ставит событие в очередь издателя или журнал; если не принято, отвечает 503
+template <typename Event>
+static bool enqueueEvent(httplib::Response& res, const char* queue, const Event& event) {
+    if (!enqueue(encodeEvent(queue, event, payloadFormat()))) {
+        sendUnavailable(res, "Event queue is full, retry later");
+        return false;
+    }
+    return true;
+}
+
 static void sendAccepted(httplib::Response& res) {
     res.status = 202;
     res.set_content(R"({"status":"accepted"})", "application/json");
 }
 
+// ==================== Validation ====================
+// Одни и те же правила для одиночных эндпоинтов и элементов /events/batch
+
+static ErrorResponse requiredField(ErrorCode code, const std::string& field) {
+    return ErrorResponse{code, "Field '" + field + "' must not be empty",
+                         json{{"field", field}, {"reason", "required"}}};
+}
+
+static std::optional<ErrorResponse> nonNegativeTiming(const std::optional<double>& value,
+                                                      const std::string& field) {
+    if (value.has_value() && value.value() < 0) {
+        return ErrorResponse{ErrorCode::InvalidPerformanceEvent, "Timing fields must be non-negative",
+                             json{{"field", field}, {"reason", "must_be_positive"}}};
+    }
+    return std::nullopt;
+}
+
+static std::optional<ErrorResponse> validateEvent(const PageViewEvent& event) {
+    if (event.page.empty()) {
+        return requiredField(ErrorCode::InvalidPageView, "page");
+    }
+    return std::nullopt;
+}
+
+static std::optional<ErrorResponse> validateEvent(const ClickEvent& event) {
+    if (event.page.empty()) {
+        return requiredField(ErrorCode::InvalidClickEvent, "page");
+    }
+    if (event.element_id.empty()) {
+        return requiredField(ErrorCode::InvalidClickEvent, "element_id");
+    }
+    return std::nullopt;
+}
+
+static std::optional<ErrorResponse> validateEvent(const PerformanceEvent& event) {
+    if (event.page.empty()) {
+        return requiredField(ErrorCode::InvalidPerformanceEvent, "page");
+    }
+    if (auto error = nonNegativeTiming(event.ttfb_ms, "ttfb_ms")) {
+        return error;
+    }
+    if (auto error = nonNegativeTiming(event.fcp_ms, "fcp_ms")) {
+        return error;
+    }
+    if (auto error = nonNegativeTiming(event.lcp_ms, "lcp_ms")) {
+        return error;
+    }
+    return nonNegativeTiming(event.total_page_load_ms, "total_page_load_ms");
+}
+
+static std::optional<ErrorResponse> validateEvent(const ErrorEvent& event) {
+    if (event.page.empty()) {
+        return requiredField(ErrorCode::InvalidErrorEvent, "page");
+    }
+    if (event.error_type.empty()) {
+        return requiredField(ErrorCode::InvalidErrorEvent, "error_type");
+    }
+    if (event.message.empty()) {
+        return requiredField(ErrorCode::InvalidErrorEvent, "message");
+    }
+    return std::nullopt;
+}
+
+static std::optional<ErrorResponse> validateEvent(const CustomEvent& event) {
+    if (event.name.empty()) {
+        return requiredField(ErrorCode::InvalidCustomEvent, "name");
+    }
+    return std::nullopt;
+}
+
 // ==================== Handlers ====================
 
 // GET /health/ping
@@ -102,21 +298,13 @@ void handlePageView(const httplib::Request& req, httplib::Response& res) {
         auto body = json::parse(req.body);
         PageViewEvent event = body.get<PageViewEvent>();
 
-        if (event.page.empty()) {
-            sendError(res, 400, ErrorCode::InvalidPageView,
-                      "Field 'page' must not be empty",
-                      json{{"field", "page"}, {"reason", "required"}});
+        if (auto error = validateEvent(event)) {
+            sendError(res, 400, *error);
             return;
         }
 
-        std::cout << "[PageView] page=" << event.page << std::endl;
-
-        if (!getRabbitMQ().publish("", "page_views", json(event).dump())) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to publish page view event");
+        if (!enqueueEvent(res, "page_views", event)) {
             return;
-        } else {
-            std::cout << "[PageView] Published event for page=" << event.page << std::endl;
         }
         sendAccepted(res);
     } catch (const json::exception& e) {
@@ -131,28 +319,13 @@ void handleClick(const httplib::Request& req, httplib::Response& res) {
         auto body = json::parse(req.body);
         ClickEvent event = body.get<ClickEvent>();
 
-        if (event.page.empty()) {
-            sendError(res, 400, ErrorCode::InvalidClickEvent,
-                      "Field 'page' must not be empty",
-                      json{{"field", "page"}, {"reason", "required"}});
+        if (auto error = validateEvent(event)) {
+            sendError(res, 400, *error);
             return;
         }
-        if (event.element_id.empty()) {
-            sendError(res, 400, ErrorCode::InvalidClickEvent,
-                      "Field 'element_id' must not be empty",
-                      json{{"field", "element_id"}, {"reason", "required"}});
-            return;
-        }
-
-        std::cout << "[Click] page=" << event.page
-                  << " element_id=" << event.element_id << std::endl;
 
-        if (!getRabbitMQ().publish("", "clicks", json(event).dump())) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to publish click event");
+        if (!enqueueEvent(res, "clicks", event)) {
             return;
-        } else {
-            std::cout << "[Click] Published event for page=" << event.page << " element_id=" << event.element_id << std::endl;
         }
         sendAccepted(res);
     } catch (const json::exception& e) {
@@ -167,49 +340,14 @@ void handlePerformance(const httplib::Request& req, httplib::Response& res) {
         auto body = json::parse(req.body);
         PerformanceEvent event = body.get<PerformanceEvent>();
 
-        if (event.page.empty()) {
-            sendError(res, 400, ErrorCode::InvalidPerformanceEvent,
-                      "Field 'page' must not be empty",
-                      json{{"field", "page"}, {"reason", "required"}});
+        if (auto error = validateEvent(event)) {
+            sendError(res, 400, *error);
             return;
         }
 
-        if (event.ttfb_ms.has_value() && event.ttfb_ms.value() < 0) {
-            sendError(res, 400, ErrorCode::InvalidPerformanceEvent,
-                      "Timing fields must be non-negative",
-                      json{{"field", "ttfb_ms"}, {"reason", "must_be_positive"}});
-            return;
-        }
-        if (event.fcp_ms.has_value() && event.fcp_ms.value() < 0) {
-            sendError(res, 400, ErrorCode::InvalidPerformanceEvent,
-                      "Timing fields must be non-negative",
-                      json{{"field", "fcp_ms"}, {"reason", "must_be_positive"}});
+        if (!enqueueEvent(res, "performance_events", event)) {
             return;
         }
-        if (event.lcp_ms.has_value() && event.lcp_ms.value() < 0) {
-            sendError(res, 400, ErrorCode::InvalidPerformanceEvent,
-                      "Timing fields must be non-negative",
-                      json{{"field", "lcp_ms"}, {"reason", "must_be_positive"}});
-            return;
-        }
-        if (event.total_page_load_ms.has_value() &&
-            event.total_page_load_ms.value() < 0) {
-            sendError(
-                res, 400, ErrorCode::InvalidPerformanceEvent,
-                "Timing fields must be non-negative",
-                json{{"field", "total_page_load_ms"}, {"reason", "must_be_positive"}});
-            return;
-        }
-
-        std::cout << "[Performance] page=" << event.page << std::endl;
-
-        if (!getRabbitMQ().publish("", "performance_events", json(event).dump())) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to publish performance event");
-            return;
-        } else {
-            std::cout << "[Performance] Published event for page=" << event.page << std::endl;
-        }
         sendAccepted(res);
     } catch (const json::exception& e) {
         sendError(res, 400, ErrorCode::InvalidPerformanceEvent,
@@ -223,34 +361,13 @@ void handleErrorEvent(const httplib::Request& req, httplib::Response& res) {
         auto body = json::parse(req.body);
         ErrorEvent event = body.get<ErrorEvent>();
 
-        if (event.page.empty()) {
-            sendError(res, 400, ErrorCode::InvalidErrorEvent,
-                      "Field 'page' must not be empty",
-                      json{{"field", "page"}, {"reason", "required"}});
-            return;
-        }
-        if (event.error_type.empty()) {
-            sendError(res, 400, ErrorCode::InvalidErrorEvent,
-                      "Field 'error_type' must not be empty",
-                      json{{"field", "error_type"}, {"reason", "required"}});
+        if (auto error = validateEvent(event)) {
+            sendError(res, 400, *error);
             return;
         }
-        if (event.message.empty()) {
-            sendError(res, 400, ErrorCode::InvalidErrorEvent,
-                      "Field 'message' must not be empty",
-                      json{{"field", "message"}, {"reason", "required"}});
-            return;
-        }
-
-        std::cout << "[ErrorEvent] page=" << event.page
-                  << " error_type=" << event.error_type << std::endl;
 
-        if (!getRabbitMQ().publish("", "error_events", json(event).dump())) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to publish error event");
+        if (!enqueueEvent(res, "error_events", event)) {
             return;
-        } else {
-            std::cout << " DSJKLFJDSLKJFL:DSKJFLKSDJFLKDJSFLKDSJFKLDF [ErrorEvent] Published event for page=" << event.page << " error_type=" << event.error_type << std::endl;
         }
         sendAccepted(res);
     } catch (const json::exception& e) {
@@ -265,21 +382,13 @@ void handleCustomEvent(const httplib::Request& req, httplib::Response& res) {
         auto body = json::parse(req.body);
         CustomEvent event = body.get<CustomEvent>();
 
-        if (event.name.empty()) {
-            sendError(res, 400, ErrorCode::InvalidCustomEvent,
-                      "Field 'name' must not be empty",
-                      json{{"field", "name"}, {"reason", "required"}});
+        if (auto error = validateEvent(event)) {
+            sendError(res, 400, *error);
             return;
         }
 
-        std::cout << "[CustomEvent] name=" << event.name << std::endl;
-
-        if (!getRabbitMQ().publish("", "custom_events", json(event).dump())) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to publish custom event");
+        if (!enqueueEvent(res, "custom_events", event)) {
             return;
-        } else {
-            std::cout << "[CustomEvent] Published event name=" << event.name << std::endl;
         }
         sendAccepted(res);
     } catch (const json::exception& e) {
@@ -288,6 +397,116 @@ void handleCustomEvent(const httplib::Request& req, httplib::Response& res) {
     }
 }
 
+// ==================== Batch ====================
+
+// Разбирает элемент батча как событие Event; при успехе out — сообщение в очередь queue
+template <typename Event>
+static std::optional<ErrorResponse> prepareBatchEvent(const json& item, ErrorCode code,
+                                                      const char* queue, PublishMessage& out) {
+    try {
+        Event event = item.get<Event>();
+        if (auto error = validateEvent(event)) {
+            return error;
+        }
+        out = encodeEvent(queue, event, payloadFormat());
+        return std::nullopt;
+    } catch (const json::exception& e) {
+        return ErrorResponse{code, std::string("Invalid JSON: ") + e.what(), std::nullopt};
+    }
+}
+
+static std::optional<ErrorResponse> prepareBatchItem(const json& item, PublishMessage& out) {
+    std::string type;
+    if (item.is_object() && item.contains("type") && item["type"].is_string()) {
+        type = item["type"].get<std::string>();
+    }
+
+    if (type == "page_view") {
+        return prepareBatchEvent<PageViewEvent>(item, ErrorCode::InvalidPageView, "page_views", out);
+    }
+    if (type == "click") {
+        return prepareBatchEvent<ClickEvent>(item, ErrorCode::InvalidClickEvent, "clicks", out);
+    }
+    if (type == "performance") {
+        return prepareBatchEvent<PerformanceEvent>(item, ErrorCode::InvalidPerformanceEvent,
+                                                   "performance_events", out);
+    }
+    if (type == "error") {
+        return prepareBatchEvent<ErrorEvent>(item, ErrorCode::InvalidErrorEvent, "error_events", out);
+    }
+    if (type == "custom") {
+        return prepareBatchEvent<CustomEvent>(item, ErrorCode::InvalidCustomEvent, "custom_events", out);
+    }
+    return ErrorResponse{ErrorCode::InvalidBatch,
+                         "Field 'type' must be one of page_view, click, performance, error, custom",
+                         json{{"field", "type"}, {"reason", "unknown_type"}}};
+}
+
+// POST /events/batch
+void handleEventsBatch(const httplib::Request& req, httplib::Response& res) {
+    const size_t maxEvents = static_cast<size_t>(getEnvInt("API_BATCH_MAX_EVENTS", 500));
+
+    json body;
+    try {
+        body = json::parse(req.body);
+    } catch (const json::exception& e) {
+        sendError(res, 400, ErrorCode::InvalidBatch, std::string("Invalid JSON: ") + e.what());
+        return;
+    }
+
+    if (!body.is_object() || !body.contains("events") || !body["events"].is_array() ||
+        body["events"].empty()) {
+        sendError(res, 400, ErrorCode::InvalidBatch,
+                  "Field 'events' must be a non-empty array",
+                  json{{"field", "events"}, {"reason", "required"}});
+        return;
+    }
+    const auto& events = body["events"];
+    if (events.size() > maxEvents) {
+        sendError(res, 400, ErrorCode::InvalidBatch,
+                  "Batch must not contain more than " + std::to_string(maxEvents) + " events",
+                  json{{"field", "events"}, {"reason", "too_many"}, {"limit", maxEvents}});
+        return;
+    }
+
+    BatchResponse response;
+    response.results.resize(events.size());
+    for (size_t i = 0; i < events.size(); ++i) {
+        auto& result = response.results[i];
+        result.index = i;
+
+        PublishMessage message;
+        if (auto error = prepareBatchItem(events[i], message)) {
+            result.status = "rejected";
+            result.error = std::move(error);
+            ++response.rejected;
+            continue;
+        }
+        if (enqueue(std::move(message))) {
+            result.status = "accepted";
+            ++response.accepted;
+        } else {
+            result.status = "failed";
+            result.error = ErrorResponse{ErrorCode::ServiceUnavailable, "Event queue is full, retry later",
+                                         std::nullopt};
+            ++response.failed;
+        }
+    }
+
+    // 207: хотя бы один элемент не принят, статус каждого — в results.
+    // 503: все элементы валидны, но ни очередь издателя, ни журнал их не приняли —
+    // батч можно повторить целиком
+    if (response.accepted == events.size()) {
+        res.status = 202;
+    } else if (response.failed == events.size()) {
+        res.status = 503;
+        res.set_header("Retry-After", "1");
+    } else {
+        res.status = 207;
+    }
+    res.set_content(json(response).dump(), "application/json");
+}
+
 // GET /uptime
 void handleUptime(const httplib::Request& req, httplib::Response& res) {
     const int timeoutMs = getEnvInt("MONITORING_HTTP_TIMEOUT_MS", 2000);
@@ -446,30 +665,33 @@ void handleAggregationPageViews(const httplib::Request& req, httplib::Response&
             }
         }
 
-        metricsys::aggregation::GetPageViewsAggResponse rpcResp;
-        auto status = getAggregationClient().GetPageViewsAgg(
-            rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
-        if (!status.ok()) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to fetch aggregation results: " + status.error_message());
-            return;
-        }
+        auto response = getResponseCache().get(cacheKey("page-views", rpcReq), [&] {
+            metricsys::aggregation::GetPageViewsAggResponse rpcResp;
+            auto status = getAggregationClient().GetPageViewsAgg(
+                rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
+            if (!status.ok()) {
+                return errorResponse(500, ErrorCode::InternalError,
+                                     "Failed to fetch aggregation results: " + status.error_message());
+            }
 
-        GetPageViewsAggResponse httpResp;
-        for (const auto& row : rpcResp.rows()) {
-            AggPageViewsRow r;
-            r.time_bucket = toIsoString(row.time_bucket());
-            r.project_id = row.project_id();
-            r.page = row.page();
-            r.views_count = row.views_count();
-            r.unique_users = row.unique_users();
-            r.unique_sessions = row.unique_sessions();
-            r.created_at = toIsoString(row.created_at());
-            httpResp.rows.push_back(std::move(r));
-        }
+            GetPageViewsAggResponse httpResp;
+            for (const auto& row : rpcResp.rows()) {
+                AggPageViewsRow r;
+                r.time_bucket = toIsoString(row.time_bucket());
+                r.project_id = row.project_id();
+                r.page = row.page();
+                r.views_count = row.views_count();
+                r.unique_users = row.unique_users();
+                r.unique_sessions = row.unique_sessions();
+                r.created_at = toIsoString(row.created_at());
+                httpResp.rows.push_back(std::move(r));
+            }
+
+            return CachedResponse{200, json(httpResp).dump()};
+        });
 
-        res.status = 200;
-        res.set_content(json(httpResp).dump(), "application/json");
+        res.status = response.status;
+        res.set_content(response.body, "application/json");
     } catch (const json::exception& e) {
         sendError(res, 400, ErrorCode::ValidationError,
                   std::string("Invalid JSON: ") + e.what());
@@ -515,33 +737,36 @@ void handleAggregationClicks(const httplib::Request& req, httplib::Response& res
             }
         }
 
-        metricsys::aggregation::GetClicksAggResponse rpcResp;
-        auto status = getAggregationClient().GetClicksAgg(
-            rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
-        if (!status.ok()) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to fetch aggregation results: " + status.error_message());
-            return;
-        }
+        auto response = getResponseCache().get(cacheKey("clicks", rpcReq), [&] {
+            metricsys::aggregation::GetClicksAggResponse rpcResp;
+            auto status = getAggregationClient().GetClicksAgg(
+                rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
+            if (!status.ok()) {
+                return errorResponse(500, ErrorCode::InternalError,
+                                     "Failed to fetch aggregation results: " + status.error_message());
+            }
 
-        GetClicksAggResponse httpResp;
-        for (const auto& row : rpcResp.rows()) {
-            AggClicksRow r;
-            r.time_bucket = toIsoString(row.time_bucket());
-            r.project_id = row.project_id();
-            r.page = row.page();
-            if (row.has_element_id()) {
-                r.element_id = row.element_id();
+            GetClicksAggResponse httpResp;
+            for (const auto& row : rpcResp.rows()) {
+                AggClicksRow r;
+                r.time_bucket = toIsoString(row.time_bucket());
+                r.project_id = row.project_id();
+                r.page = row.page();
+                if (row.has_element_id()) {
+                    r.element_id = row.element_id();
+                }
+                r.clicks_count = row.clicks_count();
+                r.unique_users = row.unique_users();
+                r.unique_sessions = row.unique_sessions();
+                r.created_at = toIsoString(row.created_at());
+                httpResp.rows.push_back(std::move(r));
             }
-            r.clicks_count = row.clicks_count();
-            r.unique_users = row.unique_users();
-            r.unique_sessions = row.unique_sessions();
-            r.created_at = toIsoString(row.created_at());
-            httpResp.rows.push_back(std::move(r));
-        }
 
-        res.status = 200;
-        res.set_content(json(httpResp).dump(), "application/json");
+            return CachedResponse{200, json(httpResp).dump()};
+        });
+
+        res.status = response.status;
+        res.set_content(response.body, "application/json");
     } catch (const json::exception& e) {
         sendError(res, 400, ErrorCode::ValidationError,
                   std::string("Invalid JSON: ") + e.what());
@@ -584,36 +809,39 @@ void handleAggregationPerformance(const httplib::Request& req, httplib::Response
             }
         }
 
-        metricsys::aggregation::GetPerformanceAggResponse rpcResp;
-        auto status = getAggregationClient().GetPerformanceAgg(
-            rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
-        if (!status.ok()) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to fetch aggregation results: " + status.error_message());
-            return;
-        }
+        auto response = getResponseCache().get(cacheKey("performance", rpcReq), [&] {
+            metricsys::aggregation::GetPerformanceAggResponse rpcResp;
+            auto status = getAggregationClient().GetPerformanceAgg(
+                rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
+            if (!status.ok()) {
+                return errorResponse(500, ErrorCode::InternalError,
+                                     "Failed to fetch aggregation results: " + status.error_message());
+            }
+
+            GetPerformanceAggResponse httpResp;
+            for (const auto& row : rpcResp.rows()) {
+                AggPerformanceRow r;
+                r.time_bucket = toIsoString(row.time_bucket());
+                r.project_id = row.project_id();
+                r.page = row.page();
+                r.samples_count = row.samples_count();
+                r.avg_total_load_ms = row.avg_total_load_ms();
+                r.p95_total_load_ms = row.p95_total_load_ms();
+                r.avg_ttfb_ms = row.avg_ttfb_ms();
+                r.p95_ttfb_ms = row.p95_ttfb_ms();
+                r.avg_fcp_ms = row.avg_fcp_ms();
+                r.p95_fcp_ms = row.p95_fcp_ms();
+                r.avg_lcp_ms = row.avg_lcp_ms();
+                r.p95_lcp_ms = row.p95_lcp_ms();
+                r.created_at = toIsoString(row.created_at());
+                httpResp.rows.push_back(std::move(r));
+            }
+
+            return CachedResponse{200, json(httpResp).dump()};
+        });
 
-        GetPerformanceAggResponse httpResp;
-        for (const auto& row : rpcResp.rows()) {
-            AggPerformanceRow r;
-            r.time_bucket = toIsoString(row.time_bucket());
-            r.project_id = row.project_id();
-            r.page = row.page();
-            r.samples_count = row.samples_count();
-            r.avg_total_load_ms = row.avg_total_load_ms();
-            r.p95_total_load_ms = row.p95_total_load_ms();
-            r.avg_ttfb_ms = row.avg_ttfb_ms();
-            r.p95_ttfb_ms = row.p95_ttfb_ms();
-            r.avg_fcp_ms = row.avg_fcp_ms();
-            r.p95_fcp_ms = row.p95_fcp_ms();
-            r.avg_lcp_ms = row.avg_lcp_ms();
-            r.p95_lcp_ms = row.p95_lcp_ms();
-            r.created_at = toIsoString(row.created_at());
-            httpResp.rows.push_back(std::move(r));
-        }
-
-        res.status = 200;
-        res.set_content(json(httpResp).dump(), "application/json");
+        res.status = response.status;
+        res.set_content(response.body, "application/json");
     } catch (const json::exception& e) {
         sendError(res, 400, ErrorCode::ValidationError,
                   std::string("Invalid JSON: ") + e.what());
@@ -659,34 +887,37 @@ void handleAggregationErrors(const httplib::Request& req, httplib::Response& res
             }
         }
 
-        metricsys::aggregation::GetErrorsAggResponse rpcResp;
-        auto status = getAggregationClient().GetErrorsAgg(
-            rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
-        if (!status.ok()) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to fetch aggregation results: " + status.error_message());
-            return;
-        }
+        auto response = getResponseCache().get(cacheKey("errors", rpcReq), [&] {
+            metricsys::aggregation::GetErrorsAggResponse rpcResp;
+            auto status = getAggregationClient().GetErrorsAgg(
+                rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
+            if (!status.ok()) {
+                return errorResponse(500, ErrorCode::InternalError,
+                                     "Failed to fetch aggregation results: " + status.error_message());
+            }
 
-        GetErrorsAggResponse httpResp;
-        for (const auto& row : rpcResp.rows()) {
-            AggErrorsRow r;
-            r.time_bucket = toIsoString(row.time_bucket());
-            r.project_id = row.project_id();
-            r.page = row.page();
-            if (row.has_error_type()) {
-                r.error_type = row.error_type();
+            GetErrorsAggResponse httpResp;
+            for (const auto& row : rpcResp.rows()) {
+                AggErrorsRow r;
+                r.time_bucket = toIsoString(row.time_bucket());
+                r.project_id = row.project_id();
+                r.page = row.page();
+                if (row.has_error_type()) {
+                    r.error_type = row.error_type();
+                }
+                r.errors_count = row.errors_count();
+                r.warning_count = row.warning_count();
+                r.critical_count = row.critical_count();
+                r.unique_users = row.unique_users();
+                r.created_at = toIsoString(row.created_at());
+                httpResp.rows.push_back(std::move(r));
             }
-            r.errors_count = row.errors_count();
-            r.warning_count = row.warning_count();
-            r.critical_count = row.critical_count();
-            r.unique_users = row.unique_users();
-            r.created_at = toIsoString(row.created_at());
-            httpResp.rows.push_back(std::move(r));
-        }
 
-        res.status = 200;
-        res.set_content(json(httpResp).dump(), "application/json");
+            return CachedResponse{200, json(httpResp).dump()};
+        });
+
+        res.status = response.status;
+        res.set_content(response.body, "application/json");
     } catch (const json::exception& e) {
         sendError(res, 400, ErrorCode::ValidationError,
                   std::string("Invalid JSON: ") + e.what());
@@ -730,39 +961,52 @@ void handleAggregationCustomEvents(const httplib::Request& req, httplib::Respons
             }
         }
 
-        metricsys::aggregation::GetCustomEventsAggResponse rpcResp;
-        auto status = getAggregationClient().GetCustomEventsAgg(
-            rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
-        if (!status.ok()) {
-            sendError(res, 500, ErrorCode::InternalError,
-                      "Failed to fetch aggregation results: " + status.error_message());
-            return;
-        }
+        auto response = getResponseCache().get(cacheKey("custom-events", rpcReq), [&] {
+            metricsys::aggregation::GetCustomEventsAggResponse rpcResp;
+            auto status = getAggregationClient().GetCustomEventsAgg(
+                rpcReq, &rpcResp, std::chrono::milliseconds(timeoutMs));
+            if (!status.ok()) {
+                return errorResponse(500, ErrorCode::InternalError,
+                                     "Failed to fetch aggregation results: " + status.error_message());
+            }
 
-        GetCustomEventsAggResponse httpResp;
-        for (const auto& row : rpcResp.rows()) {
-            AggCustomEventsRow r;
-            r.time_bucket = toIsoString(row.time_bucket());
-            r.project_id = row.project_id();
-            r.event_name = row.event_name();
-            if (row.has_page()) {
-                r.page = row.page();
+            GetCustomEventsAggResponse httpResp;
+            for (const auto& row : rpcResp.rows()) {
+                AggCustomEventsRow r;
+                r.time_bucket = toIsoString(row.time_bucket());
+                r.project_id = row.project_id();
+                r.event_name = row.event_name();
+                if (row.has_page()) {
+                    r.page = row.page();
+                }
+                r.events_count = row.events_count();
+                r.unique_users = row.unique_users();
+                r.unique_sessions = row.unique_sessions();
+                r.created_at = toIsoString(row.created_at());
+                httpResp.rows.push_back(std::move(r));
             }
-            r.events_count = row.events_count();
-            r.unique_users = row.unique_users();
-            r.unique_sessions = row.unique_sessions();
-            r.created_at = toIsoString(row.created_at());
-            httpResp.rows.push_back(std::move(r));
-        }
 
-        res.status = 200;
-        res.set_content(json(httpResp).dump(), "application/json");
+            return CachedResponse{200, json(httpResp).dump()};
+        });
+
+        res.status = response.status;
+        res.set_content(response.body, "application/json");
     } catch (const json::exception& e) {
         sendError(res, 400, ErrorCode::ValidationError,
                   std::string("Invalid JSON: ") + e.what());
     }
 }
 
+// GET /metrics
+void handleMetrics(const httplib::Request&, httplib::Response& res) {
+    res.status = 200;
+    std::string metrics = getResponseCache().formatMetrics() + getPublisher().formatMetrics();
+    if (Spool* spool = getSpool()) {
+        metrics += spool->formatMetrics();
+    }
+    res.set_content(metrics, "text/plain; version=0.0.4");
+}
+
 // ==================== Route Registration ====================
 
 void registerRoutes(httplib::Server& server) {
@@ -772,6 +1016,7 @@ void registerRoutes(httplib::Server& server) {
     server.Post("/performance", handlePerformance);
     server.Post("/errors", handleErrorEvent);
     server.Post("/custom-events", handleCustomEvent);
+    server.Post("/events/batch", handleEventsBatch);
     server.Get("/uptime", handleUptime);
     server.Get("/uptime/day", handleUptimeDay);
     server.Get("/uptime/week", handleUptimeWeek);
@@ -783,4 +1028,5 @@ void registerRoutes(httplib::Server& server) {
     server.Post("/aggregation/performance", handleAggregationPerformance);
     server.Post("/aggregation/errors", handleAggregationErrors);
     server.Post("/aggregation/custom-events", handleAggregationCustomEvents);
+    server.Get("/metrics", handleMetrics);
 }
@@ -0,0 +1,8623 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: metrics.proto
+
+#include "metrics.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace metricsys {
+PROTOBUF_CONSTEXPR TimeRange::TimeRange(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.start_timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.end_timestamp_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TimeRangeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TimeRangeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TimeRangeDefaultTypeInternal() {}
+  union {
+    TimeRange _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TimeRangeDefaultTypeInternal _TimeRange_default_instance_;
+PROTOBUF_CONSTEXPR Pagination::Pagination(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.limit_)*/0
+  , /*decltype(_impl_.offset_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PaginationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PaginationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PaginationDefaultTypeInternal() {}
+  union {
+    Pagination _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PaginationDefaultTypeInternal _Pagination_default_instance_;
+PROTOBUF_CONSTEXPR EventCursor::EventCursor(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_us_)*/int64_t{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EventCursorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EventCursorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EventCursorDefaultTypeInternal() {}
+  union {
+    EventCursor _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EventCursorDefaultTypeInternal _EventCursor_default_instance_;
+PROTOBUF_CONSTEXPR PageViewEvent::PageViewEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.referrer_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}} {}
+struct PageViewEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PageViewEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PageViewEventDefaultTypeInternal() {}
+  union {
+    PageViewEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PageViewEventDefaultTypeInternal _PageViewEvent_default_instance_;
+PROTOBUF_CONSTEXPR GetPageViewsRequest::GetPageViewsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.page_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_range_)*/nullptr
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.allow_segments_)*/false} {}
+struct GetPageViewsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetPageViewsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetPageViewsRequestDefaultTypeInternal() {}
+  union {
+    GetPageViewsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetPageViewsRequestDefaultTypeInternal _GetPageViewsRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetPageViewsResponse::GetPageViewsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
+struct GetPageViewsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetPageViewsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetPageViewsResponseDefaultTypeInternal() {}
+  union {
+    GetPageViewsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetPageViewsResponseDefaultTypeInternal _GetPageViewsResponse_default_instance_;
+PROTOBUF_CONSTEXPR ClickEvent::ClickEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.element_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.action_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}} {}
+struct ClickEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ClickEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ClickEventDefaultTypeInternal() {}
+  union {
+    ClickEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ClickEventDefaultTypeInternal _ClickEvent_default_instance_;
+PROTOBUF_CONSTEXPR GetClicksRequest::GetClicksRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.page_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.element_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_range_)*/nullptr
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.allow_segments_)*/false} {}
+struct GetClicksRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetClicksRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetClicksRequestDefaultTypeInternal() {}
+  union {
+    GetClicksRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetClicksRequestDefaultTypeInternal _GetClicksRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetClicksResponse::GetClicksResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
+struct GetClicksResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetClicksResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetClicksResponseDefaultTypeInternal() {}
+  union {
+    GetClicksResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetClicksResponseDefaultTypeInternal _GetClicksResponse_default_instance_;
+PROTOBUF_CONSTEXPR PerformanceEvent::PerformanceEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ttfb_ms_)*/0
+  , /*decltype(_impl_.fcp_ms_)*/0
+  , /*decltype(_impl_.lcp_ms_)*/0
+  , /*decltype(_impl_.total_page_load_ms_)*/0
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}} {}
+struct PerformanceEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PerformanceEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PerformanceEventDefaultTypeInternal() {}
+  union {
+    PerformanceEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PerformanceEventDefaultTypeInternal _PerformanceEvent_default_instance_;
+PROTOBUF_CONSTEXPR GetPerformanceRequest::GetPerformanceRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.page_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_range_)*/nullptr
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.allow_segments_)*/false} {}
+struct GetPerformanceRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetPerformanceRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetPerformanceRequestDefaultTypeInternal() {}
+  union {
+    GetPerformanceRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetPerformanceRequestDefaultTypeInternal _GetPerformanceRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetPerformanceResponse::GetPerformanceResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
+struct GetPerformanceResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetPerformanceResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetPerformanceResponseDefaultTypeInternal() {}
+  union {
+    GetPerformanceResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetPerformanceResponseDefaultTypeInternal _GetPerformanceResponse_default_instance_;
+PROTOBUF_CONSTEXPR ErrorEvent::ErrorEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.stack_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}
+  , /*decltype(_impl_.severity_)*/0} {}
+struct ErrorEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ErrorEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ErrorEventDefaultTypeInternal() {}
+  union {
+    ErrorEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ErrorEventDefaultTypeInternal _ErrorEvent_default_instance_;
+PROTOBUF_CONSTEXPR GetErrorsRequest::GetErrorsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.page_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.error_type_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_range_)*/nullptr
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.severity_filter_)*/0
+  , /*decltype(_impl_.allow_segments_)*/false} {}
+struct GetErrorsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetErrorsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetErrorsRequestDefaultTypeInternal() {}
+  union {
+    GetErrorsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetErrorsRequestDefaultTypeInternal _GetErrorsRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetErrorsResponse::GetErrorsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
+struct GetErrorsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetErrorsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetErrorsResponseDefaultTypeInternal() {}
+  union {
+    GetErrorsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetErrorsResponseDefaultTypeInternal _GetErrorsResponse_default_instance_;
+PROTOBUF_CONSTEXPR CustomEvent_PropertiesEntry_DoNotUse::CustomEvent_PropertiesEntry_DoNotUse(
+    ::_pbi::ConstantInitialized) {}
+struct CustomEvent_PropertiesEntry_DoNotUseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomEvent_PropertiesEntry_DoNotUseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomEvent_PropertiesEntry_DoNotUseDefaultTypeInternal() {}
+  union {
+    CustomEvent_PropertiesEntry_DoNotUse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomEvent_PropertiesEntry_DoNotUseDefaultTypeInternal _CustomEvent_PropertiesEntry_DoNotUse_default_instance_;
+PROTOBUF_CONSTEXPR CustomEvent::CustomEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.properties_)*/{::_pbi::ConstantInitialized()}
+  , /*decltype(_impl_.id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.page_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.session_id_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.timestamp_)*/int64_t{0}
+  , /*decltype(_impl_.received_at_)*/int64_t{0}} {}
+struct CustomEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CustomEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CustomEventDefaultTypeInternal() {}
+  union {
+    CustomEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CustomEventDefaultTypeInternal _CustomEvent_default_instance_;
+PROTOBUF_CONSTEXPR GetCustomEventsRequest::GetCustomEventsRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.name_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.page_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.user_id_filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_range_)*/nullptr
+  , /*decltype(_impl_.pagination_)*/nullptr
+  , /*decltype(_impl_.after_)*/nullptr
+  , /*decltype(_impl_.received_range_)*/nullptr
+  , /*decltype(_impl_.allow_segments_)*/false} {}
+struct GetCustomEventsRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetCustomEventsRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetCustomEventsRequestDefaultTypeInternal() {}
+  union {
+    GetCustomEventsRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetCustomEventsRequestDefaultTypeInternal _GetCustomEventsRequest_default_instance_;
+PROTOBUF_CONSTEXPR GetCustomEventsResponse::GetCustomEventsResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.next_cursor_)*/nullptr
+  , /*decltype(_impl_.received_until_)*/int64_t{0}
+  , /*decltype(_impl_.total_count_)*/0} {}
+struct GetCustomEventsResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GetCustomEventsResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GetCustomEventsResponseDefaultTypeInternal() {}
+  union {
+    GetCustomEventsResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GetCustomEventsResponseDefaultTypeInternal _GetCustomEventsResponse_default_instance_;
+}  // namespace metricsys
+static ::_pb::Metadata file_level_metadata_metrics_2eproto[19];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_metrics_2eproto[1];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_metrics_2eproto = nullptr;
+
+const uint32_t TableStruct_metrics_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::metricsys::TimeRange, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::TimeRange, _impl_.start_timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::TimeRange, _impl_.end_timestamp_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::metricsys::Pagination, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::Pagination, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::Pagination, _impl_.offset_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::metricsys::EventCursor, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::EventCursor, _impl_.timestamp_us_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::EventCursor, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.page_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.referrer_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PageViewEvent, _impl_.received_at_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.time_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.page_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsRequest, _impl_.allow_segments_),
+  2,
+  3,
+  0,
+  1,
+  4,
+  5,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPageViewsResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.page_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.element_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.action_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ClickEvent, _impl_.received_at_),
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.time_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.page_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.element_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksRequest, _impl_.allow_segments_),
+  3,
+  4,
+  0,
+  1,
+  2,
+  5,
+  6,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetClicksResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.page_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.ttfb_ms_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.fcp_ms_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.lcp_ms_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.total_page_load_ms_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::PerformanceEvent, _impl_.received_at_),
+  ~0u,
+  ~0u,
+  2,
+  3,
+  4,
+  5,
+  0,
+  1,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.time_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.page_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceRequest, _impl_.allow_segments_),
+  2,
+  3,
+  0,
+  1,
+  4,
+  5,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetPerformanceResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.page_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.error_type_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.stack_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.severity_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::ErrorEvent, _impl_.received_at_),
+  ~0u,
+  ~0u,
+  ~0u,
+  ~0u,
+  0,
+  ~0u,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.time_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.page_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.severity_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.error_type_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsRequest, _impl_.allow_segments_),
+  3,
+  4,
+  0,
+  7,
+  1,
+  2,
+  5,
+  6,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetErrorsResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent_PropertiesEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent_PropertiesEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent_PropertiesEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent_PropertiesEntry_DoNotUse, value_),
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.page_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.session_id_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.properties_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.timestamp_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::CustomEvent, _impl_.received_at_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  2,
+  ~0u,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.time_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.pagination_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.name_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.page_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.user_id_filter_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.after_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.received_range_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsRequest, _impl_.allow_segments_),
+  3,
+  4,
+  0,
+  1,
+  2,
+  5,
+  6,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_.total_count_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_.next_cursor_),
+  PROTOBUF_FIELD_OFFSET(::metricsys::GetCustomEventsResponse, _impl_.received_until_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::metricsys::TimeRange)},
+  { 8, -1, -1, sizeof(::metricsys::Pagination)},
+  { 16, -1, -1, sizeof(::metricsys::EventCursor)},
+  { 24, 37, -1, sizeof(::metricsys::PageViewEvent)},
+  { 44, 57, -1, sizeof(::metricsys::GetPageViewsRequest)},
+  { 64, 74, -1, sizeof(::metricsys::GetPageViewsResponse)},
+  { 78, 92, -1, sizeof(::metricsys::ClickEvent)},
+  { 100, 114, -1, sizeof(::metricsys::GetClicksRequest)},
+  { 122, 132, -1, sizeof(::metricsys::GetClicksResponse)},
+  { 136, 152, -1, sizeof(::metricsys::PerformanceEvent)},
+  { 162, 175, -1, sizeof(::metricsys::GetPerformanceRequest)},
+  { 182, 192, -1, sizeof(::metricsys::GetPerformanceResponse)},
+  { 196, 212, -1, sizeof(::metricsys::ErrorEvent)},
+  { 222, 237, -1, sizeof(::metricsys::GetErrorsRequest)},
+  { 246, 256, -1, sizeof(::metricsys::GetErrorsResponse)},
+  { 260, 268, -1, sizeof(::metricsys::CustomEvent_PropertiesEntry_DoNotUse)},
+  { 270, 284, -1, sizeof(::metricsys::CustomEvent)},
+  { 292, 306, -1, sizeof(::metricsys::GetCustomEventsRequest)},
+  { 314, 324, -1, sizeof(::metricsys::GetCustomEventsResponse)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::metricsys::_TimeRange_default_instance_._instance,
+  &::metricsys::_Pagination_default_instance_._instance,
+  &::metricsys::_EventCursor_default_instance_._instance,
+  &::metricsys::_PageViewEvent_default_instance_._instance,
+  &::metricsys::_GetPageViewsRequest_default_instance_._instance,
+  &::metricsys::_GetPageViewsResponse_default_instance_._instance,
+  &::metricsys::_ClickEvent_default_instance_._instance,
+  &::metricsys::_GetClicksRequest_default_instance_._instance,
+  &::metricsys::_GetClicksResponse_default_instance_._instance,
+  &::metricsys::_PerformanceEvent_default_instance_._instance,
+  &::metricsys::_GetPerformanceRequest_default_instance_._instance,
+  &::metricsys::_GetPerformanceResponse_default_instance_._instance,
+  &::metricsys::_ErrorEvent_default_instance_._instance,
+  &::metricsys::_GetErrorsRequest_default_instance_._instance,
+  &::metricsys::_GetErrorsResponse_default_instance_._instance,
+  &::metricsys::_CustomEvent_PropertiesEntry_DoNotUse_default_instance_._instance,
+  &::metricsys::_CustomEvent_default_instance_._instance,
+  &::metricsys::_GetCustomEventsRequest_default_instance_._instance,
+  &::metricsys::_GetCustomEventsResponse_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_metrics_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\rmetrics.proto\022\tmetricsys\";\n\tTimeRange\022"
+  "\027\n\017start_timestamp\030\001 \001(\003\022\025\n\rend_timestam"
+  "p\030\002 \001(\003\"+\n\nPagination\022\r\n\005limit\030\001 \001(\005\022\016\n\006"
+  "offset\030\002 \001(\005\"/\n\013EventCursor\022\024\n\014timestamp"
+  "_us\030\001 \001(\003\022\n\n\002id\030\002 \001(\t\"\277\001\n\rPageViewEvent\022"
+  "\n\n\002id\030\001 \001(\t\022\014\n\004page\030\002 \001(\t\022\024\n\007user_id\030\003 \001"
+  "(\tH\000\210\001\001\022\027\n\nsession_id\030\004 \001(\tH\001\210\001\001\022\025\n\010refe"
+  "rrer\030\005 \001(\tH\002\210\001\001\022\021\n\ttimestamp\030\006 \001(\003\022\023\n\013re"
+  "ceived_at\030\007 \001(\003B\n\n\010_user_idB\r\n\013_session_"
+  "idB\013\n\t_referrer\"\200\003\n\023GetPageViewsRequest\022"
+  "-\n\ntime_range\030\001 \001(\0132\024.metricsys.TimeRang"
+  "eH\000\210\001\001\022.\n\npagination\030\002 \001(\0132\025.metricsys.P"
+  "aginationH\001\210\001\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001"
+  "\022\033\n\016user_id_filter\030\004 \001(\tH\003\210\001\001\022*\n\005after\030\005"
+  " \001(\0132\026.metricsys.EventCursorH\004\210\001\001\0221\n\016rec"
+  "eived_range\030\006 \001(\0132\024.metricsys.TimeRangeH"
+  "\005\210\001\001\022\026\n\016allow_segments\030\007 \001(\010B\r\n\013_time_ra"
+  "ngeB\r\n\013_paginationB\016\n\014_page_filterB\021\n\017_u"
+  "ser_id_filterB\010\n\006_afterB\021\n\017_received_ran"
+  "ge\"\307\001\n\024GetPageViewsResponse\022(\n\006events\030\001 "
+  "\003(\0132\030.metricsys.PageViewEvent\022\023\n\013total_c"
+  "ount\030\002 \001(\005\0220\n\013next_cursor\030\003 \001(\0132\026.metric"
+  "sys.EventCursorH\000\210\001\001\022\033\n\016received_until\030\004"
+  " \001(\003H\001\210\001\001B\016\n\014_next_cursorB\021\n\017_received_u"
+  "ntil\"\314\001\n\nClickEvent\022\n\n\002id\030\001 \001(\t\022\014\n\004page\030"
+  "\002 \001(\t\022\022\n\nelement_id\030\003 \001(\t\022\023\n\006action\030\004 \001("
+  "\tH\000\210\001\001\022\024\n\007user_id\030\005 \001(\tH\001\210\001\001\022\027\n\nsession_"
+  "id\030\006 \001(\tH\002\210\001\001\022\021\n\ttimestamp\030\007 \001(\003\022\023\n\013rece"
+  "ived_at\030\010 \001(\003B\t\n\007_actionB\n\n\010_user_idB\r\n\013"
+  "_session_id\"\263\003\n\020GetClicksRequest\022-\n\ntime"
+  "_range\030\001 \001(\0132\024.metricsys.TimeRangeH\000\210\001\001\022"
+  ".\n\npagination\030\002 \001(\0132\025.metricsys.Paginati"
+  "onH\001\210\001\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001\022\036\n\021ele"
+  "ment_id_filter\030\004 \001(\tH\003\210\001\001\022\033\n\016user_id_fil"
+  "ter\030\005 \001(\tH\004\210\001\001\022*\n\005after\030\006 \001(\0132\026.metricsy"
+  "s.EventCursorH\005\210\001\001\0221\n\016received_range\030\007 \001"
+  "(\0132\024.metricsys.TimeRangeH\006\210\001\001\022\026\n\016allow_s"
+  "egments\030\010 \001(\010B\r\n\013_time_rangeB\r\n\013_paginat"
+  "ionB\016\n\014_page_filterB\024\n\022_element_id_filte"
+  "rB\021\n\017_user_id_filterB\010\n\006_afterB\021\n\017_recei"
+  "ved_range\"\301\001\n\021GetClicksResponse\022%\n\006event"
+  "s\030\001 \003(\0132\025.metricsys.ClickEvent\022\023\n\013total_"
+  "count\030\002 \001(\005\0220\n\013next_cursor\030\003 \001(\0132\026.metri"
+  "csys.EventCursorH\000\210\001\001\022\033\n\016received_until\030"
+  "\004 \001(\003H\001\210\001\001B\016\n\014_next_cursorB\021\n\017_received_"
+  "until\"\270\002\n\020PerformanceEvent\022\n\n\002id\030\001 \001(\t\022\014"
+  "\n\004page\030\002 \001(\t\022\024\n\007ttfb_ms\030\003 \001(\001H\000\210\001\001\022\023\n\006fc"
+  "p_ms\030\004 \001(\001H\001\210\001\001\022\023\n\006lcp_ms\030\005 \001(\001H\002\210\001\001\022\037\n\022"
+  "total_page_load_ms\030\006 \001(\001H\003\210\001\001\022\024\n\007user_id"
+  "\030\007 \001(\tH\004\210\001\001\022\027\n\nsession_id\030\010 \001(\tH\005\210\001\001\022\021\n\t"
+  "timestamp\030\t \001(\003\022\023\n\013received_at\030\n \001(\003B\n\n\010"
+  "_ttfb_msB\t\n\007_fcp_msB\t\n\007_lcp_msB\025\n\023_total"
+  "_page_load_msB\n\n\010_user_idB\r\n\013_session_id"
+  "\"\202\003\n\025GetPerformanceRequest\022-\n\ntime_range"
+  "\030\001 \001(\0132\024.metricsys.TimeRangeH\000\210\001\001\022.\n\npag"
+  "ination\030\002 \001(\0132\025.metricsys.PaginationH\001\210\001"
+  "\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001\022\033\n\016user_id_f"
+  "ilter\030\004 \001(\tH\003\210\001\001\022*\n\005after\030\005 \001(\0132\026.metric"
+  "sys.EventCursorH\004\210\001\001\0221\n\016received_range\030\006"
+  " \001(\0132\024.metricsys.TimeRangeH\005\210\001\001\022\026\n\016allow"
+  "_segments\030\007 \001(\010B\r\n\013_time_rangeB\r\n\013_pagin"
+  "ationB\016\n\014_page_filterB\021\n\017_user_id_filter"
+  "B\010\n\006_afterB\021\n\017_received_range\"\314\001\n\026GetPer"
+  "formanceResponse\022+\n\006events\030\001 \003(\0132\033.metri"
+  "csys.PerformanceEvent\022\023\n\013total_count\030\002 \001"
+  "(\005\0220\n\013next_cursor\030\003 \001(\0132\026.metricsys.Even"
+  "tCursorH\000\210\001\001\022\033\n\016received_until\030\004 \001(\003H\001\210\001"
+  "\001B\016\n\014_next_cursorB\021\n\017_received_until\"\202\002\n"
+  "\nErrorEvent\022\n\n\002id\030\001 \001(\t\022\014\n\004page\030\002 \001(\t\022\022\n"
+  "\nerror_type\030\003 \001(\t\022\017\n\007message\030\004 \001(\t\022\022\n\005st"
+  "ack\030\005 \001(\tH\000\210\001\001\022%\n\010severity\030\006 \001(\0162\023.metri"
+  "csys.Severity\022\024\n\007user_id\030\007 \001(\tH\001\210\001\001\022\027\n\ns"
+  "ession_id\030\010 \001(\tH\002\210\001\001\022\021\n\ttimestamp\030\t \001(\003\022"
+  "\023\n\013received_at\030\n \001(\003B\010\n\006_stackB\n\n\010_user_"
+  "idB\r\n\013_session_id\"\372\003\n\020GetErrorsRequest\022-"
+  "\n\ntime_range\030\001 \001(\0132\024.metricsys.TimeRange"
+  "H\000\210\001\001\022.\n\npagination\030\002 \001(\0132\025.metricsys.Pa"
+  "ginationH\001\210\001\001\022\030\n\013page_filter\030\003 \001(\tH\002\210\001\001\022"
+  "1\n\017severity_filter\030\004 \001(\0162\023.metricsys.Sev"
+  "erityH\003\210\001\001\022\036\n\021error_type_filter\030\005 \001(\tH\004\210"
+  "\001\001\022\033\n\016user_id_filter\030\006 \001(\tH\005\210\001\001\022*\n\005after"
+  "\030\007 \001(\0132\026.metricsys.EventCursorH\006\210\001\001\0221\n\016r"
+  "eceived_range\030\010 \001(\0132\024.metricsys.TimeRang"
+  "eH\007\210\001\001\022\026\n\016allow_segments\030\t \001(\010B\r\n\013_time_"
+  "rangeB\r\n\013_paginationB\016\n\014_page_filterB\022\n\020"
+  "_severity_filterB\024\n\022_error_type_filterB\021"
+  "\n\017_user_id_filterB\010\n\006_afterB\021\n\017_received"
+  "_range\"\301\001\n\021GetErrorsResponse\022%\n\006events\030\001"
+  " \003(\0132\025.metricsys.ErrorEvent\022\023\n\013total_cou"
+  "nt\030\002 \001(\005\0220\n\013next_cursor\030\003 \001(\0132\026.metricsy"
+  "s.EventCursorH\000\210\001\001\022\033\n\016received_until\030\004 \001"
+  "(\003H\001\210\001\001B\016\n\014_next_cursorB\021\n\017_received_unt"
+  "il\"\244\002\n\013CustomEvent\022\n\n\002id\030\001 \001(\t\022\014\n\004name\030\002"
+  " \001(\t\022\021\n\004page\030\003 \001(\tH\000\210\001\001\022\024\n\007user_id\030\004 \001(\t"
+  "H\001\210\001\001\022\027\n\nsession_id\030\005 \001(\tH\002\210\001\001\022:\n\nproper"
+  "ties\030\006 \003(\0132&.metricsys.CustomEvent.Prope"
+  "rtiesEntry\022\021\n\ttimestamp\030\007 \001(\003\022\023\n\013receive"
+  "d_at\030\010 \001(\003\0321\n\017PropertiesEntry\022\013\n\003key\030\001 \001"
+  "(\t\022\r\n\005value\030\002 \001(\t:\0028\001B\007\n\005_pageB\n\n\010_user_"
+  "idB\r\n\013_session_id\"\255\003\n\026GetCustomEventsReq"
+  "uest\022-\n\ntime_range\030\001 \001(\0132\024.metricsys.Tim"
+  "eRangeH\000\210\001\001\022.\n\npagination\030\002 \001(\0132\025.metric"
+  "sys.PaginationH\001\210\001\001\022\030\n\013name_filter\030\003 \001(\t"
+  "H\002\210\001\001\022\030\n\013page_filter\030\004 \001(\tH\003\210\001\001\022\033\n\016user_"
+  "id_filter\030\005 \001(\tH\004\210\001\001\022*\n\005after\030\006 \001(\0132\026.me"
+  "tricsys.EventCursorH\005\210\001\001\0221\n\016received_ran"
+  "ge\030\007 \001(\0132\024.metricsys.TimeRangeH\006\210\001\001\022\026\n\016a"
+  "llow_segments\030\010 \001(\010B\r\n\013_time_rangeB\r\n\013_p"
+  "aginationB\016\n\014_name_filterB\016\n\014_page_filte"
+  "rB\021\n\017_user_id_filterB\010\n\006_afterB\021\n\017_recei"
+  "ved_range\"\310\001\n\027GetCustomEventsResponse\022&\n"
+  "\006events\030\001 \003(\0132\026.metricsys.CustomEvent\022\023\n"
+  "\013total_count\030\002 \001(\005\0220\n\013next_cursor\030\003 \001(\0132"
+  "\026.metricsys.EventCursorH\000\210\001\001\022\033\n\016received"
+  "_until\030\004 \001(\003H\001\210\001\001B\016\n\014_next_cursorB\021\n\017_re"
+  "ceived_until*e\n\010Severity\022\030\n\024SEVERITY_UNS"
+  "PECIFIED\020\000\022\024\n\020SEVERITY_WARNING\020\001\022\022\n\016SEVE"
+  "RITY_ERROR\020\002\022\025\n\021SEVERITY_CRITICAL\020\0032\315\006\n\016"
+  "MetricsService\022O\n\014GetPageViews\022\036.metrics"
+  "ys.GetPageViewsRequest\032\037.metricsys.GetPa"
+  "geViewsResponse\022F\n\tGetClicks\022\033.metricsys"
+  ".GetClicksRequest\032\034.metricsys.GetClicksR"
+  "esponse\022U\n\016GetPerformance\022 .metricsys.Ge"
+  "tPerformanceRequest\032!.metricsys.GetPerfo"
+  "rmanceResponse\022F\n\tGetErrors\022\033.metricsys."
+  "GetErrorsRequest\032\034.metricsys.GetErrorsRe"
+  "sponse\022X\n\017GetCustomEvents\022!.metricsys.Ge"
+  "tCustomEventsRequest\032\".metricsys.GetCust"
+  "omEventsResponse\022T\n\017StreamPageViews\022\036.me"
+  "tricsys.GetPageViewsRequest\032\037.metricsys."
+  "GetPageViewsResponse0\001\022K\n\014StreamClicks\022\033"
+  ".metricsys.GetClicksRequest\032\034.metricsys."
+  "GetClicksResponse0\001\022Z\n\021StreamPerformance"
+  "\022 .metricsys.GetPerformanceRequest\032!.met"
+  "ricsys.GetPerformanceResponse0\001\022K\n\014Strea"
+  "mErrors\022\033.metricsys.GetErrorsRequest\032\034.m"
+  "etricsys.GetErrorsResponse0\001\022]\n\022StreamCu"
+  "stomEvents\022!.metricsys.GetCustomEventsRe"
+  "quest\032\".metricsys.GetCustomEventsRespons"
+  "e0\001b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_metrics_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_metrics_2eproto = {
+    false, false, 5571, descriptor_table_protodef_metrics_2eproto,
+    "metrics.proto",
+    &descriptor_table_metrics_2eproto_once, nullptr, 0, 19,
+    schemas, file_default_instances, TableStruct_metrics_2eproto::offsets,
+    file_level_metadata_metrics_2eproto, file_level_enum_descriptors_metrics_2eproto,
+    file_level_service_descriptors_metrics_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_metrics_2eproto_getter() {
+  return &descriptor_table_metrics_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_metrics_2eproto(&descriptor_table_metrics_2eproto);
+namespace metricsys {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Severity_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_metrics_2eproto);
+  return file_level_enum_descriptors_metrics_2eproto[0];
+}
+bool Severity_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class TimeRange::_Internal {
+ public:
+};
+
+TimeRange::TimeRange(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.TimeRange)
+}
+TimeRange::TimeRange(const TimeRange& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TimeRange* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_timestamp_){}
+    , decltype(_impl_.end_timestamp_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.start_timestamp_, &from._impl_.start_timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.end_timestamp_) -
+    reinterpret_cast<char*>(&_impl_.start_timestamp_)) + sizeof(_impl_.end_timestamp_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.TimeRange)
+}
+
+inline void TimeRange::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.start_timestamp_){int64_t{0}}
+    , decltype(_impl_.end_timestamp_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TimeRange::~TimeRange() {
+  // @@protoc_insertion_point(destructor:metricsys.TimeRange)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TimeRange::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void TimeRange::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TimeRange::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.TimeRange)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.start_timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.end_timestamp_) -
+      reinterpret_cast<char*>(&_impl_.start_timestamp_)) + sizeof(_impl_.end_timestamp_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TimeRange::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 start_timestamp = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.start_timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 end_timestamp = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.end_timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TimeRange::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.TimeRange)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 start_timestamp = 1;
+  if (this->_internal_start_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_start_timestamp(), target);
+  }
+
+  // int64 end_timestamp = 2;
+  if (this->_internal_end_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(2, this->_internal_end_timestamp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.TimeRange)
+  return target;
+}
+
+size_t TimeRange::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.TimeRange)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int64 start_timestamp = 1;
+  if (this->_internal_start_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_start_timestamp());
+  }
+
+  // int64 end_timestamp = 2;
+  if (this->_internal_end_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_end_timestamp());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TimeRange::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TimeRange::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TimeRange::GetClassData() const { return &_class_data_; }
+
+
+void TimeRange::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TimeRange*>(&to_msg);
+  auto& from = static_cast<const TimeRange&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.TimeRange)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_start_timestamp() != 0) {
+    _this->_internal_set_start_timestamp(from._internal_start_timestamp());
+  }
+  if (from._internal_end_timestamp() != 0) {
+    _this->_internal_set_end_timestamp(from._internal_end_timestamp());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TimeRange::CopyFrom(const TimeRange& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.TimeRange)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TimeRange::IsInitialized() const {
+  return true;
+}
+
+void TimeRange::InternalSwap(TimeRange* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TimeRange, _impl_.end_timestamp_)
+      + sizeof(TimeRange::_impl_.end_timestamp_)
+      - PROTOBUF_FIELD_OFFSET(TimeRange, _impl_.start_timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.start_timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.start_timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TimeRange::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[0]);
+}
+
+// ===================================================================
+
+class Pagination::_Internal {
+ public:
+};
+
+Pagination::Pagination(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.Pagination)
+}
+Pagination::Pagination(const Pagination& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Pagination* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.limit_){}
+    , decltype(_impl_.offset_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.limit_, &from._impl_.limit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.Pagination)
+}
+
+inline void Pagination::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.limit_){0}
+    , decltype(_impl_.offset_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Pagination::~Pagination() {
+  // @@protoc_insertion_point(destructor:metricsys.Pagination)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Pagination::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Pagination::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Pagination::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.Pagination)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.limit_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.offset_) -
+      reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.offset_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Pagination::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 limit = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 offset = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Pagination::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.Pagination)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 limit = 1;
+  if (this->_internal_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_limit(), target);
+  }
+
+  // int32 offset = 2;
+  if (this->_internal_offset() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_offset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.Pagination)
+  return target;
+}
+
+size_t Pagination::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.Pagination)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 limit = 1;
+  if (this->_internal_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_limit());
+  }
+
+  // int32 offset = 2;
+  if (this->_internal_offset() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_offset());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Pagination::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Pagination::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Pagination::GetClassData() const { return &_class_data_; }
+
+
+void Pagination::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Pagination*>(&to_msg);
+  auto& from = static_cast<const Pagination&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.Pagination)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_limit() != 0) {
+    _this->_internal_set_limit(from._internal_limit());
+  }
+  if (from._internal_offset() != 0) {
+    _this->_internal_set_offset(from._internal_offset());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Pagination::CopyFrom(const Pagination& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.Pagination)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Pagination::IsInitialized() const {
+  return true;
+}
+
+void Pagination::InternalSwap(Pagination* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Pagination, _impl_.offset_)
+      + sizeof(Pagination::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(Pagination, _impl_.limit_)>(
+          reinterpret_cast<char*>(&_impl_.limit_),
+          reinterpret_cast<char*>(&other->_impl_.limit_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Pagination::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[1]);
+}
+
+// ===================================================================
+
+class EventCursor::_Internal {
+ public:
+};
+
+EventCursor::EventCursor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.EventCursor)
+}
+EventCursor::EventCursor(const EventCursor& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EventCursor* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.timestamp_us_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.timestamp_us_ = from._impl_.timestamp_us_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.EventCursor)
+}
+
+inline void EventCursor::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.id_){}
+    , decltype(_impl_.timestamp_us_){int64_t{0}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+EventCursor::~EventCursor() {
+  // @@protoc_insertion_point(destructor:metricsys.EventCursor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EventCursor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+}
+
+void EventCursor::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EventCursor::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.EventCursor)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.timestamp_us_ = int64_t{0};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EventCursor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int64 timestamp_us = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.timestamp_us_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.EventCursor.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EventCursor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.EventCursor)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int64 timestamp_us = 1;
+  if (this->_internal_timestamp_us() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(1, this->_internal_timestamp_us(), target);
+  }
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.EventCursor.id");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.EventCursor)
+  return target;
+}
+
+size_t EventCursor::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.EventCursor)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 2;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // int64 timestamp_us = 1;
+  if (this->_internal_timestamp_us() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp_us());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EventCursor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EventCursor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EventCursor::GetClassData() const { return &_class_data_; }
+
+
+void EventCursor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EventCursor*>(&to_msg);
+  auto& from = static_cast<const EventCursor&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.EventCursor)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_timestamp_us() != 0) {
+    _this->_internal_set_timestamp_us(from._internal_timestamp_us());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EventCursor::CopyFrom(const EventCursor& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.EventCursor)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EventCursor::IsInitialized() const {
+  return true;
+}
+
+void EventCursor::InternalSwap(EventCursor* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  swap(_impl_.timestamp_us_, other->_impl_.timestamp_us_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EventCursor::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[2]);
+}
+
+// ===================================================================
+
+class PageViewEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PageViewEvent>()._impl_._has_bits_);
+  static void set_has_user_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_session_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_referrer(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+PageViewEvent::PageViewEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.PageViewEvent)
+}
+PageViewEvent::PageViewEvent(const PageViewEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PageViewEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.referrer_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_page().empty()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id()) {
+    _this->_impl_.user_id_.Set(from._internal_user_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_session_id()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.referrer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.referrer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_referrer()) {
+    _this->_impl_.referrer_.Set(from._internal_referrer(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.received_at_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.PageViewEvent)
+}
+
+inline void PageViewEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.referrer_){}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.referrer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.referrer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PageViewEvent::~PageViewEvent() {
+  // @@protoc_insertion_point(destructor:metricsys.PageViewEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PageViewEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.page_.Destroy();
+  _impl_.user_id_.Destroy();
+  _impl_.session_id_.Destroy();
+  _impl_.referrer_.Destroy();
+}
+
+void PageViewEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PageViewEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.PageViewEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.page_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.user_id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.session_id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.referrer_.ClearNonDefaultToEmpty();
+    }
+  }
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.received_at_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PageViewEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PageViewEvent.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string page = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PageViewEvent.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_user_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PageViewEvent.user_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string session_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PageViewEvent.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string referrer = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_referrer();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PageViewEvent.referrer"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 received_at = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PageViewEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.PageViewEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PageViewEvent.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string page = 2;
+  if (!this->_internal_page().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PageViewEvent.page");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_page(), target);
+  }
+
+  // optional string user_id = 3;
+  if (_internal_has_user_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id().data(), static_cast<int>(this->_internal_user_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PageViewEvent.user_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_user_id(), target);
+  }
+
+  // optional string session_id = 4;
+  if (_internal_has_session_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PageViewEvent.session_id");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_session_id(), target);
+  }
+
+  // optional string referrer = 5;
+  if (_internal_has_referrer()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_referrer().data(), static_cast<int>(this->_internal_referrer().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PageViewEvent.referrer");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_referrer(), target);
+  }
+
+  // int64 timestamp = 6;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(6, this->_internal_timestamp(), target);
+  }
+
+  // int64 received_at = 7;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_received_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.PageViewEvent)
+  return target;
+}
+
+size_t PageViewEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.PageViewEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string page = 2;
+  if (!this->_internal_page().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string user_id = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id());
+    }
+
+    // optional string session_id = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_session_id());
+    }
+
+    // optional string referrer = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_referrer());
+    }
+
+  }
+  // int64 timestamp = 6;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // int64 received_at = 7;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PageViewEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PageViewEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PageViewEvent::GetClassData() const { return &_class_data_; }
+
+
+void PageViewEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PageViewEvent*>(&to_msg);
+  auto& from = static_cast<const PageViewEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.PageViewEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_page().empty()) {
+    _this->_internal_set_page(from._internal_page());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_user_id(from._internal_user_id());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_session_id(from._internal_session_id());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_referrer(from._internal_referrer());
+    }
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PageViewEvent::CopyFrom(const PageViewEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.PageViewEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PageViewEvent::IsInitialized() const {
+  return true;
+}
+
+void PageViewEvent::InternalSwap(PageViewEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_, lhs_arena,
+      &other->_impl_.user_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.referrer_, lhs_arena,
+      &other->_impl_.referrer_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PageViewEvent, _impl_.received_at_)
+      + sizeof(PageViewEvent::_impl_.received_at_)
+      - PROTOBUF_FIELD_OFFSET(PageViewEvent, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PageViewEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[3]);
+}
+
+// ===================================================================
+
+class GetPageViewsRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetPageViewsRequest>()._impl_._has_bits_);
+  static const ::metricsys::TimeRange& time_range(const GetPageViewsRequest* msg);
+  static void set_has_time_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::metricsys::Pagination& pagination(const GetPageViewsRequest* msg);
+  static void set_has_pagination(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_page_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_user_id_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::metricsys::EventCursor& after(const GetPageViewsRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetPageViewsRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+const ::metricsys::TimeRange&
+GetPageViewsRequest::_Internal::time_range(const GetPageViewsRequest* msg) {
+  return *msg->_impl_.time_range_;
+}
+const ::metricsys::Pagination&
+GetPageViewsRequest::_Internal::pagination(const GetPageViewsRequest* msg) {
+  return *msg->_impl_.pagination_;
+}
+const ::metricsys::EventCursor&
+GetPageViewsRequest::_Internal::after(const GetPageViewsRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetPageViewsRequest::_Internal::received_range(const GetPageViewsRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
+GetPageViewsRequest::GetPageViewsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetPageViewsRequest)
+}
+GetPageViewsRequest::GetPageViewsRequest(const GetPageViewsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetPageViewsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page_filter()) {
+    _this->_impl_.page_filter_.Set(from._internal_page_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id_filter()) {
+    _this->_impl_.user_id_filter_.Set(from._internal_user_id_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_impl_.time_range_ = new ::metricsys::TimeRange(*from._impl_.time_range_);
+  }
+  if (from._internal_has_pagination()) {
+    _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
+  }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  _this->_impl_.allow_segments_ = from._impl_.allow_segments_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetPageViewsRequest)
+}
+
+inline void GetPageViewsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){false}
+  };
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetPageViewsRequest::~GetPageViewsRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.GetPageViewsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetPageViewsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.page_filter_.Destroy();
+  _impl_.user_id_filter_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_range_;
+  if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
+}
+
+void GetPageViewsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetPageViewsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetPageViewsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.page_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.user_id_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.time_range_ != nullptr);
+      _impl_.time_range_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
+      _impl_.pagination_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
+  }
+  _impl_.allow_segments_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetPageViewsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .metricsys.TimeRange time_range = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.Pagination pagination = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page_filter = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_page_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetPageViewsRequest.page_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id_filter = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_user_id_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetPageViewsRequest.user_id_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor after = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetPageViewsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetPageViewsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional .metricsys.TimeRange time_range = 1;
+  if (_internal_has_time_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time_range(this),
+        _Internal::time_range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.Pagination pagination = 2;
+  if (_internal_has_pagination()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pagination(this),
+        _Internal::pagination(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string page_filter = 3;
+  if (_internal_has_page_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page_filter().data(), static_cast<int>(this->_internal_page_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetPageViewsRequest.page_filter");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_page_filter(), target);
+  }
+
+  // optional string user_id_filter = 4;
+  if (_internal_has_user_id_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id_filter().data(), static_cast<int>(this->_internal_user_id_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetPageViewsRequest.user_id_filter");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_user_id_filter(), target);
+  }
+
+  // optional .metricsys.EventCursor after = 5;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 6;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 7;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_allow_segments(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetPageViewsRequest)
+  return target;
+}
+
+size_t GetPageViewsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetPageViewsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string page_filter = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_page_filter());
+    }
+
+    // optional string user_id_filter = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id_filter());
+    }
+
+    // optional .metricsys.TimeRange time_range = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.time_range_);
+    }
+
+    // optional .metricsys.Pagination pagination = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pagination_);
+    }
+
+    // optional .metricsys.EventCursor after = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
+  }
+  // bool allow_segments = 7;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetPageViewsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetPageViewsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetPageViewsRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetPageViewsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetPageViewsRequest*>(&to_msg);
+  auto& from = static_cast<const GetPageViewsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetPageViewsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_page_filter(from._internal_page_filter());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_user_id_filter(from._internal_user_id_filter());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_time_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_time_range());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
+          from._internal_pagination());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetPageViewsRequest::CopyFrom(const GetPageViewsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetPageViewsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetPageViewsRequest::IsInitialized() const {
+  return true;
+}
+
+void GetPageViewsRequest::InternalSwap(GetPageViewsRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_filter_, lhs_arena,
+      &other->_impl_.page_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_filter_, lhs_arena,
+      &other->_impl_.user_id_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetPageViewsRequest, _impl_.allow_segments_)
+      + sizeof(GetPageViewsRequest::_impl_.allow_segments_)
+      - PROTOBUF_FIELD_OFFSET(GetPageViewsRequest, _impl_.time_range_)>(
+          reinterpret_cast<char*>(&_impl_.time_range_),
+          reinterpret_cast<char*>(&other->_impl_.time_range_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetPageViewsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[4]);
+}
+
+// ===================================================================
+
+class GetPageViewsResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetPageViewsResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetPageViewsResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::metricsys::EventCursor&
+GetPageViewsResponse::_Internal::next_cursor(const GetPageViewsResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
+GetPageViewsResponse::GetPageViewsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetPageViewsResponse)
+}
+GetPageViewsResponse::GetPageViewsResponse(const GetPageViewsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetPageViewsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetPageViewsResponse)
+}
+
+inline void GetPageViewsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
+  };
+}
+
+GetPageViewsResponse::~GetPageViewsResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.GetPageViewsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetPageViewsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
+}
+
+void GetPageViewsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetPageViewsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetPageViewsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
+  _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetPageViewsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .metricsys.PageViewEvent events = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 total_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetPageViewsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetPageViewsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .metricsys.PageViewEvent events = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
+  }
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetPageViewsResponse)
+  return target;
+}
+
+size_t GetPageViewsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetPageViewsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .metricsys.PageViewEvent events = 1;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetPageViewsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetPageViewsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetPageViewsResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetPageViewsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetPageViewsResponse*>(&to_msg);
+  auto& from = static_cast<const GetPageViewsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetPageViewsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_total_count() != 0) {
+    _this->_internal_set_total_count(from._internal_total_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetPageViewsResponse::CopyFrom(const GetPageViewsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetPageViewsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetPageViewsResponse::IsInitialized() const {
+  return true;
+}
+
+void GetPageViewsResponse::InternalSwap(GetPageViewsResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetPageViewsResponse, _impl_.total_count_)
+      + sizeof(GetPageViewsResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetPageViewsResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetPageViewsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[5]);
+}
+
+// ===================================================================
+
+class ClickEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ClickEvent>()._impl_._has_bits_);
+  static void set_has_action(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_user_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_session_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+ClickEvent::ClickEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.ClickEvent)
+}
+ClickEvent::ClickEvent(const ClickEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ClickEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.element_id_){}
+    , decltype(_impl_.action_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_page().empty()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.element_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.element_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_element_id().empty()) {
+    _this->_impl_.element_id_.Set(from._internal_element_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.action_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.action_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_action()) {
+    _this->_impl_.action_.Set(from._internal_action(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id()) {
+    _this->_impl_.user_id_.Set(from._internal_user_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_session_id()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.received_at_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.ClickEvent)
+}
+
+inline void ClickEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.element_id_){}
+    , decltype(_impl_.action_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.element_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.element_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.action_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.action_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ClickEvent::~ClickEvent() {
+  // @@protoc_insertion_point(destructor:metricsys.ClickEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ClickEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.page_.Destroy();
+  _impl_.element_id_.Destroy();
+  _impl_.action_.Destroy();
+  _impl_.user_id_.Destroy();
+  _impl_.session_id_.Destroy();
+}
+
+void ClickEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ClickEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.ClickEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.page_.ClearToEmpty();
+  _impl_.element_id_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.action_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.user_id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.session_id_.ClearNonDefaultToEmpty();
+    }
+  }
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.received_at_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ClickEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ClickEvent.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string page = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ClickEvent.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string element_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_element_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ClickEvent.element_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string action = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_action();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ClickEvent.action"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_user_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ClickEvent.user_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string session_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ClickEvent.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 received_at = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ClickEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.ClickEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ClickEvent.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string page = 2;
+  if (!this->_internal_page().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ClickEvent.page");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_page(), target);
+  }
+
+  // string element_id = 3;
+  if (!this->_internal_element_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_element_id().data(), static_cast<int>(this->_internal_element_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ClickEvent.element_id");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_element_id(), target);
+  }
+
+  // optional string action = 4;
+  if (_internal_has_action()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_action().data(), static_cast<int>(this->_internal_action().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ClickEvent.action");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_action(), target);
+  }
+
+  // optional string user_id = 5;
+  if (_internal_has_user_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id().data(), static_cast<int>(this->_internal_user_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ClickEvent.user_id");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_user_id(), target);
+  }
+
+  // optional string session_id = 6;
+  if (_internal_has_session_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ClickEvent.session_id");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_session_id(), target);
+  }
+
+  // int64 timestamp = 7;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_timestamp(), target);
+  }
+
+  // int64 received_at = 8;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_received_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.ClickEvent)
+  return target;
+}
+
+size_t ClickEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.ClickEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string page = 2;
+  if (!this->_internal_page().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
+  }
+
+  // string element_id = 3;
+  if (!this->_internal_element_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_element_id());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string action = 4;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_action());
+    }
+
+    // optional string user_id = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id());
+    }
+
+    // optional string session_id = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_session_id());
+    }
+
+  }
+  // int64 timestamp = 7;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // int64 received_at = 8;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ClickEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ClickEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ClickEvent::GetClassData() const { return &_class_data_; }
+
+
+void ClickEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ClickEvent*>(&to_msg);
+  auto& from = static_cast<const ClickEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.ClickEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_page().empty()) {
+    _this->_internal_set_page(from._internal_page());
+  }
+  if (!from._internal_element_id().empty()) {
+    _this->_internal_set_element_id(from._internal_element_id());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_action(from._internal_action());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_user_id(from._internal_user_id());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_session_id(from._internal_session_id());
+    }
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ClickEvent::CopyFrom(const ClickEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.ClickEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ClickEvent::IsInitialized() const {
+  return true;
+}
+
+void ClickEvent::InternalSwap(ClickEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.element_id_, lhs_arena,
+      &other->_impl_.element_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.action_, lhs_arena,
+      &other->_impl_.action_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_, lhs_arena,
+      &other->_impl_.user_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ClickEvent, _impl_.received_at_)
+      + sizeof(ClickEvent::_impl_.received_at_)
+      - PROTOBUF_FIELD_OFFSET(ClickEvent, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ClickEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[6]);
+}
+
+// ===================================================================
+
+class GetClicksRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetClicksRequest>()._impl_._has_bits_);
+  static const ::metricsys::TimeRange& time_range(const GetClicksRequest* msg);
+  static void set_has_time_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::metricsys::Pagination& pagination(const GetClicksRequest* msg);
+  static void set_has_pagination(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_page_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_element_id_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_user_id_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::metricsys::EventCursor& after(const GetClicksRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetClicksRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+const ::metricsys::TimeRange&
+GetClicksRequest::_Internal::time_range(const GetClicksRequest* msg) {
+  return *msg->_impl_.time_range_;
+}
+const ::metricsys::Pagination&
+GetClicksRequest::_Internal::pagination(const GetClicksRequest* msg) {
+  return *msg->_impl_.pagination_;
+}
+const ::metricsys::EventCursor&
+GetClicksRequest::_Internal::after(const GetClicksRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetClicksRequest::_Internal::received_range(const GetClicksRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
+GetClicksRequest::GetClicksRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetClicksRequest)
+}
+GetClicksRequest::GetClicksRequest(const GetClicksRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetClicksRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.element_id_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page_filter()) {
+    _this->_impl_.page_filter_.Set(from._internal_page_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.element_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.element_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_element_id_filter()) {
+    _this->_impl_.element_id_filter_.Set(from._internal_element_id_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id_filter()) {
+    _this->_impl_.user_id_filter_.Set(from._internal_user_id_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_impl_.time_range_ = new ::metricsys::TimeRange(*from._impl_.time_range_);
+  }
+  if (from._internal_has_pagination()) {
+    _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
+  }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  _this->_impl_.allow_segments_ = from._impl_.allow_segments_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetClicksRequest)
+}
+
+inline void GetClicksRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.element_id_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){false}
+  };
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.element_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.element_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetClicksRequest::~GetClicksRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.GetClicksRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetClicksRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.page_filter_.Destroy();
+  _impl_.element_id_filter_.Destroy();
+  _impl_.user_id_filter_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_range_;
+  if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
+}
+
+void GetClicksRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetClicksRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetClicksRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.page_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.element_id_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.user_id_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.time_range_ != nullptr);
+      _impl_.time_range_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
+      _impl_.pagination_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
+  }
+  _impl_.allow_segments_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetClicksRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .metricsys.TimeRange time_range = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.Pagination pagination = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page_filter = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_page_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetClicksRequest.page_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string element_id_filter = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_element_id_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetClicksRequest.element_id_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id_filter = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_user_id_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetClicksRequest.user_id_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor after = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetClicksRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetClicksRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional .metricsys.TimeRange time_range = 1;
+  if (_internal_has_time_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time_range(this),
+        _Internal::time_range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.Pagination pagination = 2;
+  if (_internal_has_pagination()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pagination(this),
+        _Internal::pagination(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string page_filter = 3;
+  if (_internal_has_page_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page_filter().data(), static_cast<int>(this->_internal_page_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetClicksRequest.page_filter");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_page_filter(), target);
+  }
+
+  // optional string element_id_filter = 4;
+  if (_internal_has_element_id_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_element_id_filter().data(), static_cast<int>(this->_internal_element_id_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetClicksRequest.element_id_filter");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_element_id_filter(), target);
+  }
+
+  // optional string user_id_filter = 5;
+  if (_internal_has_user_id_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id_filter().data(), static_cast<int>(this->_internal_user_id_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetClicksRequest.user_id_filter");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_user_id_filter(), target);
+  }
+
+  // optional .metricsys.EventCursor after = 6;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 7;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 8;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_allow_segments(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetClicksRequest)
+  return target;
+}
+
+size_t GetClicksRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetClicksRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional string page_filter = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_page_filter());
+    }
+
+    // optional string element_id_filter = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_element_id_filter());
+    }
+
+    // optional string user_id_filter = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id_filter());
+    }
+
+    // optional .metricsys.TimeRange time_range = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.time_range_);
+    }
+
+    // optional .metricsys.Pagination pagination = 2;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pagination_);
+    }
+
+    // optional .metricsys.EventCursor after = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
+  }
+  // bool allow_segments = 8;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetClicksRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetClicksRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClicksRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetClicksRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetClicksRequest*>(&to_msg);
+  auto& from = static_cast<const GetClicksRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetClicksRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_page_filter(from._internal_page_filter());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_element_id_filter(from._internal_element_id_filter());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_user_id_filter(from._internal_user_id_filter());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_time_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_time_range());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
+          from._internal_pagination());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetClicksRequest::CopyFrom(const GetClicksRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetClicksRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetClicksRequest::IsInitialized() const {
+  return true;
+}
+
+void GetClicksRequest::InternalSwap(GetClicksRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_filter_, lhs_arena,
+      &other->_impl_.page_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.element_id_filter_, lhs_arena,
+      &other->_impl_.element_id_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_filter_, lhs_arena,
+      &other->_impl_.user_id_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetClicksRequest, _impl_.allow_segments_)
+      + sizeof(GetClicksRequest::_impl_.allow_segments_)
+      - PROTOBUF_FIELD_OFFSET(GetClicksRequest, _impl_.time_range_)>(
+          reinterpret_cast<char*>(&_impl_.time_range_),
+          reinterpret_cast<char*>(&other->_impl_.time_range_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetClicksRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[7]);
+}
+
+// ===================================================================
+
+class GetClicksResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetClicksResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetClicksResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::metricsys::EventCursor&
+GetClicksResponse::_Internal::next_cursor(const GetClicksResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
+GetClicksResponse::GetClicksResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetClicksResponse)
+}
+GetClicksResponse::GetClicksResponse(const GetClicksResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetClicksResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetClicksResponse)
+}
+
+inline void GetClicksResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
+  };
+}
+
+GetClicksResponse::~GetClicksResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.GetClicksResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetClicksResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
+}
+
+void GetClicksResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetClicksResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetClicksResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
+  _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetClicksResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .metricsys.ClickEvent events = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 total_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetClicksResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetClicksResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .metricsys.ClickEvent events = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
+  }
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetClicksResponse)
+  return target;
+}
+
+size_t GetClicksResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetClicksResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .metricsys.ClickEvent events = 1;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetClicksResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetClicksResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClicksResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetClicksResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetClicksResponse*>(&to_msg);
+  auto& from = static_cast<const GetClicksResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetClicksResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_total_count() != 0) {
+    _this->_internal_set_total_count(from._internal_total_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetClicksResponse::CopyFrom(const GetClicksResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetClicksResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetClicksResponse::IsInitialized() const {
+  return true;
+}
+
+void GetClicksResponse::InternalSwap(GetClicksResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetClicksResponse, _impl_.total_count_)
+      + sizeof(GetClicksResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetClicksResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetClicksResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[8]);
+}
+
+// ===================================================================
+
+class PerformanceEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<PerformanceEvent>()._impl_._has_bits_);
+  static void set_has_ttfb_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_fcp_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_lcp_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_total_page_load_ms(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_user_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_session_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+PerformanceEvent::PerformanceEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.PerformanceEvent)
+}
+PerformanceEvent::PerformanceEvent(const PerformanceEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PerformanceEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.ttfb_ms_){}
+    , decltype(_impl_.fcp_ms_){}
+    , decltype(_impl_.lcp_ms_){}
+    , decltype(_impl_.total_page_load_ms_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_page().empty()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id()) {
+    _this->_impl_.user_id_.Set(from._internal_user_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_session_id()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.ttfb_ms_, &from._impl_.ttfb_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.received_at_) -
+    reinterpret_cast<char*>(&_impl_.ttfb_ms_)) + sizeof(_impl_.received_at_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.PerformanceEvent)
+}
+
+inline void PerformanceEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.ttfb_ms_){0}
+    , decltype(_impl_.fcp_ms_){0}
+    , decltype(_impl_.lcp_ms_){0}
+    , decltype(_impl_.total_page_load_ms_){0}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PerformanceEvent::~PerformanceEvent() {
+  // @@protoc_insertion_point(destructor:metricsys.PerformanceEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PerformanceEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.page_.Destroy();
+  _impl_.user_id_.Destroy();
+  _impl_.session_id_.Destroy();
+}
+
+void PerformanceEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PerformanceEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.PerformanceEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.page_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.user_id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.session_id_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.ttfb_ms_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.total_page_load_ms_) -
+        reinterpret_cast<char*>(&_impl_.ttfb_ms_)) + sizeof(_impl_.total_page_load_ms_));
+  }
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.received_at_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PerformanceEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PerformanceEvent.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string page = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PerformanceEvent.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double ttfb_ms = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_ttfb_ms(&has_bits);
+          _impl_.ttfb_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double fcp_ms = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_fcp_ms(&has_bits);
+          _impl_.fcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double lcp_ms = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_lcp_ms(&has_bits);
+          _impl_.lcp_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double total_page_load_ms = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_total_page_load_ms(&has_bits);
+          _impl_.total_page_load_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_user_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PerformanceEvent.user_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string session_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.PerformanceEvent.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 received_at = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PerformanceEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.PerformanceEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PerformanceEvent.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string page = 2;
+  if (!this->_internal_page().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PerformanceEvent.page");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_page(), target);
+  }
+
+  // optional double ttfb_ms = 3;
+  if (_internal_has_ttfb_ms()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_ttfb_ms(), target);
+  }
+
+  // optional double fcp_ms = 4;
+  if (_internal_has_fcp_ms()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_fcp_ms(), target);
+  }
+
+  // optional double lcp_ms = 5;
+  if (_internal_has_lcp_ms()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_lcp_ms(), target);
+  }
+
+  // optional double total_page_load_ms = 6;
+  if (_internal_has_total_page_load_ms()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_total_page_load_ms(), target);
+  }
+
+  // optional string user_id = 7;
+  if (_internal_has_user_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id().data(), static_cast<int>(this->_internal_user_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PerformanceEvent.user_id");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_user_id(), target);
+  }
+
+  // optional string session_id = 8;
+  if (_internal_has_session_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.PerformanceEvent.session_id");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_session_id(), target);
+  }
+
+  // int64 timestamp = 9;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_timestamp(), target);
+  }
+
+  // int64 received_at = 10;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_received_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.PerformanceEvent)
+  return target;
+}
+
+size_t PerformanceEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.PerformanceEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string page = 2;
+  if (!this->_internal_page().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string user_id = 7;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id());
+    }
+
+    // optional string session_id = 8;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_session_id());
+    }
+
+    // optional double ttfb_ms = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double fcp_ms = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double lcp_ms = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double total_page_load_ms = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  // int64 timestamp = 9;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // int64 received_at = 10;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PerformanceEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PerformanceEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PerformanceEvent::GetClassData() const { return &_class_data_; }
+
+
+void PerformanceEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PerformanceEvent*>(&to_msg);
+  auto& from = static_cast<const PerformanceEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.PerformanceEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_page().empty()) {
+    _this->_internal_set_page(from._internal_page());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_user_id(from._internal_user_id());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_session_id(from._internal_session_id());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.ttfb_ms_ = from._impl_.ttfb_ms_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.fcp_ms_ = from._impl_.fcp_ms_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.lcp_ms_ = from._impl_.lcp_ms_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.total_page_load_ms_ = from._impl_.total_page_load_ms_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PerformanceEvent::CopyFrom(const PerformanceEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.PerformanceEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PerformanceEvent::IsInitialized() const {
+  return true;
+}
+
+void PerformanceEvent::InternalSwap(PerformanceEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_, lhs_arena,
+      &other->_impl_.user_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PerformanceEvent, _impl_.received_at_)
+      + sizeof(PerformanceEvent::_impl_.received_at_)
+      - PROTOBUF_FIELD_OFFSET(PerformanceEvent, _impl_.ttfb_ms_)>(
+          reinterpret_cast<char*>(&_impl_.ttfb_ms_),
+          reinterpret_cast<char*>(&other->_impl_.ttfb_ms_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PerformanceEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[9]);
+}
+
+// ===================================================================
+
+class GetPerformanceRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetPerformanceRequest>()._impl_._has_bits_);
+  static const ::metricsys::TimeRange& time_range(const GetPerformanceRequest* msg);
+  static void set_has_time_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::metricsys::Pagination& pagination(const GetPerformanceRequest* msg);
+  static void set_has_pagination(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_page_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_user_id_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::metricsys::EventCursor& after(const GetPerformanceRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetPerformanceRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+const ::metricsys::TimeRange&
+GetPerformanceRequest::_Internal::time_range(const GetPerformanceRequest* msg) {
+  return *msg->_impl_.time_range_;
+}
+const ::metricsys::Pagination&
+GetPerformanceRequest::_Internal::pagination(const GetPerformanceRequest* msg) {
+  return *msg->_impl_.pagination_;
+}
+const ::metricsys::EventCursor&
+GetPerformanceRequest::_Internal::after(const GetPerformanceRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetPerformanceRequest::_Internal::received_range(const GetPerformanceRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
+GetPerformanceRequest::GetPerformanceRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetPerformanceRequest)
+}
+GetPerformanceRequest::GetPerformanceRequest(const GetPerformanceRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetPerformanceRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page_filter()) {
+    _this->_impl_.page_filter_.Set(from._internal_page_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id_filter()) {
+    _this->_impl_.user_id_filter_.Set(from._internal_user_id_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_impl_.time_range_ = new ::metricsys::TimeRange(*from._impl_.time_range_);
+  }
+  if (from._internal_has_pagination()) {
+    _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
+  }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  _this->_impl_.allow_segments_ = from._impl_.allow_segments_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetPerformanceRequest)
+}
+
+inline void GetPerformanceRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){false}
+  };
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetPerformanceRequest::~GetPerformanceRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.GetPerformanceRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetPerformanceRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.page_filter_.Destroy();
+  _impl_.user_id_filter_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_range_;
+  if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
+}
+
+void GetPerformanceRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetPerformanceRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetPerformanceRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.page_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.user_id_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.time_range_ != nullptr);
+      _impl_.time_range_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
+      _impl_.pagination_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
+  }
+  _impl_.allow_segments_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetPerformanceRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .metricsys.TimeRange time_range = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.Pagination pagination = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page_filter = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_page_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetPerformanceRequest.page_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id_filter = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_user_id_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetPerformanceRequest.user_id_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor after = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetPerformanceRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetPerformanceRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional .metricsys.TimeRange time_range = 1;
+  if (_internal_has_time_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time_range(this),
+        _Internal::time_range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.Pagination pagination = 2;
+  if (_internal_has_pagination()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pagination(this),
+        _Internal::pagination(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string page_filter = 3;
+  if (_internal_has_page_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page_filter().data(), static_cast<int>(this->_internal_page_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetPerformanceRequest.page_filter");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_page_filter(), target);
+  }
+
+  // optional string user_id_filter = 4;
+  if (_internal_has_user_id_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id_filter().data(), static_cast<int>(this->_internal_user_id_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetPerformanceRequest.user_id_filter");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_user_id_filter(), target);
+  }
+
+  // optional .metricsys.EventCursor after = 5;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 6;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 7;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(7, this->_internal_allow_segments(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetPerformanceRequest)
+  return target;
+}
+
+size_t GetPerformanceRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetPerformanceRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    // optional string page_filter = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_page_filter());
+    }
+
+    // optional string user_id_filter = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id_filter());
+    }
+
+    // optional .metricsys.TimeRange time_range = 1;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.time_range_);
+    }
+
+    // optional .metricsys.Pagination pagination = 2;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pagination_);
+    }
+
+    // optional .metricsys.EventCursor after = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
+  }
+  // bool allow_segments = 7;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetPerformanceRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetPerformanceRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetPerformanceRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetPerformanceRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetPerformanceRequest*>(&to_msg);
+  auto& from = static_cast<const GetPerformanceRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetPerformanceRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_page_filter(from._internal_page_filter());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_user_id_filter(from._internal_user_id_filter());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_time_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_time_range());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
+          from._internal_pagination());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetPerformanceRequest::CopyFrom(const GetPerformanceRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetPerformanceRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetPerformanceRequest::IsInitialized() const {
+  return true;
+}
+
+void GetPerformanceRequest::InternalSwap(GetPerformanceRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_filter_, lhs_arena,
+      &other->_impl_.page_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_filter_, lhs_arena,
+      &other->_impl_.user_id_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetPerformanceRequest, _impl_.allow_segments_)
+      + sizeof(GetPerformanceRequest::_impl_.allow_segments_)
+      - PROTOBUF_FIELD_OFFSET(GetPerformanceRequest, _impl_.time_range_)>(
+          reinterpret_cast<char*>(&_impl_.time_range_),
+          reinterpret_cast<char*>(&other->_impl_.time_range_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetPerformanceRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[10]);
+}
+
+// ===================================================================
+
+class GetPerformanceResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetPerformanceResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetPerformanceResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::metricsys::EventCursor&
+GetPerformanceResponse::_Internal::next_cursor(const GetPerformanceResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
+GetPerformanceResponse::GetPerformanceResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetPerformanceResponse)
+}
+GetPerformanceResponse::GetPerformanceResponse(const GetPerformanceResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetPerformanceResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetPerformanceResponse)
+}
+
+inline void GetPerformanceResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
+  };
+}
+
+GetPerformanceResponse::~GetPerformanceResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.GetPerformanceResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetPerformanceResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
+}
+
+void GetPerformanceResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetPerformanceResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetPerformanceResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
+  _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetPerformanceResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .metricsys.PerformanceEvent events = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 total_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetPerformanceResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetPerformanceResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .metricsys.PerformanceEvent events = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
+  }
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetPerformanceResponse)
+  return target;
+}
+
+size_t GetPerformanceResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetPerformanceResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .metricsys.PerformanceEvent events = 1;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetPerformanceResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetPerformanceResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetPerformanceResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetPerformanceResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetPerformanceResponse*>(&to_msg);
+  auto& from = static_cast<const GetPerformanceResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetPerformanceResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_total_count() != 0) {
+    _this->_internal_set_total_count(from._internal_total_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetPerformanceResponse::CopyFrom(const GetPerformanceResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetPerformanceResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetPerformanceResponse::IsInitialized() const {
+  return true;
+}
+
+void GetPerformanceResponse::InternalSwap(GetPerformanceResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetPerformanceResponse, _impl_.total_count_)
+      + sizeof(GetPerformanceResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetPerformanceResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetPerformanceResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[11]);
+}
+
+// ===================================================================
+
+class ErrorEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ErrorEvent>()._impl_._has_bits_);
+  static void set_has_stack(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_user_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_session_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+ErrorEvent::ErrorEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.ErrorEvent)
+}
+ErrorEvent::ErrorEvent(const ErrorEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ErrorEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.error_type_){}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.stack_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}
+    , decltype(_impl_.severity_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_page().empty()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_error_type().empty()) {
+    _this->_impl_.error_type_.Set(from._internal_error_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.stack_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stack_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_stack()) {
+    _this->_impl_.stack_.Set(from._internal_stack(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id()) {
+    _this->_impl_.user_id_.Set(from._internal_user_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_session_id()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.severity_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.severity_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.ErrorEvent)
+}
+
+inline void ErrorEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.error_type_){}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.stack_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
+    , decltype(_impl_.severity_){0}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.stack_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.stack_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ErrorEvent::~ErrorEvent() {
+  // @@protoc_insertion_point(destructor:metricsys.ErrorEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ErrorEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.id_.Destroy();
+  _impl_.page_.Destroy();
+  _impl_.error_type_.Destroy();
+  _impl_.message_.Destroy();
+  _impl_.stack_.Destroy();
+  _impl_.user_id_.Destroy();
+  _impl_.session_id_.Destroy();
+}
+
+void ErrorEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ErrorEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.ErrorEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.id_.ClearToEmpty();
+  _impl_.page_.ClearToEmpty();
+  _impl_.error_type_.ClearToEmpty();
+  _impl_.message_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.stack_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.user_id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.session_id_.ClearNonDefaultToEmpty();
+    }
+  }
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.severity_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.severity_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ErrorEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ErrorEvent.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string page = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ErrorEvent.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string error_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_error_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ErrorEvent.error_type"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string message = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ErrorEvent.message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string stack = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_stack();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ErrorEvent.stack"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .metricsys.Severity severity = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_severity(static_cast<::metricsys::Severity>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_user_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ErrorEvent.user_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string session_id = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.ErrorEvent.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 received_at = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ErrorEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.ErrorEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ErrorEvent.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string page = 2;
+  if (!this->_internal_page().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ErrorEvent.page");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_page(), target);
+  }
+
+  // string error_type = 3;
+  if (!this->_internal_error_type().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_type().data(), static_cast<int>(this->_internal_error_type().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ErrorEvent.error_type");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_error_type(), target);
+  }
+
+  // string message = 4;
+  if (!this->_internal_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ErrorEvent.message");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_message(), target);
+  }
+
+  // optional string stack = 5;
+  if (_internal_has_stack()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_stack().data(), static_cast<int>(this->_internal_stack().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ErrorEvent.stack");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_stack(), target);
+  }
+
+  // .metricsys.Severity severity = 6;
+  if (this->_internal_severity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_severity(), target);
+  }
+
+  // optional string user_id = 7;
+  if (_internal_has_user_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id().data(), static_cast<int>(this->_internal_user_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ErrorEvent.user_id");
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_user_id(), target);
+  }
+
+  // optional string session_id = 8;
+  if (_internal_has_session_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.ErrorEvent.session_id");
+    target = stream->WriteStringMaybeAliased(
+        8, this->_internal_session_id(), target);
+  }
+
+  // int64 timestamp = 9;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(9, this->_internal_timestamp(), target);
+  }
+
+  // int64 received_at = 10;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(10, this->_internal_received_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.ErrorEvent)
+  return target;
+}
+
+size_t ErrorEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.ErrorEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string page = 2;
+  if (!this->_internal_page().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_page());
+  }
+
+  // string error_type = 3;
+  if (!this->_internal_error_type().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error_type());
+  }
+
+  // string message = 4;
+  if (!this->_internal_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string stack = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_stack());
+    }
+
+    // optional string user_id = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id());
+    }
+
+    // optional string session_id = 8;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_session_id());
+    }
+
+  }
+  // int64 timestamp = 9;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // int64 received_at = 10;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
+  // .metricsys.Severity severity = 6;
+  if (this->_internal_severity() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_severity());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ErrorEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ErrorEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ErrorEvent::GetClassData() const { return &_class_data_; }
+
+
+void ErrorEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ErrorEvent*>(&to_msg);
+  auto& from = static_cast<const ErrorEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.ErrorEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_page().empty()) {
+    _this->_internal_set_page(from._internal_page());
+  }
+  if (!from._internal_error_type().empty()) {
+    _this->_internal_set_error_type(from._internal_error_type());
+  }
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_stack(from._internal_stack());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_user_id(from._internal_user_id());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_session_id(from._internal_session_id());
+    }
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
+  if (from._internal_severity() != 0) {
+    _this->_internal_set_severity(from._internal_severity());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ErrorEvent::CopyFrom(const ErrorEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.ErrorEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ErrorEvent::IsInitialized() const {
+  return true;
+}
+
+void ErrorEvent::InternalSwap(ErrorEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_type_, lhs_arena,
+      &other->_impl_.error_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.stack_, lhs_arena,
+      &other->_impl_.stack_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_, lhs_arena,
+      &other->_impl_.user_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ErrorEvent, _impl_.severity_)
+      + sizeof(ErrorEvent::_impl_.severity_)
+      - PROTOBUF_FIELD_OFFSET(ErrorEvent, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ErrorEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[12]);
+}
+
+// ===================================================================
+
+class GetErrorsRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetErrorsRequest>()._impl_._has_bits_);
+  static const ::metricsys::TimeRange& time_range(const GetErrorsRequest* msg);
+  static void set_has_time_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::metricsys::Pagination& pagination(const GetErrorsRequest* msg);
+  static void set_has_pagination(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_page_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_severity_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_error_type_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_user_id_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::metricsys::EventCursor& after(const GetErrorsRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetErrorsRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+const ::metricsys::TimeRange&
+GetErrorsRequest::_Internal::time_range(const GetErrorsRequest* msg) {
+  return *msg->_impl_.time_range_;
+}
+const ::metricsys::Pagination&
+GetErrorsRequest::_Internal::pagination(const GetErrorsRequest* msg) {
+  return *msg->_impl_.pagination_;
+}
+const ::metricsys::EventCursor&
+GetErrorsRequest::_Internal::after(const GetErrorsRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetErrorsRequest::_Internal::received_range(const GetErrorsRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
+GetErrorsRequest::GetErrorsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetErrorsRequest)
+}
+GetErrorsRequest::GetErrorsRequest(const GetErrorsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetErrorsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.error_type_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.severity_filter_){}
+    , decltype(_impl_.allow_segments_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page_filter()) {
+    _this->_impl_.page_filter_.Set(from._internal_page_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.error_type_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error_type_filter()) {
+    _this->_impl_.error_type_filter_.Set(from._internal_error_type_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id_filter()) {
+    _this->_impl_.user_id_filter_.Set(from._internal_user_id_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_impl_.time_range_ = new ::metricsys::TimeRange(*from._impl_.time_range_);
+  }
+  if (from._internal_has_pagination()) {
+    _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
+  }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  ::memcpy(&_impl_.severity_filter_, &from._impl_.severity_filter_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.allow_segments_) -
+    reinterpret_cast<char*>(&_impl_.severity_filter_)) + sizeof(_impl_.allow_segments_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetErrorsRequest)
+}
+
+inline void GetErrorsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.error_type_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.severity_filter_){0}
+    , decltype(_impl_.allow_segments_){false}
+  };
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.error_type_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_type_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetErrorsRequest::~GetErrorsRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.GetErrorsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetErrorsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.page_filter_.Destroy();
+  _impl_.error_type_filter_.Destroy();
+  _impl_.user_id_filter_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_range_;
+  if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
+}
+
+void GetErrorsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetErrorsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetErrorsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.page_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.error_type_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.user_id_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.time_range_ != nullptr);
+      _impl_.time_range_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
+      _impl_.pagination_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
+  }
+  _impl_.severity_filter_ = 0;
+  _impl_.allow_segments_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetErrorsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .metricsys.TimeRange time_range = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.Pagination pagination = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page_filter = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_page_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetErrorsRequest.page_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.Severity severity_filter = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_severity_filter(static_cast<::metricsys::Severity>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error_type_filter = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_error_type_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetErrorsRequest.error_type_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id_filter = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_user_id_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetErrorsRequest.user_id_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor after = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetErrorsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetErrorsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional .metricsys.TimeRange time_range = 1;
+  if (_internal_has_time_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time_range(this),
+        _Internal::time_range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.Pagination pagination = 2;
+  if (_internal_has_pagination()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pagination(this),
+        _Internal::pagination(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string page_filter = 3;
+  if (_internal_has_page_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page_filter().data(), static_cast<int>(this->_internal_page_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetErrorsRequest.page_filter");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_page_filter(), target);
+  }
+
+  // optional .metricsys.Severity severity_filter = 4;
+  if (_internal_has_severity_filter()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_severity_filter(), target);
+  }
+
+  // optional string error_type_filter = 5;
+  if (_internal_has_error_type_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error_type_filter().data(), static_cast<int>(this->_internal_error_type_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetErrorsRequest.error_type_filter");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_error_type_filter(), target);
+  }
+
+  // optional string user_id_filter = 6;
+  if (_internal_has_user_id_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id_filter().data(), static_cast<int>(this->_internal_user_id_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetErrorsRequest.user_id_filter");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_user_id_filter(), target);
+  }
+
+  // optional .metricsys.EventCursor after = 7;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 8;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 9;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_allow_segments(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetErrorsRequest)
+  return target;
+}
+
+size_t GetErrorsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetErrorsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string page_filter = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_page_filter());
+    }
+
+    // optional string error_type_filter = 5;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error_type_filter());
+    }
+
+    // optional string user_id_filter = 6;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id_filter());
+    }
+
+    // optional .metricsys.TimeRange time_range = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.time_range_);
+    }
+
+    // optional .metricsys.Pagination pagination = 2;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pagination_);
+    }
+
+    // optional .metricsys.EventCursor after = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
+    // optional .metricsys.Severity severity_filter = 4;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::EnumSize(this->_internal_severity_filter());
+    }
+
+  }
+  // bool allow_segments = 9;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetErrorsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetErrorsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetErrorsRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetErrorsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetErrorsRequest*>(&to_msg);
+  auto& from = static_cast<const GetErrorsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetErrorsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_page_filter(from._internal_page_filter());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_error_type_filter(from._internal_error_type_filter());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_user_id_filter(from._internal_user_id_filter());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_time_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_time_range());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
+          from._internal_pagination());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.severity_filter_ = from._impl_.severity_filter_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetErrorsRequest::CopyFrom(const GetErrorsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetErrorsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetErrorsRequest::IsInitialized() const {
+  return true;
+}
+
+void GetErrorsRequest::InternalSwap(GetErrorsRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_filter_, lhs_arena,
+      &other->_impl_.page_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_type_filter_, lhs_arena,
+      &other->_impl_.error_type_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_filter_, lhs_arena,
+      &other->_impl_.user_id_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetErrorsRequest, _impl_.allow_segments_)
+      + sizeof(GetErrorsRequest::_impl_.allow_segments_)
+      - PROTOBUF_FIELD_OFFSET(GetErrorsRequest, _impl_.time_range_)>(
+          reinterpret_cast<char*>(&_impl_.time_range_),
+          reinterpret_cast<char*>(&other->_impl_.time_range_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetErrorsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[13]);
+}
+
+// ===================================================================
+
+class GetErrorsResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetErrorsResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetErrorsResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::metricsys::EventCursor&
+GetErrorsResponse::_Internal::next_cursor(const GetErrorsResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
+GetErrorsResponse::GetErrorsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetErrorsResponse)
+}
+GetErrorsResponse::GetErrorsResponse(const GetErrorsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetErrorsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetErrorsResponse)
+}
+
+inline void GetErrorsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
+  };
+}
+
+GetErrorsResponse::~GetErrorsResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.GetErrorsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetErrorsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
+}
+
+void GetErrorsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetErrorsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetErrorsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
+  _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetErrorsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .metricsys.ErrorEvent events = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 total_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetErrorsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetErrorsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .metricsys.ErrorEvent events = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
+  }
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetErrorsResponse)
+  return target;
+}
+
+size_t GetErrorsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetErrorsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .metricsys.ErrorEvent events = 1;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetErrorsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetErrorsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetErrorsResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetErrorsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetErrorsResponse*>(&to_msg);
+  auto& from = static_cast<const GetErrorsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetErrorsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_total_count() != 0) {
+    _this->_internal_set_total_count(from._internal_total_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetErrorsResponse::CopyFrom(const GetErrorsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetErrorsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetErrorsResponse::IsInitialized() const {
+  return true;
+}
+
+void GetErrorsResponse::InternalSwap(GetErrorsResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetErrorsResponse, _impl_.total_count_)
+      + sizeof(GetErrorsResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetErrorsResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetErrorsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[14]);
+}
+
+// ===================================================================
+
+CustomEvent_PropertiesEntry_DoNotUse::CustomEvent_PropertiesEntry_DoNotUse() {}
+CustomEvent_PropertiesEntry_DoNotUse::CustomEvent_PropertiesEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void CustomEvent_PropertiesEntry_DoNotUse::MergeFrom(const CustomEvent_PropertiesEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata CustomEvent_PropertiesEntry_DoNotUse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[15]);
+}
+
+// ===================================================================
+
+class CustomEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<CustomEvent>()._impl_._has_bits_);
+  static void set_has_page(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_user_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_session_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+CustomEvent::CustomEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  if (arena != nullptr && !is_message_owned) {
+    arena->OwnCustomDestructor(this, &CustomEvent::ArenaDtor);
+  }
+  // @@protoc_insertion_point(arena_constructor:metricsys.CustomEvent)
+}
+CustomEvent::CustomEvent(const CustomEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  CustomEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_.properties_)*/{}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.timestamp_){}
+    , decltype(_impl_.received_at_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.properties_.MergeFrom(from._impl_.properties_);
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_id().empty()) {
+    _this->_impl_.id_.Set(from._internal_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page()) {
+    _this->_impl_.page_.Set(from._internal_page(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id()) {
+    _this->_impl_.user_id_.Set(from._internal_user_id(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_session_id()) {
+    _this->_impl_.session_id_.Set(from._internal_session_id(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.timestamp_, &from._impl_.timestamp_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.received_at_) -
+    reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.CustomEvent)
+}
+
+inline void CustomEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_.properties_)*/{::_pbi::ArenaInitialized(), arena}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.page_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.session_id_){}
+    , decltype(_impl_.timestamp_){int64_t{0}}
+    , decltype(_impl_.received_at_){int64_t{0}}
+  };
+  _impl_.id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.session_id_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.session_id_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+CustomEvent::~CustomEvent() {
+  // @@protoc_insertion_point(destructor:metricsys.CustomEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    ArenaDtor(this);
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CustomEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.properties_.Destruct();
+  _impl_.properties_.~MapField();
+  _impl_.id_.Destroy();
+  _impl_.name_.Destroy();
+  _impl_.page_.Destroy();
+  _impl_.user_id_.Destroy();
+  _impl_.session_id_.Destroy();
+}
+
+void CustomEvent::ArenaDtor(void* object) {
+  CustomEvent* _this = reinterpret_cast< CustomEvent* >(object);
+  _this->_impl_.properties_.Destruct();
+}
+void CustomEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CustomEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.CustomEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.properties_.Clear();
+  _impl_.id_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.page_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.user_id_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.session_id_.ClearNonDefaultToEmpty();
+    }
+  }
+  ::memset(&_impl_.timestamp_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.received_at_) -
+      reinterpret_cast<char*>(&_impl_.timestamp_)) + sizeof(_impl_.received_at_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* CustomEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.CustomEvent.id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.CustomEvent.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_page();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.CustomEvent.page"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_user_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.CustomEvent.user_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string session_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_session_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.CustomEvent.session_id"));
+        } else
+          goto handle_unusual;
+        continue;
+      // map<string, string> properties = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&_impl_.properties_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 timestamp = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.timestamp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int64 received_at = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.received_at_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CustomEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.CustomEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_id().data(), static_cast<int>(this->_internal_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.CustomEvent.id");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_id(), target);
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.CustomEvent.name");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
+
+  // optional string page = 3;
+  if (_internal_has_page()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page().data(), static_cast<int>(this->_internal_page().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.CustomEvent.page");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_page(), target);
+  }
+
+  // optional string user_id = 4;
+  if (_internal_has_user_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id().data(), static_cast<int>(this->_internal_user_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.CustomEvent.user_id");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_user_id(), target);
+  }
+
+  // optional string session_id = 5;
+  if (_internal_has_session_id()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_session_id().data(), static_cast<int>(this->_internal_session_id().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.CustomEvent.session_id");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_session_id(), target);
+  }
+
+  // map<string, string> properties = 6;
+  if (!this->_internal_properties().empty()) {
+    using MapType = ::_pb::Map<std::string, std::string>;
+    using WireHelper = CustomEvent_PropertiesEntry_DoNotUse::Funcs;
+    const auto& map_field = this->_internal_properties();
+    auto check_utf8 = [](const MapType::value_type& entry) {
+      (void)entry;
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.first.data(), static_cast<int>(entry.first.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "metricsys.CustomEvent.PropertiesEntry.key");
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+        entry.second.data(), static_cast<int>(entry.second.length()),
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+        "metricsys.CustomEvent.PropertiesEntry.value");
+    };
+
+    if (stream->IsSerializationDeterministic() && map_field.size() > 1) {
+      for (const auto& entry : ::_pbi::MapSorterPtr<MapType>(map_field)) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    } else {
+      for (const auto& entry : map_field) {
+        target = WireHelper::InternalSerialize(6, entry.first, entry.second, target, stream);
+        check_utf8(entry);
+      }
+    }
+  }
+
+  // int64 timestamp = 7;
+  if (this->_internal_timestamp() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(7, this->_internal_timestamp(), target);
+  }
+
+  // int64 received_at = 8;
+  if (this->_internal_received_at() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(8, this->_internal_received_at(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.CustomEvent)
+  return target;
+}
+
+size_t CustomEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.CustomEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // map<string, string> properties = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_properties_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >::const_iterator
+      it = this->_internal_properties().begin();
+      it != this->_internal_properties().end(); ++it) {
+    total_size += CustomEvent_PropertiesEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // string id = 1;
+  if (!this->_internal_id().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_id());
+  }
+
+  // string name = 2;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string page = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_page());
+    }
+
+    // optional string user_id = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id());
+    }
+
+    // optional string session_id = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_session_id());
+    }
+
+  }
+  // int64 timestamp = 7;
+  if (this->_internal_timestamp() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_timestamp());
+  }
+
+  // int64 received_at = 8;
+  if (this->_internal_received_at() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_at());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData CustomEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    CustomEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*CustomEvent::GetClassData() const { return &_class_data_; }
+
+
+void CustomEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<CustomEvent*>(&to_msg);
+  auto& from = static_cast<const CustomEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.CustomEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.properties_.MergeFrom(from._impl_.properties_);
+  if (!from._internal_id().empty()) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_page(from._internal_page());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_user_id(from._internal_user_id());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_session_id(from._internal_session_id());
+    }
+  }
+  if (from._internal_timestamp() != 0) {
+    _this->_internal_set_timestamp(from._internal_timestamp());
+  }
+  if (from._internal_received_at() != 0) {
+    _this->_internal_set_received_at(from._internal_received_at());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void CustomEvent::CopyFrom(const CustomEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.CustomEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CustomEvent::IsInitialized() const {
+  return true;
+}
+
+void CustomEvent::InternalSwap(CustomEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.properties_.InternalSwap(&other->_impl_.properties_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.id_, lhs_arena,
+      &other->_impl_.id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_, lhs_arena,
+      &other->_impl_.page_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_, lhs_arena,
+      &other->_impl_.user_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.session_id_, lhs_arena,
+      &other->_impl_.session_id_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(CustomEvent, _impl_.received_at_)
+      + sizeof(CustomEvent::_impl_.received_at_)
+      - PROTOBUF_FIELD_OFFSET(CustomEvent, _impl_.timestamp_)>(
+          reinterpret_cast<char*>(&_impl_.timestamp_),
+          reinterpret_cast<char*>(&other->_impl_.timestamp_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata CustomEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[16]);
+}
+
+// ===================================================================
+
+class GetCustomEventsRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetCustomEventsRequest>()._impl_._has_bits_);
+  static const ::metricsys::TimeRange& time_range(const GetCustomEventsRequest* msg);
+  static void set_has_time_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::metricsys::Pagination& pagination(const GetCustomEventsRequest* msg);
+  static void set_has_pagination(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_name_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_page_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_user_id_filter(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::metricsys::EventCursor& after(const GetCustomEventsRequest* msg);
+  static void set_has_after(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::metricsys::TimeRange& received_range(const GetCustomEventsRequest* msg);
+  static void set_has_received_range(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+const ::metricsys::TimeRange&
+GetCustomEventsRequest::_Internal::time_range(const GetCustomEventsRequest* msg) {
+  return *msg->_impl_.time_range_;
+}
+const ::metricsys::Pagination&
+GetCustomEventsRequest::_Internal::pagination(const GetCustomEventsRequest* msg) {
+  return *msg->_impl_.pagination_;
+}
+const ::metricsys::EventCursor&
+GetCustomEventsRequest::_Internal::after(const GetCustomEventsRequest* msg) {
+  return *msg->_impl_.after_;
+}
+const ::metricsys::TimeRange&
+GetCustomEventsRequest::_Internal::received_range(const GetCustomEventsRequest* msg) {
+  return *msg->_impl_.received_range_;
+}
+GetCustomEventsRequest::GetCustomEventsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetCustomEventsRequest)
+}
+GetCustomEventsRequest::GetCustomEventsRequest(const GetCustomEventsRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetCustomEventsRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_filter_){}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name_filter()) {
+    _this->_impl_.name_filter_.Set(from._internal_name_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_page_filter()) {
+    _this->_impl_.page_filter_.Set(from._internal_page_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_user_id_filter()) {
+    _this->_impl_.user_id_filter_.Set(from._internal_user_id_filter(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_time_range()) {
+    _this->_impl_.time_range_ = new ::metricsys::TimeRange(*from._impl_.time_range_);
+  }
+  if (from._internal_has_pagination()) {
+    _this->_impl_.pagination_ = new ::metricsys::Pagination(*from._impl_.pagination_);
+  }
+  if (from._internal_has_after()) {
+    _this->_impl_.after_ = new ::metricsys::EventCursor(*from._impl_.after_);
+  }
+  if (from._internal_has_received_range()) {
+    _this->_impl_.received_range_ = new ::metricsys::TimeRange(*from._impl_.received_range_);
+  }
+  _this->_impl_.allow_segments_ = from._impl_.allow_segments_;
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetCustomEventsRequest)
+}
+
+inline void GetCustomEventsRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.name_filter_){}
+    , decltype(_impl_.page_filter_){}
+    , decltype(_impl_.user_id_filter_){}
+    , decltype(_impl_.time_range_){nullptr}
+    , decltype(_impl_.pagination_){nullptr}
+    , decltype(_impl_.after_){nullptr}
+    , decltype(_impl_.received_range_){nullptr}
+    , decltype(_impl_.allow_segments_){false}
+  };
+  _impl_.name_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.page_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.page_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.user_id_filter_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.user_id_filter_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GetCustomEventsRequest::~GetCustomEventsRequest() {
+  // @@protoc_insertion_point(destructor:metricsys.GetCustomEventsRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetCustomEventsRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_filter_.Destroy();
+  _impl_.page_filter_.Destroy();
+  _impl_.user_id_filter_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.time_range_;
+  if (this != internal_default_instance()) delete _impl_.pagination_;
+  if (this != internal_default_instance()) delete _impl_.after_;
+  if (this != internal_default_instance()) delete _impl_.received_range_;
+}
+
+void GetCustomEventsRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetCustomEventsRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetCustomEventsRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.name_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.page_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.user_id_filter_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.time_range_ != nullptr);
+      _impl_.time_range_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.pagination_ != nullptr);
+      _impl_.pagination_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.after_ != nullptr);
+      _impl_.after_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.received_range_ != nullptr);
+      _impl_.received_range_->Clear();
+    }
+  }
+  _impl_.allow_segments_ = false;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetCustomEventsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .metricsys.TimeRange time_range = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_time_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.Pagination pagination = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pagination(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string name_filter = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetCustomEventsRequest.name_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string page_filter = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_page_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetCustomEventsRequest.page_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string user_id_filter = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_user_id_filter();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "metricsys.GetCustomEventsRequest.user_id_filter"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor after = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_after(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.TimeRange received_range = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_received_range(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool allow_segments = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.allow_segments_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetCustomEventsRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetCustomEventsRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional .metricsys.TimeRange time_range = 1;
+  if (_internal_has_time_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::time_range(this),
+        _Internal::time_range(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.Pagination pagination = 2;
+  if (_internal_has_pagination()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pagination(this),
+        _Internal::pagination(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string name_filter = 3;
+  if (_internal_has_name_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name_filter().data(), static_cast<int>(this->_internal_name_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetCustomEventsRequest.name_filter");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name_filter(), target);
+  }
+
+  // optional string page_filter = 4;
+  if (_internal_has_page_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_page_filter().data(), static_cast<int>(this->_internal_page_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetCustomEventsRequest.page_filter");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_page_filter(), target);
+  }
+
+  // optional string user_id_filter = 5;
+  if (_internal_has_user_id_filter()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_user_id_filter().data(), static_cast<int>(this->_internal_user_id_filter().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "metricsys.GetCustomEventsRequest.user_id_filter");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_user_id_filter(), target);
+  }
+
+  // optional .metricsys.EventCursor after = 6;
+  if (_internal_has_after()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::after(this),
+        _Internal::after(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .metricsys.TimeRange received_range = 7;
+  if (_internal_has_received_range()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::received_range(this),
+        _Internal::received_range(this).GetCachedSize(), target, stream);
+  }
+
+  // bool allow_segments = 8;
+  if (this->_internal_allow_segments() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(8, this->_internal_allow_segments(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetCustomEventsRequest)
+  return target;
+}
+
+size_t GetCustomEventsRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetCustomEventsRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional string name_filter = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_name_filter());
+    }
+
+    // optional string page_filter = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_page_filter());
+    }
+
+    // optional string user_id_filter = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_user_id_filter());
+    }
+
+    // optional .metricsys.TimeRange time_range = 1;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.time_range_);
+    }
+
+    // optional .metricsys.Pagination pagination = 2;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.pagination_);
+    }
+
+    // optional .metricsys.EventCursor after = 6;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.after_);
+    }
+
+    // optional .metricsys.TimeRange received_range = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.received_range_);
+    }
+
+  }
+  // bool allow_segments = 8;
+  if (this->_internal_allow_segments() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetCustomEventsRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetCustomEventsRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetCustomEventsRequest::GetClassData() const { return &_class_data_; }
+
+
+void GetCustomEventsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetCustomEventsRequest*>(&to_msg);
+  auto& from = static_cast<const GetCustomEventsRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetCustomEventsRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_name_filter(from._internal_name_filter());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_page_filter(from._internal_page_filter());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_user_id_filter(from._internal_user_id_filter());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_time_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_time_range());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_pagination()->::metricsys::Pagination::MergeFrom(
+          from._internal_pagination());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_after()->::metricsys::EventCursor::MergeFrom(
+          from._internal_after());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_received_range()->::metricsys::TimeRange::MergeFrom(
+          from._internal_received_range());
+    }
+  }
+  if (from._internal_allow_segments() != 0) {
+    _this->_internal_set_allow_segments(from._internal_allow_segments());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetCustomEventsRequest::CopyFrom(const GetCustomEventsRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetCustomEventsRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetCustomEventsRequest::IsInitialized() const {
+  return true;
+}
+
+void GetCustomEventsRequest::InternalSwap(GetCustomEventsRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_filter_, lhs_arena,
+      &other->_impl_.name_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.page_filter_, lhs_arena,
+      &other->_impl_.page_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.user_id_filter_, lhs_arena,
+      &other->_impl_.user_id_filter_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetCustomEventsRequest, _impl_.allow_segments_)
+      + sizeof(GetCustomEventsRequest::_impl_.allow_segments_)
+      - PROTOBUF_FIELD_OFFSET(GetCustomEventsRequest, _impl_.time_range_)>(
+          reinterpret_cast<char*>(&_impl_.time_range_),
+          reinterpret_cast<char*>(&other->_impl_.time_range_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetCustomEventsRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[17]);
+}
+
+// ===================================================================
+
+class GetCustomEventsResponse::_Internal {
+ public:
+  using HasBits = decltype(std::declval<GetCustomEventsResponse>()._impl_._has_bits_);
+  static const ::metricsys::EventCursor& next_cursor(const GetCustomEventsResponse* msg);
+  static void set_has_next_cursor(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_received_until(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::metricsys::EventCursor&
+GetCustomEventsResponse::_Internal::next_cursor(const GetCustomEventsResponse* msg) {
+  return *msg->_impl_.next_cursor_;
+}
+GetCustomEventsResponse::GetCustomEventsResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:metricsys.GetCustomEventsResponse)
+}
+GetCustomEventsResponse::GetCustomEventsResponse(const GetCustomEventsResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GetCustomEventsResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){}
+    , decltype(_impl_.total_count_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_next_cursor()) {
+    _this->_impl_.next_cursor_ = new ::metricsys::EventCursor(*from._impl_.next_cursor_);
+  }
+  ::memcpy(&_impl_.received_until_, &from._impl_.received_until_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.total_count_) -
+    reinterpret_cast<char*>(&_impl_.received_until_)) + sizeof(_impl_.total_count_));
+  // @@protoc_insertion_point(copy_constructor:metricsys.GetCustomEventsResponse)
+}
+
+inline void GetCustomEventsResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.next_cursor_){nullptr}
+    , decltype(_impl_.received_until_){int64_t{0}}
+    , decltype(_impl_.total_count_){0}
+  };
+}
+
+GetCustomEventsResponse::~GetCustomEventsResponse() {
+  // @@protoc_insertion_point(destructor:metricsys.GetCustomEventsResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GetCustomEventsResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.next_cursor_;
+}
+
+void GetCustomEventsResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GetCustomEventsResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:metricsys.GetCustomEventsResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.next_cursor_ != nullptr);
+    _impl_.next_cursor_->Clear();
+  }
+  _impl_.received_until_ = int64_t{0};
+  _impl_.total_count_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetCustomEventsResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .metricsys.CustomEvent events = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 total_count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.total_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .metricsys.EventCursor next_cursor = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_next_cursor(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int64 received_until = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_received_until(&has_bits);
+          _impl_.received_until_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GetCustomEventsResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:metricsys.GetCustomEventsResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .metricsys.CustomEvent events = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_total_count(), target);
+  }
+
+  // optional .metricsys.EventCursor next_cursor = 3;
+  if (_internal_has_next_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::next_cursor(this),
+        _Internal::next_cursor(this).GetCachedSize(), target, stream);
+  }
+
+  // optional int64 received_until = 4;
+  if (_internal_has_received_until()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt64ToArray(4, this->_internal_received_until(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:metricsys.GetCustomEventsResponse)
+  return target;
+}
+
+size_t GetCustomEventsResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:metricsys.GetCustomEventsResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .metricsys.CustomEvent events = 1;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional .metricsys.EventCursor next_cursor = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.next_cursor_);
+    }
+
+    // optional int64 received_until = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int64SizePlusOne(this->_internal_received_until());
+    }
+
+  }
+  // int32 total_count = 2;
+  if (this->_internal_total_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_total_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GetCustomEventsResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GetCustomEventsResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetCustomEventsResponse::GetClassData() const { return &_class_data_; }
+
+
+void GetCustomEventsResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GetCustomEventsResponse*>(&to_msg);
+  auto& from = static_cast<const GetCustomEventsResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:metricsys.GetCustomEventsResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_next_cursor()->::metricsys::EventCursor::MergeFrom(
+          from._internal_next_cursor());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.received_until_ = from._impl_.received_until_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (from._internal_total_count() != 0) {
+    _this->_internal_set_total_count(from._internal_total_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GetCustomEventsResponse::CopyFrom(const GetCustomEventsResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:metricsys.GetCustomEventsResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetCustomEventsResponse::IsInitialized() const {
+  return true;
+}
+
+void GetCustomEventsResponse::InternalSwap(GetCustomEventsResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetCustomEventsResponse, _impl_.total_count_)
+      + sizeof(GetCustomEventsResponse::_impl_.total_count_)
+      - PROTOBUF_FIELD_OFFSET(GetCustomEventsResponse, _impl_.next_cursor_)>(
+          reinterpret_cast<char*>(&_impl_.next_cursor_),
+          reinterpret_cast<char*>(&other->_impl_.next_cursor_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetCustomEventsResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_metrics_2eproto_getter, &descriptor_table_metrics_2eproto_once,
+      file_level_metadata_metrics_2eproto[18]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace metricsys
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::metricsys::TimeRange*
+Arena::CreateMaybeMessage< ::metricsys::TimeRange >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::TimeRange >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::Pagination*
+Arena::CreateMaybeMessage< ::metricsys::Pagination >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::Pagination >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::EventCursor*
+Arena::CreateMaybeMessage< ::metricsys::EventCursor >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::EventCursor >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::PageViewEvent*
+Arena::CreateMaybeMessage< ::metricsys::PageViewEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::PageViewEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetPageViewsRequest*
+Arena::CreateMaybeMessage< ::metricsys::GetPageViewsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetPageViewsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetPageViewsResponse*
+Arena::CreateMaybeMessage< ::metricsys::GetPageViewsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetPageViewsResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::ClickEvent*
+Arena::CreateMaybeMessage< ::metricsys::ClickEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::ClickEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetClicksRequest*
+Arena::CreateMaybeMessage< ::metricsys::GetClicksRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetClicksRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetClicksResponse*
+Arena::CreateMaybeMessage< ::metricsys::GetClicksResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetClicksResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::PerformanceEvent*
+Arena::CreateMaybeMessage< ::metricsys::PerformanceEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::PerformanceEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetPerformanceRequest*
+Arena::CreateMaybeMessage< ::metricsys::GetPerformanceRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetPerformanceRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetPerformanceResponse*
+Arena::CreateMaybeMessage< ::metricsys::GetPerformanceResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetPerformanceResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::ErrorEvent*
+Arena::CreateMaybeMessage< ::metricsys::ErrorEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::ErrorEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetErrorsRequest*
+Arena::CreateMaybeMessage< ::metricsys::GetErrorsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetErrorsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetErrorsResponse*
+Arena::CreateMaybeMessage< ::metricsys::GetErrorsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetErrorsResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::CustomEvent_PropertiesEntry_DoNotUse*
+Arena::CreateMaybeMessage< ::metricsys::CustomEvent_PropertiesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::CustomEvent_PropertiesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::CustomEvent*
+Arena::CreateMaybeMessage< ::metricsys::CustomEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::CustomEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetCustomEventsRequest*
+Arena::CreateMaybeMessage< ::metricsys::GetCustomEventsRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetCustomEventsRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::metricsys::GetCustomEventsResponse*
+Arena::CreateMaybeMessage< ::metricsys::GetCustomEventsResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::metricsys::GetCustomEventsResponse >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -202,6 +202,21 @@ void from_json(const nlohmann::json& j, CustomEvent& e) {
         e.properties = j["properties"];
 }
 
+// ==================== Batch ====================
+
+void to_json(nlohmann::json& j, const BatchItemResult& r) {
+    j = nlohmann::json{{"index", r.index}, {"status", r.status}};
+    if (r.error.has_value())
+        j["error"] = r.error.value();
+}
+
+void to_json(nlohmann::json& j, const BatchResponse& r) {
+    j = nlohmann::json{{"accepted", r.accepted},
+                       {"rejected", r.rejected},
+                       {"failed", r.failed},
+                       {"results", r.results}};
+}
+
 // ==================== Aggregation Common ====================
 
 void to_json(nlohmann::json& j, const TimeRange& r) {
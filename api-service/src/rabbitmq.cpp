@@ -1,24 +1,256 @@
 #include "rabbitmq.hpp"
+#include "mpsc_queue.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
 #include <iostream>
-#include <cstring>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <thread>
+#include <sys/time.h>
+
+namespace {
+
+constexpr amqp_channel_t CHANNEL = 1;
+// Ожидание подтверждений, когда публиковать пока нечего
+constexpr std::chrono::milliseconds CONFIRM_POLL{10};
+constexpr std::chrono::milliseconds RECONNECT_MIN{100};
+constexpr std::chrono::milliseconds RECONNECT_MAX{5000};
+constexpr std::chrono::seconds CONNECT_TIMEOUT{5};
+
+std::string getEnvStr(const char* name, const std::string& defaultValue) {
+    const char* val = std::getenv(name);
+    return val ? val : defaultValue;
+}
+
+size_t getEnvSize(const char* name, size_t defaultValue) {
+    const char* val = std::getenv(name);
+    return val ? std::stoul(val) : defaultValue;
+}
+
+timeval toTimeval(std::chrono::microseconds timeout) {
+    timeval tv;
+    tv.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+    tv.tv_usec = static_cast<suseconds_t>(timeout.count() % 1000000);
+    return tv;
+}
 
-RabbitMQ::RabbitMQ(const std::string& host, int port, const std::string& username,
-                   const std::string& password, const std::string& vhost)
-    : host_(host), port_(port), username_(username), password_(password), vhost_(vhost) {
+} // namespace
+
+RabbitMQConfig loadRabbitMQConfig() {
+    RabbitMQConfig config;
+    config.host = getEnvStr("RABBITMQ_HOST", config.host);
+    config.port = std::stoi(getEnvStr("RABBITMQ_PORT", std::to_string(config.port)));
+    config.username = getEnvStr("RABBITMQ_USERNAME", config.username);
+    config.password = getEnvStr("RABBITMQ_PASSWORD", config.password);
+    config.vhost = getEnvStr("RABBITMQ_VHOST", config.vhost);
+    config.io_threads = std::max<size_t>(getEnvSize("RABBITMQ_PUBLISHER_THREADS", config.io_threads), 1);
+    config.queue_capacity = std::max<size_t>(getEnvSize("RABBITMQ_PUBLISH_QUEUE_SIZE", config.queue_capacity), 1);
+    config.confirm_window = std::max<size_t>(getEnvSize("RABBITMQ_CONFIRM_WINDOW", config.confirm_window), 1);
+    config.queues = {"page_views", "clicks", "performance_events", "error_events", "custom_events"};
+    return config;
+}
+
+const char* contentType(PayloadFormat format) {
+    return format == PayloadFormat::Protobuf ? "application/x-protobuf" : "application/json";
+}
+
+PublishMessage makePublishMessage(std::string routing_key, std::string body, PayloadFormat format) {
+    PublishMessage message;
+    message.routing_key = std::move(routing_key);
+    message.body = std::move(body);
+    message.format = format;
+    return message;
 }
 
-RabbitMQ::~RabbitMQ() {
-    if (conn_) {
-        if (connected_) {
-            amqp_channel_close(conn_, 1, AMQP_REPLY_SUCCESS);
-            amqp_connection_close(conn_, AMQP_REPLY_SUCCESS);
+// ==================== ConfirmTracker ====================
+
+uint64_t ConfirmTracker::track(PublishMessage message) {
+    uint64_t tag = nextTag_++;
+    pending_.emplace(tag, std::move(message));
+    return tag;
+}
+
+size_t ConfirmTracker::ack(uint64_t tag, bool multiple) {
+    auto messages = take(tag, multiple);
+    for (auto& message : messages) {
+        if (message.on_confirm) {
+            message.on_confirm();
         }
-        amqp_destroy_connection(conn_);
     }
+    return messages.size();
+}
+
+std::vector<PublishMessage> ConfirmTracker::nack(uint64_t tag, bool multiple) {
+    return take(tag, multiple);
+}
+
+std::vector<PublishMessage> ConfirmTracker::reset() {
+    std::vector<PublishMessage> messages;
+    messages.reserve(pending_.size());
+    for (auto& [tag, message] : pending_) {
+        messages.push_back(std::move(message));
+    }
+    pending_.clear();
+    nextTag_ = 1;
+    return messages;
+}
+
+std::vector<PublishMessage> ConfirmTracker::take(uint64_t tag, bool multiple) {
+    std::vector<PublishMessage> messages;
+    auto begin = multiple ? pending_.begin() : pending_.find(tag);
+    auto end = multiple ? pending_.upper_bound(tag) : begin;
+    if (!multiple && begin != pending_.end()) {
+        ++end;
+    }
+    for (auto it = begin; it != end; ++it) {
+        messages.push_back(std::move(it->second));
+    }
+    pending_.erase(begin, end);
+    return messages;
+}
+
+// ==================== IoThread ====================
+
+// Владеет своим соединением и каналом; всё AMQP-взаимодействие — только из run()
+class RabbitMQPublisher::IoThread {
+public:
+    IoThread(RabbitMQPublisher& owner, size_t index)
+        : owner_(owner), index_(index), queue_(owner.config_.queue_capacity) {
+        thread_ = std::thread(&IoThread::run, this);
+    }
+
+    ~IoThread() {
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    // Вызывается из потоков обработчиков
+    bool push(PublishMessage& message) {
+        if (!queue_.tryPush(message)) {
+            return false;
+        }
+        // Пара к барьеру в idleWait(): либо поток увидит сообщение, либо мы — sleeping_
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed)) {
+            wake();
+        }
+        return true;
+    }
+
+    void wake() {
+        wake_.fetch_add(1, std::memory_order_release);
+        wake_.notify_one();
+    }
+
+    void join() {
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    size_t depth() const { return queue_.sizeApprox(); }
+    size_t capacity() const { return queue_.capacity(); }
+    size_t unconfirmed() const { return unconfirmed_.load(std::memory_order_relaxed); }
+    bool connected() const { return connected_.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+    bool connect();
+    void disconnect();
+    // Соединение оборвалось: неподтверждённое уходит в начало retry_
+    void dropConnection(const char* reason);
+    bool send(const PublishMessage& message);
+    // Публикует, пока окно подтверждений не заполнено; true — что-то отправлено
+    bool publishPending();
+    void pollConfirms(std::chrono::milliseconds timeout);
+    void handleNack(std::vector<PublishMessage> messages);
+    void idleWait();
+    bool idle() const { return retry_.empty() && tracker_.empty() && queue_.sizeApprox() == 0; }
+    void sleepFor(std::chrono::milliseconds duration);
+
+    RabbitMQPublisher& owner_;
+    size_t index_;
+    MpscQueue<PublishMessage> queue_;
+    ConfirmTracker tracker_;
+    // Отвергнутые и оборванные на прошлом соединении — отправляются раньше очереди
+    std::deque<PublishMessage> retry_;
+
+    std::atomic<uint32_t> wake_{0};
+    std::atomic<bool> sleeping_{false};
+    std::atomic<size_t> unconfirmed_{0};
+    std::atomic<bool> connected_{false};
+    bool everConnected_ = false;
+
+    amqp_connection_state_t conn_ = nullptr;
+    std::thread thread_;
+};
+
+void RabbitMQPublisher::IoThread::run() {
+    auto backoff = RECONNECT_MIN;
+    std::optional<std::chrono::steady_clock::time_point> drainDeadline;
+
+    while (true) {
+        if (owner_.stopping_.load(std::memory_order_acquire)) {
+            auto now = std::chrono::steady_clock::now();
+            if (!drainDeadline) {
+                drainDeadline = now + owner_.config_.drain_timeout;
+            }
+            if (idle() || !connected_ || now >= *drainDeadline) {
+                break;
+            }
+        }
+
+        if (!connected_) {
+            if (!connect()) {
+                sleepFor(backoff);
+                backoff = std::min(backoff * 2, RECONNECT_MAX);
+                continue;
+            }
+            backoff = RECONNECT_MIN;
+        }
+
+        bool progressed = publishPending();
+        if (!connected_) {
+            continue;
+        }
+        if (!tracker_.empty()) {
+            pollConfirms(progressed ? std::chrono::milliseconds::zero() : CONFIRM_POLL);
+        } else if (!progressed) {
+            idleWait();
+        }
+    }
+
+    // Недоставленное в порядке отправки: неподтверждённое, повторы, очередь
+    auto left = tracker_.reset();
+    unconfirmed_.store(0, std::memory_order_relaxed);
+    left.insert(left.end(), std::make_move_iterator(retry_.begin()), std::make_move_iterator(retry_.end()));
+    retry_.clear();
+    PublishMessage message;
+    while (queue_.tryPop(message)) {
+        left.push_back(std::move(message));
+    }
+
+    size_t handedOff = 0;
+    for (const auto& pending : left) {
+        handedOff += owner_.handOff(pending) ? 1 : 0;
+    }
+    const size_t lost = left.size() - handedOff;
+    owner_.counters_.handed_off.fetch_add(handedOff, std::memory_order_relaxed);
+    owner_.counters_.dropped.fetch_add(lost, std::memory_order_relaxed);
+    if (!left.empty()) {
+        std::cerr << "[RabbitMQ] Publisher " << index_ << " stopped with " << left.size()
+                  << " unconfirmed messages, " << handedOff << " handed off, " << lost << " dropped"
+                  << std::endl;
+    }
+    disconnect();
 }
 
-bool RabbitMQ::connect() {
-    std::lock_guard<std::mutex> lock(mutex_);
+bool RabbitMQPublisher::IoThread::connect() {
+    const auto& config = owner_.config_;
 
     conn_ = amqp_new_connection();
     if (!conn_) {
@@ -26,89 +258,332 @@ bool RabbitMQ::connect() {
         return false;
     }
 
-    socket_ = amqp_tcp_socket_new(conn_);
-    if (!socket_) {
-        std::cerr << "[RabbitMQ] Failed to create TCP socket" << std::endl;
+    auto fail = [this](const char* context) {
+        std::cerr << "[RabbitMQ] Publisher " << index_ << ": " << context << " failed" << std::endl;
+        amqp_destroy_connection(conn_);
+        conn_ = nullptr;
         return false;
+    };
+
+    amqp_socket_t* socket = amqp_tcp_socket_new(conn_);
+    if (!socket) {
+        return fail("Creating TCP socket");
     }
 
-    int status = amqp_socket_open(socket_, host_.c_str(), port_);
+    auto timeout = toTimeval(CONNECT_TIMEOUT);
+    int status = amqp_socket_open_noblock(socket, config.host.c_str(), config.port, &timeout);
     if (status != AMQP_STATUS_OK) {
-        std::cerr << "[RabbitMQ] Failed to open socket: " << amqp_error_string2(status) << std::endl;
-        return false;
+        return fail("Opening socket");
     }
 
-    amqp_rpc_reply_t reply = amqp_login(conn_, vhost_.c_str(), 0, 131072, 0,
+    amqp_rpc_reply_t reply = amqp_login(conn_, config.vhost.c_str(), 0, 131072, 0,
                                          AMQP_SASL_METHOD_PLAIN,
-                                         username_.c_str(), password_.c_str());
+                                         config.username.c_str(), config.password.c_str());
     if (reply.reply_type != AMQP_RESPONSE_NORMAL) {
-        std::cerr << "[RabbitMQ] Login failed" << std::endl;
-        return false;
+        return fail("Login");
     }
 
-    amqp_channel_open(conn_, 1);
-    if (!checkRpcReply("Opening channel")) {
-        return false;
+    amqp_channel_open(conn_, CHANNEL);
+    if (amqp_get_rpc_reply(conn_).reply_type != AMQP_RESPONSE_NORMAL) {
+        return fail("Opening channel");
     }
 
-    // Объявляем очереди
-    const char* queues[] = {"page_views", "clicks", "performance_events", "error_events", "custom_events"};
-    for (const char* queue : queues) {
-        amqp_queue_declare(conn_, 1, amqp_cstring_bytes(queue),
-                          0,  // passive
-                          1,  // durable
-                          0,  // exclusive
-                          0,  // auto_delete
-                          amqp_empty_table);
-        if (!checkRpcReply("Declaring queue")) {
-            std::cerr << "[RabbitMQ] Failed to declare queue: " << queue << std::endl;
-        } else {
-            std::cout << "[RabbitMQ] Queue declared: " << queue << std::endl;
+    // После confirm.select брокер подтверждает каждую публикацию basic.ack/basic.nack
+    amqp_confirm_select(conn_, CHANNEL);
+    if (amqp_get_rpc_reply(conn_).reply_type != AMQP_RESPONSE_NORMAL) {
+        return fail("Enabling publisher confirms");
+    }
+
+    for (const auto& queue : config.queues) {
+        amqp_queue_declare(conn_, CHANNEL, amqp_cstring_bytes(queue.c_str()),
+                           0,  // passive
+                           1,  // durable
+                           0,  // exclusive
+                           0,  // auto_delete
+                           amqp_empty_table);
+        if (amqp_get_rpc_reply(conn_).reply_type != AMQP_RESPONSE_NORMAL) {
+            // Ошибка объявления закрывает канал — продолжать на нём нельзя
+            return fail("Declaring queue");
         }
     }
 
+    if (everConnected_) {
+        owner_.counters_.reconnects.fetch_add(1, std::memory_order_relaxed);
+    }
+    everConnected_ = true;
     connected_ = true;
-    std::cout << "[RabbitMQ] Connected to " << host_ << ":" << port_ << std::endl;
+    std::cout << "[RabbitMQ] Publisher " << index_ << " connected to " << config.host << ":"
+              << config.port << std::endl;
     return true;
 }
 
-bool RabbitMQ::checkRpcReply(const char* context) {
-    amqp_rpc_reply_t reply = amqp_get_rpc_reply(conn_);
-    if (reply.reply_type != AMQP_RESPONSE_NORMAL) {
-        std::cerr << "[RabbitMQ] " << context << " failed" << std::endl;
-        return false;
+void RabbitMQPublisher::IoThread::disconnect() {
+    if (!conn_) {
+        return;
     }
-    return true;
+    if (connected_) {
+        amqp_channel_close(conn_, CHANNEL, AMQP_REPLY_SUCCESS);
+        amqp_connection_close(conn_, AMQP_REPLY_SUCCESS);
+    }
+    amqp_destroy_connection(conn_);
+    conn_ = nullptr;
+    connected_ = false;
 }
 
-bool RabbitMQ::publish(const std::string& exchange, const std::string& routing_key,
-                       const std::string& message) {
-    std::lock_guard<std::mutex> lock(mutex_);
+void RabbitMQPublisher::IoThread::dropConnection(const char* reason) {
+    std::cerr << "[RabbitMQ] Publisher " << index_ << " lost connection: " << reason << std::endl;
 
-    if (!connected_) {
-        std::cerr << "[RabbitMQ] Not connected" << std::endl;
-        return false;
-    }
+    auto pending = tracker_.reset();
+    retry_.insert(retry_.begin(), std::make_move_iterator(pending.begin()),
+                  std::make_move_iterator(pending.end()));
+    unconfirmed_.store(0, std::memory_order_relaxed);
+
+    // Сокет уже неисправен: без close-рукопожатия
+    amqp_destroy_connection(conn_);
+    conn_ = nullptr;
+    connected_ = false;
+}
 
-    amqp_bytes_t exchange_bytes = amqp_cstring_bytes(exchange.c_str());
-    amqp_bytes_t routing_key_bytes = amqp_cstring_bytes(routing_key.c_str());
-    amqp_bytes_t message_bytes;
-    message_bytes.len = message.size();
-    message_bytes.bytes = (void*)message.data();
+bool RabbitMQPublisher::IoThread::send(const PublishMessage& message) {
+    amqp_bytes_t body;
+    body.len = message.body.size();
+    body.bytes = const_cast<char*>(message.body.data());
 
     amqp_basic_properties_t props;
     props._flags = AMQP_BASIC_CONTENT_TYPE_FLAG | AMQP_BASIC_DELIVERY_MODE_FLAG;
-    props.content_type = amqp_cstring_bytes("application/json");
+    props.content_type = amqp_cstring_bytes(contentType(message.format));
     props.delivery_mode = 2; // persistent
 
-    int status = amqp_basic_publish(conn_, 1, exchange_bytes, routing_key_bytes,
-                                     0, 0, &props, message_bytes);
-    
+    int status = amqp_basic_publish(conn_, CHANNEL, amqp_empty_bytes,
+                                    amqp_cstring_bytes(message.routing_key.c_str()),
+                                    0, 0, &props, body);
     if (status != AMQP_STATUS_OK) {
         std::cerr << "[RabbitMQ] Publish failed: " << amqp_error_string2(status) << std::endl;
         return false;
     }
-
-    std::cout << "[RabbitMQ] Published to queue '" << routing_key << "': " << message.substr(0, 100) << std::endl;
     return true;
 }
+
+bool RabbitMQPublisher::IoThread::publishPending() {
+    auto& counters = owner_.counters_;
+    bool progressed = false;
+
+    while (tracker_.size() < owner_.config_.confirm_window) {
+        PublishMessage message;
+        if (!retry_.empty()) {
+            message = std::move(retry_.front());
+            retry_.pop_front();
+        } else if (!queue_.tryPop(message)) {
+            break;
+        }
+
+        if (!send(message)) {
+            retry_.push_front(std::move(message));
+            dropConnection("publish failed");
+            break;
+        }
+
+        if (message.attempts > 0) {
+            counters.republished.fetch_add(1, std::memory_order_relaxed);
+        }
+        ++message.attempts;
+        tracker_.track(std::move(message));
+        counters.published.fetch_add(1, std::memory_order_relaxed);
+        progressed = true;
+    }
+
+    unconfirmed_.store(tracker_.size(), std::memory_order_relaxed);
+    return progressed;
+}
+
+void RabbitMQPublisher::IoThread::pollConfirms(std::chrono::milliseconds timeout) {
+    auto& counters = owner_.counters_;
+    auto tv = toTimeval(timeout);
+
+    while (true) {
+        amqp_frame_t frame;
+        int status = amqp_simple_wait_frame_noblock(conn_, &frame, &tv);
+        if (status == AMQP_STATUS_TIMEOUT) {
+            break;
+        }
+        if (status != AMQP_STATUS_OK) {
+            dropConnection(amqp_error_string2(status));
+            return;
+        }
+        // Остальные уже пришедшие фреймы разбираем без ожидания
+        tv = toTimeval(std::chrono::microseconds::zero());
+
+        if (frame.frame_type != AMQP_FRAME_METHOD) {
+            continue;
+        }
+        switch (frame.payload.method.id) {
+            case AMQP_BASIC_ACK_METHOD: {
+                auto* ack = static_cast<amqp_basic_ack_t*>(frame.payload.method.decoded);
+                counters.confirmed.fetch_add(tracker_.ack(ack->delivery_tag, ack->multiple),
+                                             std::memory_order_relaxed);
+                break;
+            }
+            case AMQP_BASIC_NACK_METHOD: {
+                auto* nack = static_cast<amqp_basic_nack_t*>(frame.payload.method.decoded);
+                handleNack(tracker_.nack(nack->delivery_tag, nack->multiple));
+                break;
+            }
+            case AMQP_CHANNEL_CLOSE_METHOD:
+                dropConnection("channel closed by broker");
+                return;
+            case AMQP_CONNECTION_CLOSE_METHOD:
+                dropConnection("connection closed by broker");
+                return;
+            default:
+                break;
+        }
+    }
+
+    amqp_maybe_release_buffers(conn_);
+    unconfirmed_.store(tracker_.size(), std::memory_order_relaxed);
+}
+
+void RabbitMQPublisher::IoThread::handleNack(std::vector<PublishMessage> messages) {
+    auto& counters = owner_.counters_;
+    counters.nacked.fetch_add(messages.size(), std::memory_order_relaxed);
+
+    for (auto& message : messages) {
+        if (message.attempts < owner_.config_.max_attempts) {
+            retry_.push_back(std::move(message));
+        } else {
+            counters.dropped.fetch_add(1, std::memory_order_relaxed);
+            std::cerr << "[RabbitMQ] Dropping message to '" << message.routing_key << "' after "
+                      << message.attempts << " nacks" << std::endl;
+            if (message.on_give_up) {
+                message.on_give_up(message);
+            }
+        }
+    }
+}
+
+void RabbitMQPublisher::IoThread::idleWait() {
+    sleeping_.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    uint32_t seen = wake_.load(std::memory_order_acquire);
+    if (queue_.sizeApprox() == 0 && !owner_.stopping_.load(std::memory_order_acquire)) {
+        wake_.wait(seen, std::memory_order_acquire);
+    }
+    sleeping_.store(false, std::memory_order_relaxed);
+}
+
+void RabbitMQPublisher::IoThread::sleepFor(std::chrono::milliseconds duration) {
+    constexpr std::chrono::milliseconds slice{50};
+    auto deadline = std::chrono::steady_clock::now() + duration;
+    while (!owner_.stopping_.load(std::memory_order_acquire) &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(slice);
+    }
+}
+
+// ==================== RabbitMQPublisher ====================
+
+RabbitMQPublisher::RabbitMQPublisher(RabbitMQConfig config) : config_(std::move(config)) {
+    config_.io_threads = std::max<size_t>(config_.io_threads, 1);
+    threads_.reserve(config_.io_threads);
+    for (size_t i = 0; i < config_.io_threads; ++i) {
+        threads_.push_back(std::make_unique<IoThread>(*this, i));
+    }
+}
+
+RabbitMQPublisher::~RabbitMQPublisher() {
+    stop();
+}
+
+void RabbitMQPublisher::stop() {
+    stopping_.store(true, std::memory_order_release);
+    for (auto& thread : threads_) {
+        thread->wake();
+    }
+    for (auto& thread : threads_) {
+        thread->join();
+    }
+}
+
+void RabbitMQPublisher::setShutdownSink(ShutdownSink sink) {
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    sink_ = std::move(sink);
+}
+
+bool RabbitMQPublisher::handOff(const PublishMessage& message) {
+    std::lock_guard<std::mutex> lock(sinkMutex_);
+    return sink_ && sink_(message);
+}
+
+PublishStatus RabbitMQPublisher::publish(PublishMessage&& message) {
+    if (stopping_.load(std::memory_order_acquire)) {
+        return PublishStatus::Stopped;
+    }
+
+    // Round-robin; если очередь выбранного потока полна — пробуем остальные
+    const size_t count = threads_.size();
+    const size_t start = next_.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        if (threads_[(start + i) % count]->push(message)) {
+            counters_.queued.fetch_add(1, std::memory_order_relaxed);
+            return PublishStatus::Queued;
+        }
+    }
+
+    counters_.rejected.fetch_add(1, std::memory_order_relaxed);
+    return PublishStatus::QueueFull;
+}
+
+bool RabbitMQPublisher::connected() const {
+    return std::any_of(threads_.begin(), threads_.end(),
+                       [](const auto& thread) { return thread->connected(); });
+}
+
+PublisherStats RabbitMQPublisher::stats() const {
+    PublisherStats s;
+    s.queued = counters_.queued.load(std::memory_order_relaxed);
+    s.rejected = counters_.rejected.load(std::memory_order_relaxed);
+    s.published = counters_.published.load(std::memory_order_relaxed);
+    s.confirmed = counters_.confirmed.load(std::memory_order_relaxed);
+    s.nacked = counters_.nacked.load(std::memory_order_relaxed);
+    s.republished = counters_.republished.load(std::memory_order_relaxed);
+    s.dropped = counters_.dropped.load(std::memory_order_relaxed);
+    s.handed_off = counters_.handed_off.load(std::memory_order_relaxed);
+    s.reconnects = counters_.reconnects.load(std::memory_order_relaxed);
+    for (const auto& thread : threads_) {
+        s.unconfirmed += thread->unconfirmed();
+        s.queue_depth += thread->depth();
+        s.queue_capacity += thread->capacity();
+        s.connected_threads += thread->connected() ? 1 : 0;
+    }
+    return s;
+}
+
+std::string RabbitMQPublisher::formatMetrics() const {
+    auto s = stats();
+
+    std::ostringstream out;
+    auto metric = [&out](const char* name, const char* type, const char* help, auto value) {
+        out << "# HELP " << name << " " << help << "\n"
+            << "# TYPE " << name << " " << type << "\n"
+            << name << " " << value << "\n";
+    };
+
+    metric("api_rabbitmq_queued_total", "counter", "Events accepted into the publish queue", s.queued);
+    metric("api_rabbitmq_rejected_total", "counter", "Events rejected with 503 because the publish queue was full",
+           s.rejected);
+    metric("api_rabbitmq_published_total", "counter", "basic.publish calls, including retries", s.published);
+    metric("api_rabbitmq_confirmed_total", "counter", "Messages confirmed by the broker", s.confirmed);
+    metric("api_rabbitmq_nacked_total", "counter", "Messages nacked by the broker", s.nacked);
+    metric("api_rabbitmq_republished_total", "counter", "Messages sent again after a nack or reconnect",
+           s.republished);
+    metric("api_rabbitmq_dropped_total", "counter", "Messages given up on without a broker confirm", s.dropped);
+    metric("api_rabbitmq_handed_off_total", "counter", "Undelivered messages handed to the shutdown sink",
+           s.handed_off);
+    metric("api_rabbitmq_reconnects_total", "counter", "Publisher reconnections", s.reconnects);
+    metric("api_rabbitmq_unconfirmed", "gauge", "Published messages awaiting a broker confirm", s.unconfirmed);
+    metric("api_rabbitmq_queue_depth", "gauge", "Events waiting in the publish queue", s.queue_depth);
+    metric("api_rabbitmq_queue_capacity", "gauge", "Total publish queue capacity", s.queue_capacity);
+    metric("api_rabbitmq_connected_threads", "gauge", "Publisher I/O threads with an open channel",
+           s.connected_threads);
+    return out.str();
+}
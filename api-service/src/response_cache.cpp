@@ -0,0 +1,144 @@
+#include "response_cache.hpp"
+
+#include <sstream>
+
+// Оценка накладных расходов на запись: узлы списка и хеш-таблицы
+static constexpr size_t ENTRY_OVERHEAD = 128;
+
+double ResponseCache::Stats::hitRatio() const {
+    uint64_t total = hits + misses + coalesced;
+    return total == 0 ? 0.0 : static_cast<double>(hits + coalesced) / static_cast<double>(total);
+}
+
+ResponseCache::ResponseCache(Config config, WatermarkFetcher watermark)
+    : config_(config), watermark_(std::move(watermark)) {}
+
+void ResponseCache::checkWatermark() {
+    std::unique_lock check(checkMutex_, std::try_to_lock);
+    if (!check.owns_lock()) {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (lastCheck_ && now - *lastCheck_ < config_.checkInterval) {
+        return;
+    }
+    lastCheck_ = now;
+
+    auto current = watermark_();
+    if (!current || current != knownWatermark_) {
+        std::lock_guard lock(mutex_);
+        invalidate();
+        watermarkKnown_ = current.has_value();
+    }
+    knownWatermark_ = current;
+}
+
+CachedResponse ResponseCache::get(const std::string& key, const Fetch& fetch) {
+    checkWatermark();
+
+    std::promise<CachedResponse> promise;
+    uint64_t generation = 0;
+    {
+        std::unique_lock lock(mutex_);
+        if (auto it = index_.find(key); it != index_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second);
+            ++counters_.hits;
+            return it->second->response;
+        }
+        if (auto it = inFlight_.find(key); it != inFlight_.end()) {
+            auto pending = it->second;
+            ++counters_.coalesced;
+            lock.unlock();
+            return pending.get();
+        }
+
+        ++counters_.misses;
+        inFlight_.emplace(key, promise.get_future().share());
+        generation = generation_;
+    }
+
+    CachedResponse response;
+    try {
+        response = fetch();
+    } catch (...) {
+        {
+            std::lock_guard lock(mutex_);
+            inFlight_.erase(key);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        inFlight_.erase(key);
+        if (response.status == 200 && generation == generation_ && watermarkKnown_) {
+            insert(key, response);
+        }
+    }
+    promise.set_value(response);
+    return response;
+}
+
+void ResponseCache::insert(const std::string& key, const CachedResponse& response) {
+    size_t bytes = ENTRY_OVERHEAD + 2 * key.size() + response.body.size();
+    if (bytes > config_.maxBytes) {
+        return;
+    }
+
+    lru_.push_front(Entry{key, response, bytes});
+    index_[key] = lru_.begin();
+    bytes_ += bytes;
+
+    while (bytes_ > config_.maxBytes) {
+        auto& oldest = lru_.back();
+        bytes_ -= oldest.bytes;
+        index_.erase(oldest.key);
+        lru_.pop_back();
+    }
+}
+
+void ResponseCache::invalidate() {
+    lru_.clear();
+    index_.clear();
+    bytes_ = 0;
+    ++generation_;
+    ++counters_.invalidations;
+}
+
+void ResponseCache::clear() {
+    std::lock_guard lock(mutex_);
+    invalidate();
+}
+
+ResponseCache::Stats ResponseCache::stats() const {
+    std::lock_guard lock(mutex_);
+    Stats result = counters_;
+    result.entries = index_.size();
+    result.bytes = bytes_;
+    return result;
+}
+
+std::string ResponseCache::formatMetrics() const {
+    auto s = stats();
+
+    std::ostringstream out;
+    auto metric = [&out](const char* name, const char* type, const char* help, auto value) {
+        out << "# HELP " << name << " " << help << "\n"
+            << "# TYPE " << name << " " << type << "\n"
+            << name << " " << value << "\n";
+    };
+
+    metric("api_response_cache_hits_total", "counter", "Aggregation responses served from the cache", s.hits);
+    metric("api_response_cache_misses_total", "counter", "Aggregation requests sent upstream", s.misses);
+    metric("api_response_cache_coalesced_total", "counter", "Requests that waited for an identical upstream call",
+           s.coalesced);
+    metric("api_response_cache_invalidations_total", "counter", "Cache flushes on watermark change",
+           s.invalidations);
+    metric("api_response_cache_hit_ratio", "gauge", "Share of requests served without an own upstream call",
+           s.hitRatio());
+    metric("api_response_cache_entries", "gauge", "Cached responses", s.entries);
+    metric("api_response_cache_bytes", "gauge", "Estimated memory used by cached responses", s.bytes);
+    return out.str();
+}
@@ -0,0 +1,544 @@
+#include "spool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char MAGIC[8] = {'A', 'P', 'I', 'S', 'P', 'L', '0', '2'};
+// Сегменты первой версии: без байта формата, все тела — JSON
+constexpr char MAGIC_V1[8] = {'A', 'P', 'I', 'S', 'P', 'O', 'O', 'L'};
+constexpr size_t SEGMENT_HEADER = sizeof(MAGIC);
+// Запись: u32 длина полезной нагрузки, u32 crc32, затем u16 длина ключа, u8 формат тела,
+// ключ, тело. Длина пишется последней: ненулевая длина значит, что запись целиком на месте
+constexpr size_t RECORD_HEADER = 8;
+constexpr size_t RECORD_ALIGN = 8;
+// Как часто сохранять подтверждённую позицию; после сбоя повторится не больше стольких записей
+constexpr uint64_t CURSOR_SAVE_EVERY = 1024;
+// Смещение в позиции: сегмент прочитан и подтверждён целиком
+constexpr uint64_t SEGMENT_DONE = std::numeric_limits<uint64_t>::max();
+
+constexpr std::chrono::milliseconds IDLE_POLL{50};
+constexpr std::chrono::milliseconds RETRY_MIN{50};
+constexpr std::chrono::milliseconds RETRY_MAX{5000};
+
+size_t recordSize(uint32_t payload) {
+    size_t size = RECORD_HEADER + payload;
+    return (size + RECORD_ALIGN - 1) / RECORD_ALIGN * RECORD_ALIGN;
+}
+
+uint32_t checksum(const char* data, size_t size) {
+    return static_cast<uint32_t>(crc32(0, reinterpret_cast<const Bytef*>(data), static_cast<uInt>(size)));
+}
+
+std::string segmentName(uint64_t seq) {
+    char name[40];
+    std::snprintf(name, sizeof(name), "segment-%020llu.log", static_cast<unsigned long long>(seq));
+    return name;
+}
+
+// 0 — имя не похоже на сегмент
+uint64_t parseSegmentName(const std::string& name) {
+    unsigned long long seq = 0;
+    char tail[8] = {};
+    if (std::sscanf(name.c_str(), "segment-%20llu.%4s", &seq, tail) != 2 || std::strcmp(tail, "log") != 0) {
+        return 0;
+    }
+    return seq;
+}
+
+} // namespace
+
+struct Spool::Segment {
+    uint64_t seq = 0;
+    std::string path;
+    char* data = nullptr;
+    size_t size = 0;
+    // Граница, дальше которой записей нет: у восстановленного — конец последней целой записи
+    size_t limit = 0;
+    // С этого смещения начинается чтение (позиция из cursor для первого сегмента)
+    size_t readStart = SEGMENT_HEADER;
+    // Только для активного сегмента, под writeMutex_
+    size_t writeOffset = SEGMENT_HEADER;
+    bool hasFormat = true;
+
+    // Длина ключа и формат перед ключом
+    size_t recordPrefix() const { return sizeof(uint16_t) + (hasFormat ? 1 : 0); }
+
+    ~Segment() {
+        if (data) {
+            munmap(data, size);
+        }
+    }
+};
+
+// ==================== Spool ====================
+
+Spool::Spool(Config config) : config_(std::move(config)), anchor_(std::make_shared<Anchor>()) {
+    if (config_.segmentBytes <= SEGMENT_HEADER + RECORD_HEADER) {
+        throw std::runtime_error("Spool: segment size is too small");
+    }
+    std::error_code ec;
+    fs::create_directories(config_.dir, ec);
+    if (ec) {
+        throw std::runtime_error("Spool: cannot create " + config_.dir + ": " + ec.message());
+    }
+    cursorPath_ = (fs::path(config_.dir) / "cursor").string();
+    recover();
+    anchor_->spool = this;
+}
+
+Spool::~Spool() {
+    {
+        std::lock_guard<std::mutex> lock(anchor_->mutex);
+        anchor_->spool = nullptr;
+    }
+    std::lock_guard<std::mutex> lock(commitMutex_);
+    saveCursor();
+}
+
+void Spool::recover() {
+    std::vector<std::pair<uint64_t, fs::path>> files;
+    for (const auto& entry : fs::directory_iterator(config_.dir)) {
+        if (uint64_t seq = parseSegmentName(entry.path().filename().string())) {
+            files.emplace_back(seq, entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    uint64_t cursorSeq = 0;
+    uint64_t cursorOffset = 0;
+    if (std::ifstream cursor(cursorPath_, std::ios::binary); cursor) {
+        cursor.read(reinterpret_cast<char*>(&cursorSeq), sizeof(cursorSeq));
+        cursor.read(reinterpret_cast<char*>(&cursorOffset), sizeof(cursorOffset));
+        if (!cursor) {
+            cursorSeq = cursorOffset = 0;
+        }
+    }
+
+    uint64_t recovered = 0;
+    for (const auto& [seq, path] : files) {
+        nextSeq_ = std::max(nextSeq_, seq + 1);
+        if (seq < cursorSeq || (seq == cursorSeq && cursorOffset == SEGMENT_DONE)) {
+            fs::remove(path);
+            continue;
+        }
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Spool: cannot open " + path.string());
+        }
+        auto size = static_cast<size_t>(::lseek(fd, 0, SEEK_END));
+        void* data = size > SEGMENT_HEADER ? mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+        ::close(fd);
+        if (data == MAP_FAILED || (std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0 &&
+                                   std::memcmp(data, MAGIC_V1, sizeof(MAGIC_V1)) != 0)) {
+            std::cerr << "[Spool] Skipping malformed segment " << path << std::endl;
+            if (data != MAP_FAILED) {
+                munmap(data, size);
+            }
+            fs::remove(path);
+            continue;
+        }
+
+        auto segment = std::make_shared<Segment>();
+        segment->seq = seq;
+        segment->path = path.string();
+        segment->data = static_cast<char*>(data);
+        segment->size = size;
+        segment->limit = size;
+        segment->hasFormat = std::memcmp(data, MAGIC, sizeof(MAGIC)) == 0;
+        if (seq == cursorSeq && cursorOffset >= SEGMENT_HEADER && cursorOffset <= size) {
+            segment->readStart = static_cast<size_t>(cursorOffset);
+        }
+
+        // Считаем целые записи; первая битая (недописанная при сбое) — конец сегмента
+        size_t offset = segment->readStart;
+        while (uint32_t length = recordLength(*segment, offset)) {
+            const char* payload = segment->data + offset + RECORD_HEADER;
+            uint32_t crc;
+            std::memcpy(&crc, segment->data + offset + 4, sizeof(crc));
+            if (length < segment->recordPrefix() || checksum(payload, length) != crc) {
+                std::cerr << "[Spool] Truncating " << path << " at offset " << offset << std::endl;
+                break;
+            }
+            offset += recordSize(length);
+            ++recovered;
+        }
+        segment->limit = offset;
+
+        bytes_ += size;
+        segments_.push_back(std::move(segment));
+    }
+
+    if (!segments_.empty()) {
+        committed_ = Position{segments_.front()->seq, segments_.front()->readStart};
+    }
+    pending_.store(recovered, std::memory_order_release);
+    if (recovered > 0) {
+        std::cout << "[Spool] Recovered " << recovered << " events from " << segments_.size()
+                  << " segments in " << config_.dir << std::endl;
+    }
+}
+
+std::shared_ptr<Spool::Segment> Spool::createSegment() {
+    auto segment = std::make_shared<Segment>();
+    segment->seq = nextSeq_;
+    segment->path = (fs::path(config_.dir) / segmentName(segment->seq)).string();
+    segment->size = config_.segmentBytes;
+    segment->limit = segment->size;
+
+    int fd = ::open(segment->path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "[Spool] Cannot create " << segment->path << ": " << std::strerror(errno) << std::endl;
+        return nullptr;
+    }
+    // Место резервируется сразу: нехватка диска — отказ здесь, а не SIGBUS при записи в mmap
+    int error = posix_fallocate(fd, 0, static_cast<off_t>(segment->size));
+    void* data = error == 0 ? mmap(nullptr, segment->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                            : MAP_FAILED;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        std::cerr << "[Spool] Cannot allocate " << segment->path << ": "
+                  << std::strerror(error != 0 ? error : errno) << std::endl;
+        ::unlink(segment->path.c_str());
+        return nullptr;
+    }
+
+    segment->data = static_cast<char*>(data);
+    std::memcpy(segment->data, MAGIC, sizeof(MAGIC));
+    ++nextSeq_;
+    return segment;
+}
+
+bool Spool::append(const PublishMessage& message) {
+    const size_t payload = sizeof(uint16_t) + 1 + message.routing_key.size() + message.body.size();
+    const size_t need = recordSize(static_cast<uint32_t>(std::min<size_t>(payload, UINT32_MAX)));
+    if (message.routing_key.size() > std::numeric_limits<uint16_t>::max() ||
+        need > config_.segmentBytes - SEGMENT_HEADER) {
+        rejected_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(writeMutex_);
+
+    if (!active_ || active_->writeOffset + need > active_->size) {
+        {
+            std::lock_guard<std::mutex> segmentsLock(segmentsMutex_);
+            if (bytes_ + config_.segmentBytes > config_.maxBytes) {
+                rejected_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        auto segment = createSegment();
+        if (!segment) {
+            rejected_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> segmentsLock(segmentsMutex_);
+            segments_.push_back(segment);
+            bytes_ += segment->size;
+        }
+        active_ = std::move(segment);
+        activeSeq_.store(active_->seq, std::memory_order_release);
+    }
+
+    char* record = active_->data + active_->writeOffset;
+    char* out = record + RECORD_HEADER;
+    auto keyLength = static_cast<uint16_t>(message.routing_key.size());
+    std::memcpy(out, &keyLength, sizeof(keyLength));
+    out[sizeof(keyLength)] = static_cast<char>(message.format);
+    char* key = out + active_->recordPrefix();
+    std::memcpy(key, message.routing_key.data(), keyLength);
+    std::memcpy(key + keyLength, message.body.data(), message.body.size());
+
+    uint32_t crc = checksum(out, payload);
+    std::memcpy(record + 4, &crc, sizeof(crc));
+    std::atomic_ref<uint32_t>(*reinterpret_cast<uint32_t*>(record))
+        .store(static_cast<uint32_t>(payload), std::memory_order_release);
+
+    active_->writeOffset += need;
+    appended_.fetch_add(1, std::memory_order_relaxed);
+    pending_.fetch_add(1, std::memory_order_release);
+    return true;
+}
+
+uint32_t Spool::recordLength(const Segment& segment, size_t offset) const {
+    if (offset + RECORD_HEADER > segment.limit) {
+        return 0;
+    }
+    uint32_t length = std::atomic_ref<uint32_t>(*reinterpret_cast<uint32_t*>(segment.data + offset))
+                          .load(std::memory_order_acquire);
+    if (length > segment.limit - offset - RECORD_HEADER) {
+        return 0;
+    }
+    return length;
+}
+
+bool Spool::peek(PublishMessage& out) {
+    while (true) {
+        if (!readSegment_) {
+            std::lock_guard<std::mutex> lock(segmentsMutex_);
+            // Дочитанные сегменты остаются в списке, пока их записи не подтверждены
+            auto next = std::find_if(segments_.begin(), segments_.end(),
+                                     [this](const auto& segment) { return segment->seq > readSeq_; });
+            if (next == segments_.end()) {
+                return false;
+            }
+            readSegment_ = *next;
+            readSeq_ = readSegment_->seq;
+            readOffset_ = readSegment_->readStart;
+        }
+
+        uint32_t length = recordLength(*readSegment_, readOffset_);
+        if (length == 0) {
+            if (readSegment_->seq == activeSeq_.load(std::memory_order_acquire)) {
+                return false;  // писатель ещё может дописать
+            }
+            // Запись могла появиться до переключения на следующий сегмент
+            length = recordLength(*readSegment_, readOffset_);
+        }
+        if (length == 0) {
+            {
+                std::lock_guard<std::mutex> lock(commitMutex_);
+                track({readSegment_->seq, SEGMENT_DONE}, true);
+            }
+            readSegment_.reset();
+            continue;
+        }
+
+        const char* payload = readSegment_->data + readOffset_ + RECORD_HEADER;
+        const size_t prefix = readSegment_->recordPrefix();
+        uint16_t keyLength;
+        std::memcpy(&keyLength, payload, sizeof(keyLength));
+        out.format = readSegment_->hasFormat && payload[sizeof(keyLength)] == static_cast<char>(PayloadFormat::Protobuf)
+                         ? PayloadFormat::Protobuf
+                         : PayloadFormat::Json;
+        out.routing_key.assign(payload + prefix, keyLength);
+        out.body.assign(payload + prefix + keyLength, length - prefix - keyLength);
+        out.attempts = 0;
+        peekedLength_ = length;
+
+        const Position position{readSegment_->seq, readOffset_ + recordSize(length)};
+        {
+            std::lock_guard<std::mutex> lock(commitMutex_);
+            track(position, false);
+        }
+        out.on_confirm = [anchor = anchor_, position] {
+            std::lock_guard<std::mutex> lock(anchor->mutex);
+            if (anchor->spool) {
+                std::lock_guard<std::mutex> commitLock(anchor->spool->commitMutex_);
+                anchor->spool->confirm(position);
+            }
+        };
+        // Запись не удаляется с диска, пока её копия не легла в конец журнала;
+        // если места нет, позиция остаётся неподтверждённой до рестарта
+        out.on_give_up = [anchor = anchor_, position](const PublishMessage& message) {
+            std::lock_guard<std::mutex> lock(anchor->mutex);
+            if (anchor->spool && anchor->spool->append(message)) {
+                anchor->spool->requeued_.fetch_add(1, std::memory_order_relaxed);
+                std::lock_guard<std::mutex> commitLock(anchor->spool->commitMutex_);
+                anchor->spool->confirm(position);
+            }
+        };
+        return true;
+    }
+}
+
+void Spool::pop() {
+    readOffset_ += recordSize(peekedLength_);
+    peekedLength_ = 0;
+    pending_.fetch_sub(1, std::memory_order_release);
+    replayed_.fetch_add(1, std::memory_order_relaxed);
+}
+
+// Позиции добавляются по порядку чтения; повторный peek той же записи её не дублирует
+void Spool::track(Position position, bool confirmed) {
+    if (position <= committed_ || (!inFlight_.empty() && position <= inFlight_.back().position)) {
+        return;
+    }
+    inFlight_.push_back({position, confirmed});
+    if (confirmed) {
+        advance();
+    }
+}
+
+// Издатель с несколькими I/O-потоками подтверждает не по порядку
+void Spool::confirm(Position position) {
+    auto it = std::lower_bound(inFlight_.begin(), inFlight_.end(), position,
+                               [](const InFlight& entry, const Position& p) { return entry.position < p; });
+    if (it == inFlight_.end() || it->position != position) {
+        return;
+    }
+    it->confirmed = true;
+    advance();
+}
+
+void Spool::advance() {
+    uint64_t confirmed = 0;
+    bool segmentDone = false;
+    while (!inFlight_.empty() && inFlight_.front().confirmed) {
+        committed_ = inFlight_.front().position;
+        segmentDone |= committed_.offset == SEGMENT_DONE;
+        inFlight_.pop_front();
+        ++confirmed;
+    }
+    if (confirmed == 0) {
+        return;
+    }
+    sinceCursorSave_ += confirmed;
+    if (segmentDone) {
+        // cursor сохраняется раньше удаления: иначе после сбоя он указал бы на удалённый сегмент
+        saveCursor();
+        removeConfirmedSegments();
+    } else if (sinceCursorSave_ >= CURSOR_SAVE_EVERY) {
+        saveCursor();
+    }
+}
+
+// Сегменты, все записи которых подтверждены
+void Spool::removeConfirmedSegments() {
+    std::vector<std::string> paths;
+    {
+        std::lock_guard<std::mutex> lock(segmentsMutex_);
+        while (!segments_.empty()) {
+            const auto& segment = segments_.front();
+            if (segment->seq > committed_.seq ||
+                (segment->seq == committed_.seq && committed_.offset != SEGMENT_DONE)) {
+                break;
+            }
+            bytes_ -= segment->size;
+            paths.push_back(segment->path);
+            segments_.pop_front();
+        }
+    }
+    for (const auto& path : paths) {
+        ::unlink(path.c_str());
+    }
+}
+
+// Запись во временный файл и rename: cursor всегда целый
+void Spool::saveCursor() {
+    uint64_t cursor[2] = {committed_.seq, committed_.offset};
+    const std::string tmp = cursorPath_ + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(cursor), sizeof(cursor));
+        if (!out) {
+            std::cerr << "[Spool] Cannot save cursor to " << tmp << std::endl;
+            return;
+        }
+    }
+    std::error_code ec;
+    fs::rename(tmp, cursorPath_, ec);
+    sinceCursorSave_ = 0;
+}
+
+Spool::Stats Spool::stats() const {
+    Stats s;
+    s.appended = appended_.load(std::memory_order_relaxed);
+    s.replayed = replayed_.load(std::memory_order_relaxed);
+    s.requeued = requeued_.load(std::memory_order_relaxed);
+    s.rejected = rejected_.load(std::memory_order_relaxed);
+    s.pending = pending_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(segmentsMutex_);
+    s.segments = segments_.size();
+    s.bytes = bytes_;
+    return s;
+}
+
+std::string Spool::formatMetrics() const {
+    auto s = stats();
+
+    std::ostringstream out;
+    auto metric = [&out](const char* name, const char* type, const char* help, auto value) {
+        out << "# HELP " << name << " " << help << "\n"
+            << "# TYPE " << name << " " << type << "\n"
+            << name << " " << value << "\n";
+    };
+
+    metric("api_spool_appended_total", "counter", "Events written to the disk spool", s.appended);
+    metric("api_spool_replayed_total", "counter", "Spooled events handed back to the publisher", s.replayed);
+    metric("api_spool_requeued_total", "counter", "Spooled events nacked by the broker and written to the spool again",
+           s.requeued);
+    metric("api_spool_rejected_total", "counter", "Events rejected because the spool disk budget was exhausted",
+           s.rejected);
+    metric("api_spool_pending", "gauge", "Spooled events waiting for replay", s.pending);
+    metric("api_spool_segments", "gauge", "Spool segment files on disk", s.segments);
+    metric("api_spool_bytes", "gauge", "Disk space reserved by spool segments", s.bytes);
+    return out.str();
+}
+
+// ==================== SpoolReplayer ====================
+
+SpoolReplayer::SpoolReplayer(Spool& spool, RabbitMQPublisher& publisher)
+    : spool_(spool), publisher_(publisher) {
+    thread_ = std::thread(&SpoolReplayer::run, this);
+}
+
+SpoolReplayer::~SpoolReplayer() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void SpoolReplayer::run() {
+    auto backoff = RETRY_MIN;
+    PublishMessage message;
+
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (stopping_) {
+                return;
+            }
+        }
+
+        if (spool_.empty()) {
+            sleepFor(IDLE_POLL);
+            continue;
+        }
+        // Издатель сам переподключается; пока канала нет, журнал не трогаем
+        if (!publisher_.connected() || !spool_.peek(message)) {
+            sleepFor(backoff);
+            backoff = std::min(backoff * 2, RETRY_MAX);
+            continue;
+        }
+        if (publisher_.publish(std::move(message)) != PublishStatus::Queued) {
+            sleepFor(backoff);
+            backoff = std::min(backoff * 2, RETRY_MAX);
+            continue;
+        }
+
+        // Из журнала запись уйдёт по on_confirm, когда брокер её подтвердит
+        spool_.pop();
+        backoff = RETRY_MIN;
+    }
+}
+
+void SpoolReplayer::sleepFor(std::chrono::milliseconds duration) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait_for(lock, duration, [this] { return stopping_; });
+}
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+#include "event_encoder.hpp"
+
+#include <cstdlib>
+#include <string>
+
+// ===== Тесты кодирования событий =====
+
+TEST(EventEncoderTest, PageViewProtobufRoundTrip) {
+    PageViewEvent event;
+    event.page = "/home";
+    event.user_id = "user-123";
+    event.timestamp = 1700000000;
+
+    auto message = encodeEvent("page_views", event, PayloadFormat::Protobuf);
+    EXPECT_EQ(message.routing_key, "page_views");
+    EXPECT_EQ(message.format, PayloadFormat::Protobuf);
+
+    metricsys::PageViewEvent decoded;
+    ASSERT_TRUE(decoded.ParseFromString(message.body));
+    EXPECT_EQ(decoded.page(), "/home");
+    ASSERT_TRUE(decoded.has_user_id());
+    EXPECT_EQ(decoded.user_id(), "user-123");
+    EXPECT_FALSE(decoded.has_session_id());
+    EXPECT_FALSE(decoded.has_referrer());
+    EXPECT_EQ(decoded.timestamp(), 1700000000);
+}
+
+TEST(EventEncoderTest, JsonFormatMatchesModelSerialization) {
+    ClickEvent event;
+    event.page = "/home";
+    event.element_id = "btn";
+    event.timestamp = 1700000000;
+
+    auto message = encodeEvent("clicks", event, PayloadFormat::Json);
+    EXPECT_EQ(message.format, PayloadFormat::Json);
+    EXPECT_EQ(message.body, nlohmann::json(event).dump());
+}
+
+TEST(EventEncoderTest, ProtobufIsSmallerThanJson) {
+    PerformanceEvent event;
+    event.page = "/checkout";
+    event.ttfb_ms = 120.5;
+    event.fcp_ms = 340.0;
+    event.lcp_ms = 910.25;
+    event.total_page_load_ms = 1500.0;
+    event.session_id = "session-456";
+    event.timestamp = 1700000000;
+
+    auto proto = encodeEvent("performance_events", event, PayloadFormat::Protobuf);
+    auto text = encodeEvent("performance_events", event, PayloadFormat::Json);
+    EXPECT_LT(proto.body.size(), text.body.size());
+
+    metricsys::PerformanceEvent decoded;
+    ASSERT_TRUE(decoded.ParseFromString(proto.body));
+    EXPECT_DOUBLE_EQ(decoded.lcp_ms(), 910.25);
+    EXPECT_FALSE(decoded.has_user_id());
+}
+
+TEST(EventEncoderTest, ErrorSeverityMapsToProtoEnum) {
+    ErrorEvent event;
+    event.page = "/home";
+    event.error_type = "TypeError";
+    event.message = "x is undefined";
+    event.timestamp = 1700000000;
+
+    event.severity = Severity::Warning;
+    EXPECT_EQ(toProto(event).severity(), metricsys::SEVERITY_WARNING);
+    event.severity = Severity::Error;
+    EXPECT_EQ(toProto(event).severity(), metricsys::SEVERITY_ERROR);
+    event.severity = Severity::Critical;
+    EXPECT_EQ(toProto(event).severity(), metricsys::SEVERITY_CRITICAL);
+}
+
+TEST(EventEncoderTest, CustomPropertiesBecomeStrings) {
+    CustomEvent event;
+    event.name = "signup";
+    event.properties = nlohmann::json{{"plan", "pro"}, {"seats", 5}, {"trial", true}};
+    event.timestamp = 1700000000;
+
+    auto proto = toProto(event);
+    ASSERT_EQ(proto.properties_size(), 3);
+    EXPECT_EQ(proto.properties().at("plan"), "pro");
+    EXPECT_EQ(proto.properties().at("seats"), "5");
+    EXPECT_EQ(proto.properties().at("trial"), "true");
+    EXPECT_FALSE(proto.has_page());
+}
+
+TEST(EventEncoderTest, PayloadFormatFromEnvironment) {
+    unsetenv("API_PAYLOAD_FORMAT");
+    EXPECT_EQ(loadPayloadFormat(), PayloadFormat::Json);
+    setenv("API_PAYLOAD_FORMAT", "protobuf", 1);
+    EXPECT_EQ(loadPayloadFormat(), PayloadFormat::Protobuf);
+    setenv("API_PAYLOAD_FORMAT", "msgpack", 1);
+    EXPECT_EQ(loadPayloadFormat(), PayloadFormat::Json);
+    unsetenv("API_PAYLOAD_FORMAT");
+}
+
+TEST(EventEncoderTest, ContentTypeFollowsFormat) {
+    EXPECT_STREQ(contentType(PayloadFormat::Json), "application/json");
+    EXPECT_STREQ(contentType(PayloadFormat::Protobuf), "application/x-protobuf");
+}
@@ -408,3 +408,58 @@ TEST_F(StringOperationsTest, CaseInsensitiveCompare) {
     EXPECT_TRUE(equal);
 }
 
+
+// ===== Тесты POST /events/batch =====
+// Только элементы, не прошедшие проверку: до публикации в RabbitMQ дело не доходит
+
+class EventsBatchTest : public ::testing::Test {
+protected:
+    nlohmann::json post(const nlohmann::json& body, int expectedStatus) {
+        httplib::Request req;
+        req.body = body.dump();
+        httplib::Response res;
+        handleEventsBatch(req, res);
+        EXPECT_EQ(res.status, expectedStatus);
+        return nlohmann::json::parse(res.body);
+    }
+};
+
+TEST_F(EventsBatchTest, RejectsMissingOrEmptyEvents) {
+    EXPECT_EQ(post({{"items", nlohmann::json::array()}}, 400)["code"], "INVALID_BATCH");
+    EXPECT_EQ(post({{"events", nlohmann::json::array()}}, 400)["code"], "INVALID_BATCH");
+}
+
+TEST_F(EventsBatchTest, RejectsOversizedBatch) {
+    nlohmann::json events = nlohmann::json::array();
+    for (int i = 0; i < 501; ++i) {
+        events.push_back({{"type", "page_view"}, {"page", "/"}, {"timestamp", i}});
+    }
+
+    auto response = post({{"events", events}}, 400);
+    EXPECT_EQ(response["code"], "INVALID_BATCH");
+    EXPECT_EQ(response["details"]["limit"], 500);
+}
+
+TEST_F(EventsBatchTest, ReportsPerItemValidationErrors) {
+    nlohmann::json events = {
+        {{"type", "page_view"}, {"page", ""}, {"timestamp", 1}},
+        {{"type", "click"}, {"page", "/"}, {"element_id", ""}, {"timestamp", 2}},
+        {{"type", "performance"}, {"page", "/"}, {"lcp_ms", -1.0}, {"timestamp", 3}},
+        {{"type", "error"}, {"page", "/"}, {"timestamp", 4}},
+        {{"type", "unknown"}},
+    };
+
+    auto response = post({{"events", events}}, 207);
+    EXPECT_EQ(response["accepted"], 0);
+    EXPECT_EQ(response["rejected"], 5);
+
+    const auto& results = response["results"];
+    ASSERT_EQ(results.size(), 5u);
+    EXPECT_EQ(results[0]["status"], "rejected");
+    EXPECT_EQ(results[0]["error"]["code"], "INVALID_PAGE_VIEW");
+    EXPECT_EQ(results[1]["error"]["details"]["field"], "element_id");
+    EXPECT_EQ(results[2]["error"]["details"]["field"], "lcp_ms");
+    EXPECT_EQ(results[3]["error"]["code"], "INVALID_ERROR_EVENT");
+    EXPECT_EQ(results[4]["index"], 4);
+    EXPECT_EQ(results[4]["error"]["code"], "INVALID_BATCH");
+}
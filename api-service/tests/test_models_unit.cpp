@@ -430,3 +430,23 @@ TEST_F(JsonSerializationTest, ErrorEventRoundTrip) {
     EXPECT_EQ(original.severity, deserialized.severity);
 }
 
+
+// ===== Тесты BatchResponse =====
+
+TEST(BatchResponseTest, SerializesPerItemStatus) {
+    BatchResponse response;
+    response.accepted = 1;
+    response.rejected = 1;
+    response.results.push_back(BatchItemResult{0, "accepted", std::nullopt});
+    response.results.push_back(BatchItemResult{
+        1, "rejected", ErrorResponse{ErrorCode::InvalidClickEvent, "Field 'page' must not be empty", std::nullopt}});
+
+    nlohmann::json j = response;
+
+    EXPECT_EQ(j["accepted"], 1);
+    EXPECT_EQ(j["failed"], 0);
+    ASSERT_EQ(j["results"].size(), 2u);
+    EXPECT_FALSE(j["results"][0].contains("error"));
+    EXPECT_EQ(j["results"][1]["status"], "rejected");
+    EXPECT_EQ(j["results"][1]["error"]["code"], "INVALID_CLICK_EVENT");
+}
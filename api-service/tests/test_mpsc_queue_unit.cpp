@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "mpsc_queue.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+// ===== Тесты MpscQueue =====
+
+TEST(MpscQueueTest, RoundsCapacityUpToPowerOfTwo) {
+    EXPECT_EQ(MpscQueue<int>(1).capacity(), 2u);
+    EXPECT_EQ(MpscQueue<int>(5).capacity(), 8u);
+    EXPECT_EQ(MpscQueue<int>(8).capacity(), 8u);
+}
+
+TEST(MpscQueueTest, PopsInFifoOrderAndRejectsWhenFull) {
+    MpscQueue<std::string> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        std::string value = "v" + std::to_string(i);
+        EXPECT_TRUE(queue.tryPush(value));
+    }
+
+    std::string overflow = "overflow";
+    EXPECT_FALSE(queue.tryPush(overflow));
+    EXPECT_EQ(overflow, "overflow");  // при отказе значение не перемещается
+    EXPECT_EQ(queue.sizeApprox(), 4u);
+
+    std::string out;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.tryPop(out));
+        EXPECT_EQ(out, "v" + std::to_string(i));
+    }
+    EXPECT_FALSE(queue.tryPop(out));
+    EXPECT_EQ(queue.sizeApprox(), 0u);
+}
+
+TEST(MpscQueueTest, WrapsAroundManyTimes) {
+    MpscQueue<int> queue(2);
+    for (int i = 0; i < 1000; ++i) {
+        int value = i;
+        ASSERT_TRUE(queue.tryPush(value));
+        int out = -1;
+        ASSERT_TRUE(queue.tryPop(out));
+        EXPECT_EQ(out, i);
+    }
+}
+
+TEST(MpscQueueTest, ConcurrentProducersLoseNothing) {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+    MpscQueue<int> queue(256);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < PER_PRODUCER; ++i) {
+                int value = p * PER_PRODUCER + i;
+                while (!queue.tryPush(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // Порядок внутри одного производителя сохраняется
+    std::vector<int> lastSeen(PRODUCERS, -1);
+    int received = 0;
+    while (received < PRODUCERS * PER_PRODUCER) {
+        int value;
+        if (!queue.tryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int producer = value / PER_PRODUCER;
+        EXPECT_GT(value % PER_PRODUCER, lastSeen[producer]);
+        lastSeen[producer] = value % PER_PRODUCER;
+        ++received;
+    }
+
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    for (int last : lastSeen) {
+        EXPECT_EQ(last, PER_PRODUCER - 1);
+    }
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include "rabbitmq.hpp"
+
+#include <string>
+#include <vector>
+
+// ===== Тесты ConfirmTracker =====
+
+namespace {
+
+PublishMessage message(const std::string& body) {
+    return makePublishMessage("page_views", body);
+}
+
+} // namespace
+
+TEST(ConfirmTrackerTest, AssignsSequentialTags) {
+    ConfirmTracker tracker;
+    EXPECT_EQ(tracker.track(message("a")), 1u);
+    EXPECT_EQ(tracker.track(message("b")), 2u);
+    EXPECT_EQ(tracker.track(message("c")), 3u);
+    EXPECT_EQ(tracker.size(), 3u);
+}
+
+TEST(ConfirmTrackerTest, AckSingleAndMultiple) {
+    ConfirmTracker tracker;
+    for (const char* body : {"a", "b", "c", "d", "e"}) {
+        tracker.track(message(body));
+    }
+
+    EXPECT_EQ(tracker.ack(2, false), 1u);
+    EXPECT_EQ(tracker.ack(2, false), 0u);  // повторный ack ничего не меняет
+    EXPECT_EQ(tracker.ack(4, true), 3u);   // 1, 3 и 4; 2 уже подтверждён
+    EXPECT_EQ(tracker.size(), 1u);
+    EXPECT_EQ(tracker.ack(5, false), 1u);
+    EXPECT_TRUE(tracker.empty());
+}
+
+TEST(ConfirmTrackerTest, AckRunsConfirmCallbacks) {
+    ConfirmTracker tracker;
+    std::vector<std::string> confirmed;
+    for (const char* body : {"a", "b", "c"}) {
+        auto m = message(body);
+        m.on_confirm = [&confirmed, body] { confirmed.push_back(body); };
+        tracker.track(std::move(m));
+    }
+
+    tracker.nack(1, false);
+    tracker.ack(3, true);
+    EXPECT_EQ(confirmed, (std::vector<std::string>{"b", "c"}));
+}
+
+TEST(ConfirmTrackerTest, NackReturnsMessagesInOrder) {
+    ConfirmTracker tracker;
+    for (const char* body : {"a", "b", "c", "d"}) {
+        tracker.track(message(body));
+    }
+
+    auto single = tracker.nack(2, false);
+    ASSERT_EQ(single.size(), 1u);
+    EXPECT_EQ(single[0].body, "b");
+
+    auto multiple = tracker.nack(3, true);
+    ASSERT_EQ(multiple.size(), 2u);
+    EXPECT_EQ(multiple[0].body, "a");
+    EXPECT_EQ(multiple[1].body, "c");
+    EXPECT_EQ(tracker.size(), 1u);
+}
+
+TEST(ConfirmTrackerTest, ResetReturnsUnconfirmedAndRestartsTags) {
+    ConfirmTracker tracker;
+    tracker.track(message("a"));
+    tracker.track(message("b"));
+    tracker.track(message("c"));
+    tracker.ack(1, false);
+
+    auto pending = tracker.reset();
+    ASSERT_EQ(pending.size(), 2u);
+    EXPECT_EQ(pending[0].body, "b");
+    EXPECT_EQ(pending[1].body, "c");
+    EXPECT_TRUE(tracker.empty());
+    EXPECT_EQ(tracker.track(message("d")), 1u);
+}
+
+// ===== Тесты RabbitMQPublisher =====
+
+TEST(RabbitMQPublisherTest, RejectsWhenQueueIsFull) {
+    // Брокер недоступен: I/O-поток не забирает сообщения, очередь заполняется
+    RabbitMQConfig config;
+    config.host = "127.0.0.1";
+    config.port = 1;
+    config.queue_capacity = 4;
+    RabbitMQPublisher publisher(config);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(publisher.publish(message(std::to_string(i))), PublishStatus::Queued);
+    }
+    EXPECT_EQ(publisher.publish(message("overflow")), PublishStatus::QueueFull);
+
+    auto stats = publisher.stats();
+    EXPECT_EQ(stats.queued, 4u);
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(stats.queue_depth, 4u);
+    EXPECT_EQ(stats.queue_capacity, 4u);
+    EXPECT_EQ(stats.connected_threads, 0u);
+    EXPECT_NE(publisher.formatMetrics().find("api_rabbitmq_rejected_total 1"), std::string::npos);
+}
+
+TEST(RabbitMQPublisherTest, FallsBackToOtherThreadsAndKeepsRejectedMessage) {
+    RabbitMQConfig config;
+    config.host = "127.0.0.1";
+    config.port = 1;
+    config.queue_capacity = 2;
+    config.io_threads = 2;  // сообщения распределяются по очередям обоих потоков
+    RabbitMQPublisher publisher(config);
+
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(publisher.publish(message(std::to_string(i))), PublishStatus::Queued) << i;
+    }
+
+    auto rejected = message("overflow");
+    EXPECT_EQ(publisher.publish(std::move(rejected)), PublishStatus::QueueFull);
+    EXPECT_EQ(rejected.body, "overflow");  // можно отправить другим путём
+    EXPECT_FALSE(publisher.connected());
+}
+
+TEST(RabbitMQPublisherTest, HandsUndeliveredMessagesToSinkOnStop) {
+    RabbitMQConfig config;
+    config.host = "127.0.0.1";
+    config.port = 1;
+    config.queue_capacity = 8;
+    RabbitMQPublisher publisher(config);
+
+    std::vector<std::string> sunk;
+    publisher.setShutdownSink([&sunk](const PublishMessage& m) {
+        sunk.push_back(m.body);
+        return m.body != "refused";
+    });
+    for (const char* body : {"a", "b", "refused"}) {
+        EXPECT_EQ(publisher.publish(message(body)), PublishStatus::Queued);
+    }
+
+    publisher.stop();
+    publisher.stop();
+    EXPECT_EQ(sunk, (std::vector<std::string>{"a", "b", "refused"}));
+    EXPECT_EQ(publisher.publish(message("late")), PublishStatus::Stopped);
+
+    auto stats = publisher.stats();
+    EXPECT_EQ(stats.handed_off, 2u);
+    EXPECT_EQ(stats.dropped, 1u);
+    EXPECT_EQ(stats.queue_depth, 0u);
+    EXPECT_NE(publisher.formatMetrics().find("api_rabbitmq_handed_off_total 2"), std::string::npos);
+}
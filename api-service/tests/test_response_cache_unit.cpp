@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "response_cache.hpp"
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ===== Тесты кеша ответов =====
+
+class ResponseCacheTest : public ::testing::Test {
+protected:
+    std::optional<std::string> watermark = "2024-12-06T10:00:00Z";
+    int upstreamCalls = 0;
+
+    ResponseCache makeCache(size_t maxBytes = 1u << 20) {
+        // Нулевой интервал: watermark проверяется на каждом запросе
+        return ResponseCache({maxBytes, std::chrono::milliseconds(0)}, [this] { return watermark; });
+    }
+
+    ResponseCache::Fetch respond(const std::string& body, int status = 200) {
+        return [this, body, status] {
+            ++upstreamCalls;
+            return CachedResponse{status, body};
+        };
+    }
+};
+
+TEST_F(ResponseCacheTest, ServesRepeatedRequestFromCache) {
+    auto cache = makeCache();
+
+    EXPECT_EQ(cache.get("a", respond(R"({"rows":[]})")).body, R"({"rows":[]})");
+    EXPECT_EQ(cache.get("a", respond("other")).body, R"({"rows":[]})");
+    EXPECT_EQ(upstreamCalls, 1);
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_DOUBLE_EQ(stats.hitRatio(), 0.5);
+}
+
+TEST_F(ResponseCacheTest, DoesNotStoreErrors) {
+    auto cache = makeCache();
+
+    EXPECT_EQ(cache.get("a", respond("fail", 500)).status, 500);
+    EXPECT_EQ(cache.get("a", respond("ok")).status, 200);
+    EXPECT_EQ(upstreamCalls, 2);
+}
+
+TEST_F(ResponseCacheTest, WatermarkAdvanceInvalidates) {
+    auto cache = makeCache();
+    cache.get("a", respond("v1"));
+
+    watermark = "2024-12-06T10:01:00Z";
+    EXPECT_EQ(cache.get("a", respond("v2")).body, "v2");
+    EXPECT_EQ(cache.get("a", respond("v3")).body, "v2");
+    EXPECT_EQ(upstreamCalls, 2);
+}
+
+TEST_F(ResponseCacheTest, UnknownWatermarkInvalidates) {
+    auto cache = makeCache();
+    cache.get("a", respond("v1"));
+
+    watermark.reset();
+    EXPECT_EQ(cache.get("a", respond("v2")).body, "v2");
+    EXPECT_EQ(cache.stats().entries, 0u);
+}
+
+TEST_F(ResponseCacheTest, EvictsLeastRecentlyUsed) {
+    // Три записи по ~1 КБ не помещаются в 2.5 КБ
+    auto cache = makeCache(2560);
+    std::string body(1000, 'x');
+    cache.get("a", respond(body));
+    cache.get("b", respond(body));
+    cache.get("a", respond(body));
+    cache.get("c", respond(body));
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.entries, 2u);
+    EXPECT_LE(stats.bytes, 2560u);
+
+    upstreamCalls = 0;
+    cache.get("a", respond(body));
+    cache.get("b", respond(body));
+    EXPECT_EQ(upstreamCalls, 1);
+}
+
+TEST_F(ResponseCacheTest, CoalescesConcurrentMisses) {
+    auto cache = makeCache();
+    std::atomic<int> calls{0};
+    std::atomic<bool> release{false};
+
+    auto slowFetch = [&] {
+        ++calls;
+        while (!release) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return CachedResponse{200, "shared"};
+    };
+
+    std::vector<std::thread> threads;
+    std::vector<std::string> bodies(8);
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        threads.emplace_back([&, i] { bodies[i] = cache.get("same", slowFetch).body; });
+    }
+    while (cache.stats().misses + cache.stats().coalesced < bodies.size()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    release = true;
+    for (auto& t : threads) t.join();
+
+    EXPECT_EQ(calls.load(), 1);
+    for (const auto& body : bodies) EXPECT_EQ(body, "shared");
+    EXPECT_EQ(cache.stats().coalesced, bodies.size() - 1);
+}
+
+TEST_F(ResponseCacheTest, FetchExceptionReachesCaller) {
+    auto cache = makeCache();
+    EXPECT_THROW(cache.get("a", [] () -> CachedResponse { throw std::runtime_error("rpc"); }),
+                 std::runtime_error);
+    EXPECT_EQ(cache.get("a", respond("ok")).body, "ok");
+}
+
+TEST_F(ResponseCacheTest, FormatsMetrics) {
+    auto cache = makeCache();
+    cache.get("a", respond("v"));
+    cache.get("a", respond("v"));
+
+    auto text = cache.formatMetrics();
+    EXPECT_NE(text.find("api_response_cache_hits_total 1\n"), std::string::npos);
+    EXPECT_NE(text.find("api_response_cache_hit_ratio 0.5\n"), std::string::npos);
+}
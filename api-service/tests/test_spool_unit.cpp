@@ -0,0 +1,312 @@
+#include <gtest/gtest.h>
+#include "spool.hpp"
+
+#include <zlib.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// ===== Тесты Spool =====
+
+class SpoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = fs::path(::testing::TempDir()) /
+               ("spool_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        fs::remove_all(dir_);
+    }
+
+    void TearDown() override { fs::remove_all(dir_); }
+
+    Spool::Config config(size_t segmentBytes = 4096, size_t maxBytes = 1u << 20) const {
+        return Spool::Config{dir_.string(), segmentBytes, maxBytes};
+    }
+
+    size_t segmentFiles() const {
+        size_t count = 0;
+        for (const auto& entry : fs::directory_iterator(dir_)) {
+            count += entry.path().extension() == ".log" ? 1 : 0;
+        }
+        return count;
+    }
+
+    static PublishMessage message(int i) {
+        return makePublishMessage("page_views", "{\"n\":" + std::to_string(i) + "}");
+    }
+
+    // Читает всё, что есть в журнале, по порядку; каждую запись сразу подтверждает брокер
+    static std::vector<std::string> drain(Spool& spool) {
+        std::vector<std::string> bodies;
+        PublishMessage out;
+        while (spool.peek(out)) {
+            EXPECT_EQ(out.routing_key, "page_views");
+            bodies.push_back(out.body);
+            spool.pop();
+            out.on_confirm();
+        }
+        return bodies;
+    }
+
+    fs::path dir_;
+};
+
+TEST_F(SpoolTest, ReadsBackInOrderAcrossSegments) {
+    Spool spool(config());
+    EXPECT_TRUE(spool.empty());
+
+    for (int i = 0; i < 500; ++i) {
+        ASSERT_TRUE(spool.append(message(i)));
+    }
+    EXPECT_FALSE(spool.empty());
+    EXPECT_GT(spool.stats().segments, 1u);
+
+    auto bodies = drain(spool);
+    ASSERT_EQ(bodies.size(), 500u);
+    for (int i = 0; i < 500; ++i) {
+        EXPECT_EQ(bodies[i], message(i).body);
+    }
+    EXPECT_TRUE(spool.empty());
+    // Прочитанные сегменты удалены, остаётся только активный
+    EXPECT_EQ(spool.stats().segments, 1u);
+    EXPECT_EQ(segmentFiles(), 1u);
+}
+
+TEST_F(SpoolTest, PeekWithoutPopReturnsSameRecord) {
+    Spool spool(config());
+    spool.append(message(1));
+    spool.append(message(2));
+
+    PublishMessage out;
+    ASSERT_TRUE(spool.peek(out));
+    ASSERT_TRUE(spool.peek(out));
+    EXPECT_EQ(out.body, message(1).body);
+    spool.pop();
+    ASSERT_TRUE(spool.peek(out));
+    EXPECT_EQ(out.body, message(2).body);
+}
+
+TEST_F(SpoolTest, RejectsWhenDiskBudgetIsExhausted) {
+    Spool spool(config(4096, 2 * 4096));
+    int accepted = 0;
+    while (spool.append(message(accepted))) {
+        ++accepted;
+    }
+
+    EXPECT_GT(accepted, 0);
+    auto stats = spool.stats();
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(stats.segments, 2u);
+    EXPECT_LE(stats.bytes, 2u * 4096);
+
+    // Прочитанный сегмент освобождает место
+    EXPECT_EQ(drain(spool).size(), static_cast<size_t>(accepted));
+    EXPECT_TRUE(spool.append(message(0)));
+}
+
+TEST_F(SpoolTest, RejectsRecordLargerThanSegment) {
+    Spool spool(config(4096));
+    EXPECT_FALSE(spool.append(makePublishMessage("page_views", std::string(5000, 'x'))));
+    EXPECT_TRUE(spool.empty());
+}
+
+TEST_F(SpoolTest, RecoversUnreadRecordsAfterRestart) {
+    {
+        Spool spool(config());
+        for (int i = 0; i < 300; ++i) {
+            spool.append(message(i));
+        }
+        PublishMessage out;
+        for (int i = 0; i < 100; ++i) {
+            ASSERT_TRUE(spool.peek(out));
+            spool.pop();
+            out.on_confirm();
+        }
+    }
+
+    Spool spool(config());
+    EXPECT_EQ(spool.stats().pending, 200u);
+    auto bodies = drain(spool);
+    ASSERT_EQ(bodies.size(), 200u);
+    EXPECT_EQ(bodies.front(), message(100).body);
+    EXPECT_EQ(bodies.back(), message(299).body);
+
+    // Новые записи идут в новый сегмент после восстановленных
+    spool.append(message(1000));
+    EXPECT_EQ(drain(spool), std::vector<std::string>{message(1000).body});
+}
+
+TEST_F(SpoolTest, KeepsRecordsUntilConfirmed) {
+    std::vector<PublishMessage> published;
+    {
+        Spool spool(config());
+        for (int i = 0; i < 300; ++i) {
+            spool.append(message(i));
+        }
+        PublishMessage out;
+        while (spool.peek(out)) {
+            published.push_back(out);
+            spool.pop();
+        }
+        EXPECT_TRUE(spool.empty());
+        // Ни одного подтверждения: прочитанные сегменты остаются на диске
+        EXPECT_EQ(segmentFiles(), spool.stats().segments);
+        EXPECT_GT(segmentFiles(), 1u);
+
+        // Подтверждения не по порядку: граница останавливается на первой неподтверждённой
+        for (int i = 0; i < 150; ++i) {
+            if (i != 20) {
+                published[i].on_confirm();
+            }
+        }
+    }
+
+    Spool spool(config());
+    EXPECT_EQ(spool.stats().pending, 280u);
+    auto bodies = drain(spool);
+    ASSERT_EQ(bodies.size(), 280u);
+    EXPECT_EQ(bodies.front(), message(20).body);
+    EXPECT_EQ(bodies.back(), message(299).body);
+
+    // Подтверждение, пришедшее после закрытия журнала, игнорируется
+    published[20].on_confirm();
+}
+
+TEST_F(SpoolTest, GivenUpRecordIsWrittenAgain) {
+    Spool spool(config());
+    spool.append(message(1));
+    spool.append(message(2));
+
+    PublishMessage first;
+    ASSERT_TRUE(spool.peek(first));
+    spool.pop();
+    PublishMessage second;
+    ASSERT_TRUE(spool.peek(second));
+    spool.pop();
+
+    // Брокер отверг первую запись max_attempts раз: она не теряется, а идёт в конец
+    first.on_give_up(first);
+    second.on_confirm();
+    EXPECT_EQ(spool.stats().requeued, 1u);
+    EXPECT_EQ(drain(spool), std::vector<std::string>{message(1).body});
+}
+
+TEST_F(SpoolTest, RecoveryStopsAtTornRecord) {
+    {
+        Spool spool(config());
+        for (int i = 0; i < 3; ++i) {
+            spool.append(message(i));
+        }
+    }
+
+    // Портим тело последней записи: crc не сойдётся
+    fs::path segment;
+    for (const auto& entry : fs::directory_iterator(dir_)) {
+        if (entry.path().extension() == ".log") {
+            segment = entry.path();
+        }
+    }
+    std::string content;
+    {
+        std::ifstream in(segment, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in), {});
+    }
+    auto pos = content.rfind(message(2).body);
+    ASSERT_NE(pos, std::string::npos);
+    content[pos] = 'X';
+    {
+        std::ofstream out(segment, std::ios::binary | std::ios::trunc);
+        out << content;
+    }
+
+    Spool spool(config());
+    auto bodies = drain(spool);
+    EXPECT_EQ(bodies, (std::vector<std::string>{message(0).body, message(1).body}));
+}
+
+TEST_F(SpoolTest, PreservesPayloadFormat) {
+    {
+        Spool spool(config());
+        spool.append(makePublishMessage("page_views", std::string("\x0a\x00\x01", 3), PayloadFormat::Protobuf));
+        spool.append(message(1));
+    }
+
+    Spool spool(config());
+    PublishMessage out;
+    ASSERT_TRUE(spool.peek(out));
+    EXPECT_EQ(out.format, PayloadFormat::Protobuf);
+    EXPECT_EQ(out.body, std::string("\x0a\x00\x01", 3));
+    spool.pop();
+    ASSERT_TRUE(spool.peek(out));
+    EXPECT_EQ(out.format, PayloadFormat::Json);
+    EXPECT_EQ(out.body, message(1).body);
+}
+
+TEST_F(SpoolTest, ReadsVersion1Segments) {
+    // Сегмент прошлой версии: запись без байта формата
+    const std::string key = "page_views";
+    const std::string body = message(7).body;
+    std::string payload(2, '\0');
+    auto keyLength = static_cast<uint16_t>(key.size());
+    std::memcpy(payload.data(), &keyLength, sizeof(keyLength));
+    payload += key + body;
+    auto length = static_cast<uint32_t>(payload.size());
+    auto crc = static_cast<uint32_t>(crc32(0, reinterpret_cast<const Bytef*>(payload.data()), payload.size()));
+
+    std::string content = "APISPOOL";
+    content.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    content.append(reinterpret_cast<const char*>(&crc), sizeof(crc));
+    content += payload;
+    content.resize(4096, '\0');
+    fs::create_directories(dir_);
+    {
+        std::ofstream out(dir_ / "segment-00000000000000000001.log", std::ios::binary);
+        out << content;
+    }
+
+    Spool spool(config());
+    PublishMessage out;
+    ASSERT_TRUE(spool.peek(out));
+    EXPECT_EQ(out.format, PayloadFormat::Json);
+    EXPECT_EQ(out.routing_key, key);
+    EXPECT_EQ(out.body, body);
+}
+
+TEST_F(SpoolTest, ConcurrentWritersWhileReading) {
+    constexpr int WRITERS = 4;
+    constexpr int PER_WRITER = 500;
+    Spool spool(config(8192, 64u << 20));
+
+    std::vector<std::thread> writers;
+    for (int w = 0; w < WRITERS; ++w) {
+        writers.emplace_back([&spool, w] {
+            for (int i = 0; i < PER_WRITER; ++i) {
+                ASSERT_TRUE(spool.append(makePublishMessage("page_views", std::to_string(w * PER_WRITER + i))));
+            }
+        });
+    }
+
+    std::vector<int> lastSeen(WRITERS, -1);
+    int received = 0;
+    PublishMessage out;
+    while (received < WRITERS * PER_WRITER) {
+        if (!spool.peek(out)) {
+            std::this_thread::yield();
+            continue;
+        }
+        int value = std::stoi(out.body);
+        EXPECT_GT(value % PER_WRITER, lastSeen[value / PER_WRITER]);
+        lastSeen[value / PER_WRITER] = value % PER_WRITER;
+        spool.pop();
+        ++received;
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    EXPECT_TRUE(spool.empty());
+}
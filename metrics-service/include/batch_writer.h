@@ -0,0 +1,132 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "connection_pool.h"
+#include "database.h"
+#include "rabbitmq.h"
+#include "segment_store.h"
+
+struct BatchWriterConfig {
+    // Сброс, как только в буферах набралось столько событий
+    size_t max_batch_size = 500;
+    // Сброс не реже, чем раз в max_latency после первого события в буфере
+    std::chrono::milliseconds max_latency{200};
+    // Сверх этого add() блокируется, пока не закончится текущий сброс
+    size_t max_pending = 5000;
+    // Сколько ingestHorizon() ждёт коммита пачки, прежде чем вернуть меньшую границу
+    std::chrono::milliseconds horizon_wait{2000};
+};
+
+BatchWriterConfig load_batch_writer_config();
+
+// Чем закончилась запись сообщений
+enum class WriteOutcome {
+    Committed, // ack
+    Retry,     // БД или пул недоступны: вернуть в очередь
+    Rejected,  // событие не принимается БД: повтор не поможет, в dead-letter
+};
+
+// Копит события по таблицам и пишет их пачками через соединение из пула:
+// COPY ... FROM STDIN для каждой таблицы в одной транзакции.
+// После записи вызывает CommitCallback с тегами сообщений и исходом,
+// чтобы ack уходил в RabbitMQ только после записи в БД.
+// Если пачку отвергли данные, она делится пополам, пока не останутся
+// отдельные плохие события: остальные сообщения пачки всё равно записываются.
+// Закоммиченная пачка дописывается и в SegmentStore, если он задан.
+class BatchWriter {
+  public:
+    using CommitCallback =
+        std::function<void(const std::vector<DeliveryTag>& tags, WriteOutcome outcome)>;
+
+    BatchWriter(std::shared_ptr<ConnectionPool> pool, const BatchWriterConfig& config);
+    virtual ~BatchWriter();
+
+    void setCommitCallback(CommitCallback callback);
+    // До start(); received_at пачки в сегментах и в PostgreSQL совпадает
+    void setSegmentStore(std::shared_ptr<SegmentStore> segments);
+    void start();
+    // Останавливает поток записи, дописав всё, что осталось в буферах
+    void stop();
+
+    void add(const PageView& event, const DeliveryTag& tag);
+    void add(const ClickEvent& event, const DeliveryTag& tag);
+    void add(const PerformanceEvent& event, const DeliveryTag& tag);
+    void add(const ErrorEvent& event, const DeliveryTag& tag);
+    void add(const CustomEvent& event, const DeliveryTag& tag);
+
+    // Граница received_at (мкс): всё, что принято раньше, уже закоммичено и дописано
+    // в сегменты. Это время пишущейся пачки, а без неё — текущее (следующие пачки
+    // получат не меньше). Ждёт до horizon_wait, пока граница не дойдёт до wanted_us
+    int64_t ingestHorizon(int64_t wanted_us);
+
+  protected:
+    // События одной таблицы и теги их сообщений, строка в строку
+    template <typename Event>
+    struct Rows {
+        std::vector<Event> events;
+        std::vector<DeliveryTag> tags;
+    };
+
+    struct Batch {
+        Rows<PageView> page_views;
+        Rows<ClickEvent> clicks;
+        Rows<PerformanceEvent> performance;
+        Rows<ErrorEvent> errors;
+        Rows<CustomEvent> custom;
+
+        size_t size() const {
+            return page_views.tags.size() + clicks.tags.size() + performance.tags.size() +
+                   errors.tags.size() + custom.tags.size();
+        }
+        std::vector<DeliveryTag> tags() const;
+        // Первые count событий (в порядке таблиц) и остальные
+        std::pair<Batch, Batch> split(size_t count) const;
+    };
+
+    // COPY пачки в таблицы в одной транзакции. Ошибки данных — pqxx::data_exception
+    // и pqxx::integrity_constraint_violation, остальные исключения считаются временными.
+    // Подкласс, переопределивший метод, вызывает stop() в своём деструкторе
+    virtual void copyBatch(ConnectionPool::Lease& conn, const Batch& batch, int64_t received_us);
+
+  private:
+    enum class WriteResult { Committed, Transient, DataError };
+
+    template <typename Event>
+    void enqueue(Rows<Event> Batch::*rows, const Event& event, const DeliveryTag& tag);
+    void flushLoop();
+    // Пишет пачку, деля её при ошибках данных; false — БД недоступна,
+    // неписанные сообщения возвращены в очередь
+    bool settle(const Batch& batch, int64_t received_us);
+    WriteResult writeBatch(const Batch& batch, int64_t received_us);
+    void notify(const std::vector<DeliveryTag>& tags, WriteOutcome outcome);
+
+    std::shared_ptr<ConnectionPool> pool_;
+    BatchWriterConfig config_;
+    CommitCallback callback_;
+    std::shared_ptr<SegmentStore> segments_;
+
+    // Время приёма пачек не убывает, даже если системные часы отступили, и не меньше
+    // уже выданного горизонта; in_flight_us_ — время пишущейся пачки (0 — её нет)
+    std::mutex horizon_mutex_;
+    std::condition_variable horizon_cv_;
+    int64_t last_received_us_ = 0;
+    int64_t in_flight_us_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable flush_cv_;
+    std::condition_variable space_cv_;
+    Batch pending_;
+    std::chrono::steady_clock::time_point oldest_;
+    bool running_ = false;
+    std::thread flush_thread_;
+};
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "database.h"
+
+namespace pqxx {
+class connection;
+}
+
+struct ConnectionPoolConfig {
+    size_t min_size = 2;
+    size_t max_size = 10;
+    // Сколько ждать свободное соединение, прежде чем вернуть ошибку
+    std::chrono::milliseconds checkout_timeout{2000};
+    // Соединение, простоявшее дольше, проверяется SELECT 1 перед выдачей
+    std::chrono::milliseconds health_check_after{30000};
+};
+
+ConnectionPoolConfig load_connection_pool_config();
+
+struct ConnectionPoolStats {
+    size_t max_size = 0;
+    size_t open = 0;
+    size_t in_use = 0;
+    size_t idle = 0;
+    size_t waiting = 0;
+    uint64_t checkouts = 0;
+    uint64_t timeouts = 0;
+    uint64_t connect_failures = 0;
+    uint64_t health_check_failures = 0;
+    // Время ожидания свободного слота (только для checkout, которые ждали)
+    uint64_t waits = 0;
+    double avg_wait_ms = 0.0;
+    double max_wait_ms = 0.0;
+    // Полное время checkout, включая установку соединения и health check
+    double avg_checkout_ms = 0.0;
+    double max_checkout_ms = 0.0;
+    // Сколько соединение держали до возврата в пул
+    double avg_hold_ms = 0.0;
+
+    double utilization() const {
+        return max_size ? static_cast<double>(in_use) / static_cast<double>(max_size) : 0.0;
+    }
+
+    std::string toJson() const;
+};
+
+class PoolTimeoutError : public std::runtime_error {
+  public:
+    using std::runtime_error::runtime_error;
+};
+
+// Ограниченный потокобезопасный пул соединений pqxx.
+// Соединения открываются лениво (warmUp открывает min_size заранее),
+// разорванные соединения при возврате отбрасываются.
+class ConnectionPool {
+  public:
+    // RAII-аренда соединения, возвращает его в пул в деструкторе
+    class Lease {
+      public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+        pqxx::connection& operator*() const {
+            return *conn_;
+        }
+        pqxx::connection* operator->() const {
+            return conn_.get();
+        }
+
+        // Не возвращать соединение в пул (например, после ошибки протокола)
+        void invalidate() {
+            broken_ = true;
+        }
+
+      private:
+        friend class ConnectionPool;
+        Lease(ConnectionPool* pool, std::unique_ptr<pqxx::connection> conn);
+        void release();
+
+        ConnectionPool* pool_ = nullptr;
+        std::unique_ptr<pqxx::connection> conn_;
+        std::chrono::steady_clock::time_point acquired_at_;
+        bool broken_ = false;
+    };
+
+    ConnectionPool(const DatabaseConfig& db_config, const ConnectionPoolConfig& config);
+    ~ConnectionPool();
+
+    ConnectionPool(const ConnectionPool&) = delete;
+    ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+    // Открывает min_size соединений, возвращает количество открытых
+    size_t warmUp();
+
+    // Бросает PoolTimeoutError, если за checkout_timeout соединение не освободилось,
+    // и исключение pqxx, если новое соединение не удалось открыть
+    Lease acquire();
+
+    // SELECT 1 на соединении из пула
+    bool ping();
+
+    ConnectionPoolStats stats() const;
+    const ConnectionPoolConfig& config() const {
+        return config_;
+    }
+
+  private:
+    struct IdleConnection {
+        std::unique_ptr<pqxx::connection> conn;
+        std::chrono::steady_clock::time_point since;
+    };
+
+    std::unique_ptr<pqxx::connection> openConnection();
+    bool isHealthy(pqxx::connection& conn);
+    void giveBack(std::unique_ptr<pqxx::connection> conn, bool broken,
+                  std::chrono::steady_clock::duration held);
+
+    DatabaseConfig db_config_;
+    ConnectionPoolConfig config_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable available_cv_;
+    std::vector<IdleConnection> idle_;
+    size_t open_ = 0; // выданные + простаивающие + открываемые
+    size_t in_use_ = 0;
+    size_t waiting_ = 0;
+
+    uint64_t checkouts_ = 0;
+    uint64_t timeouts_ = 0;
+    uint64_t connect_failures_ = 0;
+    uint64_t health_check_failures_ = 0;
+    uint64_t waits_ = 0;
+    uint64_t releases_ = 0;
+    std::chrono::steady_clock::duration total_wait_{};
+    std::chrono::steady_clock::duration max_wait_{};
+    std::chrono::steady_clock::duration total_checkout_{};
+    std::chrono::steady_clock::duration max_checkout_{};
+    std::chrono::steady_clock::duration total_hold_{};
+};
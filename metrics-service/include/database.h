@@ -17,6 +17,8 @@ struct PageView {
     std::optional<std::string> user_id;
     std::optional<std::string> session_id;
     std::optional<std::string> referrer;
+    // Время события по часам клиента, unix-секунды
+    std::optional<int64_t> timestamp;
 };
 
 struct ClickEvent {
@@ -25,6 +27,7 @@ struct ClickEvent {
     std::optional<std::string> action;
     std::optional<std::string> user_id;
     std::optional<std::string> session_id;
+    std::optional<int64_t> timestamp;
 };
 
 struct PerformanceEvent {
@@ -35,6 +38,7 @@ struct PerformanceEvent {
     std::optional<double> total_page_load_ms;
     std::optional<std::string> user_id;
     std::optional<std::string> session_id;
+    std::optional<int64_t> timestamp;
 };
 
 struct ErrorEvent {
@@ -45,6 +49,7 @@ struct ErrorEvent {
     std::optional<int32_t> severity;
     std::optional<std::string> user_id;
     std::optional<std::string> session_id;
+    std::optional<int64_t> timestamp;
 };
 
 struct CustomEvent {
@@ -52,12 +57,23 @@ struct CustomEvent {
     std::optional<std::string> page;
     std::optional<std::string> user_id;
     std::optional<std::string> session_id;
+    std::optional<int64_t> timestamp;
 };
 
 // Configuration functions
 DatabaseConfig load_database_config();
+std::string build_connection_string(const DatabaseConfig& config);
 bool test_database_connection(const DatabaseConfig& config);
 
+// Литерал timestamptz в UTC для unix-секунд: "2024-12-06 10:00:00+00"
+std::string format_utc_time(int64_t seconds);
+// То же с микросекундами: "2024-12-06 10:00:00.123456+00"
+std::string format_utc_time_us(int64_t micros);
+
+// Значение колонки timestamp: время события, но не позже now (часы клиента могут
+// спешить); без метки — now. Формат — литерал timestamptz в UTC
+std::string format_event_time(const std::optional<int64_t>& timestamp, int64_t now);
+
 // INSERT functions
 bool save_page_view(const DatabaseConfig& config, const PageView& event);
 bool save_click_event(const DatabaseConfig& config, const ClickEvent& event);
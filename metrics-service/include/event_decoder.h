@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include "database.h"
+
+// Значения AMQP content_type, которые понимает потребитель.
+// Сообщения без content_type считаются JSON (старые издатели его не ставили).
+inline constexpr std::string_view CONTENT_TYPE_JSON = "application/json";
+inline constexpr std::string_view CONTENT_TYPE_PROTOBUF = "application/x-protobuf";
+
+using DecodedEvent = std::variant<PageView, ClickEvent, PerformanceEvent, ErrorEvent, CustomEvent>;
+
+// Разбирает тело сообщения из очереди queue: protobuf (metricsys.*Event из
+// metrics.proto) или JSON. std::invalid_argument — неизвестная очередь,
+// content_type или тело, которое не удалось разобрать
+DecodedEvent decode_event(const std::string& queue, std::string_view content_type, const std::string& body);
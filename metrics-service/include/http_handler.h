@@ -5,14 +5,20 @@
 #include <atomic>
 #include <memory>
 #include <functional>
+#include <vector>
 
 class HttpHandler {
 public:
     using DatabaseCheckFunc = std::function<bool()>;
+    // Returns a JSON document with component statistics
+    using StatsFunc = std::function<std::string()>;
 
     HttpHandler(int port, DatabaseCheckFunc db_check);
     ~HttpHandler();
 
+    // Must be called before start()
+    void addStatsRoute(const std::string& path, StatsFunc provider);
+
     void start();
     void stop();
 
@@ -21,6 +27,7 @@ private:
     DatabaseCheckFunc db_check_;
     std::atomic<bool> running_{false};
     std::thread server_thread_;
+    std::vector<std::string> stats_routes_;
     
     class Impl;
     std::unique_ptr<Impl> impl_;
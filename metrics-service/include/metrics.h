@@ -2,14 +2,28 @@
 
 #include "metrics.grpc.pb.h"
 #include "metrics.pb.h"
+#include "connection_pool.h"
 #include "database.h"
+#include "segment_store.h"
 #include <grpcpp/grpcpp.h>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 
+// Горизонт записи (мкс): события с меньшим received_at уже все видны.
+// Аргумент — желаемая граница, до которой можно подождать коммита текущей пачки
+using IngestHorizon = std::function<int64_t(int64_t wanted_us)>;
+
 class MetricsServiceImpl final : public metricsys::MetricsService::Service {
 public:
+    // Собственный пул с настройками по умолчанию
     explicit MetricsServiceImpl(const DatabaseConfig& db_config);
+    // segments — колоночное хранилище для окон по received_range; nullptr — только PostgreSQL.
+    // horizon урезает received_range до уже записанного; без него окно не урезается
+    explicit MetricsServiceImpl(std::shared_ptr<ConnectionPool> pool,
+                                std::shared_ptr<SegmentStore> segments = nullptr,
+                                IngestHorizon horizon = nullptr);
 
     grpc::Status GetPageViews(
         grpc::ServerContext* context,
@@ -36,9 +50,38 @@ public:
         const metricsys::GetCustomEventsRequest* request,
         metricsys::GetCustomEventsResponse* response) override;
 
+    // Потоковые варианты: курсор по (timestamp, id), чанк = pagination.limit
+    grpc::Status StreamPageViews(
+        grpc::ServerContext* context,
+        const metricsys::GetPageViewsRequest* request,
+        grpc::ServerWriter<metricsys::GetPageViewsResponse>* writer) override;
+
+    grpc::Status StreamClicks(
+        grpc::ServerContext* context,
+        const metricsys::GetClicksRequest* request,
+        grpc::ServerWriter<metricsys::GetClicksResponse>* writer) override;
+
+    grpc::Status StreamPerformance(
+        grpc::ServerContext* context,
+        const metricsys::GetPerformanceRequest* request,
+        grpc::ServerWriter<metricsys::GetPerformanceResponse>* writer) override;
+
+    grpc::Status StreamErrors(
+        grpc::ServerContext* context,
+        const metricsys::GetErrorsRequest* request,
+        grpc::ServerWriter<metricsys::GetErrorsResponse>* writer) override;
+
+    grpc::Status StreamCustomEvents(
+        grpc::ServerContext* context,
+        const metricsys::GetCustomEventsRequest* request,
+        grpc::ServerWriter<metricsys::GetCustomEventsResponse>* writer) override;
+
 private:
-    DatabaseConfig db_config_;
-    std::string get_connection_string() const;
+    std::shared_ptr<ConnectionPool> pool_;
+    std::shared_ptr<SegmentStore> segments_;
+    IngestHorizon horizon_;
 };
 
-void run_grpc_server(const std::string& address, const DatabaseConfig& db_config);
+void run_grpc_server(const std::string& address, std::shared_ptr<ConnectionPool> pool,
+                     std::shared_ptr<SegmentStore> segments = nullptr,
+                     IngestHorizon horizon = nullptr);
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "connection_pool.h"
+
+// Таблицы событий, секционированные по дням received_at (UTC)
+inline constexpr std::array<const char*, 5> PARTITIONED_TABLES = {
+    "page_views", "click_events", "performance_events", "error_events", "custom_events",
+};
+
+struct PartitionManagerConfig {
+    // Сколько дней после сегодняшнего держать созданными заранее
+    int premake_days = 2;
+    // Партиции старше стольких дней удаляются целиком; 0 — хранить всё
+    int retention_days = 30;
+    std::chrono::seconds check_interval{3600};
+};
+
+PartitionManagerConfig load_partition_manager_config();
+
+// Имя партиции таблицы за день: page_views_p20241206
+std::string partition_name(const std::string& table, std::chrono::sys_days day);
+// День партиции по её имени; nullopt для чужих имён (например, page_views_default)
+std::optional<std::chrono::sys_days> partition_day(const std::string& table, const std::string& name);
+// CREATE TABLE IF NOT EXISTS ... PARTITION OF table FOR VALUES FROM (day) TO (day + 1)
+std::string create_partition_sql(const std::string& table, std::chrono::sys_days day);
+// DEFAULT-партиция таблицы: page_views_default
+std::string default_partition_name(const std::string& table);
+// Перенос строк days из DEFAULT в новые партиции этих дней: пока DEFAULT хранит строки дня,
+// партицию дня создать нельзя, поэтому DEFAULT на время отсоединяется. Выполнять в одной транзакции
+std::vector<std::string> move_default_rows_sql(const std::string& table,
+                                               const std::vector<std::chrono::sys_days>& days);
+// Партиции из names, чей день целиком старше retention_days от today
+std::vector<std::string> expired_partitions(const std::string& table, const std::vector<std::string>& names,
+                                            std::chrono::sys_days today, int retention_days);
+
+struct PartitionManagerStats {
+    uint64_t runs = 0;
+    uint64_t failures = 0;
+    uint64_t created = 0;
+    uint64_t dropped = 0;
+    // Строк, перенесённых из DEFAULT-партиций в партиции своих дней
+    uint64_t moved_rows = 0;
+    size_t partitions = 0;  // по всем таблицам после последнего прохода
+    // Строк в DEFAULT-партициях на начало последнего прохода; не 0 — вставка шла мимо партиций
+    uint64_t default_rows = 0;
+
+    std::string toJson() const;
+};
+
+// Держит партиции сырых таблиц: заранее создаёт партиции на premake_days вперёд
+// (вставка никогда не упирается в отсутствующую партицию) и удаляет партиции старше
+// retention_days — DROP TABLE вместо DELETE и VACUUM по всей истории.
+// Строки, всё же попавшие в DEFAULT, переносятся в партиции своих дней.
+class PartitionManager {
+  public:
+    PartitionManager(std::shared_ptr<ConnectionPool> pool, const PartitionManagerConfig& config);
+    ~PartitionManager();
+
+    PartitionManager(const PartitionManager&) = delete;
+    PartitionManager& operator=(const PartitionManager&) = delete;
+
+    // Первый проход выполняется синхронно, до приёма событий; дальше — фоновый поток
+    bool start();
+    void stop();
+
+    // Один проход по всем таблицам за день today; ошибка в одной таблице не мешает
+    // остальным. false, если что-то не удалось
+    bool maintain(std::chrono::sys_days today);
+
+    PartitionManagerStats stats() const;
+
+  private:
+    void loop();
+    // Своя транзакция на таблицу; счётчики прохода копятся в pass
+    void maintainTable(pqxx::connection& conn, const std::string& table, std::chrono::sys_days today,
+                       PartitionManagerStats& pass);
+
+    std::shared_ptr<ConnectionPool> pool_;
+    PartitionManagerConfig config_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    bool running_ = false;
+    std::thread thread_;
+    PartitionManagerStats stats_;
+};
@@ -3,10 +3,15 @@
 #include <amqp.h>
 #include <amqp_tcp_socket.h>
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 struct RabbitMQConfig {
@@ -16,15 +21,53 @@ struct RabbitMQConfig {
     std::string password;
     std::string vhost;
     std::vector<std::string> queues;
+    // basic.qos на каждый канал: сколько неподтверждённых сообщений держит брокер
+    uint16_t prefetch_count = 200;
+    // 0 — callback вызывается прямо в сетевом потоке
+    size_t worker_threads = 4;
+    // Ёмкость очереди между сетевым потоком и воркерами, у каждой AMQP-очереди своя;
+    // не меньше prefetch_count, чтобы сетевой поток никогда не ждал места
+    size_t work_queue_capacity = 200;
+    // Куда reject без requeue перекладывает сообщение (пусто — сообщение отбрасывается)
+    std::string dead_letter_exchange = "metrics.dead_letter";
 };
 
 RabbitMQConfig load_rabbitmq_config();
 
+// Идентифицирует доставку для отложенного ack/reject.
+// generation отличает теги прошлых соединений: после переподключения
+// брокер сам передоставит неподтверждённые сообщения.
+struct DeliveryTag {
+    uint64_t tag = 0;
+    uint64_t generation = 0;
+    amqp_channel_t channel = 1;
+};
+
+struct ConsumerStats {
+    size_t work_queue_depth = 0;
+    size_t work_queue_capacity = 0;
+    std::vector<std::pair<std::string, size_t>> work_queue_depth_per_queue;
+    size_t in_flight = 0;
+    uint64_t delivered = 0;
+    uint64_t acked = 0;
+    uint64_t rejected = 0;
+    uint64_t dead_lettered = 0;
+    // Dead-letter не подтверждён брокером: доставка возвращена в очередь
+    uint64_t dead_letter_failures = 0;
+    std::vector<std::pair<std::string, size_t>> in_flight_per_queue;
+
+    std::string toJson() const;
+};
+
 class RabbitMQConsumer {
   public:
-    // Callback receives queue name and message body
-    using MessageCallback =
-        std::function<void(const std::string& queue, const std::string& message)>;
+    // Callback receives queue name, message body, its AMQP content_type
+    // (empty if the publisher did not set one) and delivery tag.
+    // The message must later be settled with ack() or reject().
+    using MessageCallback = std::function<void(const std::string& queue,
+                                               const std::string& message,
+                                               const std::string& content_type,
+                                               const DeliveryTag& tag)>;
 
     RabbitMQConsumer(const RabbitMQConfig& config);
     ~RabbitMQConsumer();
@@ -32,23 +75,97 @@ class RabbitMQConsumer {
     bool connect();
     void subscribe(MessageCallback callback);
     void start();
+    // Перестаёт брать новые сообщения и останавливает воркеров; сетевой поток
+    // и соединение остаются, чтобы отправить ack/reject ещё не записанных сообщений
+    void stopConsuming();
+    // Отправляет оставшиеся ack/reject и закрывает соединение
     void stop();
+    // Thread-safe: the frame is sent from the network thread.
+    // reject() without requeue first publishes the message to dead_letter_exchange
+    // and waits for the publisher confirm; if it is not confirmed, the delivery is requeued.
+    void ack(const DeliveryTag& tag);
+    void reject(const DeliveryTag& tag, bool requeue);
     bool isConnected() const {
         return connected_;
     }
+    ConsumerStats stats() const;
 
   private:
+    struct Settlement {
+        DeliveryTag tag;
+        bool ack;
+        bool requeue;
+    };
+
+    struct WorkItem {
+        std::string queue;
+        std::shared_ptr<const std::string> body;
+        std::string content_type;
+        DeliveryTag tag;
+    };
+
+    // Тело доставки хранится до ack/reject, чтобы отправить его в dead-letter
+    struct Unsettled {
+        std::shared_ptr<const std::string> body;
+        std::string content_type;
+    };
+
+    struct DeadLetter {
+        const Unsettled* message;
+        const std::string* queue;
+    };
+
     bool checkRpcReply(const char* context);
+    bool connectDeadLetter();
+    // graceful = false: сокет уже неисправен, без close-рукопожатия
+    void closeDeadLetter(bool graceful);
+    // Публикует в dead_letter_exchange и ждёт publisher confirm; true — брокер принял сообщение
+    std::vector<bool> deadLetter(const std::vector<DeadLetter>& letters);
     void disconnect();
     bool reconnect();
     void consumeLoop();
+    void workerLoop();
+    void dispatch(WorkItem item);
+    void handle(const WorkItem& item);
+    void flushSettlements();
+    // Каждой очереди свой канал: медленная очередь не блокирует остальные
+    amqp_channel_t channelFor(size_t queue_index) const {
+        return static_cast<amqp_channel_t>(queue_index + 1);
+    }
 
     RabbitMQConfig config_;
     MessageCallback callback_;
     std::atomic<bool> running_{false};
+    std::atomic<bool> consuming_{false};
     std::atomic<bool> connected_{false};
     std::thread consumer_thread_;
+    std::vector<std::thread> workers_;
+
+    mutable std::mutex work_mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable space_cv_;
+    // Свой буфер на каждую AMQP-очередь (индекс = номер очереди): медленная очередь
+    // заполняет только свой. Воркеры обходят буферы по кругу
+    std::vector<std::deque<WorkItem>> work_queues_;
+    size_t next_work_queue_ = 0;
+
+    mutable std::mutex settle_mutex_;
+    std::vector<Settlement> settlements_;
+    std::atomic<uint64_t> generation_{0};
+    // Неподтверждённые доставки по каналам (индекс = номер очереди)
+    std::vector<size_t> in_flight_;
+    uint64_t delivered_ = 0;
+    uint64_t acked_ = 0;
+    uint64_t rejected_ = 0;
+    uint64_t dead_lettered_ = 0;
+    uint64_t dead_letter_failures_ = 0;
+    // Только сетевой поток: доставки по каналам, ещё не получившие ack/reject
+    std::vector<std::unordered_map<uint64_t, Unsettled>> unsettled_;
 
     amqp_connection_state_t conn_ = nullptr;
     amqp_socket_t* socket_ = nullptr;
+    // Отдельное соединение для dead-letter в режиме confirm.select: его подтверждения
+    // не перемешиваются с доставками основного соединения. Только сетевой поток
+    amqp_connection_state_t dlx_conn_ = nullptr;
+    uint64_t dlx_next_tag_ = 1;
 };
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "database.h"
+
+// Колоночное хранилище сырых событий рядом с PostgreSQL: BatchWriter дописывает в него
+// закоммиченные пачки, а чтения окон по received_range (так читает агрегатор) идут
+// из сегментов вместо таблиц. Хранятся только колонки, нужные агрегации: без id,
+// referrer, message и stack.
+
+enum class SegmentKind : uint32_t {
+    PageView,
+    Click,
+    Performance,
+    Error,
+    Custom
+};
+
+inline constexpr size_t SEGMENT_KINDS = 5;
+
+// Строковые колонки: первые три общие, дальше — своя у вида события
+// (Click: element_id, action; Error: error_type; Custom: name)
+inline constexpr size_t COL_PAGE = 0;
+inline constexpr size_t COL_USER_ID = 1;
+inline constexpr size_t COL_SESSION_ID = 2;
+inline constexpr size_t COL_EXTRA = 3;
+inline constexpr size_t COL_EXTRA2 = 4;
+// Числовые колонки Performance и Error
+inline constexpr size_t COL_TTFB = 0;
+inline constexpr size_t COL_FCP = 1;
+inline constexpr size_t COL_LCP = 2;
+inline constexpr size_t COL_TOTAL_LOAD = 3;
+inline constexpr size_t COL_SEVERITY = 0;
+
+inline constexpr size_t MAX_STRING_COLUMNS = 5;
+inline constexpr size_t MAX_DOUBLE_COLUMNS = 4;
+
+struct SegmentLayout {
+    size_t strings = 0;
+    size_t doubles = 0;
+    size_t ints = 0;
+};
+
+SegmentLayout segment_layout(SegmentKind kind);
+// Каталог вида внутри хранилища — имя таблицы PostgreSQL
+const char* segment_kind_name(SegmentKind kind);
+
+struct SegmentStoreConfig {
+    // Пусто — хранилище выключено, всё читается из PostgreSQL
+    std::string dir;
+    // Сегмент закрывается по числу строк или по возрасту первой строки
+    size_t max_rows = 65536;
+    std::chrono::seconds max_age{300};
+    // Сегменты старше удаляются целиком; 0 — хранить всё
+    int retention_days = 30;
+
+    bool enabled() const {
+        return !dir.empty();
+    }
+};
+
+SegmentStoreConfig load_segment_store_config();
+
+// id строки сегмента в формате UUID; порядок id совпадает с порядком (segment, row)
+std::string segment_row_id(uint64_t segment, uint32_t row);
+// nullopt для id, выданных PostgreSQL
+std::optional<std::pair<uint64_t, uint32_t>> parse_segment_row_id(const std::string& id);
+
+// Колонки одного сегмента (закрытого в mmap или открытого в памяти).
+// Время приёма — дельта в микросекундах от min_received_us, время события —
+// дельта в секундах от секунды приёма; строки — номера в словаре сегмента.
+struct SegmentColumns {
+    uint64_t seq = 0;
+    uint32_t rows = 0;
+    int64_t min_received_us = 0;
+    int64_t max_received_us = 0;
+    int64_t min_timestamp = 0;
+    int64_t max_timestamp = 0;
+
+    const uint32_t* received = nullptr;
+    const int32_t* timestamps = nullptr;
+    std::array<const uint32_t*, MAX_STRING_COLUMNS> strings{};
+    std::array<const double*, MAX_DOUBLE_COLUMNS> doubles{};
+    const int32_t* ints = nullptr;
+
+    uint32_t words = 0;
+    const uint32_t* word_offsets = nullptr;  // words + 1 смещение в word_bytes
+    const char* word_bytes = nullptr;
+
+    int64_t receivedUs(uint32_t row) const {
+        return min_received_us + received[row];
+    }
+    int64_t timestamp(uint32_t row) const {
+        return receivedUs(row) / 1000000 + timestamps[row];
+    }
+    std::string_view string(size_t column, uint32_t row) const {
+        const uint32_t word = strings[column][row];
+        return {word_bytes + word_offsets[word], word_offsets[word + 1] - word_offsets[word]};
+    }
+    double number(size_t column, uint32_t row) const {
+        return doubles[column][row];
+    }
+    int32_t integer(uint32_t row) const {
+        return ints[row];
+    }
+};
+
+// Позиция строки в порядке выдачи (received_us, segment, row)
+struct SegmentPosition {
+    int64_t received_us = 0;
+    uint64_t segment = 0;
+    uint32_t row = 0;
+};
+
+struct SegmentQuery {
+    // Окно [from_us, to_us) по времени приёма
+    int64_t from_us = 0;
+    int64_t to_us = 0;
+    // Дополнительно [start, end] по времени события, секунды
+    std::optional<std::pair<int64_t, int64_t>> time_range;
+    // Строго после этой позиции
+    std::optional<SegmentPosition> after;
+    size_t offset = 0;
+    size_t limit = 0;
+};
+
+// Открытый сегмент: колонки растут в памяти, строки словаря интернируются при добавлении
+class SegmentBuilder {
+  public:
+    SegmentBuilder(SegmentKind kind, uint64_t seq);
+
+    // false — дельта времени приёма не помещается в 32 бита, нужен новый сегмент
+    bool fits(int64_t received_us) const;
+    void append(int64_t received_us, int64_t timestamp,
+                const std::array<std::string_view, MAX_STRING_COLUMNS>& strings,
+                const std::array<double, MAX_DOUBLE_COLUMNS>& doubles, int32_t integer);
+
+    SegmentKind kind() const {
+        return kind_;
+    }
+    uint32_t rows() const {
+        return static_cast<uint32_t>(received_.size());
+    }
+    // Действительны до следующего append
+    SegmentColumns columns() const;
+    // Неизменяемый файл: пишется во временный и переименовывается
+    bool write(const std::string& path) const;
+
+  private:
+    uint32_t intern(std::string_view value);
+
+    SegmentKind kind_;
+    SegmentLayout layout_;
+    uint64_t seq_;
+    int64_t min_received_us_ = 0;
+    int64_t max_received_us_ = 0;
+    int64_t min_timestamp_ = 0;
+    int64_t max_timestamp_ = 0;
+
+    std::vector<uint32_t> received_;
+    std::vector<int32_t> timestamps_;
+    std::array<std::vector<uint32_t>, MAX_STRING_COLUMNS> strings_;
+    std::array<std::vector<double>, MAX_DOUBLE_COLUMNS> doubles_;
+    std::vector<int32_t> ints_;
+
+    std::unordered_map<std::string, uint32_t> dictionary_;
+    std::vector<uint32_t> word_offsets_{0};
+    std::string word_bytes_;
+};
+
+// Закрытый сегмент, отображённый в память только для чтения
+class Segment {
+  public:
+    // nullptr, если файл повреждён или не того вида
+    static std::shared_ptr<Segment> open(const std::string& path, SegmentKind kind);
+    ~Segment();
+
+    Segment(const Segment&) = delete;
+    Segment& operator=(const Segment&) = delete;
+
+    const SegmentColumns& columns() const {
+        return columns_;
+    }
+    const std::string& path() const {
+        return path_;
+    }
+    size_t bytes() const {
+        return size_;
+    }
+
+  private:
+    Segment() = default;
+
+    std::string path_;
+    void* data_ = nullptr;
+    size_t size_ = 0;
+    SegmentColumns columns_;
+};
+
+struct SegmentStoreStats {
+    size_t segments = 0;
+    uint64_t sealed_rows = 0;
+    uint64_t open_rows = 0;
+    uint64_t bytes = 0;
+    uint64_t appended = 0;
+    uint64_t scans = 0;
+    uint64_t seal_failures = 0;
+    uint64_t dropped = 0;
+    int64_t covered_from_us = 0;
+
+    std::string toJson() const;
+};
+
+// Сегменты по видам событий. Строки каждого вида лежат в порядке времени приёма:
+// пишет один поток BatchWriter, время пачки не убывает. Закрытые сегменты не
+// меняются, поэтому чтение идёт без блокировки по снимку списка.
+class SegmentStore {
+  public:
+    using RowCallback = std::function<void(const SegmentColumns& segment, uint32_t row)>;
+
+    explicit SegmentStore(const SegmentStoreConfig& config);
+    // Закрывает открытые сегменты, как stop()
+    ~SegmentStore();
+
+    SegmentStore(const SegmentStore&) = delete;
+    SegmentStore& operator=(const SegmentStore&) = delete;
+
+    // Время пачки received_us должно совпадать с received_at, записанным в PostgreSQL
+    void append(const std::vector<PageView>& events, int64_t received_us);
+    void append(const std::vector<ClickEvent>& events, int64_t received_us);
+    void append(const std::vector<PerformanceEvent>& events, int64_t received_us);
+    void append(const std::vector<ErrorEvent>& events, int64_t received_us);
+    void append(const std::vector<CustomEvent>& events, int64_t received_us);
+
+    // Все события, принятые начиная с from_us, есть в сегментах
+    bool covers(int64_t from_us) const;
+    // Вызывает callback для строк по порядку; возвращает их число
+    size_t scan(SegmentKind kind, const SegmentQuery& query, const RowCallback& callback);
+
+    // Закрывает открытые сегменты и запоминает покрытие до следующего запуска
+    void stop();
+    SegmentStoreStats stats() const;
+
+  private:
+    void load();
+    // Под mutex_; время события обрезается до времени приёма, как в format_event_time
+    void appendRow(SegmentKind kind, int64_t received_us, const std::optional<int64_t>& timestamp,
+                   const std::array<std::string_view, MAX_STRING_COLUMNS>& strings,
+                   const std::array<double, MAX_DOUBLE_COLUMNS>& doubles = {}, int32_t integer = 0);
+    void seal(SegmentKind kind);
+    void dropExpired(int64_t now_us);
+    std::string segmentPath(SegmentKind kind, uint64_t seq) const;
+
+    SegmentStoreConfig config_;
+
+    mutable std::mutex mutex_;
+    std::array<std::vector<std::shared_ptr<Segment>>, SEGMENT_KINDS> sealed_;
+    std::array<std::unique_ptr<SegmentBuilder>, SEGMENT_KINDS> open_;
+    std::array<std::chrono::steady_clock::time_point, SEGMENT_KINDS> opened_at_{};
+    std::array<int64_t, SEGMENT_KINDS> last_received_us_{};
+    uint64_t next_seq_ = 1;
+    int64_t covered_from_us_ = 0;
+    bool stopped_ = false;
+    SegmentStoreStats stats_;
+};
@@ -1,24 +1,34 @@
+-- Сырые события секционированы по дням received_at (UTC): вставка всегда идёт
+-- в партицию текущего дня, выборки по времени читают только свои дни, а срок
+-- хранения — DROP партиции вместо DELETE. Партиции создаёт и удаляет
+-- PartitionManager (src/partition_manager.cpp).
+-- Первичный ключ (received_at, id) — он же порядок выборок с received_range
+-- и keyset-курсор по ним; ключ партиционирования обязан в него входить.
 CREATE TABLE IF NOT EXISTS page_views (
-    id UUID PRIMARY KEY DEFAULT gen_random_uuid(),
+    id UUID NOT NULL DEFAULT gen_random_uuid(),
     page VARCHAR(512) NOT NULL,
     user_id VARCHAR(128),
     session_id VARCHAR(128),
     referrer VARCHAR(512),
-    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW()
-);
+    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW(),
+    received_at TIMESTAMP WITH TIME ZONE NOT NULL DEFAULT NOW(),
+    PRIMARY KEY (received_at, id)
+) PARTITION BY RANGE (received_at);
 
 CREATE TABLE IF NOT EXISTS click_events (
-    id UUID PRIMARY KEY DEFAULT gen_random_uuid(),
+    id UUID NOT NULL DEFAULT gen_random_uuid(),
     page VARCHAR(512) NOT NULL,
     element_id VARCHAR(256),
     action VARCHAR(256),
     user_id VARCHAR(128),
     session_id VARCHAR(128),
-    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW()
-);
+    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW(),
+    received_at TIMESTAMP WITH TIME ZONE NOT NULL DEFAULT NOW(),
+    PRIMARY KEY (received_at, id)
+) PARTITION BY RANGE (received_at);
 
 CREATE TABLE IF NOT EXISTS performance_events (
-    id UUID PRIMARY KEY DEFAULT gen_random_uuid(),
+    id UUID NOT NULL DEFAULT gen_random_uuid(),
     page VARCHAR(512) NOT NULL,
     ttfb_ms DOUBLE PRECISION,
     fcp_ms DOUBLE PRECISION,
@@ -26,11 +36,13 @@ CREATE TABLE IF NOT EXISTS performance_events (
     total_page_load_ms DOUBLE PRECISION,
     user_id VARCHAR(128),
     session_id VARCHAR(128),
-    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW()
-);
+    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW(),
+    received_at TIMESTAMP WITH TIME ZONE NOT NULL DEFAULT NOW(),
+    PRIMARY KEY (received_at, id)
+) PARTITION BY RANGE (received_at);
 
 CREATE TABLE IF NOT EXISTS error_events (
-    id UUID PRIMARY KEY DEFAULT gen_random_uuid(),
+    id UUID NOT NULL DEFAULT gen_random_uuid(),
     page VARCHAR(512) NOT NULL,
     error_type VARCHAR(128),
     message TEXT,
@@ -38,32 +50,64 @@ CREATE TABLE IF NOT EXISTS error_events (
     severity INTEGER DEFAULT 0,
     user_id VARCHAR(128),
     session_id VARCHAR(128),
-    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW()
-);
+    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW(),
+    received_at TIMESTAMP WITH TIME ZONE NOT NULL DEFAULT NOW(),
+    PRIMARY KEY (received_at, id)
+) PARTITION BY RANGE (received_at);
 
 CREATE TABLE IF NOT EXISTS custom_events (
-    id UUID PRIMARY KEY DEFAULT gen_random_uuid(),
+    id UUID NOT NULL DEFAULT gen_random_uuid(),
     name VARCHAR(256) NOT NULL,
     page VARCHAR(512),
     user_id VARCHAR(128),
     session_id VARCHAR(128),
-    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW()
-);
+    timestamp TIMESTAMP WITH TIME ZONE DEFAULT NOW(),
+    received_at TIMESTAMP WITH TIME ZONE NOT NULL DEFAULT NOW(),
+    PRIMARY KEY (received_at, id)
+) PARTITION BY RANGE (received_at);
 
-CREATE INDEX IF NOT EXISTS idx_page_views_timestamp ON page_views(timestamp);
+-- DEFAULT-партиция — страховка, если PartitionManager не успел создать нужный день.
+-- Строки, попавшие в DEFAULT, PartitionManager переносит в партиции их дней
+CREATE TABLE IF NOT EXISTS page_views_default PARTITION OF page_views DEFAULT;
+CREATE TABLE IF NOT EXISTS click_events_default PARTITION OF click_events DEFAULT;
+CREATE TABLE IF NOT EXISTS performance_events_default PARTITION OF performance_events DEFAULT;
+CREATE TABLE IF NOT EXISTS error_events_default PARTITION OF error_events DEFAULT;
+CREATE TABLE IF NOT EXISTS custom_events_default PARTITION OF custom_events DEFAULT;
+
+-- Сегодня и завтра, в тех же именах <table>_pYYYYMMDD, что и у PartitionManager
+DO $$
+DECLARE
+    tbl TEXT;
+    part_day DATE;
+BEGIN
+    FOREACH tbl IN ARRAY ARRAY['page_views', 'click_events', 'performance_events', 'error_events', 'custom_events'] LOOP
+        FOR offset_days IN 0..1 LOOP
+            part_day := (NOW() AT TIME ZONE 'UTC')::date + offset_days;
+            EXECUTE format(
+                'CREATE TABLE IF NOT EXISTS %I PARTITION OF %I FOR VALUES FROM (%L) TO (%L)',
+                tbl || '_p' || to_char(part_day, 'YYYYMMDD'), tbl,
+                part_day::text || ' 00:00:00+00', (part_day + 1)::text || ' 00:00:00+00');
+        END LOOP;
+    END LOOP;
+END $$;
+
+-- timestamp — время события по часам клиента, received_at — время записи в БД.
+-- (timestamp, id) — порядок выдачи и keyset-курсор в Get*/Stream* RPC.
+-- Индексы родителя создаются в каждой партиции
+CREATE INDEX IF NOT EXISTS idx_page_views_timestamp_id ON page_views(timestamp, id);
 CREATE INDEX IF NOT EXISTS idx_page_views_page ON page_views(page);
 CREATE INDEX IF NOT EXISTS idx_page_views_user_id ON page_views(user_id);
 
-CREATE INDEX IF NOT EXISTS idx_click_events_timestamp ON click_events(timestamp);
+CREATE INDEX IF NOT EXISTS idx_click_events_timestamp_id ON click_events(timestamp, id);
 CREATE INDEX IF NOT EXISTS idx_click_events_page ON click_events(page);
 
-CREATE INDEX IF NOT EXISTS idx_performance_events_timestamp ON performance_events(timestamp);
+CREATE INDEX IF NOT EXISTS idx_performance_events_timestamp_id ON performance_events(timestamp, id);
 CREATE INDEX IF NOT EXISTS idx_performance_events_page ON performance_events(page);
 
-CREATE INDEX IF NOT EXISTS idx_error_events_timestamp ON error_events(timestamp);
+CREATE INDEX IF NOT EXISTS idx_error_events_timestamp_id ON error_events(timestamp, id);
 CREATE INDEX IF NOT EXISTS idx_error_events_severity ON error_events(severity);
 
-CREATE INDEX IF NOT EXISTS idx_custom_events_timestamp ON custom_events(timestamp);
+CREATE INDEX IF NOT EXISTS idx_custom_events_timestamp_id ON custom_events(timestamp, id);
 CREATE INDEX IF NOT EXISTS idx_custom_events_name ON custom_events(name);
 
 INSERT INTO page_views (page, user_id, session_id, referrer) VALUES
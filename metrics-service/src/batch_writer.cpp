@@ -0,0 +1,367 @@
+#include "batch_writer.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <pqxx/pqxx>
+#include <utility>
+
+namespace {
+int64_t now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+} // namespace
+
+BatchWriterConfig load_batch_writer_config() {
+    const char* size_env = std::getenv("BATCH_MAX_SIZE");
+    const char* latency_env = std::getenv("BATCH_MAX_LATENCY_MS");
+    const char* pending_env = std::getenv("BATCH_MAX_PENDING");
+    const char* horizon_env = std::getenv("BATCH_HORIZON_WAIT_MS");
+
+    BatchWriterConfig config;
+    if (size_env) {
+        config.max_batch_size = std::stoul(size_env);
+    }
+    if (latency_env) {
+        config.max_latency = std::chrono::milliseconds(std::stol(latency_env));
+    }
+    config.max_pending = pending_env ? std::stoul(pending_env) : config.max_batch_size * 10;
+    if (config.max_pending < config.max_batch_size) {
+        config.max_pending = config.max_batch_size;
+    }
+    if (horizon_env) {
+        config.horizon_wait = std::chrono::milliseconds(std::stol(horizon_env));
+    }
+
+    return config;
+}
+
+BatchWriter::BatchWriter(std::shared_ptr<ConnectionPool> pool, const BatchWriterConfig& config)
+    : pool_(std::move(pool)), config_(config) {
+}
+
+BatchWriter::~BatchWriter() {
+    stop();
+}
+
+void BatchWriter::setCommitCallback(CommitCallback callback) {
+    callback_ = std::move(callback);
+}
+
+void BatchWriter::setSegmentStore(std::shared_ptr<SegmentStore> segments) {
+    segments_ = std::move(segments);
+}
+
+void BatchWriter::start() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            return;
+        }
+        running_ = true;
+    }
+    flush_thread_ = std::thread(&BatchWriter::flushLoop, this);
+    std::cout << "[BatchWriter] Started: max_batch_size=" << config_.max_batch_size
+              << ", max_latency_ms=" << config_.max_latency.count() << std::endl;
+}
+
+void BatchWriter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    flush_cv_.notify_all();
+    space_cv_.notify_all();
+    if (flush_thread_.joinable()) {
+        flush_thread_.join();
+    }
+}
+
+std::vector<DeliveryTag> BatchWriter::Batch::tags() const {
+    std::vector<DeliveryTag> all;
+    all.reserve(size());
+    for (const auto* rows : {&page_views.tags, &clicks.tags, &performance.tags, &errors.tags, &custom.tags}) {
+        all.insert(all.end(), rows->begin(), rows->end());
+    }
+    return all;
+}
+
+std::pair<BatchWriter::Batch, BatchWriter::Batch> BatchWriter::Batch::split(size_t count) const {
+    std::pair<Batch, Batch> halves;
+    auto take = [&count](const auto& from, auto& head, auto& tail) {
+        const size_t n = std::min(count, from.tags.size());
+        head.events.assign(from.events.begin(), from.events.begin() + n);
+        head.tags.assign(from.tags.begin(), from.tags.begin() + n);
+        tail.events.assign(from.events.begin() + n, from.events.end());
+        tail.tags.assign(from.tags.begin() + n, from.tags.end());
+        count -= n;
+    };
+    take(page_views, halves.first.page_views, halves.second.page_views);
+    take(clicks, halves.first.clicks, halves.second.clicks);
+    take(performance, halves.first.performance, halves.second.performance);
+    take(errors, halves.first.errors, halves.second.errors);
+    take(custom, halves.first.custom, halves.second.custom);
+    return halves;
+}
+
+template <typename Event>
+void BatchWriter::enqueue(Rows<Event> Batch::*rows, const Event& event, const DeliveryTag& tag) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_cv_.wait(lock, [this] { return pending_.size() < config_.max_pending || !running_; });
+
+    if (pending_.size() == 0) {
+        oldest_ = std::chrono::steady_clock::now();
+    }
+    (pending_.*rows).events.push_back(event);
+    (pending_.*rows).tags.push_back(tag);
+
+    if (pending_.size() >= config_.max_batch_size) {
+        flush_cv_.notify_one();
+    }
+}
+
+void BatchWriter::add(const PageView& event, const DeliveryTag& tag) {
+    enqueue(&Batch::page_views, event, tag);
+}
+
+void BatchWriter::add(const ClickEvent& event, const DeliveryTag& tag) {
+    enqueue(&Batch::clicks, event, tag);
+}
+
+void BatchWriter::add(const PerformanceEvent& event, const DeliveryTag& tag) {
+    enqueue(&Batch::performance, event, tag);
+}
+
+void BatchWriter::add(const ErrorEvent& event, const DeliveryTag& tag) {
+    enqueue(&Batch::errors, event, tag);
+}
+
+void BatchWriter::add(const CustomEvent& event, const DeliveryTag& tag) {
+    enqueue(&Batch::custom, event, tag);
+}
+
+void BatchWriter::flushLoop() {
+    std::cout << "[BatchWriter] Flush loop started" << std::endl;
+
+    while (true) {
+        Batch batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            // Ждём либо полной пачки, либо дедлайна по самому старому событию
+            while (running_ && pending_.size() < config_.max_batch_size) {
+                if (pending_.size() == 0) {
+                    flush_cv_.wait(lock);
+                } else if (flush_cv_.wait_until(lock, oldest_ + config_.max_latency) ==
+                           std::cv_status::timeout) {
+                    break;
+                }
+            }
+            if (pending_.size() == 0) {
+                if (!running_) {
+                    break;
+                }
+                continue;
+            }
+            std::swap(batch, pending_);
+        }
+        space_cv_.notify_all();
+
+        // Одно время приёма на пачку, в том числе на её части при делении
+        int64_t received_us;
+        {
+            std::lock_guard<std::mutex> lock(horizon_mutex_);
+            received_us = std::max(last_received_us_, now_us());
+            last_received_us_ = received_us;
+            in_flight_us_ = received_us;
+        }
+        const bool settled = settle(batch, received_us);
+        {
+            // Возвращённые в очередь сообщения получат новое, большее время приёма
+            std::lock_guard<std::mutex> lock(horizon_mutex_);
+            in_flight_us_ = 0;
+        }
+        horizon_cv_.notify_all();
+
+        if (!settled) {
+            // Сообщения вернутся в очередь, не крутимся вхолостую, пока БД недоступна
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+    }
+
+    std::cout << "[BatchWriter] Flush loop stopped" << std::endl;
+}
+
+int64_t BatchWriter::ingestHorizon(int64_t wanted_us) {
+    std::unique_lock<std::mutex> lock(horizon_mutex_);
+    auto current = [this] {
+        if (in_flight_us_ != 0) {
+            return in_flight_us_;
+        }
+        last_received_us_ = std::max(last_received_us_, now_us());
+        return last_received_us_;
+    };
+
+    // Без пишущейся пачки граница — текущее время, его тоже ждём (часы
+    // агрегатора могут немного спешить), поэтому проверяем и без уведомлений
+    const auto deadline = std::chrono::steady_clock::now() + config_.horizon_wait;
+    int64_t horizon = current();
+    while (horizon < wanted_us && std::chrono::steady_clock::now() < deadline) {
+        horizon_cv_.wait_until(lock, std::min(deadline, std::chrono::steady_clock::now() +
+                                                            std::chrono::milliseconds(10)));
+        horizon = current();
+    }
+    return horizon;
+}
+
+void BatchWriter::notify(const std::vector<DeliveryTag>& tags, WriteOutcome outcome) {
+    if (callback_) {
+        callback_(tags, outcome);
+    }
+}
+
+bool BatchWriter::settle(const Batch& batch, int64_t received_us) {
+    switch (writeBatch(batch, received_us)) {
+    case WriteResult::Committed:
+        notify(batch.tags(), WriteOutcome::Committed);
+        return true;
+    case WriteResult::Transient:
+        notify(batch.tags(), WriteOutcome::Retry);
+        return false;
+    case WriteResult::DataError:
+        break;
+    }
+
+    if (batch.size() == 1) {
+        std::cerr << "[BatchWriter] Rejecting event that cannot be written" << std::endl;
+        notify(batch.tags(), WriteOutcome::Rejected);
+        return true;
+    }
+    // Плохих событий обычно единицы: половины без них коммитятся целиком
+    auto [head, tail] = batch.split(batch.size() / 2);
+    if (!settle(head, received_us)) {
+        notify(tail.tags(), WriteOutcome::Retry);
+        return false;
+    }
+    return settle(tail, received_us);
+}
+
+BatchWriter::WriteResult BatchWriter::writeBatch(const Batch& batch, int64_t received_us) {
+    ConnectionPool::Lease conn;
+    try {
+        copyBatch(conn, batch, received_us);
+    } catch (const pqxx::broken_connection& ex) {
+        std::cerr << "[BatchWriter] Connection lost: " << ex.what() << std::endl;
+        conn.invalidate();
+        return WriteResult::Transient;
+    } catch (const PoolTimeoutError& ex) {
+        std::cerr << "[BatchWriter] " << ex.what() << std::endl;
+        return WriteResult::Transient;
+    } catch (const pqxx::in_doubt_error& ex) {
+        // Коммит мог пройти: повтор даст дубли, но не потеряет события
+        std::cerr << "[BatchWriter] Commit outcome unknown: " << ex.what() << std::endl;
+        conn.invalidate();
+        return WriteResult::Transient;
+    } catch (const pqxx::data_exception& ex) {
+        std::cerr << "[BatchWriter] Batch of " << batch.size() << " events rejected: " << ex.what()
+                  << std::endl;
+        return WriteResult::DataError;
+    } catch (const pqxx::integrity_constraint_violation& ex) {
+        // В том числе unique_violation
+        std::cerr << "[BatchWriter] Batch of " << batch.size()
+                  << " events violates a constraint: " << ex.what() << std::endl;
+        return WriteResult::DataError;
+    } catch (const std::exception& ex) {
+        // Таймаут запроса, нехватка ресурсов, deadlock и прочее: данные ни при чём,
+        // деление пачки лишь разослало бы её в dead-letter по одному событию
+        std::cerr << "[BatchWriter] Failed to write batch of " << batch.size()
+                  << " events: " << ex.what() << std::endl;
+        return WriteResult::Transient;
+    }
+
+    if (segments_) {
+        segments_->append(batch.page_views.events, received_us);
+        segments_->append(batch.clicks.events, received_us);
+        segments_->append(batch.performance.events, received_us);
+        segments_->append(batch.errors.events, received_us);
+        segments_->append(batch.custom.events, received_us);
+    }
+    std::cout << "[BatchWriter] Committed " << batch.size() << " events (page_views="
+              << batch.page_views.events.size() << ", clicks=" << batch.clicks.events.size()
+              << ", performance=" << batch.performance.events.size()
+              << ", errors=" << batch.errors.events.size() << ", custom=" << batch.custom.events.size()
+              << ")" << std::endl;
+    return WriteResult::Committed;
+}
+
+void BatchWriter::copyBatch(ConnectionPool::Lease& conn, const Batch& batch, int64_t received_us) {
+    conn = pool_->acquire();
+    pqxx::work tx(*conn);
+    const int64_t now = received_us / 1000000;
+    // То же значение уходит в SegmentStore
+    const std::string received_at = format_utc_time_us(received_us);
+
+    // Пустые optional пишем как "", как и одиночные INSERT в database.cpp
+    if (!batch.page_views.events.empty()) {
+        auto stream = pqxx::stream_to::table(
+            tx, {"page_views"}, {"page", "user_id", "session_id", "referrer", "timestamp", "received_at"});
+        for (const auto& e : batch.page_views.events) {
+            stream.write_values(e.page, e.user_id.value_or(""), e.session_id.value_or(""),
+                                e.referrer.value_or(""), format_event_time(e.timestamp, now), received_at);
+        }
+        stream.complete();
+    }
+
+    if (!batch.clicks.events.empty()) {
+        auto stream = pqxx::stream_to::table(
+            tx, {"click_events"},
+            {"page", "element_id", "action", "user_id", "session_id", "timestamp", "received_at"});
+        for (const auto& e : batch.clicks.events) {
+            stream.write_values(e.page, e.element_id.value_or(""), e.action.value_or(""),
+                                e.user_id.value_or(""), e.session_id.value_or(""),
+                                format_event_time(e.timestamp, now), received_at);
+        }
+        stream.complete();
+    }
+
+    if (!batch.performance.events.empty()) {
+        auto stream = pqxx::stream_to::table(tx, {"performance_events"},
+                                             {"page", "ttfb_ms", "fcp_ms", "lcp_ms",
+                                              "total_page_load_ms", "user_id", "session_id", "timestamp",
+                                              "received_at"});
+        for (const auto& e : batch.performance.events) {
+            stream.write_values(e.page, e.ttfb_ms.value_or(0.0), e.fcp_ms.value_or(0.0),
+                                e.lcp_ms.value_or(0.0), e.total_page_load_ms.value_or(0.0),
+                                e.user_id.value_or(""), e.session_id.value_or(""),
+                                format_event_time(e.timestamp, now), received_at);
+        }
+        stream.complete();
+    }
+
+    if (!batch.errors.events.empty()) {
+        auto stream = pqxx::stream_to::table(tx, {"error_events"},
+                                             {"page", "error_type", "message", "stack",
+                                              "severity", "user_id", "session_id", "timestamp",
+                                              "received_at"});
+        for (const auto& e : batch.errors.events) {
+            stream.write_values(e.page, e.error_type.value_or(""), e.message.value_or(""),
+                                e.stack.value_or(""), e.severity.value_or(0),
+                                e.user_id.value_or(""), e.session_id.value_or(""),
+                                format_event_time(e.timestamp, now), received_at);
+        }
+        stream.complete();
+    }
+
+    if (!batch.custom.events.empty()) {
+        auto stream = pqxx::stream_to::table(
+            tx, {"custom_events"}, {"name", "page", "user_id", "session_id", "timestamp", "received_at"});
+        for (const auto& e : batch.custom.events) {
+            stream.write_values(e.name, e.page.value_or(""), e.user_id.value_or(""),
+                                e.session_id.value_or(""), format_event_time(e.timestamp, now), received_at);
+        }
+        stream.complete();
+    }
+
+    tx.commit();
+}
@@ -0,0 +1,264 @@
+#include "connection_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <pqxx/pqxx>
+#include <sstream>
+#include <utility>
+
+namespace {
+double to_ms(std::chrono::steady_clock::duration d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+} // namespace
+
+ConnectionPoolConfig load_connection_pool_config() {
+    const char* min_env = std::getenv("DB_POOL_MIN_SIZE");
+    const char* max_env = std::getenv("DB_POOL_MAX_SIZE");
+    const char* timeout_env = std::getenv("DB_POOL_CHECKOUT_TIMEOUT_MS");
+    const char* health_env = std::getenv("DB_POOL_HEALTH_CHECK_MS");
+
+    ConnectionPoolConfig config;
+    if (min_env) {
+        config.min_size = std::stoul(min_env);
+    }
+    if (max_env) {
+        config.max_size = std::stoul(max_env);
+    }
+    if (timeout_env) {
+        config.checkout_timeout = std::chrono::milliseconds(std::stol(timeout_env));
+    }
+    if (health_env) {
+        config.health_check_after = std::chrono::milliseconds(std::stol(health_env));
+    }
+    config.max_size = std::max<size_t>(config.max_size, 1);
+    config.min_size = std::min(config.min_size, config.max_size);
+
+    return config;
+}
+
+std::string ConnectionPoolStats::toJson() const {
+    std::ostringstream out;
+    out << R"({"max_size":)" << max_size << R"(,"open":)" << open << R"(,"in_use":)" << in_use
+        << R"(,"idle":)" << idle << R"(,"waiting":)" << waiting
+        << R"(,"utilization":)" << utilization() << R"(,"checkouts":)" << checkouts
+        << R"(,"timeouts":)" << timeouts << R"(,"connect_failures":)" << connect_failures
+        << R"(,"health_check_failures":)" << health_check_failures << R"(,"waits":)" << waits
+        << R"(,"avg_wait_ms":)" << avg_wait_ms << R"(,"max_wait_ms":)" << max_wait_ms
+        << R"(,"avg_checkout_ms":)" << avg_checkout_ms
+        << R"(,"max_checkout_ms":)" << max_checkout_ms << R"(,"avg_hold_ms":)" << avg_hold_ms
+        << "}";
+    return out.str();
+}
+
+// ===== Lease =====
+
+ConnectionPool::Lease::Lease(ConnectionPool* pool, std::unique_ptr<pqxx::connection> conn)
+    : pool_(pool), conn_(std::move(conn)), acquired_at_(std::chrono::steady_clock::now()) {
+}
+
+ConnectionPool::Lease::Lease(Lease&& other) noexcept
+    : pool_(std::exchange(other.pool_, nullptr)), conn_(std::move(other.conn_)),
+      acquired_at_(other.acquired_at_), broken_(other.broken_) {
+}
+
+ConnectionPool::Lease& ConnectionPool::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        release();
+        pool_ = std::exchange(other.pool_, nullptr);
+        conn_ = std::move(other.conn_);
+        acquired_at_ = other.acquired_at_;
+        broken_ = other.broken_;
+    }
+    return *this;
+}
+
+ConnectionPool::Lease::~Lease() {
+    release();
+}
+
+void ConnectionPool::Lease::release() {
+    if (pool_ && conn_) {
+        pool_->giveBack(std::move(conn_), broken_,
+                        std::chrono::steady_clock::now() - acquired_at_);
+    }
+    pool_ = nullptr;
+}
+
+// ===== ConnectionPool =====
+
+ConnectionPool::ConnectionPool(const DatabaseConfig& db_config, const ConnectionPoolConfig& config)
+    : db_config_(db_config), config_(config) {
+}
+
+ConnectionPool::~ConnectionPool() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    idle_.clear();
+}
+
+std::unique_ptr<pqxx::connection> ConnectionPool::openConnection() {
+    return std::make_unique<pqxx::connection>(build_connection_string(db_config_));
+}
+
+bool ConnectionPool::isHealthy(pqxx::connection& conn) {
+    try {
+        if (!conn.is_open()) {
+            return false;
+        }
+        pqxx::nontransaction tx(conn);
+        tx.exec("SELECT 1");
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "[DBPool] Health check failed: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+size_t ConnectionPool::warmUp() {
+    std::vector<Lease> leases;
+    try {
+        while (leases.size() < config_.min_size) {
+            leases.push_back(acquire());
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[DBPool] Warm-up stopped: " << e.what() << std::endl;
+    }
+    std::cout << "[DBPool] Warmed up " << leases.size() << "/" << config_.min_size
+              << " connections (max " << config_.max_size << ")" << std::endl;
+    return leases.size();
+}
+
+ConnectionPool::Lease ConnectionPool::acquire() {
+    const auto start = std::chrono::steady_clock::now();
+    const auto deadline = start + config_.checkout_timeout;
+    std::chrono::steady_clock::duration waited{};
+
+    auto finish = [&]() {
+        const auto checkout = std::chrono::steady_clock::now() - start;
+        ++checkouts_;
+        total_checkout_ += checkout;
+        max_checkout_ = std::max(max_checkout_, checkout);
+        if (waited.count() > 0) {
+            ++waits_;
+            total_wait_ += waited;
+            max_wait_ = std::max(max_wait_, waited);
+        }
+    };
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        if (!idle_.empty()) {
+            IdleConnection candidate = std::move(idle_.back());
+            idle_.pop_back();
+            ++in_use_;
+
+            const bool stale =
+                std::chrono::steady_clock::now() - candidate.since >= config_.health_check_after;
+            if (stale || !candidate.conn->is_open()) {
+                lock.unlock();
+                const bool healthy = isHealthy(*candidate.conn);
+                lock.lock();
+                if (!healthy) {
+                    --in_use_;
+                    --open_;
+                    ++health_check_failures_;
+                    available_cv_.notify_one();
+                    continue;
+                }
+            }
+
+            finish();
+            return Lease(this, std::move(candidate.conn));
+        }
+
+        if (open_ < config_.max_size) {
+            ++open_;
+            ++in_use_;
+            lock.unlock();
+
+            std::unique_ptr<pqxx::connection> conn;
+            try {
+                conn = openConnection();
+            } catch (...) {
+                lock.lock();
+                --open_;
+                --in_use_;
+                ++connect_failures_;
+                available_cv_.notify_one();
+                throw;
+            }
+
+            lock.lock();
+            finish();
+            return Lease(this, std::move(conn));
+        }
+
+        const auto wait_start = std::chrono::steady_clock::now();
+        ++waiting_;
+        const auto status = available_cv_.wait_until(lock, deadline);
+        --waiting_;
+        waited += std::chrono::steady_clock::now() - wait_start;
+
+        if (status == std::cv_status::timeout && idle_.empty() && open_ >= config_.max_size) {
+            ++timeouts_;
+            throw PoolTimeoutError("database connection pool exhausted (" +
+                                   std::to_string(config_.max_size) + " connections in use)");
+        }
+    }
+}
+
+void ConnectionPool::giveBack(std::unique_ptr<pqxx::connection> conn, bool broken,
+                              std::chrono::steady_clock::duration held) {
+    const bool keep = !broken && conn->is_open();
+    if (!keep) {
+        conn.reset();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --in_use_;
+        ++releases_;
+        total_hold_ += held;
+        if (keep) {
+            idle_.push_back({std::move(conn), std::chrono::steady_clock::now()});
+        } else {
+            --open_;
+        }
+    }
+    available_cv_.notify_one();
+}
+
+bool ConnectionPool::ping() {
+    try {
+        Lease conn = acquire();
+        pqxx::nontransaction tx(*conn);
+        tx.exec("SELECT 1");
+        return true;
+    } catch (const std::exception& e) {
+        std::cerr << "[DBPool] Ping failed: " << e.what() << std::endl;
+        return false;
+    }
+}
+
+ConnectionPoolStats ConnectionPool::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ConnectionPoolStats s;
+    s.max_size = config_.max_size;
+    s.open = open_;
+    s.in_use = in_use_;
+    s.idle = idle_.size();
+    s.waiting = waiting_;
+    s.checkouts = checkouts_;
+    s.timeouts = timeouts_;
+    s.connect_failures = connect_failures_;
+    s.health_check_failures = health_check_failures_;
+    s.waits = waits_;
+    s.avg_wait_ms = waits_ ? to_ms(total_wait_) / static_cast<double>(waits_) : 0.0;
+    s.max_wait_ms = to_ms(max_wait_);
+    s.avg_checkout_ms = checkouts_ ? to_ms(total_checkout_) / static_cast<double>(checkouts_) : 0.0;
+    s.max_checkout_ms = to_ms(max_checkout_);
+    s.avg_hold_ms = releases_ ? to_ms(total_hold_) / static_cast<double>(releases_) : 0.0;
+    return s;
+}
@@ -1,16 +1,17 @@
 #include "database.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstdlib>
+#include <ctime>
 #include <iostream>
 #include <pqxx/pqxx>
 
-namespace {
-    std::string build_connection_string(const DatabaseConfig& config) {
-        return "host=" + config.host +
-               " dbname=" + config.dbname +
-               " user=" + config.user +
-               " password=" + config.password;
-    }
+std::string build_connection_string(const DatabaseConfig& config) {
+    return "host=" + config.host +
+           " dbname=" + config.dbname +
+           " user=" + config.user +
+           " password=" + config.password;
 }
 
 DatabaseConfig load_database_config() {
@@ -53,17 +54,45 @@ bool test_database_connection(const DatabaseConfig& config) {
     }
 }
 
+std::string format_utc_time(int64_t seconds) {
+    const auto time = static_cast<std::time_t>(seconds);
+    std::tm tm{};
+    gmtime_r(&time, &tm);
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%Y-%m-%d %H:%M:%S+00", &tm);
+    return buffer;
+}
+
+std::string format_utc_time_us(int64_t micros) {
+    std::string time = format_utc_time(micros / 1000000);
+    char fraction[16];
+    std::snprintf(fraction, sizeof(fraction), ".%06d", static_cast<int>(micros % 1000000));
+    return time.insert(time.size() - 3, fraction);
+}
+
+std::string format_event_time(const std::optional<int64_t>& timestamp, int64_t now) {
+    return format_utc_time(std::min(timestamp.value_or(now), now));
+}
+
+// Время события из параметра $n (unix-секунды или NULL), не позже времени записи.
+// LEAST пропускает NULL, так что без метки остаётся NOW()
+static std::string event_time_sql(int param) {
+    return "LEAST(to_timestamp($" + std::to_string(param) + "::bigint), NOW())";
+}
+
 bool save_page_view(const DatabaseConfig& config, const PageView& event) {
     try {
         pqxx::connection conn(build_connection_string(config));
         pqxx::work tx(conn);
 
         tx.exec_params(
-            "INSERT INTO page_views (page, user_id, session_id, referrer) VALUES ($1, $2, $3, $4)",
+            "INSERT INTO page_views (page, user_id, session_id, referrer, timestamp) "
+            "VALUES ($1, $2, $3, $4, " + event_time_sql(5) + ")",
             event.page,
             event.user_id.value_or(""),
             event.session_id.value_or(""),
-            event.referrer.value_or("")
+            event.referrer.value_or(""),
+            event.timestamp
         );
 
         tx.commit();
@@ -81,12 +110,14 @@ bool save_click_event(const DatabaseConfig& config, const ClickEvent& event) {
         pqxx::work tx(conn);
 
         tx.exec_params(
-            "INSERT INTO click_events (page, element_id, action, user_id, session_id) VALUES ($1, $2, $3, $4, $5)",
+            "INSERT INTO click_events (page, element_id, action, user_id, session_id, timestamp) "
+            "VALUES ($1, $2, $3, $4, $5, " + event_time_sql(6) + ")",
             event.page,
             event.element_id.value_or(""),
             event.action.value_or(""),
             event.user_id.value_or(""),
-            event.session_id.value_or("")
+            event.session_id.value_or(""),
+            event.timestamp
         );
 
         tx.commit();
@@ -104,15 +135,16 @@ bool save_performance_event(const DatabaseConfig& config, const PerformanceEvent
         pqxx::work tx(conn);
 
         tx.exec_params(
-            "INSERT INTO performance_events (page, ttfb_ms, fcp_ms, lcp_ms, total_page_load_ms, user_id, session_id) "
-            "VALUES ($1, $2, $3, $4, $5, $6, $7)",
+            "INSERT INTO performance_events (page, ttfb_ms, fcp_ms, lcp_ms, total_page_load_ms, user_id, session_id, timestamp) "
+            "VALUES ($1, $2, $3, $4, $5, $6, $7, " + event_time_sql(8) + ")",
             event.page,
             event.ttfb_ms.value_or(0.0),
             event.fcp_ms.value_or(0.0),
             event.lcp_ms.value_or(0.0),
             event.total_page_load_ms.value_or(0.0),
             event.user_id.value_or(""),
-            event.session_id.value_or("")
+            event.session_id.value_or(""),
+            event.timestamp
         );
 
         tx.commit();
@@ -130,15 +162,16 @@ bool save_error_event(const DatabaseConfig& config, const ErrorEvent& event) {
         pqxx::work tx(conn);
 
         tx.exec_params(
-            "INSERT INTO error_events (page, error_type, message, stack, severity, user_id, session_id) "
-            "VALUES ($1, $2, $3, $4, $5, $6, $7)",
+            "INSERT INTO error_events (page, error_type, message, stack, severity, user_id, session_id, timestamp) "
+            "VALUES ($1, $2, $3, $4, $5, $6, $7, " + event_time_sql(8) + ")",
             event.page,
             event.error_type.value_or(""),
             event.message.value_or(""),
             event.stack.value_or(""),
             event.severity.value_or(0),
             event.user_id.value_or(""),
-            event.session_id.value_or("")
+            event.session_id.value_or(""),
+            event.timestamp
         );
 
         tx.commit();
@@ -156,11 +189,13 @@ bool save_custom_event(const DatabaseConfig& config, const CustomEvent& event) {
         pqxx::work tx(conn);
 
         tx.exec_params(
-            "INSERT INTO custom_events (name, page, user_id, session_id) VALUES ($1, $2, $3, $4)",
+            "INSERT INTO custom_events (name, page, user_id, session_id, timestamp) "
+            "VALUES ($1, $2, $3, $4, " + event_time_sql(5) + ")",
             event.name,
             event.page.value_or(""),
             event.user_id.value_or(""),
-            event.session_id.value_or("")
+            event.session_id.value_or(""),
+            event.timestamp
         );
 
         tx.commit();
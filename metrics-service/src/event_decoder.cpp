@@ -0,0 +1,231 @@
+#include "event_decoder.h"
+
+#include <nlohmann/json.hpp>
+
+#include "metrics.pb.h"
+
+using json = nlohmann::json;
+
+namespace {
+
+enum class EventKind { PageView, Click, Performance, Error, Custom };
+
+EventKind event_kind(const std::string& queue) {
+    if (queue == "page_views")
+        return EventKind::PageView;
+    if (queue == "clicks")
+        return EventKind::Click;
+    if (queue == "performance_events")
+        return EventKind::Performance;
+    if (queue == "error_events")
+        return EventKind::Error;
+    if (queue == "custom_events")
+        return EventKind::Custom;
+    throw std::invalid_argument("Unknown queue: " + queue);
+}
+
+// ==================== Protobuf ====================
+
+template <typename Message>
+Message parse_proto(const std::string& body) {
+    Message message;
+    if (!message.ParseFromString(body)) {
+        throw std::invalid_argument("Malformed protobuf " + message.GetTypeName());
+    }
+    return message;
+}
+
+DecodedEvent decode_proto(EventKind kind, const std::string& body) {
+    switch (kind) {
+        case EventKind::PageView: {
+            auto message = parse_proto<metricsys::PageViewEvent>(body);
+            PageView event;
+            event.page = std::move(*message.mutable_page());
+            if (message.has_user_id())
+                event.user_id = std::move(*message.mutable_user_id());
+            if (message.has_session_id())
+                event.session_id = std::move(*message.mutable_session_id());
+            if (message.has_referrer())
+                event.referrer = std::move(*message.mutable_referrer());
+            if (message.timestamp() != 0)
+                event.timestamp = message.timestamp();
+            return event;
+        }
+        case EventKind::Click: {
+            auto message = parse_proto<metricsys::ClickEvent>(body);
+            ClickEvent event;
+            event.page = std::move(*message.mutable_page());
+            event.element_id = std::move(*message.mutable_element_id());
+            if (message.has_action())
+                event.action = std::move(*message.mutable_action());
+            if (message.has_user_id())
+                event.user_id = std::move(*message.mutable_user_id());
+            if (message.has_session_id())
+                event.session_id = std::move(*message.mutable_session_id());
+            if (message.timestamp() != 0)
+                event.timestamp = message.timestamp();
+            return event;
+        }
+        case EventKind::Performance: {
+            auto message = parse_proto<metricsys::PerformanceEvent>(body);
+            PerformanceEvent event;
+            event.page = std::move(*message.mutable_page());
+            if (message.has_ttfb_ms())
+                event.ttfb_ms = message.ttfb_ms();
+            if (message.has_fcp_ms())
+                event.fcp_ms = message.fcp_ms();
+            if (message.has_lcp_ms())
+                event.lcp_ms = message.lcp_ms();
+            if (message.has_total_page_load_ms())
+                event.total_page_load_ms = message.total_page_load_ms();
+            if (message.has_user_id())
+                event.user_id = std::move(*message.mutable_user_id());
+            if (message.has_session_id())
+                event.session_id = std::move(*message.mutable_session_id());
+            if (message.timestamp() != 0)
+                event.timestamp = message.timestamp();
+            return event;
+        }
+        case EventKind::Error: {
+            auto message = parse_proto<metricsys::ErrorEvent>(body);
+            ErrorEvent event;
+            event.page = std::move(*message.mutable_page());
+            event.error_type = std::move(*message.mutable_error_type());
+            event.message = std::move(*message.mutable_message());
+            if (message.has_stack())
+                event.stack = std::move(*message.mutable_stack());
+            // В базе и в JSON-сообщениях warning=0, error=1, critical=2
+            if (message.severity() != metricsys::SEVERITY_UNSPECIFIED) {
+                event.severity = static_cast<int32_t>(message.severity()) - 1;
+            }
+            if (message.has_user_id())
+                event.user_id = std::move(*message.mutable_user_id());
+            if (message.has_session_id())
+                event.session_id = std::move(*message.mutable_session_id());
+            if (message.timestamp() != 0)
+                event.timestamp = message.timestamp();
+            return event;
+        }
+        case EventKind::Custom: {
+            auto message = parse_proto<metricsys::CustomEvent>(body);
+            CustomEvent event;
+            event.name = std::move(*message.mutable_name());
+            if (message.has_page())
+                event.page = std::move(*message.mutable_page());
+            if (message.has_user_id())
+                event.user_id = std::move(*message.mutable_user_id());
+            if (message.has_session_id())
+                event.session_id = std::move(*message.mutable_session_id());
+            if (message.timestamp() != 0)
+                event.timestamp = message.timestamp();
+            return event;
+        }
+    }
+    throw std::invalid_argument("Unknown event kind");
+}
+
+// ==================== JSON ====================
+
+// Один поиск ключа на поле; null и отсутствие равнозначны
+template <typename T>
+void read_optional(const json& data, const char* key, std::optional<T>& out) {
+    auto it = data.find(key);
+    if (it != data.end() && !it->is_null()) {
+        out = it->get<T>();
+    }
+}
+
+std::string read_string(const json& data, const char* key) {
+    auto it = data.find(key);
+    return it != data.end() && it->is_string() ? it->get<std::string>() : std::string();
+}
+
+DecodedEvent decode_json(EventKind kind, const std::string& body) {
+    json data = json::parse(body);
+    switch (kind) {
+        case EventKind::PageView: {
+            PageView event;
+            event.page = read_string(data, "page");
+            read_optional(data, "user_id", event.user_id);
+            read_optional(data, "session_id", event.session_id);
+            read_optional(data, "referrer", event.referrer);
+            read_optional(data, "timestamp", event.timestamp);
+            return event;
+        }
+        case EventKind::Click: {
+            ClickEvent event;
+            event.page = read_string(data, "page");
+            read_optional(data, "element_id", event.element_id);
+            read_optional(data, "action", event.action);
+            read_optional(data, "user_id", event.user_id);
+            read_optional(data, "session_id", event.session_id);
+            read_optional(data, "timestamp", event.timestamp);
+            return event;
+        }
+        case EventKind::Performance: {
+            PerformanceEvent event;
+            event.page = read_string(data, "page");
+            read_optional(data, "ttfb_ms", event.ttfb_ms);
+            read_optional(data, "fcp_ms", event.fcp_ms);
+            read_optional(data, "lcp_ms", event.lcp_ms);
+            read_optional(data, "total_page_load_ms", event.total_page_load_ms);
+            read_optional(data, "user_id", event.user_id);
+            read_optional(data, "session_id", event.session_id);
+            read_optional(data, "timestamp", event.timestamp);
+            return event;
+        }
+        case EventKind::Error: {
+            ErrorEvent event;
+            event.page = read_string(data, "page");
+            read_optional(data, "error_type", event.error_type);
+            read_optional(data, "message", event.message);
+            read_optional(data, "stack", event.stack);
+            auto severity = data.find("severity");
+            if (severity != data.end() && !severity->is_null()) {
+                // Handle both string and int severity
+                if (severity->is_string()) {
+                    const auto& sev = severity->get_ref<const std::string&>();
+                    if (sev == "warning")
+                        event.severity = 0;
+                    else if (sev == "error")
+                        event.severity = 1;
+                    else if (sev == "critical")
+                        event.severity = 2;
+                } else {
+                    event.severity = severity->get<int32_t>();
+                }
+            }
+            read_optional(data, "user_id", event.user_id);
+            read_optional(data, "session_id", event.session_id);
+            read_optional(data, "timestamp", event.timestamp);
+            return event;
+        }
+        case EventKind::Custom: {
+            CustomEvent event;
+            event.name = read_string(data, "name");
+            read_optional(data, "page", event.page);
+            read_optional(data, "user_id", event.user_id);
+            read_optional(data, "session_id", event.session_id);
+            read_optional(data, "timestamp", event.timestamp);
+            return event;
+        }
+    }
+    throw std::invalid_argument("Unknown event kind");
+}
+
+}  // namespace
+
+DecodedEvent decode_event(const std::string& queue, std::string_view content_type, const std::string& body) {
+    EventKind kind = event_kind(queue);
+    if (content_type == CONTENT_TYPE_PROTOBUF) {
+        return decode_proto(kind, body);
+    }
+    if (content_type.empty() || content_type == CONTENT_TYPE_JSON) {
+        try {
+            return decode_json(kind, body);
+        } catch (const json::exception& e) {
+            throw std::invalid_argument(std::string("Invalid JSON: ") + e.what());
+        }
+    }
+    throw std::invalid_argument("Unsupported content type: " + std::string(content_type));
+}
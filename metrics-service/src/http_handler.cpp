@@ -55,6 +55,14 @@ HttpHandler::HttpHandler(int port, DatabaseCheckFunc db_check)
     });
 }
 
+void HttpHandler::addStatsRoute(const std::string& path, StatsFunc provider) {
+    impl_->server.Get(path, [path, provider](const httplib::Request& req, httplib::Response& res) {
+        res.set_content(provider(), "application/json");
+        std::cout << "[HTTP] GET " << path << " -> 200 OK" << std::endl;
+    });
+    stats_routes_.push_back(path);
+}
+
 HttpHandler::~HttpHandler() {
     stop();
 }
@@ -68,6 +76,9 @@ void HttpHandler::start() {
         std::cout << "  GET /health/ready - readiness probe" << std::endl;
         std::cout << "  GET /health       - health check" << std::endl;
         std::cout << "  GET /ping         - simple ping" << std::endl;
+        for (const auto& path : stats_routes_) {
+            std::cout << "  GET " << path << " - stats" << std::endl;
+        }
         impl_->server.listen("0.0.0.0", port_);
     });
 }
@@ -1,335 +1,632 @@
 #include "metrics.h"
 #include <pqxx/pqxx>
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
-MetricsServiceImpl::MetricsServiceImpl(const DatabaseConfig& db_config)
-    : db_config_(db_config) {}
+namespace {
+
+constexpr int DEFAULT_LIMIT = 100;
+constexpr int MAX_LIMIT = 10000;
+constexpr int DEFAULT_STREAM_CHUNK = 1000;
+constexpr int MAX_STREAM_CHUNK = 10000;
+
+const char* const NIL_UUID = "00000000-0000-0000-0000-000000000000";
+
+// received_at пишется временем начала пачки, а видна она только после коммита:
+// конец окна урезается до горизонта записи, иначе строки пишущейся пачки
+// появились бы в уже прочитанном окне. Ответ сообщает, докуда окно урезано
+template <typename Request>
+Request clamp_to_horizon(const IngestHorizon& horizon, const Request& request) {
+    Request clamped = request;
+    if (horizon && request.has_received_range()) {
+        const int64_t end = request.received_range().end_timestamp();
+        const int64_t until = horizon(end * 1000000) / 1000000;
+        clamped.mutable_received_range()->set_end_timestamp(std::min(end, until));
+    }
+    return clamped;
+}
 
-std::string MetricsServiceImpl::get_connection_string() const {
-    return "host=" + db_config_.host +
-           " dbname=" + db_config_.dbname +
-           " user=" + db_config_.user +
-           " password=" + db_config_.password;
+template <typename Request, typename Response>
+void set_received_until(const Request& request, Response* response) {
+    if (request.has_received_range()) {
+        response->set_received_until(request.received_range().end_timestamp());
+    }
 }
 
-grpc::Status MetricsServiceImpl::GetPageViews(
-    grpc::ServerContext* context,
-    const metricsys::GetPageViewsRequest* request,
-    metricsys::GetPageViewsResponse* response) {
-    
-    try {
-        pqxx::connection conn(get_connection_string());
-        pqxx::work tx(conn);
+// Выборка с received_range упорядочена по времени приёма, иначе — по времени события;
+// курсор after относится к той же колонке
+template <typename Request>
+const char* order_column(const Request& request) {
+    return request.has_received_range() ? "received_at" : "timestamp";
+}
 
-        std::stringstream query;
-        query << "SELECT id, page, user_id, session_id, referrer, "
-              << "EXTRACT(EPOCH FROM timestamp)::bigint as ts "
-              << "FROM page_views WHERE 1=1";
-
-        if (request->has_time_range()) {
-            query << " AND timestamp >= to_timestamp(" 
-                  << request->time_range().start_timestamp() << ")"
-                  << " AND timestamp <= to_timestamp(" 
-                  << request->time_range().end_timestamp() << ")";
-        }
+// Микросекунды нужны для курсора: секундного ts недостаточно,
+// чтобы однозначно продолжить выборку внутри одной секунды
+std::string timestamp_columns(const char* order) {
+    return std::string("EXTRACT(EPOCH FROM timestamp)::bigint as ts, "
+                       "EXTRACT(EPOCH FROM received_at)::bigint as received_ts, "
+                       "(EXTRACT(EPOCH FROM ") + order + ") * 1000000)::bigint as ts_us ";
+}
 
-        if (request->has_page_filter() && !request->page_filter().empty()) {
-            query << " AND page LIKE " << tx.quote("%" + request->page_filter() + "%");
-        }
+template <typename Request>
+void append_common_filters(std::ostream& query, pqxx::work& tx, const Request& request) {
+    // Границы — константы TIMESTAMPTZ: планировщик отсекает лишние дневные партиции
+    // ещё при планировании. Событие не бывает позже приёма (timestamp <= received_at),
+    // поэтому time_range ограничивает и received_at снизу
+    if (request.has_time_range()) {
+        const std::string start = format_utc_time(request.time_range().start_timestamp());
+        query << " AND timestamp >= TIMESTAMPTZ '" << start << "'"
+              << " AND timestamp <= TIMESTAMPTZ '"
+              << format_utc_time(request.time_range().end_timestamp()) << "'"
+              << " AND received_at >= TIMESTAMPTZ '" << start << "'";
+    }
 
-        if (request->has_user_id_filter() && !request->user_id_filter().empty()) {
-            query << " AND user_id = " << tx.quote(request->user_id_filter());
-        }
+    // Полуоткрытый [start, end): соседние окна не пересекаются
+    if (request.has_received_range()) {
+        query << " AND received_at >= TIMESTAMPTZ '"
+              << format_utc_time(request.received_range().start_timestamp()) << "'"
+              << " AND received_at < TIMESTAMPTZ '"
+              << format_utc_time(request.received_range().end_timestamp()) << "'";
+    }
 
-        if (request->has_pagination()) {
-            query << " LIMIT " << request->pagination().limit()
-                  << " OFFSET " << request->pagination().offset();
-        } else {
-            query << " LIMIT 100";
-        }
+    // Keyset: строго после (order, id) курсора, без OFFSET
+    if (request.has_after()) {
+        const auto& after = request.after();
+        query << " AND (" << order_column(request) << ", id) > (TIMESTAMPTZ 'epoch' + "
+              << after.timestamp_us() << " * INTERVAL '1 microsecond', "
+              << tx.quote(after.id().empty() ? std::string(NIL_UUID) : after.id()) << "::uuid)";
+    }
+}
 
-        pqxx::result result = tx.exec(query.str());
-        tx.commit();
+std::string build_query(pqxx::work& tx, const metricsys::GetPageViewsRequest& request) {
+    std::stringstream query;
+    query << "SELECT id, page, user_id, session_id, referrer, " << timestamp_columns(order_column(request))
+          << "FROM page_views WHERE 1=1";
 
-        for (const auto& row : result) {
-            auto* event = response->add_events();
-            event->set_id(row["id"].as<std::string>());
-            event->set_page(row["page"].as<std::string>());
-            event->set_user_id(row["user_id"].as<std::string>(""));
-            event->set_session_id(row["session_id"].as<std::string>(""));
-            event->set_referrer(row["referrer"].as<std::string>(""));
-            event->set_timestamp(row["ts"].as<int64_t>(0));
-        }
+    append_common_filters(query, tx, request);
 
-        response->set_total_count(result.size());
-        return grpc::Status::OK;
+    if (request.has_page_filter() && !request.page_filter().empty()) {
+        query << " AND page LIKE " << tx.quote("%" + request.page_filter() + "%");
+    }
 
-    } catch (const std::exception& e) {
-        std::cerr << "GetPageViews error: " << e.what() << std::endl;
-        return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+    if (request.has_user_id_filter() && !request.user_id_filter().empty()) {
+        query << " AND user_id = " << tx.quote(request.user_id_filter());
     }
+
+    query << " ORDER BY " << order_column(request) << ", id";
+    return query.str();
 }
 
-grpc::Status MetricsServiceImpl::GetClicks(
-    grpc::ServerContext* context,
-    const metricsys::GetClicksRequest* request,
-    metricsys::GetClicksResponse* response) {
-    
-    try {
-        pqxx::connection conn(get_connection_string());
-        pqxx::work tx(conn);
+std::string build_query(pqxx::work& tx, const metricsys::GetClicksRequest& request) {
+    std::stringstream query;
+    query << "SELECT id, page, element_id, action, user_id, session_id, " << timestamp_columns(order_column(request))
+          << "FROM click_events WHERE 1=1";
 
-        std::stringstream query;
-        query << "SELECT id, page, element_id, action, user_id, session_id, "
-              << "EXTRACT(EPOCH FROM timestamp)::bigint as ts "
-              << "FROM click_events WHERE 1=1";
-
-        if (request->has_time_range()) {
-            query << " AND timestamp >= to_timestamp(" 
-                  << request->time_range().start_timestamp() << ")"
-                  << " AND timestamp <= to_timestamp(" 
-                  << request->time_range().end_timestamp() << ")";
-        }
+    append_common_filters(query, tx, request);
 
-        if (request->has_page_filter() && !request->page_filter().empty()) {
-            query << " AND page LIKE " << tx.quote("%" + request->page_filter() + "%");
-        }
+    if (request.has_page_filter() && !request.page_filter().empty()) {
+        query << " AND page LIKE " << tx.quote("%" + request.page_filter() + "%");
+    }
 
-        if (request->has_element_id_filter() && !request->element_id_filter().empty()) {
-            query << " AND element_id LIKE " << tx.quote("%" + request->element_id_filter() + "%");
-        }
+    if (request.has_element_id_filter() && !request.element_id_filter().empty()) {
+        query << " AND element_id LIKE " << tx.quote("%" + request.element_id_filter() + "%");
+    }
 
-        if (request->has_user_id_filter() && !request->user_id_filter().empty()) {
-            query << " AND user_id = " << tx.quote(request->user_id_filter());
-        }
+    if (request.has_user_id_filter() && !request.user_id_filter().empty()) {
+        query << " AND user_id = " << tx.quote(request.user_id_filter());
+    }
 
-        if (request->has_pagination()) {
-            query << " LIMIT " << request->pagination().limit()
-                  << " OFFSET " << request->pagination().offset();
-        } else {
-            query << " LIMIT 100";
-        }
+    query << " ORDER BY " << order_column(request) << ", id";
+    return query.str();
+}
 
-        pqxx::result result = tx.exec(query.str());
-        tx.commit();
+std::string build_query(pqxx::work& tx, const metricsys::GetPerformanceRequest& request) {
+    std::stringstream query;
+    query << "SELECT id, page, ttfb_ms, fcp_ms, lcp_ms, total_page_load_ms, "
+          << "user_id, session_id, " << timestamp_columns(order_column(request))
+          << "FROM performance_events WHERE 1=1";
 
-        for (const auto& row : result) {
-            auto* event = response->add_events();
-            event->set_id(row["id"].as<std::string>());
-            event->set_page(row["page"].as<std::string>());
-            event->set_element_id(row["element_id"].as<std::string>(""));
-            event->set_action(row["action"].as<std::string>(""));
-            event->set_user_id(row["user_id"].as<std::string>(""));
-            event->set_session_id(row["session_id"].as<std::string>(""));
-            event->set_timestamp(row["ts"].as<int64_t>(0));
-        }
+    append_common_filters(query, tx, request);
 
-        response->set_total_count(result.size());
-        return grpc::Status::OK;
+    if (request.has_page_filter() && !request.page_filter().empty()) {
+        query << " AND page LIKE " << tx.quote("%" + request.page_filter() + "%");
+    }
 
-    } catch (const std::exception& e) {
-        std::cerr << "GetClicks error: " << e.what() << std::endl;
-        return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+    if (request.has_user_id_filter() && !request.user_id_filter().empty()) {
+        query << " AND user_id = " << tx.quote(request.user_id_filter());
     }
+
+    query << " ORDER BY " << order_column(request) << ", id";
+    return query.str();
 }
 
-grpc::Status MetricsServiceImpl::GetPerformance(
-    grpc::ServerContext* context,
-    const metricsys::GetPerformanceRequest* request,
-    metricsys::GetPerformanceResponse* response) {
-    
-    try {
-        pqxx::connection conn(get_connection_string());
-        pqxx::work tx(conn);
+std::string build_query(pqxx::work& tx, const metricsys::GetErrorsRequest& request) {
+    std::stringstream query;
+    query << "SELECT id, page, error_type, message, stack, severity, "
+          << "user_id, session_id, " << timestamp_columns(order_column(request))
+          << "FROM error_events WHERE 1=1";
 
-        std::stringstream query;
-        query << "SELECT id, page, ttfb_ms, fcp_ms, lcp_ms, total_page_load_ms, "
-              << "user_id, session_id, "
-              << "EXTRACT(EPOCH FROM timestamp)::bigint as ts "
-              << "FROM performance_events WHERE 1=1";
-
-        if (request->has_time_range()) {
-            query << " AND timestamp >= to_timestamp(" 
-                  << request->time_range().start_timestamp() << ")"
-                  << " AND timestamp <= to_timestamp(" 
-                  << request->time_range().end_timestamp() << ")";
-        }
+    append_common_filters(query, tx, request);
 
-        if (request->has_page_filter() && !request->page_filter().empty()) {
-            query << " AND page LIKE " << tx.quote("%" + request->page_filter() + "%");
-        }
+    if (request.has_page_filter() && !request.page_filter().empty()) {
+        query << " AND page LIKE " << tx.quote("%" + request.page_filter() + "%");
+    }
 
-        if (request->has_user_id_filter() && !request->user_id_filter().empty()) {
-            query << " AND user_id = " << tx.quote(request->user_id_filter());
-        }
+    if (request.has_error_type_filter() && !request.error_type_filter().empty()) {
+        query << " AND error_type = " << tx.quote(request.error_type_filter());
+    }
 
-        if (request->has_pagination()) {
-            query << " LIMIT " << request->pagination().limit()
-                  << " OFFSET " << request->pagination().offset();
-        } else {
-            query << " LIMIT 100";
-        }
+    if (request.has_severity_filter() && request.severity_filter() != metricsys::SEVERITY_UNSPECIFIED) {
+        query << " AND severity >= " << request.severity_filter();
+    }
 
-        pqxx::result result = tx.exec(query.str());
-        tx.commit();
+    if (request.has_user_id_filter() && !request.user_id_filter().empty()) {
+        query << " AND user_id = " << tx.quote(request.user_id_filter());
+    }
 
-        for (const auto& row : result) {
-            auto* event = response->add_events();
-            event->set_id(row["id"].as<std::string>());
-            event->set_page(row["page"].as<std::string>());
-            event->set_ttfb_ms(row["ttfb_ms"].as<double>(0));
-            event->set_fcp_ms(row["fcp_ms"].as<double>(0));
-            event->set_lcp_ms(row["lcp_ms"].as<double>(0));
-            event->set_total_page_load_ms(row["total_page_load_ms"].as<double>(0));
-            event->set_user_id(row["user_id"].as<std::string>(""));
-            event->set_session_id(row["session_id"].as<std::string>(""));
-            event->set_timestamp(row["ts"].as<int64_t>(0));
-        }
+    query << " ORDER BY " << order_column(request) << ", id";
+    return query.str();
+}
 
-        response->set_total_count(result.size());
-        return grpc::Status::OK;
+std::string build_query(pqxx::work& tx, const metricsys::GetCustomEventsRequest& request) {
+    std::stringstream query;
+    query << "SELECT id, name, page, user_id, session_id, " << timestamp_columns(order_column(request))
+          << "FROM custom_events WHERE 1=1";
 
-    } catch (const std::exception& e) {
-        std::cerr << "GetPerformance error: " << e.what() << std::endl;
-        return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
+    append_common_filters(query, tx, request);
+
+    if (request.has_name_filter() && !request.name_filter().empty()) {
+        query << " AND name = " << tx.quote(request.name_filter());
     }
+
+    if (request.has_page_filter() && !request.page_filter().empty()) {
+        query << " AND page LIKE " << tx.quote("%" + request.page_filter() + "%");
+    }
+
+    if (request.has_user_id_filter() && !request.user_id_filter().empty()) {
+        query << " AND user_id = " << tx.quote(request.user_id_filter());
+    }
+
+    query << " ORDER BY " << order_column(request) << ", id";
+    return query.str();
 }
 
-grpc::Status MetricsServiceImpl::GetErrors(
-    grpc::ServerContext* context,
-    const metricsys::GetErrorsRequest* request,
-    metricsys::GetErrorsResponse* response) {
-    
-    try {
-        pqxx::connection conn(get_connection_string());
-        pqxx::work tx(conn);
+void fill_event(const pqxx::row& row, metricsys::PageViewEvent* event) {
+    event->set_id(row["id"].as<std::string>());
+    event->set_page(row["page"].as<std::string>());
+    event->set_user_id(row["user_id"].as<std::string>(""));
+    event->set_session_id(row["session_id"].as<std::string>(""));
+    event->set_referrer(row["referrer"].as<std::string>(""));
+    event->set_timestamp(row["ts"].as<int64_t>(0));
+    event->set_received_at(row["received_ts"].as<int64_t>(0));
+}
 
-        std::stringstream query;
-        query << "SELECT id, page, error_type, message, stack, severity, "
-              << "user_id, session_id, "
-              << "EXTRACT(EPOCH FROM timestamp)::bigint as ts "
-              << "FROM error_events WHERE 1=1";
-
-        if (request->has_time_range()) {
-            query << " AND timestamp >= to_timestamp(" 
-                  << request->time_range().start_timestamp() << ")"
-                  << " AND timestamp <= to_timestamp(" 
-                  << request->time_range().end_timestamp() << ")";
-        }
+void fill_event(const pqxx::row& row, metricsys::ClickEvent* event) {
+    event->set_id(row["id"].as<std::string>());
+    event->set_page(row["page"].as<std::string>());
+    event->set_element_id(row["element_id"].as<std::string>(""));
+    event->set_action(row["action"].as<std::string>(""));
+    event->set_user_id(row["user_id"].as<std::string>(""));
+    event->set_session_id(row["session_id"].as<std::string>(""));
+    event->set_timestamp(row["ts"].as<int64_t>(0));
+    event->set_received_at(row["received_ts"].as<int64_t>(0));
+}
 
-        if (request->has_page_filter() && !request->page_filter().empty()) {
-            query << " AND page LIKE " << tx.quote("%" + request->page_filter() + "%");
-        }
+void fill_event(const pqxx::row& row, metricsys::PerformanceEvent* event) {
+    event->set_id(row["id"].as<std::string>());
+    event->set_page(row["page"].as<std::string>());
+    event->set_ttfb_ms(row["ttfb_ms"].as<double>(0));
+    event->set_fcp_ms(row["fcp_ms"].as<double>(0));
+    event->set_lcp_ms(row["lcp_ms"].as<double>(0));
+    event->set_total_page_load_ms(row["total_page_load_ms"].as<double>(0));
+    event->set_user_id(row["user_id"].as<std::string>(""));
+    event->set_session_id(row["session_id"].as<std::string>(""));
+    event->set_timestamp(row["ts"].as<int64_t>(0));
+    event->set_received_at(row["received_ts"].as<int64_t>(0));
+}
 
-        if (request->has_error_type_filter() && !request->error_type_filter().empty()) {
-            query << " AND error_type = " << tx.quote(request->error_type_filter());
-        }
+void fill_event(const pqxx::row& row, metricsys::ErrorEvent* event) {
+    event->set_id(row["id"].as<std::string>());
+    event->set_page(row["page"].as<std::string>());
+    event->set_error_type(row["error_type"].as<std::string>(""));
+    event->set_message(row["message"].as<std::string>(""));
+    event->set_stack(row["stack"].as<std::string>(""));
+    event->set_severity(static_cast<metricsys::Severity>(row["severity"].as<int>(0)));
+    event->set_user_id(row["user_id"].as<std::string>(""));
+    event->set_session_id(row["session_id"].as<std::string>(""));
+    event->set_timestamp(row["ts"].as<int64_t>(0));
+    event->set_received_at(row["received_ts"].as<int64_t>(0));
+}
 
-        if (request->has_severity_filter() && request->severity_filter() != metricsys::SEVERITY_UNSPECIFIED) {
-            query << " AND severity >= " << request->severity_filter();
-        }
+void fill_event(const pqxx::row& row, metricsys::CustomEvent* event) {
+    event->set_id(row["id"].as<std::string>());
+    event->set_name(row["name"].as<std::string>());
+    event->set_page(row["page"].as<std::string>(""));
+    event->set_user_id(row["user_id"].as<std::string>(""));
+    event->set_session_id(row["session_id"].as<std::string>(""));
+    event->set_timestamp(row["ts"].as<int64_t>(0));
+    event->set_received_at(row["received_ts"].as<int64_t>(0));
+}
 
-        if (request->has_user_id_filter() && !request->user_id_filter().empty()) {
-            query << " AND user_id = " << tx.quote(request->user_id_filter());
-        }
+// Заполняет события ответа и курсор на последнее из них
+template <typename Response>
+void fill_response(const pqxx::result& result, Response* response) {
+    for (const auto& row : result) {
+        fill_event(row, response->add_events());
+    }
 
-        if (request->has_pagination()) {
-            query << " LIMIT " << request->pagination().limit()
-                  << " OFFSET " << request->pagination().offset();
-        } else {
-            query << " LIMIT 100";
+    response->set_total_count(result.size());
+    if (!result.empty()) {
+        const auto last = result.back();
+        auto* cursor = response->mutable_next_cursor();
+        cursor->set_timestamp_us(last["ts_us"].template as<int64_t>(0));
+        cursor->set_id(last["id"].template as<std::string>());
+    }
+}
+
+// ===== Чтение из SegmentStore =====
+
+SegmentKind segment_kind(const metricsys::GetPageViewsRequest&) {
+    return SegmentKind::PageView;
+}
+SegmentKind segment_kind(const metricsys::GetClicksRequest&) {
+    return SegmentKind::Click;
+}
+SegmentKind segment_kind(const metricsys::GetPerformanceRequest&) {
+    return SegmentKind::Performance;
+}
+SegmentKind segment_kind(const metricsys::GetErrorsRequest&) {
+    return SegmentKind::Error;
+}
+SegmentKind segment_kind(const metricsys::GetCustomEventsRequest&) {
+    return SegmentKind::Custom;
+}
+
+template <typename Request>
+bool has_value_filters(const Request& request) {
+    bool filtered = !request.page_filter().empty() || !request.user_id_filter().empty();
+    if constexpr (requires { request.element_id_filter(); }) {
+        filtered = filtered || !request.element_id_filter().empty();
+    }
+    if constexpr (requires { request.error_type_filter(); }) {
+        filtered = filtered || !request.error_type_filter().empty() ||
+                   request.severity_filter() != metricsys::SEVERITY_UNSPECIFIED;
+    }
+    if constexpr (requires { request.name_filter(); }) {
+        filtered = filtered || !request.name_filter().empty();
+    }
+    return filtered;
+}
+
+// Сегменты отвечают, только если клиент согласен на их неполные строки (allow_segments),
+// на окно по received_range без фильтров по значениям — так читает агрегатор — и
+// только если покрывают окно целиком. Остальное — PostgreSQL
+template <typename Request>
+bool from_segments(const SegmentStore* segments, const Request& request) {
+    return segments && request.allow_segments() && request.has_received_range() &&
+           !has_value_filters(request) && segments->covers(request.received_range().start_timestamp() * 1000000);
+}
+
+// Курсор из PostgreSQL (или nil) не указывает на строку сегмента: продолжаем
+// со всех строк после его времени, как nil UUID в keyset-условии
+SegmentPosition segment_position(const metricsys::EventCursor& cursor) {
+    SegmentPosition position;
+    position.received_us = cursor.timestamp_us();
+    if (auto row = parse_segment_row_id(cursor.id())) {
+        position.segment = row->first;
+        position.row = row->second;
+    }
+    return position;
+}
+
+template <typename Request>
+SegmentQuery segment_query(const Request& request, size_t limit) {
+    SegmentQuery query;
+    query.from_us = request.received_range().start_timestamp() * 1000000;
+    query.to_us = request.received_range().end_timestamp() * 1000000;
+    if (request.has_time_range()) {
+        query.time_range = std::make_pair(request.time_range().start_timestamp(),
+                                          request.time_range().end_timestamp());
+    }
+    if (request.has_after()) {
+        query.after = segment_position(request.after());
+    }
+    query.limit = limit;
+    return query;
+}
+
+// Колонок, которых нет в сегментах (id из PostgreSQL, referrer, message, stack),
+// в ответе нет; id — позиция строки в сегменте
+template <typename Event>
+void fill_common(const SegmentColumns& segment, uint32_t row, Event* event) {
+    event->set_id(segment_row_id(segment.seq, row));
+    event->set_page(std::string(segment.string(COL_PAGE, row)));
+    event->set_user_id(std::string(segment.string(COL_USER_ID, row)));
+    event->set_session_id(std::string(segment.string(COL_SESSION_ID, row)));
+    event->set_timestamp(segment.timestamp(row));
+    event->set_received_at(segment.receivedUs(row) / 1000000);
+}
+
+void fill_event(const SegmentColumns& segment, uint32_t row, metricsys::PageViewEvent* event) {
+    fill_common(segment, row, event);
+}
+
+void fill_event(const SegmentColumns& segment, uint32_t row, metricsys::ClickEvent* event) {
+    fill_common(segment, row, event);
+    event->set_element_id(std::string(segment.string(COL_EXTRA, row)));
+    event->set_action(std::string(segment.string(COL_EXTRA2, row)));
+}
+
+void fill_event(const SegmentColumns& segment, uint32_t row, metricsys::PerformanceEvent* event) {
+    fill_common(segment, row, event);
+    event->set_ttfb_ms(segment.number(COL_TTFB, row));
+    event->set_fcp_ms(segment.number(COL_FCP, row));
+    event->set_lcp_ms(segment.number(COL_LCP, row));
+    event->set_total_page_load_ms(segment.number(COL_TOTAL_LOAD, row));
+}
+
+void fill_event(const SegmentColumns& segment, uint32_t row, metricsys::ErrorEvent* event) {
+    fill_common(segment, row, event);
+    event->set_error_type(std::string(segment.string(COL_EXTRA, row)));
+    event->set_severity(static_cast<metricsys::Severity>(segment.integer(row)));
+}
+
+void fill_event(const SegmentColumns& segment, uint32_t row, metricsys::CustomEvent* event) {
+    fill_common(segment, row, event);
+    event->set_name(std::string(segment.string(COL_EXTRA, row)));
+}
+
+template <typename Request, typename Response>
+size_t scan_segments(SegmentStore& segments, const Request& request, const SegmentQuery& query,
+                     Response* response) {
+    SegmentPosition last;
+    size_t count = segments.scan(segment_kind(request), query,
+                                 [response, &last](const SegmentColumns& segment, uint32_t row) {
+        fill_event(segment, row, response->add_events());
+        last = {segment.receivedUs(row), segment.seq, row};
+    });
+
+    response->set_total_count(static_cast<int32_t>(count));
+    if (count > 0) {
+        auto* cursor = response->mutable_next_cursor();
+        cursor->set_timestamp_us(last.received_us);
+        cursor->set_id(segment_row_id(last.segment, last.row));
+    }
+    return count;
+}
+
+// Размер страницы Get*: без лимита или с неположительным — DEFAULT_LIMIT, не больше MAX_LIMIT
+template <typename Request>
+int page_limit(const Request& request) {
+    const int limit = request.has_pagination() ? request.pagination().limit() : 0;
+    return limit > 0 ? std::min(limit, MAX_LIMIT) : DEFAULT_LIMIT;
+}
+
+// OFFSET только без курсора: after уже указывает, откуда продолжать
+template <typename Request>
+int page_offset(const Request& request) {
+    return request.has_pagination() && !request.has_after() ? std::max(0, request.pagination().offset()) : 0;
+}
+
+template <typename Request, typename Response>
+grpc::Status query_events(ConnectionPool& pool, SegmentStore* segments, const IngestHorizon& horizon,
+                          const char* name, const Request& original, Response* response) {
+    const Request request = clamp_to_horizon(horizon, original);
+    set_received_until(request, response);
+
+    if (from_segments(segments, request)) {
+        SegmentQuery query = segment_query(request, static_cast<size_t>(page_limit(request)));
+        query.offset = static_cast<size_t>(page_offset(request));
+        scan_segments(*segments, request, query, response);
+        return grpc::Status::OK;
+    }
+
+    try {
+        auto conn = pool.acquire();
+        pqxx::work tx(*conn);
+
+        std::stringstream query;
+        query << build_query(tx, request) << " LIMIT " << page_limit(request);
+        if (const int offset = page_offset(request); offset > 0) {
+            query << " OFFSET " << offset;
         }
 
         pqxx::result result = tx.exec(query.str());
         tx.commit();
 
-        for (const auto& row : result) {
-            auto* event = response->add_events();
-            event->set_id(row["id"].as<std::string>());
-            event->set_page(row["page"].as<std::string>());
-            event->set_error_type(row["error_type"].as<std::string>(""));
-            event->set_message(row["message"].as<std::string>(""));
-            event->set_stack(row["stack"].as<std::string>(""));
-            event->set_severity(static_cast<metricsys::Severity>(row["severity"].as<int>(0)));
-            event->set_user_id(row["user_id"].as<std::string>(""));
-            event->set_session_id(row["session_id"].as<std::string>(""));
-            event->set_timestamp(row["ts"].as<int64_t>(0));
-        }
-
-        response->set_total_count(result.size());
+        fill_response(result, response);
         return grpc::Status::OK;
 
+    } catch (const PoolTimeoutError& e) {
+        std::cerr << name << " error: " << e.what() << std::endl;
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE, e.what());
     } catch (const std::exception& e) {
-        std::cerr << "GetErrors error: " << e.what() << std::endl;
+        std::cerr << name << " error: " << e.what() << std::endl;
         return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
     }
 }
 
-grpc::Status MetricsServiceImpl::GetCustomEvents(
-    grpc::ServerContext* context,
-    const metricsys::GetCustomEventsRequest* request,
-    metricsys::GetCustomEventsResponse* response) {
-    
-    try {
-        pqxx::connection conn(get_connection_string());
-        pqxx::work tx(conn);
-
-        std::stringstream query;
-        query << "SELECT id, name, page, user_id, session_id, "
-              << "EXTRACT(EPOCH FROM timestamp)::bigint as ts "
-              << "FROM custom_events WHERE 1=1";
-
-        if (request->has_time_range()) {
-            query << " AND timestamp >= to_timestamp(" 
-                  << request->time_range().start_timestamp() << ")"
-                  << " AND timestamp <= to_timestamp(" 
-                  << request->time_range().end_timestamp() << ")";
+// Выборка читается серверным курсором по FETCH FORWARD chunk, каждый чанк
+// уходит отдельным сообщением — в памяти не больше одного чанка
+template <typename Request, typename Response>
+grpc::Status stream_events(ConnectionPool& pool, SegmentStore* segments, const IngestHorizon& horizon,
+                           const char* name, grpc::ServerContext* context, const Request& original,
+                           grpc::ServerWriter<Response>* writer) {
+    const Request request = clamp_to_horizon(horizon, original);
+    // Пустое окно всё равно отвечает одним сообщением: клиенту нужен received_until
+    auto finish_empty = [&request, writer](size_t total) {
+        if (total == 0 && request.has_received_range()) {
+            Response response;
+            set_received_until(request, &response);
+            writer->Write(response);
         }
+    };
 
-        if (request->has_name_filter() && !request->name_filter().empty()) {
-            query << " AND name = " << tx.quote(request->name_filter());
-        }
+    int chunk = DEFAULT_STREAM_CHUNK;
+    if (request.has_pagination() && request.pagination().limit() > 0) {
+        chunk = std::min(request.pagination().limit(), MAX_STREAM_CHUNK);
+    }
 
-        if (request->has_page_filter() && !request->page_filter().empty()) {
-            query << " AND page LIKE " << tx.quote("%" + request->page_filter() + "%");
+    if (from_segments(segments, request)) {
+        SegmentQuery query = segment_query(request, static_cast<size_t>(chunk));
+        size_t total = 0;
+        while (true) {
+            if (context->IsCancelled()) {
+                return grpc::Status(grpc::StatusCode::CANCELLED, "stream cancelled by client");
+            }
+
+            Response response;
+            set_received_until(request, &response);
+            const size_t count = scan_segments(*segments, request, query, &response);
+            if (count == 0) {
+                break;
+            }
+            total += count;
+            if (!writer->Write(response)) {
+                return grpc::Status(grpc::StatusCode::CANCELLED, "client closed the stream");
+            }
+            if (count < static_cast<size_t>(chunk)) {
+                break;
+            }
+            query.after = segment_position(response.next_cursor());
         }
 
-        if (request->has_user_id_filter() && !request->user_id_filter().empty()) {
-            query << " AND user_id = " << tx.quote(request->user_id_filter());
-        }
+        finish_empty(total);
+        std::cout << name << ": streamed " << total << " events from segments" << std::endl;
+        return grpc::Status::OK;
+    }
 
-        if (request->has_pagination()) {
-            query << " LIMIT " << request->pagination().limit()
-                  << " OFFSET " << request->pagination().offset();
-        } else {
-            query << " LIMIT 100";
+    try {
+        auto conn = pool.acquire();
+        pqxx::work tx(*conn);
+
+        tx.exec("DECLARE events_cursor NO SCROLL CURSOR FOR " + build_query(tx, request));
+        const std::string fetch = "FETCH FORWARD " + std::to_string(chunk) + " FROM events_cursor";
+
+        size_t total = 0;
+        while (true) {
+            if (context->IsCancelled()) {
+                return grpc::Status(grpc::StatusCode::CANCELLED, "stream cancelled by client");
+            }
+
+            pqxx::result result = tx.exec(fetch);
+            if (result.empty()) {
+                break;
+            }
+
+            Response response;
+            set_received_until(request, &response);
+            fill_response(result, &response);
+            total += result.size();
+            if (!writer->Write(response)) {
+                return grpc::Status(grpc::StatusCode::CANCELLED, "client closed the stream");
+            }
+
+            if (result.size() < static_cast<size_t>(chunk)) {
+                break;
+            }
         }
 
-        pqxx::result result = tx.exec(query.str());
+        tx.exec("CLOSE events_cursor");
         tx.commit();
 
-        for (const auto& row : result) {
-            auto* event = response->add_events();
-            event->set_id(row["id"].as<std::string>());
-            event->set_name(row["name"].as<std::string>());
-            event->set_page(row["page"].as<std::string>(""));
-            event->set_user_id(row["user_id"].as<std::string>(""));
-            event->set_session_id(row["session_id"].as<std::string>(""));
-            event->set_timestamp(row["ts"].as<int64_t>(0));
-        }
-
-        response->set_total_count(result.size());
+        finish_empty(total);
+        std::cout << name << ": streamed " << total << " events" << std::endl;
         return grpc::Status::OK;
 
+    } catch (const PoolTimeoutError& e) {
+        std::cerr << name << " error: " << e.what() << std::endl;
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE, e.what());
     } catch (const std::exception& e) {
-        std::cerr << "GetCustomEvents error: " << e.what() << std::endl;
+        std::cerr << name << " error: " << e.what() << std::endl;
         return grpc::Status(grpc::StatusCode::INTERNAL, e.what());
     }
 }
 
-void run_grpc_server(const std::string& address, const DatabaseConfig& db_config) {
-    MetricsServiceImpl service(db_config);
+} // namespace
+
+MetricsServiceImpl::MetricsServiceImpl(const DatabaseConfig& db_config)
+    : pool_(std::make_shared<ConnectionPool>(db_config, ConnectionPoolConfig{})) {}
+
+MetricsServiceImpl::MetricsServiceImpl(std::shared_ptr<ConnectionPool> pool,
+                                       std::shared_ptr<SegmentStore> segments,
+                                       IngestHorizon horizon)
+    : pool_(std::move(pool)), segments_(std::move(segments)), horizon_(std::move(horizon)) {}
+
+grpc::Status MetricsServiceImpl::GetPageViews(
+    grpc::ServerContext* context,
+    const metricsys::GetPageViewsRequest* request,
+    metricsys::GetPageViewsResponse* response) {
+    return query_events(*pool_, segments_.get(), horizon_, "GetPageViews", *request, response);
+}
+
+grpc::Status MetricsServiceImpl::GetClicks(
+    grpc::ServerContext* context,
+    const metricsys::GetClicksRequest* request,
+    metricsys::GetClicksResponse* response) {
+    return query_events(*pool_, segments_.get(), horizon_, "GetClicks", *request, response);
+}
+
+grpc::Status MetricsServiceImpl::GetPerformance(
+    grpc::ServerContext* context,
+    const metricsys::GetPerformanceRequest* request,
+    metricsys::GetPerformanceResponse* response) {
+    return query_events(*pool_, segments_.get(), horizon_, "GetPerformance", *request, response);
+}
+
+grpc::Status MetricsServiceImpl::GetErrors(
+    grpc::ServerContext* context,
+    const metricsys::GetErrorsRequest* request,
+    metricsys::GetErrorsResponse* response) {
+    return query_events(*pool_, segments_.get(), horizon_, "GetErrors", *request, response);
+}
+
+grpc::Status MetricsServiceImpl::GetCustomEvents(
+    grpc::ServerContext* context,
+    const metricsys::GetCustomEventsRequest* request,
+    metricsys::GetCustomEventsResponse* response) {
+    return query_events(*pool_, segments_.get(), horizon_, "GetCustomEvents", *request, response);
+}
+
+grpc::Status MetricsServiceImpl::StreamPageViews(
+    grpc::ServerContext* context,
+    const metricsys::GetPageViewsRequest* request,
+    grpc::ServerWriter<metricsys::GetPageViewsResponse>* writer) {
+    return stream_events(*pool_, segments_.get(), horizon_, "StreamPageViews", context, *request, writer);
+}
+
+grpc::Status MetricsServiceImpl::StreamClicks(
+    grpc::ServerContext* context,
+    const metricsys::GetClicksRequest* request,
+    grpc::ServerWriter<metricsys::GetClicksResponse>* writer) {
+    return stream_events(*pool_, segments_.get(), horizon_, "StreamClicks", context, *request, writer);
+}
+
+grpc::Status MetricsServiceImpl::StreamPerformance(
+    grpc::ServerContext* context,
+    const metricsys::GetPerformanceRequest* request,
+    grpc::ServerWriter<metricsys::GetPerformanceResponse>* writer) {
+    return stream_events(*pool_, segments_.get(), horizon_, "StreamPerformance", context, *request, writer);
+}
+
+grpc::Status MetricsServiceImpl::StreamErrors(
+    grpc::ServerContext* context,
+    const metricsys::GetErrorsRequest* request,
+    grpc::ServerWriter<metricsys::GetErrorsResponse>* writer) {
+    return stream_events(*pool_, segments_.get(), horizon_, "StreamErrors", context, *request, writer);
+}
+
+grpc::Status MetricsServiceImpl::StreamCustomEvents(
+    grpc::ServerContext* context,
+    const metricsys::GetCustomEventsRequest* request,
+    grpc::ServerWriter<metricsys::GetCustomEventsResponse>* writer) {
+    return stream_events(*pool_, segments_.get(), horizon_, "StreamCustomEvents", context, *request, writer);
+}
+
+void run_grpc_server(const std::string& address, std::shared_ptr<ConnectionPool> pool,
+                     std::shared_ptr<SegmentStore> segments, IngestHorizon horizon) {
+    MetricsServiceImpl service(std::move(pool), std::move(segments), std::move(horizon));
 
     grpc::ServerBuilder builder;
     builder.AddListeningPort(address, grpc::InsecureServerCredentials());
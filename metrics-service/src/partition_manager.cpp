@@ -0,0 +1,275 @@
+#include "partition_manager.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <pqxx/pqxx>
+#include <sstream>
+
+PartitionManagerConfig load_partition_manager_config() {
+    const char* premake_env = std::getenv("PARTITION_PREMAKE_DAYS");
+    const char* retention_env = std::getenv("PARTITION_RETENTION_DAYS");
+    const char* interval_env = std::getenv("PARTITION_CHECK_INTERVAL_SEC");
+
+    PartitionManagerConfig config;
+    if (premake_env) {
+        config.premake_days = std::max(1, std::stoi(premake_env));
+    }
+    if (retention_env) {
+        config.retention_days = std::max(0, std::stoi(retention_env));
+    }
+    if (interval_env) {
+        config.check_interval = std::chrono::seconds(std::max(1L, std::stol(interval_env)));
+    }
+    return config;
+}
+
+namespace {
+
+// YYYYMMDD, или YYYY-MM-DD с separator
+std::string format_day(std::chrono::sys_days day, const char* separator) {
+    std::chrono::year_month_day ymd{day};
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%04d%s%02u%s%02u", static_cast<int>(ymd.year()), separator,
+                  static_cast<unsigned>(ymd.month()), separator, static_cast<unsigned>(ymd.day()));
+    return buffer;
+}
+
+std::string day_literal(std::chrono::sys_days day) {
+    return "'" + format_day(day, "-") + " 00:00:00+00'";
+}
+
+} // namespace
+
+std::string partition_name(const std::string& table, std::chrono::sys_days day) {
+    return table + "_p" + format_day(day, "");
+}
+
+std::optional<std::chrono::sys_days> partition_day(const std::string& table, const std::string& name) {
+    const std::string prefix = table + "_p";
+    if (name.size() != prefix.size() + 8 || name.compare(0, prefix.size(), prefix) != 0) {
+        return std::nullopt;
+    }
+    int value = 0;
+    for (size_t i = prefix.size(); i < name.size(); ++i) {
+        if (name[i] < '0' || name[i] > '9') {
+            return std::nullopt;
+        }
+        value = value * 10 + (name[i] - '0');
+    }
+
+    std::chrono::year_month_day ymd{std::chrono::year(value / 10000),
+                                    std::chrono::month(static_cast<unsigned>(value / 100 % 100)),
+                                    std::chrono::day(static_cast<unsigned>(value % 100))};
+    if (!ymd.ok()) {
+        return std::nullopt;
+    }
+    return std::chrono::sys_days(ymd);
+}
+
+std::string create_partition_sql(const std::string& table, std::chrono::sys_days day) {
+    return "CREATE TABLE IF NOT EXISTS " + partition_name(table, day) + " PARTITION OF " + table +
+           " FOR VALUES FROM (" + day_literal(day) + ") TO (" +
+           day_literal(day + std::chrono::days(1)) + ")";
+}
+
+std::string default_partition_name(const std::string& table) {
+    return table + "_default";
+}
+
+std::vector<std::string> move_default_rows_sql(const std::string& table,
+                                               const std::vector<std::chrono::sys_days>& days) {
+    const std::string default_name = default_partition_name(table);
+    std::vector<std::string> statements;
+    statements.push_back("ALTER TABLE " + table + " DETACH PARTITION " + default_name);
+    for (auto day : days) {
+        const std::string range = "received_at >= " + day_literal(day) + " AND received_at < " +
+                                  day_literal(day + std::chrono::days(1));
+        statements.push_back(create_partition_sql(table, day));
+        statements.push_back("INSERT INTO " + partition_name(table, day) + " SELECT * FROM " +
+                             default_name + " WHERE " + range);
+        statements.push_back("DELETE FROM " + default_name + " WHERE " + range);
+    }
+    statements.push_back("ALTER TABLE " + table + " ATTACH PARTITION " + default_name + " DEFAULT");
+    return statements;
+}
+
+std::vector<std::string> expired_partitions(const std::string& table, const std::vector<std::string>& names,
+                                            std::chrono::sys_days today, int retention_days) {
+    std::vector<std::string> expired;
+    if (retention_days <= 0) {
+        return expired;
+    }
+    // Партиция дня d хранит [d, d + 1); она целиком старше срока, если d + 1 <= today - retention
+    const auto cutoff = today - std::chrono::days(retention_days);
+    for (const auto& name : names) {
+        auto day = partition_day(table, name);
+        if (day && *day + std::chrono::days(1) <= cutoff) {
+            expired.push_back(name);
+        }
+    }
+    return expired;
+}
+
+std::string PartitionManagerStats::toJson() const {
+    std::ostringstream out;
+    out << R"({"runs":)" << runs << R"(,"failures":)" << failures << R"(,"created":)" << created
+        << R"(,"dropped":)" << dropped << R"(,"moved_rows":)" << moved_rows
+        << R"(,"partitions":)" << partitions << R"(,"default_rows":)" << default_rows << "}";
+    return out.str();
+}
+
+PartitionManager::PartitionManager(std::shared_ptr<ConnectionPool> pool, const PartitionManagerConfig& config)
+    : pool_(std::move(pool)), config_(config) {
+}
+
+PartitionManager::~PartitionManager() {
+    stop();
+}
+
+bool PartitionManager::start() {
+    bool ok = maintain(std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now()));
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            return ok;
+        }
+        running_ = true;
+    }
+    thread_ = std::thread(&PartitionManager::loop, this);
+    std::cout << "[PartitionManager] Started: premake_days=" << config_.premake_days
+              << ", retention_days=" << config_.retention_days << std::endl;
+    return ok;
+}
+
+void PartitionManager::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void PartitionManager::loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_) {
+        if (cv_.wait_for(lock, config_.check_interval, [this] { return !running_; })) {
+            break;
+        }
+        lock.unlock();
+        maintain(std::chrono::floor<std::chrono::days>(std::chrono::system_clock::now()));
+        lock.lock();
+    }
+}
+
+bool PartitionManager::maintain(std::chrono::sys_days today) {
+    PartitionManagerStats pass;
+    bool ok = true;
+
+    try {
+        auto conn = pool_->acquire();
+        for (const char* table : PARTITIONED_TABLES) {
+            try {
+                maintainTable(*conn, table, today, pass);
+            } catch (const pqxx::broken_connection&) {
+                throw;
+            } catch (const std::exception& e) {
+                // Транзакция таблицы откатилась целиком, DEFAULT остаётся присоединённой
+                std::cerr << "[PartitionManager] Maintenance of " << table << " failed: " << e.what()
+                          << std::endl;
+                ok = false;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[PartitionManager] Maintenance failed: " << e.what() << std::endl;
+        ok = false;
+    }
+
+    if (pass.created > 0 || pass.dropped > 0) {
+        std::cout << "[PartitionManager] Created " << pass.created << " and dropped " << pass.dropped
+                  << " partitions" << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.runs;
+    stats_.created += pass.created;
+    stats_.dropped += pass.dropped;
+    stats_.moved_rows += pass.moved_rows;
+    stats_.default_rows = pass.default_rows;
+    if (ok) {
+        stats_.partitions = pass.partitions;
+    } else {
+        ++stats_.failures;
+    }
+    return ok;
+}
+
+void PartitionManager::maintainTable(pqxx::connection& conn, const std::string& table,
+                                     std::chrono::sys_days today, PartitionManagerStats& pass) {
+    // Каждая таблица своей транзакцией: DDL берёт блокировку родителя ненадолго
+    pqxx::work tx(conn);
+
+    std::vector<std::string> names;
+    for (const auto& row : tx.exec_params(
+             "SELECT c.relname FROM pg_inherits i "
+             "JOIN pg_class c ON c.oid = i.inhrelid "
+             "JOIN pg_class p ON p.oid = i.inhparent "
+             "WHERE p.relname = $1",
+             table)) {
+        names.push_back(row[0].as<std::string>());
+    }
+
+    // Строки в DEFAULT значат, что вставка опередила создание партиций. Их дни
+    // переезжают в свои партиции, иначе CREATE ... PARTITION OF для этих дней падает
+    const std::string default_name = default_partition_name(table);
+    if (std::find(names.begin(), names.end(), default_name) != names.end()) {
+        std::vector<std::chrono::sys_days> days;
+        uint64_t rows = 0;
+        for (const auto& row : tx.exec("SELECT floor(EXTRACT(EPOCH FROM received_at) / 86400)::bigint, count(*) "
+                                       "FROM " + default_name + " GROUP BY 1 ORDER BY 1")) {
+            days.push_back(std::chrono::sys_days(std::chrono::days(row[0].as<int64_t>())));
+            rows += row[1].as<uint64_t>();
+        }
+
+        if (!days.empty()) {
+            std::cerr << "[PartitionManager] ALERT: " << default_name << " holds " << rows << " rows of "
+                      << days.size() << " days, moving them to day partitions" << std::endl;
+            for (const auto& statement : move_default_rows_sql(table, days)) {
+                tx.exec(statement);
+            }
+            for (auto day : days) {
+                names.push_back(partition_name(table, day));
+            }
+            pass.default_rows += rows;
+            pass.moved_rows += rows;
+            pass.created += days.size();
+        }
+    }
+
+    for (int offset = 0; offset <= config_.premake_days; ++offset) {
+        auto day = today + std::chrono::days(offset);
+        if (std::find(names.begin(), names.end(), partition_name(table, day)) == names.end()) {
+            tx.exec(create_partition_sql(table, day));
+            names.push_back(partition_name(table, day));
+            ++pass.created;
+        }
+    }
+
+    for (const auto& name : expired_partitions(table, names, today, config_.retention_days)) {
+        tx.exec("DROP TABLE IF EXISTS " + tx.quote_name(name));
+        names.erase(std::find(names.begin(), names.end(), name));
+        ++pass.dropped;
+    }
+
+    tx.commit();
+    pass.partitions += names.size();
+}
+
+PartitionManagerStats PartitionManager::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
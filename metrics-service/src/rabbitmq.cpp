@@ -1,11 +1,32 @@
 #include "rabbitmq.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <map>
+#include <numeric>
+#include <sstream>
 #include <thread>
 
+namespace {
+
+constexpr amqp_channel_t DEAD_LETTER_CHANNEL = 1;
+// Сколько ждать publisher confirm для отправленных в dead-letter сообщений
+constexpr std::chrono::seconds DEAD_LETTER_CONFIRM_TIMEOUT{5};
+
+bool rpc_ok(amqp_connection_state_t conn, const char* context) {
+    amqp_rpc_reply_t reply = amqp_get_rpc_reply(conn);
+    if (reply.reply_type != AMQP_RESPONSE_NORMAL) {
+        std::cerr << "[RabbitMQ] " << context << " failed" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
 RabbitMQConfig load_rabbitmq_config() {
     RabbitMQConfig config;
 
@@ -14,20 +35,67 @@ RabbitMQConfig load_rabbitmq_config() {
     const char* user = std::getenv("RABBITMQ_USER");
     const char* password = std::getenv("RABBITMQ_PASSWORD");
     const char* vhost = std::getenv("RABBITMQ_VHOST");
+    const char* prefetch = std::getenv("RABBITMQ_PREFETCH");
+    const char* workers = std::getenv("RABBITMQ_WORKERS");
+    const char* work_queue = std::getenv("RABBITMQ_WORK_QUEUE_SIZE");
+    const char* dead_letter = std::getenv("RABBITMQ_DEAD_LETTER_EXCHANGE");
 
     config.host = host ? host : "localhost";
     config.port = port ? std::stoi(port) : 5672;
     config.user = user ? user : "guest";
     config.password = password ? password : "guest";
     config.vhost = vhost ? vhost : "/";
+    if (prefetch) {
+        config.prefetch_count = static_cast<uint16_t>(std::stoi(prefetch));
+    }
+    if (workers) {
+        config.worker_threads = std::stoul(workers);
+    }
+    if (work_queue) {
+        config.work_queue_capacity = std::max<size_t>(std::stoul(work_queue), 1);
+    }
+    if (dead_letter) {
+        config.dead_letter_exchange = dead_letter;
+    }
 
     // Default queues matching api-service
     config.queues = {"page_views", "clicks", "performance_events", "error_events", "custom_events"};
+    // Доставок на канале не больше prefetch, столько же вмещает буфер очереди
+    if (config.prefetch_count > 0) {
+        config.work_queue_capacity = std::max<size_t>(config.work_queue_capacity, config.prefetch_count);
+    }
 
     return config;
 }
 
-RabbitMQConsumer::RabbitMQConsumer(const RabbitMQConfig& config) : config_(config) {
+std::string ConsumerStats::toJson() const {
+    std::ostringstream out;
+    out << R"({"work_queue_depth":)" << work_queue_depth << R"(,"work_queue_capacity":)"
+        << work_queue_capacity << R"(,"work_queue_depth_per_queue":{)";
+    for (size_t i = 0; i < work_queue_depth_per_queue.size(); ++i) {
+        if (i > 0) {
+            out << ",";
+        }
+        out << "\"" << work_queue_depth_per_queue[i].first << "\":" << work_queue_depth_per_queue[i].second;
+    }
+    out << R"(},"in_flight":)" << in_flight << R"(,"delivered":)"
+        << delivered << R"(,"acked":)" << acked << R"(,"rejected":)" << rejected
+        << R"(,"dead_lettered":)" << dead_lettered
+        << R"(,"dead_letter_failures":)" << dead_letter_failures
+        << R"(,"in_flight_per_queue":{)";
+    for (size_t i = 0; i < in_flight_per_queue.size(); ++i) {
+        if (i > 0) {
+            out << ",";
+        }
+        out << "\"" << in_flight_per_queue[i].first << "\":" << in_flight_per_queue[i].second;
+    }
+    out << "}}";
+    return out.str();
+}
+
+RabbitMQConsumer::RabbitMQConsumer(const RabbitMQConfig& config)
+    : config_(config), work_queues_(config.queues.size()), in_flight_(config.queues.size(), 0),
+      unsettled_(config.queues.size()) {
 }
 
 RabbitMQConsumer::~RabbitMQConsumer() {
@@ -36,18 +104,16 @@ RabbitMQConsumer::~RabbitMQConsumer() {
 }
 
 bool RabbitMQConsumer::checkRpcReply(const char* context) {
-    amqp_rpc_reply_t reply = amqp_get_rpc_reply(conn_);
-    if (reply.reply_type != AMQP_RESPONSE_NORMAL) {
-        std::cerr << "[RabbitMQ] " << context << " failed" << std::endl;
-        return false;
-    }
-    return true;
+    return rpc_ok(conn_, context);
 }
 
 void RabbitMQConsumer::disconnect() {
     connected_ = false;
+    closeDeadLetter(true);
     if (conn_) {
-        amqp_channel_close(conn_, 1, AMQP_REPLY_SUCCESS);
+        for (size_t i = 0; i < config_.queues.size(); ++i) {
+            amqp_channel_close(conn_, channelFor(i), AMQP_REPLY_SUCCESS);
+        }
         amqp_connection_close(conn_, AMQP_REPLY_SUCCESS);
         amqp_destroy_connection(conn_);
     }
@@ -98,14 +164,22 @@ bool RabbitMQConsumer::connect() {
         return false;
     }
 
-    amqp_channel_open(conn_, 1);
-    if (!checkRpcReply("Opening channel")) {
-        return false;
-    }
+    // Объявляем очереди, у каждой свой канал с ограниченным prefetch
+    for (size_t i = 0; i < config_.queues.size(); ++i) {
+        const auto& queue = config_.queues[i];
+        const amqp_channel_t channel = channelFor(i);
 
-    // Объявляем очереди
-    for (const auto& queue : config_.queues) {
-        amqp_queue_declare(conn_, 1, amqp_cstring_bytes(queue.c_str()),
+        amqp_channel_open(conn_, channel);
+        if (!checkRpcReply("Opening channel")) {
+            return false;
+        }
+
+        amqp_basic_qos(conn_, channel, 0, config_.prefetch_count, 0);
+        if (!checkRpcReply("Setting prefetch")) {
+            return false;
+        }
+
+        amqp_queue_declare(conn_, channel, amqp_cstring_bytes(queue.c_str()),
                            0, // passive
                            1, // durable
                            0, // exclusive
@@ -114,21 +188,211 @@ bool RabbitMQConsumer::connect() {
         if (!checkRpcReply("Declaring queue")) {
             std::cerr << "[RabbitMQ] Failed to declare queue: " << queue << std::endl;
         } else {
-            std::cout << "[RabbitMQ] Queue declared: " << queue << std::endl;
+            std::cout << "[RabbitMQ] Queue declared: " << queue << " (channel " << channel
+                      << ", prefetch " << config_.prefetch_count << ")" << std::endl;
         }
     }
 
+    if (!connectDeadLetter()) {
+        return false;
+    }
+
+    // Сообщения прошлого соединения брокер передоставит сам
+    for (auto& deliveries : unsettled_) {
+        deliveries.clear();
+    }
+    {
+        std::lock_guard<std::mutex> lock(work_mutex_);
+        for (auto& queue : work_queues_) {
+            queue.clear();
+        }
+    }
+    space_cv_.notify_all();
+    {
+        std::lock_guard<std::mutex> lock(settle_mutex_);
+        ++generation_;
+        settlements_.clear();
+        std::fill(in_flight_.begin(), in_flight_.end(), 0);
+    }
     connected_ = true;
     std::cout << "[RabbitMQ] Connected to " << config_.host << ":" << config_.port << std::endl;
     return true;
 }
 
+bool RabbitMQConsumer::connectDeadLetter() {
+    closeDeadLetter(false);
+    if (config_.dead_letter_exchange.empty()) {
+        return true;
+    }
+
+    dlx_conn_ = amqp_new_connection();
+    if (!dlx_conn_) {
+        std::cerr << "[RabbitMQ] Failed to create dead-letter connection" << std::endl;
+        return false;
+    }
+    auto fail = [this](const char* context) {
+        std::cerr << "[RabbitMQ] Dead-letter: " << context << " failed" << std::endl;
+        closeDeadLetter(false);
+        return false;
+    };
+
+    amqp_socket_t* socket = amqp_tcp_socket_new(dlx_conn_);
+    if (!socket) {
+        return fail("Creating TCP socket");
+    }
+    if (amqp_socket_open(socket, config_.host.c_str(), config_.port) != AMQP_STATUS_OK) {
+        return fail("Opening socket");
+    }
+    amqp_rpc_reply_t reply =
+        amqp_login(dlx_conn_, config_.vhost.c_str(), 0, 131072, 0, AMQP_SASL_METHOD_PLAIN,
+                   config_.user.c_str(), config_.password.c_str());
+    if (reply.reply_type != AMQP_RESPONSE_NORMAL) {
+        return fail("Login");
+    }
+    amqp_channel_open(dlx_conn_, DEAD_LETTER_CHANNEL);
+    if (!rpc_ok(dlx_conn_, "Opening dead-letter channel")) {
+        return fail("Opening channel");
+    }
+    // После confirm.select брокер подтверждает каждую публикацию basic.ack/basic.nack
+    amqp_confirm_select(dlx_conn_, DEAD_LETTER_CHANNEL);
+    if (!rpc_ok(dlx_conn_, "Enabling publisher confirms")) {
+        return fail("Enabling publisher confirms");
+    }
+
+    // Fanout-обменник и одноимённая очередь; routing key сообщения — исходная очередь
+    const amqp_bytes_t name = amqp_cstring_bytes(config_.dead_letter_exchange.c_str());
+    amqp_exchange_declare(dlx_conn_, DEAD_LETTER_CHANNEL, name, amqp_cstring_bytes("fanout"),
+                          0, // passive
+                          1, // durable
+                          0, // auto_delete
+                          0, // internal
+                          amqp_empty_table);
+    if (!rpc_ok(dlx_conn_, "Declaring dead-letter exchange")) {
+        return fail("Declaring exchange");
+    }
+    amqp_queue_declare(dlx_conn_, DEAD_LETTER_CHANNEL, name, 0, 1, 0, 0, amqp_empty_table);
+    if (!rpc_ok(dlx_conn_, "Declaring dead-letter queue")) {
+        return fail("Declaring queue");
+    }
+    amqp_queue_bind(dlx_conn_, DEAD_LETTER_CHANNEL, name, name, amqp_empty_bytes, amqp_empty_table);
+    if (!rpc_ok(dlx_conn_, "Binding dead-letter queue")) {
+        return fail("Binding queue");
+    }
+
+    // Нумерация подтверждений на новом канале начинается с 1
+    dlx_next_tag_ = 1;
+    return true;
+}
+
+void RabbitMQConsumer::closeDeadLetter(bool graceful) {
+    if (!dlx_conn_) {
+        return;
+    }
+    if (graceful) {
+        amqp_channel_close(dlx_conn_, DEAD_LETTER_CHANNEL, AMQP_REPLY_SUCCESS);
+        amqp_connection_close(dlx_conn_, AMQP_REPLY_SUCCESS);
+    }
+    amqp_destroy_connection(dlx_conn_);
+    dlx_conn_ = nullptr;
+}
+
+std::vector<bool> RabbitMQConsumer::deadLetter(const std::vector<DeadLetter>& letters) {
+    std::vector<bool> confirmed(letters.size(), false);
+    if (letters.empty() || (!dlx_conn_ && !connectDeadLetter())) {
+        return confirmed;
+    }
+
+    // delivery tag публикации на dead-letter канале -> индекс в letters
+    std::map<uint64_t, size_t> pending;
+    for (size_t i = 0; i < letters.size(); ++i) {
+        const Unsettled& message = *letters[i].message;
+        amqp_basic_properties_t properties;
+        properties._flags = AMQP_BASIC_DELIVERY_MODE_FLAG;
+        properties.delivery_mode = 2; // persistent
+        if (!message.content_type.empty()) {
+            properties._flags |= AMQP_BASIC_CONTENT_TYPE_FLAG;
+            properties.content_type = amqp_cstring_bytes(message.content_type.c_str());
+        }
+
+        amqp_bytes_t body;
+        body.len = message.body->size();
+        body.bytes = const_cast<char*>(message.body->data());
+        const int status = amqp_basic_publish(
+            dlx_conn_, DEAD_LETTER_CHANNEL, amqp_cstring_bytes(config_.dead_letter_exchange.c_str()),
+            amqp_cstring_bytes(letters[i].queue->c_str()), 0, 0, &properties, body);
+        if (status != AMQP_STATUS_OK) {
+            std::cerr << "[RabbitMQ] Failed to dead-letter message from " << *letters[i].queue << ": "
+                      << amqp_error_string2(status) << std::endl;
+            closeDeadLetter(false);
+            return confirmed;
+        }
+        pending.emplace(dlx_next_tag_++, i);
+    }
+
+    auto settle = [&](uint64_t tag, bool multiple, bool ack) {
+        auto begin = multiple ? pending.begin() : pending.find(tag);
+        auto end = multiple ? pending.upper_bound(tag) : begin;
+        if (!multiple && begin != pending.end()) {
+            ++end;
+        }
+        for (auto it = begin; it != end; ++it) {
+            confirmed[it->second] = ack;
+        }
+        pending.erase(begin, end);
+    };
+
+    const auto deadline = std::chrono::steady_clock::now() + DEAD_LETTER_CONFIRM_TIMEOUT;
+    while (!pending.empty()) {
+        const auto left = std::chrono::duration_cast<std::chrono::microseconds>(
+            deadline - std::chrono::steady_clock::now());
+        if (left.count() <= 0) {
+            std::cerr << "[RabbitMQ] Dead-letter confirms timed out for " << pending.size()
+                      << " messages" << std::endl;
+            closeDeadLetter(false);
+            break;
+        }
+        struct timeval timeout = {static_cast<time_t>(left.count() / 1000000),
+                                  static_cast<suseconds_t>(left.count() % 1000000)};
+        amqp_frame_t frame;
+        const int status = amqp_simple_wait_frame_noblock(dlx_conn_, &frame, &timeout);
+        if (status == AMQP_STATUS_TIMEOUT) {
+            continue;
+        }
+        if (status != AMQP_STATUS_OK) {
+            std::cerr << "[RabbitMQ] Dead-letter connection lost: " << amqp_error_string2(status)
+                      << std::endl;
+            closeDeadLetter(false);
+            break;
+        }
+        if (frame.frame_type != AMQP_FRAME_METHOD) {
+            continue;
+        }
+        if (frame.payload.method.id == AMQP_BASIC_ACK_METHOD) {
+            auto* ack = static_cast<amqp_basic_ack_t*>(frame.payload.method.decoded);
+            settle(ack->delivery_tag, ack->multiple, true);
+        } else if (frame.payload.method.id == AMQP_BASIC_NACK_METHOD) {
+            auto* nack = static_cast<amqp_basic_nack_t*>(frame.payload.method.decoded);
+            settle(nack->delivery_tag, nack->multiple, false);
+        } else if (frame.payload.method.id == AMQP_CHANNEL_CLOSE_METHOD ||
+                   frame.payload.method.id == AMQP_CONNECTION_CLOSE_METHOD) {
+            std::cerr << "[RabbitMQ] Dead-letter channel closed by broker" << std::endl;
+            closeDeadLetter(false);
+            break;
+        }
+    }
+    if (dlx_conn_) {
+        amqp_maybe_release_buffers(dlx_conn_);
+    }
+    return confirmed;
+}
+
 void RabbitMQConsumer::subscribe(MessageCallback callback) {
     callback_ = callback;
 
     // Подписываемся на все очереди
-    for (const auto& queue : config_.queues) {
-        amqp_basic_consume(conn_, 1, amqp_cstring_bytes(queue.c_str()),
+    for (size_t i = 0; i < config_.queues.size(); ++i) {
+        const auto& queue = config_.queues[i];
+        amqp_basic_consume(conn_, channelFor(i), amqp_cstring_bytes(queue.c_str()),
                            amqp_empty_bytes, // consumer_tag
                            0,                // no_local
                            0,                // no_ack (we will ack manually)
@@ -142,6 +406,159 @@ void RabbitMQConsumer::subscribe(MessageCallback callback) {
     }
 }
 
+void RabbitMQConsumer::ack(const DeliveryTag& tag) {
+    std::lock_guard<std::mutex> lock(settle_mutex_);
+    settlements_.push_back({tag, true, false});
+}
+
+void RabbitMQConsumer::reject(const DeliveryTag& tag, bool requeue) {
+    std::lock_guard<std::mutex> lock(settle_mutex_);
+    settlements_.push_back({tag, false, requeue});
+}
+
+void RabbitMQConsumer::flushSettlements() {
+    std::vector<Settlement> pending;
+    {
+        std::lock_guard<std::mutex> lock(settle_mutex_);
+        pending.swap(settlements_);
+    }
+    if (pending.empty()) {
+        return;
+    }
+
+    // Reject без requeue уходит брокеру только после подтверждения dead-letter;
+    // иначе доставка возвращается в очередь, а не отбрасывается
+    std::vector<DeadLetter> letters;
+    std::vector<size_t> letter_of(pending.size(), SIZE_MAX);
+    if (!config_.dead_letter_exchange.empty()) {
+        for (size_t i = 0; i < pending.size(); ++i) {
+            const auto& s = pending[i];
+            if (s.ack || s.requeue || s.tag.generation != generation_) {
+                continue;
+            }
+            const auto& deliveries = unsettled_[s.tag.channel - 1];
+            auto delivery = deliveries.find(s.tag.tag);
+            if (delivery != deliveries.end()) {
+                letter_of[i] = letters.size();
+                letters.push_back({&delivery->second, &config_.queues[s.tag.channel - 1]});
+            }
+        }
+    }
+    const std::vector<bool> confirmed = deadLetter(letters);
+
+    size_t acked = 0;
+    size_t rejected = 0;
+    size_t dead_lettered = 0;
+    size_t dead_letter_failures = 0;
+    std::vector<size_t> settled(in_flight_.size(), 0);
+    for (size_t i = 0; i < pending.size(); ++i) {
+        const auto& s = pending[i];
+        // Теги старого соединения уже недействительны
+        if (s.tag.generation != generation_) {
+            continue;
+        }
+        auto& deliveries = unsettled_[s.tag.channel - 1];
+        auto delivery = deliveries.find(s.tag.tag);
+        if (s.ack) {
+            amqp_basic_ack(conn_, s.tag.channel, s.tag.tag, 0);
+            ++acked;
+        } else {
+            bool requeue = s.requeue;
+            if (!requeue && !config_.dead_letter_exchange.empty()) {
+                if (letter_of[i] != SIZE_MAX && confirmed[letter_of[i]]) {
+                    ++dead_lettered;
+                } else {
+                    requeue = true;
+                    ++dead_letter_failures;
+                }
+            }
+            amqp_basic_reject(conn_, s.tag.channel, s.tag.tag, requeue ? 1 : 0);
+            ++rejected;
+        }
+        if (delivery != deliveries.end()) {
+            deliveries.erase(delivery);
+        }
+        ++settled[s.tag.channel - 1];
+    }
+
+    std::lock_guard<std::mutex> lock(settle_mutex_);
+    acked_ += acked;
+    rejected_ += rejected;
+    dead_lettered_ += dead_lettered;
+    dead_letter_failures_ += dead_letter_failures;
+    for (size_t i = 0; i < settled.size(); ++i) {
+        in_flight_[i] -= std::min(in_flight_[i], settled[i]);
+    }
+}
+
+void RabbitMQConsumer::handle(const WorkItem& item) {
+    try {
+        if (callback_) {
+            callback_(item.queue, *item.body, item.content_type, item.tag);
+        } else {
+            ack(item.tag);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[RabbitMQ] Error processing message: " << e.what() << std::endl;
+        reject(item.tag, true);
+    }
+}
+
+void RabbitMQConsumer::dispatch(WorkItem item) {
+    // После stopConsuming() доставка остаётся без ack и вернётся в очередь при закрытии
+    if (!consuming_) {
+        return;
+    }
+    if (workers_.empty()) {
+        handle(item);
+        return;
+    }
+
+    auto& queue = work_queues_[item.tag.channel - 1];
+    std::unique_lock<std::mutex> lock(work_mutex_);
+    // Ждать можно только при prefetch 0. Пока буфер полон, сетевой поток продолжает
+    // отправлять ack, иначе воркеры, ждущие подтверждений, не смогут его разгрузить
+    while (consuming_ && queue.size() >= config_.work_queue_capacity) {
+        lock.unlock();
+        flushSettlements();
+        lock.lock();
+        space_cv_.wait_for(lock, std::chrono::milliseconds(20),
+                           [this, &queue] { return queue.size() < config_.work_queue_capacity; });
+    }
+    queue.push_back(std::move(item));
+    lock.unlock();
+    work_cv_.notify_one();
+}
+
+void RabbitMQConsumer::workerLoop() {
+    while (true) {
+        WorkItem item;
+        {
+            std::unique_lock<std::mutex> lock(work_mutex_);
+            auto ready = [this] {
+                return std::any_of(work_queues_.begin(), work_queues_.end(),
+                                   [](const auto& queue) { return !queue.empty(); });
+            };
+            work_cv_.wait(lock, [this, &ready] { return ready() || !consuming_; });
+            if (!consuming_) {
+                break;
+            }
+            // По кругу, начиная со следующей очереди: глубокий буфер не отодвигает остальные
+            for (size_t i = 0; i < work_queues_.size(); ++i) {
+                auto& queue = work_queues_[(next_work_queue_ + i) % work_queues_.size()];
+                if (!queue.empty()) {
+                    item = std::move(queue.front());
+                    queue.pop_front();
+                    next_work_queue_ = (next_work_queue_ + i + 1) % work_queues_.size();
+                    break;
+                }
+            }
+        }
+        space_cv_.notify_one();
+        handle(item);
+    }
+}
+
 void RabbitMQConsumer::consumeLoop() {
     std::cout << "[RabbitMQ] Consumer loop started" << std::endl;
 
@@ -154,34 +571,48 @@ void RabbitMQConsumer::consumeLoop() {
             std::cout << "[RabbitMQ] Reconnected after disconnect" << std::endl;
         }
 
+        flushSettlements();
+        if (!consuming_) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            continue;
+        }
+
         amqp_envelope_t envelope;
         amqp_maybe_release_buffers(conn_);
 
-        struct timeval timeout = {0, 100000}; // 100ms timeout
+        // Таймаут также ограничивает задержку отправки отложенных ack
+        struct timeval timeout = {0, 20000}; // 20ms timeout
         amqp_rpc_reply_t reply = amqp_consume_message(conn_, &envelope, &timeout, 0);
 
         if (reply.reply_type == AMQP_RESPONSE_NORMAL) {
-            std::string routing_key(static_cast<char*>(envelope.routing_key.bytes),
-                                    envelope.routing_key.len);
-            std::string body(static_cast<char*>(envelope.message.body.bytes),
-                             envelope.message.body.len);
+            const size_t queue_index = envelope.channel - 1;
+            if (envelope.channel == 0 || queue_index >= config_.queues.size()) {
+                std::cerr << "[RabbitMQ] Delivery on unexpected channel " << envelope.channel
+                          << std::endl;
+                amqp_destroy_envelope(&envelope);
+                continue;
+            }
 
-            std::cout << "[RabbitMQ] Received message from queue '" << routing_key << "'"
-                      << std::endl;
-            std::cout << "[RabbitMQ] Message body: " << body << std::endl;
+            WorkItem item;
+            item.queue = config_.queues[queue_index];
+            item.body = std::make_shared<const std::string>(
+                static_cast<char*>(envelope.message.body.bytes), envelope.message.body.len);
+            const amqp_basic_properties_t& properties = envelope.message.properties;
+            if (properties._flags & AMQP_BASIC_CONTENT_TYPE_FLAG) {
+                item.content_type.assign(static_cast<char*>(properties.content_type.bytes),
+                                         properties.content_type.len);
+            }
+            item.tag = DeliveryTag{envelope.delivery_tag, generation_, envelope.channel};
+            amqp_destroy_envelope(&envelope);
+            unsettled_[queue_index].emplace(item.tag.tag, Unsettled{item.body, item.content_type});
 
-            try {
-                if (callback_) {
-                    callback_(routing_key, body);
-                }
-                amqp_basic_ack(conn_, 1, envelope.delivery_tag, 0);
-                std::cout << "[RabbitMQ] Message acknowledged" << std::endl;
-            } catch (const std::exception& e) {
-                std::cerr << "[RabbitMQ] Error processing message: " << e.what() << std::endl;
-                amqp_basic_reject(conn_, 1, envelope.delivery_tag, 1); // requeue
+            {
+                std::lock_guard<std::mutex> lock(settle_mutex_);
+                ++delivered_;
+                ++in_flight_[queue_index];
             }
 
-            amqp_destroy_envelope(&envelope);
+            dispatch(std::move(item));
         } else if (reply.reply_type == AMQP_RESPONSE_LIBRARY_EXCEPTION &&
                    reply.library_error == AMQP_STATUS_TIMEOUT) {
             // Timeout - это нормально, просто продолжаем
@@ -197,11 +628,20 @@ void RabbitMQConsumer::consumeLoop() {
         }
     }
 
+    // Ack/reject, поставленные до stop(), уходят до закрытия соединения
+    if (connected_ && conn_) {
+        flushSettlements();
+    }
     std::cout << "[RabbitMQ] Consumer loop stopped" << std::endl;
 }
 
 void RabbitMQConsumer::start() {
     running_ = true;
+    consuming_ = true;
+    for (size_t i = 0; i < config_.worker_threads; ++i) {
+        workers_.emplace_back(&RabbitMQConsumer::workerLoop, this);
+    }
+
     consumer_thread_ = std::thread([this]() {
         std::cout << "[RabbitMQ] Consumer started on queues: ";
         for (size_t i = 0; i < config_.queues.size(); ++i) {
@@ -209,15 +649,53 @@ void RabbitMQConsumer::start() {
             if (i < config_.queues.size() - 1)
                 std::cout << ", ";
         }
-        std::cout << std::endl;
+        std::cout << " (" << config_.worker_threads << " workers)" << std::endl;
 
         consumeLoop();
     });
 }
 
+void RabbitMQConsumer::stopConsuming() {
+    consuming_ = false;
+    work_cv_.notify_all();
+    space_cv_.notify_all();
+    for (auto& worker : workers_) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers_.clear();
+}
+
 void RabbitMQConsumer::stop() {
+    stopConsuming();
     running_ = false;
     if (consumer_thread_.joinable()) {
         consumer_thread_.join();
     }
+    disconnect();
+}
+
+ConsumerStats RabbitMQConsumer::stats() const {
+    ConsumerStats s;
+    {
+        std::lock_guard<std::mutex> lock(work_mutex_);
+        for (size_t i = 0; i < work_queues_.size(); ++i) {
+            s.work_queue_depth += work_queues_[i].size();
+            s.work_queue_depth_per_queue.emplace_back(config_.queues[i], work_queues_[i].size());
+        }
+    }
+    s.work_queue_capacity = config_.work_queue_capacity;
+
+    std::lock_guard<std::mutex> lock(settle_mutex_);
+    s.delivered = delivered_;
+    s.acked = acked_;
+    s.rejected = rejected_;
+    s.dead_lettered = dead_lettered_;
+    s.dead_letter_failures = dead_letter_failures_;
+    for (size_t i = 0; i < config_.queues.size(); ++i) {
+        s.in_flight_per_queue.emplace_back(config_.queues[i], in_flight_[i]);
+    }
+    s.in_flight = std::accumulate(in_flight_.begin(), in_flight_.end(), size_t{0});
+    return s;
 }
@@ -0,0 +1,753 @@
+#include "segment_store.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr char SEGMENT_MAGIC[4] = {'M', 'S', 'E', 'G'};
+constexpr uint32_t SEGMENT_VERSION = 1;
+constexpr const char* SEGMENT_EXT = ".seg";
+// Покрытие, записанное при штатной остановке; без него после падения покрытие
+// начинается заново — строки открытых сегментов пропали
+constexpr const char* COVERAGE_FILE = "coverage";
+constexpr int64_t MICROS_PER_DAY = 86400LL * 1000000;
+
+// Файл сегмента: заголовок, затем колонки подряд, каждая выровнена на 8 байт.
+// Числа в порядке байт хоста — файлы читает тот же сервис
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t kind;
+    uint32_t rows;
+    uint32_t words;
+    uint32_t word_bytes;
+    uint64_t seq;
+    int64_t min_received_us;
+    int64_t max_received_us;
+    int64_t min_timestamp;
+    int64_t max_timestamp;
+};
+
+static_assert(sizeof(FileHeader) == 64);
+
+size_t align8(size_t size) {
+    return (size + 7) & ~size_t(7);
+}
+
+// Раскладка колонок по смещениям; одна и та же для записи и чтения
+struct FileLayout {
+    size_t received = 0;
+    size_t timestamps = 0;
+    std::array<size_t, MAX_STRING_COLUMNS> strings{};
+    std::array<size_t, MAX_DOUBLE_COLUMNS> doubles{};
+    size_t ints = 0;
+    size_t word_offsets = 0;
+    size_t word_bytes = 0;
+    size_t total = 0;
+
+    FileLayout(const SegmentLayout& layout, uint32_t rows, uint32_t words, uint32_t bytes) {
+        size_t offset = sizeof(FileHeader);
+        auto place = [&offset](size_t size) {
+            size_t at = offset;
+            offset += align8(size);
+            return at;
+        };
+        received = place(rows * sizeof(uint32_t));
+        timestamps = place(rows * sizeof(int32_t));
+        for (size_t i = 0; i < layout.strings; ++i) {
+            strings[i] = place(rows * sizeof(uint32_t));
+        }
+        for (size_t i = 0; i < layout.doubles; ++i) {
+            doubles[i] = place(rows * sizeof(double));
+        }
+        ints = place(layout.ints * rows * sizeof(int32_t));
+        word_offsets = place((size_t(words) + 1) * sizeof(uint32_t));
+        word_bytes = place(bytes);
+        total = offset;
+    }
+};
+
+bool write_all(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool write_file(const std::string& path, const std::string& content) {
+    const std::string tmp = path + ".tmp";
+    int fd = ::open(tmp.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    bool ok = write_all(fd, content.data(), content.size()) && ::fsync(fd) == 0;
+    ::close(fd);
+    std::error_code ec;
+    if (ok) {
+        fs::rename(tmp, path, ec);
+    }
+    if (!ok || ec) {
+        fs::remove(tmp, ec);
+        return false;
+    }
+    return true;
+}
+
+int64_t now_us() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+std::string_view value_or_empty(const std::optional<std::string>& value) {
+    return value ? std::string_view(*value) : std::string_view();
+}
+
+// Ключ строки в порядке выдачи не больше after
+bool at_or_before(int64_t received_us, uint64_t segment, uint32_t row, const SegmentPosition& after) {
+    if (received_us != after.received_us) {
+        return received_us < after.received_us;
+    }
+    if (segment != after.segment) {
+        return segment < after.segment;
+    }
+    return row <= after.row;
+}
+
+enum class ScanState {
+    Continue,
+    Done
+};
+
+ScanState scan_columns(const SegmentColumns& c, const SegmentQuery& query, size_t& skipped, size_t& emitted,
+                       const SegmentStore::RowCallback& callback) {
+    if (c.rows == 0 || c.max_received_us < query.from_us) {
+        return ScanState::Continue;
+    }
+    if (c.min_received_us >= query.to_us) {
+        return ScanState::Done;
+    }
+    // Индекс min/max: сегмент целиком вне диапазона или уже выдан
+    if (query.time_range &&
+        (c.max_timestamp < query.time_range->first || c.min_timestamp > query.time_range->second)) {
+        return ScanState::Continue;
+    }
+    if (query.after && at_or_before(c.max_received_us, c.seq, c.rows - 1, *query.after)) {
+        return ScanState::Continue;
+    }
+
+    // Время приёма внутри сегмента не убывает — начало ищется двоичным поиском
+    int64_t lower = query.from_us;
+    if (query.after) {
+        lower = std::max(lower, query.after->received_us);
+    }
+    uint32_t row = 0;
+    if (lower > c.min_received_us) {
+        const auto delta = static_cast<uint32_t>(
+            std::min<int64_t>(lower - c.min_received_us, std::numeric_limits<uint32_t>::max()));
+        row = static_cast<uint32_t>(std::lower_bound(c.received, c.received + c.rows, delta) - c.received);
+    }
+
+    for (; row < c.rows; ++row) {
+        const int64_t received_us = c.receivedUs(row);
+        if (received_us >= query.to_us) {
+            return ScanState::Done;
+        }
+        if (query.after && at_or_before(received_us, c.seq, row, *query.after)) {
+            continue;
+        }
+        if (query.time_range) {
+            const int64_t timestamp = c.timestamp(row);
+            if (timestamp < query.time_range->first || timestamp > query.time_range->second) {
+                continue;
+            }
+        }
+        if (skipped < query.offset) {
+            ++skipped;
+            continue;
+        }
+        callback(c, row);
+        if (query.limit > 0 && ++emitted >= query.limit) {
+            return ScanState::Done;
+        }
+    }
+    return ScanState::Continue;
+}
+
+} // namespace
+
+SegmentLayout segment_layout(SegmentKind kind) {
+    switch (kind) {
+        case SegmentKind::PageView:
+            return {3, 0, 0};
+        case SegmentKind::Click:
+            return {5, 0, 0};
+        case SegmentKind::Performance:
+            return {3, 4, 0};
+        case SegmentKind::Error:
+            return {4, 0, 1};
+        case SegmentKind::Custom:
+            return {4, 0, 0};
+    }
+    return {};
+}
+
+const char* segment_kind_name(SegmentKind kind) {
+    switch (kind) {
+        case SegmentKind::PageView:
+            return "page_views";
+        case SegmentKind::Click:
+            return "click_events";
+        case SegmentKind::Performance:
+            return "performance_events";
+        case SegmentKind::Error:
+            return "error_events";
+        case SegmentKind::Custom:
+            return "custom_events";
+    }
+    return "unknown";
+}
+
+SegmentStoreConfig load_segment_store_config() {
+    const char* dir_env = std::getenv("SEGMENT_STORE_DIR");
+    const char* rows_env = std::getenv("SEGMENT_MAX_ROWS");
+    const char* age_env = std::getenv("SEGMENT_MAX_AGE_SEC");
+    const char* retention_env = std::getenv("SEGMENT_RETENTION_DAYS");
+
+    SegmentStoreConfig config;
+    if (dir_env) {
+        config.dir = dir_env;
+    }
+    if (rows_env) {
+        config.max_rows = std::max<size_t>(1, std::stoul(rows_env));
+    }
+    if (age_env) {
+        config.max_age = std::chrono::seconds(std::max(1L, std::stol(age_env)));
+    }
+    if (retention_env) {
+        config.retention_days = std::max(0, std::stoi(retention_env));
+    }
+    return config;
+}
+
+std::string segment_row_id(uint64_t segment, uint32_t row) {
+    // Шестнадцатеричные поля фиксированной ширины: сравнение UUID побайтно
+    // совпадает с порядком (segment, row). Последние 8 цифр — нули
+    char buffer[40];
+    std::snprintf(buffer, sizeof(buffer), "%08" PRIx32 "-%04" PRIx32 "-%04" PRIx32 "-%04" PRIx32 "-%04" PRIx32 "00000000",
+                  static_cast<uint32_t>(segment >> 32), static_cast<uint32_t>(segment >> 16) & 0xffff,
+                  static_cast<uint32_t>(segment) & 0xffff, row >> 16, row & 0xffff);
+    return buffer;
+}
+
+std::optional<std::pair<uint64_t, uint32_t>> parse_segment_row_id(const std::string& id) {
+    if (id.size() != 36 || id.compare(28, 8, "00000000") != 0) {
+        return std::nullopt;
+    }
+    uint64_t segment = 0;
+    uint32_t row = 0;
+    size_t digits = 0;
+    for (size_t i = 0; i < 28; ++i) {
+        const char ch = id[i];
+        if (i == 8 || i == 13 || i == 18 || i == 23) {
+            if (ch != '-') {
+                return std::nullopt;
+            }
+            continue;
+        }
+        uint32_t nibble = 0;
+        if (ch >= '0' && ch <= '9') {
+            nibble = static_cast<uint32_t>(ch - '0');
+        } else if (ch >= 'a' && ch <= 'f') {
+            nibble = static_cast<uint32_t>(ch - 'a' + 10);
+        } else {
+            return std::nullopt;
+        }
+        if (digits++ < 16) {
+            segment = (segment << 4) | nibble;
+        } else {
+            row = (row << 4) | nibble;
+        }
+    }
+    return std::make_pair(segment, row);
+}
+
+// ==================== SegmentBuilder ====================
+
+SegmentBuilder::SegmentBuilder(SegmentKind kind, uint64_t seq)
+    : kind_(kind), layout_(segment_layout(kind)), seq_(seq) {
+}
+
+bool SegmentBuilder::fits(int64_t received_us) const {
+    return received_.empty() ||
+           (received_us >= min_received_us_ &&
+            received_us - min_received_us_ <= std::numeric_limits<uint32_t>::max());
+}
+
+void SegmentBuilder::append(int64_t received_us, int64_t timestamp,
+                            const std::array<std::string_view, MAX_STRING_COLUMNS>& strings,
+                            const std::array<double, MAX_DOUBLE_COLUMNS>& doubles, int32_t integer) {
+    if (received_.empty()) {
+        min_received_us_ = received_us;
+    }
+    // Время события хранится дельтой от секунды приёма: обычно это единицы секунд
+    const int64_t received_s = received_us / 1000000;
+    const auto delta = static_cast<int32_t>(std::clamp<int64_t>(
+        timestamp - received_s, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()));
+    const int64_t stored = received_s + delta;
+
+    if (received_.empty()) {
+        min_timestamp_ = max_timestamp_ = stored;
+    } else {
+        min_timestamp_ = std::min(min_timestamp_, stored);
+        max_timestamp_ = std::max(max_timestamp_, stored);
+    }
+    max_received_us_ = received_us;
+
+    received_.push_back(static_cast<uint32_t>(received_us - min_received_us_));
+    timestamps_.push_back(delta);
+    for (size_t i = 0; i < layout_.strings; ++i) {
+        strings_[i].push_back(intern(strings[i]));
+    }
+    for (size_t i = 0; i < layout_.doubles; ++i) {
+        doubles_[i].push_back(doubles[i]);
+    }
+    if (layout_.ints > 0) {
+        ints_.push_back(integer);
+    }
+}
+
+uint32_t SegmentBuilder::intern(std::string_view value) {
+    auto it = dictionary_.find(std::string(value));
+    if (it != dictionary_.end()) {
+        return it->second;
+    }
+    const auto word = static_cast<uint32_t>(word_offsets_.size() - 1);
+    word_bytes_.append(value);
+    word_offsets_.push_back(static_cast<uint32_t>(word_bytes_.size()));
+    dictionary_.emplace(std::string(value), word);
+    return word;
+}
+
+SegmentColumns SegmentBuilder::columns() const {
+    SegmentColumns c;
+    c.seq = seq_;
+    c.rows = rows();
+    c.min_received_us = min_received_us_;
+    c.max_received_us = max_received_us_;
+    c.min_timestamp = min_timestamp_;
+    c.max_timestamp = max_timestamp_;
+    c.received = received_.data();
+    c.timestamps = timestamps_.data();
+    for (size_t i = 0; i < layout_.strings; ++i) {
+        c.strings[i] = strings_[i].data();
+    }
+    for (size_t i = 0; i < layout_.doubles; ++i) {
+        c.doubles[i] = doubles_[i].data();
+    }
+    c.ints = ints_.data();
+    c.words = static_cast<uint32_t>(word_offsets_.size() - 1);
+    c.word_offsets = word_offsets_.data();
+    c.word_bytes = word_bytes_.data();
+    return c;
+}
+
+bool SegmentBuilder::write(const std::string& path) const {
+    const uint32_t words = static_cast<uint32_t>(word_offsets_.size() - 1);
+    FileLayout file(layout_, rows(), words, static_cast<uint32_t>(word_bytes_.size()));
+
+    std::string content(file.total, '\0');
+    FileHeader header{};
+    std::memcpy(header.magic, SEGMENT_MAGIC, sizeof(header.magic));
+    header.version = SEGMENT_VERSION;
+    header.kind = static_cast<uint32_t>(kind_);
+    header.rows = rows();
+    header.words = words;
+    header.word_bytes = static_cast<uint32_t>(word_bytes_.size());
+    header.seq = seq_;
+    header.min_received_us = min_received_us_;
+    header.max_received_us = max_received_us_;
+    header.min_timestamp = min_timestamp_;
+    header.max_timestamp = max_timestamp_;
+    std::memcpy(content.data(), &header, sizeof(header));
+
+    auto put = [&content](size_t offset, const auto& column) {
+        if (!column.empty()) {
+            std::memcpy(content.data() + offset, column.data(), column.size() * sizeof(column[0]));
+        }
+    };
+    put(file.received, received_);
+    put(file.timestamps, timestamps_);
+    for (size_t i = 0; i < layout_.strings; ++i) {
+        put(file.strings[i], strings_[i]);
+    }
+    for (size_t i = 0; i < layout_.doubles; ++i) {
+        put(file.doubles[i], doubles_[i]);
+    }
+    put(file.ints, ints_);
+    put(file.word_offsets, word_offsets_);
+    put(file.word_bytes, word_bytes_);
+
+    return write_file(path, content);
+}
+
+// ==================== Segment ====================
+
+std::shared_ptr<Segment> Segment::open(const std::string& path, SegmentKind kind) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st{};
+    const size_t size = ::fstat(fd, &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+    void* data = size >= sizeof(FileHeader) ? mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+
+    std::shared_ptr<Segment> segment(new Segment());
+    segment->path_ = path;
+    segment->data_ = data;
+    segment->size_ = size;
+
+    FileHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    const SegmentLayout layout = segment_layout(kind);
+    if (std::memcmp(header.magic, SEGMENT_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != SEGMENT_VERSION || header.kind != static_cast<uint32_t>(kind) ||
+        FileLayout(layout, header.rows, header.words, header.word_bytes).total != size) {
+        return nullptr;
+    }
+
+    const auto* base = static_cast<const char*>(data);
+    FileLayout file(layout, header.rows, header.words, header.word_bytes);
+    SegmentColumns& c = segment->columns_;
+    c.seq = header.seq;
+    c.rows = header.rows;
+    c.min_received_us = header.min_received_us;
+    c.max_received_us = header.max_received_us;
+    c.min_timestamp = header.min_timestamp;
+    c.max_timestamp = header.max_timestamp;
+    c.received = reinterpret_cast<const uint32_t*>(base + file.received);
+    c.timestamps = reinterpret_cast<const int32_t*>(base + file.timestamps);
+    for (size_t i = 0; i < layout.strings; ++i) {
+        c.strings[i] = reinterpret_cast<const uint32_t*>(base + file.strings[i]);
+    }
+    for (size_t i = 0; i < layout.doubles; ++i) {
+        c.doubles[i] = reinterpret_cast<const double*>(base + file.doubles[i]);
+    }
+    c.ints = reinterpret_cast<const int32_t*>(base + file.ints);
+    c.words = header.words;
+    c.word_offsets = reinterpret_cast<const uint32_t*>(base + file.word_offsets);
+    c.word_bytes = base + file.word_bytes;
+
+    // Чтение не проверяет границы, поэтому словарь и ссылки на него проверяются здесь
+    for (uint32_t w = 0; w < c.words; ++w) {
+        if (c.word_offsets[w] > c.word_offsets[w + 1]) {
+            return nullptr;
+        }
+    }
+    if (c.word_offsets[c.words] > header.word_bytes) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < layout.strings; ++i) {
+        for (uint32_t row = 0; row < c.rows; ++row) {
+            if (c.strings[i][row] >= c.words) {
+                return nullptr;
+            }
+        }
+    }
+
+    madvise(data, size, MADV_SEQUENTIAL);
+    return segment;
+}
+
+Segment::~Segment() {
+    if (data_) {
+        munmap(data_, size_);
+    }
+}
+
+// ==================== SegmentStore ====================
+
+std::string SegmentStoreStats::toJson() const {
+    std::ostringstream out;
+    out << R"({"segments":)" << segments << R"(,"sealed_rows":)" << sealed_rows
+        << R"(,"open_rows":)" << open_rows << R"(,"bytes":)" << bytes << R"(,"appended":)" << appended
+        << R"(,"scans":)" << scans << R"(,"seal_failures":)" << seal_failures
+        << R"(,"dropped":)" << dropped << R"(,"covered_from_us":)" << covered_from_us << "}";
+    return out.str();
+}
+
+SegmentStore::SegmentStore(const SegmentStoreConfig& config) : config_(config) {
+    std::error_code ec;
+    for (size_t k = 0; k < SEGMENT_KINDS; ++k) {
+        fs::create_directories(fs::path(config_.dir) / segment_kind_name(static_cast<SegmentKind>(k)), ec);
+    }
+    load();
+    std::cout << "[SegmentStore] Opened " << config_.dir << ": " << stats_.segments
+              << " segments, covered from " << covered_from_us_ / 1000000 << std::endl;
+}
+
+SegmentStore::~SegmentStore() {
+    stop();
+}
+
+void SegmentStore::load() {
+    const fs::path coverage = fs::path(config_.dir) / COVERAGE_FILE;
+    bool clean = false;
+    {
+        std::ifstream in(coverage);
+        clean = static_cast<bool>(in >> covered_from_us_);
+    }
+    std::error_code ec;
+    fs::remove(coverage, ec);
+
+    for (size_t k = 0; k < SEGMENT_KINDS; ++k) {
+        const auto kind = static_cast<SegmentKind>(k);
+        std::vector<std::pair<uint64_t, fs::path>> files;
+        for (const auto& entry : fs::directory_iterator(fs::path(config_.dir) / segment_kind_name(kind), ec)) {
+            const auto& path = entry.path();
+            if (path.extension() == ".tmp") {
+                fs::remove(path, ec);
+            } else if (path.extension() == SEGMENT_EXT) {
+                files.emplace_back(std::strtoull(path.stem().c_str(), nullptr, 10), path);
+            }
+        }
+        std::sort(files.begin(), files.end());
+
+        for (const auto& [seq, path] : files) {
+            next_seq_ = std::max(next_seq_, seq + 1);
+            auto segment = Segment::open(path.string(), kind);
+            if (!segment) {
+                // Дыра в данных: покрытие не может начинаться раньше неё
+                std::cerr << "[SegmentStore] Skipping damaged segment " << path << std::endl;
+                clean = false;
+                continue;
+            }
+            stats_.segments++;
+            sealed_[k].push_back(std::move(segment));
+        }
+    }
+
+    if (!clean) {
+        covered_from_us_ = now_us();
+    }
+    stats_.covered_from_us = covered_from_us_;
+}
+
+std::string SegmentStore::segmentPath(SegmentKind kind, uint64_t seq) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016" PRIu64 "%s", seq, SEGMENT_EXT);
+    return (fs::path(config_.dir) / segment_kind_name(kind) / name).string();
+}
+
+void SegmentStore::append(const std::vector<PageView>& events, int64_t received_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& e : events) {
+        appendRow(SegmentKind::PageView, received_us, e.timestamp,
+                  {e.page, value_or_empty(e.user_id), value_or_empty(e.session_id)});
+    }
+}
+
+void SegmentStore::append(const std::vector<ClickEvent>& events, int64_t received_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& e : events) {
+        appendRow(SegmentKind::Click, received_us, e.timestamp,
+                  {e.page, value_or_empty(e.user_id), value_or_empty(e.session_id),
+                   value_or_empty(e.element_id), value_or_empty(e.action)});
+    }
+}
+
+void SegmentStore::append(const std::vector<PerformanceEvent>& events, int64_t received_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& e : events) {
+        appendRow(SegmentKind::Performance, received_us, e.timestamp,
+                  {e.page, value_or_empty(e.user_id), value_or_empty(e.session_id)},
+                  {e.ttfb_ms.value_or(0.0), e.fcp_ms.value_or(0.0), e.lcp_ms.value_or(0.0),
+                   e.total_page_load_ms.value_or(0.0)});
+    }
+}
+
+void SegmentStore::append(const std::vector<ErrorEvent>& events, int64_t received_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& e : events) {
+        appendRow(SegmentKind::Error, received_us, e.timestamp,
+                  {e.page, value_or_empty(e.user_id), value_or_empty(e.session_id),
+                   value_or_empty(e.error_type)},
+                  {}, e.severity.value_or(0));
+    }
+}
+
+void SegmentStore::append(const std::vector<CustomEvent>& events, int64_t received_us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& e : events) {
+        appendRow(SegmentKind::Custom, received_us, e.timestamp,
+                  {value_or_empty(e.page), value_or_empty(e.user_id), value_or_empty(e.session_id), e.name});
+    }
+}
+
+void SegmentStore::appendRow(SegmentKind kind, int64_t received_us, const std::optional<int64_t>& timestamp,
+                             const std::array<std::string_view, MAX_STRING_COLUMNS>& strings,
+                             const std::array<double, MAX_DOUBLE_COLUMNS>& doubles, int32_t integer) {
+    if (stopped_) {
+        return;
+    }
+    const auto k = static_cast<size_t>(kind);
+    auto& builder = open_[k];
+    const auto now = std::chrono::steady_clock::now();
+    // Порядок строк — порядок приёма; от отката часов спасает монотонность
+    received_us = std::max(received_us, last_received_us_[k]);
+    last_received_us_[k] = received_us;
+
+    if (builder && (builder->rows() >= config_.max_rows || !builder->fits(received_us) ||
+                    now - opened_at_[k] >= config_.max_age)) {
+        seal(kind);
+    }
+    if (!builder) {
+        builder = std::make_unique<SegmentBuilder>(kind, next_seq_++);
+        opened_at_[k] = now;
+    }
+
+    const int64_t now_s = received_us / 1000000;
+    builder->append(received_us, std::min(timestamp.value_or(now_s), now_s), strings, doubles, integer);
+    stats_.appended++;
+}
+
+void SegmentStore::seal(SegmentKind kind) {
+    const auto k = static_cast<size_t>(kind);
+    auto builder = std::move(open_[k]);
+    if (!builder || builder->rows() == 0) {
+        return;
+    }
+
+    const SegmentColumns columns = builder->columns();
+    const std::string path = segmentPath(kind, columns.seq);
+    std::shared_ptr<Segment> segment = builder->write(path) ? Segment::open(path, kind) : nullptr;
+    if (!segment) {
+        // Строки сегмента потеряны для хранилища: окна до них читаются из PostgreSQL
+        std::cerr << "[SegmentStore] Failed to seal " << path << std::endl;
+        stats_.seal_failures++;
+        covered_from_us_ = std::max(covered_from_us_, columns.max_received_us + 1);
+        stats_.covered_from_us = covered_from_us_;
+        return;
+    }
+
+    sealed_[k].push_back(std::move(segment));
+    stats_.segments++;
+    dropExpired(now_us());
+}
+
+void SegmentStore::dropExpired(int64_t now_us) {
+    if (config_.retention_days <= 0) {
+        return;
+    }
+    const int64_t cutoff = now_us - config_.retention_days * MICROS_PER_DAY;
+    bool dropped = false;
+    for (auto& segments : sealed_) {
+        while (!segments.empty() && segments.front()->columns().max_received_us < cutoff) {
+            std::error_code ec;
+            fs::remove(segments.front()->path(), ec);
+            segments.erase(segments.begin());
+            stats_.segments--;
+            stats_.dropped++;
+            dropped = true;
+        }
+    }
+    if (dropped) {
+        covered_from_us_ = std::max(covered_from_us_, cutoff);
+        stats_.covered_from_us = covered_from_us_;
+    }
+}
+
+bool SegmentStore::covers(int64_t from_us) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !stopped_ && from_us >= covered_from_us_;
+}
+
+size_t SegmentStore::scan(SegmentKind kind, const SegmentQuery& query, const RowCallback& callback) {
+    const auto k = static_cast<size_t>(kind);
+    std::vector<std::shared_ptr<Segment>> snapshot;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        snapshot = sealed_[k];
+        stats_.scans++;
+    }
+
+    size_t skipped = 0;
+    size_t emitted = 0;
+    uint64_t last_seq = 0;
+    for (const auto& segment : snapshot) {
+        last_seq = segment->columns().seq;
+        if (scan_columns(segment->columns(), query, skipped, emitted, callback) == ScanState::Done) {
+            return emitted;
+        }
+    }
+
+    // Открытый сегмент меняется при записи — читается под блокировкой, вместе
+    // с сегментами, закрытыми после снимка
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& segment : sealed_[k]) {
+        if (segment->columns().seq > last_seq &&
+            scan_columns(segment->columns(), query, skipped, emitted, callback) == ScanState::Done) {
+            return emitted;
+        }
+    }
+    if (open_[k]) {
+        scan_columns(open_[k]->columns(), query, skipped, emitted, callback);
+    }
+    return emitted;
+}
+
+void SegmentStore::stop() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopped_) {
+        return;
+    }
+    bool sealed = true;
+    for (size_t k = 0; k < SEGMENT_KINDS; ++k) {
+        const uint64_t failures = stats_.seal_failures;
+        seal(static_cast<SegmentKind>(k));
+        sealed = sealed && stats_.seal_failures == failures;
+    }
+    if (sealed) {
+        write_file((fs::path(config_.dir) / COVERAGE_FILE).string(), std::to_string(covered_from_us_));
+    }
+    stopped_ = true;
+    std::cout << "[SegmentStore] Stopped: " << stats_.segments << " segments" << std::endl;
+}
+
+SegmentStoreStats SegmentStore::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SegmentStoreStats stats = stats_;
+    for (size_t k = 0; k < SEGMENT_KINDS; ++k) {
+        for (const auto& segment : sealed_[k]) {
+            stats.sealed_rows += segment->columns().rows;
+            stats.bytes += segment->bytes();
+        }
+        if (open_[k]) {
+            stats.open_rows += open_[k]->rows();
+        }
+    }
+    return stats;
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include "batch_writer.h"
+
+#include <pqxx/pqxx>
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+PageView page_view(const std::string& page) {
+    PageView event;
+    event.page = page;
+    return event;
+}
+
+DeliveryTag delivery(uint64_t tag) {
+    DeliveryTag result;
+    result.tag = tag;
+    return result;
+}
+
+// Вместо COPY в PostgreSQL вызывает fail для каждой пачки
+class FailingWriter : public BatchWriter {
+  public:
+    using Fail = std::function<void(const std::vector<std::string>& pages)>;
+
+    explicit FailingWriter(Fail fail)
+        : BatchWriter(std::make_shared<ConnectionPool>(DatabaseConfig{}, ConnectionPoolConfig{}),
+                      config()),
+          fail_(std::move(fail)) {
+        setCommitCallback([this](const std::vector<DeliveryTag>& tags, WriteOutcome outcome) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& tag : tags) {
+                outcomes_.emplace_back(tag.tag, outcome);
+            }
+        });
+    }
+
+    ~FailingWriter() override { stop(); }
+
+    std::vector<std::pair<uint64_t, WriteOutcome>> outcomes() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return outcomes_;
+    }
+
+  protected:
+    void copyBatch(ConnectionPool::Lease&, const Batch& batch, int64_t) override {
+        std::vector<std::string> pages;
+        for (const auto& event : batch.page_views.events) {
+            pages.push_back(event.page);
+        }
+        fail_(pages);
+    }
+
+  private:
+    static BatchWriterConfig config() {
+        BatchWriterConfig config;
+        config.max_batch_size = 100;
+        config.max_latency = std::chrono::milliseconds(10);
+        return config;
+    }
+
+    Fail fail_;
+    std::mutex mutex_;
+    std::vector<std::pair<uint64_t, WriteOutcome>> outcomes_;
+};
+
+} // namespace
+
+TEST(BatchWriterTest, NonDataErrorRequeuesWholeBatch) {
+    FailingWriter writer([](const std::vector<std::string>&) {
+        throw pqxx::sql_error("canceling statement due to statement timeout");
+    });
+    writer.start();
+    for (uint64_t i = 1; i <= 4; ++i) {
+        writer.add(page_view("/p" + std::to_string(i)), delivery(i));
+    }
+    writer.stop();
+
+    // Одна попытка на всю пачку, без деления и без dead-letter
+    auto outcomes = writer.outcomes();
+    ASSERT_EQ(outcomes.size(), 4u);
+    for (const auto& [tag, outcome] : outcomes) {
+        EXPECT_EQ(outcome, WriteOutcome::Retry) << tag;
+    }
+}
+
+TEST(BatchWriterTest, DataErrorIsolatesBadEvent) {
+    FailingWriter writer([](const std::vector<std::string>& pages) {
+        for (const auto& page : pages) {
+            if (page == "/bad") {
+                throw pqxx::data_exception("invalid byte sequence for encoding \"UTF8\"");
+            }
+        }
+    });
+    writer.start();
+    writer.add(page_view("/a"), delivery(1));
+    writer.add(page_view("/bad"), delivery(2));
+    writer.add(page_view("/b"), delivery(3));
+    writer.stop();
+
+    auto outcomes = writer.outcomes();
+    ASSERT_EQ(outcomes.size(), 3u);
+    for (const auto& [tag, outcome] : outcomes) {
+        EXPECT_EQ(outcome, tag == 2 ? WriteOutcome::Rejected : WriteOutcome::Committed) << tag;
+    }
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "database.h"
+#include "connection_pool.h"
 #include <string>
 #include <optional>
 
@@ -50,6 +51,20 @@ TEST_F(DatabaseConfigTest, ConfigWithSpecialCharacters) {
     EXPECT_EQ(config.password, "p@$$w0rd!");
 }
 
+// ===== Тесты format_event_time =====
+
+TEST(EventTimeTest, FormatsClientTimestampInUtc) {
+    EXPECT_EQ(format_event_time(1733505600, 1733509200), "2024-12-06 17:20:00+00");
+}
+
+TEST(EventTimeTest, FutureTimestampClampedToNow) {
+    EXPECT_EQ(format_event_time(1733509200 + 3600, 1733509200), "2024-12-06 18:20:00+00");
+}
+
+TEST(EventTimeTest, MissingTimestampUsesNow) {
+    EXPECT_EQ(format_event_time(std::nullopt, 1733509200), "2024-12-06 18:20:00+00");
+}
+
 // ===== Тесты PageView =====
 
 class PageViewTest : public ::testing::Test {};
@@ -407,3 +422,50 @@ TEST_F(BoundaryConditionsTest, VerySmallDoublePerformance) {
     EXPECT_LT(perf.ttfb_ms.value(), 0.01);
 }
 
+
+// ===== Тесты ConnectionPool =====
+
+TEST(ConnectionPoolTest, ConstructionDoesNotConnect) {
+    DatabaseConfig config;
+    config.host = "nonexistent-host";
+
+    ConnectionPool pool(config, ConnectionPoolConfig{});
+    ConnectionPoolStats stats = pool.stats();
+
+    EXPECT_EQ(stats.open, 0u);
+    EXPECT_EQ(stats.in_use, 0u);
+    EXPECT_EQ(stats.checkouts, 0u);
+    EXPECT_EQ(stats.max_size, 10u);
+}
+
+TEST(ConnectionPoolTest, ConfigSizesAreClamped) {
+    setenv("DB_POOL_MIN_SIZE", "20", 1);
+    setenv("DB_POOL_MAX_SIZE", "0", 1);
+
+    ConnectionPoolConfig config = load_connection_pool_config();
+
+    EXPECT_EQ(config.max_size, 1u);
+    EXPECT_EQ(config.min_size, 1u);
+
+    unsetenv("DB_POOL_MIN_SIZE");
+    unsetenv("DB_POOL_MAX_SIZE");
+}
+
+TEST(ConnectionPoolTest, UtilizationOfEmptyStats) {
+    ConnectionPoolStats stats;
+    EXPECT_DOUBLE_EQ(stats.utilization(), 0.0);
+
+    stats.max_size = 4;
+    stats.in_use = 3;
+    EXPECT_DOUBLE_EQ(stats.utilization(), 0.75);
+}
+
+TEST(ConnectionPoolTest, StatsJsonContainsCounters) {
+    ConnectionPoolStats stats;
+    stats.max_size = 8;
+    stats.timeouts = 2;
+
+    std::string json = stats.toJson();
+    EXPECT_NE(json.find("\"max_size\":8"), std::string::npos);
+    EXPECT_NE(json.find("\"timeouts\":2"), std::string::npos);
+}
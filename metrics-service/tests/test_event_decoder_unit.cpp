@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "event_decoder.h"
+#include "metrics.pb.h"
+#include <string>
+#include <variant>
+
+// ===== Тесты decode_event =====
+
+TEST(EventDecoderTest, DecodesProtobufPageView) {
+    metricsys::PageViewEvent message;
+    message.set_page("/home");
+    message.set_user_id("user-123");
+    message.set_timestamp(1700000000);
+
+    auto decoded = decode_event("page_views", CONTENT_TYPE_PROTOBUF, message.SerializeAsString());
+    ASSERT_TRUE(std::holds_alternative<PageView>(decoded));
+    const auto& event = std::get<PageView>(decoded);
+    EXPECT_EQ(event.page, "/home");
+    ASSERT_TRUE(event.user_id.has_value());
+    EXPECT_EQ(*event.user_id, "user-123");
+    EXPECT_FALSE(event.session_id.has_value());
+    EXPECT_FALSE(event.referrer.has_value());
+    ASSERT_TRUE(event.timestamp.has_value());
+    EXPECT_EQ(*event.timestamp, 1700000000);
+}
+
+TEST(EventDecoderTest, DecodesJsonWithAndWithoutContentType) {
+    const std::string body = R"({"page":"/home","element_id":"btn","action":null,"timestamp":1700000000})";
+    for (std::string_view content_type : {std::string_view(), CONTENT_TYPE_JSON}) {
+        auto decoded = decode_event("clicks", content_type, body);
+        ASSERT_TRUE(std::holds_alternative<ClickEvent>(decoded));
+        const auto& event = std::get<ClickEvent>(decoded);
+        EXPECT_EQ(event.page, "/home");
+        EXPECT_EQ(event.element_id, "btn");
+        EXPECT_FALSE(event.action.has_value());
+        EXPECT_EQ(event.timestamp, 1700000000);
+    }
+}
+
+TEST(EventDecoderTest, ProtobufAndJsonAgreeOnPerformance) {
+    metricsys::PerformanceEvent message;
+    message.set_page("/checkout");
+    message.set_lcp_ms(910.25);
+    message.set_session_id("s-1");
+    const std::string body = R"({"page":"/checkout","lcp_ms":910.25,"session_id":"s-1"})";
+
+    auto proto = std::get<PerformanceEvent>(decode_event("performance_events", CONTENT_TYPE_PROTOBUF,
+                                                         message.SerializeAsString()));
+    auto text = std::get<PerformanceEvent>(decode_event("performance_events", CONTENT_TYPE_JSON, body));
+    EXPECT_EQ(proto.page, text.page);
+    EXPECT_EQ(proto.lcp_ms, text.lcp_ms);
+    EXPECT_EQ(proto.ttfb_ms, text.ttfb_ms);
+    EXPECT_EQ(proto.session_id, text.session_id);
+    EXPECT_FALSE(proto.ttfb_ms.has_value());
+    // Без метки времени в сообщении timestamp остаётся пустым — время ставит БД
+    EXPECT_FALSE(proto.timestamp.has_value());
+    EXPECT_FALSE(text.timestamp.has_value());
+}
+
+TEST(EventDecoderTest, SeverityMatchesJsonEncoding) {
+    const std::pair<metricsys::Severity, const char*> cases[] = {
+        {metricsys::SEVERITY_WARNING, "warning"},
+        {metricsys::SEVERITY_ERROR, "error"},
+        {metricsys::SEVERITY_CRITICAL, "critical"},
+    };
+    for (const auto& [severity, name] : cases) {
+        metricsys::ErrorEvent message;
+        message.set_page("/home");
+        message.set_severity(severity);
+        auto proto = std::get<ErrorEvent>(
+            decode_event("error_events", CONTENT_TYPE_PROTOBUF, message.SerializeAsString()));
+        auto text = std::get<ErrorEvent>(
+            decode_event("error_events", CONTENT_TYPE_JSON, std::string(R"({"page":"/home","severity":")") + name + "\"}"));
+        EXPECT_EQ(proto.severity, text.severity) << name;
+    }
+
+    metricsys::ErrorEvent unspecified;
+    unspecified.set_page("/home");
+    auto event = std::get<ErrorEvent>(
+        decode_event("error_events", CONTENT_TYPE_PROTOBUF, unspecified.SerializeAsString()));
+    EXPECT_FALSE(event.severity.has_value());
+}
+
+TEST(EventDecoderTest, DecodesCustomEvent) {
+    metricsys::CustomEvent message;
+    message.set_name("signup");
+    message.set_page("/register");
+    (*message.mutable_properties())["plan"] = "pro";
+
+    auto event = std::get<CustomEvent>(
+        decode_event("custom_events", CONTENT_TYPE_PROTOBUF, message.SerializeAsString()));
+    EXPECT_EQ(event.name, "signup");
+    ASSERT_TRUE(event.page.has_value());
+    EXPECT_EQ(*event.page, "/register");
+}
+
+TEST(EventDecoderTest, RejectsBadInput) {
+    EXPECT_THROW(decode_event("unknown", CONTENT_TYPE_JSON, "{}"), std::invalid_argument);
+    EXPECT_THROW(decode_event("page_views", "text/plain", "{}"), std::invalid_argument);
+    EXPECT_THROW(decode_event("page_views", CONTENT_TYPE_JSON, "not json"), std::invalid_argument);
+    EXPECT_THROW(decode_event("page_views", CONTENT_TYPE_JSON, R"({"user_id":42})"), std::invalid_argument);
+    EXPECT_THROW(decode_event("page_views", CONTENT_TYPE_PROTOBUF, std::string("\xff\xff\xff", 3)),
+                 std::invalid_argument);
+}
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "partition_manager.h"
+#include "database.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+using namespace std::chrono;
+
+namespace {
+
+sys_days make_day(int y, unsigned m, unsigned d) {
+    return sys_days(year(y) / month(m) / day(d));
+}
+
+} // namespace
+
+// ===== Имена партиций =====
+
+TEST(PartitionNameTest, FormatsDaySuffix) {
+    EXPECT_EQ(partition_name("page_views", make_day(2024, 12, 6)), "page_views_p20241206");
+    EXPECT_EQ(partition_name("custom_events", make_day(2025, 1, 31)), "custom_events_p20250131");
+}
+
+TEST(PartitionNameTest, ParsesOwnNamesOnly) {
+    EXPECT_EQ(partition_day("page_views", "page_views_p20241206"), make_day(2024, 12, 6));
+
+    EXPECT_FALSE(partition_day("page_views", "page_views_default").has_value());
+    EXPECT_FALSE(partition_day("page_views", "click_events_p20241206").has_value());
+    EXPECT_FALSE(partition_day("page_views", "page_views_p2024120").has_value());
+    EXPECT_FALSE(partition_day("page_views", "page_views_p20241332").has_value());
+}
+
+TEST(PartitionNameTest, RoundTripsAcrossYearBoundary) {
+    for (auto d = make_day(2024, 12, 25); d < make_day(2025, 1, 5); d += days(1)) {
+        EXPECT_EQ(partition_day("error_events", partition_name("error_events", d)), d);
+    }
+}
+
+TEST(PartitionSqlTest, CoversOneUtcDay) {
+    EXPECT_EQ(create_partition_sql("page_views", make_day(2024, 2, 29)),
+              "CREATE TABLE IF NOT EXISTS page_views_p20240229 PARTITION OF page_views "
+              "FOR VALUES FROM ('2024-02-29 00:00:00+00') TO ('2024-03-01 00:00:00+00')");
+}
+
+// ===== Строки в DEFAULT =====
+
+TEST(MoveDefaultRowsTest, DetachesMovesEachDayAndReattaches) {
+    EXPECT_EQ(default_partition_name("click_events"), "click_events_default");
+
+    auto statements = move_default_rows_sql("page_views", {make_day(2024, 12, 6), make_day(2024, 12, 7)});
+    const std::string day6 = "received_at >= '2024-12-06 00:00:00+00' AND received_at < '2024-12-07 00:00:00+00'";
+    EXPECT_EQ(statements, (std::vector<std::string>{
+        "ALTER TABLE page_views DETACH PARTITION page_views_default",
+        create_partition_sql("page_views", make_day(2024, 12, 6)),
+        "INSERT INTO page_views_p20241206 SELECT * FROM page_views_default WHERE " + day6,
+        "DELETE FROM page_views_default WHERE " + day6,
+        create_partition_sql("page_views", make_day(2024, 12, 7)),
+        "INSERT INTO page_views_p20241207 SELECT * FROM page_views_default WHERE "
+        "received_at >= '2024-12-07 00:00:00+00' AND received_at < '2024-12-08 00:00:00+00'",
+        "DELETE FROM page_views_default WHERE "
+        "received_at >= '2024-12-07 00:00:00+00' AND received_at < '2024-12-08 00:00:00+00'",
+        "ALTER TABLE page_views ATTACH PARTITION page_views_default DEFAULT",
+    }));
+}
+
+// ===== Срок хранения =====
+
+TEST(ExpiredPartitionsTest, DropsOnlyWholeDaysPastRetention) {
+    const std::vector<std::string> names = {
+        "page_views_p20241201", "page_views_p20241202", "page_views_p20241203",
+        "page_views_p20241204", "page_views_default",
+    };
+
+    // Срок 2 дня от 5-го: данные до 3-го числа 00:00 устарели целиком
+    auto expired = expired_partitions("page_views", names, make_day(2024, 12, 5), 2);
+    EXPECT_EQ(expired, (std::vector<std::string>{"page_views_p20241201", "page_views_p20241202"}));
+}
+
+TEST(ExpiredPartitionsTest, ZeroRetentionKeepsEverything) {
+    const std::vector<std::string> names = {"page_views_p20200101"};
+    EXPECT_TRUE(expired_partitions("page_views", names, make_day(2024, 12, 5), 0).empty());
+}
+
+// ===== Литералы времени для отсечения партиций =====
+
+TEST(FormatUtcTimeTest, FormatsTimestamptzLiteral) {
+    EXPECT_EQ(format_utc_time(0), "1970-01-01 00:00:00+00");
+    EXPECT_EQ(format_utc_time(1733479200), "2024-12-06 10:00:00+00");
+    EXPECT_EQ(format_utc_time_us(1733479200000042), "2024-12-06 10:00:00.000042+00");
+}
+
+TEST(PartitionManagerStatsTest, ToJson) {
+    PartitionManagerStats stats;
+    stats.runs = 3;
+    stats.failures = 1;
+    stats.created = 15;
+    stats.dropped = 5;
+    stats.moved_rows = 7;
+    stats.partitions = 20;
+    stats.default_rows = 2;
+    EXPECT_EQ(stats.toJson(), R"({"runs":3,"failures":1,"created":15,"dropped":5,"moved_rows":7,)"
+                              R"("partitions":20,"default_rows":2})");
+}
+
+TEST(PartitionManagerConfigTest, LoadsFromEnvironment) {
+    setenv("PARTITION_PREMAKE_DAYS", "5", 1);
+    setenv("PARTITION_RETENTION_DAYS", "0", 1);
+    setenv("PARTITION_CHECK_INTERVAL_SEC", "60", 1);
+
+    auto config = load_partition_manager_config();
+    EXPECT_EQ(config.premake_days, 5);
+    EXPECT_EQ(config.retention_days, 0);
+    EXPECT_EQ(config.check_interval, seconds(60));
+
+    unsetenv("PARTITION_PREMAKE_DAYS");
+    unsetenv("PARTITION_RETENTION_DAYS");
+    unsetenv("PARTITION_CHECK_INTERVAL_SEC");
+}
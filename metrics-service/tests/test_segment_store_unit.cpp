@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include "segment_store.h"
+
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr int64_t T0 = 1733479200LL * 1000000;  // 2024-12-06 10:00:00 UTC
+
+PageView page_view(const std::string& page, const std::string& user, std::optional<int64_t> timestamp = {}) {
+    PageView event;
+    event.page = page;
+    event.user_id = user;
+    event.session_id = "sess-" + user;
+    event.referrer = "https://example.com";
+    event.timestamp = timestamp;
+    return event;
+}
+
+struct Row {
+    int64_t received_us;
+    int64_t timestamp;
+    std::string page;
+    std::string user;
+    SegmentPosition position;
+};
+
+} // namespace
+
+// ===== id строк сегмента =====
+
+TEST(SegmentRowIdTest, RoundTripsAndKeepsOrder) {
+    const std::string a = segment_row_id(1, 65535);
+    const std::string b = segment_row_id(1, 65536);
+    const std::string c = segment_row_id(0x100000000ULL, 0);
+
+    EXPECT_EQ(a.size(), 36u);
+    EXPECT_LT(a, b);
+    EXPECT_LT(b, c);
+    EXPECT_EQ(parse_segment_row_id(b), std::make_pair(uint64_t{1}, uint32_t{65536}));
+    EXPECT_EQ(parse_segment_row_id(c), std::make_pair(uint64_t{0x100000000ULL}, uint32_t{0}));
+
+    EXPECT_FALSE(parse_segment_row_id("550e8400-e29b-41d4-a716-446655440000").has_value());
+    EXPECT_FALSE(parse_segment_row_id("").has_value());
+}
+
+// ===== SegmentBuilder и Segment =====
+
+class SegmentStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dir_ = fs::path(::testing::TempDir()) /
+               ("segments_" + std::string(::testing::UnitTest::GetInstance()->current_test_info()->name()));
+        fs::remove_all(dir_);
+    }
+
+    void TearDown() override { fs::remove_all(dir_); }
+
+    SegmentStoreConfig config(size_t max_rows = 1000) const {
+        SegmentStoreConfig config;
+        config.dir = dir_.string();
+        config.max_rows = max_rows;
+        config.retention_days = 0;
+        return config;
+    }
+
+    size_t segmentFiles(const char* kind) const {
+        size_t count = 0;
+        for (const auto& entry : fs::directory_iterator(dir_ / kind)) {
+            count += entry.path().extension() == ".seg" ? 1 : 0;
+        }
+        return count;
+    }
+
+    static std::vector<Row> scan(SegmentStore& store, SegmentQuery query) {
+        std::vector<Row> rows;
+        store.scan(SegmentKind::PageView, query, [&rows](const SegmentColumns& s, uint32_t row) {
+            rows.push_back({s.receivedUs(row), s.timestamp(row), std::string(s.string(COL_PAGE, row)),
+                            std::string(s.string(COL_USER_ID, row)), {s.receivedUs(row), s.seq, row}});
+        });
+        return rows;
+    }
+
+    static SegmentQuery window(int64_t from_us, int64_t to_us, size_t limit = 0) {
+        SegmentQuery query;
+        query.from_us = from_us;
+        query.to_us = to_us;
+        query.limit = limit;
+        return query;
+    }
+
+    fs::path dir_;
+};
+
+TEST_F(SegmentStoreTest, BuilderWritesFileThatMapsBack) {
+    fs::create_directories(dir_);
+    SegmentBuilder builder(SegmentKind::Performance, 7);
+    builder.append(T0, T0 / 1000000 - 5, {"/home", "u1", "s1"}, {100.0, 200.0, 300.0, 400.0}, 0);
+    builder.append(T0 + 250, T0 / 1000000, {"/home", "u2", "s2"}, {1.5, 2.5, 3.5, 4.5}, 0);
+
+    const std::string path = (dir_ / "perf.seg").string();
+    ASSERT_TRUE(builder.write(path));
+    EXPECT_EQ(Segment::open(path, SegmentKind::PageView), nullptr);
+
+    auto segment = Segment::open(path, SegmentKind::Performance);
+    ASSERT_NE(segment, nullptr);
+    const auto& c = segment->columns();
+    EXPECT_EQ(c.seq, 7u);
+    EXPECT_EQ(c.rows, 2u);
+    // "/home" хранится в словаре один раз
+    EXPECT_EQ(c.words, 5u);
+    EXPECT_EQ(c.receivedUs(1), T0 + 250);
+    EXPECT_EQ(c.timestamp(0), T0 / 1000000 - 5);
+    EXPECT_EQ(c.min_timestamp, T0 / 1000000 - 5);
+    EXPECT_EQ(c.max_timestamp, T0 / 1000000);
+    EXPECT_EQ(c.string(COL_PAGE, 1), "/home");
+    EXPECT_EQ(c.string(COL_USER_ID, 1), "u2");
+    EXPECT_DOUBLE_EQ(c.number(COL_TOTAL_LOAD, 1), 4.5);
+}
+
+TEST_F(SegmentStoreTest, RejectsTruncatedFile) {
+    fs::create_directories(dir_);
+    SegmentBuilder builder(SegmentKind::PageView, 1);
+    builder.append(T0, T0 / 1000000, {"/a", "u", "s"}, {}, 0);
+    const std::string path = (dir_ / "a.seg").string();
+    ASSERT_TRUE(builder.write(path));
+
+    fs::resize_file(path, fs::file_size(path) - 8);
+    EXPECT_EQ(Segment::open(path, SegmentKind::PageView), nullptr);
+}
+
+// ===== SegmentStore =====
+
+TEST_F(SegmentStoreTest, ScansWindowAcrossSealedAndOpenSegments) {
+    SegmentStore store(config(2));
+    for (int i = 0; i < 5; ++i) {
+        store.append(std::vector<PageView>{page_view("/p" + std::to_string(i), "u")}, T0 + i * 1000000);
+    }
+    EXPECT_EQ(segmentFiles("page_views"), 2u);
+
+    auto rows = scan(store, window(T0 + 1000000, T0 + 4000000));
+    ASSERT_EQ(rows.size(), 3u);
+    EXPECT_EQ(rows[0].page, "/p1");
+    EXPECT_EQ(rows[2].page, "/p3");
+    // Без метки время события — время приёма
+    EXPECT_EQ(rows[0].timestamp, (T0 + 1000000) / 1000000);
+
+    auto stats = store.stats();
+    EXPECT_EQ(stats.sealed_rows, 4u);
+    EXPECT_EQ(stats.open_rows, 1u);
+}
+
+TEST_F(SegmentStoreTest, ContinuesAfterCursorWithinSameReceiveTime) {
+    SegmentStore store(config(3));
+    std::vector<PageView> batch;
+    for (int i = 0; i < 7; ++i) {
+        batch.push_back(page_view("/p" + std::to_string(i), "u"));
+    }
+    store.append(batch, T0);
+
+    std::vector<std::string> pages;
+    SegmentQuery query = window(T0, T0 + 1, 2);
+    while (true) {
+        auto rows = scan(store, query);
+        for (const auto& row : rows) {
+            pages.push_back(row.page);
+        }
+        if (rows.size() < query.limit) {
+            break;
+        }
+        query.after = rows.back().position;
+    }
+    EXPECT_EQ(pages, (std::vector<std::string>{"/p0", "/p1", "/p2", "/p3", "/p4", "/p5", "/p6"}));
+}
+
+TEST_F(SegmentStoreTest, FiltersByEventTimeAndClampsFutureTimestamps) {
+    SegmentStore store(config());
+    const int64_t received_s = T0 / 1000000;
+    store.append(std::vector<PageView>{page_view("/old", "u", received_s - 3600),
+                                       page_view("/new", "u", received_s - 10),
+                                       page_view("/future", "u", received_s + 3600)},
+                 T0);
+
+    SegmentQuery query = window(T0, T0 + 1);
+    query.time_range = std::make_pair(received_s - 60, received_s);
+    auto rows = scan(store, query);
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(rows[0].page, "/new");
+    EXPECT_EQ(rows[1].page, "/future");
+    EXPECT_EQ(rows[1].timestamp, received_s);
+}
+
+TEST_F(SegmentStoreTest, CleanStopKeepsCoverageAndSegments) {
+    int64_t covered_from = 0;
+    {
+        SegmentStore store(config());
+        covered_from = store.stats().covered_from_us;
+        store.append(std::vector<PageView>{page_view("/a", "u1"), page_view("/b", "u2")}, T0);
+        store.stop();
+        EXPECT_FALSE(store.covers(covered_from));
+    }
+
+    SegmentStore reopened(config());
+    EXPECT_TRUE(reopened.covers(covered_from));
+    auto rows = scan(reopened, window(T0, T0 + 1));
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(rows[1].user, "u2");
+
+    // Новые сегменты продолжают нумерацию
+    reopened.append(std::vector<PageView>{page_view("/c", "u3")}, T0 + 1);
+    rows = scan(reopened, window(T0, T0 + 2));
+    ASSERT_EQ(rows.size(), 3u);
+    EXPECT_GT(rows[2].position.segment, rows[1].position.segment);
+}
+
+TEST_F(SegmentStoreTest, DamagedSegmentResetsCoverage) {
+    int64_t covered_from = 0;
+    {
+        SegmentStore store(config());
+        covered_from = store.stats().covered_from_us;
+        store.append(std::vector<PageView>{page_view("/a", "u")}, T0);
+    }
+    for (const auto& entry : fs::directory_iterator(dir_ / "page_views")) {
+        fs::resize_file(entry.path(), 16);
+    }
+
+    SegmentStore reopened(config());
+    EXPECT_FALSE(reopened.covers(covered_from));
+    EXPECT_EQ(reopened.stats().segments, 0u);
+}
+
+TEST_F(SegmentStoreTest, RetentionDropsWholeSegments) {
+    SegmentStoreConfig cfg = config(1);
+    cfg.retention_days = 1;
+    SegmentStore store(cfg);
+
+    // Срок хранения отсчитывается от текущего времени
+    const int64_t now_us = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    const int64_t old_us = now_us - 10LL * 86400 * 1000000;
+    store.append(std::vector<PageView>{page_view("/old", "u")}, old_us);
+    store.append(std::vector<PageView>{page_view("/old2", "u")}, old_us + 1);
+    // Закрытие сегментов запускает удаление старых
+    store.append(std::vector<PageView>{page_view("/new", "u")}, now_us);
+    store.append(std::vector<PageView>{page_view("/new2", "u")}, now_us + 1);
+
+    EXPECT_EQ(store.stats().dropped, 2u);
+    EXPECT_EQ(segmentFiles("page_views"), 1u);
+    EXPECT_FALSE(store.covers(old_us));
+    auto rows = scan(store, window(old_us, now_us + 2));
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(rows[0].page, "/new");
+}
+
+TEST_F(SegmentStoreTest, StatsToJson) {
+    SegmentStoreStats stats;
+    stats.segments = 2;
+    stats.sealed_rows = 100;
+    stats.open_rows = 3;
+    stats.bytes = 4096;
+    stats.appended = 103;
+    stats.scans = 5;
+    stats.covered_from_us = 42;
+    EXPECT_EQ(stats.toJson(),
+              R"({"segments":2,"sealed_rows":100,"open_rows":3,"bytes":4096,"appended":103,)"
+              R"("scans":5,"seal_failures":0,"dropped":0,"covered_from_us":42})");
+}